@@ -22,11 +22,13 @@
 
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "b_u585i_iot02a.h"
+#include "b_u585i_iot02a_ospi.h"
 
 /* Exported types ----------------------------------------------------------------------------------------------------*/
 /* Exported constants ------------------------------------------------------------------------------------------------*/
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
 int bsp_init(void);
+int bsp_ospi_nor_map(const uint8_t **area, uint32_t *area_size);
 
 #endif /* BSP_H */
@@ -54,7 +54,7 @@
 /*#define HAL_NAND_MODULE_ENABLED      */
 /*#define HAL_NOR_MODULE_ENABLED       */
 /*#define HAL_OPAMP_MODULE_ENABLED     */
-/*#define HAL_OSPI_MODULE_ENABLED      */
+#define HAL_OSPI_MODULE_ENABLED
 /*#define HAL_OSPI_MODULE_ENABLED      */
 /*#define HAL_OTFDEC_MODULE_ENABLED    */
 /*#define HAL_PCD_MODULE_ENABLED       */
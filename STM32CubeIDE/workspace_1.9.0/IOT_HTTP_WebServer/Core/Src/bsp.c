@@ -50,3 +50,32 @@ int bsp_init(void)
 
   return status;
 }
+
+/**
+  * @brief  Map the OSPI NOR flash in the address space, for its content to be read in place
+  * @param  area      : pointer to the mapped area start, NULL if not mapped
+  * @param  area_size : pointer to the mapped area size
+  * @retval BSP status
+  */
+int bsp_ospi_nor_map(const uint8_t **area, uint32_t *area_size)
+{
+  BSP_OSPI_NOR_Init_t init = {BSP_OSPI_NOR_OPI_MODE, BSP_OSPI_NOR_DTR_TRANSFER};
+  BSP_OSPI_NOR_Info_t info;
+  int status = BSP_ERROR_NONE;
+
+  *area      = NULL;
+  *area_size = 0U;
+
+  /* Initialize the flash in octal DTR mode, then map it through OCTOSPI2 */
+  status |= BSP_OSPI_NOR_Init(0, &init);
+  status |= BSP_OSPI_NOR_GetInfo(0, &info);
+  status |= BSP_OSPI_NOR_EnableMemoryMappedMode(0);
+
+  if (status == BSP_ERROR_NONE)
+  {
+    *area      = (const uint8_t *)OCTOSPI2_BASE;
+    *area_size = info.FlashSize;
+  }
+
+  return status;
+}
@@ -74,7 +74,9 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
 static int32_t HTS221_GetOutputDataRate(HTS221_Object_t *pObj, float *Odr);
 static int32_t HTS221_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 static int32_t HTS221_Initialize(HTS221_Object_t *pObj);
-static float Linear_Interpolation(lin_t *Lin, float Coeff);
+static int32_t HTS221_ReadCalibration(HTS221_Object_t *pObj);
+static int32_t Linear_Calibration(lin_t *Lin, HTS221_Calib_t *Calib);
+static float Linear_Interpolation(HTS221_Calib_t *Calib, int16_t Raw);
 
 /**
  * @}
@@ -313,35 +315,15 @@ int32_t HTS221_HUM_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_humidity;
-  lin_t lin_hum;
-
-  if (hts221_hum_adc_point_0_get(&(pObj->Ctx), &lin_hum.x0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_rh_point_0_get(&(pObj->Ctx), &lin_hum.y0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_adc_point_1_get(&(pObj->Ctx), &lin_hum.x1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_rh_point_1_get(&(pObj->Ctx), &lin_hum.y1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
 
+  /* Calibration is read once at init, only the sample is read here */
   (void)memset(&data_raw_humidity.i16bit, 0x00, sizeof(int16_t));
   if (hts221_humidity_raw_get(&(pObj->Ctx), &data_raw_humidity.i16bit) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_hum, (float)data_raw_humidity.i16bit);
+  *Value = Linear_Interpolation(&pObj->hum_calib, data_raw_humidity.i16bit);
 
   if (*Value < 0.0f)
   {
@@ -461,35 +443,15 @@ int32_t HTS221_TEMP_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_temperature;
-  lin_t lin_temp;
-
-  if (hts221_temp_adc_point_0_get(&(pObj->Ctx), &lin_temp.x0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_temp_deg_point_0_get(&(pObj->Ctx), &lin_temp.y0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_temp_adc_point_1_get(&(pObj->Ctx), &lin_temp.x1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_temp_deg_point_1_get(&(pObj->Ctx), &lin_temp.y1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
 
+  /* Calibration is read once at init, only the sample is read here */
   (void)memset(&data_raw_temperature.i16bit, 0x00, sizeof(int16_t));
   if (hts221_temperature_raw_get(&(pObj->Ctx), &data_raw_temperature.i16bit) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_temp, (float)data_raw_temperature.i16bit);
+  *Value = Linear_Interpolation(&pObj->temp_calib, data_raw_temperature.i16bit);
 
   return HTS221_OK;
 }
@@ -699,6 +661,75 @@ static int32_t HTS221_Initialize(HTS221_Object_t *pObj)
     return HTS221_ERROR;
   }
 
+  /* Read the factory calibration once */
+  if (HTS221_ReadCalibration(pObj) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  return HTS221_OK;
+}
+
+/**
+ * @brief  Read the HTS221 factory calibration points and cache them as calibration lines
+ * @param  pObj the device pObj
+ * @retval 0 in case of success, an error code otherwise
+ */
+static int32_t HTS221_ReadCalibration(HTS221_Object_t *pObj)
+{
+  lin_t lin_hum;
+  lin_t lin_temp;
+
+  if (hts221_hum_adc_point_0_get(&(pObj->Ctx), &lin_hum.x0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_rh_point_0_get(&(pObj->Ctx), &lin_hum.y0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_adc_point_1_get(&(pObj->Ctx), &lin_hum.x1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_hum_rh_point_1_get(&(pObj->Ctx), &lin_hum.y1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_adc_point_0_get(&(pObj->Ctx), &lin_temp.x0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_deg_point_0_get(&(pObj->Ctx), &lin_temp.y0) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_adc_point_1_get(&(pObj->Ctx), &lin_temp.x1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (hts221_temp_deg_point_1_get(&(pObj->Ctx), &lin_temp.y1) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (Linear_Calibration(&lin_hum, &pObj->hum_calib) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  if (Linear_Calibration(&lin_temp, &pObj->temp_calib) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
   return HTS221_OK;
 }
 
@@ -718,14 +749,45 @@ int32_t HTS221_Enable_DRDY_Interrupt(HTS221_Object_t *pObj)
 }
 
 /**
- * @brief  Function used to apply coefficient
- * @param  Lin the line
- * @param  Coeff the coefficient
+ * @brief  Function used to compute the fixed point calibration line going through two points.
+ *         The slope is rounded to 2^-HTS221_CALIB_SHIFT and the line goes exactly through (x0, y0), so for slopes
+ *         below 0.05 per raw unit, as on real parts, a value is within |Raw - x0| * 2^-HTS221_CALIB_SHIFT of the
+ *         exact line (4e-3 at most over the raw range), plus the float rounding of the result.
+ * @param  Lin the calibration points
+ * @param  Calib the calibration line
+ * @retval 0 in case of success, an error code if the points do not give a usable line
+ */
+static int32_t Linear_Calibration(lin_t *Lin, HTS221_Calib_t *Calib)
+{
+  float one = (float)(1UL << HTS221_CALIB_SHIFT);
+  float slope;
+
+  if (Lin->x1 == Lin->x0)
+  {
+    return HTS221_ERROR;
+  }
+
+  /* Slope must fit its 32 bits, y0 is a multiple of 1/8 below 128 so y0 * 2^24 is exact */
+  slope = ((Lin->y1 - Lin->y0) * one) / (Lin->x1 - Lin->x0);
+  if ((slope >= (64.0f * one)) || (slope <= (-64.0f * one)))
+  {
+    return HTS221_ERROR;
+  }
+  Calib->Slope  = (int32_t)((slope >= 0.0f) ? (slope + 0.5f) : (slope - 0.5f));
+  Calib->Offset = (int64_t)(Lin->y0 * one) - ((int64_t)Calib->Slope * (int64_t)Lin->x0);
+
+  return HTS221_OK;
+}
+
+/**
+ * @brief  Function used to apply a calibration line
+ * @param  Calib the calibration line
+ * @param  Raw the raw output
  * @retval Calculation result
  */
-static float Linear_Interpolation(lin_t *Lin, float Coeff)
+static float Linear_Interpolation(HTS221_Calib_t *Calib, int16_t Raw)
 {
-  return (((Lin->y1 - Lin->y0) * Coeff) + ((Lin->x1 * Lin->y0) - (Lin->x0 * Lin->y1))) / (Lin->x1 - Lin->x0);
+  return (float)(((int64_t)Calib->Slope * Raw) + Calib->Offset) / (float)(1UL << HTS221_CALIB_SHIFT);
 }
 
 /**
@@ -70,6 +70,13 @@ typedef struct
   float y1;
 } lin_t;
 
+/* Calibration line of an output, value = (Slope * raw + Offset) / 2^HTS221_CALIB_SHIFT */
+typedef struct
+{
+  int32_t Slope;
+  int64_t Offset;
+} HTS221_Calib_t;
+
 typedef struct
 {
   HTS221_IO_t        IO;
@@ -77,6 +84,8 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            hum_is_enabled;
   uint8_t            temp_is_enabled;
+  HTS221_Calib_t     hum_calib;
+  HTS221_Calib_t     temp_calib;
 } HTS221_Object_t;
 
 typedef struct
@@ -150,6 +159,9 @@ typedef union{
 #define HTS221_OK                 0
 #define HTS221_ERROR             -1
 
+/** Fractional bits of the calibration lines **/
+#define HTS221_CALIB_SHIFT       24U
+
 /**
  * @}
  */
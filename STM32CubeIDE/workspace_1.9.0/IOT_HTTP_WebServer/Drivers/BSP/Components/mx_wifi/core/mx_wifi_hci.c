@@ -44,6 +44,10 @@
 static hci_send_func_t tcl_output = NULL;
 /* HCI recv data queue */
 static FIFO_DECLARE(hci_pkt_fifo);
+#if (MX_WIFI_USE_SPI == 0)
+/* SLIP frames are encoded and sent through it, a command at a time under lockcmd */
+static uint8_t hci_slip_buffer[MX_WIFI_UART_TX_BUFFER_SIZE];
+#endif /* MX_WIFI_USE_SPI */
 
 static bool mx_wifi_hci_pkt_verify(uint8_t *data, uint16_t len);
 
@@ -80,10 +84,9 @@ int32_t mx_wifi_hci_deinit(void)
 int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
 {
   int32_t ret = 0;
-  uint16_t sent = 0;
 
 #if MX_WIFI_USE_SPI
-  sent = tcl_output(payload, len);
+  uint16_t sent = tcl_output(payload, len);
   if (len != sent)
   {
     DEBUG_ERROR("tcl_output(spi) error sent=%d !\n", sent);
@@ -94,30 +97,10 @@ int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
     ret = 0;
   }
 #else
-  uint8_t *slip_frame = NULL;
-  uint16_t slip_len = 0;
-
-  slip_frame = slip_transfer(payload, len, &slip_len);
-  if ((NULL != slip_frame) && (slip_len > 0))
-  {
-    sent = tcl_output(slip_frame, slip_len);
-    if (slip_len == sent)
-    {
-      ret = 0;
-    }
-    else
-    {
-      DEBUG_ERROR("tcl_output(uart) error sent=%d !\r\n", sent);
-      ret = -1;
-    }
-
-    MX_WIFI_FREE(slip_frame);
-    slip_frame = NULL;
-  }
-  else
+  if (0U == slip_encode(payload, len, hci_slip_buffer, sizeof(hci_slip_buffer), tcl_output))
   {
-    DEBUG_ERROR("create slip frame error!\r\n");
-    ret = -2;
+    DEBUG_ERROR("tcl_output(uart) error !\r\n");
+    ret = -1;
   }
 #endif /* MX_WIFI_USE_SPI */
 
@@ -125,6 +108,12 @@ int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
 }
 
 void process_txrx_poll(uint32_t timeout);
+bool process_tx_pending(void);
+
+bool mx_wifi_hci_tx_pending(void)
+{
+  return process_tx_pending();
+}
 
 mx_buf_t *mx_wifi_hci_recv(uint32_t timeout)
 {
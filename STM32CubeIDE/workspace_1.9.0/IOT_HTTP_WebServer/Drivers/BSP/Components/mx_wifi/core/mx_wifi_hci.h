@@ -60,6 +60,7 @@ typedef uint16_t (*hci_send_func_t)(uint8_t *data, uint16_t size);
   */
 int32_t mx_wifi_hci_init(hci_send_func_t low_level_send);
 int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len);
+bool mx_wifi_hci_tx_pending(void);
 mx_buf_t *mx_wifi_hci_recv(uint32_t timeout);
 void mx_wifi_hci_free(mx_buf_t *nbuf);
 int32_t mx_wifi_hci_deinit(void);
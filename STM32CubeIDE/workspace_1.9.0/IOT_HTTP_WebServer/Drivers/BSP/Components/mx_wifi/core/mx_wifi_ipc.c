@@ -38,8 +38,12 @@
 #define DEBUG_LOG(M, ...)
 #endif /* MX_WIFI_IPC_DEBUG */
 
+/* Commands in flight at a time, a power of two: a request is found from its req_id as list[req_id % size] */
 #define MIPC_REQ_LIST_SIZE      (64)
 
+/* Declare HAL Tick based on a period of 1 ms. */
+extern uint32_t HAL_GetTick(void);
+
 /**
   * @brief IPC API event handlers
   */
@@ -62,18 +66,32 @@ event_item_t event_table[3] =
 /**
   * @brief IPC API request list
   */
-typedef struct _mipc_req_s
+struct _mipc_req_s
 {
-  uint32_t req_id;
+  bool busy;              /* owned by a caller of mipc_request() */
+  uint32_t req_id;        /* MIPC_REQ_ID_NONE once answered */
   SEM_DECLARE(resp_flag);
   uint16_t *rbuffer_size; /* in/out*/
   uint8_t *rbuffer;
-} mipc_req_t;
+  mx_buf_t **rnetbuf;     /* answer buffer handed over as is, instead of copied to rbuffer */
+  uint16_t api_id;
+  uint32_t sent_id;       /* req_id the command was sent with */
+  uint8_t *cbuf;          /* command buffer to free once answered, NULL if sent in place */
+  uint32_t tickstart;
+};
 
 
-static mipc_req_t pending_request;
+static mipc_req_t pending_request[MIPC_REQ_LIST_SIZE];
+
+static mx_ipc_stat_t mipc_stat;
 
 static uint32_t get_new_req_id(void);
+static mipc_req_t *mipc_req_alloc(uint32_t *req_id);
+static int32_t mipc_tx_wait(uint32_t timeout_ms);
+static int32_t mipc_request_post(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size, mx_buf_t **rnetbuf, mipc_req_t **request);
+static int32_t mipc_request_send(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size, mx_buf_t **rnetbuf, uint32_t timeout_ms);
 static uint32_t mpic_get_req_id(uint8_t *buffer_in);
 static uint16_t mpic_get_api_id(uint8_t *buffer_in);
 static uint32_t mipc_event(mx_buf_t *netbuf);
@@ -82,9 +100,33 @@ static uint32_t mipc_event(mx_buf_t *netbuf);
 static uint32_t get_new_req_id(void)
 {
   static uint32_t id = 1;
+
+  if (MIPC_REQ_ID_NONE == id)
+  {
+    id++;
+  }
   return id++;
 }
 
+/* take a free request entry and the req_id keying it, lockcmd held */
+static mipc_req_t *mipc_req_alloc(uint32_t *req_id)
+{
+  mipc_req_t *req;
+
+  for (uint32_t i = 0; i < MIPC_REQ_LIST_SIZE; i++)
+  {
+    *req_id = get_new_req_id();
+    req = &pending_request[*req_id % MIPC_REQ_LIST_SIZE];
+    if (false == req->busy)
+    {
+      req->busy = true;
+      req->req_id = *req_id;
+      return req;
+    }
+  }
+  return NULL;
+}
+
 static uint32_t mpic_get_req_id(uint8_t *buffer_in)
 {
   return *((uint32_t *) & (buffer_in[MIPC_PKT_REQ_ID_OFFSET]));
@@ -114,30 +156,57 @@ static uint32_t mipc_event(mx_buf_t *netbuf)
       DEBUG_LOG("req_id: 0x%08"PRIx32", api_id: 0x%04x\n", req_id, api_id);
       if ((0 == (api_id & MIPC_API_EVENT_BASE)) && (MIPC_REQ_ID_NONE != req_id))
       {
-        /* cmd response must match pending req id */
-        MX_ASSERT(pending_request.req_id == req_id);
+        /* cmd responses come in any order, each one for the request keyed by its req id */
+        mipc_req_t *req = &pending_request[req_id % MIPC_REQ_LIST_SIZE];
+
+        LOCK(wifi_obj_get()->lockcmd);
+        if ((true == req->busy) && (req->req_id == req_id) && (NULL != req->rnetbuf))
+        {
+          /* return the buffer itself, params first */
+          MX_NET_BUFFER_HIDE_HEADER(netbuf, MIPC_PKT_PARAMS_OFFSET);
+          MX_NET_BUFFER_SET_PAYLOAD_SIZE(netbuf, buffer_size - MIPC_PKT_PARAMS_OFFSET);
+          *(req->rnetbuf) = netbuf;
+          netbuf = NULL;
+          req->req_id = MIPC_REQ_ID_NONE;
+          if (SEM_OK != SEM_SIGNAL(req->resp_flag))
+          {
+            DEBUG_ERROR("Failed to signal command response\n");
+            while (1);
+          }
+          MX_STAT(cmd_get_answer);
+        }
+        else if ((true == req->busy) && (req->req_id == req_id))
         {
           /* return params */
-          if ((pending_request.rbuffer_size != NULL) && (*(pending_request.rbuffer_size) > 0)
-              && (NULL != pending_request.rbuffer))
+          if ((req->rbuffer_size != NULL) && (*(req->rbuffer_size) > 0) && (NULL != req->rbuffer))
           {
-            *(pending_request.rbuffer_size) = *(pending_request.rbuffer_size) < (buffer_size - MIPC_PKT_MIN_SIZE) ? \
-                                              *(pending_request.rbuffer_size) : (buffer_size - MIPC_PKT_MIN_SIZE);
-            memcpy(pending_request.rbuffer, buffer_in + MIPC_PKT_PARAMS_OFFSET, *(pending_request.rbuffer_size));
+            *(req->rbuffer_size) = *(req->rbuffer_size) < (buffer_size - MIPC_PKT_MIN_SIZE) ? \
+                                   *(req->rbuffer_size) : (buffer_size - MIPC_PKT_MIN_SIZE);
+            memcpy(req->rbuffer, buffer_in + MIPC_PKT_PARAMS_OFFSET, *(req->rbuffer_size));
           }
-          /* printf("Signal for %d\n",pending_request.req_id); */
-          pending_request.req_id = 0xFFFFFFFF;
-          if (SEM_OK != SEM_SIGNAL(pending_request.resp_flag))
+          /* printf("Signal for %d\n",req_id); */
+          req->req_id = MIPC_REQ_ID_NONE;
+          if (SEM_OK != SEM_SIGNAL(req->resp_flag))
           {
             DEBUG_ERROR("Failed to signal command response\n");
             while (1);
           }
           MX_STAT(cmd_get_answer);
+        }
+        else
+        {
+          /* answer to a command that already timed out */
+          DEBUG_LOG("no request waiting for %"PRIu32"\n", req_id);
+        }
+        UNLOCK(wifi_obj_get()->lockcmd);
+        if (NULL != netbuf)
+        {
           mx_wifi_hci_free(netbuf);
         }
       }
       else /* event callback */
       {
+        mipc_stat.events++;
         for (i = 0; i < sizeof(event_table) / sizeof(event_item_t); i++)
         {
           if (event_table[i].api_id == api_id)
@@ -180,8 +249,13 @@ int32_t mipc_init(mipc_send_func_t ipc_send)
 {
   int32_t ret;
 
-  pending_request.req_id = 0xFFFFFFFF;
-  SEM_INIT(pending_request.resp_flag, 1);
+  for (uint32_t i = 0; i < MIPC_REQ_LIST_SIZE; i++)
+  {
+    pending_request[i].busy = false;
+    pending_request[i].req_id = MIPC_REQ_ID_NONE;
+    SEM_INIT(pending_request[i].resp_flag, 1);
+  }
+  (void)memset(&mipc_stat, 0, sizeof(mipc_stat));
 
   ret = mx_wifi_hci_init(ipc_send);
 
@@ -192,15 +266,41 @@ int32_t mipc_init(mipc_send_func_t ipc_send)
 int32_t mipc_deinit(void)
 {
   int32_t ret;
-  SEM_DEINIT(pending_request.resp_flag);
+  for (uint32_t i = 0; i < MIPC_REQ_LIST_SIZE; i++)
+  {
+    SEM_DEINIT(pending_request[i].resp_flag);
+  }
   ret = mx_wifi_hci_deinit();
 
   return ret;
 }
 
 
-int32_t mipc_request(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
-                     uint8_t *rbuffer, uint16_t *rbuffer_size, uint32_t timeout_ms)
+/* wait until the link layer sent its pending frame: it holds one, a new one would replace it */
+static int32_t mipc_tx_wait(uint32_t timeout_ms)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  while (true == mx_wifi_hci_tx_pending())
+  {
+    if ((HAL_GetTick() - tickstart) > timeout_ms)
+    {
+      DEBUG_ERROR("Error: link layer busy, timeout(%" PRIu32 " ms)\n", timeout_ms);
+      return MIPC_CODE_TIMEOUT;
+    }
+#if (MX_WIFI_USE_CMSIS_OS == 0)
+    /* the frame goes with the next link poll, run it from the IPC poll so that the received frames are handled */
+    mipc_poll(1);
+#else
+    DELAYms(1);
+#endif /* MX_WIFI_USE_CMSIS_OS */
+  }
+  return MIPC_CODE_SUCCESS;
+}
+
+
+static int32_t mipc_request_post(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size, mx_buf_t **rnetbuf, mipc_req_t **request)
 {
   int32_t ret = MIPC_CODE_ERROR;
 
@@ -209,15 +309,19 @@ int32_t mipc_request(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
   uint16_t cbuf_size;
   uint32_t req_id;
   bool copy_buffer = true;
+  mipc_req_t *req;
+
+  *request = NULL;
 
-  LOCK(wifi_obj_get()->lockcmd);
   if (cparams_size <= MX_WIFI_IPC_PAYLOAD_SIZE)
   {
     /* create cmd data */
     cbuf_size = sizeof(req_id) + sizeof(api_id) + cparams_size;
 
 #if MX_WIFI_TX_BUFFER_NO_COPY
-    if (api_id == MIPC_API_WIFI_BYPASS_OUT_CMD)
+    /* these commands come with room for the header in front of their parameters */
+    if ((api_id == MIPC_API_WIFI_BYPASS_OUT_CMD) || (api_id == MIPC_API_SOCKET_SEND_CMD) ||
+        (api_id == MIPC_API_SOCKET_SENDTO_CMD))
     {
       cbuf = cparams - sizeof(req_id) - sizeof(api_id);
       copy_buffer = false;
@@ -230,59 +334,186 @@ int32_t mipc_request(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
 
     if (NULL != cbuf)
     {
-      /* get an uniq identifier */
-      req_id = get_new_req_id();
-      /* copy the protocol parameter to the head part of the buffer */
-      pos = cbuf;
-      memcpy(pos, &req_id, sizeof(req_id));
-      pos += sizeof(req_id);
-      memcpy(pos, &api_id, sizeof(api_id));
-      pos += sizeof(api_id);
-
-      if ((true == copy_buffer) && (cparams_size > 0))
+#if (MX_WIFI_USE_CMSIS_OS == 0)
+      /* polled outside lockcmd, the answers handled meanwhile take it */
+      ret = mipc_tx_wait(MX_WIFI_CMD_TIMEOUT);
+#endif /* MX_WIFI_USE_CMSIS_OS */
+      /* lockcmd only covers the request list and the command send, not the wait for the answer:
+         other commands can be sent meanwhile, and be answered before this one */
+      LOCK(wifi_obj_get()->lockcmd);
+#if (MX_WIFI_USE_CMSIS_OS == 1)
+      ret = mipc_tx_wait(MX_WIFI_CMD_TIMEOUT);
+#endif /* MX_WIFI_USE_CMSIS_OS */
+      /* get an uniq identifier, keying a free request entry */
+      req = (MIPC_CODE_SUCCESS == ret) ? mipc_req_alloc(&req_id) : NULL;
+      if (MIPC_CODE_SUCCESS != ret)
       {
-        memcpy(pos, cparams, cparams_size);
+        UNLOCK(wifi_obj_get()->lockcmd);
       }
-
-      /* a single pending request due to LOCK usage on command */
-      if (pending_request.req_id != 0xFFFFFFFF)
+      else if (NULL == req)
       {
-        DEBUG_LOG("Error req_id must be 0xffffffff here %"PRIu32"\n", pending_request.req_id);
-        while (1);
+        UNLOCK(wifi_obj_get()->lockcmd);
+        DEBUG_ERROR("Error: command 0x%04x, %d commands already in flight\n", api_id, MIPC_REQ_LIST_SIZE);
+        ret = MIPC_CODE_NO_MEMORY;
       }
-      pending_request.req_id = req_id;
-      pending_request.rbuffer = rbuffer;
-      pending_request.rbuffer_size = rbuffer_size;
-      /* static int iter=0;                       */
-      /* printf("%d push %d\n",iter++,cbuf_size); */
-
-      /* send the command */
-      DEBUG_LOG("cmd %"PRIu32"\n", req_id);
-      ret = mx_wifi_hci_send(cbuf, cbuf_size);
-      if (ret == 0)
+      else
       {
-        /* wait for command answer */
-        if (SEM_WAIT(pending_request.resp_flag, timeout_ms, mipc_poll) != SEM_OK)
+        req->rbuffer = rbuffer;
+        req->rbuffer_size = rbuffer_size;
+        req->rnetbuf = rnetbuf;
+        req->api_id = api_id;
+        req->sent_id = req_id;
+        req->cbuf = (true == copy_buffer) ? cbuf : NULL;
+
+        /* copy the protocol parameter to the head part of the buffer */
+        pos = cbuf;
+        memcpy(pos, &req_id, sizeof(req_id));
+        pos += sizeof(req_id);
+        memcpy(pos, &api_id, sizeof(api_id));
+        pos += sizeof(api_id);
+
+        if ((true == copy_buffer) && (cparams_size > 0))
         {
-          DEBUG_ERROR("Error: command 0x%04x timeout(%" PRIu32 " ms) waiting answer %" PRIu32 "\n",
-                      api_id, timeout_ms, pending_request.req_id);
-          pending_request.req_id = 0xFFFFFFFF;
-          ret = MIPC_CODE_ERROR;
+          memcpy(pos, cparams, cparams_size);
+        }
+        /* static int iter=0;                       */
+        /* printf("%d push %d\n",iter++,cbuf_size); */
+
+        /* send the command */
+        DEBUG_LOG("cmd %"PRIu32"\n", req_id);
+        ret = mx_wifi_hci_send(cbuf, cbuf_size);
+        UNLOCK(wifi_obj_get()->lockcmd);
+        if (ret == 0)
+        {
+          mipc_stat.requests++;
+          req->tickstart = HAL_GetTick();
+          *request = req;
+          /* the command buffer is freed once answered */
+          copy_buffer = false;
+        }
+        else
+        {
+          DEBUG_ERROR("Failed to send command to Hci\n");
+          while (1);
         }
       }
-      else
-      {
-        DEBUG_ERROR("Failed to send command to Hci\n");
-        while (1);
-      }
-      DEBUG_LOG("done %"PRIu32"\n", req_id);
       if (true == copy_buffer)
       {
         MX_WIFI_FREE(cbuf);
       }
     }
   }
-  UNLOCK(wifi_obj_get()->lockcmd);
+
+  return ret;
+}
+
+
+static int32_t mipc_request_send(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size, mx_buf_t **rnetbuf, uint32_t timeout_ms)
+{
+  int32_t ret;
+  mipc_req_t *req;
+
+  ret = mipc_request_post(api_id, cparams, cparams_size, rbuffer, rbuffer_size, rnetbuf, &req);
+  if (NULL != req)
+  {
+    ret = mipc_request_wait(req, timeout_ms);
+  }
+
+  return ret;
+}
+
+
+int32_t mipc_request(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                     uint8_t *rbuffer, uint16_t *rbuffer_size, uint32_t timeout_ms)
+{
+  return mipc_request_send(api_id, cparams, cparams_size, rbuffer, rbuffer_size, NULL, timeout_ms);
+}
+
+
+/**
+  * @brief                   mipc request sent without waiting for its answer, several being in flight at a time
+  * @param  api_id           command
+  * @param  cparams          command parameters, for the commands sent in place they must stay valid until the
+  *                          answer has been waited for
+  * @param  cparams_size     command parameters size
+  * @param  rbuffer          answer buffer, filled when answered
+  * @param  rbuffer_size     answer buffer size (in/out)
+  * @param  req              request (out), to wait for with mipc_request_wait(), NULL if not sent
+  * @return int32_t          MIPC_CODE_SUCCESS if sent, otherwise failed
+  */
+int32_t mipc_request_start(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                           uint8_t *rbuffer, uint16_t *rbuffer_size, mipc_req_t **req)
+{
+  return mipc_request_post(api_id, cparams, cparams_size, rbuffer, rbuffer_size, NULL, req);
+}
+
+
+/**
+  * @brief                   wait for the answer of a request sent with mipc_request_start(), and release it
+  * @param  req              request
+  * @param  timeout_ms       timeout in ms, from the call
+  * @return int32_t          MIPC_CODE_SUCCESS if answered, otherwise failed
+  */
+int32_t mipc_request_wait(mipc_req_t *req, uint32_t timeout_ms)
+{
+  int32_t ret = MIPC_CODE_SUCCESS;
+  bool answered;
+
+  /* wait for command answer */
+  if (SEM_WAIT(req->resp_flag, timeout_ms, mipc_poll) != SEM_OK)
+  {
+    /* the answer may have come in between the timeout and the lock, its signal is then pending */
+    LOCK(wifi_obj_get()->lockcmd);
+    answered = (MIPC_REQ_ID_NONE == req->req_id);
+    req->req_id = MIPC_REQ_ID_NONE;
+    UNLOCK(wifi_obj_get()->lockcmd);
+    if (true == answered)
+    {
+      (void)SEM_WAIT(req->resp_flag, WAIT_FOREVER, mipc_poll);
+    }
+    else
+    {
+      mipc_stat.timeouts++;
+      DEBUG_ERROR("Error: command 0x%04x timeout(%" PRIu32 " ms) waiting answer %" PRIu32 "\n",
+                  req->api_id, timeout_ms, req->sent_id);
+      ret = MIPC_CODE_ERROR;
+    }
+  }
+  mipc_stat.wait_ms += HAL_GetTick() - req->tickstart;
+
+  DEBUG_LOG("done %"PRIu32"\n", req->sent_id);
+  if (NULL != req->cbuf)
+  {
+    MX_WIFI_FREE(req->cbuf);
+  }
+  req->busy = false;
+
+  return ret;
+}
+
+
+/**
+  * @brief                   mipc request, the answer buffer being handed over instead of copied
+  * @param  api_id           command
+  * @param  cparams          command parameters
+  * @param  cparams_size     command parameters size
+  * @param  rnetbuf          answer buffer (out), its payload starting with the answer params, NULL if none. It must be
+  *                          released with MX_NET_BUFFER_FREE().
+  * @param  timeout_ms       timeout in ms
+  * @return int32_t          MIPC_CODE_SUCCESS if answered, otherwise failed
+  */
+int32_t mipc_request_netbuf(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                            mx_buf_t **rnetbuf, uint32_t timeout_ms)
+{
+  int32_t ret;
+
+  *rnetbuf = NULL;
+  ret = mipc_request_send(api_id, cparams, cparams_size, NULL, NULL, rnetbuf, timeout_ms);
+  if ((MIPC_CODE_SUCCESS != ret) || (NULL == *rnetbuf))
+  {
+    ret = MIPC_CODE_ERROR;
+  }
 
   return ret;
 }
@@ -316,6 +547,16 @@ void mipc_poll(uint32_t timeout)
 }
 
 
+/**
+  * @brief                   mipc statistics
+  * @param  stat             statistics (out)
+  */
+void mipc_stat_get(mx_ipc_stat_t *stat)
+{
+  *stat = mipc_stat;
+}
+
+
 int32_t mipc_echo(uint8_t *in, uint16_t in_len, uint8_t *out, uint16_t *out_len,
                   uint32_t timeout)
 {
@@ -156,6 +156,7 @@ extern "C" {
 
 /* Exported typedef ----------------------------------------------------------*/
 typedef uint16_t (*mipc_send_func_t)(uint8_t *data, uint16_t size);
+typedef struct _mipc_req_s mipc_req_t;
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -166,10 +167,18 @@ int32_t mipc_deinit(void);
 /* ipc api request */
 int32_t mipc_request(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
                      uint8_t *rbuffer, uint16_t *rbuffer_size, uint32_t timeout_ms);
+int32_t mipc_request_netbuf(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                            mx_buf_t **rnetbuf, uint32_t timeout_ms);
+int32_t mipc_request_start(uint16_t api_id, uint8_t *cparams, uint16_t cparams_size,
+                           uint8_t *rbuffer, uint16_t *rbuffer_size, mipc_req_t **req);
+int32_t mipc_request_wait(mipc_req_t *req, uint32_t timeout_ms);
 
 /* ipc handle response/event */
 void mipc_poll(uint32_t timeout);
 
+/* ipc statistics */
+void mipc_stat_get(mx_ipc_stat_t *stat);
+
 /* ipc echo test */
 int32_t mipc_echo(uint8_t *in, uint16_t in_len, uint8_t *out, uint16_t *out_len,
                   uint32_t timeout);
@@ -21,6 +21,7 @@
 /*cstat -MISRAC2012-* */
 #include "stdio.h"
 #include "stdlib.h"
+#include "string.h"
 /*cstat +MISRAC2012-* */
 
 #include "mx_wifi_conf.h"
@@ -47,54 +48,127 @@ enum
 };
 
 
-uint8_t *slip_transfer(uint8_t *data, uint16_t len, uint16_t *outlen)
+/* word at a time scan: a byte of the word is special if its XOR with the special byte is zero */
+#define SLIP_WORD_ONES          (0x01010101UL)
+#define SLIP_WORD_HIGHS         (0x80808080UL)
+#define SLIP_WORD_ZERO(x)       (((x) - SLIP_WORD_ONES) & ~(x) & SLIP_WORD_HIGHS)
+
+#define SLIP_IS_SPECIAL(c)      (((c) == SLIP_START) || ((c) == SLIP_END) || ((c) == SLIP_ESCAPE))
+
+static uint16_t slip_plain_run(const uint8_t *data, uint16_t len);
+static bool slip_flush(uint8_t *buf, uint16_t *fill, uint32_t *total, slip_output_func_t output);
+
+
+/* length of the data head to send as is, with no byte to escape */
+static uint16_t slip_plain_run(const uint8_t *data, uint16_t len)
 {
-  uint16_t i;
-  uint16_t j;
-  uint16_t inc = 2;
-  uint8_t *buff = NULL;
+  uint16_t i = 0;
+  uint32_t word;
 
-  for (i = 0; i < len; i++)
+  /* non special words skipped 4 bytes at a time, the one holding a special byte is then scanned byte per byte */
+  while ((len - i) >= sizeof(word))
   {
-    if ((data[i] == SLIP_START) || (data[i] == SLIP_END) || (data[i] == SLIP_ESCAPE))
+    memcpy(&word, &data[i], sizeof(word));
+    if ((SLIP_WORD_ZERO(word ^ (SLIP_WORD_ONES * SLIP_START)) |
+         SLIP_WORD_ZERO(word ^ (SLIP_WORD_ONES * SLIP_END)) |
+         SLIP_WORD_ZERO(word ^ (SLIP_WORD_ONES * SLIP_ESCAPE))) != 0U)
     {
-      inc++;
+      break;
     }
+    i += sizeof(word);
   }
 
-  buff = (uint8_t *)MX_WIFI_MALLOC(len + inc);
-  if (buff == NULL)
+  while ((i < len) && !SLIP_IS_SPECIAL(data[i]))
   {
-    return NULL;
+    i++;
   }
 
-  buff[0] = SLIP_START;
-  for (i = 0, j = 1; i < len; i++)
+  return i;
+}
+
+
+static bool slip_flush(uint8_t *buf, uint16_t *fill, uint32_t *total, slip_output_func_t output)
+{
+  if (output(buf, *fill) != *fill)
   {
-    if (data[i] == SLIP_START)
-    {
-      buff[j++] = SLIP_ESCAPE;
-      buff[j++] = SLIP_ESCAPE_START;
-    }
-    else if (data[i] == SLIP_END)
+    return false;
+  }
+  *total += *fill;
+  *fill = 0;
+  return true;
+}
+
+
+uint32_t slip_encode(const uint8_t *data, uint16_t len, uint8_t *buf, uint16_t buf_size,
+                     slip_output_func_t output)
+{
+  uint32_t total = 0;
+  uint16_t fill = 0;
+  uint16_t i = 0;
+  uint16_t run;
+  uint16_t n;
+
+  if ((NULL == buf) || (buf_size < 2U) || (NULL == output))
+  {
+    return 0;
+  }
+
+  buf[fill++] = SLIP_START;
+  while (i < len)
+  {
+    /* plain bytes copied by runs, as much as the buffer takes at a time */
+    run = slip_plain_run(&data[i], len - i);
+    while (run > 0U)
     {
-      buff[j++] = SLIP_ESCAPE;
-      buff[j++] = SLIP_ESCAPE_END;
+      if (fill == buf_size)
+      {
+        if (false == slip_flush(buf, &fill, &total, output))
+        {
+          return 0;
+        }
+      }
+      n = ((buf_size - fill) < run) ? (buf_size - fill) : run;
+      memcpy(&buf[fill], &data[i], n);
+      fill += n;
+      i += n;
+      run -= n;
     }
-    else if (data[i] == SLIP_ESCAPE)
+
+    /* bytes to escape, the run of them escaped as much as the buffer takes at a time */
+    while ((i < len) && SLIP_IS_SPECIAL(data[i]))
     {
-      buff[j++] = SLIP_ESCAPE;
-      buff[j++] = SLIP_ESCAPE_ES;
+      if ((buf_size - fill) < 2U)
+      {
+        if (false == slip_flush(buf, &fill, &total, output))
+        {
+          return 0;
+        }
+      }
+      for (n = (buf_size - fill) / 2U; (n > 0U) && (i < len) && SLIP_IS_SPECIAL(data[i]); n--)
+      {
+        buf[fill] = SLIP_ESCAPE;
+        buf[fill + 1U] = (data[i] == SLIP_START) ? SLIP_ESCAPE_START :
+                         ((data[i] == SLIP_END) ? SLIP_ESCAPE_END : SLIP_ESCAPE_ES);
+        fill += 2U;
+        i++;
+      }
     }
-    else
+  }
+
+  if (fill == buf_size)
+  {
+    if (false == slip_flush(buf, &fill, &total, output))
     {
-      buff[j++] = data[i];
+      return 0;
     }
   }
-  buff[j++] = SLIP_END;
-  *outlen = j;
+  buf[fill++] = SLIP_END;
+  if (false == slip_flush(buf, &fill, &total, output))
+  {
+    return 0;
+  }
 
-  return buff;
+  return total;
 }
 
 
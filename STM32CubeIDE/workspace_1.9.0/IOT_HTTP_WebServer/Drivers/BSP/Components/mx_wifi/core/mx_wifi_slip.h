@@ -45,9 +45,14 @@ extern "C" {
  * API
  */
 
-/* transfer HCI data to SLIP data,
- * return the SLIP buffer */
-uint8_t *slip_transfer(uint8_t *data, uint16_t len, uint16_t *outlen);
+/* send a part of a SLIP frame,
+ * return the number of bytes sent */
+typedef uint16_t (*slip_output_func_t)(uint8_t *data, uint16_t len);
+
+/* encode HCI data to a SLIP frame in buf, at least 2 bytes, sent with output each time it is full,
+ * return the SLIP frame length, 0 if output failed */
+uint32_t slip_encode(const uint8_t *data, uint16_t len, uint8_t *buf, uint16_t buf_size,
+                     slip_output_func_t output);
 
 /* PHY receive one serial byte to SLIP,
  * return SLIP frame
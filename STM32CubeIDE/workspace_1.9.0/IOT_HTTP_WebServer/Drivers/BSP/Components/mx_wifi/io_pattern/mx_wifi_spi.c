@@ -157,6 +157,7 @@ static void mx_wifi_spi_txrx_task(THREAD_CONTEXT_TYPE argument);
 
 /* SPI protocol functions */
 void process_txrx_poll(uint32_t timeout);
+bool process_tx_pending(void);
 
 
 static void MX_WIFI_IO_DELAY(uint32_t ms)
@@ -263,6 +264,13 @@ static uint16_t MX_WIFI_SPI_Write(uint8_t *data, uint16_t len)
 }
 
 
+/* a single frame waits for the next transfer, a new write before it would replace it */
+bool process_tx_pending(void)
+{
+  return (NULL != spi_tx_data);
+}
+
+
 static uint16_t MX_WIFI_SPI_Read(uint8_t *buffer, uint16_t buff_size)
 {
   return 0;
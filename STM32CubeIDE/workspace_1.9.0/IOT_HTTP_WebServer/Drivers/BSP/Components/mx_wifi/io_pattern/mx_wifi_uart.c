@@ -254,6 +254,13 @@ void process_txrx_poll(uint32_t timeout)
 }
 
 
+/* frames are sent by MX_WIFI_UART_SendData() before it returns */
+bool process_tx_pending(void)
+{
+  return false;
+}
+
+
 void HWInterfaceReceivedPollTask(void const *argument)
 {
   while (true)
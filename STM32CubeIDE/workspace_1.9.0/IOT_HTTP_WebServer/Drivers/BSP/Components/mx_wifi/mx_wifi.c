@@ -83,10 +83,25 @@ typedef struct mx_sockaddr_in
 } mx_sockaddr_in_t;
 
 
+/* Socket send frames: the IPC header, then the command parameters on a 4 bytes boundary */
+#define MX_WIFI_TX_FRAME_PAD    (2U)
+#define MX_WIFI_TX_FRAME_WORDS  ((MX_WIFI_TX_FRAME_PAD + MIPC_PKT_MAX_SIZE + 3U) / 4U)
+
+/* Socket send fragments: as much data as one IPC request carries */
+#define MX_WIFI_TX_FRAG_SIZE    ((int32_t)(MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_send_cparams_t) - 1U)))
+
+/* Private variables ---------------------------------------------------------*/
+static uint32_t mx_wifi_tx_frames[MX_WIFI_TX_FRAME_NBR][MX_WIFI_TX_FRAME_WORDS];
+static volatile bool mx_wifi_tx_frame_busy[MX_WIFI_TX_FRAME_NBR];
+
 /* Private functions ---------------------------------------------------------*/
 static int32_t mx_aton(const int8_t *ptr, mx_ip_addr_t *addr);
 static int32_t mx_aton_r(const int8_t *cp);
 static int8_t *mx_ntoa(const mx_ip4_addr_t *addr);
+static uint8_t *mx_wifi_tx_frame_get(MX_WIFIObject_t *Obj, uint16_t cparams_size);
+static void mx_wifi_tx_frame_put(uint8_t *cparams);
+static int32_t mx_wifi_socket_send_frags(MX_WIFIObject_t *Obj, int32_t sockfd, const mx_iovec_t *iov,
+                                         int32_t len, int32_t flags);
 
 /**
   * @brief  Function description
@@ -529,6 +544,23 @@ MX_WIFI_STATUS_T MX_WIFI_IO_YIELD(MX_WIFIObject_t *Obj, uint32_t timeout)
   return ret;
 }
 
+/**
+  * @brief                   wifi IPC statistics
+  * @param  Obj              wifi object
+  * @param  stat             IPC statistics (out)
+  * @return MX_WIFI_STATUS_T status
+  */
+MX_WIFI_STATUS_T MX_WIFI_GetIpcStat(MX_WIFIObject_t *Obj, mx_ipc_stat_t *stat)
+{
+  MX_WIFI_STATUS_T ret = MX_WIFI_STATUS_PARAM_ERROR;
+  if ((NULL != Obj) && (NULL != stat))
+  {
+    mipc_stat_get(stat);
+    ret = MX_WIFI_STATUS_OK;
+  }
+  return ret;
+}
+
 /**
   * @brief                   wifi software reboot
   * @param  Obj              wifi object
@@ -1707,23 +1739,201 @@ int32_t MX_WIFI_Socket_close(MX_WIFIObject_t *Obj, int32_t sockfd)
 }
 
 /**
-  * @brief  Socket send.
+  * @brief  Take a socket send frame, for the command parameters to be built in place and sent by mipc_request()
+  *         without being copied again.
+  * @param  Obj: pointer to module handle
+  * @param  cparams_size: size of the command parameters
+  * @retval Pointer to the command parameters, with room for the IPC header in front, NULL if none.
+  */
+static uint8_t *mx_wifi_tx_frame_get(MX_WIFIObject_t *Obj, uint16_t cparams_size)
+{
+  uint8_t *frame = NULL;
+
+  LOCK(Obj->lockcmd);
+  for (uint32_t i = 0; i < (uint32_t)MX_WIFI_TX_FRAME_NBR; i++)
+  {
+    if (false == mx_wifi_tx_frame_busy[i])
+    {
+      mx_wifi_tx_frame_busy[i] = true;
+      frame = (uint8_t *)mx_wifi_tx_frames[i] + MX_WIFI_TX_FRAME_PAD;
+      break;
+    }
+  }
+  UNLOCK(Obj->lockcmd);
+
+  /* all of them in use by other sends in flight: same layout, the parameters on a 4 bytes boundary */
+  if (NULL == frame)
+  {
+    frame = (uint8_t *)MX_WIFI_MALLOC(MX_WIFI_TX_FRAME_PAD + MIPC_HEADER_SIZE + cparams_size);
+    if (NULL != frame)
+    {
+      frame = &frame[MX_WIFI_TX_FRAME_PAD];
+    }
+  }
+
+  return (NULL != frame) ? &frame[MIPC_HEADER_SIZE] : NULL;
+}
+
+/**
+  * @brief  Release a socket send frame.
+  * @param  cparams: command parameters, as returned by mx_wifi_tx_frame_get()
+  * @retval None
+  */
+static void mx_wifi_tx_frame_put(uint8_t *cparams)
+{
+  uint8_t *frame = cparams - MIPC_HEADER_SIZE;
+
+  for (uint32_t i = 0; i < (uint32_t)MX_WIFI_TX_FRAME_NBR; i++)
+  {
+    if (frame == ((uint8_t *)mx_wifi_tx_frames[i] + MX_WIFI_TX_FRAME_PAD))
+    {
+      mx_wifi_tx_frame_busy[i] = false;
+      return;
+    }
+  }
+  MX_WIFI_FREE(frame - MX_WIFI_TX_FRAME_PAD);
+}
+
+/**
+  * @brief  Socket send of a byte stream, in fragments of one IPC request each. Up to MX_WIFI_TX_WINDOW fragments
+  *         are kept in flight, the next ones going over the link while the module handles the first, blocking and
+  *         non-blocking sends alike. Sending stops at the first fragment not sent in full, the ones in flight after
+  *         it being still waited for: when the module took none of their bytes, as when its send buffer is full,
+  *         the bytes sent up to the short fragment are returned. When it took some past the gap, or a fragment is
+  *         not answered within MX_WIFI_CMD_TIMEOUT, the stream is broken or unknown and the send fails.
+  * @param  Obj: pointer to module handle
+  * @param  sockfd: socket fd
+  * @param  iov: send data buffers
+  * @param  len: number of bytes to send, the sum of the buffer lengths
+  * @param  flags: send flags
+  * @retval Number of bytes sent up to the first fragment not sent in full, return < 0 if failed, if a fragment
+  *         was not answered or if bytes were sent after that fragment.
+  */
+static int32_t mx_wifi_socket_send_frags(MX_WIFIObject_t *Obj, int32_t sockfd, const mx_iovec_t *iov,
+                                         int32_t len, int32_t flags)
+{
+  int32_t ret = -1;
+  socket_send_cparams_t *cp[MX_WIFI_TX_WINDOW];
+  socket_send_rparams_t rp[MX_WIFI_TX_WINDOW];
+  uint16_t rp_size[MX_WIFI_TX_WINDOW];
+  mipc_req_t *req[MX_WIFI_TX_WINDOW];
+  uint16_t cp_size;
+  uint32_t head = 0U;
+  uint32_t count = 0U;
+  uint32_t slot;
+  int32_t posted = 0;
+  int32_t sent = 0;
+  int32_t datalen;
+  int32_t copied;
+  int32_t copylen;
+  int32_t offset = 0;
+  bool stopped = false;
+  bool counted = false;
+  bool broken = false;
+  bool answered;
+
+  while ((count > 0U) || ((posted < len) && (false == stopped)))
+  {
+    /* fill the window, the frames are built and sent in place */
+    while ((count < MX_WIFI_TX_WINDOW) && (posted < len) && (false == stopped))
+    {
+      datalen = ((len - posted) > MX_WIFI_TX_FRAG_SIZE) ? MX_WIFI_TX_FRAG_SIZE : (len - posted);
+      cp_size = (sizeof(socket_send_cparams_t) - 1 + datalen);
+      slot = (head + count) % MX_WIFI_TX_WINDOW;
+      cp[slot] = (socket_send_cparams_t *)mx_wifi_tx_frame_get(Obj, cp_size);
+      if (NULL == cp[slot])
+      {
+        stopped = true;
+        break;
+      }
+
+      for (copied = 0; copied < datalen; copied += copylen)
+      {
+        while (offset == iov->len)
+        {
+          iov++;
+          offset = 0;
+        }
+        copylen = ((datalen - copied) < (iov->len - offset)) ? (datalen - copied) : (iov->len - offset);
+        memcpy(&(cp[slot]->buffer[copied]), &iov->buf[offset], copylen);
+        offset += copylen;
+      }
+      cp[slot]->socket = sockfd;
+      cp[slot]->size = datalen;
+      cp[slot]->flags = flags;
+      rp[slot].sent = 0;
+      rp_size[slot] = sizeof(rp[slot]);
+      if (MIPC_CODE_SUCCESS != mipc_request_start(MIPC_API_SOCKET_SEND_CMD,
+                                                  (uint8_t *)cp[slot], cp_size,
+                                                  (uint8_t *)&rp[slot], &rp_size[slot], &req[slot]))
+      {
+        mx_wifi_tx_frame_put((uint8_t *)cp[slot]);
+        stopped = true;
+        break;
+      }
+      posted += datalen;
+      count++;
+    }
+
+    if (count > 0U)
+    {
+      /* the oldest fragment: once one is not sent in full, the later ones are waited for but not counted */
+      answered = (MIPC_CODE_SUCCESS == mipc_request_wait(req[head], MX_WIFI_CMD_TIMEOUT));
+      if (false == answered)
+      {
+        /* the module may have taken it, the bytes sent are not known */
+        broken = true;
+        counted = true;
+        stopped = true;
+      }
+      else if (true == counted)
+      {
+        /* bytes taken past the gap break the stream */
+        broken = broken || (rp[head].sent > 0);
+      }
+      else if (rp[head].sent == (int32_t)cp[head]->size)
+      {
+        sent += rp[head].sent;
+        ret = sent;
+      }
+      else
+      {
+        counted = true;
+        stopped = true;
+        if (rp[head].sent >= 0)
+        {
+          sent += rp[head].sent;
+          ret = sent;
+        }
+        else if (sent == 0)
+        {
+          ret = rp[head].sent;
+        }
+      }
+      mx_wifi_tx_frame_put((uint8_t *)cp[head]);
+      head = (head + 1U) % MX_WIFI_TX_WINDOW;
+      count--;
+    }
+  }
+
+  return (true == broken) ? -1 : ret;
+}
+
+/**
+  * @brief  Socket send, of any length: it is split in fragments of one IPC request each.
   * @param  Obj: pointer to module handle
   * @param  sockfd: socket fd
   * @param  buf: send data buffer
   * @param  len: length of send data
-  * @param  flags: zero for MXOS
-  * @retval Number of bytes sent, return < 0 if failed.
+  * @param  flags: zero or MX_MSG_DONTWAIT
+  * @retval Number of bytes sent, fewer than len only on a non-blocking socket, one with a send timeout or a
+  *         failed connection, return < 0 if failed.
   */
 int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf,
                             int32_t len, int32_t flags)
 {
   int32_t ret = -1;
-  socket_send_cparams_t *cp;
-  uint16_t cp_size;
-  socket_send_rparams_t rp;
-  uint16_t rp_size = sizeof(rp);
-  int32_t datalen;
+  mx_iovec_t iov;
 
   if ((NULL == Obj) || (sockfd < 0) || (NULL == buf) || (len <= 0))
   {
@@ -1731,31 +1941,49 @@ int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf,
   }
   else
   {
-    if ((len + sizeof(socket_send_cparams_t) - 1) > MX_WIFI_IPC_PAYLOAD_SIZE)
-    {
-      datalen = (MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_send_cparams_t) - 1));
-    }
-    else
-    {
-      datalen = len;
-    }
-    rp.sent = 0;
-    cp_size = (sizeof(socket_send_cparams_t) - 1 + datalen);
-    cp = (socket_send_cparams_t *)MX_WIFI_MALLOC(cp_size);
-    if (NULL != cp)
+    iov.buf = buf;
+    iov.len = len;
+    ret = mx_wifi_socket_send_frags(Obj, sockfd, &iov, len, flags);
+  }
+  return ret;
+}
+
+/**
+  * @brief  Socket send of several buffers, one after the other as a single stream.
+  * @param  Obj: pointer to module handle
+  * @param  sockfd: socket fd
+  * @param  iov: send data buffers
+  * @param  iovcnt: number of send data buffers, up to MX_WIFI_IOV_MAX
+  * @param  flags: zero or MX_MSG_DONTWAIT
+  * @retval Number of bytes sent, fewer than the buffers hold only on a non-blocking socket, one with a send
+  *         timeout or a failed connection, return < 0 if failed.
+  */
+int32_t MX_WIFI_Socket_sendv(MX_WIFIObject_t *Obj, int32_t sockfd, const mx_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags)
+{
+  int32_t ret = -1;
+  int32_t datalen = 0;
+  int32_t i;
+
+  if ((NULL == Obj) || (sockfd < 0) || (NULL == iov) || (iovcnt <= 0) || (iovcnt > MX_WIFI_IOV_MAX))
+  {
+    ret = -1;
+  }
+  else
+  {
+    for (i = 0; i < iovcnt; i++)
     {
-      cp->socket = sockfd;
-      memcpy(&(cp->buffer[0]), buf, datalen);
-      cp->size = datalen;
-      cp->flags = flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_SEND_CMD,
-                                            (uint8_t *)cp, cp_size,
-                                            (uint8_t *)&rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      if ((NULL == iov[i].buf) || (iov[i].len < 0) || (iov[i].len > (INT32_MAX - datalen)))
       {
-        ret = rp.sent;
+        datalen = -1;
+        break;
       }
-      MX_WIFI_FREE(cp);
+      datalen += iov[i].len;
+    }
+
+    if (datalen > 0)
+    {
+      ret = mx_wifi_socket_send_frags(Obj, sockfd, iov, datalen, flags);
     }
   }
   return ret;
@@ -1798,7 +2026,7 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf
       datalen = len;
     }
     cp_size = (sizeof(socket_sendto_cparams_t) - 1 + datalen);
-    cp = (socket_sendto_cparams_t *)MX_WIFI_MALLOC(cp_size);
+    cp = (socket_sendto_cparams_t *)mx_wifi_tx_frame_get(Obj, cp_size);
     if (NULL != cp)
     {
       rp.sent = 0;
@@ -1815,7 +2043,7 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf
       {
         ret = rp.sent;
       }
-      MX_WIFI_FREE(cp);
+      mx_wifi_tx_frame_put((uint8_t *)cp);
     }
   }
   return ret;
@@ -1832,14 +2060,54 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf
   */
 int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf,
                             int32_t len, int32_t flags)
+{
+  int32_t ret = -1;
+  mx_buf_t *netbuf;
+  uint8_t *data;
+
+  if ((NULL == Obj) || (sockfd < 0) || (NULL == buf) || (len <= 0))
+  {
+    ret = -1;
+  }
+  else
+  {
+    /* data copied once, from the IPC answer buffer to the caller's one */
+    ret = MX_WIFI_Socket_recv_buf(Obj, sockfd, len, flags, &netbuf, &data);
+    if (ret > 0)
+    {
+      memcpy(buf, data, ret);
+    }
+    MX_WIFI_Socket_recv_release(Obj, netbuf);
+  }
+  return ret;
+}
+
+/**
+  * @brief  Socket recv, the data being left in the IPC answer buffer instead of copied.
+  * @param  Obj: pointer to module handle
+  * @param  sockfd: socket fd
+  * @param  len: maximum length of data
+  * @param  flags: zero for MXOS
+  * @param  netbuf: IPC answer buffer holding the data (out), NULL if none. Once done with the data, it must be
+  *         released with MX_WIFI_Socket_recv_release(), the recv having failed or not.
+  * @param  data: pointer to the data in the answer buffer (out)
+  * @retval Number of bytes received, return < 0 if failed.
+  */
+int32_t MX_WIFI_Socket_recv_buf(MX_WIFIObject_t *Obj, int32_t sockfd, int32_t len, int32_t flags,
+                                mx_buf_t **netbuf, uint8_t **data)
 {
   int32_t ret = -1;
   socket_recv_cparams_t cp;
   socket_recv_rparams_t *rp;
-  uint16_t rp_size;
   int32_t datalen;
 
-  if ((NULL == Obj) || (sockfd < 0) || (NULL == buf) || (len <= 0))
+  if ((NULL != netbuf) && (NULL != data))
+  {
+    *netbuf = NULL;
+    *data = NULL;
+  }
+
+  if ((NULL == Obj) || (sockfd < 0) || (len <= 0) || (NULL == netbuf) || (NULL == data))
   {
     ret = -1;
   }
@@ -1854,31 +2122,52 @@ int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf,
     {
       datalen = len;
     }
-    rp_size = (sizeof(socket_recv_rparams_t) - 1 + datalen);
-    rp = (socket_recv_rparams_t *)MX_WIFI_MALLOC(rp_size);
-    if (NULL != rp)
-    {
-      rp->received = 0;
-      cp.socket = sockfd;
-      cp.size = datalen;
-      cp.flags = flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECV_CMD,
-                                            (uint8_t *)&cp, sizeof(cp),
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+    cp.socket = sockfd;
+    cp.size = datalen;
+    cp.flags = flags;
+    if (MIPC_CODE_SUCCESS == mipc_request_netbuf(MIPC_API_SOCKET_RECV_CMD,
+                                                 (uint8_t *)&cp, sizeof(cp),
+                                                 netbuf, MX_WIFI_CMD_TIMEOUT))
+    {
+      rp = (socket_recv_rparams_t *)MX_NET_BUFFER_PAYLOAD(*netbuf);
+      if (MX_NET_BUFFER_GET_PAYLOAD_SIZE(*netbuf) < sizeof(rp->received))
       {
-        if ((rp->received <= datalen) && (rp->received > 0))
+        ret = -1;
+      }
+      else
+      {
+        ret = rp->received;
+        /* the data must be all in the answer, a malformed one failing the recv instead of reading as a close */
+        if ((ret > datalen) ||
+            ((ret > 0) && ((sizeof(socket_recv_rparams_t) - 1 + ret) > MX_NET_BUFFER_GET_PAYLOAD_SIZE(*netbuf))))
         {
-          memcpy(buf, &(rp->buffer[0]), rp->received);
+          ret = -1;
+        }
+        else if (ret > 0)
+        {
+          *data = &(rp->buffer[0]);
         }
-        ret = rp->received;
       }
-      MX_WIFI_FREE(rp);
     }
   }
   return ret;
 }
 
+/**
+  * @brief  Release an IPC answer buffer returned by MX_WIFI_Socket_recv_buf().
+  * @param  Obj: pointer to module handle
+  * @param  netbuf: IPC answer buffer, may be NULL
+  * @retval None
+  */
+void MX_WIFI_Socket_recv_release(MX_WIFIObject_t *Obj, mx_buf_t *netbuf)
+{
+  (void)Obj;
+  if (NULL != netbuf)
+  {
+    MX_NET_BUFFER_FREE(netbuf);
+  }
+}
+
 /**
   * @brief  Socket recvfrom.
   * @param  Obj: pointer to module handle
@@ -1897,7 +2186,7 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *b
   int32_t ret = -1;
   socket_recvfrom_cparams_t cp;
   socket_recvfrom_rparams_t *rp;
-  uint16_t rp_size;
+  mx_buf_t *netbuf;
   int32_t datalen;
 
   if ((NULL == Obj) || (sockfd < 0) || (NULL == buf) || (len <= 0) || (NULL == fromaddr) \
@@ -1916,28 +2205,31 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *b
     {
       datalen = len;
     }
-    rp_size = (sizeof(socket_recvfrom_rparams_t) - 1 + datalen);
-    rp = (socket_recvfrom_rparams_t *)MX_WIFI_MALLOC(rp_size);
-    if (NULL != rp)
-    {
-      rp->received = 0;
-      cp.socket = sockfd;
-      cp.size = datalen;
-      cp.flags = flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECVFROM_CMD,
-                                            (uint8_t *)&cp, sizeof(cp),
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+    cp.socket = sockfd;
+    cp.size = datalen;
+    cp.flags = flags;
+    /* data copied once, from the IPC answer buffer to the caller's one */
+    if (MIPC_CODE_SUCCESS == mipc_request_netbuf(MIPC_API_SOCKET_RECVFROM_CMD,
+                                                 (uint8_t *)&cp, sizeof(cp),
+                                                 &netbuf, MX_WIFI_CMD_TIMEOUT))
+    {
+      rp = (socket_recvfrom_rparams_t *)MX_NET_BUFFER_PAYLOAD(netbuf);
+      /* the data must be all in the answer, a malformed one failing the recvfrom */
+      if ((MX_NET_BUFFER_GET_PAYLOAD_SIZE(netbuf) < (sizeof(socket_recvfrom_rparams_t) - 1)) ||
+          (rp->received > datalen) ||
+          ((rp->received > 0) &&
+           ((sizeof(socket_recvfrom_rparams_t) - 1 + rp->received) > MX_NET_BUFFER_GET_PAYLOAD_SIZE(netbuf))))
       {
-        if ((rp->received <= datalen) && (rp->received > 0))
-        {
-          memcpy(buf, &(rp->buffer[0]), rp->received);
-          ret = rp->received;
-          memcpy(fromaddr, &(rp->addr), sizeof(rp->addr));
-          *fromaddrlen = rp->length;
-        }
+        ret = -1;
       }
-      MX_WIFI_FREE(rp);
+      else if (rp->received > 0)
+      {
+        memcpy(buf, &(rp->buffer[0]), rp->received);
+        ret = rp->received;
+        memcpy(fromaddr, &(rp->addr), sizeof(rp->addr));
+        *fromaddrlen = rp->length;
+      }
+      MX_NET_BUFFER_FREE(netbuf);
     }
   }
   return ret;
@@ -396,6 +396,25 @@ MX_WIFI_STATUS_T MX_WIFI_SetTimeout(MX_WIFIObject_t *Obj, uint32_t Timeout);
   */
 MX_WIFI_STATUS_T MX_WIFI_IO_YIELD(MX_WIFIObject_t *Obj, uint32_t timeout);
 
+/**
+  * @brief IPC statistics, counted since the driver init
+  */
+typedef struct
+{
+  uint32_t requests;              /**< commands sent to the module. */
+  uint32_t timeouts;              /**< commands not answered in time. */
+  uint32_t events;                /**< events received from the module. */
+  uint32_t wait_ms;               /**< time spent waiting for command answers, in ms. */
+} mx_ipc_stat_t;
+
+/**
+  * @brief  Get the IPC statistics.
+  * @param  Obj: pointer to module handle
+  * @param  stat: IPC statistics (out)
+  * @retval Operation Status.
+  */
+MX_WIFI_STATUS_T MX_WIFI_GetIpcStat(MX_WIFIObject_t *Obj, mx_ipc_stat_t *stat);
+
 /**
   * @} **
   */
@@ -832,6 +851,8 @@ struct addrinfo
 
 #define O_NONBLOCK  1 /* nonblocking I/O */
 
+#define MX_MSG_DONTWAIT   (0x08)  /* nonblocking send or recv, this call only */
+
 /**
   * @brief socket option value
   */
@@ -890,6 +911,17 @@ typedef enum
   IP_MULTICAST_LOOP       = 0x0007
 } IP_OPT_VAL;
 
+/**
+  * @brief  Socket send buffer, one of several sent at once
+  */
+typedef struct
+{
+  uint8_t *buf;                   /**< buffer start. */
+  int32_t len;                    /**< buffer length. */
+} mx_iovec_t;
+
+#define MX_WIFI_IOV_MAX   (4)     /**< max number of buffers sent at once. */
+
 /**
   * @brief  Create a socket.
   * @param  Obj: pointer to module handle
@@ -986,16 +1018,30 @@ int32_t MX_WIFI_Socket_shutdown(MX_WIFIObject_t *Obj, int32_t sockfd, int32_t mo
 int32_t MX_WIFI_Socket_close(MX_WIFIObject_t *Obj, int32_t sockfd);
 
 /**
-  * @brief  Socket send.
+  * @brief  Socket send, of any length: it is split in fragments of one IPC request each.
   * @param  Obj: pointer to module handle
   * @param  sockfd: socket fd
   * @param  buf: send data buffer
   * @param  len: length of send data
-  * @param  flags: zero for MXOS
-  * @retval Number of bytes sent, return < 0 if failed.
+  * @param  flags: zero or MX_MSG_DONTWAIT
+  * @retval Number of bytes sent, fewer than len only on a non-blocking socket, one with a send timeout or a
+  *         failed connection, return < 0 if failed.
   */
 int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf, int32_t len, int32_t flags);
 
+/**
+  * @brief  Socket send of several buffers, one after the other as a single stream.
+  * @param  Obj: pointer to module handle
+  * @param  sockfd: socket fd
+  * @param  iov: send data buffers
+  * @param  iovcnt: number of send data buffers, up to MX_WIFI_IOV_MAX
+  * @param  flags: zero or MX_MSG_DONTWAIT
+  * @retval Number of bytes sent, fewer than the buffers hold only on a non-blocking socket, one with a send
+  *         timeout or a failed connection, return < 0 if failed.
+  */
+int32_t MX_WIFI_Socket_sendv(MX_WIFIObject_t *Obj, int32_t sockfd, const mx_iovec_t *iov, int32_t iovcnt,
+                             int32_t flags);
+
 /**
   * @brief  Socket recv.
   * @param  Obj: pointer to module handle
@@ -1007,6 +1053,28 @@ int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf,
   */
 int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t sockfd, uint8_t *buf, int32_t len, int32_t flags);
 
+/**
+  * @brief  Socket recv, the data being left in the IPC answer buffer instead of copied.
+  * @param  Obj: pointer to module handle
+  * @param  sockfd: socket fd
+  * @param  len: maximum length of data
+  * @param  flags: zero for MXOS
+  * @param  netbuf: IPC answer buffer holding the data (out), NULL if none. Once done with the data, it must be
+  *         released with MX_WIFI_Socket_recv_release(), the recv having failed or not.
+  * @param  data: pointer to the data in the answer buffer (out)
+  * @retval Number of bytes received, return < 0 if failed.
+  */
+int32_t MX_WIFI_Socket_recv_buf(MX_WIFIObject_t *Obj, int32_t sockfd, int32_t len, int32_t flags,
+                                mx_buf_t **netbuf, uint8_t **data);
+
+/**
+  * @brief  Release an IPC answer buffer returned by MX_WIFI_Socket_recv_buf().
+  * @param  Obj: pointer to module handle
+  * @param  netbuf: IPC answer buffer, may be NULL
+  * @retval None
+  */
+void MX_WIFI_Socket_recv_release(MX_WIFIObject_t *Obj, mx_buf_t *netbuf);
+
 /**
   * @brief  Socket sendto.
   * @param  Obj: pointer to module handle
@@ -1,20 +1 @@
-/*!
-
-=========================================================
-* Black Dashboard React - v1.2.0
-=========================================================
-
-* Product Page: https://www.creative-tim.com/product/black-dashboard-react
-* Copyright 2020 Creative Tim (https://www.creative-tim.com)
-* Licensed under MIT (https://github.com/creativetimofficial/black-dashboard-react/blob/master/LICENSE.md)
-
-* Coded by Creative Tim
-
-=========================================================
-
-* The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
-
-*/
-/*! For license information please see 2.da35ac61.chunk.js.LICENSE.txt */
-(this["webpackJsonpblack-dashboard-react"]=this["webpackJsonpblack-dashboard-react"]||[]).push([[2],[function(e,t,n){"use strict";e.exports=n(87)},function(e,t,n){e.exports=n(88)()},function(e,t,n){"use strict";e.exports=n(79)},function(e,t,n){"use strict";n.d(t,"f",(function(){return o})),n.d(t,"g",(function(){return l})),n.d(t,"h",(function(){return s})),n.d(t,"i",(function(){return c})),n.d(t,"c",(function(){return d})),n.d(t,"a",(function(){return f})),n.d(t,"b",(function(){return h})),n.d(t,"e",(function(){return p})),n.d(t,"d",(function(){return g}));var r,i=n(1),a=n.n(i);function o(e,t){return void 0===e&&(e=""),void 0===t&&(t=r),t?e.split(" ").map((function(e){return t[e]||e})).join(" "):e}function l(e,t){var n={};return Object.keys(e).forEach((function(r){-1===t.indexOf(r)&&(n[r]=e[r])})),n}function s(e,t){for(var n,r=Array.isArray(t)?t:[t],i=r.length,a={};i>0;)a[n=r[i-=1]]=e[n];return a}var u="object"===typeof window&&window.Element||function(){};a.a.oneOfType([a.a.string,a.a.func,function(e,t,n){if(!(e[t]instanceof u))return new Error("Invalid prop `"+t+"` supplied to `"+n+"`. Expected prop to be an instance of Element. Validation failed.")},a.a.shape({current:a.a.any})]);var c=a.a.oneOfType([a.a.func,a.a.string,a.a.shape({$$typeof:a.a.symbol,render:a.a.func}),a.a.arrayOf(a.a.oneOfType([a.a.func,a.a.string,a.a.shape({$$typeof:a.a.symbol,render:a.a.func})]))]),d={Fade:150,Collapse:350,Modal:300,Carousel:600},f=["in","mountOnEnter","unmountOnExit","appear","enter","exit","timeout","onEnter","onEntering","onEntered","onExit","onExiting","onExited"],h={ENTERING:"entering",ENTERED:"entered",EXITING:"exiting",EXITED:"exited"},p={esc:27,space:32,enter:13,tab:9,up:38,down:40,home:36,end:35,n:78,p:80};"undefined"===typeof window||!window.document||window.document.createElement;function g(e){var t=typeof e;return null!=e&&("object"===t||"function"===t)}},function(e,t,n){"use strict";function r(){return(r=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}n.d(t,"a",(function(){return r}))},function(e,t,n){var r;!function(){"use strict";var n={}.hasOwnProperty;function i(){for(var e=[],t=0;t<arguments.length;t++){var r=arguments[t];if(r){var a=typeof r;if("string"===a||"number"===a)e.push(r);else if(Array.isArray(r)&&r.length){var o=i.apply(null,r);o&&e.push(o)}else if("object"===a)for(var l in r)n.call(r,l)&&r[l]&&e.push(l)}}return e.join(" ")}e.exports?(i.default=i,e.exports=i):void 0===(r=function(){return i}.apply(t,[]))||(e.exports=r)}()},function(e,t,n){"use strict";function r(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}n.d(t,"a",(function(){return r}))},function(e,t,n){"use strict";function r(e,t){return(r=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e})(e,t)}function i(e,t){e.prototype=Object.create(t.prototype),e.prototype.constructor=e,r(e,t)}n.d(t,"a",(function(){return i}))},function(e,t,n){"use strict";n.d(t,"a",(function(){return x})),n.d(t,"b",(function(){return S})),n.d(t,"c",(function(){return g})),n.d(t,"d",(function(){return T})),n.d(t,"e",(function(){return p})),n.d(t,"f",(function(){return k})),n.d(t,"g",(function(){return N}));var r=n(7),i=n(2),a=n.n(i),o=(n(1),n(12)),l=n(48),s=n(11),u=n(4),c=n(49),d=n.n(c),f=(n(56),n(6)),h=(n(74),function(e){var t=Object(l.a)();return t.displayName=e,t}("Router-History")),p=function(e){var t=Object(l.a)();return t.displayName=e,t}("Router"),g=function(e){function t(t){var n;return(n=e.call(this,t)||this).state={location:t.history.location},n._isMounted=!1,n._pendingLocation=null,t.staticContext||(n.unlisten=t.history.listen((function(e){n._isMounted?n.setState({location:e}):n._pendingLocation=e}))),n}Object(r.a)(t,e),t.computeRootMatch=function(e){return{path:"/",url:"/",params:{},isExact:"/"===e}};var n=t.prototype;return n.componentDidMount=function(){this._isMounted=!0,this._pendingLocation&&this.setState({location:this._pendingLocation})},n.componentWillUnmount=function(){this.unlisten&&this.unlisten()},n.render=function(){return a.a.createElement(p.Provider,{value:{history:this.props.history,location:this.state.location,match:t.computeRootMatch(this.state.location.pathname),staticContext:this.props.staticContext}},a.a.createElement(h.Provider,{children:this.props.children||null,value:this.props.history}))},t}(a.a.Component);a.a.Component;var m=function(e){function t(){return e.apply(this,arguments)||this}Object(r.a)(t,e);var n=t.prototype;return n.componentDidMount=function(){this.props.onMount&&this.props.onMount.call(this,this)},n.componentDidUpdate=function(e){this.props.onUpdate&&this.props.onUpdate.call(this,this,e)},n.componentWillUnmount=function(){this.props.onUnmount&&this.props.onUnmount.call(this,this)},n.render=function(){return null},t}(a.a.Component);var v={},y=0;function b(e,t){return void 0===e&&(e="/"),void 0===t&&(t={}),"/"===e?e:function(e){if(v[e])return v[e];var t=d.a.compile(e);return y<1e4&&(v[e]=t,y++),t}(e)(t,{pretty:!0})}function x(e){var t=e.computedMatch,n=e.to,r=e.push,i=void 0!==r&&r;return a.a.createElement(p.Consumer,null,(function(e){e||Object(s.a)(!1);var r=e.history,l=e.staticContext,c=i?r.push:r.replace,d=Object(o.c)(t?"string"===typeof n?b(n,t.params):Object(u.a)({},n,{pathname:b(n.pathname,t.params)}):n);return l?(c(d),null):a.a.createElement(m,{onMount:function(){c(d)},onUpdate:function(e,t){var n=Object(o.c)(t.to);Object(o.f)(n,Object(u.a)({},d,{key:n.key}))||c(d)},to:n})}))}var w={},_=0;function k(e,t){void 0===t&&(t={}),("string"===typeof t||Array.isArray(t))&&(t={path:t});var n=t,r=n.path,i=n.exact,a=void 0!==i&&i,o=n.strict,l=void 0!==o&&o,s=n.sensitive,u=void 0!==s&&s;return[].concat(r).reduce((function(t,n){if(!n&&""!==n)return null;if(t)return t;var r=function(e,t){var n=""+t.end+t.strict+t.sensitive,r=w[n]||(w[n]={});if(r[e])return r[e];var i=[],a={regexp:d()(e,i,t),keys:i};return _<1e4&&(r[e]=a,_++),a}(n,{end:a,strict:l,sensitive:u}),i=r.regexp,o=r.keys,s=i.exec(e);if(!s)return null;var c=s[0],f=s.slice(1),h=e===c;return a&&!h?null:{path:n,url:"/"===n&&""===c?"/":c,isExact:h,params:o.reduce((function(e,t,n){return e[t.name]=f[n],e}),{})}}),null)}var S=function(e){function t(){return e.apply(this,arguments)||this}return Object(r.a)(t,e),t.prototype.render=function(){var e=this;return a.a.createElement(p.Consumer,null,(function(t){t||Object(s.a)(!1);var n=e.props.location||t.location,r=e.props.computedMatch?e.props.computedMatch:e.props.path?k(n.pathname,e.props):t.match,i=Object(u.a)({},t,{location:n,match:r}),o=e.props,l=o.children,c=o.component,d=o.render;return Array.isArray(l)&&0===l.length&&(l=null),a.a.createElement(p.Provider,{value:i},i.match?l?"function"===typeof l?l(i):l:c?a.a.createElement(c,i):d?d(i):null:"function"===typeof l?l(i):null)}))},t}(a.a.Component);function M(e){return"/"===e.charAt(0)?e:"/"+e}function C(e,t){if(!e)return t;var n=M(e);return 0!==t.pathname.indexOf(n)?t:Object(u.a)({},t,{pathname:t.pathname.substr(n.length)})}function E(e){return"string"===typeof e?e:Object(o.e)(e)}function O(e){return function(){Object(s.a)(!1)}}function P(){}a.a.Component;var T=function(e){function t(){return e.apply(this,arguments)||this}return Object(r.a)(t,e),t.prototype.render=function(){var e=this;return a.a.createElement(p.Consumer,null,(function(t){t||Object(s.a)(!1);var n,r,i=e.props.location||t.location;return a.a.Children.forEach(e.props.children,(function(e){if(null==r&&a.a.isValidElement(e)){n=e;var o=e.props.path||e.props.from;r=o?k(i.pathname,Object(u.a)({},e.props,{path:o})):t.match}})),r?a.a.cloneElement(n,{location:i,computedMatch:r}):null}))},t}(a.a.Component);var D=a.a.useContext;function N(){return D(p).location}},function(e,t,n){"use strict";function r(e,t){(null==t||t>e.length)&&(t=e.length);for(var n=0,r=new Array(t);n<t;n++)r[n]=e[n];return r}function i(e,t){return function(e){if(Array.isArray(e))return e}(e)||function(e,t){if("undefined"!==typeof Symbol&&Symbol.iterator in Object(e)){var n=[],r=!0,i=!1,a=void 0;try{for(var o,l=e[Symbol.iterator]();!(r=(o=l.next()).done)&&(n.push(o.value),!t||n.length!==t);r=!0);}catch(s){i=!0,a=s}finally{try{r||null==l.return||l.return()}finally{if(i)throw a}}return n}}(e,t)||function(e,t){if(e){if("string"===typeof e)return r(e,t);var n=Object.prototype.toString.call(e).slice(8,-1);return"Object"===n&&e.constructor&&(n=e.constructor.name),"Map"===n||"Set"===n?Array.from(e):"Arguments"===n||/^(?:Ui|I)nt(?:8|16|32)(?:Clamped)?Array$/.test(n)?r(e,t):void 0}}(e,t)||function(){throw new TypeError("Invalid attempt to destructure non-iterable instance.\nIn order to be iterable, non-array objects must have a [Symbol.iterator]() method.")}()}n.d(t,"a",(function(){return i}))},function(e,t,n){"use strict";function r(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}n.d(t,"a",(function(){return r}))},function(e,t,n){"use strict";var r="Invariant failed";t.a=function(e,t){if(!e)throw new Error(r)}},function(e,t,n){"use strict";n.d(t,"a",(function(){return k})),n.d(t,"b",(function(){return P})),n.d(t,"d",(function(){return D})),n.d(t,"c",(function(){return g})),n.d(t,"f",(function(){return m})),n.d(t,"e",(function(){return p}));var r=n(4);function i(e){return"/"===e.charAt(0)}function a(e,t){for(var n=t,r=n+1,i=e.length;r<i;n+=1,r+=1)e[n]=e[r];e.pop()}var o=function(e,t){void 0===t&&(t="");var n,r=e&&e.split("/")||[],o=t&&t.split("/")||[],l=e&&i(e),s=t&&i(t),u=l||s;if(e&&i(e)?o=r:r.length&&(o.pop(),o=o.concat(r)),!o.length)return"/";if(o.length){var c=o[o.length-1];n="."===c||".."===c||""===c}else n=!1;for(var d=0,f=o.length;f>=0;f--){var h=o[f];"."===h?a(o,f):".."===h?(a(o,f),d++):d&&(a(o,f),d--)}if(!u)for(;d--;d)o.unshift("..");!u||""===o[0]||o[0]&&i(o[0])||o.unshift("");var p=o.join("/");return n&&"/"!==p.substr(-1)&&(p+="/"),p};function l(e){return e.valueOf?e.valueOf():Object.prototype.valueOf.call(e)}var s=function e(t,n){if(t===n)return!0;if(null==t||null==n)return!1;if(Array.isArray(t))return Array.isArray(n)&&t.length===n.length&&t.every((function(t,r){return e(t,n[r])}));if("object"===typeof t||"object"===typeof n){var r=l(t),i=l(n);return r!==t||i!==n?e(r,i):Object.keys(Object.assign({},t,n)).every((function(r){return e(t[r],n[r])}))}return!1},u=n(11);function c(e){return"/"===e.charAt(0)?e:"/"+e}function d(e){return"/"===e.charAt(0)?e.substr(1):e}function f(e,t){return function(e,t){return 0===e.toLowerCase().indexOf(t.toLowerCase())&&-1!=="/?#".indexOf(e.charAt(t.length))}(e,t)?e.substr(t.length):e}function h(e){return"/"===e.charAt(e.length-1)?e.slice(0,-1):e}function p(e){var t=e.pathname,n=e.search,r=e.hash,i=t||"/";return n&&"?"!==n&&(i+="?"===n.charAt(0)?n:"?"+n),r&&"#"!==r&&(i+="#"===r.charAt(0)?r:"#"+r),i}function g(e,t,n,i){var a;"string"===typeof e?(a=function(e){var t=e||"/",n="",r="",i=t.indexOf("#");-1!==i&&(r=t.substr(i),t=t.substr(0,i));var a=t.indexOf("?");return-1!==a&&(n=t.substr(a),t=t.substr(0,a)),{pathname:t,search:"?"===n?"":n,hash:"#"===r?"":r}}(e)).state=t:(void 0===(a=Object(r.a)({},e)).pathname&&(a.pathname=""),a.search?"?"!==a.search.charAt(0)&&(a.search="?"+a.search):a.search="",a.hash?"#"!==a.hash.charAt(0)&&(a.hash="#"+a.hash):a.hash="",void 0!==t&&void 0===a.state&&(a.state=t));try{a.pathname=decodeURI(a.pathname)}catch(l){throw l instanceof URIError?new URIError('Pathname "'+a.pathname+'" could not be decoded. This is likely caused by an invalid percent-encoding.'):l}return n&&(a.key=n),i?a.pathname?"/"!==a.pathname.charAt(0)&&(a.pathname=o(a.pathname,i.pathname)):a.pathname=i.pathname:a.pathname||(a.pathname="/"),a}function m(e,t){return e.pathname===t.pathname&&e.search===t.search&&e.hash===t.hash&&e.key===t.key&&s(e.state,t.state)}function v(){var e=null;var t=[];return{setPrompt:function(t){return e=t,function(){e===t&&(e=null)}},confirmTransitionTo:function(t,n,r,i){if(null!=e){var a="function"===typeof e?e(t,n):e;"string"===typeof a?"function"===typeof r?r(a,i):i(!0):i(!1!==a)}else i(!0)},appendListener:function(e){var n=!0;function r(){n&&e.apply(void 0,arguments)}return t.push(r),function(){n=!1,t=t.filter((function(e){return e!==r}))}},notifyListeners:function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];t.forEach((function(e){return e.apply(void 0,n)}))}}}var y=!("undefined"===typeof window||!window.document||!window.document.createElement);function b(e,t){t(window.confirm(e))}var x="popstate",w="hashchange";function _(){try{return window.history.state||{}}catch(e){return{}}}function k(e){void 0===e&&(e={}),y||Object(u.a)(!1);var t=window.history,n=function(){var e=window.navigator.userAgent;return(-1===e.indexOf("Android 2.")&&-1===e.indexOf("Android 4.0")||-1===e.indexOf("Mobile Safari")||-1!==e.indexOf("Chrome")||-1!==e.indexOf("Windows Phone"))&&window.history&&"pushState"in window.history}(),i=!(-1===window.navigator.userAgent.indexOf("Trident")),a=e,o=a.forceRefresh,l=void 0!==o&&o,s=a.getUserConfirmation,d=void 0===s?b:s,m=a.keyLength,k=void 0===m?6:m,S=e.basename?h(c(e.basename)):"";function M(e){var t=e||{},n=t.key,r=t.state,i=window.location,a=i.pathname+i.search+i.hash;return S&&(a=f(a,S)),g(a,r,n)}function C(){return Math.random().toString(36).substr(2,k)}var E=v();function O(e){Object(r.a)(W,e),W.length=t.length,E.notifyListeners(W.location,W.action)}function P(e){(function(e){return void 0===e.state&&-1===navigator.userAgent.indexOf("CriOS")})(e)||N(M(e.state))}function T(){N(M(_()))}var D=!1;function N(e){if(D)D=!1,O();else{E.confirmTransitionTo(e,"POP",d,(function(t){t?O({action:"POP",location:e}):function(e){var t=W.location,n=A.indexOf(t.key);-1===n&&(n=0);var r=A.indexOf(e.key);-1===r&&(r=0);var i=n-r;i&&(D=!0,L(i))}(e)}))}}var R=M(_()),A=[R.key];function I(e){return S+p(e)}function L(e){t.go(e)}var j=0;function F(e){1===(j+=e)&&1===e?(window.addEventListener(x,P),i&&window.addEventListener(w,T)):0===j&&(window.removeEventListener(x,P),i&&window.removeEventListener(w,T))}var z=!1;var W={length:t.length,action:"POP",location:R,createHref:I,push:function(e,r){var i="PUSH",a=g(e,r,C(),W.location);E.confirmTransitionTo(a,i,d,(function(e){if(e){var r=I(a),o=a.key,s=a.state;if(n)if(t.pushState({key:o,state:s},null,r),l)window.location.href=r;else{var u=A.indexOf(W.location.key),c=A.slice(0,u+1);c.push(a.key),A=c,O({action:i,location:a})}else window.location.href=r}}))},replace:function(e,r){var i="REPLACE",a=g(e,r,C(),W.location);E.confirmTransitionTo(a,i,d,(function(e){if(e){var r=I(a),o=a.key,s=a.state;if(n)if(t.replaceState({key:o,state:s},null,r),l)window.location.replace(r);else{var u=A.indexOf(W.location.key);-1!==u&&(A[u]=a.key),O({action:i,location:a})}else window.location.replace(r)}}))},go:L,goBack:function(){L(-1)},goForward:function(){L(1)},block:function(e){void 0===e&&(e=!1);var t=E.setPrompt(e);return z||(F(1),z=!0),function(){return z&&(z=!1,F(-1)),t()}},listen:function(e){var t=E.appendListener(e);return F(1),function(){F(-1),t()}}};return W}var S="hashchange",M={hashbang:{encodePath:function(e){return"!"===e.charAt(0)?e:"!/"+d(e)},decodePath:function(e){return"!"===e.charAt(0)?e.substr(1):e}},noslash:{encodePath:d,decodePath:c},slash:{encodePath:c,decodePath:c}};function C(e){var t=e.indexOf("#");return-1===t?e:e.slice(0,t)}function E(){var e=window.location.href,t=e.indexOf("#");return-1===t?"":e.substring(t+1)}function O(e){window.location.replace(C(window.location.href)+"#"+e)}function P(e){void 0===e&&(e={}),y||Object(u.a)(!1);var t=window.history,n=(window.navigator.userAgent.indexOf("Firefox"),e),i=n.getUserConfirmation,a=void 0===i?b:i,o=n.hashType,l=void 0===o?"slash":o,s=e.basename?h(c(e.basename)):"",d=M[l],m=d.encodePath,x=d.decodePath;function w(){var e=x(E());return s&&(e=f(e,s)),g(e)}var _=v();function k(e){Object(r.a)(W,e),W.length=t.length,_.notifyListeners(W.location,W.action)}var P=!1,T=null;function D(){var e=E(),t=m(e);if(e!==t)O(t);else{var n=w(),r=W.location;if(!P&&function(e,t){return e.pathname===t.pathname&&e.search===t.search&&e.hash===t.hash}(r,n))return;if(T===p(n))return;T=null,function(e){if(P)P=!1,k();else{var t="POP";_.confirmTransitionTo(e,t,a,(function(n){n?k({action:t,location:e}):function(e){var t=W.location,n=I.lastIndexOf(p(t));-1===n&&(n=0);var r=I.lastIndexOf(p(e));-1===r&&(r=0);var i=n-r;i&&(P=!0,L(i))}(e)}))}}(n)}}var N=E(),R=m(N);N!==R&&O(R);var A=w(),I=[p(A)];function L(e){t.go(e)}var j=0;function F(e){1===(j+=e)&&1===e?window.addEventListener(S,D):0===j&&window.removeEventListener(S,D)}var z=!1;var W={length:t.length,action:"POP",location:A,createHref:function(e){var t=document.querySelector("base"),n="";return t&&t.getAttribute("href")&&(n=C(window.location.href)),n+"#"+m(s+p(e))},push:function(e,t){var n="PUSH",r=g(e,void 0,void 0,W.location);_.confirmTransitionTo(r,n,a,(function(e){if(e){var t=p(r),i=m(s+t);if(E()!==i){T=t,function(e){window.location.hash=e}(i);var a=I.lastIndexOf(p(W.location)),o=I.slice(0,a+1);o.push(t),I=o,k({action:n,location:r})}else k()}}))},replace:function(e,t){var n="REPLACE",r=g(e,void 0,void 0,W.location);_.confirmTransitionTo(r,n,a,(function(e){if(e){var t=p(r),i=m(s+t);E()!==i&&(T=t,O(i));var a=I.indexOf(p(W.location));-1!==a&&(I[a]=t),k({action:n,location:r})}}))},go:L,goBack:function(){L(-1)},goForward:function(){L(1)},block:function(e){void 0===e&&(e=!1);var t=_.setPrompt(e);return z||(F(1),z=!0),function(){return z&&(z=!1,F(-1)),t()}},listen:function(e){var t=_.appendListener(e);return F(1),function(){F(-1),t()}}};return W}function T(e,t,n){return Math.min(Math.max(e,t),n)}function D(e){void 0===e&&(e={});var t=e,n=t.getUserConfirmation,i=t.initialEntries,a=void 0===i?["/"]:i,o=t.initialIndex,l=void 0===o?0:o,s=t.keyLength,u=void 0===s?6:s,c=v();function d(e){Object(r.a)(x,e),x.length=x.entries.length,c.notifyListeners(x.location,x.action)}function f(){return Math.random().toString(36).substr(2,u)}var h=T(l,0,a.length-1),m=a.map((function(e){return g(e,void 0,"string"===typeof e?f():e.key||f())})),y=p;function b(e){var t=T(x.index+e,0,x.entries.length-1),r=x.entries[t];c.confirmTransitionTo(r,"POP",n,(function(e){e?d({action:"POP",location:r,index:t}):d()}))}var x={length:m.length,action:"POP",location:m[h],index:h,entries:m,createHref:y,push:function(e,t){var r="PUSH",i=g(e,t,f(),x.location);c.confirmTransitionTo(i,r,n,(function(e){if(e){var t=x.index+1,n=x.entries.slice(0);n.length>t?n.splice(t,n.length-t,i):n.push(i),d({action:r,location:i,index:t,entries:n})}}))},replace:function(e,t){var r="REPLACE",i=g(e,t,f(),x.location);c.confirmTransitionTo(i,r,n,(function(e){e&&(x.entries[x.index]=i,d({action:r,location:i}))}))},go:b,goBack:function(){b(-1)},goForward:function(){b(1)},canGo:function(e){var t=x.index+e;return t>=0&&t<x.entries.length},block:function(e){return void 0===e&&(e=!1),c.setPrompt(e)},listen:function(e){return c.appendListener(e)}};return x}},function(e,t,n){var r=n(62),i="object"==typeof self&&self&&self.Object===Object&&self,a=r||i||Function("return this")();e.exports=a},function(e,t){var n=Array.isArray;e.exports=n},function(e,t){e.exports=function(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){var r=n(115),i=n(120);e.exports=function(e,t){var n=i(e,t);return r(n)?n:void 0}},function(e,t,n){"use strict";n.d(t,"a",(function(){return d})),n.d(t,"b",(function(){return v})),n.d(t,"c",(function(){return x}));var r=n(8),i=n(7),a=n(2),o=n.n(a),l=n(12),s=(n(1),n(4)),u=n(6),c=n(11);o.a.Component;var d=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).history=Object(l.b)(t.props),t}return Object(i.a)(t,e),t.prototype.render=function(){return o.a.createElement(r.c,{history:this.history,children:this.props.children})},t}(o.a.Component);var f=function(e,t){return"function"===typeof e?e(t):e},h=function(e,t){return"string"===typeof e?Object(l.c)(e,null,null,t):e},p=function(e){return e},g=o.a.forwardRef;"undefined"===typeof g&&(g=p);var m=g((function(e,t){var n=e.innerRef,r=e.navigate,i=e.onClick,a=Object(u.a)(e,["innerRef","navigate","onClick"]),l=a.target,c=Object(s.a)({},a,{onClick:function(e){try{i&&i(e)}catch(t){throw e.preventDefault(),t}e.defaultPrevented||0!==e.button||l&&"_self"!==l||function(e){return!!(e.metaKey||e.altKey||e.ctrlKey||e.shiftKey)}(e)||(e.preventDefault(),r())}});return c.ref=p!==g&&t||n,o.a.createElement("a",c)}));var v=g((function(e,t){var n=e.component,i=void 0===n?m:n,a=e.replace,l=e.to,d=e.innerRef,v=Object(u.a)(e,["component","replace","to","innerRef"]);return o.a.createElement(r.e.Consumer,null,(function(e){e||Object(c.a)(!1);var n=e.history,r=h(f(l,e.location),e.location),u=r?n.createHref(r):"",m=Object(s.a)({},v,{href:u,navigate:function(){var t=f(l,e.location);(a?n.replace:n.push)(t)}});return p!==g?m.ref=t||d:m.innerRef=d,o.a.createElement(i,m)}))})),y=function(e){return e},b=o.a.forwardRef;"undefined"===typeof b&&(b=y);var x=b((function(e,t){var n=e["aria-current"],i=void 0===n?"page":n,a=e.activeClassName,l=void 0===a?"active":a,d=e.activeStyle,p=e.className,g=e.exact,m=e.isActive,x=e.location,w=e.sensitive,_=e.strict,k=e.style,S=e.to,M=e.innerRef,C=Object(u.a)(e,["aria-current","activeClassName","activeStyle","className","exact","isActive","location","sensitive","strict","style","to","innerRef"]);return o.a.createElement(r.e.Consumer,null,(function(e){e||Object(c.a)(!1);var n=x||e.location,a=h(f(S,n),n),u=a.pathname,E=u&&u.replace(/([.+*?=^!:${}()[\]|/\\])/g,"\\$1"),O=E?Object(r.f)(n.pathname,{path:E,exact:g,sensitive:w,strict:_}):null,P=!!(m?m(O,n):O),T=P?function(){for(var e=arguments.length,t=new Array(e),n=0;n<e;n++)t[n]=arguments[n];return t.filter((function(e){return e})).join(" ")}(p,l):p,D=P?Object(s.a)({},k,{},d):k,N=Object(s.a)({"aria-current":P&&i||null,className:T,style:D,to:a},C);return y!==b?N.ref=t||M:N.innerRef=M,o.a.createElement(v,N)}))}))},,function(e,t,n){"use strict";(function(e){Object.defineProperty(t,"__esModule",{value:!0}),Object.defineProperty(t,"Chart",{enumerable:!0,get:function(){return a.default}}),t.defaults=t.Scatter=t.Bubble=t.Polar=t.Radar=t.HorizontalBar=t.Bar=t.Line=t.Pie=t.Doughnut=t.default=void 0;var r=s(n(2)),i=s(n(1)),a=s(n(57)),o=s(n(103)),l=s(n(165));function s(e){return e&&e.__esModule?e:{default:e}}function u(){return(u=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}function c(e){return(c="function"===typeof Symbol&&"symbol"===typeof Symbol.iterator?function(e){return typeof e}:function(e){return e&&"function"===typeof Symbol&&e.constructor===Symbol&&e!==Symbol.prototype?"symbol":typeof e})(e)}function d(e,t){if(null==e)return{};var n,r,i=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,t);if(Object.getOwnPropertySymbols){var a=Object.getOwnPropertySymbols(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||Object.prototype.propertyIsEnumerable.call(e,n)&&(i[n]=e[n])}return i}function f(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function h(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?f(Object(n),!0).forEach((function(t){k(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):f(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}function p(e,t){if(!(e instanceof t))throw new TypeError("Cannot call a class as a function")}function g(e,t){for(var n=0;n<t.length;n++){var r=t[n];r.enumerable=r.enumerable||!1,r.configurable=!0,"value"in r&&(r.writable=!0),Object.defineProperty(e,r.key,r)}}function m(e,t,n){return t&&g(e.prototype,t),n&&g(e,n),e}function v(e,t){if("function"!==typeof t&&null!==t)throw new TypeError("Super expression must either be null or a function");e.prototype=Object.create(t&&t.prototype,{constructor:{value:e,writable:!0,configurable:!0}}),t&&y(e,t)}function y(e,t){return(y=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e})(e,t)}function b(e){var t=function(){if("undefined"===typeof Reflect||!Reflect.construct)return!1;if(Reflect.construct.sham)return!1;if("function"===typeof Proxy)return!0;try{return Date.prototype.toString.call(Reflect.construct(Date,[],(function(){}))),!0}catch(e){return!1}}();return function(){var n,r=_(e);if(t){var i=_(this).constructor;n=Reflect.construct(r,arguments,i)}else n=r.apply(this,arguments);return x(this,n)}}function x(e,t){return!t||"object"!==c(t)&&"function"!==typeof t?w(e):t}function w(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}function _(e){return(_=Object.setPrototypeOf?Object.getPrototypeOf:function(e){return e.__proto__||Object.getPrototypeOf(e)})(e)}function k(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}var S="undefined"!==typeof e&&Object({NODE_ENV:"production",PUBLIC_URL:".",WDS_SOCKET_HOST:void 0,WDS_SOCKET_PATH:void 0,WDS_SOCKET_PORT:void 0,FAST_REFRESH:!0})&&"production",M=function(e){v(n,e);var t=b(n);function n(){var e;return p(this,n),k(w(e=t.call(this)),"handleOnClick",(function(t){var n=e.chartInstance,r=e.props,i=r.getDatasetAtEvent,a=r.getElementAtEvent,o=r.getElementsAtEvent,l=r.onElementsClick;i&&i(n.getDatasetAtEvent(t),t),a&&a(n.getElementAtEvent(t),t),o&&o(n.getElementsAtEvent(t),t),l&&l(n.getElementsAtEvent(t),t)})),k(w(e),"ref",(function(t){e.element=t})),e.chartInstance=void 0,e}return m(n,[{key:"componentDidMount",value:function(){this.renderChart()}},{key:"componentDidUpdate",value:function(){if(this.props.redraw)return this.destroyChart(),void this.renderChart();this.updateChart()}},{key:"shouldComponentUpdate",value:function(e){var t=this.props,n=(t.redraw,t.type),r=t.options,i=t.plugins,a=t.legend,l=t.height,s=t.width;if(!0===e.redraw)return!0;if(l!==e.height||s!==e.width)return!0;if(n!==e.type)return!0;if(!(0,o.default)(a,e.legend))return!0;if(!(0,o.default)(r,e.options))return!0;var u=this.transformDataProp(e);return!(0,o.default)(this.shadowDataProp,u)||!(0,o.default)(i,e.plugins)}},{key:"componentWillUnmount",value:function(){this.destroyChart()}},{key:"transformDataProp",value:function(e){var t=e.data;return"function"==typeof t?t(this.element):t}},{key:"memoizeDataProps",value:function(){if(this.props.data){var e=this.transformDataProp(this.props);return this.shadowDataProp=h(h({},e),{},{datasets:e.datasets&&e.datasets.map((function(e){return h({},e)}))}),this.saveCurrentDatasets(),e}}},{key:"checkDatasets",value:function(e){var t="production"!==S&&"prod"!==S,r=this.props.datasetKeyProvider!==n.getLabelAsKey,i=e.length>1;if(t&&i&&!r){var a=!1;e.forEach((function(e){e.label||(a=!0)})),a&&console.error('[react-chartjs-2] Warning: Each dataset needs a unique key. By default, the "label" property on each dataset is used. Alternatively, you may provide a "datasetKeyProvider" as a prop that returns a unique key.')}}},{key:"getCurrentDatasets",value:function(){return this.chartInstance&&this.chartInstance.config.data&&this.chartInstance.config.data.datasets||[]}},{key:"saveCurrentDatasets",value:function(){var e=this;this.datasets=this.datasets||{},this.getCurrentDatasets().forEach((function(t){e.datasets[e.props.datasetKeyProvider(t)]=t}))}},{key:"updateChart",value:function(){var e=this,t=this.props.options,n=this.memoizeDataProps(this.props);if(this.chartInstance){t&&(this.chartInstance.options=a.default.helpers.configMerge(this.chartInstance.options,t));var r=this.getCurrentDatasets(),i=n.datasets||[];this.checkDatasets(r);var o=(0,l.default)(r,this.props.datasetKeyProvider);this.chartInstance.config.data.datasets=i.map((function(t){var n=o[e.props.datasetKeyProvider(t)];if(n&&n.type===t.type&&t.data){n.data.splice(t.data.length),t.data.forEach((function(e,r){n.data[r]=t.data[r]}));t.data;var r=d(t,["data"]);return h(h({},n),r)}return t}));n.datasets;var s=d(n,["datasets"]);this.chartInstance.config.data=h(h({},this.chartInstance.config.data),s),this.chartInstance.update()}}},{key:"renderChart",value:function(){var e=this.props,t=e.options,r=e.legend,i=e.type,l=e.plugins,s=this.element,u=this.memoizeDataProps();"undefined"===typeof r||(0,o.default)(n.defaultProps.legend,r)||(t.legend=r),this.chartInstance=new a.default(s,{type:i,data:u,options:t,plugins:l})}},{key:"destroyChart",value:function(){if(this.chartInstance){this.saveCurrentDatasets();var e=Object.values(this.datasets);this.chartInstance.config.data.datasets=e,this.chartInstance.destroy()}}},{key:"render",value:function(){var e=this.props,t=e.height,n=e.width,i=e.id;return r.default.createElement("canvas",{ref:this.ref,height:t,width:n,id:i,onClick:this.handleOnClick})}}]),n}(r.default.Component);k(M,"getLabelAsKey",(function(e){return e.label})),k(M,"propTypes",{data:i.default.oneOfType([i.default.object,i.default.func]).isRequired,getDatasetAtEvent:i.default.func,getElementAtEvent:i.default.func,getElementsAtEvent:i.default.func,height:i.default.number,legend:i.default.object,onElementsClick:i.default.func,options:i.default.object,plugins:i.default.arrayOf(i.default.object),redraw:i.default.bool,type:function(e,t,n){if(!a.default.controllers[e[t]])return new Error("Invalid chart type `"+e[t]+"` supplied to `"+n+"`.")},width:i.default.number,datasetKeyProvider:i.default.func}),k(M,"defaultProps",{legend:{display:!0,position:"bottom"},type:"doughnut",height:150,width:300,redraw:!1,options:{},datasetKeyProvider:M.getLabelAsKey});var C=M;t.default=C;var E=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"doughnut"}))}}]),n}(r.default.Component);t.Doughnut=E;var O=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"pie"}))}}]),n}(r.default.Component);t.Pie=O;var P=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"line"}))}}]),n}(r.default.Component);t.Line=P;var T=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"bar"}))}}]),n}(r.default.Component);t.Bar=T;var D=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"horizontalBar"}))}}]),n}(r.default.Component);t.HorizontalBar=D;var N=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"radar"}))}}]),n}(r.default.Component);t.Radar=N;var R=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"polarArea"}))}}]),n}(r.default.Component);t.Polar=R;var A=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"bubble"}))}}]),n}(r.default.Component);t.Bubble=A;var I=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"scatter"}))}}]),n}(r.default.Component);t.Scatter=I;var L=a.default.defaults;t.defaults=L}).call(this,n(102))},function(e,t,n){"use strict";function r(e){return getComputedStyle(e)}function i(e,t){for(var n in t){var r=t[n];"number"===typeof r&&(r+="px"),e.style[n]=r}return e}function a(e){var t=document.createElement("div");return t.className=e,t}var o="undefined"!==typeof Element&&(Element.prototype.matches||Element.prototype.webkitMatchesSelector||Element.prototype.mozMatchesSelector||Element.prototype.msMatchesSelector);function l(e,t){if(!o)throw new Error("No element matching method supported");return o.call(e,t)}function s(e){e.remove?e.remove():e.parentNode&&e.parentNode.removeChild(e)}function u(e,t){return Array.prototype.filter.call(e.children,(function(e){return l(e,t)}))}var c="ps",d="ps__rtl",f={thumb:function(e){return"ps__thumb-"+e},rail:function(e){return"ps__rail-"+e},consuming:"ps__child--consume"},h={focus:"ps--focus",clicking:"ps--clicking",active:function(e){return"ps--active-"+e},scrolling:function(e){return"ps--scrolling-"+e}},p={x:null,y:null};function g(e,t){var n=e.element.classList,r=h.scrolling(t);n.contains(r)?clearTimeout(p[t]):n.add(r)}function m(e,t){p[t]=setTimeout((function(){return e.isAlive&&e.element.classList.remove(h.scrolling(t))}),e.settings.scrollingThreshold)}var v=function(e){this.element=e,this.handlers={}},y={isEmpty:{configurable:!0}};v.prototype.bind=function(e,t){"undefined"===typeof this.handlers[e]&&(this.handlers[e]=[]),this.handlers[e].push(t),this.element.addEventListener(e,t,!1)},v.prototype.unbind=function(e,t){var n=this;this.handlers[e]=this.handlers[e].filter((function(r){return!(!t||r===t)||(n.element.removeEventListener(e,r,!1),!1)}))},v.prototype.unbindAll=function(){for(var e in this.handlers)this.unbind(e)},y.isEmpty.get=function(){var e=this;return Object.keys(this.handlers).every((function(t){return 0===e.handlers[t].length}))},Object.defineProperties(v.prototype,y);var b=function(){this.eventElements=[]};function x(e){if("function"===typeof window.CustomEvent)return new CustomEvent(e);var t=document.createEvent("CustomEvent");return t.initCustomEvent(e,!1,!1,void 0),t}function w(e,t,n,r,i){var a;if(void 0===r&&(r=!0),void 0===i&&(i=!1),"top"===t)a=["contentHeight","containerHeight","scrollTop","y","up","down"];else{if("left"!==t)throw new Error("A proper axis should be provided");a=["contentWidth","containerWidth","scrollLeft","x","left","right"]}!function(e,t,n,r,i){var a=n[0],o=n[1],l=n[2],s=n[3],u=n[4],c=n[5];void 0===r&&(r=!0);void 0===i&&(i=!1);var d=e.element;e.reach[s]=null,d[l]<1&&(e.reach[s]="start");d[l]>e[a]-e[o]-1&&(e.reach[s]="end");t&&(d.dispatchEvent(x("ps-scroll-"+s)),t<0?d.dispatchEvent(x("ps-scroll-"+u)):t>0&&d.dispatchEvent(x("ps-scroll-"+c)),r&&function(e,t){g(e,t),m(e,t)}(e,s));e.reach[s]&&(t||i)&&d.dispatchEvent(x("ps-"+s+"-reach-"+e.reach[s]))}(e,n,a,r,i)}function _(e){return parseInt(e,10)||0}b.prototype.eventElement=function(e){var t=this.eventElements.filter((function(t){return t.element===e}))[0];return t||(t=new v(e),this.eventElements.push(t)),t},b.prototype.bind=function(e,t,n){this.eventElement(e).bind(t,n)},b.prototype.unbind=function(e,t,n){var r=this.eventElement(e);r.unbind(t,n),r.isEmpty&&this.eventElements.splice(this.eventElements.indexOf(r),1)},b.prototype.unbindAll=function(){this.eventElements.forEach((function(e){return e.unbindAll()})),this.eventElements=[]},b.prototype.once=function(e,t,n){var r=this.eventElement(e);r.bind(t,(function e(i){r.unbind(t,e),n(i)}))};var k={isWebKit:"undefined"!==typeof document&&"WebkitAppearance"in document.documentElement.style,supportsTouch:"undefined"!==typeof window&&("ontouchstart"in window||"maxTouchPoints"in window.navigator&&window.navigator.maxTouchPoints>0||window.DocumentTouch&&document instanceof window.DocumentTouch),supportsIePointer:"undefined"!==typeof navigator&&navigator.msMaxTouchPoints,isChrome:"undefined"!==typeof navigator&&/Chrome/i.test(navigator&&navigator.userAgent)};function S(e){var t=e.element,n=Math.floor(t.scrollTop),r=t.getBoundingClientRect();e.containerWidth=Math.ceil(r.width),e.containerHeight=Math.ceil(r.height),e.contentWidth=t.scrollWidth,e.contentHeight=t.scrollHeight,t.contains(e.scrollbarXRail)||(u(t,f.rail("x")).forEach((function(e){return s(e)})),t.appendChild(e.scrollbarXRail)),t.contains(e.scrollbarYRail)||(u(t,f.rail("y")).forEach((function(e){return s(e)})),t.appendChild(e.scrollbarYRail)),!e.settings.suppressScrollX&&e.containerWidth+e.settings.scrollXMarginOffset<e.contentWidth?(e.scrollbarXActive=!0,e.railXWidth=e.containerWidth-e.railXMarginWidth,e.railXRatio=e.containerWidth/e.railXWidth,e.scrollbarXWidth=M(e,_(e.railXWidth*e.containerWidth/e.contentWidth)),e.scrollbarXLeft=_((e.negativeScrollAdjustment+t.scrollLeft)*(e.railXWidth-e.scrollbarXWidth)/(e.contentWidth-e.containerWidth))):e.scrollbarXActive=!1,!e.settings.suppressScrollY&&e.containerHeight+e.settings.scrollYMarginOffset<e.contentHeight?(e.scrollbarYActive=!0,e.railYHeight=e.containerHeight-e.railYMarginHeight,e.railYRatio=e.containerHeight/e.railYHeight,e.scrollbarYHeight=M(e,_(e.railYHeight*e.containerHeight/e.contentHeight)),e.scrollbarYTop=_(n*(e.railYHeight-e.scrollbarYHeight)/(e.contentHeight-e.containerHeight))):e.scrollbarYActive=!1,e.scrollbarXLeft>=e.railXWidth-e.scrollbarXWidth&&(e.scrollbarXLeft=e.railXWidth-e.scrollbarXWidth),e.scrollbarYTop>=e.railYHeight-e.scrollbarYHeight&&(e.scrollbarYTop=e.railYHeight-e.scrollbarYHeight),function(e,t){var n={width:t.railXWidth},r=Math.floor(e.scrollTop);t.isRtl?n.left=t.negativeScrollAdjustment+e.scrollLeft+t.containerWidth-t.contentWidth:n.left=e.scrollLeft;t.isScrollbarXUsingBottom?n.bottom=t.scrollbarXBottom-r:n.top=t.scrollbarXTop+r;i(t.scrollbarXRail,n);var a={top:r,height:t.railYHeight};t.isScrollbarYUsingRight?t.isRtl?a.right=t.contentWidth-(t.negativeScrollAdjustment+e.scrollLeft)-t.scrollbarYRight-t.scrollbarYOuterWidth-9:a.right=t.scrollbarYRight-e.scrollLeft:t.isRtl?a.left=t.negativeScrollAdjustment+e.scrollLeft+2*t.containerWidth-t.contentWidth-t.scrollbarYLeft-t.scrollbarYOuterWidth:a.left=t.scrollbarYLeft+e.scrollLeft;i(t.scrollbarYRail,a),i(t.scrollbarX,{left:t.scrollbarXLeft,width:t.scrollbarXWidth-t.railBorderXWidth}),i(t.scrollbarY,{top:t.scrollbarYTop,height:t.scrollbarYHeight-t.railBorderYWidth})}(t,e),e.scrollbarXActive?t.classList.add(h.active("x")):(t.classList.remove(h.active("x")),e.scrollbarXWidth=0,e.scrollbarXLeft=0,t.scrollLeft=!0===e.isRtl?e.contentWidth:0),e.scrollbarYActive?t.classList.add(h.active("y")):(t.classList.remove(h.active("y")),e.scrollbarYHeight=0,e.scrollbarYTop=0,t.scrollTop=0)}function M(e,t){return e.settings.minScrollbarLength&&(t=Math.max(t,e.settings.minScrollbarLength)),e.settings.maxScrollbarLength&&(t=Math.min(t,e.settings.maxScrollbarLength)),t}function C(e,t){var n=t[0],r=t[1],i=t[2],a=t[3],o=t[4],l=t[5],s=t[6],u=t[7],c=t[8],d=e.element,f=null,p=null,v=null;function y(t){t.touches&&t.touches[0]&&(t[i]=t.touches[0].pageY),d[s]=f+v*(t[i]-p),g(e,u),S(e),t.stopPropagation(),t.preventDefault()}function b(){m(e,u),e[c].classList.remove(h.clicking),e.event.unbind(e.ownerDocument,"mousemove",y)}function x(t,o){f=d[s],o&&t.touches&&(t[i]=t.touches[0].pageY),p=t[i],v=(e[r]-e[n])/(e[a]-e[l]),o?e.event.bind(e.ownerDocument,"touchmove",y):(e.event.bind(e.ownerDocument,"mousemove",y),e.event.once(e.ownerDocument,"mouseup",b),t.preventDefault()),e[c].classList.add(h.clicking),t.stopPropagation()}e.event.bind(e[o],"mousedown",(function(e){x(e)})),e.event.bind(e[o],"touchstart",(function(e){x(e,!0)}))}var E={"click-rail":function(e){e.element,e.event.bind(e.scrollbarY,"mousedown",(function(e){return e.stopPropagation()})),e.event.bind(e.scrollbarYRail,"mousedown",(function(t){var n=t.pageY-window.pageYOffset-e.scrollbarYRail.getBoundingClientRect().top>e.scrollbarYTop?1:-1;e.element.scrollTop+=n*e.containerHeight,S(e),t.stopPropagation()})),e.event.bind(e.scrollbarX,"mousedown",(function(e){return e.stopPropagation()})),e.event.bind(e.scrollbarXRail,"mousedown",(function(t){var n=t.pageX-window.pageXOffset-e.scrollbarXRail.getBoundingClientRect().left>e.scrollbarXLeft?1:-1;e.element.scrollLeft+=n*e.containerWidth,S(e),t.stopPropagation()}))},"drag-thumb":function(e){C(e,["containerWidth","contentWidth","pageX","railXWidth","scrollbarX","scrollbarXWidth","scrollLeft","x","scrollbarXRail"]),C(e,["containerHeight","contentHeight","pageY","railYHeight","scrollbarY","scrollbarYHeight","scrollTop","y","scrollbarYRail"])},keyboard:function(e){var t=e.element;e.event.bind(e.ownerDocument,"keydown",(function(n){if(!(n.isDefaultPrevented&&n.isDefaultPrevented()||n.defaultPrevented)&&(l(t,":hover")||l(e.scrollbarX,":focus")||l(e.scrollbarY,":focus"))){var r,i=document.activeElement?document.activeElement:e.ownerDocument.activeElement;if(i){if("IFRAME"===i.tagName)i=i.contentDocument.activeElement;else for(;i.shadowRoot;)i=i.shadowRoot.activeElement;if(l(r=i,"input,[contenteditable]")||l(r,"select,[contenteditable]")||l(r,"textarea,[contenteditable]")||l(r,"button,[contenteditable]"))return}var a=0,o=0;switch(n.which){case 37:a=n.metaKey?-e.contentWidth:n.altKey?-e.containerWidth:-30;break;case 38:o=n.metaKey?e.contentHeight:n.altKey?e.containerHeight:30;break;case 39:a=n.metaKey?e.contentWidth:n.altKey?e.containerWidth:30;break;case 40:o=n.metaKey?-e.contentHeight:n.altKey?-e.containerHeight:-30;break;case 32:o=n.shiftKey?e.containerHeight:-e.containerHeight;break;case 33:o=e.containerHeight;break;case 34:o=-e.containerHeight;break;case 36:o=e.contentHeight;break;case 35:o=-e.contentHeight;break;default:return}e.settings.suppressScrollX&&0!==a||e.settings.suppressScrollY&&0!==o||(t.scrollTop-=o,t.scrollLeft+=a,S(e),function(n,r){var i=Math.floor(t.scrollTop);if(0===n){if(!e.scrollbarYActive)return!1;if(0===i&&r>0||i>=e.contentHeight-e.containerHeight&&r<0)return!e.settings.wheelPropagation}var a=t.scrollLeft;if(0===r){if(!e.scrollbarXActive)return!1;if(0===a&&n<0||a>=e.contentWidth-e.containerWidth&&n>0)return!e.settings.wheelPropagation}return!0}(a,o)&&n.preventDefault())}}))},wheel:function(e){var t=e.element;function n(n){var i=function(e){var t=e.deltaX,n=-1*e.deltaY;return"undefined"!==typeof t&&"undefined"!==typeof n||(t=-1*e.wheelDeltaX/6,n=e.wheelDeltaY/6),e.deltaMode&&1===e.deltaMode&&(t*=10,n*=10),t!==t&&n!==n&&(t=0,n=e.wheelDelta),e.shiftKey?[-n,-t]:[t,n]}(n),a=i[0],o=i[1];if(!function(e,n,i){if(!k.isWebKit&&t.querySelector("select:focus"))return!0;if(!t.contains(e))return!1;for(var a=e;a&&a!==t;){if(a.classList.contains(f.consuming))return!0;var o=r(a);if(i&&o.overflowY.match(/(scroll|auto)/)){var l=a.scrollHeight-a.clientHeight;if(l>0&&(a.scrollTop>0&&i<0||a.scrollTop<l&&i>0))return!0}if(n&&o.overflowX.match(/(scroll|auto)/)){var s=a.scrollWidth-a.clientWidth;if(s>0&&(a.scrollLeft>0&&n<0||a.scrollLeft<s&&n>0))return!0}a=a.parentNode}return!1}(n.target,a,o)){var l=!1;e.settings.useBothWheelAxes?e.scrollbarYActive&&!e.scrollbarXActive?(o?t.scrollTop-=o*e.settings.wheelSpeed:t.scrollTop+=a*e.settings.wheelSpeed,l=!0):e.scrollbarXActive&&!e.scrollbarYActive&&(a?t.scrollLeft+=a*e.settings.wheelSpeed:t.scrollLeft-=o*e.settings.wheelSpeed,l=!0):(t.scrollTop-=o*e.settings.wheelSpeed,t.scrollLeft+=a*e.settings.wheelSpeed),S(e),(l=l||function(n,r){var i=Math.floor(t.scrollTop),a=0===t.scrollTop,o=i+t.offsetHeight===t.scrollHeight,l=0===t.scrollLeft,s=t.scrollLeft+t.offsetWidth===t.scrollWidth;return!(Math.abs(r)>Math.abs(n)?a||o:l||s)||!e.settings.wheelPropagation}(a,o))&&!n.ctrlKey&&(n.stopPropagation(),n.preventDefault())}}"undefined"!==typeof window.onwheel?e.event.bind(t,"wheel",n):"undefined"!==typeof window.onmousewheel&&e.event.bind(t,"mousewheel",n)},touch:function(e){if(k.supportsTouch||k.supportsIePointer){var t=e.element,n={},i=0,a={},o=null;k.supportsTouch?(e.event.bind(t,"touchstart",c),e.event.bind(t,"touchmove",d),e.event.bind(t,"touchend",h)):k.supportsIePointer&&(window.PointerEvent?(e.event.bind(t,"pointerdown",c),e.event.bind(t,"pointermove",d),e.event.bind(t,"pointerup",h)):window.MSPointerEvent&&(e.event.bind(t,"MSPointerDown",c),e.event.bind(t,"MSPointerMove",d),e.event.bind(t,"MSPointerUp",h)))}function l(n,r){t.scrollTop-=r,t.scrollLeft-=n,S(e)}function s(e){return e.targetTouches?e.targetTouches[0]:e}function u(e){return(!e.pointerType||"pen"!==e.pointerType||0!==e.buttons)&&(!(!e.targetTouches||1!==e.targetTouches.length)||!(!e.pointerType||"mouse"===e.pointerType||e.pointerType===e.MSPOINTER_TYPE_MOUSE))}function c(e){if(u(e)){var t=s(e);n.pageX=t.pageX,n.pageY=t.pageY,i=(new Date).getTime(),null!==o&&clearInterval(o)}}function d(o){if(u(o)){var c=s(o),d={pageX:c.pageX,pageY:c.pageY},h=d.pageX-n.pageX,p=d.pageY-n.pageY;if(function(e,n,i){if(!t.contains(e))return!1;for(var a=e;a&&a!==t;){if(a.classList.contains(f.consuming))return!0;var o=r(a);if(i&&o.overflowY.match(/(scroll|auto)/)){var l=a.scrollHeight-a.clientHeight;if(l>0&&(a.scrollTop>0&&i<0||a.scrollTop<l&&i>0))return!0}if(n&&o.overflowX.match(/(scroll|auto)/)){var s=a.scrollWidth-a.clientWidth;if(s>0&&(a.scrollLeft>0&&n<0||a.scrollLeft<s&&n>0))return!0}a=a.parentNode}return!1}(o.target,h,p))return;l(h,p),n=d;var g=(new Date).getTime(),m=g-i;m>0&&(a.x=h/m,a.y=p/m,i=g),function(n,r){var i=Math.floor(t.scrollTop),a=t.scrollLeft,o=Math.abs(n),l=Math.abs(r);if(l>o){if(r<0&&i===e.contentHeight-e.containerHeight||r>0&&0===i)return 0===window.scrollY&&r>0&&k.isChrome}else if(o>l&&(n<0&&a===e.contentWidth-e.containerWidth||n>0&&0===a))return!0;return!0}(h,p)&&o.preventDefault()}}function h(){e.settings.swipeEasing&&(clearInterval(o),o=setInterval((function(){e.isInitialized?clearInterval(o):a.x||a.y?Math.abs(a.x)<.01&&Math.abs(a.y)<.01?clearInterval(o):(l(30*a.x,30*a.y),a.x*=.8,a.y*=.8):clearInterval(o)}),10))}}},O=function(e,t){var n=this;if(void 0===t&&(t={}),"string"===typeof e&&(e=document.querySelector(e)),!e||!e.nodeName)throw new Error("no element is specified to initialize PerfectScrollbar");for(var o in this.element=e,e.classList.add(c),this.settings={handlers:["click-rail","drag-thumb","keyboard","wheel","touch"],maxScrollbarLength:null,minScrollbarLength:null,scrollingThreshold:1e3,scrollXMarginOffset:0,scrollYMarginOffset:0,suppressScrollX:!1,suppressScrollY:!1,swipeEasing:!0,useBothWheelAxes:!1,wheelPropagation:!0,wheelSpeed:1},t)this.settings[o]=t[o];this.containerWidth=null,this.containerHeight=null,this.contentWidth=null,this.contentHeight=null;var l=function(){return e.classList.add(h.focus)},s=function(){return e.classList.remove(h.focus)};this.isRtl="rtl"===r(e).direction,!0===this.isRtl&&e.classList.add(d),this.isNegativeScroll=function(){var t,n=e.scrollLeft;return e.scrollLeft=-1,t=e.scrollLeft<0,e.scrollLeft=n,t}(),this.negativeScrollAdjustment=this.isNegativeScroll?e.scrollWidth-e.clientWidth:0,this.event=new b,this.ownerDocument=e.ownerDocument||document,this.scrollbarXRail=a(f.rail("x")),e.appendChild(this.scrollbarXRail),this.scrollbarX=a(f.thumb("x")),this.scrollbarXRail.appendChild(this.scrollbarX),this.scrollbarX.setAttribute("tabindex",0),this.event.bind(this.scrollbarX,"focus",l),this.event.bind(this.scrollbarX,"blur",s),this.scrollbarXActive=null,this.scrollbarXWidth=null,this.scrollbarXLeft=null;var u=r(this.scrollbarXRail);this.scrollbarXBottom=parseInt(u.bottom,10),isNaN(this.scrollbarXBottom)?(this.isScrollbarXUsingBottom=!1,this.scrollbarXTop=_(u.top)):this.isScrollbarXUsingBottom=!0,this.railBorderXWidth=_(u.borderLeftWidth)+_(u.borderRightWidth),i(this.scrollbarXRail,{display:"block"}),this.railXMarginWidth=_(u.marginLeft)+_(u.marginRight),i(this.scrollbarXRail,{display:""}),this.railXWidth=null,this.railXRatio=null,this.scrollbarYRail=a(f.rail("y")),e.appendChild(this.scrollbarYRail),this.scrollbarY=a(f.thumb("y")),this.scrollbarYRail.appendChild(this.scrollbarY),this.scrollbarY.setAttribute("tabindex",0),this.event.bind(this.scrollbarY,"focus",l),this.event.bind(this.scrollbarY,"blur",s),this.scrollbarYActive=null,this.scrollbarYHeight=null,this.scrollbarYTop=null;var p=r(this.scrollbarYRail);this.scrollbarYRight=parseInt(p.right,10),isNaN(this.scrollbarYRight)?(this.isScrollbarYUsingRight=!1,this.scrollbarYLeft=_(p.left)):this.isScrollbarYUsingRight=!0,this.scrollbarYOuterWidth=this.isRtl?function(e){var t=r(e);return _(t.width)+_(t.paddingLeft)+_(t.paddingRight)+_(t.borderLeftWidth)+_(t.borderRightWidth)}(this.scrollbarY):null,this.railBorderYWidth=_(p.borderTopWidth)+_(p.borderBottomWidth),i(this.scrollbarYRail,{display:"block"}),this.railYMarginHeight=_(p.marginTop)+_(p.marginBottom),i(this.scrollbarYRail,{display:""}),this.railYHeight=null,this.railYRatio=null,this.reach={x:e.scrollLeft<=0?"start":e.scrollLeft>=this.contentWidth-this.containerWidth?"end":null,y:e.scrollTop<=0?"start":e.scrollTop>=this.contentHeight-this.containerHeight?"end":null},this.isAlive=!0,this.settings.handlers.forEach((function(e){return E[e](n)})),this.lastScrollTop=Math.floor(e.scrollTop),this.lastScrollLeft=e.scrollLeft,this.event.bind(this.element,"scroll",(function(e){return n.onScroll(e)})),S(this)};O.prototype.update=function(){this.isAlive&&(this.negativeScrollAdjustment=this.isNegativeScroll?this.element.scrollWidth-this.element.clientWidth:0,i(this.scrollbarXRail,{display:"block"}),i(this.scrollbarYRail,{display:"block"}),this.railXMarginWidth=_(r(this.scrollbarXRail).marginLeft)+_(r(this.scrollbarXRail).marginRight),this.railYMarginHeight=_(r(this.scrollbarYRail).marginTop)+_(r(this.scrollbarYRail).marginBottom),i(this.scrollbarXRail,{display:"none"}),i(this.scrollbarYRail,{display:"none"}),S(this),w(this,"top",0,!1,!0),w(this,"left",0,!1,!0),i(this.scrollbarXRail,{display:""}),i(this.scrollbarYRail,{display:""}))},O.prototype.onScroll=function(e){this.isAlive&&(S(this),w(this,"top",this.element.scrollTop-this.lastScrollTop),w(this,"left",this.element.scrollLeft-this.lastScrollLeft),this.lastScrollTop=Math.floor(this.element.scrollTop),this.lastScrollLeft=this.element.scrollLeft)},O.prototype.destroy=function(){this.isAlive&&(this.event.unbindAll(),s(this.scrollbarX),s(this.scrollbarY),s(this.scrollbarXRail),s(this.scrollbarYRail),this.removePsClasses(),this.element=null,this.scrollbarX=null,this.scrollbarY=null,this.scrollbarXRail=null,this.scrollbarYRail=null,this.isAlive=!1)},O.prototype.removePsClasses=function(){this.element.className=this.element.className.split(" ").filter((function(e){return!e.match(/^ps([-_].+|)$/)})).join(" ")},t.a=O},function(e,t,n){var r=n(26),i=n(116),a=n(117),o=r?r.toStringTag:void 0;e.exports=function(e){return null==e?void 0===e?"[object Undefined]":"[object Null]":o&&o in Object(e)?i(e):a(e)}},function(e,t){e.exports=function(e){return null!=e&&"object"==typeof e}},function(e,t){e.exports=function(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){var r=n(105),i=n(106),a=n(107),o=n(108),l=n(109);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(60);e.exports=function(e,t){for(var n=e.length;n--;)if(r(e[n][0],t))return n;return-1}},function(e,t,n){var r=n(13).Symbol;e.exports=r},function(e,t,n){var r=n(16)(Object,"create");e.exports=r},function(e,t,n){var r=n(129);e.exports=function(e,t){var n=e.__data__;return r(t)?n["string"==typeof t?"string":"hash"]:n.map}},function(e,t,n){var r=n(45);e.exports=function(e){if("string"==typeof e||r(e))return e;var t=e+"";return"0"==t&&1/e==-Infinity?"-0":t}},function(e,t,n){"use strict";!function e(){if("undefined"!==typeof __REACT_DEVTOOLS_GLOBAL_HOOK__&&"function"===typeof __REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE)try{__REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE(e)}catch(t){console.error(t)}}(),e.exports=n(80)},function(e,t,n){"use strict";n.d(t,"a",(function(){return i}));var r=n(2),i=n.n(r).a.createContext({})},function(e,t,n){var r=n(99);e.exports=function(e,t){e.prototype=Object.create(t.prototype),e.prototype.constructor=e,r(e,t)},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";var r=l(n(90)),i=l(n(95)),a=l(n(55)),o=l(n(52));function l(e){return e&&e.__esModule?e:{default:e}}e.exports={Transition:o.default,TransitionGroup:a.default,ReplaceTransition:i.default,CSSTransition:r.default}},,function(e,t,n){"use strict";var r=Object.getOwnPropertySymbols,i=Object.prototype.hasOwnProperty,a=Object.prototype.propertyIsEnumerable;function o(e){if(null===e||void 0===e)throw new TypeError("Object.assign cannot be called with null or undefined");return Object(e)}e.exports=function(){try{if(!Object.assign)return!1;var e=new String("abc");if(e[5]="de","5"===Object.getOwnPropertyNames(e)[0])return!1;for(var t={},n=0;n<10;n++)t["_"+String.fromCharCode(n)]=n;if("0123456789"!==Object.getOwnPropertyNames(t).map((function(e){return t[e]})).join(""))return!1;var r={};return"abcdefghijklmnopqrst".split("").forEach((function(e){r[e]=e})),"abcdefghijklmnopqrst"===Object.keys(Object.assign({},r)).join("")}catch(i){return!1}}()?Object.assign:function(e,t){for(var n,l,s=o(e),u=1;u<arguments.length;u++){for(var c in n=Object(arguments[u]))i.call(n,c)&&(s[c]=n[c]);if(r){l=r(n);for(var d=0;d<l.length;d++)a.call(n,l[d])&&(s[l[d]]=n[l[d]])}}return s}},function(e,t){var n;n=function(){return this}();try{n=n||new Function("return this")()}catch(r){"object"===typeof window&&(n=window)}e.exports=n},function(e,t){e.exports=function(e){return e.webpackPolyfill||(e.deprecate=function(){},e.paths=[],e.children||(e.children=[]),Object.defineProperty(e,"loaded",{enumerable:!0,get:function(){return e.l}}),Object.defineProperty(e,"id",{enumerable:!0,get:function(){return e.i}}),e.webpackPolyfill=1),e}},function(e,t,n){var r=n(104),i=n(22);e.exports=function e(t,n,a,o,l){return t===n||(null==t||null==n||!i(t)&&!i(n)?t!==t&&n!==n:r(t,n,a,o,e,l))}},function(e,t,n){var r=n(16)(n(13),"Map");e.exports=r},function(e,t){e.exports=function(e){var t=typeof e;return null!=e&&("object"==t||"function"==t)}},function(e,t,n){var r=n(121),i=n(128),a=n(130),o=n(131),l=n(132);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(149),i=n(156),a=n(69);e.exports=function(e){return a(e)?r(e):i(e)}},function(e,t){e.exports=function(e){return"number"==typeof e&&e>-1&&e%1==0&&e<=9007199254740991}},function(e,t,n){var r=n(14),i=n(45),a=/\.|\[(?:[^[\]]*|(["'])(?:(?!\1)[^\\]|\\.)*?\1)\]/,o=/^\w*$/;e.exports=function(e,t){if(r(e))return!1;var n=typeof e;return!("number"!=n&&"symbol"!=n&&"boolean"!=n&&null!=e&&!i(e))||(o.test(e)||!a.test(e)||null!=t&&e in Object(t))}},function(e,t,n){var r=n(21),i=n(22);e.exports=function(e){return"symbol"==typeof e||i(e)&&"[object Symbol]"==r(e)}},function(e,t,n){e.exports=function(e,t){"use strict";e=e&&e.hasOwnProperty("default")?e.default:e,t=t&&t.hasOwnProperty("default")?t.default:t;var n=e.helpers,r=function(){if("undefined"!==typeof window)return window.cancelAnimationFrame||window.webkitCancelAnimationFrame||window.mozCancelAnimationFrame||window.oCancelAnimationFrame||window.msCancelAnimationFrame||function(e){return window.clearTimeout(e)}}(),i={startFrameRefreshTimer:function(e,t){if(!e.frameRequestID){var r=function r(){t(),e.frameRequestID=n.requestAnimFrame.call(window,r)};e.frameRequestID=n.requestAnimFrame.call(window,r)}},stopFrameRefreshTimer:function(e){var t=e.frameRequestID;t&&(r.call(window,t),delete e.frameRequestID)}},a=e.helpers,o=a.canvas,l=e.scaleService,s=l.getScaleConstructor("time");l.getScaleConstructor=function(e){return"time"===e&&(e="realtime"),this.constructors.hasOwnProperty(e)?this.constructors[e]:void 0};var u={parse:function(e,n){return"string"===typeof e&&"string"===typeof n?e=t(e,n):e instanceof t||(e=t(e)),e.isValid()?e.valueOf():null}};function c(e,t){var n=e._adapter||u,r=e.options.time,i=r.parser,a=i||r.format,o=t;return"function"===typeof i&&(o=i(o)),("number"===typeof o||o instanceof Number)&&isFinite(o)||(o="string"===typeof a?n.parse(o,a):n.parse(o)),null!==o?+o:(i||"function"!==typeof a||("number"===typeof(o=a(t))||o instanceof Number)&&isFinite(o)||(o=n.parse(o)),o)}function d(e,t){if(a.isNullOrUndef(t))return null;var n=e.options.time,r=c(e,e.getRightValue(t));return null===r||n.round&&(r=+e._adapter.startOf(r,n.round)),r}function f(e,t){var n=e.options.realtime,r=e.chart.options.plugins.streaming;return a.valueOrDefault(n[t],r[t])}var h=["pointBackgroundColor","pointBorderColor","pointBorderWidth","pointRadius","pointRotation","pointStyle","pointHitRadius","pointHoverBackgroundColor","pointHoverBorderColor","pointHoverBorderWidth","pointHoverRadius","backgroundColor","borderColor","borderSkipped","borderWidth","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth","hoverRadius","hitRadius","radius","rotation"];function p(e){var t,n,r,i,o,l,s,u=e.chart,c=e.id,d=f(e,"duration"),p=f(e,"delay"),g=f(e,"ttl"),m=f(e,"pause"),v=f(e,"onRefresh"),y=e.max,b=Date.now()-(isNaN(g)?d+p:g);v&&v(u),u.data.datasets.forEach((function(d,f){if(t=u.getDatasetMeta(f),c===t.xAxisID||c===t.yAxisID){if(n=d.data,r=n.length,m){for(i=0;i<r&&e._getTimeForIndex(i,f)<y;++i);o=i+2}else o=0;for(i=o;i<r&&e._getTimeForIndex(i,f)<=b;++i);l=i-o,isNaN(g)&&(l=Math.max(l-2,0)),n.splice(o,l),h.forEach((function(e){d.hasOwnProperty(e)&&a.isArray(d[e])&&d[e].splice(o,l)})),a.each(d.datalabels,(function(e){a.isArray(e)&&e.splice(o,l)})),"object"!==typeof n[0]&&(s={start:o,count:l})}})),s&&u.data.labels.splice(s.start,s.count),u.update({preservation:!0})}function g(e){var t=e.realtime,n=t.refreshTimerID;n&&(clearInterval(n),delete t.refreshTimerID,delete t.refreshInterval)}function m(e){var t=e.realtime,n=f(e,"refresh");t.refreshTimerID=setInterval((function(){var n=f(e,"refresh");p(e),t.refreshInterval===n||isNaN(n)||(g(e),m(e))}),n),t.refreshInterval=n}var v={x:{data:["x","controlPointPreviousX","controlPointNextX"],dataset:["x"],tooltip:["x","caretX"]},y:{data:["y","controlPointPreviousY","controlPointNextY"],dataset:["y"],tooltip:["y","caretY"]}};function y(e,t,n){var r,i,a=e._start||{},o=e._view||{},l=e._model||{};for(r=0,i=t.length;r<i;++r){var s=t[r];a.hasOwnProperty(s)&&(a[s]-=n),o.hasOwnProperty(s)&&o!==a&&(o[s]-=n),l.hasOwnProperty(s)&&l!==o&&(l[s]-=n)}}function b(e){var t,n,r,i,o,l,s,u=e.chart,c=e.realtime,d=f(e,"duration"),h=f(e,"delay"),p=e.id,g=u.tooltip,m=g._active,b=Date.now();e.isHorizontal()?(t=e.width,n=v.x):(t=e.height,n=v.y),r=t*(b-c.head)/d,e.options.ticks.reverse&&(r=-r),a.each(u.data.datasets,(function(e,t){if(i=u.getDatasetMeta(t),p===i.xAxisID||p===i.yAxisID){for(o=i.data||[],l=0,s=o.length;l<s;++l)y(o[l],n.data,r);i.dataset&&y(i.dataset,n.dataset,r)}})),m&&m[0]&&(i=u.getDatasetMeta(m[0]._datasetIndex),p!==i.xAxisID&&p!==i.yAxisID||y(g,n.tooltip,r)),e.max=e._table[1].time=b-h,e.min=e._table[0].time=e.max-d,c.head=b}var x={position:"bottom",distribution:"linear",bounds:"data",adapters:{},time:{parser:!1,format:!1,unit:!1,round:!1,displayFormat:!1,isoWeekday:!1,minUnit:"millisecond",displayFormats:{millisecond:"h:mm:ss.SSS a",second:"h:mm:ss a",minute:"h:mm a",hour:"hA",day:"MMM D",week:"ll",month:"MMM YYYY",quarter:"[Q]Q - YYYY",year:"YYYY"}},realtime:{},ticks:{autoSkip:!1,source:"auto",major:{enabled:!0}}},w=s.extend({initialize:function(){var e=this;s.prototype.initialize.apply(e,arguments),("time"!==e.options.type||e.chart.options.plugins.streaming)&&(e.realtime=e.realtime||{},m(e))},update:function(){var e=this,t=e.realtime;return"time"!==e.options.type||e.chart.options.plugins.streaming?(f(e,"pause")?i.stopFrameRefreshTimer(t):(i.startFrameRefreshTimer(t,(function(){b(e)})),t.head=Date.now()),s.prototype.update.apply(e,arguments)):s.prototype.update.apply(e,arguments)},buildTicks:function(){var e=this,t=e.options;if("time"===t.type&&!e.chart.options.plugins.streaming)return s.prototype.buildTicks.apply(e,arguments);var n,r=t.time,i=t.ticks.major,o=f(e,"duration"),l=f(e,"delay"),u=f(e,"refresh"),c=t.bounds,d=t.distribution,h=t.offset,p=r.min,g=r.max,m=i.enabled,v=e.realtime.head-l,y=v-o,b=[v+u,v];return t.bounds=void 0,t.distribution="linear",t.offset=!1,r.min=-1e15,r.max=1e15,i.enabled=!0,Object.defineProperty(e,"min",{get:function(){return y},set:a.noop}),Object.defineProperty(e,"max",{get:function(){return b.shift()},set:a.noop}),n=s.prototype.buildTicks.apply(e,arguments),delete e.min,delete e.max,e.min=y,e.max=v,t.bounds=c,t.distribution=d,t.offset=h,r.min=p,r.max=g,i.enabled=m,e._table=[{time:y,pos:0},{time:v,pos:1}],n},fit:function(){var e=this,t=e.options;s.prototype.fit.apply(e,arguments),("time"!==t.type||e.chart.options.plugins.streaming)&&t.ticks.display&&t.display&&e.isHorizontal()&&(e.paddingLeft=3,e.paddingRight=3,e.handleMargins())},draw:function(e){var t=this,n=t.chart;if("time"!==t.options.type||n.options.plugins.streaming){var r=t.ctx,i=t.isHorizontal()?{left:e.left,top:0,right:e.right,bottom:n.height}:{left:0,top:e.top,right:n.width,bottom:e.bottom};o.clipArea(r,i),s.prototype.draw.apply(t,arguments),o.unclipArea(r)}else s.prototype.draw.apply(t,arguments)},destroy:function(){var e=this;("time"!==e.options.type||e.chart.options.plugins.streaming)&&(i.stopFrameRefreshTimer(e.realtime),g(e))},_getTimeForIndex:function(e,t){var n,r=this,i=r._timestamps,o=i.datasets[t][e];return a.isNullOrUndef(o)&&(n=r.chart.data.datasets[t].data[e],o=a.isObject(n)?d(r,n):d(r,i.labels[e])),o}});l.registerScaleType("realtime",w,x);var _=e.helpers,k=_.canvas;function S(t){var n,r,i,a,o=this,l=t&&t.preservation;l&&(n=o.tooltip,r=o.lastActive,i=n._lastActive,o._bufferedRender=!0),e.prototype.update.apply(o,arguments),l&&(o._bufferedRender=!1,o._bufferedRequest=null,o.lastActive=r,n._lastActive=i,o.animating?e.animationService.animations.forEach((function(e){e.chart===o&&o.render({duration:16.66*(e.numSteps-e.currentStep)})})):o.data.datasets.forEach((function(e,t){o.getDatasetMeta(t).controller.transition(1)})),n._active&&n.update(!0),(a=o.streaming.lastMouseEvent)&&o.eventHandler(a))}function M(e){var t=e.streaming,n=e.options.plugins.streaming.frameRate,r=1e3/(Math.max(n,0)||30),i=t.lastDrawn+r||0,a=Date.now(),o=t.lastMouseEvent;i<=a&&(e.animating||e.tooltip._start||e.draw(),o&&e.eventHandler(o),t.lastDrawn=i+r>a?i:a)}e.defaults.global.plugins.streaming={duration:1e4,delay:0,frameRate:30,refresh:1e3,onRefresh:null,pause:!1,ttl:void 0};var C={id:"streaming",beforeInit:function(e){var t=e.streaming=e.streaming||{},n=t.canvas=e.canvas,r=t.mouseEventListener=function(n){var r=_.getRelativePosition(n,e);t.lastMouseEvent={type:"mousemove",chart:e,native:n,x:r.x,y:r.y}};n.addEventListener("mousedown",r),n.addEventListener("mouseup",r)},afterInit:function(t){t.update=S,t.resetZoom&&e.Zoom.updateResetZoom(t)},beforeUpdate:function(e){var t=e.options,n=t.scales;return n&&n.xAxes.concat(n.yAxes).forEach((function(e){"realtime"!==e.type&&"time"!==e.type||(t.elements.line.capBezierPoints=!1)})),!0},afterUpdate:function(e,t){var n=e.streaming,r=!0;_.each(e.scales,(function(e){e instanceof w&&(r&=_.valueOrDefault(e.options.realtime.pause,t.pause))})),r?i.stopFrameRefreshTimer(n):i.startFrameRefreshTimer(n,(function(){M(e)}))},beforeDatasetDraw:function(e,t){var n=t.meta,r=e.chartArea,i={left:0,top:0,right:e.width,bottom:e.height};return n.xAxisID&&n.controller.getScaleForId(n.xAxisID)instanceof w&&(i.left=r.left,i.right=r.right),n.yAxisID&&n.controller.getScaleForId(n.yAxisID)instanceof w&&(i.top=r.top,i.bottom=r.bottom),k.clipArea(e.ctx,i),!0},afterDatasetDraw:function(e){k.unclipArea(e.ctx)},beforeEvent:function(e,t){var n=e.streaming;return"mousemove"===t.type?n.lastMouseEvent=t:"mouseout"===t.type&&delete n.lastMouseEvent,!0},destroy:function(e){var t=e.streaming,n=t.canvas,r=t.mouseEventListener;i.stopFrameRefreshTimer(t),n.removeEventListener("mousedown",r),n.removeEventListener("mouseup",r),_.each(e.scales,(function(e){e instanceof w&&e.destroy()}))}},E=e.helpers,O=e.Zoom=e.Zoom||{};function P(e,t){if(e.scaleAxes&&e.rangeMax&&!E.isNullOrUndef(e.rangeMax[e.scaleAxes])){var n=e.rangeMax[e.scaleAxes];t>n&&(t=n)}return t}function T(e,t){if(e.scaleAxes&&e.rangeMin&&!E.isNullOrUndef(e.rangeMin[e.scaleAxes])){var n=e.rangeMin[e.scaleAxes];t<n&&(t=n)}return t}function D(e,t,n,r){var i,a,o=e.options.realtime,l=e.chart.options.plugins.streaming,s=E.valueOrDefault(o.duration,l.duration),u=E.valueOrDefault(o.delay,l.delay),c=s*(2-t);i=e.isHorizontal()?(e.right-n.x)/(e.right-e.left):(e.bottom-n.y)/(e.bottom-e.top),a=t<1?P(r,c):T(r,c),o.duration=a,o.delay=u+i*(s-a)}function N(e,t,n){var r=e.options.realtime,i=e.chart.options.plugins.streaming,a=E.valueOrDefault(r.delay,i.delay)+(e.getValueForPixel(t)-e.getValueForPixel(0));r.delay=t>0?P(n,a):T(n,a)}function R(e){var t=e.$zoom||{_originalOptions:{}},n=e.resetZoom,r=e.update,i=function(){E.each(e.scales,(function(e){var n=e.options.realtime,r=t._originalOptions[e.id]||e.originalOptions;n&&(r?(n.duration=r.realtime.duration,n.delay=r.realtime.delay):(delete n.duration,delete n.delay))})),r.call(e,{duration:0})};e.resetZoom=function(){e.update=i,n(),e.update=r}}return O.zoomFunctions=O.zoomFunctions||{},O.panFunctions=O.panFunctions||{},O.zoomFunctions.realtime=D,O.panFunctions.realtime=N,O.updateResetZoom=R,e.helpers.streaming=i,e.plugins.register(C),C}(n(57),n(58))},function(e,t,n){"use strict";var r=function(){};e.exports=r},function(e,t,n){"use strict";(function(e){var r=n(2),i=n.n(r),a=n(7),o=n(1),l=n.n(o),s=1073741823,u="undefined"!==typeof globalThis?globalThis:"undefined"!==typeof window?window:"undefined"!==typeof e?e:{};function c(e){var t=[];return{on:function(e){t.push(e)},off:function(e){t=t.filter((function(t){return t!==e}))},get:function(){return e},set:function(n,r){e=n,t.forEach((function(t){return t(e,r)}))}}}var d=i.a.createContext||function(e,t){var n,i,o="__create-react-context-"+function(){var e="__global_unique_id__";return u[e]=(u[e]||0)+1}()+"__",d=function(e){function n(){var t;return(t=e.apply(this,arguments)||this).emitter=c(t.props.value),t}Object(a.a)(n,e);var r=n.prototype;return r.getChildContext=function(){var e;return(e={})[o]=this.emitter,e},r.componentWillReceiveProps=function(e){if(this.props.value!==e.value){var n,r=this.props.value,i=e.value;((a=r)===(o=i)?0!==a||1/a===1/o:a!==a&&o!==o)?n=0:(n="function"===typeof t?t(r,i):s,0!==(n|=0)&&this.emitter.set(e.value,n))}var a,o},r.render=function(){return this.props.children},n}(r.Component);d.childContextTypes=((n={})[o]=l.a.object.isRequired,n);var f=function(t){function n(){var e;return(e=t.apply(this,arguments)||this).state={value:e.getValue()},e.onUpdate=function(t,n){0!==((0|e.observedBits)&n)&&e.setState({value:e.getValue()})},e}Object(a.a)(n,t);var r=n.prototype;return r.componentWillReceiveProps=function(e){var t=e.observedBits;this.observedBits=void 0===t||null===t?s:t},r.componentDidMount=function(){this.context[o]&&this.context[o].on(this.onUpdate);var e=this.props.observedBits;this.observedBits=void 0===e||null===e?s:e},r.componentWillUnmount=function(){this.context[o]&&this.context[o].off(this.onUpdate)},r.getValue=function(){return this.context[o]?this.context[o].get():e},r.render=function(){return(e=this.props.children,Array.isArray(e)?e[0]:e)(this.state.value);var e},n}(r.Component);return f.contextTypes=((i={})[o]=l.a.object,i),{Provider:d,Consumer:f}};t.a=d}).call(this,n(36))},function(e,t,n){var r=n(97);e.exports=h,e.exports.parse=a,e.exports.compile=function(e,t){return l(a(e,t),t)},e.exports.tokensToFunction=l,e.exports.tokensToRegExp=f;var i=new RegExp(["(\\\\.)","([\\/.])?(?:(?:\\:(\\w+)(?:\\(((?:\\\\.|[^\\\\()])+)\\))?|\\(((?:\\\\.|[^\\\\()])+)\\))([+*?])?|(\\*))"].join("|"),"g");function a(e,t){for(var n,r=[],a=0,o=0,l="",c=t&&t.delimiter||"/";null!=(n=i.exec(e));){var d=n[0],f=n[1],h=n.index;if(l+=e.slice(o,h),o=h+d.length,f)l+=f[1];else{var p=e[o],g=n[2],m=n[3],v=n[4],y=n[5],b=n[6],x=n[7];l&&(r.push(l),l="");var w=null!=g&&null!=p&&p!==g,_="+"===b||"*"===b,k="?"===b||"*"===b,S=n[2]||c,M=v||y;r.push({name:m||a++,prefix:g||"",delimiter:S,optional:k,repeat:_,partial:w,asterisk:!!x,pattern:M?u(M):x?".*":"[^"+s(S)+"]+?"})}}return o<e.length&&(l+=e.substr(o)),l&&r.push(l),r}function o(e){return encodeURI(e).replace(/[\/?#]/g,(function(e){return"%"+e.charCodeAt(0).toString(16).toUpperCase()}))}function l(e,t){for(var n=new Array(e.length),i=0;i<e.length;i++)"object"===typeof e[i]&&(n[i]=new RegExp("^(?:"+e[i].pattern+")$",d(t)));return function(t,i){for(var a="",l=t||{},s=(i||{}).pretty?o:encodeURIComponent,u=0;u<e.length;u++){var c=e[u];if("string"!==typeof c){var d,f=l[c.name];if(null==f){if(c.optional){c.partial&&(a+=c.prefix);continue}throw new TypeError('Expected "'+c.name+'" to be defined')}if(r(f)){if(!c.repeat)throw new TypeError('Expected "'+c.name+'" to not repeat, but received `'+JSON.stringify(f)+"`");if(0===f.length){if(c.optional)continue;throw new TypeError('Expected "'+c.name+'" to not be empty')}for(var h=0;h<f.length;h++){if(d=s(f[h]),!n[u].test(d))throw new TypeError('Expected all "'+c.name+'" to match "'+c.pattern+'", but received `'+JSON.stringify(d)+"`");a+=(0===h?c.prefix:c.delimiter)+d}}else{if(d=c.asterisk?encodeURI(f).replace(/[?#]/g,(function(e){return"%"+e.charCodeAt(0).toString(16).toUpperCase()})):s(f),!n[u].test(d))throw new TypeError('Expected "'+c.name+'" to match "'+c.pattern+'", but received "'+d+'"');a+=c.prefix+d}}else a+=c}return a}}function s(e){return e.replace(/([.+*?=^!:${}()[\]|\/\\])/g,"\\$1")}function u(e){return e.replace(/([=!:$\/()])/g,"\\$1")}function c(e,t){return e.keys=t,e}function d(e){return e&&e.sensitive?"":"i"}function f(e,t,n){r(t)||(n=t||n,t=[]);for(var i=(n=n||{}).strict,a=!1!==n.end,o="",l=0;l<e.length;l++){var u=e[l];if("string"===typeof u)o+=s(u);else{var f=s(u.prefix),h="(?:"+u.pattern+")";t.push(u),u.repeat&&(h+="(?:"+f+h+")*"),o+=h=u.optional?u.partial?f+"("+h+")?":"(?:"+f+"("+h+"))?":f+"("+h+")"}}var p=s(n.delimiter||"/"),g=o.slice(-p.length)===p;return i||(o=(g?o.slice(0,-p.length):o)+"(?:"+p+"(?=$))?"),o+=a?"$":i&&g?"":"(?="+p+"|$)",c(new RegExp("^"+o,d(n)),t)}function h(e,t,n){return r(t)||(n=t||n,t=[]),n=n||{},e instanceof RegExp?function(e,t){var n=e.source.match(/\((?!\?)/g);if(n)for(var r=0;r<n.length;r++)t.push({name:r,prefix:null,delimiter:null,optional:!1,repeat:!1,partial:!1,asterisk:!1,pattern:null});return c(e,t)}(e,t):r(e)?function(e,t,n){for(var r=[],i=0;i<e.length;i++)r.push(h(e[i],t,n).source);return c(new RegExp("(?:"+r.join("|")+")",d(n)),t)}(e,t,n):function(e,t,n){return f(a(e,n),t,n)}(e,t,n)}},function(e,t,n){"use strict";n.d(t,"a",(function(){return h})),n.d(t,"b",(function(){return p}));var r=n(32),i=n.n(r),a=n(15),o=n.n(a),l=n(23),s=n.n(l),u=n(2),c=n(51),d=n.n(c),f=d()(),h=d()(),p=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return t=e.call.apply(e,[this].concat(r))||this,s()(o()(o()(t)),"referenceNode",void 0),s()(o()(o()(t)),"setReferenceNode",(function(e){e&&t.referenceNode!==e&&(t.referenceNode=e,t.forceUpdate())})),t}i()(t,e);var n=t.prototype;return n.componentWillUnmount=function(){this.referenceNode=null},n.render=function(){return u.createElement(f.Provider,{value:this.referenceNode},u.createElement(h.Provider,{value:this.setReferenceNode},this.props.children))},t}(u.Component)},function(e,t,n){"use strict";t.__esModule=!0;var r=a(n(2)),i=a(n(100));function a(e){return e&&e.__esModule?e:{default:e}}t.default=r.default.createContext||i.default,e.exports=t.default},function(e,t,n){"use strict";t.__esModule=!0,t.default=t.EXITING=t.ENTERED=t.ENTERING=t.EXITED=t.UNMOUNTED=void 0;var r=function(e){if(e&&e.__esModule)return e;var t={};if(null!=e)for(var n in e)if(Object.prototype.hasOwnProperty.call(e,n)){var r=Object.defineProperty&&Object.getOwnPropertyDescriptor?Object.getOwnPropertyDescriptor(e,n):{};r.get||r.set?Object.defineProperty(t,n,r):t[n]=e[n]}return t.default=e,t}(n(1)),i=l(n(2)),a=l(n(30)),o=n(53);n(54);function l(e){return e&&e.__esModule?e:{default:e}}var s="unmounted";t.UNMOUNTED=s;var u="exited";t.EXITED=u;var c="entering";t.ENTERING=c;var d="entered";t.ENTERED=d;var f="exiting";t.EXITING=f;var h=function(e){var t,n;function r(t,n){var r;r=e.call(this,t,n)||this;var i,a=n.transitionGroup,o=a&&!a.isMounting?t.enter:t.appear;return r.appearStatus=null,t.in?o?(i=u,r.appearStatus=c):i=d:i=t.unmountOnExit||t.mountOnEnter?s:u,r.state={status:i},r.nextCallback=null,r}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var o=r.prototype;return o.getChildContext=function(){return{transitionGroup:null}},r.getDerivedStateFromProps=function(e,t){return e.in&&t.status===s?{status:u}:null},o.componentDidMount=function(){this.updateStatus(!0,this.appearStatus)},o.componentDidUpdate=function(e){var t=null;if(e!==this.props){var n=this.state.status;this.props.in?n!==c&&n!==d&&(t=c):n!==c&&n!==d||(t=f)}this.updateStatus(!1,t)},o.componentWillUnmount=function(){this.cancelNextCallback()},o.getTimeouts=function(){var e,t,n,r=this.props.timeout;return e=t=n=r,null!=r&&"number"!==typeof r&&(e=r.exit,t=r.enter,n=void 0!==r.appear?r.appear:t),{exit:e,enter:t,appear:n}},o.updateStatus=function(e,t){if(void 0===e&&(e=!1),null!==t){this.cancelNextCallback();var n=a.default.findDOMNode(this);t===c?this.performEnter(n,e):this.performExit(n)}else this.props.unmountOnExit&&this.state.status===u&&this.setState({status:s})},o.performEnter=function(e,t){var n=this,r=this.props.enter,i=this.context.transitionGroup?this.context.transitionGroup.isMounting:t,a=this.getTimeouts(),o=i?a.appear:a.enter;t||r?(this.props.onEnter(e,i),this.safeSetState({status:c},(function(){n.props.onEntering(e,i),n.onTransitionEnd(e,o,(function(){n.safeSetState({status:d},(function(){n.props.onEntered(e,i)}))}))}))):this.safeSetState({status:d},(function(){n.props.onEntered(e)}))},o.performExit=function(e){var t=this,n=this.props.exit,r=this.getTimeouts();n?(this.props.onExit(e),this.safeSetState({status:f},(function(){t.props.onExiting(e),t.onTransitionEnd(e,r.exit,(function(){t.safeSetState({status:u},(function(){t.props.onExited(e)}))}))}))):this.safeSetState({status:u},(function(){t.props.onExited(e)}))},o.cancelNextCallback=function(){null!==this.nextCallback&&(this.nextCallback.cancel(),this.nextCallback=null)},o.safeSetState=function(e,t){t=this.setNextCallback(t),this.setState(e,t)},o.setNextCallback=function(e){var t=this,n=!0;return this.nextCallback=function(r){n&&(n=!1,t.nextCallback=null,e(r))},this.nextCallback.cancel=function(){n=!1},this.nextCallback},o.onTransitionEnd=function(e,t,n){this.setNextCallback(n);var r=null==t&&!this.props.addEndListener;e&&!r?(this.props.addEndListener&&this.props.addEndListener(e,this.nextCallback),null!=t&&setTimeout(this.nextCallback,t)):setTimeout(this.nextCallback,0)},o.render=function(){var e=this.state.status;if(e===s)return null;var t=this.props,n=t.children,r=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(t,["children"]);if(delete r.in,delete r.mountOnEnter,delete r.unmountOnExit,delete r.appear,delete r.enter,delete r.exit,delete r.timeout,delete r.addEndListener,delete r.onEnter,delete r.onEntering,delete r.onEntered,delete r.onExit,delete r.onExiting,delete r.onExited,"function"===typeof n)return n(e,r);var a=i.default.Children.only(n);return i.default.cloneElement(a,r)},r}(i.default.Component);function p(){}h.contextTypes={transitionGroup:r.object},h.childContextTypes={transitionGroup:function(){}},h.propTypes={},h.defaultProps={in:!1,mountOnEnter:!1,unmountOnExit:!1,appear:!1,enter:!0,exit:!0,onEnter:p,onEntering:p,onEntered:p,onExit:p,onExiting:p,onExited:p},h.UNMOUNTED=0,h.EXITED=1,h.ENTERING=2,h.ENTERED=3,h.EXITING=4;var g=(0,o.polyfill)(h);t.default=g},function(e,t,n){"use strict";function r(){var e=this.constructor.getDerivedStateFromProps(this.props,this.state);null!==e&&void 0!==e&&this.setState(e)}function i(e){this.setState(function(t){var n=this.constructor.getDerivedStateFromProps(e,t);return null!==n&&void 0!==n?n:null}.bind(this))}function a(e,t){try{var n=this.props,r=this.state;this.props=e,this.state=t,this.__reactInternalSnapshotFlag=!0,this.__reactInternalSnapshot=this.getSnapshotBeforeUpdate(n,r)}finally{this.props=n,this.state=r}}function o(e){var t=e.prototype;if(!t||!t.isReactComponent)throw new Error("Can only polyfill class components");if("function"!==typeof e.getDerivedStateFromProps&&"function"!==typeof t.getSnapshotBeforeUpdate)return e;var n=null,o=null,l=null;if("function"===typeof t.componentWillMount?n="componentWillMount":"function"===typeof t.UNSAFE_componentWillMount&&(n="UNSAFE_componentWillMount"),"function"===typeof t.componentWillReceiveProps?o="componentWillReceiveProps":"function"===typeof t.UNSAFE_componentWillReceiveProps&&(o="UNSAFE_componentWillReceiveProps"),"function"===typeof t.componentWillUpdate?l="componentWillUpdate":"function"===typeof t.UNSAFE_componentWillUpdate&&(l="UNSAFE_componentWillUpdate"),null!==n||null!==o||null!==l){var s=e.displayName||e.name,u="function"===typeof e.getDerivedStateFromProps?"getDerivedStateFromProps()":"getSnapshotBeforeUpdate()";throw Error("Unsafe legacy lifecycles will not be called for components using new component APIs.\n\n"+s+" uses "+u+" but also contains the following legacy lifecycles:"+(null!==n?"\n  "+n:"")+(null!==o?"\n  "+o:"")+(null!==l?"\n  "+l:"")+"\n\nThe above lifecycles should be removed. Learn more about this warning here:\nhttps://fb.me/react-async-component-lifecycle-hooks")}if("function"===typeof e.getDerivedStateFromProps&&(t.componentWillMount=r,t.componentWillReceiveProps=i),"function"===typeof t.getSnapshotBeforeUpdate){if("function"!==typeof t.componentDidUpdate)throw new Error("Cannot polyfill getSnapshotBeforeUpdate() for components that do not define componentDidUpdate() on the prototype");t.componentWillUpdate=a;var c=t.componentDidUpdate;t.componentDidUpdate=function(e,t,n){var r=this.__reactInternalSnapshotFlag?this.__reactInternalSnapshot:n;c.call(this,e,t,r)}}return e}n.r(t),n.d(t,"polyfill",(function(){return o})),r.__suppressDeprecationWarning=!0,i.__suppressDeprecationWarning=!0,a.__suppressDeprecationWarning=!0},function(e,t,n){"use strict";t.__esModule=!0,t.classNamesShape=t.timeoutsShape=void 0;var r;(r=n(1))&&r.__esModule;t.timeoutsShape=null;t.classNamesShape=null},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;var r=l(n(1)),i=l(n(2)),a=n(53),o=n(96);function l(e){return e&&e.__esModule?e:{default:e}}function s(){return(s=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}function u(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}var c=Object.values||function(e){return Object.keys(e).map((function(t){return e[t]}))},d=function(e){var t,n;function r(t,n){var r,i=(r=e.call(this,t,n)||this).handleExited.bind(u(u(r)));return r.state={handleExited:i,firstRender:!0},r}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var a=r.prototype;return a.getChildContext=function(){return{transitionGroup:{isMounting:!this.appeared}}},a.componentDidMount=function(){this.appeared=!0,this.mounted=!0},a.componentWillUnmount=function(){this.mounted=!1},r.getDerivedStateFromProps=function(e,t){var n=t.children,r=t.handleExited;return{children:t.firstRender?(0,o.getInitialChildMapping)(e,r):(0,o.getNextChildMapping)(e,n,r),firstRender:!1}},a.handleExited=function(e,t){var n=(0,o.getChildMapping)(this.props.children);e.key in n||(e.props.onExited&&e.props.onExited(t),this.mounted&&this.setState((function(t){var n=s({},t.children);return delete n[e.key],{children:n}})))},a.render=function(){var e=this.props,t=e.component,n=e.childFactory,r=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,["component","childFactory"]),a=c(this.state.children).map(n);return delete r.appear,delete r.enter,delete r.exit,null===t?a:i.default.createElement(t,r,a)},r}(i.default.Component);d.childContextTypes={transitionGroup:r.default.object.isRequired},d.propTypes={},d.defaultProps={component:"div",childFactory:function(e){return e}};var f=(0,a.polyfill)(d);t.default=f,e.exports=t.default},function(e,t,n){"use strict";e.exports=n(98)},function(e,t,n){e.exports=function(e){"use strict";e=e&&e.hasOwnProperty("default")?e.default:e;var t={rgb2hsl:n,rgb2hsv:i,rgb2hwb:a,rgb2cmyk:o,rgb2keyword:l,rgb2xyz:s,rgb2lab:u,rgb2lch:c,hsl2rgb:d,hsl2hsv:f,hsl2hwb:h,hsl2cmyk:p,hsl2keyword:m,hsv2rgb:v,hsv2hsl:y,hsv2hwb:x,hsv2cmyk:w,hsv2keyword:_,hwb2rgb:k,hwb2hsl:S,hwb2hsv:M,hwb2cmyk:C,hwb2keyword:E,cmyk2rgb:O,cmyk2hsl:P,cmyk2hsv:T,cmyk2hwb:D,cmyk2keyword:N,keyword2rgb:H,keyword2hsl:U,keyword2hsv:V,keyword2hwb:B,keyword2cmyk:$,keyword2lab:X,keyword2xyz:q,xyz2rgb:R,xyz2lab:A,xyz2lch:I,lab2xyz:L,lab2rgb:F,lab2lch:j,lch2lab:z,lch2xyz:W,lch2rgb:Y};function n(e){var t,n,r=e[0]/255,i=e[1]/255,a=e[2]/255,o=Math.min(r,i,a),l=Math.max(r,i,a),s=l-o;return l==o?t=0:r==l?t=(i-a)/s:i==l?t=2+(a-r)/s:a==l&&(t=4+(r-i)/s),(t=Math.min(60*t,360))<0&&(t+=360),n=(o+l)/2,[t,100*(l==o?0:n<=.5?s/(l+o):s/(2-l-o)),100*n]}function i(e){var t,n,r=e[0],i=e[1],a=e[2],o=Math.min(r,i,a),l=Math.max(r,i,a),s=l-o;return n=0==l?0:s/l*1e3/10,l==o?t=0:r==l?t=(i-a)/s:i==l?t=2+(a-r)/s:a==l&&(t=4+(r-i)/s),(t=Math.min(60*t,360))<0&&(t+=360),[t,n,l/255*1e3/10]}function a(e){var t=e[0],r=e[1],i=e[2];return[n(e)[0],1/255*Math.min(t,Math.min(r,i))*100,100*(i=1-1/255*Math.max(t,Math.max(r,i)))]}function o(e){var t,n=e[0]/255,r=e[1]/255,i=e[2]/255;return[100*((1-n-(t=Math.min(1-n,1-r,1-i)))/(1-t)||0),100*((1-r-t)/(1-t)||0),100*((1-i-t)/(1-t)||0),100*t]}function l(e){return K[JSON.stringify(e)]}function s(e){var t=e[0]/255,n=e[1]/255,r=e[2]/255;return[100*(.4124*(t=t>.04045?Math.pow((t+.055)/1.055,2.4):t/12.92)+.3576*(n=n>.04045?Math.pow((n+.055)/1.055,2.4):n/12.92)+.1805*(r=r>.04045?Math.pow((r+.055)/1.055,2.4):r/12.92)),100*(.2126*t+.7152*n+.0722*r),100*(.0193*t+.1192*n+.9505*r)]}function u(e){var t=s(e),n=t[0],r=t[1],i=t[2];return r/=100,i/=108.883,n=(n/=95.047)>.008856?Math.pow(n,1/3):7.787*n+16/116,[116*(r=r>.008856?Math.pow(r,1/3):7.787*r+16/116)-16,500*(n-r),200*(r-(i=i>.008856?Math.pow(i,1/3):7.787*i+16/116))]}function c(e){return j(u(e))}function d(e){var t,n,r,i,a,o=e[0]/360,l=e[1]/100,s=e[2]/100;if(0==l)return[a=255*s,a,a];t=2*s-(n=s<.5?s*(1+l):s+l-s*l),i=[0,0,0];for(var u=0;u<3;u++)(r=o+1/3*-(u-1))<0&&r++,r>1&&r--,a=6*r<1?t+6*(n-t)*r:2*r<1?n:3*r<2?t+(n-t)*(2/3-r)*6:t,i[u]=255*a;return i}function f(e){var t=e[0],n=e[1]/100,r=e[2]/100;return 0===r?[0,0,0]:[t,2*(n*=(r*=2)<=1?r:2-r)/(r+n)*100,(r+n)/2*100]}function h(e){return a(d(e))}function p(e){return o(d(e))}function m(e){return l(d(e))}function v(e){var t=e[0]/60,n=e[1]/100,r=e[2]/100,i=Math.floor(t)%6,a=t-Math.floor(t),o=255*r*(1-n),l=255*r*(1-n*a),s=255*r*(1-n*(1-a));switch(r*=255,i){case 0:return[r,s,o];case 1:return[l,r,o];case 2:return[o,r,s];case 3:return[o,l,r];case 4:return[s,o,r];case 5:return[r,o,l]}}function y(e){var t,n,r=e[0],i=e[1]/100,a=e[2]/100;return t=i*a,[r,100*(t=(t/=(n=(2-i)*a)<=1?n:2-n)||0),100*(n/=2)]}function x(e){return a(v(e))}function w(e){return o(v(e))}function _(e){return l(v(e))}function k(e){var t,n,i,a,o=e[0]/360,l=e[1]/100,s=e[2]/100,u=l+s;switch(u>1&&(l/=u,s/=u),i=6*o-(t=Math.floor(6*o)),0!=(1&t)&&(i=1-i),a=l+i*((n=1-s)-l),t){default:case 6:case 0:r=n,g=a,b=l;break;case 1:r=a,g=n,b=l;break;case 2:r=l,g=n,b=a;break;case 3:r=l,g=a,b=n;break;case 4:r=a,g=l,b=n;break;case 5:r=n,g=l,b=a}return[255*r,255*g,255*b]}function S(e){return n(k(e))}function M(e){return i(k(e))}function C(e){return o(k(e))}function E(e){return l(k(e))}function O(e){var t=e[0]/100,n=e[1]/100,r=e[2]/100,i=e[3]/100;return[255*(1-Math.min(1,t*(1-i)+i)),255*(1-Math.min(1,n*(1-i)+i)),255*(1-Math.min(1,r*(1-i)+i))]}function P(e){return n(O(e))}function T(e){return i(O(e))}function D(e){return a(O(e))}function N(e){return l(O(e))}function R(e){var t,n,r,i=e[0]/100,a=e[1]/100,o=e[2]/100;return n=-.9689*i+1.8758*a+.0415*o,r=.0557*i+-.204*a+1.057*o,t=(t=3.2406*i+-1.5372*a+-.4986*o)>.0031308?1.055*Math.pow(t,1/2.4)-.055:t*=12.92,n=n>.0031308?1.055*Math.pow(n,1/2.4)-.055:n*=12.92,r=r>.0031308?1.055*Math.pow(r,1/2.4)-.055:r*=12.92,[255*(t=Math.min(Math.max(0,t),1)),255*(n=Math.min(Math.max(0,n),1)),255*(r=Math.min(Math.max(0,r),1))]}function A(e){var t=e[0],n=e[1],r=e[2];return n/=100,r/=108.883,t=(t/=95.047)>.008856?Math.pow(t,1/3):7.787*t+16/116,[116*(n=n>.008856?Math.pow(n,1/3):7.787*n+16/116)-16,500*(t-n),200*(n-(r=r>.008856?Math.pow(r,1/3):7.787*r+16/116))]}function I(e){return j(A(e))}function L(e){var t,n,r,i,a=e[0],o=e[1],l=e[2];return a<=8?i=(n=100*a/903.3)/100*7.787+16/116:(n=100*Math.pow((a+16)/116,3),i=Math.pow(n/100,1/3)),[t=t/95.047<=.008856?t=95.047*(o/500+i-16/116)/7.787:95.047*Math.pow(o/500+i,3),n,r=r/108.883<=.008859?r=108.883*(i-l/200-16/116)/7.787:108.883*Math.pow(i-l/200,3)]}function j(e){var t,n=e[0],r=e[1],i=e[2];return(t=360*Math.atan2(i,r)/2/Math.PI)<0&&(t+=360),[n,Math.sqrt(r*r+i*i),t]}function F(e){return R(L(e))}function z(e){var t,n=e[0],r=e[1];return t=e[2]/360*2*Math.PI,[n,r*Math.cos(t),r*Math.sin(t)]}function W(e){return L(z(e))}function Y(e){return F(z(e))}function H(e){return G[e]}function U(e){return n(H(e))}function V(e){return i(H(e))}function B(e){return a(H(e))}function $(e){return o(H(e))}function X(e){return u(H(e))}function q(e){return s(H(e))}var G={aliceblue:[240,248,255],antiquewhite:[250,235,215],aqua:[0,255,255],aquamarine:[127,255,212],azure:[240,255,255],beige:[245,245,220],bisque:[255,228,196],black:[0,0,0],blanchedalmond:[255,235,205],blue:[0,0,255],blueviolet:[138,43,226],brown:[165,42,42],burlywood:[222,184,135],cadetblue:[95,158,160],chartreuse:[127,255,0],chocolate:[210,105,30],coral:[255,127,80],cornflowerblue:[100,149,237],cornsilk:[255,248,220],crimson:[220,20,60],cyan:[0,255,255],darkblue:[0,0,139],darkcyan:[0,139,139],darkgoldenrod:[184,134,11],darkgray:[169,169,169],darkgreen:[0,100,0],darkgrey:[169,169,169],darkkhaki:[189,183,107],darkmagenta:[139,0,139],darkolivegreen:[85,107,47],darkorange:[255,140,0],darkorchid:[153,50,204],darkred:[139,0,0],darksalmon:[233,150,122],darkseagreen:[143,188,143],darkslateblue:[72,61,139],darkslategray:[47,79,79],darkslategrey:[47,79,79],darkturquoise:[0,206,209],darkviolet:[148,0,211],deeppink:[255,20,147],deepskyblue:[0,191,255],dimgray:[105,105,105],dimgrey:[105,105,105],dodgerblue:[30,144,255],firebrick:[178,34,34],floralwhite:[255,250,240],forestgreen:[34,139,34],fuchsia:[255,0,255],gainsboro:[220,220,220],ghostwhite:[248,248,255],gold:[255,215,0],goldenrod:[218,165,32],gray:[128,128,128],green:[0,128,0],greenyellow:[173,255,47],grey:[128,128,128],honeydew:[240,255,240],hotpink:[255,105,180],indianred:[205,92,92],indigo:[75,0,130],ivory:[255,255,240],khaki:[240,230,140],lavender:[230,230,250],lavenderblush:[255,240,245],lawngreen:[124,252,0],lemonchiffon:[255,250,205],lightblue:[173,216,230],lightcoral:[240,128,128],lightcyan:[224,255,255],lightgoldenrodyellow:[250,250,210],lightgray:[211,211,211],lightgreen:[144,238,144],lightgrey:[211,211,211],lightpink:[255,182,193],lightsalmon:[255,160,122],lightseagreen:[32,178,170],lightskyblue:[135,206,250],lightslategray:[119,136,153],lightslategrey:[119,136,153],lightsteelblue:[176,196,222],lightyellow:[255,255,224],lime:[0,255,0],limegreen:[50,205,50],linen:[250,240,230],magenta:[255,0,255],maroon:[128,0,0],mediumaquamarine:[102,205,170],mediumblue:[0,0,205],mediumorchid:[186,85,211],mediumpurple:[147,112,219],mediumseagreen:[60,179,113],mediumslateblue:[123,104,238],mediumspringgreen:[0,250,154],mediumturquoise:[72,209,204],mediumvioletred:[199,21,133],midnightblue:[25,25,112],mintcream:[245,255,250],mistyrose:[255,228,225],moccasin:[255,228,181],navajowhite:[255,222,173],navy:[0,0,128],oldlace:[253,245,230],olive:[128,128,0],olivedrab:[107,142,35],orange:[255,165,0],orangered:[255,69,0],orchid:[218,112,214],palegoldenrod:[238,232,170],palegreen:[152,251,152],paleturquoise:[175,238,238],palevioletred:[219,112,147],papayawhip:[255,239,213],peachpuff:[255,218,185],peru:[205,133,63],pink:[255,192,203],plum:[221,160,221],powderblue:[176,224,230],purple:[128,0,128],rebeccapurple:[102,51,153],red:[255,0,0],rosybrown:[188,143,143],royalblue:[65,105,225],saddlebrown:[139,69,19],salmon:[250,128,114],sandybrown:[244,164,96],seagreen:[46,139,87],seashell:[255,245,238],sienna:[160,82,45],silver:[192,192,192],skyblue:[135,206,235],slateblue:[106,90,205],slategray:[112,128,144],slategrey:[112,128,144],snow:[255,250,250],springgreen:[0,255,127],steelblue:[70,130,180],tan:[210,180,140],teal:[0,128,128],thistle:[216,191,216],tomato:[255,99,71],turquoise:[64,224,208],violet:[238,130,238],wheat:[245,222,179],white:[255,255,255],whitesmoke:[245,245,245],yellow:[255,255,0],yellowgreen:[154,205,50]},K={};for(var Q in G)K[JSON.stringify(G[Q])]=Q;var Z=function(){return new re};for(var J in t){Z[J+"Raw"]=function(e){return function(n){return"number"==typeof n&&(n=Array.prototype.slice.call(arguments)),t[e](n)}}(J);var ee=/(\w+)2(\w+)/.exec(J),te=ee[1],ne=ee[2];Z[te]=Z[te]||{},Z[te][ne]=Z[J]=function(e){return function(n){"number"==typeof n&&(n=Array.prototype.slice.call(arguments));var r=t[e](n);if("string"==typeof r||void 0===r)return r;for(var i=0;i<r.length;i++)r[i]=Math.round(r[i]);return r}}(J)}var re=function(){this.convs={}};re.prototype.routeSpace=function(e,t){var n=t[0];return void 0===n?this.getValues(e):("number"==typeof n&&(n=Array.prototype.slice.call(t)),this.setValues(e,n))},re.prototype.setValues=function(e,t){return this.space=e,this.convs={},this.convs[e]=t,this},re.prototype.getValues=function(e){var t=this.convs[e];if(!t){var n=this.space,r=this.convs[n];t=Z[n][e](r),this.convs[e]=t}return t},["rgb","hsl","hsv","cmyk","keyword"].forEach((function(e){re.prototype[e]=function(t){return this.routeSpace(e,arguments)}}));var ie=Z,ae={aliceblue:[240,248,255],antiquewhite:[250,235,215],aqua:[0,255,255],aquamarine:[127,255,212],azure:[240,255,255],beige:[245,245,220],bisque:[255,228,196],black:[0,0,0],blanchedalmond:[255,235,205],blue:[0,0,255],blueviolet:[138,43,226],brown:[165,42,42],burlywood:[222,184,135],cadetblue:[95,158,160],chartreuse:[127,255,0],chocolate:[210,105,30],coral:[255,127,80],cornflowerblue:[100,149,237],cornsilk:[255,248,220],crimson:[220,20,60],cyan:[0,255,255],darkblue:[0,0,139],darkcyan:[0,139,139],darkgoldenrod:[184,134,11],darkgray:[169,169,169],darkgreen:[0,100,0],darkgrey:[169,169,169],darkkhaki:[189,183,107],darkmagenta:[139,0,139],darkolivegreen:[85,107,47],darkorange:[255,140,0],darkorchid:[153,50,204],darkred:[139,0,0],darksalmon:[233,150,122],darkseagreen:[143,188,143],darkslateblue:[72,61,139],darkslategray:[47,79,79],darkslategrey:[47,79,79],darkturquoise:[0,206,209],darkviolet:[148,0,211],deeppink:[255,20,147],deepskyblue:[0,191,255],dimgray:[105,105,105],dimgrey:[105,105,105],dodgerblue:[30,144,255],firebrick:[178,34,34],floralwhite:[255,250,240],forestgreen:[34,139,34],fuchsia:[255,0,255],gainsboro:[220,220,220],ghostwhite:[248,248,255],gold:[255,215,0],goldenrod:[218,165,32],gray:[128,128,128],green:[0,128,0],greenyellow:[173,255,47],grey:[128,128,128],honeydew:[240,255,240],hotpink:[255,105,180],indianred:[205,92,92],indigo:[75,0,130],ivory:[255,255,240],khaki:[240,230,140],lavender:[230,230,250],lavenderblush:[255,240,245],lawngreen:[124,252,0],lemonchiffon:[255,250,205],lightblue:[173,216,230],lightcoral:[240,128,128],lightcyan:[224,255,255],lightgoldenrodyellow:[250,250,210],lightgray:[211,211,211],lightgreen:[144,238,144],lightgrey:[211,211,211],lightpink:[255,182,193],lightsalmon:[255,160,122],lightseagreen:[32,178,170],lightskyblue:[135,206,250],lightslategray:[119,136,153],lightslategrey:[119,136,153],lightsteelblue:[176,196,222],lightyellow:[255,255,224],lime:[0,255,0],limegreen:[50,205,50],linen:[250,240,230],magenta:[255,0,255],maroon:[128,0,0],mediumaquamarine:[102,205,170],mediumblue:[0,0,205],mediumorchid:[186,85,211],mediumpurple:[147,112,219],mediumseagreen:[60,179,113],mediumslateblue:[123,104,238],mediumspringgreen:[0,250,154],mediumturquoise:[72,209,204],mediumvioletred:[199,21,133],midnightblue:[25,25,112],mintcream:[245,255,250],mistyrose:[255,228,225],moccasin:[255,228,181],navajowhite:[255,222,173],navy:[0,0,128],oldlace:[253,245,230],olive:[128,128,0],olivedrab:[107,142,35],orange:[255,165,0],orangered:[255,69,0],orchid:[218,112,214],palegoldenrod:[238,232,170],palegreen:[152,251,152],paleturquoise:[175,238,238],palevioletred:[219,112,147],papayawhip:[255,239,213],peachpuff:[255,218,185],peru:[205,133,63],pink:[255,192,203],plum:[221,160,221],powderblue:[176,224,230],purple:[128,0,128],rebeccapurple:[102,51,153],red:[255,0,0],rosybrown:[188,143,143],royalblue:[65,105,225],saddlebrown:[139,69,19],salmon:[250,128,114],sandybrown:[244,164,96],seagreen:[46,139,87],seashell:[255,245,238],sienna:[160,82,45],silver:[192,192,192],skyblue:[135,206,235],slateblue:[106,90,205],slategray:[112,128,144],slategrey:[112,128,144],snow:[255,250,250],springgreen:[0,255,127],steelblue:[70,130,180],tan:[210,180,140],teal:[0,128,128],thistle:[216,191,216],tomato:[255,99,71],turquoise:[64,224,208],violet:[238,130,238],wheat:[245,222,179],white:[255,255,255],whitesmoke:[245,245,245],yellow:[255,255,0],yellowgreen:[154,205,50]},oe={getRgba:le,getHsla:se,getRgb:ce,getHsl:de,getHwb:ue,getAlpha:fe,hexString:he,rgbString:pe,rgbaString:ge,percentString:me,percentaString:ve,hslString:ye,hslaString:be,hwbString:xe,keyword:we};function le(e){if(e){var t=/^#([a-fA-F0-9]{3,4})$/i,n=/^#([a-fA-F0-9]{6}([a-fA-F0-9]{2})?)$/i,r=/^rgba?\(\s*([+-]?\d+)\s*,\s*([+-]?\d+)\s*,\s*([+-]?\d+)\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)$/i,i=/^rgba?\(\s*([+-]?[\d\.]+)\%\s*,\s*([+-]?[\d\.]+)\%\s*,\s*([+-]?[\d\.]+)\%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)$/i,a=/(\w+)/,o=[0,0,0],l=1,s=e.match(t),u="";if(s){u=(s=s[1])[3];for(var c=0;c<o.length;c++)o[c]=parseInt(s[c]+s[c],16);u&&(l=Math.round(parseInt(u+u,16)/255*100)/100)}else if(s=e.match(n)){for(u=s[2],s=s[1],c=0;c<o.length;c++)o[c]=parseInt(s.slice(2*c,2*c+2),16);u&&(l=Math.round(parseInt(u,16)/255*100)/100)}else if(s=e.match(r)){for(c=0;c<o.length;c++)o[c]=parseInt(s[c+1]);l=parseFloat(s[4])}else if(s=e.match(i)){for(c=0;c<o.length;c++)o[c]=Math.round(2.55*parseFloat(s[c+1]));l=parseFloat(s[4])}else if(s=e.match(a)){if("transparent"==s[1])return[0,0,0,0];if(!(o=ae[s[1]]))return}for(c=0;c<o.length;c++)o[c]=_e(o[c],0,255);return l=l||0==l?_e(l,0,1):1,o[3]=l,o}}function se(e){if(e){var t=/^hsla?\(\s*([+-]?\d+)(?:deg)?\s*,\s*([+-]?[\d\.]+)%\s*,\s*([+-]?[\d\.]+)%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)/,n=e.match(t);if(n){var r=parseFloat(n[4]);return[_e(parseInt(n[1]),0,360),_e(parseFloat(n[2]),0,100),_e(parseFloat(n[3]),0,100),_e(isNaN(r)?1:r,0,1)]}}}function ue(e){if(e){var t=/^hwb\(\s*([+-]?\d+)(?:deg)?\s*,\s*([+-]?[\d\.]+)%\s*,\s*([+-]?[\d\.]+)%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)/,n=e.match(t);if(n){var r=parseFloat(n[4]);return[_e(parseInt(n[1]),0,360),_e(parseFloat(n[2]),0,100),_e(parseFloat(n[3]),0,100),_e(isNaN(r)?1:r,0,1)]}}}function ce(e){var t=le(e);return t&&t.slice(0,3)}function de(e){var t=se(e);return t&&t.slice(0,3)}function fe(e){var t=le(e);return t||(t=se(e))||(t=ue(e))?t[3]:void 0}function he(e,t){return t=void 0!==t&&3===e.length?t:e[3],"#"+ke(e[0])+ke(e[1])+ke(e[2])+(t>=0&&t<1?ke(Math.round(255*t)):"")}function pe(e,t){return t<1||e[3]&&e[3]<1?ge(e,t):"rgb("+e[0]+", "+e[1]+", "+e[2]+")"}function ge(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"rgba("+e[0]+", "+e[1]+", "+e[2]+", "+t+")"}function me(e,t){return t<1||e[3]&&e[3]<1?ve(e,t):"rgb("+Math.round(e[0]/255*100)+"%, "+Math.round(e[1]/255*100)+"%, "+Math.round(e[2]/255*100)+"%)"}function ve(e,t){return"rgba("+Math.round(e[0]/255*100)+"%, "+Math.round(e[1]/255*100)+"%, "+Math.round(e[2]/255*100)+"%, "+(t||e[3]||1)+")"}function ye(e,t){return t<1||e[3]&&e[3]<1?be(e,t):"hsl("+e[0]+", "+e[1]+"%, "+e[2]+"%)"}function be(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"hsla("+e[0]+", "+e[1]+"%, "+e[2]+"%, "+t+")"}function xe(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"hwb("+e[0]+", "+e[1]+"%, "+e[2]+"%"+(void 0!==t&&1!==t?", "+t:"")+")"}function we(e){return Se[e.slice(0,3)]}function _e(e,t,n){return Math.min(Math.max(t,e),n)}function ke(e){var t=e.toString(16).toUpperCase();return t.length<2?"0"+t:t}var Se={};for(var Me in ae)Se[ae[Me]]=Me;var Ce=function e(t){return t instanceof e?t:this instanceof e?(this.valid=!1,this.values={rgb:[0,0,0],hsl:[0,0,0],hsv:[0,0,0],hwb:[0,0,0],cmyk:[0,0,0,0],alpha:1},void("string"===typeof t?(n=oe.getRgba(t))?this.setValues("rgb",n):(n=oe.getHsla(t))?this.setValues("hsl",n):(n=oe.getHwb(t))&&this.setValues("hwb",n):"object"===typeof t&&(void 0!==(n=t).r||void 0!==n.red?this.setValues("rgb",n):void 0!==n.l||void 0!==n.lightness?this.setValues("hsl",n):void 0!==n.v||void 0!==n.value?this.setValues("hsv",n):void 0!==n.w||void 0!==n.whiteness?this.setValues("hwb",n):void 0===n.c&&void 0===n.cyan||this.setValues("cmyk",n)))):new e(t);var n};Ce.prototype={isValid:function(){return this.valid},rgb:function(){return this.setSpace("rgb",arguments)},hsl:function(){return this.setSpace("hsl",arguments)},hsv:function(){return this.setSpace("hsv",arguments)},hwb:function(){return this.setSpace("hwb",arguments)},cmyk:function(){return this.setSpace("cmyk",arguments)},rgbArray:function(){return this.values.rgb},hslArray:function(){return this.values.hsl},hsvArray:function(){return this.values.hsv},hwbArray:function(){var e=this.values;return 1!==e.alpha?e.hwb.concat([e.alpha]):e.hwb},cmykArray:function(){return this.values.cmyk},rgbaArray:function(){var e=this.values;return e.rgb.concat([e.alpha])},hslaArray:function(){var e=this.values;return e.hsl.concat([e.alpha])},alpha:function(e){return void 0===e?this.values.alpha:(this.setValues("alpha",e),this)},red:function(e){return this.setChannel("rgb",0,e)},green:function(e){return this.setChannel("rgb",1,e)},blue:function(e){return this.setChannel("rgb",2,e)},hue:function(e){return e&&(e=(e%=360)<0?360+e:e),this.setChannel("hsl",0,e)},saturation:function(e){return this.setChannel("hsl",1,e)},lightness:function(e){return this.setChannel("hsl",2,e)},saturationv:function(e){return this.setChannel("hsv",1,e)},whiteness:function(e){return this.setChannel("hwb",1,e)},blackness:function(e){return this.setChannel("hwb",2,e)},value:function(e){return this.setChannel("hsv",2,e)},cyan:function(e){return this.setChannel("cmyk",0,e)},magenta:function(e){return this.setChannel("cmyk",1,e)},yellow:function(e){return this.setChannel("cmyk",2,e)},black:function(e){return this.setChannel("cmyk",3,e)},hexString:function(){return oe.hexString(this.values.rgb)},rgbString:function(){return oe.rgbString(this.values.rgb,this.values.alpha)},rgbaString:function(){return oe.rgbaString(this.values.rgb,this.values.alpha)},percentString:function(){return oe.percentString(this.values.rgb,this.values.alpha)},hslString:function(){return oe.hslString(this.values.hsl,this.values.alpha)},hslaString:function(){return oe.hslaString(this.values.hsl,this.values.alpha)},hwbString:function(){return oe.hwbString(this.values.hwb,this.values.alpha)},keyword:function(){return oe.keyword(this.values.rgb,this.values.alpha)},rgbNumber:function(){var e=this.values.rgb;return e[0]<<16|e[1]<<8|e[2]},luminosity:function(){for(var e=this.values.rgb,t=[],n=0;n<e.length;n++){var r=e[n]/255;t[n]=r<=.03928?r/12.92:Math.pow((r+.055)/1.055,2.4)}return.2126*t[0]+.7152*t[1]+.0722*t[2]},contrast:function(e){var t=this.luminosity(),n=e.luminosity();return t>n?(t+.05)/(n+.05):(n+.05)/(t+.05)},level:function(e){var t=this.contrast(e);return t>=7.1?"AAA":t>=4.5?"AA":""},dark:function(){var e=this.values.rgb;return(299*e[0]+587*e[1]+114*e[2])/1e3<128},light:function(){return!this.dark()},negate:function(){for(var e=[],t=0;t<3;t++)e[t]=255-this.values.rgb[t];return this.setValues("rgb",e),this},lighten:function(e){var t=this.values.hsl;return t[2]+=t[2]*e,this.setValues("hsl",t),this},darken:function(e){var t=this.values.hsl;return t[2]-=t[2]*e,this.setValues("hsl",t),this},saturate:function(e){var t=this.values.hsl;return t[1]+=t[1]*e,this.setValues("hsl",t),this},desaturate:function(e){var t=this.values.hsl;return t[1]-=t[1]*e,this.setValues("hsl",t),this},whiten:function(e){var t=this.values.hwb;return t[1]+=t[1]*e,this.setValues("hwb",t),this},blacken:function(e){var t=this.values.hwb;return t[2]+=t[2]*e,this.setValues("hwb",t),this},greyscale:function(){var e=this.values.rgb,t=.3*e[0]+.59*e[1]+.11*e[2];return this.setValues("rgb",[t,t,t]),this},clearer:function(e){var t=this.values.alpha;return this.setValues("alpha",t-t*e),this},opaquer:function(e){var t=this.values.alpha;return this.setValues("alpha",t+t*e),this},rotate:function(e){var t=this.values.hsl,n=(t[0]+e)%360;return t[0]=n<0?360+n:n,this.setValues("hsl",t),this},mix:function(e,t){var n=this,r=e,i=void 0===t?.5:t,a=2*i-1,o=n.alpha()-r.alpha(),l=((a*o===-1?a:(a+o)/(1+a*o))+1)/2,s=1-l;return this.rgb(l*n.red()+s*r.red(),l*n.green()+s*r.green(),l*n.blue()+s*r.blue()).alpha(n.alpha()*i+r.alpha()*(1-i))},toJSON:function(){return this.rgb()},clone:function(){var e,t,n=new Ce,r=this.values,i=n.values;for(var a in r)r.hasOwnProperty(a)&&(e=r[a],"[object Array]"===(t={}.toString.call(e))?i[a]=e.slice(0):"[object Number]"===t?i[a]=e:console.error("unexpected color value:",e));return n}},Ce.prototype.spaces={rgb:["red","green","blue"],hsl:["hue","saturation","lightness"],hsv:["hue","saturation","value"],hwb:["hue","whiteness","blackness"],cmyk:["cyan","magenta","yellow","black"]},Ce.prototype.maxes={rgb:[255,255,255],hsl:[360,100,100],hsv:[360,100,100],hwb:[360,100,100],cmyk:[100,100,100,100]},Ce.prototype.getValues=function(e){for(var t=this.values,n={},r=0;r<e.length;r++)n[e.charAt(r)]=t[e][r];return 1!==t.alpha&&(n.a=t.alpha),n},Ce.prototype.setValues=function(e,t){var n,r,i=this.values,a=this.spaces,o=this.maxes,l=1;if(this.valid=!0,"alpha"===e)l=t;else if(t.length)i[e]=t.slice(0,e.length),l=t[e.length];else if(void 0!==t[e.charAt(0)]){for(n=0;n<e.length;n++)i[e][n]=t[e.charAt(n)];l=t.a}else if(void 0!==t[a[e][0]]){var s=a[e];for(n=0;n<e.length;n++)i[e][n]=t[s[n]];l=t.alpha}if(i.alpha=Math.max(0,Math.min(1,void 0===l?i.alpha:l)),"alpha"===e)return!1;for(n=0;n<e.length;n++)r=Math.max(0,Math.min(o[e][n],i[e][n])),i[e][n]=Math.round(r);for(var u in a)u!==e&&(i[u]=ie[e][u](i[e]));return!0},Ce.prototype.setSpace=function(e,t){var n=t[0];return void 0===n?this.getValues(e):("number"===typeof n&&(n=Array.prototype.slice.call(t)),this.setValues(e,n),this)},Ce.prototype.setChannel=function(e,t,n){var r=this.values[e];return void 0===n?r[t]:(n===r[t]||(r[t]=n,this.setValues(e,r)),this)},"undefined"!==typeof window&&(window.Color=Ce);var Ee=Ce,Oe={noop:function(){},uid:function(){var e=0;return function(){return e++}}(),isNullOrUndef:function(e){return null===e||"undefined"===typeof e},isArray:function(e){if(Array.isArray&&Array.isArray(e))return!0;var t=Object.prototype.toString.call(e);return"[object"===t.substr(0,7)&&"Array]"===t.substr(-6)},isObject:function(e){return null!==e&&"[object Object]"===Object.prototype.toString.call(e)},isFinite:function(e){function t(t){return e.apply(this,arguments)}return t.toString=function(){return e.toString()},t}((function(e){return("number"===typeof e||e instanceof Number)&&isFinite(e)})),valueOrDefault:function(e,t){return"undefined"===typeof e?t:e},valueAtIndexOrDefault:function(e,t,n){return Oe.valueOrDefault(Oe.isArray(e)?e[t]:e,n)},callback:function(e,t,n){if(e&&"function"===typeof e.call)return e.apply(n,t)},each:function(e,t,n,r){var i,a,o;if(Oe.isArray(e))if(a=e.length,r)for(i=a-1;i>=0;i--)t.call(n,e[i],i);else for(i=0;i<a;i++)t.call(n,e[i],i);else if(Oe.isObject(e))for(a=(o=Object.keys(e)).length,i=0;i<a;i++)t.call(n,e[o[i]],o[i])},arrayEquals:function(e,t){var n,r,i,a;if(!e||!t||e.length!==t.length)return!1;for(n=0,r=e.length;n<r;++n)if(i=e[n],a=t[n],i instanceof Array&&a instanceof Array){if(!Oe.arrayEquals(i,a))return!1}else if(i!==a)return!1;return!0},clone:function(e){if(Oe.isArray(e))return e.map(Oe.clone);if(Oe.isObject(e)){for(var t={},n=Object.keys(e),r=n.length,i=0;i<r;++i)t[n[i]]=Oe.clone(e[n[i]]);return t}return e},_merger:function(e,t,n,r){var i=t[e],a=n[e];Oe.isObject(i)&&Oe.isObject(a)?Oe.merge(i,a,r):t[e]=Oe.clone(a)},_mergerIf:function(e,t,n){var r=t[e],i=n[e];Oe.isObject(r)&&Oe.isObject(i)?Oe.mergeIf(r,i):t.hasOwnProperty(e)||(t[e]=Oe.clone(i))},merge:function(e,t,n){var r,i,a,o,l,s=Oe.isArray(t)?t:[t],u=s.length;if(!Oe.isObject(e))return e;for(r=(n=n||{}).merger||Oe._merger,i=0;i<u;++i)if(t=s[i],Oe.isObject(t))for(l=0,o=(a=Object.keys(t)).length;l<o;++l)r(a[l],e,t,n);return e},mergeIf:function(e,t){return Oe.merge(e,t,{merger:Oe._mergerIf})},extend:function(e){for(var t=function(t,n){e[n]=t},n=1,r=arguments.length;n<r;++n)Oe.each(arguments[n],t);return e},inherits:function(e){var t=this,n=e&&e.hasOwnProperty("constructor")?e.constructor:function(){return t.apply(this,arguments)},r=function(){this.constructor=n};return r.prototype=t.prototype,n.prototype=new r,n.extend=Oe.inherits,e&&Oe.extend(n.prototype,e),n.__super__=t.prototype,n}},Pe=Oe;Oe.callCallback=Oe.callback,Oe.indexOf=function(e,t,n){return Array.prototype.indexOf.call(e,t,n)},Oe.getValueOrDefault=Oe.valueOrDefault,Oe.getValueAtIndexOrDefault=Oe.valueAtIndexOrDefault;var Te={linear:function(e){return e},easeInQuad:function(e){return e*e},easeOutQuad:function(e){return-e*(e-2)},easeInOutQuad:function(e){return(e/=.5)<1?.5*e*e:-.5*(--e*(e-2)-1)},easeInCubic:function(e){return e*e*e},easeOutCubic:function(e){return(e-=1)*e*e+1},easeInOutCubic:function(e){return(e/=.5)<1?.5*e*e*e:.5*((e-=2)*e*e+2)},easeInQuart:function(e){return e*e*e*e},easeOutQuart:function(e){return-((e-=1)*e*e*e-1)},easeInOutQuart:function(e){return(e/=.5)<1?.5*e*e*e*e:-.5*((e-=2)*e*e*e-2)},easeInQuint:function(e){return e*e*e*e*e},easeOutQuint:function(e){return(e-=1)*e*e*e*e+1},easeInOutQuint:function(e){return(e/=.5)<1?.5*e*e*e*e*e:.5*((e-=2)*e*e*e*e+2)},easeInSine:function(e){return 1-Math.cos(e*(Math.PI/2))},easeOutSine:function(e){return Math.sin(e*(Math.PI/2))},easeInOutSine:function(e){return-.5*(Math.cos(Math.PI*e)-1)},easeInExpo:function(e){return 0===e?0:Math.pow(2,10*(e-1))},easeOutExpo:function(e){return 1===e?1:1-Math.pow(2,-10*e)},easeInOutExpo:function(e){return 0===e?0:1===e?1:(e/=.5)<1?.5*Math.pow(2,10*(e-1)):.5*(2-Math.pow(2,-10*--e))},easeInCirc:function(e){return e>=1?e:-(Math.sqrt(1-e*e)-1)},easeOutCirc:function(e){return Math.sqrt(1-(e-=1)*e)},easeInOutCirc:function(e){return(e/=.5)<1?-.5*(Math.sqrt(1-e*e)-1):.5*(Math.sqrt(1-(e-=2)*e)+1)},easeInElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:1===e?1:(n||(n=.3),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),-r*Math.pow(2,10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n))},easeOutElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:1===e?1:(n||(n=.3),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),r*Math.pow(2,-10*e)*Math.sin((e-t)*(2*Math.PI)/n)+1)},easeInOutElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:2===(e/=.5)?1:(n||(n=.45),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),e<1?r*Math.pow(2,10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n)*-.5:r*Math.pow(2,-10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n)*.5+1)},easeInBack:function(e){var t=1.70158;return e*e*((t+1)*e-t)},easeOutBack:function(e){var t=1.70158;return(e-=1)*e*((t+1)*e+t)+1},easeInOutBack:function(e){var t=1.70158;return(e/=.5)<1?e*e*((1+(t*=1.525))*e-t)*.5:.5*((e-=2)*e*((1+(t*=1.525))*e+t)+2)},easeInBounce:function(e){return 1-Te.easeOutBounce(1-e)},easeOutBounce:function(e){return e<1/2.75?7.5625*e*e:e<2/2.75?7.5625*(e-=1.5/2.75)*e+.75:e<2.5/2.75?7.5625*(e-=2.25/2.75)*e+.9375:7.5625*(e-=2.625/2.75)*e+.984375},easeInOutBounce:function(e){return e<.5?.5*Te.easeInBounce(2*e):.5*Te.easeOutBounce(2*e-1)+.5}},De={effects:Te};Pe.easingEffects=Te;var Ne=Math.PI,Re=Ne/180,Ae=2*Ne,Ie=Ne/2,Le=Ne/4,je=2*Ne/3,Fe={clear:function(e){e.ctx.clearRect(0,0,e.width,e.height)},roundedRect:function(e,t,n,r,i,a){if(a){var o=Math.min(a,i/2,r/2),l=t+o,s=n+o,u=t+r-o,c=n+i-o;e.moveTo(t,s),l<u&&s<c?(e.arc(l,s,o,-Ne,-Ie),e.arc(u,s,o,-Ie,0),e.arc(u,c,o,0,Ie),e.arc(l,c,o,Ie,Ne)):l<u?(e.moveTo(l,n),e.arc(u,s,o,-Ie,Ie),e.arc(l,s,o,Ie,Ne+Ie)):s<c?(e.arc(l,s,o,-Ne,0),e.arc(l,c,o,0,Ne)):e.arc(l,s,o,-Ne,Ne),e.closePath(),e.moveTo(t,n)}else e.rect(t,n,r,i)},drawPoint:function(e,t,n,r,i,a){var o,l,s,u,c,d=(a||0)*Re;if(!t||"object"!==typeof t||"[object HTMLImageElement]"!==(o=t.toString())&&"[object HTMLCanvasElement]"!==o){if(!(isNaN(n)||n<=0)){switch(e.beginPath(),t){default:e.arc(r,i,n,0,Ae),e.closePath();break;case"triangle":e.moveTo(r+Math.sin(d)*n,i-Math.cos(d)*n),d+=je,e.lineTo(r+Math.sin(d)*n,i-Math.cos(d)*n),d+=je,e.lineTo(r+Math.sin(d)*n,i-Math.cos(d)*n),e.closePath();break;case"rectRounded":u=n-(c=.516*n),l=Math.cos(d+Le)*u,s=Math.sin(d+Le)*u,e.arc(r-l,i-s,c,d-Ne,d-Ie),e.arc(r+s,i-l,c,d-Ie,d),e.arc(r+l,i+s,c,d,d+Ie),e.arc(r-s,i+l,c,d+Ie,d+Ne),e.closePath();break;case"rect":if(!a){u=Math.SQRT1_2*n,e.rect(r-u,i-u,2*u,2*u);break}d+=Le;case"rectRot":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+s,i-l),e.lineTo(r+l,i+s),e.lineTo(r-s,i+l),e.closePath();break;case"crossRot":d+=Le;case"cross":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l);break;case"star":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l),d+=Le,l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l);break;case"line":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s);break;case"dash":e.moveTo(r,i),e.lineTo(r+Math.cos(d)*n,i+Math.sin(d)*n)}e.fill(),e.stroke()}}else e.drawImage(t,r-t.width/2,i-t.height/2,t.width,t.height)},_isPointInArea:function(e,t){var n=1e-6;return e.x>t.left-n&&e.x<t.right+n&&e.y>t.top-n&&e.y<t.bottom+n},clipArea:function(e,t){e.save(),e.beginPath(),e.rect(t.left,t.top,t.right-t.left,t.bottom-t.top),e.clip()},unclipArea:function(e){e.restore()},lineTo:function(e,t,n,r){var i=n.steppedLine;if(i){if("middle"===i){var a=(t.x+n.x)/2;e.lineTo(a,r?n.y:t.y),e.lineTo(a,r?t.y:n.y)}else"after"===i&&!r||"after"!==i&&r?e.lineTo(t.x,n.y):e.lineTo(n.x,t.y);e.lineTo(n.x,n.y)}else n.tension?e.bezierCurveTo(r?t.controlPointPreviousX:t.controlPointNextX,r?t.controlPointPreviousY:t.controlPointNextY,r?n.controlPointNextX:n.controlPointPreviousX,r?n.controlPointNextY:n.controlPointPreviousY,n.x,n.y):e.lineTo(n.x,n.y)}},ze=Fe;Pe.clear=Fe.clear,Pe.drawRoundedRectangle=function(e){e.beginPath(),Fe.roundedRect.apply(Fe,arguments)};var We={_set:function(e,t){return Pe.merge(this[e]||(this[e]={}),t)}};We._set("global",{defaultColor:"rgba(0,0,0,0.1)",defaultFontColor:"#666",defaultFontFamily:"'Helvetica Neue', 'Helvetica', 'Arial', sans-serif",defaultFontSize:12,defaultFontStyle:"normal",defaultLineHeight:1.2,showLines:!0});var Ye=We,He=Pe.valueOrDefault;function Ue(e){return!e||Pe.isNullOrUndef(e.size)||Pe.isNullOrUndef(e.family)?null:(e.style?e.style+" ":"")+(e.weight?e.weight+" ":"")+e.size+"px "+e.family}var Ve={toLineHeight:function(e,t){var n=(""+e).match(/^(normal|(\d+(?:\.\d+)?)(px|em|%)?)$/);if(!n||"normal"===n[1])return 1.2*t;switch(e=+n[2],n[3]){case"px":return e;case"%":e/=100}return t*e},toPadding:function(e){var t,n,r,i;return Pe.isObject(e)?(t=+e.top||0,n=+e.right||0,r=+e.bottom||0,i=+e.left||0):t=n=r=i=+e||0,{top:t,right:n,bottom:r,left:i,height:t+r,width:i+n}},_parseFont:function(e){var t=Ye.global,n=He(e.fontSize,t.defaultFontSize),r={family:He(e.fontFamily,t.defaultFontFamily),lineHeight:Pe.options.toLineHeight(He(e.lineHeight,t.defaultLineHeight),n),size:n,style:He(e.fontStyle,t.defaultFontStyle),weight:null,string:""};return r.string=Ue(r),r},resolve:function(e,t,n){var r,i,a;for(r=0,i=e.length;r<i;++r)if(void 0!==(a=e[r])&&(void 0!==t&&"function"===typeof a&&(a=a(t)),void 0!==n&&Pe.isArray(a)&&(a=a[n]),void 0!==a))return a}},Be=Pe,$e=De,Xe=ze,qe=Ve;function Ge(e,t,n,r){var i,a,o,l,s,u,c,d,f,h=Object.keys(n);for(i=0,a=h.length;i<a;++i)if(u=n[o=h[i]],t.hasOwnProperty(o)||(t[o]=u),(l=t[o])!==u&&"_"!==o[0]){if(e.hasOwnProperty(o)||(e[o]=l),(c=typeof u)===typeof(s=e[o]))if("string"===c){if((d=Ee(s)).valid&&(f=Ee(u)).valid){t[o]=f.mix(d,r).rgbString();continue}}else if(Be.isFinite(s)&&Be.isFinite(u)){t[o]=s+(u-s)*r;continue}t[o]=u}}Be.easing=$e,Be.canvas=Xe,Be.options=qe;var Ke=function(e){Be.extend(this,e),this.initialize.apply(this,arguments)};Be.extend(Ke.prototype,{initialize:function(){this.hidden=!1},pivot:function(){var e=this;return e._view||(e._view=Be.clone(e._model)),e._start={},e},transition:function(e){var t=this,n=t._model,r=t._start,i=t._view;return n&&1!==e?(i||(i=t._view={}),r||(r=t._start={}),Ge(r,i,n,e),t):(t._view=n,t._start=null,t)},tooltipPosition:function(){return{x:this._model.x,y:this._model.y}},hasValue:function(){return Be.isNumber(this._model.x)&&Be.isNumber(this._model.y)}}),Ke.extend=Be.inherits;var Qe=Ke,Ze=Qe.extend({chart:null,currentStep:0,numSteps:60,easing:"",render:null,onAnimationProgress:null,onAnimationComplete:null}),Je=Ze;Object.defineProperty(Ze.prototype,"animationObject",{get:function(){return this}}),Object.defineProperty(Ze.prototype,"chartInstance",{get:function(){return this.chart},set:function(e){this.chart=e}}),Ye._set("global",{animation:{duration:1e3,easing:"easeOutQuart",onProgress:Be.noop,onComplete:Be.noop}});var et={animations:[],request:null,addAnimation:function(e,t,n,r){var i,a,o=this.animations;for(t.chart=e,t.startTime=Date.now(),t.duration=n,r||(e.animating=!0),i=0,a=o.length;i<a;++i)if(o[i].chart===e)return void(o[i]=t);o.push(t),1===o.length&&this.requestAnimationFrame()},cancelAnimation:function(e){var t=Be.findIndex(this.animations,(function(t){return t.chart===e}));-1!==t&&(this.animations.splice(t,1),e.animating=!1)},requestAnimationFrame:function(){var e=this;null===e.request&&(e.request=Be.requestAnimFrame.call(window,(function(){e.request=null,e.startDigest()})))},startDigest:function(){var e=this;e.advance(),e.animations.length>0&&e.requestAnimationFrame()},advance:function(){for(var e,t,n,r,i=this.animations,a=0;a<i.length;)t=(e=i[a]).chart,n=e.numSteps,r=Math.floor((Date.now()-e.startTime)/e.duration*n)+1,e.currentStep=Math.min(r,n),Be.callback(e.render,[t,e],t),Be.callback(e.onAnimationProgress,[e],t),e.currentStep>=n?(Be.callback(e.onAnimationComplete,[e],t),t.animating=!1,i.splice(a,1)):++a}},tt=Be.options.resolve,nt=["push","pop","shift","splice","unshift"];function rt(e,t){e._chartjs?e._chartjs.listeners.push(t):(Object.defineProperty(e,"_chartjs",{configurable:!0,enumerable:!1,value:{listeners:[t]}}),nt.forEach((function(t){var n="onData"+t.charAt(0).toUpperCase()+t.slice(1),r=e[t];Object.defineProperty(e,t,{configurable:!0,enumerable:!1,value:function(){var t=Array.prototype.slice.call(arguments),i=r.apply(this,t);return Be.each(e._chartjs.listeners,(function(e){"function"===typeof e[n]&&e[n].apply(e,t)})),i}})})))}function it(e,t){var n=e._chartjs;if(n){var r=n.listeners,i=r.indexOf(t);-1!==i&&r.splice(i,1),r.length>0||(nt.forEach((function(t){delete e[t]})),delete e._chartjs)}}var at=function(e,t){this.initialize(e,t)};Be.extend(at.prototype,{datasetElementType:null,dataElementType:null,initialize:function(e,t){var n=this;n.chart=e,n.index=t,n.linkScales(),n.addElements()},updateIndex:function(e){this.index=e},linkScales:function(){var e=this,t=e.getMeta(),n=e.getDataset();null!==t.xAxisID&&t.xAxisID in e.chart.scales||(t.xAxisID=n.xAxisID||e.chart.options.scales.xAxes[0].id),null!==t.yAxisID&&t.yAxisID in e.chart.scales||(t.yAxisID=n.yAxisID||e.chart.options.scales.yAxes[0].id)},getDataset:function(){return this.chart.data.datasets[this.index]},getMeta:function(){return this.chart.getDatasetMeta(this.index)},getScaleForId:function(e){return this.chart.scales[e]},_getValueScaleId:function(){return this.getMeta().yAxisID},_getIndexScaleId:function(){return this.getMeta().xAxisID},_getValueScale:function(){return this.getScaleForId(this._getValueScaleId())},_getIndexScale:function(){return this.getScaleForId(this._getIndexScaleId())},reset:function(){this.update(!0)},destroy:function(){this._data&&it(this._data,this)},createMetaDataset:function(){var e=this,t=e.datasetElementType;return t&&new t({_chart:e.chart,_datasetIndex:e.index})},createMetaData:function(e){var t=this,n=t.dataElementType;return n&&new n({_chart:t.chart,_datasetIndex:t.index,_index:e})},addElements:function(){var e,t,n=this,r=n.getMeta(),i=n.getDataset().data||[],a=r.data;for(e=0,t=i.length;e<t;++e)a[e]=a[e]||n.createMetaData(e);r.dataset=r.dataset||n.createMetaDataset()},addElementAndReset:function(e){var t=this.createMetaData(e);this.getMeta().data.splice(e,0,t),this.updateElement(t,e,!0)},buildOrUpdateElements:function(){var e=this,t=e.getDataset(),n=t.data||(t.data=[]);e._data!==n&&(e._data&&it(e._data,e),n&&Object.isExtensible(n)&&rt(n,e),e._data=n),e.resyncElements()},update:Be.noop,transition:function(e){for(var t=this.getMeta(),n=t.data||[],r=n.length,i=0;i<r;++i)n[i].transition(e);t.dataset&&t.dataset.transition(e)},draw:function(){var e=this.getMeta(),t=e.data||[],n=t.length,r=0;for(e.dataset&&e.dataset.draw();r<n;++r)t[r].draw()},removeHoverStyle:function(e){Be.merge(e._model,e.$previousStyle||{}),delete e.$previousStyle},setHoverStyle:function(e){var t=this.chart.data.datasets[e._datasetIndex],n=e._index,r=e.custom||{},i=e._model,a=Be.getHoverColor;e.$previousStyle={backgroundColor:i.backgroundColor,borderColor:i.borderColor,borderWidth:i.borderWidth},i.backgroundColor=tt([r.hoverBackgroundColor,t.hoverBackgroundColor,a(i.backgroundColor)],void 0,n),i.borderColor=tt([r.hoverBorderColor,t.hoverBorderColor,a(i.borderColor)],void 0,n),i.borderWidth=tt([r.hoverBorderWidth,t.hoverBorderWidth,i.borderWidth],void 0,n)},resyncElements:function(){var e=this,t=e.getMeta(),n=e.getDataset().data,r=t.data.length,i=n.length;i<r?t.data.splice(i,r-i):i>r&&e.insertElements(r,i-r)},insertElements:function(e,t){for(var n=0;n<t;++n)this.addElementAndReset(e+n)},onDataPush:function(){var e=arguments.length;this.insertElements(this.getDataset().data.length-e,e)},onDataPop:function(){this.getMeta().data.pop()},onDataShift:function(){this.getMeta().data.shift()},onDataSplice:function(e,t){this.getMeta().data.splice(e,t),this.insertElements(e,arguments.length-2)},onDataUnshift:function(){this.insertElements(0,arguments.length)}}),at.extend=Be.inherits;var ot=at;Ye._set("global",{elements:{arc:{backgroundColor:Ye.global.defaultColor,borderColor:"#fff",borderWidth:2,borderAlign:"center"}}});var lt=Qe.extend({inLabelRange:function(e){var t=this._view;return!!t&&Math.pow(e-t.x,2)<Math.pow(t.radius+t.hoverRadius,2)},inRange:function(e,t){var n=this._view;if(n){for(var r=Be.getAngleFromPoint(n,{x:e,y:t}),i=r.angle,a=r.distance,o=n.startAngle,l=n.endAngle;l<o;)l+=2*Math.PI;for(;i>l;)i-=2*Math.PI;for(;i<o;)i+=2*Math.PI;var s=i>=o&&i<=l,u=a>=n.innerRadius&&a<=n.outerRadius;return s&&u}return!1},getCenterPoint:function(){var e=this._view,t=(e.startAngle+e.endAngle)/2,n=(e.innerRadius+e.outerRadius)/2;return{x:e.x+Math.cos(t)*n,y:e.y+Math.sin(t)*n}},getArea:function(){var e=this._view;return Math.PI*((e.endAngle-e.startAngle)/(2*Math.PI))*(Math.pow(e.outerRadius,2)-Math.pow(e.innerRadius,2))},tooltipPosition:function(){var e=this._view,t=e.startAngle+(e.endAngle-e.startAngle)/2,n=(e.outerRadius-e.innerRadius)/2+e.innerRadius;return{x:e.x+Math.cos(t)*n,y:e.y+Math.sin(t)*n}},draw:function(){var e,t=this._chart.ctx,n=this._view,r=n.startAngle,i=n.endAngle,a="inner"===n.borderAlign?.33:0;t.save(),t.beginPath(),t.arc(n.x,n.y,Math.max(n.outerRadius-a,0),r,i),t.arc(n.x,n.y,n.innerRadius,i,r,!0),t.closePath(),t.fillStyle=n.backgroundColor,t.fill(),n.borderWidth&&("inner"===n.borderAlign?(t.beginPath(),e=a/n.outerRadius,t.arc(n.x,n.y,n.outerRadius,r-e,i+e),n.innerRadius>a?(e=a/n.innerRadius,t.arc(n.x,n.y,n.innerRadius-a,i+e,r-e,!0)):t.arc(n.x,n.y,a,i+Math.PI/2,r-Math.PI/2),t.closePath(),t.clip(),t.beginPath(),t.arc(n.x,n.y,n.outerRadius,r,i),t.arc(n.x,n.y,n.innerRadius,i,r,!0),t.closePath(),t.lineWidth=2*n.borderWidth,t.lineJoin="round"):(t.lineWidth=n.borderWidth,t.lineJoin="bevel"),t.strokeStyle=n.borderColor,t.stroke()),t.restore()}}),st=Be.valueOrDefault,ut=Ye.global.defaultColor;Ye._set("global",{elements:{line:{tension:.4,backgroundColor:ut,borderWidth:3,borderColor:ut,borderCapStyle:"butt",borderDash:[],borderDashOffset:0,borderJoinStyle:"miter",capBezierPoints:!0,fill:!0}}});var ct=Qe.extend({draw:function(){var e,t,n,r,i=this,a=i._view,o=i._chart.ctx,l=a.spanGaps,s=i._children.slice(),u=Ye.global,c=u.elements.line,d=-1;for(i._loop&&s.length&&s.push(s[0]),o.save(),o.lineCap=a.borderCapStyle||c.borderCapStyle,o.setLineDash&&o.setLineDash(a.borderDash||c.borderDash),o.lineDashOffset=st(a.borderDashOffset,c.borderDashOffset),o.lineJoin=a.borderJoinStyle||c.borderJoinStyle,o.lineWidth=st(a.borderWidth,c.borderWidth),o.strokeStyle=a.borderColor||u.defaultColor,o.beginPath(),d=-1,e=0;e<s.length;++e)t=s[e],n=Be.previousItem(s,e),r=t._view,0===e?r.skip||(o.moveTo(r.x,r.y),d=e):(n=-1===d?n:s[d],r.skip||(d!==e-1&&!l||-1===d?o.moveTo(r.x,r.y):Be.canvas.lineTo(o,n._view,t._view),d=e));o.stroke(),o.restore()}}),dt=Be.valueOrDefault,ft=Ye.global.defaultColor;function ht(e){var t=this._view;return!!t&&Math.abs(e-t.x)<t.radius+t.hitRadius}function pt(e){var t=this._view;return!!t&&Math.abs(e-t.y)<t.radius+t.hitRadius}Ye._set("global",{elements:{point:{radius:3,pointStyle:"circle",backgroundColor:ft,borderColor:ft,borderWidth:1,hitRadius:1,hoverRadius:4,hoverBorderWidth:1}}});var gt=Qe.extend({inRange:function(e,t){var n=this._view;return!!n&&Math.pow(e-n.x,2)+Math.pow(t-n.y,2)<Math.pow(n.hitRadius+n.radius,2)},inLabelRange:ht,inXRange:ht,inYRange:pt,getCenterPoint:function(){var e=this._view;return{x:e.x,y:e.y}},getArea:function(){return Math.PI*Math.pow(this._view.radius,2)},tooltipPosition:function(){var e=this._view;return{x:e.x,y:e.y,padding:e.radius+e.borderWidth}},draw:function(e){var t=this._view,n=this._chart.ctx,r=t.pointStyle,i=t.rotation,a=t.radius,o=t.x,l=t.y,s=Ye.global,u=s.defaultColor;t.skip||(void 0===e||Be.canvas._isPointInArea(t,e))&&(n.strokeStyle=t.borderColor||u,n.lineWidth=dt(t.borderWidth,s.elements.point.borderWidth),n.fillStyle=t.backgroundColor||u,Be.canvas.drawPoint(n,r,a,o,l,i))}}),mt=Ye.global.defaultColor;function vt(e){return e&&void 0!==e.width}function yt(e){var t,n,r,i,a;return vt(e)?(a=e.width/2,t=e.x-a,n=e.x+a,r=Math.min(e.y,e.base),i=Math.max(e.y,e.base)):(a=e.height/2,t=Math.min(e.x,e.base),n=Math.max(e.x,e.base),r=e.y-a,i=e.y+a),{left:t,top:r,right:n,bottom:i}}function bt(e,t,n){return e===t?n:e===n?t:e}function xt(e){var t=e.borderSkipped,n={};return t?(e.horizontal?e.base>e.x&&(t=bt(t,"left","right")):e.base<e.y&&(t=bt(t,"bottom","top")),n[t]=!0,n):n}function wt(e,t,n){var r,i,a,o,l=e.borderWidth,s=xt(e);return Be.isObject(l)?(r=+l.top||0,i=+l.right||0,a=+l.bottom||0,o=+l.left||0):r=i=a=o=+l||0,{t:s.top||r<0?0:r>n?n:r,r:s.right||i<0?0:i>t?t:i,b:s.bottom||a<0?0:a>n?n:a,l:s.left||o<0?0:o>t?t:o}}function _t(e){var t=yt(e),n=t.right-t.left,r=t.bottom-t.top,i=wt(e,n/2,r/2);return{outer:{x:t.left,y:t.top,w:n,h:r},inner:{x:t.left+i.l,y:t.top+i.t,w:n-i.l-i.r,h:r-i.t-i.b}}}function kt(e,t,n){var r=null===t,i=null===n,a=!(!e||r&&i)&&yt(e);return a&&(r||t>=a.left&&t<=a.right)&&(i||n>=a.top&&n<=a.bottom)}Ye._set("global",{elements:{rectangle:{backgroundColor:mt,borderColor:mt,borderSkipped:"bottom",borderWidth:0}}});var St=Qe.extend({draw:function(){var e=this._chart.ctx,t=this._view,n=_t(t),r=n.outer,i=n.inner;e.fillStyle=t.backgroundColor,e.fillRect(r.x,r.y,r.w,r.h),r.w===i.w&&r.h===i.h||(e.save(),e.beginPath(),e.rect(r.x,r.y,r.w,r.h),e.clip(),e.fillStyle=t.borderColor,e.rect(i.x,i.y,i.w,i.h),e.fill("evenodd"),e.restore())},height:function(){var e=this._view;return e.base-e.y},inRange:function(e,t){return kt(this._view,e,t)},inLabelRange:function(e,t){var n=this._view;return vt(n)?kt(n,e,null):kt(n,null,t)},inXRange:function(e){return kt(this._view,e,null)},inYRange:function(e){return kt(this._view,null,e)},getCenterPoint:function(){var e,t,n=this._view;return vt(n)?(e=n.x,t=(n.y+n.base)/2):(e=(n.x+n.base)/2,t=n.y),{x:e,y:t}},getArea:function(){var e=this._view;return vt(e)?e.width*Math.abs(e.y-e.base):e.height*Math.abs(e.x-e.base)},tooltipPosition:function(){var e=this._view;return{x:e.x,y:e.y}}}),Mt={},Ct=lt,Et=ct,Ot=gt,Pt=St;Mt.Arc=Ct,Mt.Line=Et,Mt.Point=Ot,Mt.Rectangle=Pt;var Tt=Be.options.resolve;function Dt(e,t){var n,r,i,a,o=e.isHorizontal()?e.width:e.height,l=e.getTicks();for(i=1,a=t.length;i<a;++i)o=Math.min(o,Math.abs(t[i]-t[i-1]));for(i=0,a=l.length;i<a;++i)r=e.getPixelForTick(i),o=i>0?Math.min(o,r-n):o,n=r;return o}function Nt(e,t,n){var r,i,a=n.barThickness,o=t.stackCount,l=t.pixels[e];return Be.isNullOrUndef(a)?(r=t.min*n.categoryPercentage,i=n.barPercentage):(r=a*o,i=1),{chunk:r/o,ratio:i,start:l-r/2}}function Rt(e,t,n){var r,i=t.pixels,a=i[e],o=e>0?i[e-1]:null,l=e<i.length-1?i[e+1]:null,s=n.categoryPercentage;return null===o&&(o=a-(null===l?t.end-t.start:l-a)),null===l&&(l=a+a-o),r=a-(a-Math.min(o,l))/2*s,{chunk:Math.abs(l-o)/2*s/t.stackCount,ratio:n.barPercentage,start:r}}Ye._set("bar",{hover:{mode:"label"},scales:{xAxes:[{type:"category",categoryPercentage:.8,barPercentage:.9,offset:!0,gridLines:{offsetGridLines:!0}}],yAxes:[{type:"linear"}]}});var At=ot.extend({dataElementType:Mt.Rectangle,initialize:function(){var e,t=this;ot.prototype.initialize.apply(t,arguments),(e=t.getMeta()).stack=t.getDataset().stack,e.bar=!0},update:function(e){var t,n,r=this,i=r.getMeta().data;for(r._ruler=r.getRuler(),t=0,n=i.length;t<n;++t)r.updateElement(i[t],t,e)},updateElement:function(e,t,n){var r=this,i=r.getMeta(),a=r.getDataset(),o=r._resolveElementOptions(e,t);e._xScale=r.getScaleForId(i.xAxisID),e._yScale=r.getScaleForId(i.yAxisID),e._datasetIndex=r.index,e._index=t,e._model={backgroundColor:o.backgroundColor,borderColor:o.borderColor,borderSkipped:o.borderSkipped,borderWidth:o.borderWidth,datasetLabel:a.label,label:r.chart.data.labels[t]},r._updateElementGeometry(e,t,n),e.pivot()},_updateElementGeometry:function(e,t,n){var r=this,i=e._model,a=r._getValueScale(),o=a.getBasePixel(),l=a.isHorizontal(),s=r._ruler||r.getRuler(),u=r.calculateBarValuePixels(r.index,t),c=r.calculateBarIndexPixels(r.index,t,s);i.horizontal=l,i.base=n?o:u.base,i.x=l?n?o:u.head:c.center,i.y=l?c.center:n?o:u.head,i.height=l?c.size:void 0,i.width=l?void 0:c.size},_getStacks:function(e){var t,n,r=this,i=r.chart,a=r._getIndexScale().options.stacked,o=void 0===e?i.data.datasets.length:e+1,l=[];for(t=0;t<o;++t)(n=i.getDatasetMeta(t)).bar&&i.isDatasetVisible(t)&&(!1===a||!0===a&&-1===l.indexOf(n.stack)||void 0===a&&(void 0===n.stack||-1===l.indexOf(n.stack)))&&l.push(n.stack);return l},getStackCount:function(){return this._getStacks().length},getStackIndex:function(e,t){var n=this._getStacks(e),r=void 0!==t?n.indexOf(t):-1;return-1===r?n.length-1:r},getRuler:function(){var e,t,n=this,r=n._getIndexScale(),i=n.getStackCount(),a=n.index,o=r.isHorizontal(),l=o?r.left:r.top,s=l+(o?r.width:r.height),u=[];for(e=0,t=n.getMeta().data.length;e<t;++e)u.push(r.getPixelForValue(null,e,a));return{min:Be.isNullOrUndef(r.options.barThickness)?Dt(r,u):-1,pixels:u,start:l,end:s,stackCount:i,scale:r}},calculateBarValuePixels:function(e,t){var n,r,i,a,o,l,s=this,u=s.chart,c=s.getMeta(),d=s._getValueScale(),f=d.isHorizontal(),h=u.data.datasets,p=+d.getRightValue(h[e].data[t]),g=d.options.minBarLength,m=d.options.stacked,v=c.stack,y=0;if(m||void 0===m&&void 0!==v)for(n=0;n<e;++n)(r=u.getDatasetMeta(n)).bar&&r.stack===v&&r.controller._getValueScaleId()===d.id&&u.isDatasetVisible(n)&&(i=+d.getRightValue(h[n].data[t]),(p<0&&i<0||p>=0&&i>0)&&(y+=i));return a=d.getPixelForValue(y),l=(o=d.getPixelForValue(y+p))-a,void 0!==g&&Math.abs(l)<g&&(l=g,o=p>=0&&!f||p<0&&f?a-g:a+g),{size:l,base:a,head:o,center:o+l/2}},calculateBarIndexPixels:function(e,t,n){var r=this,i=n.scale.options,a="flex"===i.barThickness?Rt(t,n,i):Nt(t,n,i),o=r.getStackIndex(e,r.getMeta().stack),l=a.start+a.chunk*o+a.chunk/2,s=Math.min(Be.valueOrDefault(i.maxBarThickness,1/0),a.chunk*a.ratio);return{base:l-s/2,head:l+s/2,center:l,size:s}},draw:function(){var e=this,t=e.chart,n=e._getValueScale(),r=e.getMeta().data,i=e.getDataset(),a=r.length,o=0;for(Be.canvas.clipArea(t.ctx,t.chartArea);o<a;++o)isNaN(n.getRightValue(i.data[o]))||r[o].draw();Be.canvas.unclipArea(t.ctx)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.rectangle,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderSkipped","borderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Tt([s[i],l[i],u[i]],d,t);return c}}),It=Be.valueOrDefault,Lt=Be.options.resolve;Ye._set("bubble",{hover:{mode:"single"},scales:{xAxes:[{type:"linear",position:"bottom",id:"x-axis-0"}],yAxes:[{type:"linear",position:"left",id:"y-axis-0"}]},tooltips:{callbacks:{title:function(){return""},label:function(e,t){var n=t.datasets[e.datasetIndex].label||"",r=t.datasets[e.datasetIndex].data[e.index];return n+": ("+e.xLabel+", "+e.yLabel+", "+r.r+")"}}}});var jt=ot.extend({dataElementType:Mt.Point,update:function(e){var t=this,n=t.getMeta().data;Be.each(n,(function(n,r){t.updateElement(n,r,e)}))},updateElement:function(e,t,n){var r=this,i=r.getMeta(),a=e.custom||{},o=r.getScaleForId(i.xAxisID),l=r.getScaleForId(i.yAxisID),s=r._resolveElementOptions(e,t),u=r.getDataset().data[t],c=r.index,d=n?o.getPixelForDecimal(.5):o.getPixelForValue("object"===typeof u?u:NaN,t,c),f=n?l.getBasePixel():l.getPixelForValue(u,t,c);e._xScale=o,e._yScale=l,e._options=s,e._datasetIndex=c,e._index=t,e._model={backgroundColor:s.backgroundColor,borderColor:s.borderColor,borderWidth:s.borderWidth,hitRadius:s.hitRadius,pointStyle:s.pointStyle,rotation:s.rotation,radius:n?0:s.radius,skip:a.skip||isNaN(d)||isNaN(f),x:d,y:f},e.pivot()},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=It(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=It(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=It(n.hoverBorderWidth,n.borderWidth),t.radius=n.radius+n.hoverRadius},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c=l.data[t],d={},f={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},h=["backgroundColor","borderColor","borderWidth","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth","hoverRadius","hitRadius","pointStyle","rotation"];for(n=0,r=h.length;n<r;++n)d[i=h[n]]=Lt([s[i],l[i],u[i]],f,t);return d.radius=Lt([s.radius,c?c.r:void 0,l.radius,u.radius],f,t),d}}),Ft=Be.options.resolve,zt=Be.valueOrDefault;Ye._set("doughnut",{animation:{animateRotate:!0,animateScale:!1},hover:{mode:"single"},legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');var n=e.data,r=n.datasets,i=n.labels;if(r.length)for(var a=0;a<r[0].data.length;++a)t.push('<li><span style="background-color:'+r[0].backgroundColor[a]+'"></span>'),i[a]&&t.push(i[a]),t.push("</li>");return t.push("</ul>"),t.join("")},legend:{labels:{generateLabels:function(e){var t=e.data;return t.labels.length&&t.datasets.length?t.labels.map((function(n,r){var i=e.getDatasetMeta(0),a=t.datasets[0],o=i.data[r],l=o&&o.custom||{},s=e.options.elements.arc;return{text:n,fillStyle:Ft([l.backgroundColor,a.backgroundColor,s.backgroundColor],void 0,r),strokeStyle:Ft([l.borderColor,a.borderColor,s.borderColor],void 0,r),lineWidth:Ft([l.borderWidth,a.borderWidth,s.borderWidth],void 0,r),hidden:isNaN(a.data[r])||i.data[r].hidden,index:r}})):[]}},onClick:function(e,t){var n,r,i,a=t.index,o=this.chart;for(n=0,r=(o.data.datasets||[]).length;n<r;++n)(i=o.getDatasetMeta(n)).data[a]&&(i.data[a].hidden=!i.data[a].hidden);o.update()}},cutoutPercentage:50,rotation:-.5*Math.PI,circumference:2*Math.PI,tooltips:{callbacks:{title:function(){return""},label:function(e,t){var n=t.labels[e.index],r=": "+t.datasets[e.datasetIndex].data[e.index];return Be.isArray(n)?(n=n.slice())[0]+=r:n+=r,n}}}});var Wt=ot.extend({dataElementType:Mt.Arc,linkScales:Be.noop,getRingIndex:function(e){for(var t=0,n=0;n<e;++n)this.chart.isDatasetVisible(n)&&++t;return t},update:function(e){var t,n,r=this,i=r.chart,a=i.chartArea,o=i.options,l=a.right-a.left,s=a.bottom-a.top,u=Math.min(l,s),c={x:0,y:0},d=r.getMeta(),f=d.data,h=o.cutoutPercentage,p=o.circumference,g=r._getRingWeight(r.index);if(p<2*Math.PI){var m=o.rotation%(2*Math.PI),v=(m+=2*Math.PI*(m>=Math.PI?-1:m<-Math.PI?1:0))+p,y={x:Math.cos(m),y:Math.sin(m)},b={x:Math.cos(v),y:Math.sin(v)},x=m<=0&&v>=0||m<=2*Math.PI&&2*Math.PI<=v,w=m<=.5*Math.PI&&.5*Math.PI<=v||m<=2.5*Math.PI&&2.5*Math.PI<=v,_=m<=-Math.PI&&-Math.PI<=v||m<=Math.PI&&Math.PI<=v,k=m<=.5*-Math.PI&&.5*-Math.PI<=v||m<=1.5*Math.PI&&1.5*Math.PI<=v,S=h/100,M={x:_?-1:Math.min(y.x*(y.x<0?1:S),b.x*(b.x<0?1:S)),y:k?-1:Math.min(y.y*(y.y<0?1:S),b.y*(b.y<0?1:S))},C={x:x?1:Math.max(y.x*(y.x>0?1:S),b.x*(b.x>0?1:S)),y:w?1:Math.max(y.y*(y.y>0?1:S),b.y*(b.y>0?1:S))},E={width:.5*(C.x-M.x),height:.5*(C.y-M.y)};u=Math.min(l/E.width,s/E.height),c={x:-.5*(C.x+M.x),y:-.5*(C.y+M.y)}}for(t=0,n=f.length;t<n;++t)f[t]._options=r._resolveElementOptions(f[t],t);for(i.borderWidth=r.getMaxBorderWidth(),i.outerRadius=Math.max((u-i.borderWidth)/2,0),i.innerRadius=Math.max(h?i.outerRadius/100*h:0,0),i.radiusLength=(i.outerRadius-i.innerRadius)/(r._getVisibleDatasetWeightTotal()||1),i.offsetX=c.x*i.outerRadius,i.offsetY=c.y*i.outerRadius,d.total=r.calculateTotal(),r.outerRadius=i.outerRadius-i.radiusLength*r._getRingWeightOffset(r.index),r.innerRadius=Math.max(r.outerRadius-i.radiusLength*g,0),t=0,n=f.length;t<n;++t)r.updateElement(f[t],t,e)},updateElement:function(e,t,n){var r=this,i=r.chart,a=i.chartArea,o=i.options,l=o.animation,s=(a.left+a.right)/2,u=(a.top+a.bottom)/2,c=o.rotation,d=o.rotation,f=r.getDataset(),h=n&&l.animateRotate||e.hidden?0:r.calculateCircumference(f.data[t])*(o.circumference/(2*Math.PI)),p=n&&l.animateScale?0:r.innerRadius,g=n&&l.animateScale?0:r.outerRadius,m=e._options||{};Be.extend(e,{_datasetIndex:r.index,_index:t,_model:{backgroundColor:m.backgroundColor,borderColor:m.borderColor,borderWidth:m.borderWidth,borderAlign:m.borderAlign,x:s+i.offsetX,y:u+i.offsetY,startAngle:c,endAngle:d,circumference:h,outerRadius:g,innerRadius:p,label:Be.valueAtIndexOrDefault(f.label,t,i.data.labels[t])}});var v=e._model;n&&l.animateRotate||(v.startAngle=0===t?o.rotation:r.getMeta().data[t-1]._model.endAngle,v.endAngle=v.startAngle+v.circumference),e.pivot()},calculateTotal:function(){var e,t=this.getDataset(),n=this.getMeta(),r=0;return Be.each(n.data,(function(n,i){e=t.data[i],isNaN(e)||n.hidden||(r+=Math.abs(e))})),r},calculateCircumference:function(e){var t=this.getMeta().total;return t>0&&!isNaN(e)?2*Math.PI*(Math.abs(e)/t):0},getMaxBorderWidth:function(e){var t,n,r,i,a,o,l,s,u=this,c=0,d=u.chart;if(!e)for(t=0,n=d.data.datasets.length;t<n;++t)if(d.isDatasetVisible(t)){e=(r=d.getDatasetMeta(t)).data,t!==u.index&&(a=r.controller);break}if(!e)return 0;for(t=0,n=e.length;t<n;++t)i=e[t],"inner"!==(o=a?a._resolveElementOptions(i,t):i._options).borderAlign&&(l=o.borderWidth,c=(s=o.hoverBorderWidth)>(c=l>c?l:c)?s:c);return c},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth},t.backgroundColor=zt(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=zt(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=zt(n.hoverBorderWidth,n.borderWidth)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=a.getDataset(),s=e.custom||{},u=o.options.elements.arc,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderWidth","borderAlign","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Ft([s[i],l[i],u[i]],d,t);return c},_getRingWeightOffset:function(e){for(var t=0,n=0;n<e;++n)this.chart.isDatasetVisible(n)&&(t+=this._getRingWeight(n));return t},_getRingWeight:function(e){return Math.max(zt(this.chart.data.datasets[e].weight,1),0)},_getVisibleDatasetWeightTotal:function(){return this._getRingWeightOffset(this.chart.data.datasets.length)}});Ye._set("horizontalBar",{hover:{mode:"index",axis:"y"},scales:{xAxes:[{type:"linear",position:"bottom"}],yAxes:[{type:"category",position:"left",categoryPercentage:.8,barPercentage:.9,offset:!0,gridLines:{offsetGridLines:!0}}]},elements:{rectangle:{borderSkipped:"left"}},tooltips:{mode:"index",axis:"y"}});var Yt=At.extend({_getValueScaleId:function(){return this.getMeta().xAxisID},_getIndexScaleId:function(){return this.getMeta().yAxisID}}),Ht=Be.valueOrDefault,Ut=Be.options.resolve,Vt=Be.canvas._isPointInArea;function Bt(e,t){return Ht(e.showLine,t.showLines)}Ye._set("line",{showLines:!0,spanGaps:!1,hover:{mode:"label"},scales:{xAxes:[{type:"category",id:"x-axis-0"}],yAxes:[{type:"linear",id:"y-axis-0"}]}});var $t=ot.extend({datasetElementType:Mt.Line,dataElementType:Mt.Point,update:function(e){var t,n,r=this,i=r.getMeta(),a=i.dataset,o=i.data||[],l=r.getScaleForId(i.yAxisID),s=r.getDataset(),u=Bt(s,r.chart.options);for(u&&(void 0!==s.tension&&void 0===s.lineTension&&(s.lineTension=s.tension),a._scale=l,a._datasetIndex=r.index,a._children=o,a._model=r._resolveLineOptions(a),a.pivot()),t=0,n=o.length;t<n;++t)r.updateElement(o[t],t,e);for(u&&0!==a._model.tension&&r.updateBezierControlPoints(),t=0,n=o.length;t<n;++t)o[t].pivot()},updateElement:function(e,t,n){var r,i,a=this,o=a.getMeta(),l=e.custom||{},s=a.getDataset(),u=a.index,c=s.data[t],d=a.getScaleForId(o.yAxisID),f=a.getScaleForId(o.xAxisID),h=o.dataset._model,p=a._resolvePointOptions(e,t);r=f.getPixelForValue("object"===typeof c?c:NaN,t,u),i=n?d.getBasePixel():a.calculatePointY(c,t,u),e._xScale=f,e._yScale=d,e._options=p,e._datasetIndex=u,e._index=t,e._model={x:r,y:i,skip:l.skip||isNaN(r)||isNaN(i),radius:p.radius,pointStyle:p.pointStyle,rotation:p.rotation,backgroundColor:p.backgroundColor,borderColor:p.borderColor,borderWidth:p.borderWidth,tension:Ht(l.tension,h?h.tension:0),steppedLine:!!h&&h.steppedLine,hitRadius:p.hitRadius}},_resolvePointOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f={backgroundColor:"pointBackgroundColor",borderColor:"pointBorderColor",borderWidth:"pointBorderWidth",hitRadius:"pointHitRadius",hoverBackgroundColor:"pointHoverBackgroundColor",hoverBorderColor:"pointHoverBorderColor",hoverBorderWidth:"pointHoverBorderWidth",hoverRadius:"pointHoverRadius",pointStyle:"pointStyle",radius:"pointRadius",rotation:"pointRotation"},h=Object.keys(f);for(n=0,r=h.length;n<r;++n)c[i=h[n]]=Ut([s[i],l[f[i]],l[i],u[i]],d,t);return c},_resolveLineOptions:function(e){var t,n,r,i=this,a=i.chart,o=a.data.datasets[i.index],l=e.custom||{},s=a.options,u=s.elements.line,c={},d=["backgroundColor","borderWidth","borderColor","borderCapStyle","borderDash","borderDashOffset","borderJoinStyle","fill","cubicInterpolationMode"];for(t=0,n=d.length;t<n;++t)c[r=d[t]]=Ut([l[r],o[r],u[r]]);return c.spanGaps=Ht(o.spanGaps,s.spanGaps),c.tension=Ht(o.lineTension,u.tension),c.steppedLine=Ut([l.steppedLine,o.steppedLine,u.stepped]),c},calculatePointY:function(e,t,n){var r,i,a,o=this,l=o.chart,s=o.getMeta(),u=o.getScaleForId(s.yAxisID),c=0,d=0;if(u.options.stacked){for(r=0;r<n;r++)if(i=l.data.datasets[r],"line"===(a=l.getDatasetMeta(r)).type&&a.yAxisID===u.id&&l.isDatasetVisible(r)){var f=Number(u.getRightValue(i.data[t]));f<0?d+=f||0:c+=f||0}var h=Number(u.getRightValue(e));return h<0?u.getPixelForValue(d+h):u.getPixelForValue(c+h)}return u.getPixelForValue(e)},updateBezierControlPoints:function(){var e,t,n,r,i=this,a=i.chart,o=i.getMeta(),l=o.dataset._model,s=a.chartArea,u=o.data||[];function c(e,t,n){return Math.max(Math.min(e,n),t)}if(l.spanGaps&&(u=u.filter((function(e){return!e._model.skip}))),"monotone"===l.cubicInterpolationMode)Be.splineCurveMonotone(u);else for(e=0,t=u.length;e<t;++e)n=u[e]._model,r=Be.splineCurve(Be.previousItem(u,e)._model,n,Be.nextItem(u,e)._model,l.tension),n.controlPointPreviousX=r.previous.x,n.controlPointPreviousY=r.previous.y,n.controlPointNextX=r.next.x,n.controlPointNextY=r.next.y;if(a.options.elements.line.capBezierPoints)for(e=0,t=u.length;e<t;++e)n=u[e]._model,Vt(n,s)&&(e>0&&Vt(u[e-1]._model,s)&&(n.controlPointPreviousX=c(n.controlPointPreviousX,s.left,s.right),n.controlPointPreviousY=c(n.controlPointPreviousY,s.top,s.bottom)),e<u.length-1&&Vt(u[e+1]._model,s)&&(n.controlPointNextX=c(n.controlPointNextX,s.left,s.right),n.controlPointNextY=c(n.controlPointNextY,s.top,s.bottom)))},draw:function(){var e,t=this,n=t.chart,r=t.getMeta(),i=r.data||[],a=n.chartArea,o=i.length,l=0;for(Bt(t.getDataset(),n.options)&&(e=(r.dataset._model.borderWidth||0)/2,Be.canvas.clipArea(n.ctx,{left:a.left,right:a.right,top:a.top-e,bottom:a.bottom+e}),r.dataset.draw(),Be.canvas.unclipArea(n.ctx));l<o;++l)i[l].draw(a)},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=Ht(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=Ht(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=Ht(n.hoverBorderWidth,n.borderWidth),t.radius=Ht(n.hoverRadius,n.radius)}}),Xt=Be.options.resolve;Ye._set("polarArea",{scale:{type:"radialLinear",angleLines:{display:!1},gridLines:{circular:!0},pointLabels:{display:!1},ticks:{beginAtZero:!0}},animation:{animateRotate:!0,animateScale:!0},startAngle:-.5*Math.PI,legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');var n=e.data,r=n.datasets,i=n.labels;if(r.length)for(var a=0;a<r[0].data.length;++a)t.push('<li><span style="background-color:'+r[0].backgroundColor[a]+'"></span>'),i[a]&&t.push(i[a]),t.push("</li>");return t.push("</ul>"),t.join("")},legend:{labels:{generateLabels:function(e){var t=e.data;return t.labels.length&&t.datasets.length?t.labels.map((function(n,r){var i=e.getDatasetMeta(0),a=t.datasets[0],o=i.data[r].custom||{},l=e.options.elements.arc;return{text:n,fillStyle:Xt([o.backgroundColor,a.backgroundColor,l.backgroundColor],void 0,r),strokeStyle:Xt([o.borderColor,a.borderColor,l.borderColor],void 0,r),lineWidth:Xt([o.borderWidth,a.borderWidth,l.borderWidth],void 0,r),hidden:isNaN(a.data[r])||i.data[r].hidden,index:r}})):[]}},onClick:function(e,t){var n,r,i,a=t.index,o=this.chart;for(n=0,r=(o.data.datasets||[]).length;n<r;++n)(i=o.getDatasetMeta(n)).data[a].hidden=!i.data[a].hidden;o.update()}},tooltips:{callbacks:{title:function(){return""},label:function(e,t){return t.labels[e.index]+": "+e.yLabel}}}});var qt=ot.extend({dataElementType:Mt.Arc,linkScales:Be.noop,update:function(e){var t,n,r,i=this,a=i.getDataset(),o=i.getMeta(),l=i.chart.options.startAngle||0,s=i._starts=[],u=i._angles=[],c=o.data;for(i._updateRadius(),o.count=i.countVisibleElements(),t=0,n=a.data.length;t<n;t++)s[t]=l,r=i._computeAngle(t),u[t]=r,l+=r;for(t=0,n=c.length;t<n;++t)c[t]._options=i._resolveElementOptions(c[t],t),i.updateElement(c[t],t,e)},_updateRadius:function(){var e=this,t=e.chart,n=t.chartArea,r=t.options,i=Math.min(n.right-n.left,n.bottom-n.top);t.outerRadius=Math.max(i/2,0),t.innerRadius=Math.max(r.cutoutPercentage?t.outerRadius/100*r.cutoutPercentage:1,0),t.radiusLength=(t.outerRadius-t.innerRadius)/t.getVisibleDatasetCount(),e.outerRadius=t.outerRadius-t.radiusLength*e.index,e.innerRadius=e.outerRadius-t.radiusLength},updateElement:function(e,t,n){var r=this,i=r.chart,a=r.getDataset(),o=i.options,l=o.animation,s=i.scale,u=i.data.labels,c=s.xCenter,d=s.yCenter,f=o.startAngle,h=e.hidden?0:s.getDistanceFromCenterForValue(a.data[t]),p=r._starts[t],g=p+(e.hidden?0:r._angles[t]),m=l.animateScale?0:s.getDistanceFromCenterForValue(a.data[t]),v=e._options||{};Be.extend(e,{_datasetIndex:r.index,_index:t,_scale:s,_model:{backgroundColor:v.backgroundColor,borderColor:v.borderColor,borderWidth:v.borderWidth,borderAlign:v.borderAlign,x:c,y:d,innerRadius:0,outerRadius:n?m:h,startAngle:n&&l.animateRotate?f:p,endAngle:n&&l.animateRotate?f:g,label:Be.valueAtIndexOrDefault(u,t,u[t])}}),e.pivot()},countVisibleElements:function(){var e=this.getDataset(),t=this.getMeta(),n=0;return Be.each(t.data,(function(t,r){isNaN(e.data[r])||t.hidden||n++})),n},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor,i=Be.valueOrDefault;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth},t.backgroundColor=i(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=i(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=i(n.hoverBorderWidth,n.borderWidth)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=a.getDataset(),s=e.custom||{},u=o.options.elements.arc,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderWidth","borderAlign","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Xt([s[i],l[i],u[i]],d,t);return c},_computeAngle:function(e){var t=this,n=this.getMeta().count,r=t.getDataset(),i=t.getMeta();if(isNaN(r.data[e])||i.data[e].hidden)return 0;var a={chart:t.chart,dataIndex:e,dataset:r,datasetIndex:t.index};return Xt([t.chart.options.elements.arc.angle,2*Math.PI/n],a,e)}});Ye._set("pie",Be.clone(Ye.doughnut)),Ye._set("pie",{cutoutPercentage:0});var Gt=Wt,Kt=Be.valueOrDefault,Qt=Be.options.resolve;Ye._set("radar",{scale:{type:"radialLinear"},elements:{line:{tension:0}}});var Zt=ot.extend({datasetElementType:Mt.Line,dataElementType:Mt.Point,linkScales:Be.noop,update:function(e){var t,n,r=this,i=r.getMeta(),a=i.dataset,o=i.data||[],l=r.chart.scale,s=r.getDataset();for(void 0!==s.tension&&void 0===s.lineTension&&(s.lineTension=s.tension),a._scale=l,a._datasetIndex=r.index,a._children=o,a._loop=!0,a._model=r._resolveLineOptions(a),a.pivot(),t=0,n=o.length;t<n;++t)r.updateElement(o[t],t,e);for(r.updateBezierControlPoints(),t=0,n=o.length;t<n;++t)o[t].pivot()},updateElement:function(e,t,n){var r=this,i=e.custom||{},a=r.getDataset(),o=r.chart.scale,l=o.getPointPositionForValue(t,a.data[t]),s=r._resolvePointOptions(e,t),u=r.getMeta().dataset._model,c=n?o.xCenter:l.x,d=n?o.yCenter:l.y;e._scale=o,e._options=s,e._datasetIndex=r.index,e._index=t,e._model={x:c,y:d,skip:i.skip||isNaN(c)||isNaN(d),radius:s.radius,pointStyle:s.pointStyle,rotation:s.rotation,backgroundColor:s.backgroundColor,borderColor:s.borderColor,borderWidth:s.borderWidth,tension:Kt(i.tension,u?u.tension:0),hitRadius:s.hitRadius}},_resolvePointOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f={backgroundColor:"pointBackgroundColor",borderColor:"pointBorderColor",borderWidth:"pointBorderWidth",hitRadius:"pointHitRadius",hoverBackgroundColor:"pointHoverBackgroundColor",hoverBorderColor:"pointHoverBorderColor",hoverBorderWidth:"pointHoverBorderWidth",hoverRadius:"pointHoverRadius",pointStyle:"pointStyle",radius:"pointRadius",rotation:"pointRotation"},h=Object.keys(f);for(n=0,r=h.length;n<r;++n)c[i=h[n]]=Qt([s[i],l[f[i]],l[i],u[i]],d,t);return c},_resolveLineOptions:function(e){var t,n,r,i=this,a=i.chart,o=a.data.datasets[i.index],l=e.custom||{},s=a.options.elements.line,u={},c=["backgroundColor","borderWidth","borderColor","borderCapStyle","borderDash","borderDashOffset","borderJoinStyle","fill"];for(t=0,n=c.length;t<n;++t)u[r=c[t]]=Qt([l[r],o[r],s[r]]);return u.tension=Kt(o.lineTension,s.tension),u},updateBezierControlPoints:function(){var e,t,n,r,i=this,a=i.getMeta(),o=i.chart.chartArea,l=a.data||[];function s(e,t,n){return Math.max(Math.min(e,n),t)}for(e=0,t=l.length;e<t;++e)n=l[e]._model,r=Be.splineCurve(Be.previousItem(l,e,!0)._model,n,Be.nextItem(l,e,!0)._model,n.tension),n.controlPointPreviousX=s(r.previous.x,o.left,o.right),n.controlPointPreviousY=s(r.previous.y,o.top,o.bottom),n.controlPointNextX=s(r.next.x,o.left,o.right),n.controlPointNextY=s(r.next.y,o.top,o.bottom)},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=Kt(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=Kt(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=Kt(n.hoverBorderWidth,n.borderWidth),t.radius=Kt(n.hoverRadius,n.radius)}});Ye._set("scatter",{hover:{mode:"single"},scales:{xAxes:[{id:"x-axis-1",type:"linear",position:"bottom"}],yAxes:[{id:"y-axis-1",type:"linear",position:"left"}]},showLines:!1,tooltips:{callbacks:{title:function(){return""},label:function(e){return"("+e.xLabel+", "+e.yLabel+")"}}}});var Jt={bar:At,bubble:jt,doughnut:Wt,horizontalBar:Yt,line:$t,polarArea:qt,pie:Gt,radar:Zt,scatter:$t};function en(e,t){return e.native?{x:e.x,y:e.y}:Be.getRelativePosition(e,t)}function tn(e,t){var n,r,i,a,o;for(r=0,a=e.data.datasets.length;r<a;++r)if(e.isDatasetVisible(r))for(i=0,o=(n=e.getDatasetMeta(r)).data.length;i<o;++i){var l=n.data[i];l._view.skip||t(l)}}function nn(e,t){var n=[];return tn(e,(function(e){e.inRange(t.x,t.y)&&n.push(e)})),n}function rn(e,t,n,r){var i=Number.POSITIVE_INFINITY,a=[];return tn(e,(function(e){if(!n||e.inRange(t.x,t.y)){var o=e.getCenterPoint(),l=r(t,o);l<i?(a=[e],i=l):l===i&&a.push(e)}})),a}function an(e){var t=-1!==e.indexOf("x"),n=-1!==e.indexOf("y");return function(e,r){var i=t?Math.abs(e.x-r.x):0,a=n?Math.abs(e.y-r.y):0;return Math.sqrt(Math.pow(i,2)+Math.pow(a,2))}}function on(e,t,n){var r=en(t,e);n.axis=n.axis||"x";var i=an(n.axis),a=n.intersect?nn(e,r):rn(e,r,!1,i),o=[];return a.length?(e.data.datasets.forEach((function(t,n){if(e.isDatasetVisible(n)){var r=e.getDatasetMeta(n).data[a[0]._index];r&&!r._view.skip&&o.push(r)}})),o):[]}var ln={modes:{single:function(e,t){var n=en(t,e),r=[];return tn(e,(function(e){if(e.inRange(n.x,n.y))return r.push(e),r})),r.slice(0,1)},label:on,index:on,dataset:function(e,t,n){var r=en(t,e);n.axis=n.axis||"xy";var i=an(n.axis),a=n.intersect?nn(e,r):rn(e,r,!1,i);return a.length>0&&(a=e.getDatasetMeta(a[0]._datasetIndex).data),a},"x-axis":function(e,t){return on(e,t,{intersect:!1})},point:function(e,t){return nn(e,en(t,e))},nearest:function(e,t,n){var r=en(t,e);n.axis=n.axis||"xy";var i=an(n.axis);return rn(e,r,n.intersect,i)},x:function(e,t,n){var r=en(t,e),i=[],a=!1;return tn(e,(function(e){e.inXRange(r.x)&&i.push(e),e.inRange(r.x,r.y)&&(a=!0)})),n.intersect&&!a&&(i=[]),i},y:function(e,t,n){var r=en(t,e),i=[],a=!1;return tn(e,(function(e){e.inYRange(r.y)&&i.push(e),e.inRange(r.x,r.y)&&(a=!0)})),n.intersect&&!a&&(i=[]),i}}};function sn(e,t){return Be.where(e,(function(e){return e.position===t}))}function un(e,t){e.forEach((function(e,t){return e._tmpIndex_=t,e})),e.sort((function(e,n){var r=t?n:e,i=t?e:n;return r.weight===i.weight?r._tmpIndex_-i._tmpIndex_:r.weight-i.weight})),e.forEach((function(e){delete e._tmpIndex_}))}function cn(e){var t=0,n=0,r=0,i=0;return Be.each(e,(function(e){if(e.getPadding){var a=e.getPadding();t=Math.max(t,a.top),n=Math.max(n,a.left),r=Math.max(r,a.bottom),i=Math.max(i,a.right)}})),{top:t,left:n,bottom:r,right:i}}function dn(e,t){Be.each(e,(function(e){t[e.position]+=e.isHorizontal()?e.height:e.width}))}Ye._set("global",{layout:{padding:{top:0,right:0,bottom:0,left:0}}});var fn={defaults:{},addBox:function(e,t){e.boxes||(e.boxes=[]),t.fullWidth=t.fullWidth||!1,t.position=t.position||"top",t.weight=t.weight||0,e.boxes.push(t)},removeBox:function(e,t){var n=e.boxes?e.boxes.indexOf(t):-1;-1!==n&&e.boxes.splice(n,1)},configure:function(e,t,n){for(var r,i=["fullWidth","position","weight"],a=i.length,o=0;o<a;++o)r=i[o],n.hasOwnProperty(r)&&(t[r]=n[r])},update:function(e,t,n){if(e){var r=e.options.layout||{},i=Be.options.toPadding(r.padding),a=i.left,o=i.right,l=i.top,s=i.bottom,u=sn(e.boxes,"left"),c=sn(e.boxes,"right"),d=sn(e.boxes,"top"),f=sn(e.boxes,"bottom"),h=sn(e.boxes,"chartArea");un(u,!0),un(c,!1),un(d,!0),un(f,!1);var p,g=u.concat(c),m=d.concat(f),v=g.concat(m),y=t-a-o,b=n-l-s,x=(t-y/2)/g.length,w=y,_=b,k={top:l,left:a,bottom:s,right:o},S=[];Be.each(v,D),p=cn(v),Be.each(g,N),dn(g,k),Be.each(m,N),dn(m,k),Be.each(g,R),dn(v,k={top:l,left:a,bottom:s,right:o});var M=Math.max(p.left-k.left,0);k.left+=M,k.right+=Math.max(p.right-k.right,0);var C=Math.max(p.top-k.top,0);k.top+=C,k.bottom+=Math.max(p.bottom-k.bottom,0);var E=n-k.top-k.bottom,O=t-k.left-k.right;O===w&&E===_||(Be.each(g,(function(e){e.height=E})),Be.each(m,(function(e){e.fullWidth||(e.width=O)})),_=E,w=O);var P=a+M,T=l+C;Be.each(u.concat(d),A),P+=w,T+=_,Be.each(c,A),Be.each(f,A),e.chartArea={left:k.left,top:k.top,right:k.left+w,bottom:k.top+_},Be.each(h,(function(t){t.left=e.chartArea.left,t.top=e.chartArea.top,t.right=e.chartArea.right,t.bottom=e.chartArea.bottom,t.update(w,_)}))}function D(e){var t,n=e.isHorizontal();n?(t=e.update(e.fullWidth?y:w,b/2),_-=t.height):(t=e.update(x,_),w-=t.width),S.push({horizontal:n,width:t.width,box:e})}function N(e){var t=Be.findNextWhere(S,(function(t){return t.box===e}));if(t)if(t.horizontal){var n={left:Math.max(k.left,p.left),right:Math.max(k.right,p.right),top:0,bottom:0};e.update(e.fullWidth?y:w,b/2,n)}else e.update(t.width,_)}function R(e){var t=Be.findNextWhere(S,(function(t){return t.box===e})),n={left:0,right:0,top:k.top,bottom:k.bottom};t&&e.update(t.width,_,n)}function A(e){e.isHorizontal()?(e.left=e.fullWidth?a:k.left,e.right=e.fullWidth?t-o:k.left+w,e.top=T,e.bottom=T+e.height,T=e.bottom):(e.left=P,e.right=P+e.width,e.top=k.top,e.bottom=k.top+_,P=e.right)}}},hn={acquireContext:function(e){return e&&e.canvas&&(e=e.canvas),e&&e.getContext("2d")||null}},pn="/*\n * DOM element rendering detection\n * https://davidwalsh.name/detect-node-insertion\n */\n@keyframes chartjs-render-animation {\n\tfrom { opacity: 0.99; }\n\tto { opacity: 1; }\n}\n\n.chartjs-render-monitor {\n\tanimation: chartjs-render-animation 0.001s;\n}\n\n/*\n * DOM element resizing detection\n * https://github.com/marcj/css-element-queries\n */\n.chartjs-size-monitor,\n.chartjs-size-monitor-expand,\n.chartjs-size-monitor-shrink {\n\tposition: absolute;\n\tdirection: ltr;\n\tleft: 0;\n\ttop: 0;\n\tright: 0;\n\tbottom: 0;\n\toverflow: hidden;\n\tpointer-events: none;\n\tvisibility: hidden;\n\tz-index: -1;\n}\n\n.chartjs-size-monitor-expand > div {\n\tposition: absolute;\n\twidth: 1000000px;\n\theight: 1000000px;\n\tleft: 0;\n\ttop: 0;\n}\n\n.chartjs-size-monitor-shrink > div {\n\tposition: absolute;\n\twidth: 200%;\n\theight: 200%;\n\tleft: 0;\n\ttop: 0;\n}\n";function gn(e){return e&&e.default||e}var mn=gn(Object.freeze({default:pn})),vn="$chartjs",yn="chartjs-",bn=yn+"size-monitor",xn=yn+"render-monitor",wn=yn+"render-animation",_n=["animationstart","webkitAnimationStart"],kn={touchstart:"mousedown",touchmove:"mousemove",touchend:"mouseup",pointerenter:"mouseenter",pointerdown:"mousedown",pointermove:"mousemove",pointerup:"mouseup",pointerleave:"mouseout",pointerout:"mouseout"};function Sn(e,t){var n=Be.getStyle(e,t),r=n&&n.match(/^(\d+)(\.\d+)?px$/);return r?Number(r[1]):void 0}function Mn(e,t){var n=e.style,r=e.getAttribute("height"),i=e.getAttribute("width");if(e[vn]={initial:{height:r,width:i,style:{display:n.display,height:n.height,width:n.width}}},n.display=n.display||"block",null===i||""===i){var a=Sn(e,"width");void 0!==a&&(e.width=a)}if(null===r||""===r)if(""===e.style.height)e.height=e.width/(t.options.aspectRatio||2);else{var o=Sn(e,"height");void 0!==a&&(e.height=o)}return e}var Cn=!!function(){var e=!1;try{var t=Object.defineProperty({},"passive",{get:function(){e=!0}});window.addEventListener("e",null,t)}catch(n){}return e}()&&{passive:!0};function En(e,t,n){e.addEventListener(t,n,Cn)}function On(e,t,n){e.removeEventListener(t,n,Cn)}function Pn(e,t,n,r,i){return{type:e,chart:t,native:i||null,x:void 0!==n?n:null,y:void 0!==r?r:null}}function Tn(e,t){var n=kn[e.type]||e.type,r=Be.getRelativePosition(e,t);return Pn(n,t,r.x,r.y,e)}function Dn(e,t){var n=!1,r=[];return function(){r=Array.prototype.slice.call(arguments),t=t||this,n||(n=!0,Be.requestAnimFrame.call(window,(function(){n=!1,e.apply(t,r)})))}}function Nn(e){var t=document.createElement("div");return t.className=e||"",t}function Rn(e){var t=1e6,n=Nn(bn),r=Nn(bn+"-expand"),i=Nn(bn+"-shrink");r.appendChild(Nn()),i.appendChild(Nn()),n.appendChild(r),n.appendChild(i),n._reset=function(){r.scrollLeft=t,r.scrollTop=t,i.scrollLeft=t,i.scrollTop=t};var a=function(){n._reset(),e()};return En(r,"scroll",a.bind(r,"expand")),En(i,"scroll",a.bind(i,"shrink")),n}function An(e,t){var n=e[vn]||(e[vn]={}),r=n.renderProxy=function(e){e.animationName===wn&&t()};Be.each(_n,(function(t){En(e,t,r)})),n.reflow=!!e.offsetParent,e.classList.add(xn)}function In(e){var t=e[vn]||{},n=t.renderProxy;n&&(Be.each(_n,(function(t){On(e,t,n)})),delete t.renderProxy),e.classList.remove(xn)}function Ln(e,t,n){var r=e[vn]||(e[vn]={}),i=r.resizer=Rn(Dn((function(){if(r.resizer){var i=n.options.maintainAspectRatio&&e.parentNode,a=i?i.clientWidth:0;t(Pn("resize",n)),i&&i.clientWidth<a&&n.canvas&&t(Pn("resize",n))}})));An(e,(function(){if(r.resizer){var t=e.parentNode;t&&t!==i.parentNode&&t.insertBefore(i,t.firstChild),i._reset()}}))}function jn(e){var t=e[vn]||{},n=t.resizer;delete t.resizer,In(e),n&&n.parentNode&&n.parentNode.removeChild(n)}function Fn(e,t){var n=e._style||document.createElement("style");e._style||(e._style=n,t="/* Chart.js */\n"+t,n.setAttribute("type","text/css"),document.getElementsByTagName("head")[0].appendChild(n)),n.appendChild(document.createTextNode(t))}var zn={disableCSSInjection:!1,_enabled:"undefined"!==typeof window&&"undefined"!==typeof document,_ensureLoaded:function(){this._loaded||(this._loaded=!0,this.disableCSSInjection||Fn(this,mn))},acquireContext:function(e,t){"string"===typeof e?e=document.getElementById(e):e.length&&(e=e[0]),e&&e.canvas&&(e=e.canvas);var n=e&&e.getContext&&e.getContext("2d");return this._ensureLoaded(),n&&n.canvas===e?(Mn(e,t),n):null},releaseContext:function(e){var t=e.canvas;if(t[vn]){var n=t[vn].initial;["height","width"].forEach((function(e){var r=n[e];Be.isNullOrUndef(r)?t.removeAttribute(e):t.setAttribute(e,r)})),Be.each(n.style||{},(function(e,n){t.style[n]=e})),t.width=t.width,delete t[vn]}},addEventListener:function(e,t,n){var r=e.canvas;if("resize"!==t){var i=n[vn]||(n[vn]={});En(r,t,(i.proxies||(i.proxies={}))[e.id+"_"+t]=function(t){n(Tn(t,e))})}else Ln(r,n,e)},removeEventListener:function(e,t,n){var r=e.canvas;if("resize"!==t){var i=((n[vn]||{}).proxies||{})[e.id+"_"+t];i&&On(r,t,i)}else jn(r)}};Be.addEvent=En,Be.removeEvent=On;var Wn=zn._enabled?zn:hn,Yn=Be.extend({initialize:function(){},acquireContext:function(){},releaseContext:function(){},addEventListener:function(){},removeEventListener:function(){}},Wn);Ye._set("global",{plugins:{}});var Hn={_plugins:[],_cacheId:0,register:function(e){var t=this._plugins;[].concat(e).forEach((function(e){-1===t.indexOf(e)&&t.push(e)})),this._cacheId++},unregister:function(e){var t=this._plugins;[].concat(e).forEach((function(e){var n=t.indexOf(e);-1!==n&&t.splice(n,1)})),this._cacheId++},clear:function(){this._plugins=[],this._cacheId++},count:function(){return this._plugins.length},getAll:function(){return this._plugins},notify:function(e,t,n){var r,i,a,o,l,s=this.descriptors(e),u=s.length;for(r=0;r<u;++r)if("function"===typeof(l=(a=(i=s[r]).plugin)[t])&&((o=[e].concat(n||[])).push(i.options),!1===l.apply(a,o)))return!1;return!0},descriptors:function(e){var t=e.$plugins||(e.$plugins={});if(t.id===this._cacheId)return t.descriptors;var n=[],r=[],i=e&&e.config||{},a=i.options&&i.options.plugins||{};return this._plugins.concat(i.plugins||[]).forEach((function(e){if(-1===n.indexOf(e)){var t=e.id,i=a[t];!1!==i&&(!0===i&&(i=Be.clone(Ye.global.plugins[t])),n.push(e),r.push({plugin:e,options:i||{}}))}})),t.descriptors=r,t.id=this._cacheId,r},_invalidate:function(e){delete e.$plugins}},Un={constructors:{},defaults:{},registerScaleType:function(e,t,n){this.constructors[e]=t,this.defaults[e]=Be.clone(n)},getScaleConstructor:function(e){return this.constructors.hasOwnProperty(e)?this.constructors[e]:void 0},getScaleDefaults:function(e){return this.defaults.hasOwnProperty(e)?Be.merge({},[Ye.scale,this.defaults[e]]):{}},updateScaleDefaults:function(e,t){var n=this;n.defaults.hasOwnProperty(e)&&(n.defaults[e]=Be.extend(n.defaults[e],t))},addScalesToLayout:function(e){Be.each(e.scales,(function(t){t.fullWidth=t.options.fullWidth,t.position=t.options.position,t.weight=t.options.weight,fn.addBox(e,t)}))}},Vn=Be.valueOrDefault;Ye._set("global",{tooltips:{enabled:!0,custom:null,mode:"nearest",position:"average",intersect:!0,backgroundColor:"rgba(0,0,0,0.8)",titleFontStyle:"bold",titleSpacing:2,titleMarginBottom:6,titleFontColor:"#fff",titleAlign:"left",bodySpacing:2,bodyFontColor:"#fff",bodyAlign:"left",footerFontStyle:"bold",footerSpacing:2,footerMarginTop:6,footerFontColor:"#fff",footerAlign:"left",yPadding:6,xPadding:6,caretPadding:2,caretSize:5,cornerRadius:6,multiKeyBackground:"#fff",displayColors:!0,borderColor:"rgba(0,0,0,0)",borderWidth:0,callbacks:{beforeTitle:Be.noop,title:function(e,t){var n="",r=t.labels,i=r?r.length:0;if(e.length>0){var a=e[0];a.label?n=a.label:a.xLabel?n=a.xLabel:i>0&&a.index<i&&(n=r[a.index])}return n},afterTitle:Be.noop,beforeBody:Be.noop,beforeLabel:Be.noop,label:function(e,t){var n=t.datasets[e.datasetIndex].label||"";return n&&(n+=": "),Be.isNullOrUndef(e.value)?n+=e.yLabel:n+=e.value,n},labelColor:function(e,t){var n=t.getDatasetMeta(e.datasetIndex).data[e.index]._view;return{borderColor:n.borderColor,backgroundColor:n.backgroundColor}},labelTextColor:function(){return this._options.bodyFontColor},afterLabel:Be.noop,afterBody:Be.noop,beforeFooter:Be.noop,footer:Be.noop,afterFooter:Be.noop}}});var Bn={average:function(e){if(!e.length)return!1;var t,n,r=0,i=0,a=0;for(t=0,n=e.length;t<n;++t){var o=e[t];if(o&&o.hasValue()){var l=o.tooltipPosition();r+=l.x,i+=l.y,++a}}return{x:r/a,y:i/a}},nearest:function(e,t){var n,r,i,a=t.x,o=t.y,l=Number.POSITIVE_INFINITY;for(n=0,r=e.length;n<r;++n){var s=e[n];if(s&&s.hasValue()){var u=s.getCenterPoint(),c=Be.distanceBetweenPoints(t,u);c<l&&(l=c,i=s)}}if(i){var d=i.tooltipPosition();a=d.x,o=d.y}return{x:a,y:o}}};function $n(e,t){return t&&(Be.isArray(t)?Array.prototype.push.apply(e,t):e.push(t)),e}function Xn(e){return("string"===typeof e||e instanceof String)&&e.indexOf("\n")>-1?e.split("\n"):e}function qn(e){var t=e._xScale,n=e._yScale||e._scale,r=e._index,i=e._datasetIndex,a=e._chart.getDatasetMeta(i).controller,o=a._getIndexScale(),l=a._getValueScale();return{xLabel:t?t.getLabelForIndex(r,i):"",yLabel:n?n.getLabelForIndex(r,i):"",label:o?""+o.getLabelForIndex(r,i):"",value:l?""+l.getLabelForIndex(r,i):"",index:r,datasetIndex:i,x:e._model.x,y:e._model.y}}function Gn(e){var t=Ye.global;return{xPadding:e.xPadding,yPadding:e.yPadding,xAlign:e.xAlign,yAlign:e.yAlign,bodyFontColor:e.bodyFontColor,_bodyFontFamily:Vn(e.bodyFontFamily,t.defaultFontFamily),_bodyFontStyle:Vn(e.bodyFontStyle,t.defaultFontStyle),_bodyAlign:e.bodyAlign,bodyFontSize:Vn(e.bodyFontSize,t.defaultFontSize),bodySpacing:e.bodySpacing,titleFontColor:e.titleFontColor,_titleFontFamily:Vn(e.titleFontFamily,t.defaultFontFamily),_titleFontStyle:Vn(e.titleFontStyle,t.defaultFontStyle),titleFontSize:Vn(e.titleFontSize,t.defaultFontSize),_titleAlign:e.titleAlign,titleSpacing:e.titleSpacing,titleMarginBottom:e.titleMarginBottom,footerFontColor:e.footerFontColor,_footerFontFamily:Vn(e.footerFontFamily,t.defaultFontFamily),_footerFontStyle:Vn(e.footerFontStyle,t.defaultFontStyle),footerFontSize:Vn(e.footerFontSize,t.defaultFontSize),_footerAlign:e.footerAlign,footerSpacing:e.footerSpacing,footerMarginTop:e.footerMarginTop,caretSize:e.caretSize,cornerRadius:e.cornerRadius,backgroundColor:e.backgroundColor,opacity:0,legendColorBackground:e.multiKeyBackground,displayColors:e.displayColors,borderColor:e.borderColor,borderWidth:e.borderWidth}}function Kn(e,t){var n=e._chart.ctx,r=2*t.yPadding,i=0,a=t.body,o=a.reduce((function(e,t){return e+t.before.length+t.lines.length+t.after.length}),0);o+=t.beforeBody.length+t.afterBody.length;var l=t.title.length,s=t.footer.length,u=t.titleFontSize,c=t.bodyFontSize,d=t.footerFontSize;r+=l*u,r+=l?(l-1)*t.titleSpacing:0,r+=l?t.titleMarginBottom:0,r+=o*c,r+=o?(o-1)*t.bodySpacing:0,r+=s?t.footerMarginTop:0,r+=s*d,r+=s?(s-1)*t.footerSpacing:0;var f=0,h=function(e){i=Math.max(i,n.measureText(e).width+f)};return n.font=Be.fontString(u,t._titleFontStyle,t._titleFontFamily),Be.each(t.title,h),n.font=Be.fontString(c,t._bodyFontStyle,t._bodyFontFamily),Be.each(t.beforeBody.concat(t.afterBody),h),f=t.displayColors?c+2:0,Be.each(a,(function(e){Be.each(e.before,h),Be.each(e.lines,h),Be.each(e.after,h)})),f=0,n.font=Be.fontString(d,t._footerFontStyle,t._footerFontFamily),Be.each(t.footer,h),{width:i+=2*t.xPadding,height:r}}function Qn(e,t){var n,r,i,a,o,l=e._model,s=e._chart,u=e._chart.chartArea,c="center",d="center";l.y<t.height?d="top":l.y>s.height-t.height&&(d="bottom");var f=(u.left+u.right)/2,h=(u.top+u.bottom)/2;"center"===d?(n=function(e){return e<=f},r=function(e){return e>f}):(n=function(e){return e<=t.width/2},r=function(e){return e>=s.width-t.width/2}),i=function(e){return e+t.width+l.caretSize+l.caretPadding>s.width},a=function(e){return e-t.width-l.caretSize-l.caretPadding<0},o=function(e){return e<=h?"top":"bottom"},n(l.x)?(c="left",i(l.x)&&(c="center",d=o(l.y))):r(l.x)&&(c="right",a(l.x)&&(c="center",d=o(l.y)));var p=e._options;return{xAlign:p.xAlign?p.xAlign:c,yAlign:p.yAlign?p.yAlign:d}}function Zn(e,t,n,r){var i=e.x,a=e.y,o=e.caretSize,l=e.caretPadding,s=e.cornerRadius,u=n.xAlign,c=n.yAlign,d=o+l,f=s+l;return"right"===u?i-=t.width:"center"===u&&((i-=t.width/2)+t.width>r.width&&(i=r.width-t.width),i<0&&(i=0)),"top"===c?a+=d:a-="bottom"===c?t.height+d:t.height/2,"center"===c?"left"===u?i+=d:"right"===u&&(i-=d):"left"===u?i-=f:"right"===u&&(i+=f),{x:i,y:a}}function Jn(e,t){return"center"===t?e.x+e.width/2:"right"===t?e.x+e.width-e.xPadding:e.x+e.xPadding}function er(e){return $n([],Xn(e))}var tr=Qe.extend({initialize:function(){this._model=Gn(this._options),this._lastActive=[]},getTitle:function(){var e=this,t=e._options.callbacks,n=t.beforeTitle.apply(e,arguments),r=t.title.apply(e,arguments),i=t.afterTitle.apply(e,arguments),a=[];return a=$n(a,Xn(n)),a=$n(a,Xn(r)),a=$n(a,Xn(i))},getBeforeBody:function(){return er(this._options.callbacks.beforeBody.apply(this,arguments))},getBody:function(e,t){var n=this,r=n._options.callbacks,i=[];return Be.each(e,(function(e){var a={before:[],lines:[],after:[]};$n(a.before,Xn(r.beforeLabel.call(n,e,t))),$n(a.lines,r.label.call(n,e,t)),$n(a.after,Xn(r.afterLabel.call(n,e,t))),i.push(a)})),i},getAfterBody:function(){return er(this._options.callbacks.afterBody.apply(this,arguments))},getFooter:function(){var e=this,t=e._options.callbacks,n=t.beforeFooter.apply(e,arguments),r=t.footer.apply(e,arguments),i=t.afterFooter.apply(e,arguments),a=[];return a=$n(a,Xn(n)),a=$n(a,Xn(r)),a=$n(a,Xn(i))},update:function(e){var t,n,r=this,i=r._options,a=r._model,o=r._model=Gn(i),l=r._active,s=r._data,u={xAlign:a.xAlign,yAlign:a.yAlign},c={x:a.x,y:a.y},d={width:a.width,height:a.height},f={x:a.caretX,y:a.caretY};if(l.length){o.opacity=1;var h=[],p=[];f=Bn[i.position].call(r,l,r._eventPosition);var g=[];for(t=0,n=l.length;t<n;++t)g.push(qn(l[t]));i.filter&&(g=g.filter((function(e){return i.filter(e,s)}))),i.itemSort&&(g=g.sort((function(e,t){return i.itemSort(e,t,s)}))),Be.each(g,(function(e){h.push(i.callbacks.labelColor.call(r,e,r._chart)),p.push(i.callbacks.labelTextColor.call(r,e,r._chart))})),o.title=r.getTitle(g,s),o.beforeBody=r.getBeforeBody(g,s),o.body=r.getBody(g,s),o.afterBody=r.getAfterBody(g,s),o.footer=r.getFooter(g,s),o.x=f.x,o.y=f.y,o.caretPadding=i.caretPadding,o.labelColors=h,o.labelTextColors=p,o.dataPoints=g,c=Zn(o,d=Kn(this,o),u=Qn(this,d),r._chart)}else o.opacity=0;return o.xAlign=u.xAlign,o.yAlign=u.yAlign,o.x=c.x,o.y=c.y,o.width=d.width,o.height=d.height,o.caretX=f.x,o.caretY=f.y,r._model=o,e&&i.custom&&i.custom.call(r,o),r},drawCaret:function(e,t){var n=this._chart.ctx,r=this._view,i=this.getCaretPosition(e,t,r);n.lineTo(i.x1,i.y1),n.lineTo(i.x2,i.y2),n.lineTo(i.x3,i.y3)},getCaretPosition:function(e,t,n){var r,i,a,o,l,s,u=n.caretSize,c=n.cornerRadius,d=n.xAlign,f=n.yAlign,h=e.x,p=e.y,g=t.width,m=t.height;if("center"===f)l=p+m/2,"left"===d?(i=(r=h)-u,a=r,o=l+u,s=l-u):(i=(r=h+g)+u,a=r,o=l-u,s=l+u);else if("left"===d?(r=(i=h+c+u)-u,a=i+u):"right"===d?(r=(i=h+g-c-u)-u,a=i+u):(r=(i=n.caretX)-u,a=i+u),"top"===f)l=(o=p)-u,s=o;else{l=(o=p+m)+u,s=o;var v=a;a=r,r=v}return{x1:r,x2:i,x3:a,y1:o,y2:l,y3:s}},drawTitle:function(e,t,n){var r=t.title;if(r.length){e.x=Jn(t,t._titleAlign),n.textAlign=t._titleAlign,n.textBaseline="top";var i,a,o=t.titleFontSize,l=t.titleSpacing;for(n.fillStyle=t.titleFontColor,n.font=Be.fontString(o,t._titleFontStyle,t._titleFontFamily),i=0,a=r.length;i<a;++i)n.fillText(r[i],e.x,e.y),e.y+=o+l,i+1===r.length&&(e.y+=t.titleMarginBottom-l)}},drawBody:function(e,t,n){var r,i=t.bodyFontSize,a=t.bodySpacing,o=t._bodyAlign,l=t.body,s=t.displayColors,u=t.labelColors,c=0,d=s?Jn(t,"left"):0;n.textAlign=o,n.textBaseline="top",n.font=Be.fontString(i,t._bodyFontStyle,t._bodyFontFamily),e.x=Jn(t,o);var f=function(t){n.fillText(t,e.x+c,e.y),e.y+=i+a};n.fillStyle=t.bodyFontColor,Be.each(t.beforeBody,f),c=s&&"right"!==o?"center"===o?i/2+1:i+2:0,Be.each(l,(function(a,o){r=t.labelTextColors[o],n.fillStyle=r,Be.each(a.before,f),Be.each(a.lines,(function(a){s&&(n.fillStyle=t.legendColorBackground,n.fillRect(d,e.y,i,i),n.lineWidth=1,n.strokeStyle=u[o].borderColor,n.strokeRect(d,e.y,i,i),n.fillStyle=u[o].backgroundColor,n.fillRect(d+1,e.y+1,i-2,i-2),n.fillStyle=r),f(a)})),Be.each(a.after,f)})),c=0,Be.each(t.afterBody,f),e.y-=a},drawFooter:function(e,t,n){var r=t.footer;r.length&&(e.x=Jn(t,t._footerAlign),e.y+=t.footerMarginTop,n.textAlign=t._footerAlign,n.textBaseline="top",n.fillStyle=t.footerFontColor,n.font=Be.fontString(t.footerFontSize,t._footerFontStyle,t._footerFontFamily),Be.each(r,(function(r){n.fillText(r,e.x,e.y),e.y+=t.footerFontSize+t.footerSpacing})))},drawBackground:function(e,t,n,r){n.fillStyle=t.backgroundColor,n.strokeStyle=t.borderColor,n.lineWidth=t.borderWidth;var i=t.xAlign,a=t.yAlign,o=e.x,l=e.y,s=r.width,u=r.height,c=t.cornerRadius;n.beginPath(),n.moveTo(o+c,l),"top"===a&&this.drawCaret(e,r),n.lineTo(o+s-c,l),n.quadraticCurveTo(o+s,l,o+s,l+c),"center"===a&&"right"===i&&this.drawCaret(e,r),n.lineTo(o+s,l+u-c),n.quadraticCurveTo(o+s,l+u,o+s-c,l+u),"bottom"===a&&this.drawCaret(e,r),n.lineTo(o+c,l+u),n.quadraticCurveTo(o,l+u,o,l+u-c),"center"===a&&"left"===i&&this.drawCaret(e,r),n.lineTo(o,l+c),n.quadraticCurveTo(o,l,o+c,l),n.closePath(),n.fill(),t.borderWidth>0&&n.stroke()},draw:function(){var e=this._chart.ctx,t=this._view;if(0!==t.opacity){var n={width:t.width,height:t.height},r={x:t.x,y:t.y},i=Math.abs(t.opacity<.001)?0:t.opacity,a=t.title.length||t.beforeBody.length||t.body.length||t.afterBody.length||t.footer.length;this._options.enabled&&a&&(e.save(),e.globalAlpha=i,this.drawBackground(r,t,e,n),r.y+=t.yPadding,this.drawTitle(r,t,e),this.drawBody(r,t,e),this.drawFooter(r,t,e),e.restore())}},handleEvent:function(e){var t=this,n=t._options,r=!1;return t._lastActive=t._lastActive||[],"mouseout"===e.type?t._active=[]:t._active=t._chart.getElementsAtEventForMode(e,n.mode,n),(r=!Be.arrayEquals(t._active,t._lastActive))&&(t._lastActive=t._active,(n.enabled||n.custom)&&(t._eventPosition={x:e.x,y:e.y},t.update(!0),t.pivot())),r}}),nr=Bn,rr=tr;rr.positioners=nr;var ir=Be.valueOrDefault;function ar(){return Be.merge({},[].slice.call(arguments),{merger:function(e,t,n,r){if("xAxes"===e||"yAxes"===e){var i,a,o,l=n[e].length;for(t[e]||(t[e]=[]),i=0;i<l;++i)o=n[e][i],a=ir(o.type,"xAxes"===e?"category":"linear"),i>=t[e].length&&t[e].push({}),!t[e][i].type||o.type&&o.type!==t[e][i].type?Be.merge(t[e][i],[Un.getScaleDefaults(a),o]):Be.merge(t[e][i],o)}else Be._merger(e,t,n,r)}})}function or(){return Be.merge({},[].slice.call(arguments),{merger:function(e,t,n,r){var i=t[e]||{},a=n[e];"scales"===e?t[e]=ar(i,a):"scale"===e?t[e]=Be.merge(i,[Un.getScaleDefaults(a.type),a]):Be._merger(e,t,n,r)}})}function lr(e){var t=(e=e||{}).data=e.data||{};return t.datasets=t.datasets||[],t.labels=t.labels||[],e.options=or(Ye.global,Ye[e.type],e.options||{}),e}function sr(e){var t=e.options;Be.each(e.scales,(function(t){fn.removeBox(e,t)})),t=or(Ye.global,Ye[e.config.type],t),e.options=e.config.options=t,e.ensureScalesHaveIDs(),e.buildOrUpdateScales(),e.tooltip._options=t.tooltips,e.tooltip.initialize()}function ur(e){return"top"===e||"bottom"===e}Ye._set("global",{elements:{},events:["mousemove","mouseout","click","touchstart","touchmove"],hover:{onHover:null,mode:"nearest",intersect:!0,animationDuration:400},onClick:null,maintainAspectRatio:!0,responsive:!0,responsiveAnimationDuration:0});var cr=function(e,t){return this.construct(e,t),this};Be.extend(cr.prototype,{construct:function(e,t){var n=this;t=lr(t);var r=Yn.acquireContext(e,t),i=r&&r.canvas,a=i&&i.height,o=i&&i.width;n.id=Be.uid(),n.ctx=r,n.canvas=i,n.config=t,n.width=o,n.height=a,n.aspectRatio=a?o/a:null,n.options=t.options,n._bufferedRender=!1,n.chart=n,n.controller=n,cr.instances[n.id]=n,Object.defineProperty(n,"data",{get:function(){return n.config.data},set:function(e){n.config.data=e}}),r&&i?(n.initialize(),n.update()):console.error("Failed to create chart: can't acquire context from the given item")},initialize:function(){var e=this;return Hn.notify(e,"beforeInit"),Be.retinaScale(e,e.options.devicePixelRatio),e.bindEvents(),e.options.responsive&&e.resize(!0),e.ensureScalesHaveIDs(),e.buildOrUpdateScales(),e.initToolTip(),Hn.notify(e,"afterInit"),e},clear:function(){return Be.canvas.clear(this),this},stop:function(){return et.cancelAnimation(this),this},resize:function(e){var t=this,n=t.options,r=t.canvas,i=n.maintainAspectRatio&&t.aspectRatio||null,a=Math.max(0,Math.floor(Be.getMaximumWidth(r))),o=Math.max(0,Math.floor(i?a/i:Be.getMaximumHeight(r)));if((t.width!==a||t.height!==o)&&(r.width=t.width=a,r.height=t.height=o,r.style.width=a+"px",r.style.height=o+"px",Be.retinaScale(t,n.devicePixelRatio),!e)){var l={width:a,height:o};Hn.notify(t,"resize",[l]),n.onResize&&n.onResize(t,l),t.stop(),t.update({duration:n.responsiveAnimationDuration})}},ensureScalesHaveIDs:function(){var e=this.options,t=e.scales||{},n=e.scale;Be.each(t.xAxes,(function(e,t){e.id=e.id||"x-axis-"+t})),Be.each(t.yAxes,(function(e,t){e.id=e.id||"y-axis-"+t})),n&&(n.id=n.id||"scale")},buildOrUpdateScales:function(){var e=this,t=e.options,n=e.scales||{},r=[],i=Object.keys(n).reduce((function(e,t){return e[t]=!1,e}),{});t.scales&&(r=r.concat((t.scales.xAxes||[]).map((function(e){return{options:e,dtype:"category",dposition:"bottom"}})),(t.scales.yAxes||[]).map((function(e){return{options:e,dtype:"linear",dposition:"left"}})))),t.scale&&r.push({options:t.scale,dtype:"radialLinear",isDefault:!0,dposition:"chartArea"}),Be.each(r,(function(t){var r=t.options,a=r.id,o=ir(r.type,t.dtype);ur(r.position)!==ur(t.dposition)&&(r.position=t.dposition),i[a]=!0;var l=null;if(a in n&&n[a].type===o)(l=n[a]).options=r,l.ctx=e.ctx,l.chart=e;else{var s=Un.getScaleConstructor(o);if(!s)return;l=new s({id:a,type:o,options:r,ctx:e.ctx,chart:e}),n[l.id]=l}l.mergeTicksOptions(),t.isDefault&&(e.scale=l)})),Be.each(i,(function(e,t){e||delete n[t]})),e.scales=n,Un.addScalesToLayout(this)},buildOrUpdateControllers:function(){var e=this,t=[];return Be.each(e.data.datasets,(function(n,r){var i=e.getDatasetMeta(r),a=n.type||e.config.type;if(i.type&&i.type!==a&&(e.destroyDatasetMeta(r),i=e.getDatasetMeta(r)),i.type=a,i.controller)i.controller.updateIndex(r),i.controller.linkScales();else{var o=Jt[i.type];if(void 0===o)throw new Error('"'+i.type+'" is not a chart type.');i.controller=new o(e,r),t.push(i.controller)}}),e),t},resetElements:function(){var e=this;Be.each(e.data.datasets,(function(t,n){e.getDatasetMeta(n).controller.reset()}),e)},reset:function(){this.resetElements(),this.tooltip.initialize()},update:function(e){var t=this;if(e&&"object"===typeof e||(e={duration:e,lazy:arguments[1]}),sr(t),Hn._invalidate(t),!1!==Hn.notify(t,"beforeUpdate")){t.tooltip._data=t.data;var n=t.buildOrUpdateControllers();Be.each(t.data.datasets,(function(e,n){t.getDatasetMeta(n).controller.buildOrUpdateElements()}),t),t.updateLayout(),t.options.animation&&t.options.animation.duration&&Be.each(n,(function(e){e.reset()})),t.updateDatasets(),t.tooltip.initialize(),t.lastActive=[],Hn.notify(t,"afterUpdate"),t._bufferedRender?t._bufferedRequest={duration:e.duration,easing:e.easing,lazy:e.lazy}:t.render(e)}},updateLayout:function(){var e=this;!1!==Hn.notify(e,"beforeLayout")&&(fn.update(this,this.width,this.height),Hn.notify(e,"afterScaleUpdate"),Hn.notify(e,"afterLayout"))},updateDatasets:function(){var e=this;if(!1!==Hn.notify(e,"beforeDatasetsUpdate")){for(var t=0,n=e.data.datasets.length;t<n;++t)e.updateDataset(t);Hn.notify(e,"afterDatasetsUpdate")}},updateDataset:function(e){var t=this,n=t.getDatasetMeta(e),r={meta:n,index:e};!1!==Hn.notify(t,"beforeDatasetUpdate",[r])&&(n.controller.update(),Hn.notify(t,"afterDatasetUpdate",[r]))},render:function(e){var t=this;e&&"object"===typeof e||(e={duration:e,lazy:arguments[1]});var n=t.options.animation,r=ir(e.duration,n&&n.duration),i=e.lazy;if(!1!==Hn.notify(t,"beforeRender")){var a=function(e){Hn.notify(t,"afterRender"),Be.callback(n&&n.onComplete,[e],t)};if(n&&r){var o=new Je({numSteps:r/16.66,easing:e.easing||n.easing,render:function(e,t){var n=Be.easing.effects[t.easing],r=t.currentStep,i=r/t.numSteps;e.draw(n(i),i,r)},onAnimationProgress:n.onProgress,onAnimationComplete:a});et.addAnimation(t,o,r,i)}else t.draw(),a(new Je({numSteps:0,chart:t}));return t}},draw:function(e){var t=this;t.clear(),Be.isNullOrUndef(e)&&(e=1),t.transition(e),t.width<=0||t.height<=0||!1!==Hn.notify(t,"beforeDraw",[e])&&(Be.each(t.boxes,(function(e){e.draw(t.chartArea)}),t),t.drawDatasets(e),t._drawTooltip(e),Hn.notify(t,"afterDraw",[e]))},transition:function(e){for(var t=this,n=0,r=(t.data.datasets||[]).length;n<r;++n)t.isDatasetVisible(n)&&t.getDatasetMeta(n).controller.transition(e);t.tooltip.transition(e)},drawDatasets:function(e){var t=this;if(!1!==Hn.notify(t,"beforeDatasetsDraw",[e])){for(var n=(t.data.datasets||[]).length-1;n>=0;--n)t.isDatasetVisible(n)&&t.drawDataset(n,e);Hn.notify(t,"afterDatasetsDraw",[e])}},drawDataset:function(e,t){var n=this,r=n.getDatasetMeta(e),i={meta:r,index:e,easingValue:t};!1!==Hn.notify(n,"beforeDatasetDraw",[i])&&(r.controller.draw(t),Hn.notify(n,"afterDatasetDraw",[i]))},_drawTooltip:function(e){var t=this,n=t.tooltip,r={tooltip:n,easingValue:e};!1!==Hn.notify(t,"beforeTooltipDraw",[r])&&(n.draw(),Hn.notify(t,"afterTooltipDraw",[r]))},getElementAtEvent:function(e){return ln.modes.single(this,e)},getElementsAtEvent:function(e){return ln.modes.label(this,e,{intersect:!0})},getElementsAtXAxis:function(e){return ln.modes["x-axis"](this,e,{intersect:!0})},getElementsAtEventForMode:function(e,t,n){var r=ln.modes[t];return"function"===typeof r?r(this,e,n):[]},getDatasetAtEvent:function(e){return ln.modes.dataset(this,e,{intersect:!0})},getDatasetMeta:function(e){var t=this,n=t.data.datasets[e];n._meta||(n._meta={});var r=n._meta[t.id];return r||(r=n._meta[t.id]={type:null,data:[],dataset:null,controller:null,hidden:null,xAxisID:null,yAxisID:null}),r},getVisibleDatasetCount:function(){for(var e=0,t=0,n=this.data.datasets.length;t<n;++t)this.isDatasetVisible(t)&&e++;return e},isDatasetVisible:function(e){var t=this.getDatasetMeta(e);return"boolean"===typeof t.hidden?!t.hidden:!this.data.datasets[e].hidden},generateLegend:function(){return this.options.legendCallback(this)},destroyDatasetMeta:function(e){var t=this.id,n=this.data.datasets[e],r=n._meta&&n._meta[t];r&&(r.controller.destroy(),delete n._meta[t])},destroy:function(){var e,t,n=this,r=n.canvas;for(n.stop(),e=0,t=n.data.datasets.length;e<t;++e)n.destroyDatasetMeta(e);r&&(n.unbindEvents(),Be.canvas.clear(n),Yn.releaseContext(n.ctx),n.canvas=null,n.ctx=null),Hn.notify(n,"destroy"),delete cr.instances[n.id]},toBase64Image:function(){return this.canvas.toDataURL.apply(this.canvas,arguments)},initToolTip:function(){var e=this;e.tooltip=new rr({_chart:e,_chartInstance:e,_data:e.data,_options:e.options.tooltips},e)},bindEvents:function(){var e=this,t=e._listeners={},n=function(){e.eventHandler.apply(e,arguments)};Be.each(e.options.events,(function(r){Yn.addEventListener(e,r,n),t[r]=n})),e.options.responsive&&(n=function(){e.resize()},Yn.addEventListener(e,"resize",n),t.resize=n)},unbindEvents:function(){var e=this,t=e._listeners;t&&(delete e._listeners,Be.each(t,(function(t,n){Yn.removeEventListener(e,n,t)})))},updateHoverStyle:function(e,t,n){var r,i,a,o=n?"setHoverStyle":"removeHoverStyle";for(i=0,a=e.length;i<a;++i)(r=e[i])&&this.getDatasetMeta(r._datasetIndex).controller[o](r)},eventHandler:function(e){var t=this,n=t.tooltip;if(!1!==Hn.notify(t,"beforeEvent",[e])){t._bufferedRender=!0,t._bufferedRequest=null;var r=t.handleEvent(e);n&&(r=n._start?n.handleEvent(e):r|n.handleEvent(e)),Hn.notify(t,"afterEvent",[e]);var i=t._bufferedRequest;return i?t.render(i):r&&!t.animating&&(t.stop(),t.render({duration:t.options.hover.animationDuration,lazy:!0})),t._bufferedRender=!1,t._bufferedRequest=null,t}},handleEvent:function(e){var t=this,n=t.options||{},r=n.hover,i=!1;return t.lastActive=t.lastActive||[],"mouseout"===e.type?t.active=[]:t.active=t.getElementsAtEventForMode(e,r.mode,r),Be.callback(n.onHover||n.hover.onHover,[e.native,t.active],t),"mouseup"!==e.type&&"click"!==e.type||n.onClick&&n.onClick.call(t,e.native,t.active),t.lastActive.length&&t.updateHoverStyle(t.lastActive,r.mode,!1),t.active.length&&r.mode&&t.updateHoverStyle(t.active,r.mode,!0),i=!Be.arrayEquals(t.active,t.lastActive),t.lastActive=t.active,i}}),cr.instances={};var dr=cr;cr.Controller=cr,cr.types={},Be.configMerge=or,Be.scaleMerge=ar;var fr=function(){function e(e,t,n){var r;return"string"===typeof e?(r=parseInt(e,10),-1!==e.indexOf("%")&&(r=r/100*t.parentNode[n])):r=e,r}function t(e){return void 0!==e&&null!==e&&"none"!==e}function n(n,r,i){var a=document.defaultView,o=Be._getParentNode(n),l=a.getComputedStyle(n)[r],s=a.getComputedStyle(o)[r],u=t(l),c=t(s),d=Number.POSITIVE_INFINITY;return u||c?Math.min(u?e(l,n,i):d,c?e(s,o,i):d):"none"}Be.where=function(e,t){if(Be.isArray(e)&&Array.prototype.filter)return e.filter(t);var n=[];return Be.each(e,(function(e){t(e)&&n.push(e)})),n},Be.findIndex=Array.prototype.findIndex?function(e,t,n){return e.findIndex(t,n)}:function(e,t,n){n=void 0===n?e:n;for(var r=0,i=e.length;r<i;++r)if(t.call(n,e[r],r,e))return r;return-1},Be.findNextWhere=function(e,t,n){Be.isNullOrUndef(n)&&(n=-1);for(var r=n+1;r<e.length;r++){var i=e[r];if(t(i))return i}},Be.findPreviousWhere=function(e,t,n){Be.isNullOrUndef(n)&&(n=e.length);for(var r=n-1;r>=0;r--){var i=e[r];if(t(i))return i}},Be.isNumber=function(e){return!isNaN(parseFloat(e))&&isFinite(e)},Be.almostEquals=function(e,t,n){return Math.abs(e-t)<n},Be.almostWhole=function(e,t){var n=Math.round(e);return n-t<e&&n+t>e},Be.max=function(e){return e.reduce((function(e,t){return isNaN(t)?e:Math.max(e,t)}),Number.NEGATIVE_INFINITY)},Be.min=function(e){return e.reduce((function(e,t){return isNaN(t)?e:Math.min(e,t)}),Number.POSITIVE_INFINITY)},Be.sign=Math.sign?function(e){return Math.sign(e)}:function(e){return 0===(e=+e)||isNaN(e)?e:e>0?1:-1},Be.log10=Math.log10?function(e){return Math.log10(e)}:function(e){var t=Math.log(e)*Math.LOG10E,n=Math.round(t);return e===Math.pow(10,n)?n:t},Be.toRadians=function(e){return e*(Math.PI/180)},Be.toDegrees=function(e){return e*(180/Math.PI)},Be._decimalPlaces=function(e){if(Be.isFinite(e)){for(var t=1,n=0;Math.round(e*t)/t!==e;)t*=10,n++;return n}},Be.getAngleFromPoint=function(e,t){var n=t.x-e.x,r=t.y-e.y,i=Math.sqrt(n*n+r*r),a=Math.atan2(r,n);return a<-.5*Math.PI&&(a+=2*Math.PI),{angle:a,distance:i}},Be.distanceBetweenPoints=function(e,t){return Math.sqrt(Math.pow(t.x-e.x,2)+Math.pow(t.y-e.y,2))},Be.aliasPixel=function(e){return e%2===0?0:.5},Be._alignPixel=function(e,t,n){var r=e.currentDevicePixelRatio,i=n/2;return Math.round((t-i)*r)/r+i},Be.splineCurve=function(e,t,n,r){var i=e.skip?t:e,a=t,o=n.skip?t:n,l=Math.sqrt(Math.pow(a.x-i.x,2)+Math.pow(a.y-i.y,2)),s=Math.sqrt(Math.pow(o.x-a.x,2)+Math.pow(o.y-a.y,2)),u=l/(l+s),c=s/(l+s),d=r*(u=isNaN(u)?0:u),f=r*(c=isNaN(c)?0:c);return{previous:{x:a.x-d*(o.x-i.x),y:a.y-d*(o.y-i.y)},next:{x:a.x+f*(o.x-i.x),y:a.y+f*(o.y-i.y)}}},Be.EPSILON=Number.EPSILON||1e-14,Be.splineCurveMonotone=function(e){var t,n,r,i,a,o,l,s,u,c=(e||[]).map((function(e){return{model:e._model,deltaK:0,mK:0}})),d=c.length;for(t=0;t<d;++t)if(!(r=c[t]).model.skip){if(n=t>0?c[t-1]:null,(i=t<d-1?c[t+1]:null)&&!i.model.skip){var f=i.model.x-r.model.x;r.deltaK=0!==f?(i.model.y-r.model.y)/f:0}!n||n.model.skip?r.mK=r.deltaK:!i||i.model.skip?r.mK=n.deltaK:this.sign(n.deltaK)!==this.sign(r.deltaK)?r.mK=0:r.mK=(n.deltaK+r.deltaK)/2}for(t=0;t<d-1;++t)r=c[t],i=c[t+1],r.model.skip||i.model.skip||(Be.almostEquals(r.deltaK,0,this.EPSILON)?r.mK=i.mK=0:(a=r.mK/r.deltaK,o=i.mK/r.deltaK,(s=Math.pow(a,2)+Math.pow(o,2))<=9||(l=3/Math.sqrt(s),r.mK=a*l*r.deltaK,i.mK=o*l*r.deltaK)));for(t=0;t<d;++t)(r=c[t]).model.skip||(n=t>0?c[t-1]:null,i=t<d-1?c[t+1]:null,n&&!n.model.skip&&(u=(r.model.x-n.model.x)/3,r.model.controlPointPreviousX=r.model.x-u,r.model.controlPointPreviousY=r.model.y-u*r.mK),i&&!i.model.skip&&(u=(i.model.x-r.model.x)/3,r.model.controlPointNextX=r.model.x+u,r.model.controlPointNextY=r.model.y+u*r.mK))},Be.nextItem=function(e,t,n){return n?t>=e.length-1?e[0]:e[t+1]:t>=e.length-1?e[e.length-1]:e[t+1]},Be.previousItem=function(e,t,n){return n?t<=0?e[e.length-1]:e[t-1]:t<=0?e[0]:e[t-1]},Be.niceNum=function(e,t){var n=Math.floor(Be.log10(e)),r=e/Math.pow(10,n);return(t?r<1.5?1:r<3?2:r<7?5:10:r<=1?1:r<=2?2:r<=5?5:10)*Math.pow(10,n)},Be.requestAnimFrame="undefined"===typeof window?function(e){e()}:window.requestAnimationFrame||window.webkitRequestAnimationFrame||window.mozRequestAnimationFrame||window.oRequestAnimationFrame||window.msRequestAnimationFrame||function(e){return window.setTimeout(e,1e3/60)},Be.getRelativePosition=function(e,t){var n,r,i=e.originalEvent||e,a=e.target||e.srcElement,o=a.getBoundingClientRect(),l=i.touches;l&&l.length>0?(n=l[0].clientX,r=l[0].clientY):(n=i.clientX,r=i.clientY);var s=parseFloat(Be.getStyle(a,"padding-left")),u=parseFloat(Be.getStyle(a,"padding-top")),c=parseFloat(Be.getStyle(a,"padding-right")),d=parseFloat(Be.getStyle(a,"padding-bottom")),f=o.right-o.left-s-c,h=o.bottom-o.top-u-d;return{x:n=Math.round((n-o.left-s)/f*a.width/t.currentDevicePixelRatio),y:r=Math.round((r-o.top-u)/h*a.height/t.currentDevicePixelRatio)}},Be.getConstraintWidth=function(e){return n(e,"max-width","clientWidth")},Be.getConstraintHeight=function(e){return n(e,"max-height","clientHeight")},Be._calculatePadding=function(e,t,n){return(t=Be.getStyle(e,t)).indexOf("%")>-1?n*parseInt(t,10)/100:parseInt(t,10)},Be._getParentNode=function(e){var t=e.parentNode;return t&&"[object ShadowRoot]"===t.toString()&&(t=t.host),t},Be.getMaximumWidth=function(e){var t=Be._getParentNode(e);if(!t)return e.clientWidth;var n=t.clientWidth,r=n-Be._calculatePadding(t,"padding-left",n)-Be._calculatePadding(t,"padding-right",n),i=Be.getConstraintWidth(e);return isNaN(i)?r:Math.min(r,i)},Be.getMaximumHeight=function(e){var t=Be._getParentNode(e);if(!t)return e.clientHeight;var n=t.clientHeight,r=n-Be._calculatePadding(t,"padding-top",n)-Be._calculatePadding(t,"padding-bottom",n),i=Be.getConstraintHeight(e);return isNaN(i)?r:Math.min(r,i)},Be.getStyle=function(e,t){return e.currentStyle?e.currentStyle[t]:document.defaultView.getComputedStyle(e,null).getPropertyValue(t)},Be.retinaScale=function(e,t){var n=e.currentDevicePixelRatio=t||"undefined"!==typeof window&&window.devicePixelRatio||1;if(1!==n){var r=e.canvas,i=e.height,a=e.width;r.height=i*n,r.width=a*n,e.ctx.scale(n,n),r.style.height||r.style.width||(r.style.height=i+"px",r.style.width=a+"px")}},Be.fontString=function(e,t,n){return t+" "+e+"px "+n},Be.longestText=function(e,t,n,r){var i=(r=r||{}).data=r.data||{},a=r.garbageCollect=r.garbageCollect||[];r.font!==t&&(i=r.data={},a=r.garbageCollect=[],r.font=t),e.font=t;var o=0;Be.each(n,(function(t){void 0!==t&&null!==t&&!0!==Be.isArray(t)?o=Be.measureText(e,i,a,o,t):Be.isArray(t)&&Be.each(t,(function(t){void 0===t||null===t||Be.isArray(t)||(o=Be.measureText(e,i,a,o,t))}))}));var l=a.length/2;if(l>n.length){for(var s=0;s<l;s++)delete i[a[s]];a.splice(0,l)}return o},Be.measureText=function(e,t,n,r,i){var a=t[i];return a||(a=t[i]=e.measureText(i).width,n.push(i)),a>r&&(r=a),r},Be.numberOfLabelLines=function(e){var t=1;return Be.each(e,(function(e){Be.isArray(e)&&e.length>t&&(t=e.length)})),t},Be.color=Ee?function(e){return e instanceof CanvasGradient&&(e=Ye.global.defaultColor),Ee(e)}:function(e){return console.error("Color.js not found!"),e},Be.getHoverColor=function(e){return e instanceof CanvasPattern||e instanceof CanvasGradient?e:Be.color(e).saturate(.5).darken(.1).rgbString()}};function hr(){throw new Error("This method is not implemented: either no adapter can be found or an incomplete integration was provided.")}function pr(e){this.options=e||{}}Be.extend(pr.prototype,{formats:hr,parse:hr,format:hr,add:hr,diff:hr,startOf:hr,endOf:hr,_create:function(e){return e}}),pr.override=function(e){Be.extend(pr.prototype,e)};var gr={_date:pr},mr={formatters:{values:function(e){return Be.isArray(e)?e:""+e},linear:function(e,t,n){var r=n.length>3?n[2]-n[1]:n[1]-n[0];Math.abs(r)>1&&e!==Math.floor(e)&&(r=e-Math.floor(e));var i=Be.log10(Math.abs(r)),a="";if(0!==e)if(Math.max(Math.abs(n[0]),Math.abs(n[n.length-1]))<1e-4){var o=Be.log10(Math.abs(e));a=e.toExponential(Math.floor(o)-Math.floor(i))}else{var l=-1*Math.floor(i);l=Math.max(Math.min(l,20),0),a=e.toFixed(l)}else a="0";return a},logarithmic:function(e,t,n){var r=e/Math.pow(10,Math.floor(Be.log10(e)));return 0===e?"0":1===r||2===r||5===r||0===t||t===n.length-1?e.toExponential():""}}},vr=Be.valueOrDefault,yr=Be.valueAtIndexOrDefault;function br(e){var t,n,r=[];for(t=0,n=e.length;t<n;++t)r.push(e[t].label);return r}function xr(e,t,n){var r=e.getPixelForTick(t);return n&&(1===e.getTicks().length?r-=e.isHorizontal()?Math.max(r-e.left,e.right-r):Math.max(r-e.top,e.bottom-r):r-=0===t?(e.getPixelForTick(1)-r)/2:(r-e.getPixelForTick(t-1))/2),r}function wr(e,t,n){return Be.isArray(t)?Be.longestText(e,n,t):e.measureText(t).width}Ye._set("scale",{display:!0,position:"left",offset:!1,gridLines:{display:!0,color:"rgba(0, 0, 0, 0.1)",lineWidth:1,drawBorder:!0,drawOnChartArea:!0,drawTicks:!0,tickMarkLength:10,zeroLineWidth:1,zeroLineColor:"rgba(0,0,0,0.25)",zeroLineBorderDash:[],zeroLineBorderDashOffset:0,offsetGridLines:!1,borderDash:[],borderDashOffset:0},scaleLabel:{display:!1,labelString:"",padding:{top:4,bottom:4}},ticks:{beginAtZero:!1,minRotation:0,maxRotation:50,mirror:!1,padding:0,reverse:!1,display:!0,autoSkip:!0,autoSkipPadding:0,labelOffset:0,callback:mr.formatters.values,minor:{},major:{}}});var _r=Qe.extend({getPadding:function(){var e=this;return{left:e.paddingLeft||0,top:e.paddingTop||0,right:e.paddingRight||0,bottom:e.paddingBottom||0}},getTicks:function(){return this._ticks},mergeTicksOptions:function(){var e=this.options.ticks;for(var t in!1===e.minor&&(e.minor={display:!1}),!1===e.major&&(e.major={display:!1}),e)"major"!==t&&"minor"!==t&&("undefined"===typeof e.minor[t]&&(e.minor[t]=e[t]),"undefined"===typeof e.major[t]&&(e.major[t]=e[t]))},beforeUpdate:function(){Be.callback(this.options.beforeUpdate,[this])},update:function(e,t,n){var r,i,a,o,l,s,u=this;for(u.beforeUpdate(),u.maxWidth=e,u.maxHeight=t,u.margins=Be.extend({left:0,right:0,top:0,bottom:0},n),u._maxLabelLines=0,u.longestLabelWidth=0,u.longestTextCache=u.longestTextCache||{},u.beforeSetDimensions(),u.setDimensions(),u.afterSetDimensions(),u.beforeDataLimits(),u.determineDataLimits(),u.afterDataLimits(),u.beforeBuildTicks(),l=u.buildTicks()||[],l=u.afterBuildTicks(l)||l,u.beforeTickToLabelConversion(),a=u.convertTicksToLabels(l)||u.ticks,u.afterTickToLabelConversion(),u.ticks=a,r=0,i=a.length;r<i;++r)o=a[r],(s=l[r])?s.label=o:l.push(s={label:o,major:!1});return u._ticks=l,u.beforeCalculateTickRotation(),u.calculateTickRotation(),u.afterCalculateTickRotation(),u.beforeFit(),u.fit(),u.afterFit(),u.afterUpdate(),u.minSize},afterUpdate:function(){Be.callback(this.options.afterUpdate,[this])},beforeSetDimensions:function(){Be.callback(this.options.beforeSetDimensions,[this])},setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0},afterSetDimensions:function(){Be.callback(this.options.afterSetDimensions,[this])},beforeDataLimits:function(){Be.callback(this.options.beforeDataLimits,[this])},determineDataLimits:Be.noop,afterDataLimits:function(){Be.callback(this.options.afterDataLimits,[this])},beforeBuildTicks:function(){Be.callback(this.options.beforeBuildTicks,[this])},buildTicks:Be.noop,afterBuildTicks:function(e){var t=this;return Be.isArray(e)&&e.length?Be.callback(t.options.afterBuildTicks,[t,e]):(t.ticks=Be.callback(t.options.afterBuildTicks,[t,t.ticks])||t.ticks,e)},beforeTickToLabelConversion:function(){Be.callback(this.options.beforeTickToLabelConversion,[this])},convertTicksToLabels:function(){var e=this,t=e.options.ticks;e.ticks=e.ticks.map(t.userCallback||t.callback,this)},afterTickToLabelConversion:function(){Be.callback(this.options.afterTickToLabelConversion,[this])},beforeCalculateTickRotation:function(){Be.callback(this.options.beforeCalculateTickRotation,[this])},calculateTickRotation:function(){var e=this,t=e.ctx,n=e.options.ticks,r=br(e._ticks),i=Be.options._parseFont(n);t.font=i.string;var a=n.minRotation||0;if(r.length&&e.options.display&&e.isHorizontal())for(var o,l=Be.longestText(t,i.string,r,e.longestTextCache),s=l,u=e.getPixelForTick(1)-e.getPixelForTick(0)-6;s>u&&a<n.maxRotation;){var c=Be.toRadians(a);if(o=Math.cos(c),Math.sin(c)*l>e.maxHeight){a--;break}a++,s=o*l}e.labelRotation=a},afterCalculateTickRotation:function(){Be.callback(this.options.afterCalculateTickRotation,[this])},beforeFit:function(){Be.callback(this.options.beforeFit,[this])},fit:function(){var e=this,t=e.minSize={width:0,height:0},n=br(e._ticks),r=e.options,i=r.ticks,a=r.scaleLabel,o=r.gridLines,l=e._isVisible(),s=r.position,u=e.isHorizontal(),c=Be.options._parseFont,d=c(i),f=r.gridLines.tickMarkLength;if(t.width=u?e.isFullWidth()?e.maxWidth-e.margins.left-e.margins.right:e.maxWidth:l&&o.drawTicks?f:0,t.height=u?l&&o.drawTicks?f:0:e.maxHeight,a.display&&l){var h=c(a),p=Be.options.toPadding(a.padding),g=h.lineHeight+p.height;u?t.height+=g:t.width+=g}if(i.display&&l){var m=Be.longestText(e.ctx,d.string,n,e.longestTextCache),v=Be.numberOfLabelLines(n),y=.5*d.size,b=e.options.ticks.padding;if(e._maxLabelLines=v,e.longestLabelWidth=m,u){var x=Be.toRadians(e.labelRotation),w=Math.cos(x),_=Math.sin(x)*m+d.lineHeight*v+y;t.height=Math.min(e.maxHeight,t.height+_+b),e.ctx.font=d.string;var k,S,M=wr(e.ctx,n[0],d.string),C=wr(e.ctx,n[n.length-1],d.string),E=e.getPixelForTick(0)-e.left,O=e.right-e.getPixelForTick(n.length-1);0!==e.labelRotation?(k="bottom"===s?w*M:w*y,S="bottom"===s?w*y:w*C):(k=M/2,S=C/2),e.paddingLeft=Math.max(k-E,0)+3,e.paddingRight=Math.max(S-O,0)+3}else i.mirror?m=0:m+=b+y,t.width=Math.min(e.maxWidth,t.width+m),e.paddingTop=d.size/2,e.paddingBottom=d.size/2}e.handleMargins(),e.width=t.width,e.height=t.height},handleMargins:function(){var e=this;e.margins&&(e.paddingLeft=Math.max(e.paddingLeft-e.margins.left,0),e.paddingTop=Math.max(e.paddingTop-e.margins.top,0),e.paddingRight=Math.max(e.paddingRight-e.margins.right,0),e.paddingBottom=Math.max(e.paddingBottom-e.margins.bottom,0))},afterFit:function(){Be.callback(this.options.afterFit,[this])},isHorizontal:function(){return"top"===this.options.position||"bottom"===this.options.position},isFullWidth:function(){return this.options.fullWidth},getRightValue:function(e){if(Be.isNullOrUndef(e))return NaN;if(("number"===typeof e||e instanceof Number)&&!isFinite(e))return NaN;if(e)if(this.isHorizontal()){if(void 0!==e.x)return this.getRightValue(e.x)}else if(void 0!==e.y)return this.getRightValue(e.y);return e},getLabelForIndex:Be.noop,getPixelForValue:Be.noop,getValueForPixel:Be.noop,getPixelForTick:function(e){var t=this,n=t.options.offset;if(t.isHorizontal()){var r=(t.width-(t.paddingLeft+t.paddingRight))/Math.max(t._ticks.length-(n?0:1),1),i=r*e+t.paddingLeft;n&&(i+=r/2);var a=t.left+i;return a+=t.isFullWidth()?t.margins.left:0}var o=t.height-(t.paddingTop+t.paddingBottom);return t.top+e*(o/(t._ticks.length-1))},getPixelForDecimal:function(e){var t=this;if(t.isHorizontal()){var n=(t.width-(t.paddingLeft+t.paddingRight))*e+t.paddingLeft,r=t.left+n;return r+=t.isFullWidth()?t.margins.left:0}return t.top+e*t.height},getBasePixel:function(){return this.getPixelForValue(this.getBaseValue())},getBaseValue:function(){var e=this,t=e.min,n=e.max;return e.beginAtZero?0:t<0&&n<0?n:t>0&&n>0?t:0},_autoSkip:function(e){var t,n,r=this,i=r.isHorizontal(),a=r.options.ticks.minor,o=e.length,l=!1,s=a.maxTicksLimit,u=r._tickSize()*(o-1),c=i?r.width-(r.paddingLeft+r.paddingRight):r.height-(r.paddingTop+r.PaddingBottom),d=[];for(u>c&&(l=1+Math.floor(u/c)),o>s&&(l=Math.max(l,1+Math.floor(o/s))),t=0;t<o;t++)n=e[t],l>1&&t%l>0&&delete n.label,d.push(n);return d},_tickSize:function(){var e=this,t=e.isHorizontal(),n=e.options.ticks.minor,r=Be.toRadians(e.labelRotation),i=Math.abs(Math.cos(r)),a=Math.abs(Math.sin(r)),o=n.autoSkipPadding||0,l=e.longestLabelWidth+o||0,s=Be.options._parseFont(n),u=e._maxLabelLines*s.lineHeight+o||0;return t?u*i>l*a?l/i:u/a:u*a<l*i?u/i:l/a},_isVisible:function(){var e,t,n,r=this,i=r.chart,a=r.options.display;if("auto"!==a)return!!a;for(e=0,t=i.data.datasets.length;e<t;++e)if(i.isDatasetVisible(e)&&((n=i.getDatasetMeta(e)).xAxisID===r.id||n.yAxisID===r.id))return!0;return!1},draw:function(e){var t=this,n=t.options;if(t._isVisible()){var r,i,a,o=t.chart,l=t.ctx,s=Ye.global.defaultFontColor,u=n.ticks.minor,c=n.ticks.major||u,d=n.gridLines,f=n.scaleLabel,h=n.position,p=0!==t.labelRotation,g=u.mirror,m=t.isHorizontal(),v=Be.options._parseFont,y=u.display&&u.autoSkip?t._autoSkip(t.getTicks()):t.getTicks(),b=vr(u.fontColor,s),x=v(u),w=x.lineHeight,_=vr(c.fontColor,s),k=v(c),S=u.padding,M=u.labelOffset,C=d.drawTicks?d.tickMarkLength:0,E=vr(f.fontColor,s),O=v(f),P=Be.options.toPadding(f.padding),T=Be.toRadians(t.labelRotation),D=[],N=d.drawBorder?yr(d.lineWidth,0,0):0,R=Be._alignPixel;"top"===h?(r=R(o,t.bottom,N),i=t.bottom-C,a=r-N/2):"bottom"===h?(r=R(o,t.top,N),i=r+N/2,a=t.top+C):"left"===h?(r=R(o,t.right,N),i=t.right-C,a=r-N/2):(r=R(o,t.left,N),i=r+N/2,a=t.left+C);var A=1e-7;if(Be.each(y,(function(r,l){if(!Be.isNullOrUndef(r.label)){var s,u,c,f,v,y,b,x,_,k,E,O,P,I,L,j,F=r.label;l===t.zeroLineIndex&&n.offset===d.offsetGridLines?(s=d.zeroLineWidth,u=d.zeroLineColor,c=d.zeroLineBorderDash||[],f=d.zeroLineBorderDashOffset||0):(s=yr(d.lineWidth,l),u=yr(d.color,l),c=d.borderDash||[],f=d.borderDashOffset||0);var z=Be.isArray(F)?F.length:1,W=xr(t,l,d.offsetGridLines);if(m){var Y=C+S;W<t.left-A&&(u="rgba(0,0,0,0)"),v=b=_=E=R(o,W,s),y=i,x=a,P=t.getPixelForTick(l)+M,"top"===h?(k=R(o,e.top,N)+N/2,O=e.bottom,L=((p?1:.5)-z)*w,j=p?"left":"center",I=t.bottom-Y):(k=e.top,O=R(o,e.bottom,N)-N/2,L=(p?0:.5)*w,j=p?"right":"center",I=t.top+Y)}else{var H=(g?0:C)+S;W<t.top-A&&(u="rgba(0,0,0,0)"),v=i,b=a,y=x=k=O=R(o,W,s),I=t.getPixelForTick(l)+M,L=(1-z)*w/2,"left"===h?(_=R(o,e.left,N)+N/2,E=e.right,j=g?"left":"right",P=t.right-H):(_=e.left,E=R(o,e.right,N)-N/2,j=g?"right":"left",P=t.left+H)}D.push({tx1:v,ty1:y,tx2:b,ty2:x,x1:_,y1:k,x2:E,y2:O,labelX:P,labelY:I,glWidth:s,glColor:u,glBorderDash:c,glBorderDashOffset:f,rotation:-1*T,label:F,major:r.major,textOffset:L,textAlign:j})}})),Be.each(D,(function(e){var t=e.glWidth,n=e.glColor;if(d.display&&t&&n&&(l.save(),l.lineWidth=t,l.strokeStyle=n,l.setLineDash&&(l.setLineDash(e.glBorderDash),l.lineDashOffset=e.glBorderDashOffset),l.beginPath(),d.drawTicks&&(l.moveTo(e.tx1,e.ty1),l.lineTo(e.tx2,e.ty2)),d.drawOnChartArea&&(l.moveTo(e.x1,e.y1),l.lineTo(e.x2,e.y2)),l.stroke(),l.restore()),u.display){l.save(),l.translate(e.labelX,e.labelY),l.rotate(e.rotation),l.font=e.major?k.string:x.string,l.fillStyle=e.major?_:b,l.textBaseline="middle",l.textAlign=e.textAlign;var r=e.label,i=e.textOffset;if(Be.isArray(r))for(var a=0;a<r.length;++a)l.fillText(""+r[a],0,i),i+=w;else l.fillText(r,0,i);l.restore()}})),f.display){var I,L,j=0,F=O.lineHeight/2;if(m)I=t.left+(t.right-t.left)/2,L="bottom"===h?t.bottom-F-P.bottom:t.top+F+P.top;else{var z="left"===h;I=z?t.left+F+P.top:t.right-F-P.top,L=t.top+(t.bottom-t.top)/2,j=z?-.5*Math.PI:.5*Math.PI}l.save(),l.translate(I,L),l.rotate(j),l.textAlign="center",l.textBaseline="middle",l.fillStyle=E,l.font=O.string,l.fillText(f.labelString,0,0),l.restore()}if(N){var W,Y,H,U,V=N,B=yr(d.lineWidth,y.length-1,0);m?(W=R(o,t.left,V)-V/2,Y=R(o,t.right,B)+B/2,H=U=r):(H=R(o,t.top,V)-V/2,U=R(o,t.bottom,B)+B/2,W=Y=r),l.lineWidth=N,l.strokeStyle=yr(d.color,0),l.beginPath(),l.moveTo(W,H),l.lineTo(Y,U),l.stroke()}}}}),kr={position:"bottom"},Sr=_r.extend({getLabels:function(){var e=this.chart.data;return this.options.labels||(this.isHorizontal()?e.xLabels:e.yLabels)||e.labels},determineDataLimits:function(){var e,t=this,n=t.getLabels();t.minIndex=0,t.maxIndex=n.length-1,void 0!==t.options.ticks.min&&(e=n.indexOf(t.options.ticks.min),t.minIndex=-1!==e?e:t.minIndex),void 0!==t.options.ticks.max&&(e=n.indexOf(t.options.ticks.max),t.maxIndex=-1!==e?e:t.maxIndex),t.min=n[t.minIndex],t.max=n[t.maxIndex]},buildTicks:function(){var e=this,t=e.getLabels();e.ticks=0===e.minIndex&&e.maxIndex===t.length-1?t:t.slice(e.minIndex,e.maxIndex+1)},getLabelForIndex:function(e,t){var n=this,r=n.chart;return r.getDatasetMeta(t).controller._getValueScaleId()===n.id?n.getRightValue(r.data.datasets[t].data[e]):n.ticks[e-n.minIndex]},getPixelForValue:function(e,t){var n,r=this,i=r.options.offset,a=Math.max(r.maxIndex+1-r.minIndex-(i?0:1),1);if(void 0!==e&&null!==e&&(n=r.isHorizontal()?e.x:e.y),void 0!==n||void 0!==e&&isNaN(t)){e=n||e;var o=r.getLabels().indexOf(e);t=-1!==o?o:t}if(r.isHorizontal()){var l=r.width/a,s=l*(t-r.minIndex);return i&&(s+=l/2),r.left+s}var u=r.height/a,c=u*(t-r.minIndex);return i&&(c+=u/2),r.top+c},getPixelForTick:function(e){return this.getPixelForValue(this.ticks[e],e+this.minIndex,null)},getValueForPixel:function(e){var t=this,n=t.options.offset,r=Math.max(t._ticks.length-(n?0:1),1),i=t.isHorizontal(),a=(i?t.width:t.height)/r;return e-=i?t.left:t.top,n&&(e-=a/2),(e<=0?0:Math.round(e/a))+t.minIndex},getBasePixel:function(){return this.bottom}}),Mr=kr;Sr._defaults=Mr;var Cr=Be.noop,Er=Be.isNullOrUndef;function Or(e,t){var n,r,i,a,o=[],l=1e-14,s=e.stepSize,u=s||1,c=e.maxTicks-1,d=e.min,f=e.max,h=e.precision,p=t.min,g=t.max,m=Be.niceNum((g-p)/c/u)*u;if(m<l&&Er(d)&&Er(f))return[p,g];(a=Math.ceil(g/m)-Math.floor(p/m))>c&&(m=Be.niceNum(a*m/c/u)*u),s||Er(h)?n=Math.pow(10,Be._decimalPlaces(m)):(n=Math.pow(10,h),m=Math.ceil(m*n)/n),r=Math.floor(p/m)*m,i=Math.ceil(g/m)*m,s&&(!Er(d)&&Be.almostWhole(d/m,m/1e3)&&(r=d),!Er(f)&&Be.almostWhole(f/m,m/1e3)&&(i=f)),a=(i-r)/m,a=Be.almostEquals(a,Math.round(a),m/1e3)?Math.round(a):Math.ceil(a),r=Math.round(r*n)/n,i=Math.round(i*n)/n,o.push(Er(d)?r:d);for(var v=1;v<a;++v)o.push(Math.round((r+v*m)*n)/n);return o.push(Er(f)?i:f),o}var Pr=_r.extend({getRightValue:function(e){return"string"===typeof e?+e:_r.prototype.getRightValue.call(this,e)},handleTickRangeOptions:function(){var e=this,t=e.options.ticks;if(t.beginAtZero){var n=Be.sign(e.min),r=Be.sign(e.max);n<0&&r<0?e.max=0:n>0&&r>0&&(e.min=0)}var i=void 0!==t.min||void 0!==t.suggestedMin,a=void 0!==t.max||void 0!==t.suggestedMax;void 0!==t.min?e.min=t.min:void 0!==t.suggestedMin&&(null===e.min?e.min=t.suggestedMin:e.min=Math.min(e.min,t.suggestedMin)),void 0!==t.max?e.max=t.max:void 0!==t.suggestedMax&&(null===e.max?e.max=t.suggestedMax:e.max=Math.max(e.max,t.suggestedMax)),i!==a&&e.min>=e.max&&(i?e.max=e.min+1:e.min=e.max-1),e.min===e.max&&(e.max++,t.beginAtZero||e.min--)},getTickLimit:function(){var e,t=this,n=t.options.ticks,r=n.stepSize,i=n.maxTicksLimit;return r?e=Math.ceil(t.max/r)-Math.floor(t.min/r)+1:(e=t._computeTickLimit(),i=i||11),i&&(e=Math.min(i,e)),e},_computeTickLimit:function(){return Number.POSITIVE_INFINITY},handleDirectionalChanges:Cr,buildTicks:function(){var e=this,t=e.options.ticks,n=e.getTickLimit(),r={maxTicks:n=Math.max(2,n),min:t.min,max:t.max,precision:t.precision,stepSize:Be.valueOrDefault(t.fixedStepSize,t.stepSize)},i=e.ticks=Or(r,e);e.handleDirectionalChanges(),e.max=Be.max(i),e.min=Be.min(i),t.reverse?(i.reverse(),e.start=e.max,e.end=e.min):(e.start=e.min,e.end=e.max)},convertTicksToLabels:function(){var e=this;e.ticksAsNumbers=e.ticks.slice(),e.zeroLineIndex=e.ticks.indexOf(0),_r.prototype.convertTicksToLabels.call(e)}}),Tr={position:"left",ticks:{callback:mr.formatters.linear}},Dr=Pr.extend({determineDataLimits:function(){var e=this,t=e.options,n=e.chart,r=n.data.datasets,i=e.isHorizontal(),a=0,o=1;function l(t){return i?t.xAxisID===e.id:t.yAxisID===e.id}e.min=null,e.max=null;var s=t.stacked;if(void 0===s&&Be.each(r,(function(e,t){if(!s){var r=n.getDatasetMeta(t);n.isDatasetVisible(t)&&l(r)&&void 0!==r.stack&&(s=!0)}})),t.stacked||s){var u={};Be.each(r,(function(r,i){var a=n.getDatasetMeta(i),o=[a.type,void 0===t.stacked&&void 0===a.stack?i:"",a.stack].join(".");void 0===u[o]&&(u[o]={positiveValues:[],negativeValues:[]});var s=u[o].positiveValues,c=u[o].negativeValues;n.isDatasetVisible(i)&&l(a)&&Be.each(r.data,(function(n,r){var i=+e.getRightValue(n);isNaN(i)||a.data[r].hidden||(s[r]=s[r]||0,c[r]=c[r]||0,t.relativePoints?s[r]=100:i<0?c[r]+=i:s[r]+=i)}))})),Be.each(u,(function(t){var n=t.positiveValues.concat(t.negativeValues),r=Be.min(n),i=Be.max(n);e.min=null===e.min?r:Math.min(e.min,r),e.max=null===e.max?i:Math.max(e.max,i)}))}else Be.each(r,(function(t,r){var i=n.getDatasetMeta(r);n.isDatasetVisible(r)&&l(i)&&Be.each(t.data,(function(t,n){var r=+e.getRightValue(t);isNaN(r)||i.data[n].hidden||((null===e.min||r<e.min)&&(e.min=r),(null===e.max||r>e.max)&&(e.max=r))}))}));e.min=isFinite(e.min)&&!isNaN(e.min)?e.min:a,e.max=isFinite(e.max)&&!isNaN(e.max)?e.max:o,this.handleTickRangeOptions()},_computeTickLimit:function(){var e,t=this;return t.isHorizontal()?Math.ceil(t.width/40):(e=Be.options._parseFont(t.options.ticks),Math.ceil(t.height/e.lineHeight))},handleDirectionalChanges:function(){this.isHorizontal()||this.ticks.reverse()},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},getPixelForValue:function(e){var t=this,n=t.start,r=+t.getRightValue(e),i=t.end-n;return t.isHorizontal()?t.left+t.width/i*(r-n):t.bottom-t.height/i*(r-n)},getValueForPixel:function(e){var t=this,n=t.isHorizontal(),r=n?t.width:t.height,i=(n?e-t.left:t.bottom-e)/r;return t.start+(t.end-t.start)*i},getPixelForTick:function(e){return this.getPixelForValue(this.ticksAsNumbers[e])}}),Nr=Tr;Dr._defaults=Nr;var Rr=Be.valueOrDefault;function Ar(e,t){var n,r,i=[],a=Rr(e.min,Math.pow(10,Math.floor(Be.log10(t.min)))),o=Math.floor(Be.log10(t.max)),l=Math.ceil(t.max/Math.pow(10,o));0===a?(n=Math.floor(Be.log10(t.minNotZero)),r=Math.floor(t.minNotZero/Math.pow(10,n)),i.push(a),a=r*Math.pow(10,n)):(n=Math.floor(Be.log10(a)),r=Math.floor(a/Math.pow(10,n)));var s=n<0?Math.pow(10,Math.abs(n)):1;do{i.push(a),10===++r&&(r=1,s=++n>=0?1:s),a=Math.round(r*Math.pow(10,n)*s)/s}while(n<o||n===o&&r<l);var u=Rr(e.max,a);return i.push(u),i}var Ir={position:"left",ticks:{callback:mr.formatters.logarithmic}};function Lr(e,t){return Be.isFinite(e)&&e>=0?e:t}var jr=_r.extend({determineDataLimits:function(){var e=this,t=e.options,n=e.chart,r=n.data.datasets,i=e.isHorizontal();function a(t){return i?t.xAxisID===e.id:t.yAxisID===e.id}e.min=null,e.max=null,e.minNotZero=null;var o=t.stacked;if(void 0===o&&Be.each(r,(function(e,t){if(!o){var r=n.getDatasetMeta(t);n.isDatasetVisible(t)&&a(r)&&void 0!==r.stack&&(o=!0)}})),t.stacked||o){var l={};Be.each(r,(function(r,i){var o=n.getDatasetMeta(i),s=[o.type,void 0===t.stacked&&void 0===o.stack?i:"",o.stack].join(".");n.isDatasetVisible(i)&&a(o)&&(void 0===l[s]&&(l[s]=[]),Be.each(r.data,(function(t,n){var r=l[s],i=+e.getRightValue(t);isNaN(i)||o.data[n].hidden||i<0||(r[n]=r[n]||0,r[n]+=i)})))})),Be.each(l,(function(t){if(t.length>0){var n=Be.min(t),r=Be.max(t);e.min=null===e.min?n:Math.min(e.min,n),e.max=null===e.max?r:Math.max(e.max,r)}}))}else Be.each(r,(function(t,r){var i=n.getDatasetMeta(r);n.isDatasetVisible(r)&&a(i)&&Be.each(t.data,(function(t,n){var r=+e.getRightValue(t);isNaN(r)||i.data[n].hidden||r<0||((null===e.min||r<e.min)&&(e.min=r),(null===e.max||r>e.max)&&(e.max=r),0!==r&&(null===e.minNotZero||r<e.minNotZero)&&(e.minNotZero=r))}))}));this.handleTickRangeOptions()},handleTickRangeOptions:function(){var e=this,t=e.options.ticks,n=1,r=10;e.min=Lr(t.min,e.min),e.max=Lr(t.max,e.max),e.min===e.max&&(0!==e.min&&null!==e.min?(e.min=Math.pow(10,Math.floor(Be.log10(e.min))-1),e.max=Math.pow(10,Math.floor(Be.log10(e.max))+1)):(e.min=n,e.max=r)),null===e.min&&(e.min=Math.pow(10,Math.floor(Be.log10(e.max))-1)),null===e.max&&(e.max=0!==e.min?Math.pow(10,Math.floor(Be.log10(e.min))+1):r),null===e.minNotZero&&(e.min>0?e.minNotZero=e.min:e.max<1?e.minNotZero=Math.pow(10,Math.floor(Be.log10(e.max))):e.minNotZero=n)},buildTicks:function(){var e=this,t=e.options.ticks,n=!e.isHorizontal(),r={min:Lr(t.min),max:Lr(t.max)},i=e.ticks=Ar(r,e);e.max=Be.max(i),e.min=Be.min(i),t.reverse?(n=!n,e.start=e.max,e.end=e.min):(e.start=e.min,e.end=e.max),n&&i.reverse()},convertTicksToLabels:function(){this.tickValues=this.ticks.slice(),_r.prototype.convertTicksToLabels.call(this)},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},getPixelForTick:function(e){return this.getPixelForValue(this.tickValues[e])},_getFirstTickValue:function(e){var t=Math.floor(Be.log10(e));return Math.floor(e/Math.pow(10,t))*Math.pow(10,t)},getPixelForValue:function(e){var t,n,r,i,a,o=this,l=o.options.ticks,s=l.reverse,u=Be.log10,c=o._getFirstTickValue(o.minNotZero),d=0;return e=+o.getRightValue(e),s?(r=o.end,i=o.start,a=-1):(r=o.start,i=o.end,a=1),o.isHorizontal()?(t=o.width,n=s?o.right:o.left):(t=o.height,a*=-1,n=s?o.top:o.bottom),e!==r&&(0===r&&(t-=d=Rr(l.fontSize,Ye.global.defaultFontSize),r=c),0!==e&&(d+=t/(u(i)-u(r))*(u(e)-u(r))),n+=a*d),n},getValueForPixel:function(e){var t,n,r,i,a=this,o=a.options.ticks,l=o.reverse,s=Be.log10,u=a._getFirstTickValue(a.minNotZero);if(l?(n=a.end,r=a.start):(n=a.start,r=a.end),a.isHorizontal()?(t=a.width,i=l?a.right-e:e-a.left):(t=a.height,i=l?e-a.top:a.bottom-e),i!==n){if(0===n){var c=Rr(o.fontSize,Ye.global.defaultFontSize);i-=c,t-=c,n=u}i*=s(r)-s(n),i/=t,i=Math.pow(10,s(n)+i)}return i}}),Fr=Ir;jr._defaults=Fr;var zr=Be.valueOrDefault,Wr=Be.valueAtIndexOrDefault,Yr=Be.options.resolve,Hr={display:!0,animate:!0,position:"chartArea",angleLines:{display:!0,color:"rgba(0, 0, 0, 0.1)",lineWidth:1,borderDash:[],borderDashOffset:0},gridLines:{circular:!1},ticks:{showLabelBackdrop:!0,backdropColor:"rgba(255,255,255,0.75)",backdropPaddingY:2,backdropPaddingX:2,callback:mr.formatters.linear},pointLabels:{display:!0,fontSize:10,callback:function(e){return e}}};function Ur(e){var t=e.options;return t.angleLines.display||t.pointLabels.display?e.chart.data.labels.length:0}function Vr(e){var t=e.ticks;return t.display&&e.display?zr(t.fontSize,Ye.global.defaultFontSize)+2*t.backdropPaddingY:0}function Br(e,t,n){return Be.isArray(n)?{w:Be.longestText(e,e.font,n),h:n.length*t}:{w:e.measureText(n).width,h:t}}function $r(e,t,n,r,i){return e===r||e===i?{start:t-n/2,end:t+n/2}:e<r||e>i?{start:t-n,end:t}:{start:t,end:t+n}}function Xr(e){var t,n,r,i=Be.options._parseFont(e.options.pointLabels),a={l:0,r:e.width,t:0,b:e.height-e.paddingTop},o={};e.ctx.font=i.string,e._pointLabelSizes=[];var l=Ur(e);for(t=0;t<l;t++){r=e.getPointPosition(t,e.drawingArea+5),n=Br(e.ctx,i.lineHeight,e.pointLabels[t]||""),e._pointLabelSizes[t]=n;var s=e.getIndexAngle(t),u=Be.toDegrees(s)%360,c=$r(u,r.x,n.w,0,180),d=$r(u,r.y,n.h,90,270);c.start<a.l&&(a.l=c.start,o.l=s),c.end>a.r&&(a.r=c.end,o.r=s),d.start<a.t&&(a.t=d.start,o.t=s),d.end>a.b&&(a.b=d.end,o.b=s)}e.setReductions(e.drawingArea,a,o)}function qr(e){return 0===e||180===e?"center":e<180?"left":"right"}function Gr(e,t,n,r){var i,a,o=n.y+r/2;if(Be.isArray(t))for(i=0,a=t.length;i<a;++i)e.fillText(t[i],n.x,o),o+=r;else e.fillText(t,n.x,o)}function Kr(e,t,n){90===e||270===e?n.y-=t.h/2:(e>270||e<90)&&(n.y-=t.h)}function Qr(e){var t=e.ctx,n=e.options,r=n.angleLines,i=n.gridLines,a=n.pointLabels,o=zr(r.lineWidth,i.lineWidth),l=zr(r.color,i.color),s=Vr(n);t.save(),t.lineWidth=o,t.strokeStyle=l,t.setLineDash&&(t.setLineDash(Yr([r.borderDash,i.borderDash,[]])),t.lineDashOffset=Yr([r.borderDashOffset,i.borderDashOffset,0]));var u=e.getDistanceFromCenterForValue(n.ticks.reverse?e.min:e.max),c=Be.options._parseFont(a);t.font=c.string,t.textBaseline="middle";for(var d=Ur(e)-1;d>=0;d--){if(r.display&&o&&l){var f=e.getPointPosition(d,u);t.beginPath(),t.moveTo(e.xCenter,e.yCenter),t.lineTo(f.x,f.y),t.stroke()}if(a.display){var h=0===d?s/2:0,p=e.getPointPosition(d,u+h+5),g=Wr(a.fontColor,d,Ye.global.defaultFontColor);t.fillStyle=g;var m=e.getIndexAngle(d),v=Be.toDegrees(m);t.textAlign=qr(v),Kr(v,e._pointLabelSizes[d],p),Gr(t,e.pointLabels[d]||"",p,c.lineHeight)}}t.restore()}function Zr(e,t,n,r){var i,a=e.ctx,o=t.circular,l=Ur(e),s=Wr(t.color,r-1),u=Wr(t.lineWidth,r-1);if((o||l)&&s&&u){if(a.save(),a.strokeStyle=s,a.lineWidth=u,a.setLineDash&&(a.setLineDash(t.borderDash||[]),a.lineDashOffset=t.borderDashOffset||0),a.beginPath(),o)a.arc(e.xCenter,e.yCenter,n,0,2*Math.PI);else{i=e.getPointPosition(0,n),a.moveTo(i.x,i.y);for(var c=1;c<l;c++)i=e.getPointPosition(c,n),a.lineTo(i.x,i.y)}a.closePath(),a.stroke(),a.restore()}}function Jr(e){return Be.isNumber(e)?e:0}var ei=Pr.extend({setDimensions:function(){var e=this;e.width=e.maxWidth,e.height=e.maxHeight,e.paddingTop=Vr(e.options)/2,e.xCenter=Math.floor(e.width/2),e.yCenter=Math.floor((e.height-e.paddingTop)/2),e.drawingArea=Math.min(e.height-e.paddingTop,e.width)/2},determineDataLimits:function(){var e=this,t=e.chart,n=Number.POSITIVE_INFINITY,r=Number.NEGATIVE_INFINITY;Be.each(t.data.datasets,(function(i,a){if(t.isDatasetVisible(a)){var o=t.getDatasetMeta(a);Be.each(i.data,(function(t,i){var a=+e.getRightValue(t);isNaN(a)||o.data[i].hidden||(n=Math.min(a,n),r=Math.max(a,r))}))}})),e.min=n===Number.POSITIVE_INFINITY?0:n,e.max=r===Number.NEGATIVE_INFINITY?0:r,e.handleTickRangeOptions()},_computeTickLimit:function(){return Math.ceil(this.drawingArea/Vr(this.options))},convertTicksToLabels:function(){var e=this;Pr.prototype.convertTicksToLabels.call(e),e.pointLabels=e.chart.data.labels.map(e.options.pointLabels.callback,e)},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},fit:function(){var e=this,t=e.options;t.display&&t.pointLabels.display?Xr(e):e.setCenterPoint(0,0,0,0)},setReductions:function(e,t,n){var r=this,i=t.l/Math.sin(n.l),a=Math.max(t.r-r.width,0)/Math.sin(n.r),o=-t.t/Math.cos(n.t),l=-Math.max(t.b-(r.height-r.paddingTop),0)/Math.cos(n.b);i=Jr(i),a=Jr(a),o=Jr(o),l=Jr(l),r.drawingArea=Math.min(Math.floor(e-(i+a)/2),Math.floor(e-(o+l)/2)),r.setCenterPoint(i,a,o,l)},setCenterPoint:function(e,t,n,r){var i=this,a=i.width-t-i.drawingArea,o=e+i.drawingArea,l=n+i.drawingArea,s=i.height-i.paddingTop-r-i.drawingArea;i.xCenter=Math.floor((o+a)/2+i.left),i.yCenter=Math.floor((l+s)/2+i.top+i.paddingTop)},getIndexAngle:function(e){return e*(2*Math.PI/Ur(this))+(this.chart.options&&this.chart.options.startAngle?this.chart.options.startAngle:0)*Math.PI*2/360},getDistanceFromCenterForValue:function(e){var t=this;if(null===e)return 0;var n=t.drawingArea/(t.max-t.min);return t.options.ticks.reverse?(t.max-e)*n:(e-t.min)*n},getPointPosition:function(e,t){var n=this,r=n.getIndexAngle(e)-Math.PI/2;return{x:Math.cos(r)*t+n.xCenter,y:Math.sin(r)*t+n.yCenter}},getPointPositionForValue:function(e,t){return this.getPointPosition(e,this.getDistanceFromCenterForValue(t))},getBasePosition:function(){var e=this,t=e.min,n=e.max;return e.getPointPositionForValue(0,e.beginAtZero?0:t<0&&n<0?n:t>0&&n>0?t:0)},draw:function(){var e=this,t=e.options,n=t.gridLines,r=t.ticks;if(t.display){var i=e.ctx,a=this.getIndexAngle(0),o=Be.options._parseFont(r);(t.angleLines.display||t.pointLabels.display)&&Qr(e),Be.each(e.ticks,(function(t,l){if(l>0||r.reverse){var s=e.getDistanceFromCenterForValue(e.ticksAsNumbers[l]);if(n.display&&0!==l&&Zr(e,n,s,l),r.display){var u=zr(r.fontColor,Ye.global.defaultFontColor);if(i.font=o.string,i.save(),i.translate(e.xCenter,e.yCenter),i.rotate(a),r.showLabelBackdrop){var c=i.measureText(t).width;i.fillStyle=r.backdropColor,i.fillRect(-c/2-r.backdropPaddingX,-s-o.size/2-r.backdropPaddingY,c+2*r.backdropPaddingX,o.size+2*r.backdropPaddingY)}i.textAlign="center",i.textBaseline="middle",i.fillStyle=u,i.fillText(t,0,-s),i.restore()}}}))}}}),ti=Hr;ei._defaults=ti;var ni=Be.valueOrDefault,ri=Number.MIN_SAFE_INTEGER||-9007199254740991,ii=Number.MAX_SAFE_INTEGER||9007199254740991,ai={millisecond:{common:!0,size:1,steps:[1,2,5,10,20,50,100,250,500]},second:{common:!0,size:1e3,steps:[1,2,5,10,15,30]},minute:{common:!0,size:6e4,steps:[1,2,5,10,15,30]},hour:{common:!0,size:36e5,steps:[1,2,3,6,12]},day:{common:!0,size:864e5,steps:[1,2,5]},week:{common:!1,size:6048e5,steps:[1,2,3,4]},month:{common:!0,size:2628e6,steps:[1,2,3]},quarter:{common:!1,size:7884e6,steps:[1,2,3,4]},year:{common:!0,size:3154e7}},oi=Object.keys(ai);function li(e,t){return e-t}function si(e){var t,n,r,i={},a=[];for(t=0,n=e.length;t<n;++t)i[r=e[t]]||(i[r]=!0,a.push(r));return a}function ui(e,t,n,r){if("linear"===r||!e.length)return[{time:t,pos:0},{time:n,pos:1}];var i,a,o,l,s,u=[],c=[t];for(i=0,a=e.length;i<a;++i)(l=e[i])>t&&l<n&&c.push(l);for(c.push(n),i=0,a=c.length;i<a;++i)s=c[i+1],o=c[i-1],l=c[i],void 0!==o&&void 0!==s&&Math.round((s+o)/2)===l||u.push({time:l,pos:i/(a-1)});return u}function ci(e,t,n){for(var r,i,a,o=0,l=e.length-1;o>=0&&o<=l;){if(i=e[(r=o+l>>1)-1]||null,a=e[r],!i)return{lo:null,hi:a};if(a[t]<n)o=r+1;else{if(!(i[t]>n))return{lo:i,hi:a};l=r-1}}return{lo:a,hi:null}}function di(e,t,n,r){var i=ci(e,t,n),a=i.lo?i.hi?i.lo:e[e.length-2]:e[0],o=i.lo?i.hi?i.hi:e[e.length-1]:e[1],l=o[t]-a[t],s=l?(n-a[t])/l:0,u=(o[r]-a[r])*s;return a[r]+u}function fi(e,t){var n=e._adapter,r=e.options.time,i=r.parser,a=i||r.format,o=t;return"function"===typeof i&&(o=i(o)),Be.isFinite(o)||(o="string"===typeof a?n.parse(o,a):n.parse(o)),null!==o?+o:(i||"function"!==typeof a||(o=a(t),Be.isFinite(o)||(o=n.parse(o))),o)}function hi(e,t){if(Be.isNullOrUndef(t))return null;var n=e.options.time,r=fi(e,e.getRightValue(t));return null===r||n.round&&(r=+e._adapter.startOf(r,n.round)),r}function pi(e,t,n,r){var i,a,o,l=t-e,s=ai[n],u=s.size,c=s.steps;if(!c)return Math.ceil(l/(r*u));for(i=0,a=c.length;i<a&&(o=c[i],!(Math.ceil(l/(u*o))<=r));++i);return o}function gi(e,t,n,r){var i,a,o,l=oi.length;for(i=oi.indexOf(e);i<l-1;++i)if(o=(a=ai[oi[i]]).steps?a.steps[a.steps.length-1]:ii,a.common&&Math.ceil((n-t)/(o*a.size))<=r)return oi[i];return oi[l-1]}function mi(e,t,n,r,i){var a,o;for(a=oi.length-1;a>=oi.indexOf(n);a--)if(o=oi[a],ai[o].common&&e._adapter.diff(i,r,o)>=t.length)return o;return oi[n?oi.indexOf(n):0]}function vi(e){for(var t=oi.indexOf(e)+1,n=oi.length;t<n;++t)if(ai[oi[t]].common)return oi[t]}function yi(e,t,n,r){var i,a=e._adapter,o=e.options,l=o.time,s=l.unit||gi(l.minUnit,t,n,r),u=vi(s),c=ni(l.stepSize,l.unitStepSize),d="week"===s&&l.isoWeekday,f=o.ticks.major.enabled,h=ai[s],p=t,g=n,m=[];for(c||(c=pi(t,n,s,r)),d&&(p=+a.startOf(p,"isoWeek",d),g=+a.startOf(g,"isoWeek",d)),p=+a.startOf(p,d?"day":s),(g=+a.startOf(g,d?"day":s))<n&&(g=+a.add(g,1,s)),i=p,f&&u&&!d&&!l.round&&(i=+a.startOf(i,u),i=+a.add(i,~~((p-i)/(h.size*c))*c,s));i<g;i=+a.add(i,c,s))m.push(+i);return m.push(+i),m}function bi(e,t,n,r,i){var a,o,l=0,s=0;return i.offset&&t.length&&(i.time.min||(a=di(e,"time",t[0],"pos"),l=1===t.length?1-a:(di(e,"time",t[1],"pos")-a)/2),i.time.max||(o=di(e,"time",t[t.length-1],"pos"),s=1===t.length?o:(o-di(e,"time",t[t.length-2],"pos"))/2)),{start:l,end:s}}function xi(e,t,n){var r,i,a,o,l=[];for(r=0,i=t.length;r<i;++r)a=t[r],o=!!n&&a===+e._adapter.startOf(a,n),l.push({value:a,major:o});return l}var wi={position:"bottom",distribution:"linear",bounds:"data",adapters:{},time:{parser:!1,format:!1,unit:!1,round:!1,displayFormat:!1,isoWeekday:!1,minUnit:"millisecond",displayFormats:{}},ticks:{autoSkip:!1,source:"auto",major:{enabled:!1}}},_i=_r.extend({initialize:function(){this.mergeTicksOptions(),_r.prototype.initialize.call(this)},update:function(){var e=this,t=e.options,n=t.time||(t.time={}),r=e._adapter=new gr._date(t.adapters.date);return n.format&&console.warn("options.time.format is deprecated and replaced by options.time.parser."),Be.mergeIf(n.displayFormats,r.formats()),_r.prototype.update.apply(e,arguments)},getRightValue:function(e){return e&&void 0!==e.t&&(e=e.t),_r.prototype.getRightValue.call(this,e)},determineDataLimits:function(){var e,t,n,r,i,a,o=this,l=o.chart,s=o._adapter,u=o.options.time,c=u.unit||"day",d=ii,f=ri,h=[],p=[],g=[],m=l.data.labels||[];for(e=0,n=m.length;e<n;++e)g.push(hi(o,m[e]));for(e=0,n=(l.data.datasets||[]).length;e<n;++e)if(l.isDatasetVisible(e))if(i=l.data.datasets[e].data,Be.isObject(i[0]))for(p[e]=[],t=0,r=i.length;t<r;++t)a=hi(o,i[t]),h.push(a),p[e][t]=a;else{for(t=0,r=g.length;t<r;++t)h.push(g[t]);p[e]=g.slice(0)}else p[e]=[];g.length&&(g=si(g).sort(li),d=Math.min(d,g[0]),f=Math.max(f,g[g.length-1])),h.length&&(h=si(h).sort(li),d=Math.min(d,h[0]),f=Math.max(f,h[h.length-1])),d=hi(o,u.min)||d,f=hi(o,u.max)||f,d=d===ii?+s.startOf(Date.now(),c):d,f=f===ri?+s.endOf(Date.now(),c)+1:f,o.min=Math.min(d,f),o.max=Math.max(d+1,f),o._horizontal=o.isHorizontal(),o._table=[],o._timestamps={data:h,datasets:p,labels:g}},buildTicks:function(){var e,t,n,r=this,i=r.min,a=r.max,o=r.options,l=o.time,s=[],u=[];switch(o.ticks.source){case"data":s=r._timestamps.data;break;case"labels":s=r._timestamps.labels;break;case"auto":default:s=yi(r,i,a,r.getLabelCapacity(i),o)}for("ticks"===o.bounds&&s.length&&(i=s[0],a=s[s.length-1]),i=hi(r,l.min)||i,a=hi(r,l.max)||a,e=0,t=s.length;e<t;++e)(n=s[e])>=i&&n<=a&&u.push(n);return r.min=i,r.max=a,r._unit=l.unit||mi(r,u,l.minUnit,r.min,r.max),r._majorUnit=vi(r._unit),r._table=ui(r._timestamps.data,i,a,o.distribution),r._offsets=bi(r._table,u,i,a,o),o.ticks.reverse&&u.reverse(),xi(r,u,r._majorUnit)},getLabelForIndex:function(e,t){var n=this,r=n._adapter,i=n.chart.data,a=n.options.time,o=i.labels&&e<i.labels.length?i.labels[e]:"",l=i.datasets[t].data[e];return Be.isObject(l)&&(o=n.getRightValue(l)),a.tooltipFormat?r.format(fi(n,o),a.tooltipFormat):"string"===typeof o?o:r.format(fi(n,o),a.displayFormats.datetime)},tickFormatFunction:function(e,t,n,r){var i=this,a=i._adapter,o=i.options,l=o.time.displayFormats,s=l[i._unit],u=i._majorUnit,c=l[u],d=+a.startOf(e,u),f=o.ticks.major,h=f.enabled&&u&&c&&e===d,p=a.format(e,r||(h?c:s)),g=h?f:o.ticks.minor,m=ni(g.callback,g.userCallback);return m?m(p,t,n):p},convertTicksToLabels:function(e){var t,n,r=[];for(t=0,n=e.length;t<n;++t)r.push(this.tickFormatFunction(e[t].value,t,e));return r},getPixelForOffset:function(e){var t=this,n=t.options.ticks.reverse,r=t._horizontal?t.width:t.height,i=t._horizontal?n?t.right:t.left:n?t.bottom:t.top,a=di(t._table,"time",e,"pos"),o=r*(t._offsets.start+a)/(t._offsets.start+1+t._offsets.end);return n?i-o:i+o},getPixelForValue:function(e,t,n){var r=this,i=null;if(void 0!==t&&void 0!==n&&(i=r._timestamps.datasets[n][t]),null===i&&(i=hi(r,e)),null!==i)return r.getPixelForOffset(i)},getPixelForTick:function(e){var t=this.getTicks();return e>=0&&e<t.length?this.getPixelForOffset(t[e].value):null},getValueForPixel:function(e){var t=this,n=t._horizontal?t.width:t.height,r=t._horizontal?t.left:t.top,i=(n?(e-r)/n:0)*(t._offsets.start+1+t._offsets.start)-t._offsets.end,a=di(t._table,"pos",i,"time");return t._adapter._create(a)},getLabelWidth:function(e){var t=this,n=t.options.ticks,r=t.ctx.measureText(e).width,i=Be.toRadians(n.maxRotation),a=Math.cos(i),o=Math.sin(i);return r*a+ni(n.fontSize,Ye.global.defaultFontSize)*o},getLabelCapacity:function(e){var t=this,n=t.options.time.displayFormats.millisecond,r=t.tickFormatFunction(e,0,[],n),i=t.getLabelWidth(r),a=t.isHorizontal()?t.width:t.height,o=Math.floor(a/i);return o>0?o:1}}),ki=wi;_i._defaults=ki;var Si={category:Sr,linear:Dr,logarithmic:jr,radialLinear:ei,time:_i},Mi={datetime:"MMM D, YYYY, h:mm:ss a",millisecond:"h:mm:ss.SSS a",second:"h:mm:ss a",minute:"h:mm a",hour:"hA",day:"MMM D",week:"ll",month:"MMM YYYY",quarter:"[Q]Q - YYYY",year:"YYYY"};gr._date.override("function"===typeof e?{_id:"moment",formats:function(){return Mi},parse:function(t,n){return"string"===typeof t&&"string"===typeof n?t=e(t,n):t instanceof e||(t=e(t)),t.isValid()?t.valueOf():null},format:function(t,n){return e(t).format(n)},add:function(t,n,r){return e(t).add(n,r).valueOf()},diff:function(t,n,r){return e.duration(e(t).diff(e(n))).as(r)},startOf:function(t,n,r){return t=e(t),"isoWeek"===n?t.isoWeekday(r).valueOf():t.startOf(n).valueOf()},endOf:function(t,n){return e(t).endOf(n).valueOf()},_create:function(t){return e(t)}}:{}),Ye._set("global",{plugins:{filler:{propagate:!0}}});var Ci={dataset:function(e){var t=e.fill,n=e.chart,r=n.getDatasetMeta(t),i=r&&n.isDatasetVisible(t)&&r.dataset._children||[],a=i.length||0;return a?function(e,t){return t<a&&i[t]._view||null}:null},boundary:function(e){var t=e.boundary,n=t?t.x:null,r=t?t.y:null;return function(e){return{x:null===n?e.x:n,y:null===r?e.y:r}}}};function Ei(e,t,n){var r,i=e._model||{},a=i.fill;if(void 0===a&&(a=!!i.backgroundColor),!1===a||null===a)return!1;if(!0===a)return"origin";if(r=parseFloat(a,10),isFinite(r)&&Math.floor(r)===r)return"-"!==a[0]&&"+"!==a[0]||(r=t+r),!(r===t||r<0||r>=n)&&r;switch(a){case"bottom":return"start";case"top":return"end";case"zero":return"origin";case"origin":case"start":case"end":return a;default:return!1}}function Oi(e){var t,n=e.el._model||{},r=e.el._scale||{},i=e.fill,a=null;if(isFinite(i))return null;if("start"===i?a=void 0===n.scaleBottom?r.bottom:n.scaleBottom:"end"===i?a=void 0===n.scaleTop?r.top:n.scaleTop:void 0!==n.scaleZero?a=n.scaleZero:r.getBasePosition?a=r.getBasePosition():r.getBasePixel&&(a=r.getBasePixel()),void 0!==a&&null!==a){if(void 0!==a.x&&void 0!==a.y)return a;if(Be.isFinite(a))return{x:(t=r.isHorizontal())?a:null,y:t?null:a}}return null}function Pi(e,t,n){var r,i=e[t].fill,a=[t];if(!n)return i;for(;!1!==i&&-1===a.indexOf(i);){if(!isFinite(i))return i;if(!(r=e[i]))return!1;if(r.visible)return i;a.push(i),i=r.fill}return!1}function Ti(e){var t=e.fill,n="dataset";return!1===t?null:(isFinite(t)||(n="boundary"),Ci[n](e))}function Di(e){return e&&!e.skip}function Ni(e,t,n,r,i){var a;if(r&&i){for(e.moveTo(t[0].x,t[0].y),a=1;a<r;++a)Be.canvas.lineTo(e,t[a-1],t[a]);for(e.lineTo(n[i-1].x,n[i-1].y),a=i-1;a>0;--a)Be.canvas.lineTo(e,n[a],n[a-1],!0)}}function Ri(e,t,n,r,i,a){var o,l,s,u,c,d,f,h=t.length,p=r.spanGaps,g=[],m=[],v=0,y=0;for(e.beginPath(),o=0,l=h+!!a;o<l;++o)c=n(u=t[s=o%h]._view,s,r),d=Di(u),f=Di(c),d&&f?(v=g.push(u),y=m.push(c)):v&&y&&(p?(d&&g.push(u),f&&m.push(c)):(Ni(e,g,m,v,y),v=y=0,g=[],m=[]));Ni(e,g,m,v,y),e.closePath(),e.fillStyle=i,e.fill()}var Ai={id:"filler",afterDatasetsUpdate:function(e,t){var n,r,i,a,o=(e.data.datasets||[]).length,l=t.propagate,s=[];for(r=0;r<o;++r)a=null,(i=(n=e.getDatasetMeta(r)).dataset)&&i._model&&i instanceof Mt.Line&&(a={visible:e.isDatasetVisible(r),fill:Ei(i,r,o),chart:e,el:i}),n.$filler=a,s.push(a);for(r=0;r<o;++r)(a=s[r])&&(a.fill=Pi(s,r,l),a.boundary=Oi(a),a.mapper=Ti(a))},beforeDatasetDraw:function(e,t){var n=t.meta.$filler;if(n){var r=e.ctx,i=n.el,a=i._view,o=i._children||[],l=n.mapper,s=a.backgroundColor||Ye.global.defaultColor;l&&s&&o.length&&(Be.canvas.clipArea(r,e.chartArea),Ri(r,o,l,a,s,i._loop),Be.canvas.unclipArea(r))}}},Ii=Be.noop,Li=Be.valueOrDefault;function ji(e,t){return e.usePointStyle&&e.boxWidth>t?t:e.boxWidth}Ye._set("global",{legend:{display:!0,position:"top",fullWidth:!0,reverse:!1,weight:1e3,onClick:function(e,t){var n=t.datasetIndex,r=this.chart,i=r.getDatasetMeta(n);i.hidden=null===i.hidden?!r.data.datasets[n].hidden:null,r.update()},onHover:null,onLeave:null,labels:{boxWidth:40,padding:10,generateLabels:function(e){var t=e.data;return Be.isArray(t.datasets)?t.datasets.map((function(t,n){return{text:t.label,fillStyle:Be.isArray(t.backgroundColor)?t.backgroundColor[0]:t.backgroundColor,hidden:!e.isDatasetVisible(n),lineCap:t.borderCapStyle,lineDash:t.borderDash,lineDashOffset:t.borderDashOffset,lineJoin:t.borderJoinStyle,lineWidth:t.borderWidth,strokeStyle:t.borderColor,pointStyle:t.pointStyle,datasetIndex:n}}),this):[]}}},legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');for(var n=0;n<e.data.datasets.length;n++)t.push('<li><span style="background-color:'+e.data.datasets[n].backgroundColor+'"></span>'),e.data.datasets[n].label&&t.push(e.data.datasets[n].label),t.push("</li>");return t.push("</ul>"),t.join("")}});var Fi=Qe.extend({initialize:function(e){Be.extend(this,e),this.legendHitBoxes=[],this._hoveredItem=null,this.doughnutMode=!1},beforeUpdate:Ii,update:function(e,t,n){var r=this;return r.beforeUpdate(),r.maxWidth=e,r.maxHeight=t,r.margins=n,r.beforeSetDimensions(),r.setDimensions(),r.afterSetDimensions(),r.beforeBuildLabels(),r.buildLabels(),r.afterBuildLabels(),r.beforeFit(),r.fit(),r.afterFit(),r.afterUpdate(),r.minSize},afterUpdate:Ii,beforeSetDimensions:Ii,setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0,e.minSize={width:0,height:0}},afterSetDimensions:Ii,beforeBuildLabels:Ii,buildLabels:function(){var e=this,t=e.options.labels||{},n=Be.callback(t.generateLabels,[e.chart],e)||[];t.filter&&(n=n.filter((function(n){return t.filter(n,e.chart.data)}))),e.options.reverse&&n.reverse(),e.legendItems=n},afterBuildLabels:Ii,beforeFit:Ii,fit:function(){var e=this,t=e.options,n=t.labels,r=t.display,i=e.ctx,a=Be.options._parseFont(n),o=a.size,l=e.legendHitBoxes=[],s=e.minSize,u=e.isHorizontal();if(u?(s.width=e.maxWidth,s.height=r?10:0):(s.width=r?10:0,s.height=e.maxHeight),r)if(i.font=a.string,u){var c=e.lineWidths=[0],d=0;i.textAlign="left",i.textBaseline="top",Be.each(e.legendItems,(function(e,t){var r=ji(n,o)+o/2+i.measureText(e.text).width;(0===t||c[c.length-1]+r+n.padding>s.width)&&(d+=o+n.padding,c[c.length-(t>0?0:1)]=n.padding),l[t]={left:0,top:0,width:r,height:o},c[c.length-1]+=r+n.padding})),s.height+=d}else{var f=n.padding,h=e.columnWidths=[],p=n.padding,g=0,m=0,v=o+f;Be.each(e.legendItems,(function(e,t){var r=ji(n,o)+o/2+i.measureText(e.text).width;t>0&&m+v>s.height-f&&(p+=g+n.padding,h.push(g),g=0,m=0),g=Math.max(g,r),m+=v,l[t]={left:0,top:0,width:r,height:o}})),p+=g,h.push(g),s.width+=p}e.width=s.width,e.height=s.height},afterFit:Ii,isHorizontal:function(){return"top"===this.options.position||"bottom"===this.options.position},draw:function(){var e=this,t=e.options,n=t.labels,r=Ye.global,i=r.defaultColor,a=r.elements.line,o=e.width,l=e.lineWidths;if(t.display){var s,u=e.ctx,c=Li(n.fontColor,r.defaultFontColor),d=Be.options._parseFont(n),f=d.size;u.textAlign="left",u.textBaseline="middle",u.lineWidth=.5,u.strokeStyle=c,u.fillStyle=c,u.font=d.string;var h=ji(n,f),p=e.legendHitBoxes,g=function(e,n,r){if(!(isNaN(h)||h<=0)){u.save();var o=Li(r.lineWidth,a.borderWidth);if(u.fillStyle=Li(r.fillStyle,i),u.lineCap=Li(r.lineCap,a.borderCapStyle),u.lineDashOffset=Li(r.lineDashOffset,a.borderDashOffset),u.lineJoin=Li(r.lineJoin,a.borderJoinStyle),u.lineWidth=o,u.strokeStyle=Li(r.strokeStyle,i),u.setLineDash&&u.setLineDash(Li(r.lineDash,a.borderDash)),t.labels&&t.labels.usePointStyle){var l=h*Math.SQRT2/2,s=e+h/2,c=n+f/2;Be.canvas.drawPoint(u,r.pointStyle,l,s,c)}else 0!==o&&u.strokeRect(e,n,h,f),u.fillRect(e,n,h,f);u.restore()}},m=function(e,t,n,r){var i=f/2,a=h+i+e,o=t+i;u.fillText(n.text,a,o),n.hidden&&(u.beginPath(),u.lineWidth=2,u.moveTo(a,o),u.lineTo(a+r,o),u.stroke())},v=e.isHorizontal();s=v?{x:e.left+(o-l[0])/2+n.padding,y:e.top+n.padding,line:0}:{x:e.left+n.padding,y:e.top+n.padding,line:0};var y=f+n.padding;Be.each(e.legendItems,(function(t,r){var i=u.measureText(t.text).width,a=h+f/2+i,c=s.x,d=s.y;v?r>0&&c+a+n.padding>e.left+e.minSize.width&&(d=s.y+=y,s.line++,c=s.x=e.left+(o-l[s.line])/2+n.padding):r>0&&d+y>e.top+e.minSize.height&&(c=s.x=c+e.columnWidths[s.line]+n.padding,d=s.y=e.top+n.padding,s.line++),g(c,d,t),p[r].left=c,p[r].top=d,m(c,d,t,i),v?s.x+=a+n.padding:s.y+=y}))}},_getLegendItemAt:function(e,t){var n,r,i,a=this;if(e>=a.left&&e<=a.right&&t>=a.top&&t<=a.bottom)for(i=a.legendHitBoxes,n=0;n<i.length;++n)if(e>=(r=i[n]).left&&e<=r.left+r.width&&t>=r.top&&t<=r.top+r.height)return a.legendItems[n];return null},handleEvent:function(e){var t,n=this,r=n.options,i="mouseup"===e.type?"click":e.type;if("mousemove"===i){if(!r.onHover&&!r.onLeave)return}else{if("click"!==i)return;if(!r.onClick)return}t=n._getLegendItemAt(e.x,e.y),"click"===i?t&&r.onClick&&r.onClick.call(n,e.native,t):(r.onLeave&&t!==n._hoveredItem&&(n._hoveredItem&&r.onLeave.call(n,e.native,n._hoveredItem),n._hoveredItem=t),r.onHover&&t&&r.onHover.call(n,e.native,t))}});function zi(e,t){var n=new Fi({ctx:e.ctx,options:t,chart:e});fn.configure(e,n,t),fn.addBox(e,n),e.legend=n}var Wi={id:"legend",_element:Fi,beforeInit:function(e){var t=e.options.legend;t&&zi(e,t)},beforeUpdate:function(e){var t=e.options.legend,n=e.legend;t?(Be.mergeIf(t,Ye.global.legend),n?(fn.configure(e,n,t),n.options=t):zi(e,t)):n&&(fn.removeBox(e,n),delete e.legend)},afterEvent:function(e,t){var n=e.legend;n&&n.handleEvent(t)}},Yi=Be.noop;Ye._set("global",{title:{display:!1,fontStyle:"bold",fullWidth:!0,padding:10,position:"top",text:"",weight:2e3}});var Hi=Qe.extend({initialize:function(e){var t=this;Be.extend(t,e),t.legendHitBoxes=[]},beforeUpdate:Yi,update:function(e,t,n){var r=this;return r.beforeUpdate(),r.maxWidth=e,r.maxHeight=t,r.margins=n,r.beforeSetDimensions(),r.setDimensions(),r.afterSetDimensions(),r.beforeBuildLabels(),r.buildLabels(),r.afterBuildLabels(),r.beforeFit(),r.fit(),r.afterFit(),r.afterUpdate(),r.minSize},afterUpdate:Yi,beforeSetDimensions:Yi,setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0,e.minSize={width:0,height:0}},afterSetDimensions:Yi,beforeBuildLabels:Yi,buildLabels:Yi,afterBuildLabels:Yi,beforeFit:Yi,fit:function(){var e=this,t=e.options,n=t.display,r=e.minSize,i=Be.isArray(t.text)?t.text.length:1,a=Be.options._parseFont(t),o=n?i*a.lineHeight+2*t.padding:0;e.isHorizontal()?(r.width=e.maxWidth,r.height=o):(r.width=o,r.height=e.maxHeight),e.width=r.width,e.height=r.height},afterFit:Yi,isHorizontal:function(){var e=this.options.position;return"top"===e||"bottom"===e},draw:function(){var e=this,t=e.ctx,n=e.options;if(n.display){var r,i,a,o=Be.options._parseFont(n),l=o.lineHeight,s=l/2+n.padding,u=0,c=e.top,d=e.left,f=e.bottom,h=e.right;t.fillStyle=Be.valueOrDefault(n.fontColor,Ye.global.defaultFontColor),t.font=o.string,e.isHorizontal()?(i=d+(h-d)/2,a=c+s,r=h-d):(i="left"===n.position?d+s:h-s,a=c+(f-c)/2,r=f-c,u=Math.PI*("left"===n.position?-.5:.5)),t.save(),t.translate(i,a),t.rotate(u),t.textAlign="center",t.textBaseline="middle";var p=n.text;if(Be.isArray(p))for(var g=0,m=0;m<p.length;++m)t.fillText(p[m],0,g,r),g+=l;else t.fillText(p,0,0,r);t.restore()}}});function Ui(e,t){var n=new Hi({ctx:e.ctx,options:t,chart:e});fn.configure(e,n,t),fn.addBox(e,n),e.titleBlock=n}var Vi={},Bi=Ai,$i=Wi,Xi={id:"title",_element:Hi,beforeInit:function(e){var t=e.options.title;t&&Ui(e,t)},beforeUpdate:function(e){var t=e.options.title,n=e.titleBlock;t?(Be.mergeIf(t,Ye.global.title),n?(fn.configure(e,n,t),n.options=t):Ui(e,t)):n&&(fn.removeBox(e,n),delete e.titleBlock)}};for(var qi in Vi.filler=Bi,Vi.legend=$i,Vi.title=Xi,dr.helpers=Be,fr(dr),dr._adapters=gr,dr.Animation=Je,dr.animationService=et,dr.controllers=Jt,dr.DatasetController=ot,dr.defaults=Ye,dr.Element=Qe,dr.elements=Mt,dr.Interaction=ln,dr.layouts=fn,dr.platform=Yn,dr.plugins=Hn,dr.Scale=_r,dr.scaleService=Un,dr.Ticks=mr,dr.Tooltip=rr,dr.helpers.each(Si,(function(e,t){dr.scaleService.registerScaleType(t,e,e._defaults)})),Vi)Vi.hasOwnProperty(qi)&&dr.plugins.register(Vi[qi]);dr.platform.initialize();var Gi=dr;return"undefined"!==typeof window&&(window.Chart=dr),dr.Chart=dr,dr.Legend=Vi.legend._element,dr.Title=Vi.title._element,dr.pluginService=dr.plugins,dr.PluginBase=dr.Element.extend({}),dr.canvasHelpers=dr.helpers.canvas,dr.layoutService=dr.layouts,dr.LinearScaleBase=Pr,dr.helpers.each(["Bar","Bubble","Doughnut","Line","PolarArea","Radar","Scatter"],(function(e){dr[e]=function(t,n){return new dr(t,dr.helpers.merge(n||{},{type:e.charAt(0).toLowerCase()+e.slice(1)}))}})),Gi}(function(){try{return n(58)}catch(e){}}())},function(e,t,n){(function(e){e.exports=function(){"use strict";var t,n;function r(){return t.apply(null,arguments)}function i(e){t=e}function a(e){return e instanceof Array||"[object Array]"===Object.prototype.toString.call(e)}function o(e){return null!=e&&"[object Object]"===Object.prototype.toString.call(e)}function l(e,t){return Object.prototype.hasOwnProperty.call(e,t)}function s(e){if(Object.getOwnPropertyNames)return 0===Object.getOwnPropertyNames(e).length;var t;for(t in e)if(l(e,t))return!1;return!0}function u(e){return void 0===e}function c(e){return"number"===typeof e||"[object Number]"===Object.prototype.toString.call(e)}function d(e){return e instanceof Date||"[object Date]"===Object.prototype.toString.call(e)}function f(e,t){var n,r=[];for(n=0;n<e.length;++n)r.push(t(e[n],n));return r}function h(e,t){for(var n in t)l(t,n)&&(e[n]=t[n]);return l(t,"toString")&&(e.toString=t.toString),l(t,"valueOf")&&(e.valueOf=t.valueOf),e}function p(e,t,n,r){return Xn(e,t,n,r,!0).utc()}function g(){return{empty:!1,unusedTokens:[],unusedInput:[],overflow:-2,charsLeftOver:0,nullInput:!1,invalidEra:null,invalidMonth:null,invalidFormat:!1,userInvalidated:!1,iso:!1,parsedDateParts:[],era:null,meridiem:null,rfc2822:!1,weekdayMismatch:!1}}function m(e){return null==e._pf&&(e._pf=g()),e._pf}function v(e){if(null==e._isValid){var t=m(e),r=n.call(t.parsedDateParts,(function(e){return null!=e})),i=!isNaN(e._d.getTime())&&t.overflow<0&&!t.empty&&!t.invalidEra&&!t.invalidMonth&&!t.invalidWeekday&&!t.weekdayMismatch&&!t.nullInput&&!t.invalidFormat&&!t.userInvalidated&&(!t.meridiem||t.meridiem&&r);if(e._strict&&(i=i&&0===t.charsLeftOver&&0===t.unusedTokens.length&&void 0===t.bigHour),null!=Object.isFrozen&&Object.isFrozen(e))return i;e._isValid=i}return e._isValid}function y(e){var t=p(NaN);return null!=e?h(m(t),e):m(t).userInvalidated=!0,t}n=Array.prototype.some?Array.prototype.some:function(e){var t,n=Object(this),r=n.length>>>0;for(t=0;t<r;t++)if(t in n&&e.call(this,n[t],t,n))return!0;return!1};var b=r.momentProperties=[],x=!1;function w(e,t){var n,r,i;if(u(t._isAMomentObject)||(e._isAMomentObject=t._isAMomentObject),u(t._i)||(e._i=t._i),u(t._f)||(e._f=t._f),u(t._l)||(e._l=t._l),u(t._strict)||(e._strict=t._strict),u(t._tzm)||(e._tzm=t._tzm),u(t._isUTC)||(e._isUTC=t._isUTC),u(t._offset)||(e._offset=t._offset),u(t._pf)||(e._pf=m(t)),u(t._locale)||(e._locale=t._locale),b.length>0)for(n=0;n<b.length;n++)u(i=t[r=b[n]])||(e[r]=i);return e}function _(e){w(this,e),this._d=new Date(null!=e._d?e._d.getTime():NaN),this.isValid()||(this._d=new Date(NaN)),!1===x&&(x=!0,r.updateOffset(this),x=!1)}function k(e){return e instanceof _||null!=e&&null!=e._isAMomentObject}function S(e){!1===r.suppressDeprecationWarnings&&"undefined"!==typeof console&&console.warn&&console.warn("Deprecation warning: "+e)}function M(e,t){var n=!0;return h((function(){if(null!=r.deprecationHandler&&r.deprecationHandler(null,e),n){var i,a,o,s=[];for(a=0;a<arguments.length;a++){if(i="","object"===typeof arguments[a]){for(o in i+="\n["+a+"] ",arguments[0])l(arguments[0],o)&&(i+=o+": "+arguments[0][o]+", ");i=i.slice(0,-2)}else i=arguments[a];s.push(i)}S(e+"\nArguments: "+Array.prototype.slice.call(s).join("")+"\n"+(new Error).stack),n=!1}return t.apply(this,arguments)}),t)}var C,E={};function O(e,t){null!=r.deprecationHandler&&r.deprecationHandler(e,t),E[e]||(S(t),E[e]=!0)}function P(e){return"undefined"!==typeof Function&&e instanceof Function||"[object Function]"===Object.prototype.toString.call(e)}function T(e){var t,n;for(n in e)l(e,n)&&(P(t=e[n])?this[n]=t:this["_"+n]=t);this._config=e,this._dayOfMonthOrdinalParseLenient=new RegExp((this._dayOfMonthOrdinalParse.source||this._ordinalParse.source)+"|"+/\d{1,2}/.source)}function D(e,t){var n,r=h({},e);for(n in t)l(t,n)&&(o(e[n])&&o(t[n])?(r[n]={},h(r[n],e[n]),h(r[n],t[n])):null!=t[n]?r[n]=t[n]:delete r[n]);for(n in e)l(e,n)&&!l(t,n)&&o(e[n])&&(r[n]=h({},r[n]));return r}function N(e){null!=e&&this.set(e)}r.suppressDeprecationWarnings=!1,r.deprecationHandler=null,C=Object.keys?Object.keys:function(e){var t,n=[];for(t in e)l(e,t)&&n.push(t);return n};var R={sameDay:"[Today at] LT",nextDay:"[Tomorrow at] LT",nextWeek:"dddd [at] LT",lastDay:"[Yesterday at] LT",lastWeek:"[Last] dddd [at] LT",sameElse:"L"};function A(e,t,n){var r=this._calendar[e]||this._calendar.sameElse;return P(r)?r.call(t,n):r}function I(e,t,n){var r=""+Math.abs(e),i=t-r.length;return(e>=0?n?"+":"":"-")+Math.pow(10,Math.max(0,i)).toString().substr(1)+r}var L=/(\[[^\[]*\])|(\\)?([Hh]mm(ss)?|Mo|MM?M?M?|Do|DDDo|DD?D?D?|ddd?d?|do?|w[o|w]?|W[o|W]?|Qo?|N{1,5}|YYYYYY|YYYYY|YYYY|YY|y{2,4}|yo?|gg(ggg?)?|GG(GGG?)?|e|E|a|A|hh?|HH?|kk?|mm?|ss?|S{1,9}|x|X|zz?|ZZ?|.)/g,j=/(\[[^\[]*\])|(\\)?(LTS|LT|LL?L?L?|l{1,4})/g,F={},z={};function W(e,t,n,r){var i=r;"string"===typeof r&&(i=function(){return this[r]()}),e&&(z[e]=i),t&&(z[t[0]]=function(){return I(i.apply(this,arguments),t[1],t[2])}),n&&(z[n]=function(){return this.localeData().ordinal(i.apply(this,arguments),e)})}function Y(e){return e.match(/\[[\s\S]/)?e.replace(/^\[|\]$/g,""):e.replace(/\\/g,"")}function H(e){var t,n,r=e.match(L);for(t=0,n=r.length;t<n;t++)z[r[t]]?r[t]=z[r[t]]:r[t]=Y(r[t]);return function(t){var i,a="";for(i=0;i<n;i++)a+=P(r[i])?r[i].call(t,e):r[i];return a}}function U(e,t){return e.isValid()?(t=V(t,e.localeData()),F[t]=F[t]||H(t),F[t](e)):e.localeData().invalidDate()}function V(e,t){var n=5;function r(e){return t.longDateFormat(e)||e}for(j.lastIndex=0;n>=0&&j.test(e);)e=e.replace(j,r),j.lastIndex=0,n-=1;return e}var B={LTS:"h:mm:ss A",LT:"h:mm A",L:"MM/DD/YYYY",LL:"MMMM D, YYYY",LLL:"MMMM D, YYYY h:mm A",LLLL:"dddd, MMMM D, YYYY h:mm A"};function $(e){var t=this._longDateFormat[e],n=this._longDateFormat[e.toUpperCase()];return t||!n?t:(this._longDateFormat[e]=n.match(L).map((function(e){return"MMMM"===e||"MM"===e||"DD"===e||"dddd"===e?e.slice(1):e})).join(""),this._longDateFormat[e])}var X="Invalid date";function q(){return this._invalidDate}var G="%d",K=/\d{1,2}/;function Q(e){return this._ordinal.replace("%d",e)}var Z={future:"in %s",past:"%s ago",s:"a few seconds",ss:"%d seconds",m:"a minute",mm:"%d minutes",h:"an hour",hh:"%d hours",d:"a day",dd:"%d days",w:"a week",ww:"%d weeks",M:"a month",MM:"%d months",y:"a year",yy:"%d years"};function J(e,t,n,r){var i=this._relativeTime[n];return P(i)?i(e,t,n,r):i.replace(/%d/i,e)}function ee(e,t){var n=this._relativeTime[e>0?"future":"past"];return P(n)?n(t):n.replace(/%s/i,t)}var te={};function ne(e,t){var n=e.toLowerCase();te[n]=te[n+"s"]=te[t]=e}function re(e){return"string"===typeof e?te[e]||te[e.toLowerCase()]:void 0}function ie(e){var t,n,r={};for(n in e)l(e,n)&&(t=re(n))&&(r[t]=e[n]);return r}var ae={};function oe(e,t){ae[e]=t}function le(e){var t,n=[];for(t in e)l(e,t)&&n.push({unit:t,priority:ae[t]});return n.sort((function(e,t){return e.priority-t.priority})),n}function se(e){return e%4===0&&e%100!==0||e%400===0}function ue(e){return e<0?Math.ceil(e)||0:Math.floor(e)}function ce(e){var t=+e,n=0;return 0!==t&&isFinite(t)&&(n=ue(t)),n}function de(e,t){return function(n){return null!=n?(he(this,e,n),r.updateOffset(this,t),this):fe(this,e)}}function fe(e,t){return e.isValid()?e._d["get"+(e._isUTC?"UTC":"")+t]():NaN}function he(e,t,n){e.isValid()&&!isNaN(n)&&("FullYear"===t&&se(e.year())&&1===e.month()&&29===e.date()?(n=ce(n),e._d["set"+(e._isUTC?"UTC":"")+t](n,e.month(),Je(n,e.month()))):e._d["set"+(e._isUTC?"UTC":"")+t](n))}function pe(e){return P(this[e=re(e)])?this[e]():this}function ge(e,t){if("object"===typeof e){var n,r=le(e=ie(e));for(n=0;n<r.length;n++)this[r[n].unit](e[r[n].unit])}else if(P(this[e=re(e)]))return this[e](t);return this}var me,ve=/\d/,ye=/\d\d/,be=/\d{3}/,xe=/\d{4}/,we=/[+-]?\d{6}/,_e=/\d\d?/,ke=/\d\d\d\d?/,Se=/\d\d\d\d\d\d?/,Me=/\d{1,3}/,Ce=/\d{1,4}/,Ee=/[+-]?\d{1,6}/,Oe=/\d+/,Pe=/[+-]?\d+/,Te=/Z|[+-]\d\d:?\d\d/gi,De=/Z|[+-]\d\d(?::?\d\d)?/gi,Ne=/[+-]?\d+(\.\d{1,3})?/,Re=/[0-9]{0,256}['a-z\u00A0-\u05FF\u0700-\uD7FF\uF900-\uFDCF\uFDF0-\uFF07\uFF10-\uFFEF]{1,256}|[\u0600-\u06FF\/]{1,256}(\s*?[\u0600-\u06FF]{1,256}){1,2}/i;function Ae(e,t,n){me[e]=P(t)?t:function(e,r){return e&&n?n:t}}function Ie(e,t){return l(me,e)?me[e](t._strict,t._locale):new RegExp(Le(e))}function Le(e){return je(e.replace("\\","").replace(/\\(\[)|\\(\])|\[([^\]\[]*)\]|\\(.)/g,(function(e,t,n,r,i){return t||n||r||i})))}function je(e){return e.replace(/[-\/\\^$*+?.()|[\]{}]/g,"\\$&")}me={};var Fe={};function ze(e,t){var n,r=t;for("string"===typeof e&&(e=[e]),c(t)&&(r=function(e,n){n[t]=ce(e)}),n=0;n<e.length;n++)Fe[e[n]]=r}function We(e,t){ze(e,(function(e,n,r,i){r._w=r._w||{},t(e,r._w,r,i)}))}function Ye(e,t,n){null!=t&&l(Fe,e)&&Fe[e](t,n._a,n,e)}var He,Ue=0,Ve=1,Be=2,$e=3,Xe=4,qe=5,Ge=6,Ke=7,Qe=8;function Ze(e,t){return(e%t+t)%t}function Je(e,t){if(isNaN(e)||isNaN(t))return NaN;var n=Ze(t,12);return e+=(t-n)/12,1===n?se(e)?29:28:31-n%7%2}He=Array.prototype.indexOf?Array.prototype.indexOf:function(e){var t;for(t=0;t<this.length;++t)if(this[t]===e)return t;return-1},W("M",["MM",2],"Mo",(function(){return this.month()+1})),W("MMM",0,0,(function(e){return this.localeData().monthsShort(this,e)})),W("MMMM",0,0,(function(e){return this.localeData().months(this,e)})),ne("month","M"),oe("month",8),Ae("M",_e),Ae("MM",_e,ye),Ae("MMM",(function(e,t){return t.monthsShortRegex(e)})),Ae("MMMM",(function(e,t){return t.monthsRegex(e)})),ze(["M","MM"],(function(e,t){t[Ve]=ce(e)-1})),ze(["MMM","MMMM"],(function(e,t,n,r){var i=n._locale.monthsParse(e,r,n._strict);null!=i?t[Ve]=i:m(n).invalidMonth=e}));var et="January_February_March_April_May_June_July_August_September_October_November_December".split("_"),tt="Jan_Feb_Mar_Apr_May_Jun_Jul_Aug_Sep_Oct_Nov_Dec".split("_"),nt=/D[oD]?(\[[^\[\]]*\]|\s)+MMMM?/,rt=Re,it=Re;function at(e,t){return e?a(this._months)?this._months[e.month()]:this._months[(this._months.isFormat||nt).test(t)?"format":"standalone"][e.month()]:a(this._months)?this._months:this._months.standalone}function ot(e,t){return e?a(this._monthsShort)?this._monthsShort[e.month()]:this._monthsShort[nt.test(t)?"format":"standalone"][e.month()]:a(this._monthsShort)?this._monthsShort:this._monthsShort.standalone}function lt(e,t,n){var r,i,a,o=e.toLocaleLowerCase();if(!this._monthsParse)for(this._monthsParse=[],this._longMonthsParse=[],this._shortMonthsParse=[],r=0;r<12;++r)a=p([2e3,r]),this._shortMonthsParse[r]=this.monthsShort(a,"").toLocaleLowerCase(),this._longMonthsParse[r]=this.months(a,"").toLocaleLowerCase();return n?"MMM"===t?-1!==(i=He.call(this._shortMonthsParse,o))?i:null:-1!==(i=He.call(this._longMonthsParse,o))?i:null:"MMM"===t?-1!==(i=He.call(this._shortMonthsParse,o))||-1!==(i=He.call(this._longMonthsParse,o))?i:null:-1!==(i=He.call(this._longMonthsParse,o))||-1!==(i=He.call(this._shortMonthsParse,o))?i:null}function st(e,t,n){var r,i,a;if(this._monthsParseExact)return lt.call(this,e,t,n);for(this._monthsParse||(this._monthsParse=[],this._longMonthsParse=[],this._shortMonthsParse=[]),r=0;r<12;r++){if(i=p([2e3,r]),n&&!this._longMonthsParse[r]&&(this._longMonthsParse[r]=new RegExp("^"+this.months(i,"").replace(".","")+"$","i"),this._shortMonthsParse[r]=new RegExp("^"+this.monthsShort(i,"").replace(".","")+"$","i")),n||this._monthsParse[r]||(a="^"+this.months(i,"")+"|^"+this.monthsShort(i,""),this._monthsParse[r]=new RegExp(a.replace(".",""),"i")),n&&"MMMM"===t&&this._longMonthsParse[r].test(e))return r;if(n&&"MMM"===t&&this._shortMonthsParse[r].test(e))return r;if(!n&&this._monthsParse[r].test(e))return r}}function ut(e,t){var n;if(!e.isValid())return e;if("string"===typeof t)if(/^\d+$/.test(t))t=ce(t);else if(!c(t=e.localeData().monthsParse(t)))return e;return n=Math.min(e.date(),Je(e.year(),t)),e._d["set"+(e._isUTC?"UTC":"")+"Month"](t,n),e}function ct(e){return null!=e?(ut(this,e),r.updateOffset(this,!0),this):fe(this,"Month")}function dt(){return Je(this.year(),this.month())}function ft(e){return this._monthsParseExact?(l(this,"_monthsRegex")||pt.call(this),e?this._monthsShortStrictRegex:this._monthsShortRegex):(l(this,"_monthsShortRegex")||(this._monthsShortRegex=rt),this._monthsShortStrictRegex&&e?this._monthsShortStrictRegex:this._monthsShortRegex)}function ht(e){return this._monthsParseExact?(l(this,"_monthsRegex")||pt.call(this),e?this._monthsStrictRegex:this._monthsRegex):(l(this,"_monthsRegex")||(this._monthsRegex=it),this._monthsStrictRegex&&e?this._monthsStrictRegex:this._monthsRegex)}function pt(){function e(e,t){return t.length-e.length}var t,n,r=[],i=[],a=[];for(t=0;t<12;t++)n=p([2e3,t]),r.push(this.monthsShort(n,"")),i.push(this.months(n,"")),a.push(this.months(n,"")),a.push(this.monthsShort(n,""));for(r.sort(e),i.sort(e),a.sort(e),t=0;t<12;t++)r[t]=je(r[t]),i[t]=je(i[t]);for(t=0;t<24;t++)a[t]=je(a[t]);this._monthsRegex=new RegExp("^("+a.join("|")+")","i"),this._monthsShortRegex=this._monthsRegex,this._monthsStrictRegex=new RegExp("^("+i.join("|")+")","i"),this._monthsShortStrictRegex=new RegExp("^("+r.join("|")+")","i")}function gt(e){return se(e)?366:365}W("Y",0,0,(function(){var e=this.year();return e<=9999?I(e,4):"+"+e})),W(0,["YY",2],0,(function(){return this.year()%100})),W(0,["YYYY",4],0,"year"),W(0,["YYYYY",5],0,"year"),W(0,["YYYYYY",6,!0],0,"year"),ne("year","y"),oe("year",1),Ae("Y",Pe),Ae("YY",_e,ye),Ae("YYYY",Ce,xe),Ae("YYYYY",Ee,we),Ae("YYYYYY",Ee,we),ze(["YYYYY","YYYYYY"],Ue),ze("YYYY",(function(e,t){t[Ue]=2===e.length?r.parseTwoDigitYear(e):ce(e)})),ze("YY",(function(e,t){t[Ue]=r.parseTwoDigitYear(e)})),ze("Y",(function(e,t){t[Ue]=parseInt(e,10)})),r.parseTwoDigitYear=function(e){return ce(e)+(ce(e)>68?1900:2e3)};var mt=de("FullYear",!0);function vt(){return se(this.year())}function yt(e,t,n,r,i,a,o){var l;return e<100&&e>=0?(l=new Date(e+400,t,n,r,i,a,o),isFinite(l.getFullYear())&&l.setFullYear(e)):l=new Date(e,t,n,r,i,a,o),l}function bt(e){var t,n;return e<100&&e>=0?((n=Array.prototype.slice.call(arguments))[0]=e+400,t=new Date(Date.UTC.apply(null,n)),isFinite(t.getUTCFullYear())&&t.setUTCFullYear(e)):t=new Date(Date.UTC.apply(null,arguments)),t}function xt(e,t,n){var r=7+t-n;return-(7+bt(e,0,r).getUTCDay()-t)%7+r-1}function wt(e,t,n,r,i){var a,o,l=1+7*(t-1)+(7+n-r)%7+xt(e,r,i);return l<=0?o=gt(a=e-1)+l:l>gt(e)?(a=e+1,o=l-gt(e)):(a=e,o=l),{year:a,dayOfYear:o}}function _t(e,t,n){var r,i,a=xt(e.year(),t,n),o=Math.floor((e.dayOfYear()-a-1)/7)+1;return o<1?r=o+kt(i=e.year()-1,t,n):o>kt(e.year(),t,n)?(r=o-kt(e.year(),t,n),i=e.year()+1):(i=e.year(),r=o),{week:r,year:i}}function kt(e,t,n){var r=xt(e,t,n),i=xt(e+1,t,n);return(gt(e)-r+i)/7}function St(e){return _t(e,this._week.dow,this._week.doy).week}W("w",["ww",2],"wo","week"),W("W",["WW",2],"Wo","isoWeek"),ne("week","w"),ne("isoWeek","W"),oe("week",5),oe("isoWeek",5),Ae("w",_e),Ae("ww",_e,ye),Ae("W",_e),Ae("WW",_e,ye),We(["w","ww","W","WW"],(function(e,t,n,r){t[r.substr(0,1)]=ce(e)}));var Mt={dow:0,doy:6};function Ct(){return this._week.dow}function Et(){return this._week.doy}function Ot(e){var t=this.localeData().week(this);return null==e?t:this.add(7*(e-t),"d")}function Pt(e){var t=_t(this,1,4).week;return null==e?t:this.add(7*(e-t),"d")}function Tt(e,t){return"string"!==typeof e?e:isNaN(e)?"number"===typeof(e=t.weekdaysParse(e))?e:null:parseInt(e,10)}function Dt(e,t){return"string"===typeof e?t.weekdaysParse(e)%7||7:isNaN(e)?null:e}function Nt(e,t){return e.slice(t,7).concat(e.slice(0,t))}W("d",0,"do","day"),W("dd",0,0,(function(e){return this.localeData().weekdaysMin(this,e)})),W("ddd",0,0,(function(e){return this.localeData().weekdaysShort(this,e)})),W("dddd",0,0,(function(e){return this.localeData().weekdays(this,e)})),W("e",0,0,"weekday"),W("E",0,0,"isoWeekday"),ne("day","d"),ne("weekday","e"),ne("isoWeekday","E"),oe("day",11),oe("weekday",11),oe("isoWeekday",11),Ae("d",_e),Ae("e",_e),Ae("E",_e),Ae("dd",(function(e,t){return t.weekdaysMinRegex(e)})),Ae("ddd",(function(e,t){return t.weekdaysShortRegex(e)})),Ae("dddd",(function(e,t){return t.weekdaysRegex(e)})),We(["dd","ddd","dddd"],(function(e,t,n,r){var i=n._locale.weekdaysParse(e,r,n._strict);null!=i?t.d=i:m(n).invalidWeekday=e})),We(["d","e","E"],(function(e,t,n,r){t[r]=ce(e)}));var Rt="Sunday_Monday_Tuesday_Wednesday_Thursday_Friday_Saturday".split("_"),At="Sun_Mon_Tue_Wed_Thu_Fri_Sat".split("_"),It="Su_Mo_Tu_We_Th_Fr_Sa".split("_"),Lt=Re,jt=Re,Ft=Re;function zt(e,t){var n=a(this._weekdays)?this._weekdays:this._weekdays[e&&!0!==e&&this._weekdays.isFormat.test(t)?"format":"standalone"];return!0===e?Nt(n,this._week.dow):e?n[e.day()]:n}function Wt(e){return!0===e?Nt(this._weekdaysShort,this._week.dow):e?this._weekdaysShort[e.day()]:this._weekdaysShort}function Yt(e){return!0===e?Nt(this._weekdaysMin,this._week.dow):e?this._weekdaysMin[e.day()]:this._weekdaysMin}function Ht(e,t,n){var r,i,a,o=e.toLocaleLowerCase();if(!this._weekdaysParse)for(this._weekdaysParse=[],this._shortWeekdaysParse=[],this._minWeekdaysParse=[],r=0;r<7;++r)a=p([2e3,1]).day(r),this._minWeekdaysParse[r]=this.weekdaysMin(a,"").toLocaleLowerCase(),this._shortWeekdaysParse[r]=this.weekdaysShort(a,"").toLocaleLowerCase(),this._weekdaysParse[r]=this.weekdays(a,"").toLocaleLowerCase();return n?"dddd"===t?-1!==(i=He.call(this._weekdaysParse,o))?i:null:"ddd"===t?-1!==(i=He.call(this._shortWeekdaysParse,o))?i:null:-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:"dddd"===t?-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._shortWeekdaysParse,o))||-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:"ddd"===t?-1!==(i=He.call(this._shortWeekdaysParse,o))||-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:-1!==(i=He.call(this._minWeekdaysParse,o))||-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._shortWeekdaysParse,o))?i:null}function Ut(e,t,n){var r,i,a;if(this._weekdaysParseExact)return Ht.call(this,e,t,n);for(this._weekdaysParse||(this._weekdaysParse=[],this._minWeekdaysParse=[],this._shortWeekdaysParse=[],this._fullWeekdaysParse=[]),r=0;r<7;r++){if(i=p([2e3,1]).day(r),n&&!this._fullWeekdaysParse[r]&&(this._fullWeekdaysParse[r]=new RegExp("^"+this.weekdays(i,"").replace(".","\\.?")+"$","i"),this._shortWeekdaysParse[r]=new RegExp("^"+this.weekdaysShort(i,"").replace(".","\\.?")+"$","i"),this._minWeekdaysParse[r]=new RegExp("^"+this.weekdaysMin(i,"").replace(".","\\.?")+"$","i")),this._weekdaysParse[r]||(a="^"+this.weekdays(i,"")+"|^"+this.weekdaysShort(i,"")+"|^"+this.weekdaysMin(i,""),this._weekdaysParse[r]=new RegExp(a.replace(".",""),"i")),n&&"dddd"===t&&this._fullWeekdaysParse[r].test(e))return r;if(n&&"ddd"===t&&this._shortWeekdaysParse[r].test(e))return r;if(n&&"dd"===t&&this._minWeekdaysParse[r].test(e))return r;if(!n&&this._weekdaysParse[r].test(e))return r}}function Vt(e){if(!this.isValid())return null!=e?this:NaN;var t=this._isUTC?this._d.getUTCDay():this._d.getDay();return null!=e?(e=Tt(e,this.localeData()),this.add(e-t,"d")):t}function Bt(e){if(!this.isValid())return null!=e?this:NaN;var t=(this.day()+7-this.localeData()._week.dow)%7;return null==e?t:this.add(e-t,"d")}function $t(e){if(!this.isValid())return null!=e?this:NaN;if(null!=e){var t=Dt(e,this.localeData());return this.day(this.day()%7?t:t-7)}return this.day()||7}function Xt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysStrictRegex:this._weekdaysRegex):(l(this,"_weekdaysRegex")||(this._weekdaysRegex=Lt),this._weekdaysStrictRegex&&e?this._weekdaysStrictRegex:this._weekdaysRegex)}function qt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysShortStrictRegex:this._weekdaysShortRegex):(l(this,"_weekdaysShortRegex")||(this._weekdaysShortRegex=jt),this._weekdaysShortStrictRegex&&e?this._weekdaysShortStrictRegex:this._weekdaysShortRegex)}function Gt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysMinStrictRegex:this._weekdaysMinRegex):(l(this,"_weekdaysMinRegex")||(this._weekdaysMinRegex=Ft),this._weekdaysMinStrictRegex&&e?this._weekdaysMinStrictRegex:this._weekdaysMinRegex)}function Kt(){function e(e,t){return t.length-e.length}var t,n,r,i,a,o=[],l=[],s=[],u=[];for(t=0;t<7;t++)n=p([2e3,1]).day(t),r=je(this.weekdaysMin(n,"")),i=je(this.weekdaysShort(n,"")),a=je(this.weekdays(n,"")),o.push(r),l.push(i),s.push(a),u.push(r),u.push(i),u.push(a);o.sort(e),l.sort(e),s.sort(e),u.sort(e),this._weekdaysRegex=new RegExp("^("+u.join("|")+")","i"),this._weekdaysShortRegex=this._weekdaysRegex,this._weekdaysMinRegex=this._weekdaysRegex,this._weekdaysStrictRegex=new RegExp("^("+s.join("|")+")","i"),this._weekdaysShortStrictRegex=new RegExp("^("+l.join("|")+")","i"),this._weekdaysMinStrictRegex=new RegExp("^("+o.join("|")+")","i")}function Qt(){return this.hours()%12||12}function Zt(){return this.hours()||24}function Jt(e,t){W(e,0,0,(function(){return this.localeData().meridiem(this.hours(),this.minutes(),t)}))}function en(e,t){return t._meridiemParse}function tn(e){return"p"===(e+"").toLowerCase().charAt(0)}W("H",["HH",2],0,"hour"),W("h",["hh",2],0,Qt),W("k",["kk",2],0,Zt),W("hmm",0,0,(function(){return""+Qt.apply(this)+I(this.minutes(),2)})),W("hmmss",0,0,(function(){return""+Qt.apply(this)+I(this.minutes(),2)+I(this.seconds(),2)})),W("Hmm",0,0,(function(){return""+this.hours()+I(this.minutes(),2)})),W("Hmmss",0,0,(function(){return""+this.hours()+I(this.minutes(),2)+I(this.seconds(),2)})),Jt("a",!0),Jt("A",!1),ne("hour","h"),oe("hour",13),Ae("a",en),Ae("A",en),Ae("H",_e),Ae("h",_e),Ae("k",_e),Ae("HH",_e,ye),Ae("hh",_e,ye),Ae("kk",_e,ye),Ae("hmm",ke),Ae("hmmss",Se),Ae("Hmm",ke),Ae("Hmmss",Se),ze(["H","HH"],$e),ze(["k","kk"],(function(e,t,n){var r=ce(e);t[$e]=24===r?0:r})),ze(["a","A"],(function(e,t,n){n._isPm=n._locale.isPM(e),n._meridiem=e})),ze(["h","hh"],(function(e,t,n){t[$e]=ce(e),m(n).bigHour=!0})),ze("hmm",(function(e,t,n){var r=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r)),m(n).bigHour=!0})),ze("hmmss",(function(e,t,n){var r=e.length-4,i=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r,2)),t[qe]=ce(e.substr(i)),m(n).bigHour=!0})),ze("Hmm",(function(e,t,n){var r=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r))})),ze("Hmmss",(function(e,t,n){var r=e.length-4,i=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r,2)),t[qe]=ce(e.substr(i))}));var nn=/[ap]\.?m?\.?/i,rn=de("Hours",!0);function an(e,t,n){return e>11?n?"pm":"PM":n?"am":"AM"}var on,ln={calendar:R,longDateFormat:B,invalidDate:X,ordinal:G,dayOfMonthOrdinalParse:K,relativeTime:Z,months:et,monthsShort:tt,week:Mt,weekdays:Rt,weekdaysMin:It,weekdaysShort:At,meridiemParse:nn},sn={},un={};function cn(e,t){var n,r=Math.min(e.length,t.length);for(n=0;n<r;n+=1)if(e[n]!==t[n])return n;return r}function dn(e){return e?e.toLowerCase().replace("_","-"):e}function fn(e){for(var t,n,r,i,a=0;a<e.length;){for(t=(i=dn(e[a]).split("-")).length,n=(n=dn(e[a+1]))?n.split("-"):null;t>0;){if(r=hn(i.slice(0,t).join("-")))return r;if(n&&n.length>=t&&cn(i,n)>=t-1)break;t--}a++}return on}function hn(t){var n=null;if(void 0===sn[t]&&"undefined"!==typeof e&&e&&e.exports)try{n=on._abbr,function(){var e=new Error("Cannot find module 'undefined'");throw e.code="MODULE_NOT_FOUND",e}(),pn(n)}catch(r){sn[t]=null}return sn[t]}function pn(e,t){var n;return e&&((n=u(t)?vn(e):gn(e,t))?on=n:"undefined"!==typeof console&&console.warn&&console.warn("Locale "+e+" not found. Did you forget to load it?")),on._abbr}function gn(e,t){if(null!==t){var n,r=ln;if(t.abbr=e,null!=sn[e])O("defineLocaleOverride","use moment.updateLocale(localeName, config) to change an existing locale. moment.defineLocale(localeName, config) should only be used for creating a new locale See http://momentjs.com/guides/#/warnings/define-locale/ for more info."),r=sn[e]._config;else if(null!=t.parentLocale)if(null!=sn[t.parentLocale])r=sn[t.parentLocale]._config;else{if(null==(n=hn(t.parentLocale)))return un[t.parentLocale]||(un[t.parentLocale]=[]),un[t.parentLocale].push({name:e,config:t}),null;r=n._config}return sn[e]=new N(D(r,t)),un[e]&&un[e].forEach((function(e){gn(e.name,e.config)})),pn(e),sn[e]}return delete sn[e],null}function mn(e,t){if(null!=t){var n,r,i=ln;null!=sn[e]&&null!=sn[e].parentLocale?sn[e].set(D(sn[e]._config,t)):(null!=(r=hn(e))&&(i=r._config),t=D(i,t),null==r&&(t.abbr=e),(n=new N(t)).parentLocale=sn[e],sn[e]=n),pn(e)}else null!=sn[e]&&(null!=sn[e].parentLocale?(sn[e]=sn[e].parentLocale,e===pn()&&pn(e)):null!=sn[e]&&delete sn[e]);return sn[e]}function vn(e){var t;if(e&&e._locale&&e._locale._abbr&&(e=e._locale._abbr),!e)return on;if(!a(e)){if(t=hn(e))return t;e=[e]}return fn(e)}function yn(){return C(sn)}function bn(e){var t,n=e._a;return n&&-2===m(e).overflow&&(t=n[Ve]<0||n[Ve]>11?Ve:n[Be]<1||n[Be]>Je(n[Ue],n[Ve])?Be:n[$e]<0||n[$e]>24||24===n[$e]&&(0!==n[Xe]||0!==n[qe]||0!==n[Ge])?$e:n[Xe]<0||n[Xe]>59?Xe:n[qe]<0||n[qe]>59?qe:n[Ge]<0||n[Ge]>999?Ge:-1,m(e)._overflowDayOfYear&&(t<Ue||t>Be)&&(t=Be),m(e)._overflowWeeks&&-1===t&&(t=Ke),m(e)._overflowWeekday&&-1===t&&(t=Qe),m(e).overflow=t),e}var xn=/^\s*((?:[+-]\d{6}|\d{4})-(?:\d\d-\d\d|W\d\d-\d|W\d\d|\d\d\d|\d\d))(?:(T| )(\d\d(?::\d\d(?::\d\d(?:[.,]\d+)?)?)?)([+-]\d\d(?::?\d\d)?|\s*Z)?)?$/,wn=/^\s*((?:[+-]\d{6}|\d{4})(?:\d\d\d\d|W\d\d\d|W\d\d|\d\d\d|\d\d|))(?:(T| )(\d\d(?:\d\d(?:\d\d(?:[.,]\d+)?)?)?)([+-]\d\d(?::?\d\d)?|\s*Z)?)?$/,_n=/Z|[+-]\d\d(?::?\d\d)?/,kn=[["YYYYYY-MM-DD",/[+-]\d{6}-\d\d-\d\d/],["YYYY-MM-DD",/\d{4}-\d\d-\d\d/],["GGGG-[W]WW-E",/\d{4}-W\d\d-\d/],["GGGG-[W]WW",/\d{4}-W\d\d/,!1],["YYYY-DDD",/\d{4}-\d{3}/],["YYYY-MM",/\d{4}-\d\d/,!1],["YYYYYYMMDD",/[+-]\d{10}/],["YYYYMMDD",/\d{8}/],["GGGG[W]WWE",/\d{4}W\d{3}/],["GGGG[W]WW",/\d{4}W\d{2}/,!1],["YYYYDDD",/\d{7}/],["YYYYMM",/\d{6}/,!1],["YYYY",/\d{4}/,!1]],Sn=[["HH:mm:ss.SSSS",/\d\d:\d\d:\d\d\.\d+/],["HH:mm:ss,SSSS",/\d\d:\d\d:\d\d,\d+/],["HH:mm:ss",/\d\d:\d\d:\d\d/],["HH:mm",/\d\d:\d\d/],["HHmmss.SSSS",/\d\d\d\d\d\d\.\d+/],["HHmmss,SSSS",/\d\d\d\d\d\d,\d+/],["HHmmss",/\d\d\d\d\d\d/],["HHmm",/\d\d\d\d/],["HH",/\d\d/]],Mn=/^\/?Date\((-?\d+)/i,Cn=/^(?:(Mon|Tue|Wed|Thu|Fri|Sat|Sun),?\s)?(\d{1,2})\s(Jan|Feb|Mar|Apr|May|Jun|Jul|Aug|Sep|Oct|Nov|Dec)\s(\d{2,4})\s(\d\d):(\d\d)(?::(\d\d))?\s(?:(UT|GMT|[ECMP][SD]T)|([Zz])|([+-]\d{4}))$/,En={UT:0,GMT:0,EDT:-240,EST:-300,CDT:-300,CST:-360,MDT:-360,MST:-420,PDT:-420,PST:-480};function On(e){var t,n,r,i,a,o,l=e._i,s=xn.exec(l)||wn.exec(l);if(s){for(m(e).iso=!0,t=0,n=kn.length;t<n;t++)if(kn[t][1].exec(s[1])){i=kn[t][0],r=!1!==kn[t][2];break}if(null==i)return void(e._isValid=!1);if(s[3]){for(t=0,n=Sn.length;t<n;t++)if(Sn[t][1].exec(s[3])){a=(s[2]||" ")+Sn[t][0];break}if(null==a)return void(e._isValid=!1)}if(!r&&null!=a)return void(e._isValid=!1);if(s[4]){if(!_n.exec(s[4]))return void(e._isValid=!1);o="Z"}e._f=i+(a||"")+(o||""),Wn(e)}else e._isValid=!1}function Pn(e,t,n,r,i,a){var o=[Tn(e),tt.indexOf(t),parseInt(n,10),parseInt(r,10),parseInt(i,10)];return a&&o.push(parseInt(a,10)),o}function Tn(e){var t=parseInt(e,10);return t<=49?2e3+t:t<=999?1900+t:t}function Dn(e){return e.replace(/\([^)]*\)|[\n\t]/g," ").replace(/(\s\s+)/g," ").replace(/^\s\s*/,"").replace(/\s\s*$/,"")}function Nn(e,t,n){return!e||At.indexOf(e)===new Date(t[0],t[1],t[2]).getDay()||(m(n).weekdayMismatch=!0,n._isValid=!1,!1)}function Rn(e,t,n){if(e)return En[e];if(t)return 0;var r=parseInt(n,10),i=r%100;return(r-i)/100*60+i}function An(e){var t,n=Cn.exec(Dn(e._i));if(n){if(t=Pn(n[4],n[3],n[2],n[5],n[6],n[7]),!Nn(n[1],t,e))return;e._a=t,e._tzm=Rn(n[8],n[9],n[10]),e._d=bt.apply(null,e._a),e._d.setUTCMinutes(e._d.getUTCMinutes()-e._tzm),m(e).rfc2822=!0}else e._isValid=!1}function In(e){var t=Mn.exec(e._i);null===t?(On(e),!1===e._isValid&&(delete e._isValid,An(e),!1===e._isValid&&(delete e._isValid,e._strict?e._isValid=!1:r.createFromInputFallback(e)))):e._d=new Date(+t[1])}function Ln(e,t,n){return null!=e?e:null!=t?t:n}function jn(e){var t=new Date(r.now());return e._useUTC?[t.getUTCFullYear(),t.getUTCMonth(),t.getUTCDate()]:[t.getFullYear(),t.getMonth(),t.getDate()]}function Fn(e){var t,n,r,i,a,o=[];if(!e._d){for(r=jn(e),e._w&&null==e._a[Be]&&null==e._a[Ve]&&zn(e),null!=e._dayOfYear&&(a=Ln(e._a[Ue],r[Ue]),(e._dayOfYear>gt(a)||0===e._dayOfYear)&&(m(e)._overflowDayOfYear=!0),n=bt(a,0,e._dayOfYear),e._a[Ve]=n.getUTCMonth(),e._a[Be]=n.getUTCDate()),t=0;t<3&&null==e._a[t];++t)e._a[t]=o[t]=r[t];for(;t<7;t++)e._a[t]=o[t]=null==e._a[t]?2===t?1:0:e._a[t];24===e._a[$e]&&0===e._a[Xe]&&0===e._a[qe]&&0===e._a[Ge]&&(e._nextDay=!0,e._a[$e]=0),e._d=(e._useUTC?bt:yt).apply(null,o),i=e._useUTC?e._d.getUTCDay():e._d.getDay(),null!=e._tzm&&e._d.setUTCMinutes(e._d.getUTCMinutes()-e._tzm),e._nextDay&&(e._a[$e]=24),e._w&&"undefined"!==typeof e._w.d&&e._w.d!==i&&(m(e).weekdayMismatch=!0)}}function zn(e){var t,n,r,i,a,o,l,s,u;null!=(t=e._w).GG||null!=t.W||null!=t.E?(a=1,o=4,n=Ln(t.GG,e._a[Ue],_t(qn(),1,4).year),r=Ln(t.W,1),((i=Ln(t.E,1))<1||i>7)&&(s=!0)):(a=e._locale._week.dow,o=e._locale._week.doy,u=_t(qn(),a,o),n=Ln(t.gg,e._a[Ue],u.year),r=Ln(t.w,u.week),null!=t.d?((i=t.d)<0||i>6)&&(s=!0):null!=t.e?(i=t.e+a,(t.e<0||t.e>6)&&(s=!0)):i=a),r<1||r>kt(n,a,o)?m(e)._overflowWeeks=!0:null!=s?m(e)._overflowWeekday=!0:(l=wt(n,r,i,a,o),e._a[Ue]=l.year,e._dayOfYear=l.dayOfYear)}function Wn(e){if(e._f!==r.ISO_8601)if(e._f!==r.RFC_2822){e._a=[],m(e).empty=!0;var t,n,i,a,o,l,s=""+e._i,u=s.length,c=0;for(i=V(e._f,e._locale).match(L)||[],t=0;t<i.length;t++)a=i[t],(n=(s.match(Ie(a,e))||[])[0])&&((o=s.substr(0,s.indexOf(n))).length>0&&m(e).unusedInput.push(o),s=s.slice(s.indexOf(n)+n.length),c+=n.length),z[a]?(n?m(e).empty=!1:m(e).unusedTokens.push(a),Ye(a,n,e)):e._strict&&!n&&m(e).unusedTokens.push(a);m(e).charsLeftOver=u-c,s.length>0&&m(e).unusedInput.push(s),e._a[$e]<=12&&!0===m(e).bigHour&&e._a[$e]>0&&(m(e).bigHour=void 0),m(e).parsedDateParts=e._a.slice(0),m(e).meridiem=e._meridiem,e._a[$e]=Yn(e._locale,e._a[$e],e._meridiem),null!==(l=m(e).era)&&(e._a[Ue]=e._locale.erasConvertYear(l,e._a[Ue])),Fn(e),bn(e)}else An(e);else On(e)}function Yn(e,t,n){var r;return null==n?t:null!=e.meridiemHour?e.meridiemHour(t,n):null!=e.isPM?((r=e.isPM(n))&&t<12&&(t+=12),r||12!==t||(t=0),t):t}function Hn(e){var t,n,r,i,a,o,l=!1;if(0===e._f.length)return m(e).invalidFormat=!0,void(e._d=new Date(NaN));for(i=0;i<e._f.length;i++)a=0,o=!1,t=w({},e),null!=e._useUTC&&(t._useUTC=e._useUTC),t._f=e._f[i],Wn(t),v(t)&&(o=!0),a+=m(t).charsLeftOver,a+=10*m(t).unusedTokens.length,m(t).score=a,l?a<r&&(r=a,n=t):(null==r||a<r||o)&&(r=a,n=t,o&&(l=!0));h(e,n||t)}function Un(e){if(!e._d){var t=ie(e._i),n=void 0===t.day?t.date:t.day;e._a=f([t.year,t.month,n,t.hour,t.minute,t.second,t.millisecond],(function(e){return e&&parseInt(e,10)})),Fn(e)}}function Vn(e){var t=new _(bn(Bn(e)));return t._nextDay&&(t.add(1,"d"),t._nextDay=void 0),t}function Bn(e){var t=e._i,n=e._f;return e._locale=e._locale||vn(e._l),null===t||void 0===n&&""===t?y({nullInput:!0}):("string"===typeof t&&(e._i=t=e._locale.preparse(t)),k(t)?new _(bn(t)):(d(t)?e._d=t:a(n)?Hn(e):n?Wn(e):$n(e),v(e)||(e._d=null),e))}function $n(e){var t=e._i;u(t)?e._d=new Date(r.now()):d(t)?e._d=new Date(t.valueOf()):"string"===typeof t?In(e):a(t)?(e._a=f(t.slice(0),(function(e){return parseInt(e,10)})),Fn(e)):o(t)?Un(e):c(t)?e._d=new Date(t):r.createFromInputFallback(e)}function Xn(e,t,n,r,i){var l={};return!0!==t&&!1!==t||(r=t,t=void 0),!0!==n&&!1!==n||(r=n,n=void 0),(o(e)&&s(e)||a(e)&&0===e.length)&&(e=void 0),l._isAMomentObject=!0,l._useUTC=l._isUTC=i,l._l=n,l._i=e,l._f=t,l._strict=r,Vn(l)}function qn(e,t,n,r){return Xn(e,t,n,r,!1)}r.createFromInputFallback=M("value provided is not in a recognized RFC2822 or ISO format. moment construction falls back to js Date(), which is not reliable across all browsers and versions. Non RFC2822/ISO date formats are discouraged. Please refer to http://momentjs.com/guides/#/warnings/js-date/ for more info.",(function(e){e._d=new Date(e._i+(e._useUTC?" UTC":""))})),r.ISO_8601=function(){},r.RFC_2822=function(){};var Gn=M("moment().min is deprecated, use moment.max instead. http://momentjs.com/guides/#/warnings/min-max/",(function(){var e=qn.apply(null,arguments);return this.isValid()&&e.isValid()?e<this?this:e:y()})),Kn=M("moment().max is deprecated, use moment.min instead. http://momentjs.com/guides/#/warnings/min-max/",(function(){var e=qn.apply(null,arguments);return this.isValid()&&e.isValid()?e>this?this:e:y()}));function Qn(e,t){var n,r;if(1===t.length&&a(t[0])&&(t=t[0]),!t.length)return qn();for(n=t[0],r=1;r<t.length;++r)t[r].isValid()&&!t[r][e](n)||(n=t[r]);return n}function Zn(){return Qn("isBefore",[].slice.call(arguments,0))}function Jn(){return Qn("isAfter",[].slice.call(arguments,0))}var er=function(){return Date.now?Date.now():+new Date},tr=["year","quarter","month","week","day","hour","minute","second","millisecond"];function nr(e){var t,n,r=!1;for(t in e)if(l(e,t)&&(-1===He.call(tr,t)||null!=e[t]&&isNaN(e[t])))return!1;for(n=0;n<tr.length;++n)if(e[tr[n]]){if(r)return!1;parseFloat(e[tr[n]])!==ce(e[tr[n]])&&(r=!0)}return!0}function rr(){return this._isValid}function ir(){return Er(NaN)}function ar(e){var t=ie(e),n=t.year||0,r=t.quarter||0,i=t.month||0,a=t.week||t.isoWeek||0,o=t.day||0,l=t.hour||0,s=t.minute||0,u=t.second||0,c=t.millisecond||0;this._isValid=nr(t),this._milliseconds=+c+1e3*u+6e4*s+1e3*l*60*60,this._days=+o+7*a,this._months=+i+3*r+12*n,this._data={},this._locale=vn(),this._bubble()}function or(e){return e instanceof ar}function lr(e){return e<0?-1*Math.round(-1*e):Math.round(e)}function sr(e,t,n){var r,i=Math.min(e.length,t.length),a=Math.abs(e.length-t.length),o=0;for(r=0;r<i;r++)(n&&e[r]!==t[r]||!n&&ce(e[r])!==ce(t[r]))&&o++;return o+a}function ur(e,t){W(e,0,0,(function(){var e=this.utcOffset(),n="+";return e<0&&(e=-e,n="-"),n+I(~~(e/60),2)+t+I(~~e%60,2)}))}ur("Z",":"),ur("ZZ",""),Ae("Z",De),Ae("ZZ",De),ze(["Z","ZZ"],(function(e,t,n){n._useUTC=!0,n._tzm=dr(De,e)}));var cr=/([\+\-]|\d\d)/gi;function dr(e,t){var n,r,i=(t||"").match(e);return null===i?null:0===(r=60*(n=((i[i.length-1]||[])+"").match(cr)||["-",0,0])[1]+ce(n[2]))?0:"+"===n[0]?r:-r}function fr(e,t){var n,i;return t._isUTC?(n=t.clone(),i=(k(e)||d(e)?e.valueOf():qn(e).valueOf())-n.valueOf(),n._d.setTime(n._d.valueOf()+i),r.updateOffset(n,!1),n):qn(e).local()}function hr(e){return-Math.round(e._d.getTimezoneOffset())}function pr(e,t,n){var i,a=this._offset||0;if(!this.isValid())return null!=e?this:NaN;if(null!=e){if("string"===typeof e){if(null===(e=dr(De,e)))return this}else Math.abs(e)<16&&!n&&(e*=60);return!this._isUTC&&t&&(i=hr(this)),this._offset=e,this._isUTC=!0,null!=i&&this.add(i,"m"),a!==e&&(!t||this._changeInProgress?Nr(this,Er(e-a,"m"),1,!1):this._changeInProgress||(this._changeInProgress=!0,r.updateOffset(this,!0),this._changeInProgress=null)),this}return this._isUTC?a:hr(this)}function gr(e,t){return null!=e?("string"!==typeof e&&(e=-e),this.utcOffset(e,t),this):-this.utcOffset()}function mr(e){return this.utcOffset(0,e)}function vr(e){return this._isUTC&&(this.utcOffset(0,e),this._isUTC=!1,e&&this.subtract(hr(this),"m")),this}function yr(){if(null!=this._tzm)this.utcOffset(this._tzm,!1,!0);else if("string"===typeof this._i){var e=dr(Te,this._i);null!=e?this.utcOffset(e):this.utcOffset(0,!0)}return this}function br(e){return!!this.isValid()&&(e=e?qn(e).utcOffset():0,(this.utcOffset()-e)%60===0)}function xr(){return this.utcOffset()>this.clone().month(0).utcOffset()||this.utcOffset()>this.clone().month(5).utcOffset()}function wr(){if(!u(this._isDSTShifted))return this._isDSTShifted;var e,t={};return w(t,this),(t=Bn(t))._a?(e=t._isUTC?p(t._a):qn(t._a),this._isDSTShifted=this.isValid()&&sr(t._a,e.toArray())>0):this._isDSTShifted=!1,this._isDSTShifted}function _r(){return!!this.isValid()&&!this._isUTC}function kr(){return!!this.isValid()&&this._isUTC}function Sr(){return!!this.isValid()&&this._isUTC&&0===this._offset}r.updateOffset=function(){};var Mr=/^(-|\+)?(?:(\d*)[. ])?(\d+):(\d+)(?::(\d+)(\.\d*)?)?$/,Cr=/^(-|\+)?P(?:([-+]?[0-9,.]*)Y)?(?:([-+]?[0-9,.]*)M)?(?:([-+]?[0-9,.]*)W)?(?:([-+]?[0-9,.]*)D)?(?:T(?:([-+]?[0-9,.]*)H)?(?:([-+]?[0-9,.]*)M)?(?:([-+]?[0-9,.]*)S)?)?$/;function Er(e,t){var n,r,i,a=e,o=null;return or(e)?a={ms:e._milliseconds,d:e._days,M:e._months}:c(e)||!isNaN(+e)?(a={},t?a[t]=+e:a.milliseconds=+e):(o=Mr.exec(e))?(n="-"===o[1]?-1:1,a={y:0,d:ce(o[Be])*n,h:ce(o[$e])*n,m:ce(o[Xe])*n,s:ce(o[qe])*n,ms:ce(lr(1e3*o[Ge]))*n}):(o=Cr.exec(e))?(n="-"===o[1]?-1:1,a={y:Or(o[2],n),M:Or(o[3],n),w:Or(o[4],n),d:Or(o[5],n),h:Or(o[6],n),m:Or(o[7],n),s:Or(o[8],n)}):null==a?a={}:"object"===typeof a&&("from"in a||"to"in a)&&(i=Tr(qn(a.from),qn(a.to)),(a={}).ms=i.milliseconds,a.M=i.months),r=new ar(a),or(e)&&l(e,"_locale")&&(r._locale=e._locale),or(e)&&l(e,"_isValid")&&(r._isValid=e._isValid),r}function Or(e,t){var n=e&&parseFloat(e.replace(",","."));return(isNaN(n)?0:n)*t}function Pr(e,t){var n={};return n.months=t.month()-e.month()+12*(t.year()-e.year()),e.clone().add(n.months,"M").isAfter(t)&&--n.months,n.milliseconds=+t-+e.clone().add(n.months,"M"),n}function Tr(e,t){var n;return e.isValid()&&t.isValid()?(t=fr(t,e),e.isBefore(t)?n=Pr(e,t):((n=Pr(t,e)).milliseconds=-n.milliseconds,n.months=-n.months),n):{milliseconds:0,months:0}}function Dr(e,t){return function(n,r){var i;return null===r||isNaN(+r)||(O(t,"moment()."+t+"(period, number) is deprecated. Please use moment()."+t+"(number, period). See http://momentjs.com/guides/#/warnings/add-inverted-param/ for more info."),i=n,n=r,r=i),Nr(this,Er(n,r),e),this}}function Nr(e,t,n,i){var a=t._milliseconds,o=lr(t._days),l=lr(t._months);e.isValid()&&(i=null==i||i,l&&ut(e,fe(e,"Month")+l*n),o&&he(e,"Date",fe(e,"Date")+o*n),a&&e._d.setTime(e._d.valueOf()+a*n),i&&r.updateOffset(e,o||l))}Er.fn=ar.prototype,Er.invalid=ir;var Rr=Dr(1,"add"),Ar=Dr(-1,"subtract");function Ir(e){return"string"===typeof e||e instanceof String}function Lr(e){return k(e)||d(e)||Ir(e)||c(e)||Fr(e)||jr(e)||null===e||void 0===e}function jr(e){var t,n,r=o(e)&&!s(e),i=!1,a=["years","year","y","months","month","M","days","day","d","dates","date","D","hours","hour","h","minutes","minute","m","seconds","second","s","milliseconds","millisecond","ms"];for(t=0;t<a.length;t+=1)n=a[t],i=i||l(e,n);return r&&i}function Fr(e){var t=a(e),n=!1;return t&&(n=0===e.filter((function(t){return!c(t)&&Ir(e)})).length),t&&n}function zr(e){var t,n,r=o(e)&&!s(e),i=!1,a=["sameDay","nextDay","lastDay","nextWeek","lastWeek","sameElse"];for(t=0;t<a.length;t+=1)n=a[t],i=i||l(e,n);return r&&i}function Wr(e,t){var n=e.diff(t,"days",!0);return n<-6?"sameElse":n<-1?"lastWeek":n<0?"lastDay":n<1?"sameDay":n<2?"nextDay":n<7?"nextWeek":"sameElse"}function Yr(e,t){1===arguments.length&&(arguments[0]?Lr(arguments[0])?(e=arguments[0],t=void 0):zr(arguments[0])&&(t=arguments[0],e=void 0):(e=void 0,t=void 0));var n=e||qn(),i=fr(n,this).startOf("day"),a=r.calendarFormat(this,i)||"sameElse",o=t&&(P(t[a])?t[a].call(this,n):t[a]);return this.format(o||this.localeData().calendar(a,this,qn(n)))}function Hr(){return new _(this)}function Ur(e,t){var n=k(e)?e:qn(e);return!(!this.isValid()||!n.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()>n.valueOf():n.valueOf()<this.clone().startOf(t).valueOf())}function Vr(e,t){var n=k(e)?e:qn(e);return!(!this.isValid()||!n.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()<n.valueOf():this.clone().endOf(t).valueOf()<n.valueOf())}function Br(e,t,n,r){var i=k(e)?e:qn(e),a=k(t)?t:qn(t);return!!(this.isValid()&&i.isValid()&&a.isValid())&&("("===(r=r||"()")[0]?this.isAfter(i,n):!this.isBefore(i,n))&&(")"===r[1]?this.isBefore(a,n):!this.isAfter(a,n))}function $r(e,t){var n,r=k(e)?e:qn(e);return!(!this.isValid()||!r.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()===r.valueOf():(n=r.valueOf(),this.clone().startOf(t).valueOf()<=n&&n<=this.clone().endOf(t).valueOf()))}function Xr(e,t){return this.isSame(e,t)||this.isAfter(e,t)}function qr(e,t){return this.isSame(e,t)||this.isBefore(e,t)}function Gr(e,t,n){var r,i,a;if(!this.isValid())return NaN;if(!(r=fr(e,this)).isValid())return NaN;switch(i=6e4*(r.utcOffset()-this.utcOffset()),t=re(t)){case"year":a=Kr(this,r)/12;break;case"month":a=Kr(this,r);break;case"quarter":a=Kr(this,r)/3;break;case"second":a=(this-r)/1e3;break;case"minute":a=(this-r)/6e4;break;case"hour":a=(this-r)/36e5;break;case"day":a=(this-r-i)/864e5;break;case"week":a=(this-r-i)/6048e5;break;default:a=this-r}return n?a:ue(a)}function Kr(e,t){if(e.date()<t.date())return-Kr(t,e);var n=12*(t.year()-e.year())+(t.month()-e.month()),r=e.clone().add(n,"months");return-(n+(t-r<0?(t-r)/(r-e.clone().add(n-1,"months")):(t-r)/(e.clone().add(n+1,"months")-r)))||0}function Qr(){return this.clone().locale("en").format("ddd MMM DD YYYY HH:mm:ss [GMT]ZZ")}function Zr(e){if(!this.isValid())return null;var t=!0!==e,n=t?this.clone().utc():this;return n.year()<0||n.year()>9999?U(n,t?"YYYYYY-MM-DD[T]HH:mm:ss.SSS[Z]":"YYYYYY-MM-DD[T]HH:mm:ss.SSSZ"):P(Date.prototype.toISOString)?t?this.toDate().toISOString():new Date(this.valueOf()+60*this.utcOffset()*1e3).toISOString().replace("Z",U(n,"Z")):U(n,t?"YYYY-MM-DD[T]HH:mm:ss.SSS[Z]":"YYYY-MM-DD[T]HH:mm:ss.SSSZ")}function Jr(){if(!this.isValid())return"moment.invalid(/* "+this._i+" */)";var e,t,n,r,i="moment",a="";return this.isLocal()||(i=0===this.utcOffset()?"moment.utc":"moment.parseZone",a="Z"),e="["+i+'("]',t=0<=this.year()&&this.year()<=9999?"YYYY":"YYYYYY",n="-MM-DD[T]HH:mm:ss.SSS",r=a+'[")]',this.format(e+t+n+r)}function ei(e){e||(e=this.isUtc()?r.defaultFormatUtc:r.defaultFormat);var t=U(this,e);return this.localeData().postformat(t)}function ti(e,t){return this.isValid()&&(k(e)&&e.isValid()||qn(e).isValid())?Er({to:this,from:e}).locale(this.locale()).humanize(!t):this.localeData().invalidDate()}function ni(e){return this.from(qn(),e)}function ri(e,t){return this.isValid()&&(k(e)&&e.isValid()||qn(e).isValid())?Er({from:this,to:e}).locale(this.locale()).humanize(!t):this.localeData().invalidDate()}function ii(e){return this.to(qn(),e)}function ai(e){var t;return void 0===e?this._locale._abbr:(null!=(t=vn(e))&&(this._locale=t),this)}r.defaultFormat="YYYY-MM-DDTHH:mm:ssZ",r.defaultFormatUtc="YYYY-MM-DDTHH:mm:ss[Z]";var oi=M("moment().lang() is deprecated. Instead, use moment().localeData() to get the language configuration. Use moment().locale() to change languages.",(function(e){return void 0===e?this.localeData():this.locale(e)}));function li(){return this._locale}var si=1e3,ui=60*si,ci=60*ui,di=3506328*ci;function fi(e,t){return(e%t+t)%t}function hi(e,t,n){return e<100&&e>=0?new Date(e+400,t,n)-di:new Date(e,t,n).valueOf()}function pi(e,t,n){return e<100&&e>=0?Date.UTC(e+400,t,n)-di:Date.UTC(e,t,n)}function gi(e){var t,n;if(void 0===(e=re(e))||"millisecond"===e||!this.isValid())return this;switch(n=this._isUTC?pi:hi,e){case"year":t=n(this.year(),0,1);break;case"quarter":t=n(this.year(),this.month()-this.month()%3,1);break;case"month":t=n(this.year(),this.month(),1);break;case"week":t=n(this.year(),this.month(),this.date()-this.weekday());break;case"isoWeek":t=n(this.year(),this.month(),this.date()-(this.isoWeekday()-1));break;case"day":case"date":t=n(this.year(),this.month(),this.date());break;case"hour":t=this._d.valueOf(),t-=fi(t+(this._isUTC?0:this.utcOffset()*ui),ci);break;case"minute":t=this._d.valueOf(),t-=fi(t,ui);break;case"second":t=this._d.valueOf(),t-=fi(t,si)}return this._d.setTime(t),r.updateOffset(this,!0),this}function mi(e){var t,n;if(void 0===(e=re(e))||"millisecond"===e||!this.isValid())return this;switch(n=this._isUTC?pi:hi,e){case"year":t=n(this.year()+1,0,1)-1;break;case"quarter":t=n(this.year(),this.month()-this.month()%3+3,1)-1;break;case"month":t=n(this.year(),this.month()+1,1)-1;break;case"week":t=n(this.year(),this.month(),this.date()-this.weekday()+7)-1;break;case"isoWeek":t=n(this.year(),this.month(),this.date()-(this.isoWeekday()-1)+7)-1;break;case"day":case"date":t=n(this.year(),this.month(),this.date()+1)-1;break;case"hour":t=this._d.valueOf(),t+=ci-fi(t+(this._isUTC?0:this.utcOffset()*ui),ci)-1;break;case"minute":t=this._d.valueOf(),t+=ui-fi(t,ui)-1;break;case"second":t=this._d.valueOf(),t+=si-fi(t,si)-1}return this._d.setTime(t),r.updateOffset(this,!0),this}function vi(){return this._d.valueOf()-6e4*(this._offset||0)}function yi(){return Math.floor(this.valueOf()/1e3)}function bi(){return new Date(this.valueOf())}function xi(){var e=this;return[e.year(),e.month(),e.date(),e.hour(),e.minute(),e.second(),e.millisecond()]}function wi(){var e=this;return{years:e.year(),months:e.month(),date:e.date(),hours:e.hours(),minutes:e.minutes(),seconds:e.seconds(),milliseconds:e.milliseconds()}}function _i(){return this.isValid()?this.toISOString():null}function ki(){return v(this)}function Si(){return h({},m(this))}function Mi(){return m(this).overflow}function Ci(){return{input:this._i,format:this._f,locale:this._locale,isUTC:this._isUTC,strict:this._strict}}function Ei(e,t){var n,i,a,o=this._eras||vn("en")._eras;for(n=0,i=o.length;n<i;++n){switch(typeof o[n].since){case"string":a=r(o[n].since).startOf("day"),o[n].since=a.valueOf()}switch(typeof o[n].until){case"undefined":o[n].until=1/0;break;case"string":a=r(o[n].until).startOf("day").valueOf(),o[n].until=a.valueOf()}}return o}function Oi(e,t,n){var r,i,a,o,l,s=this.eras();for(e=e.toUpperCase(),r=0,i=s.length;r<i;++r)if(a=s[r].name.toUpperCase(),o=s[r].abbr.toUpperCase(),l=s[r].narrow.toUpperCase(),n)switch(t){case"N":case"NN":case"NNN":if(o===e)return s[r];break;case"NNNN":if(a===e)return s[r];break;case"NNNNN":if(l===e)return s[r]}else if([a,o,l].indexOf(e)>=0)return s[r]}function Pi(e,t){var n=e.since<=e.until?1:-1;return void 0===t?r(e.since).year():r(e.since).year()+(t-e.offset)*n}function Ti(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].name;if(r[e].until<=n&&n<=r[e].since)return r[e].name}return""}function Di(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].narrow;if(r[e].until<=n&&n<=r[e].since)return r[e].narrow}return""}function Ni(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].abbr;if(r[e].until<=n&&n<=r[e].since)return r[e].abbr}return""}function Ri(){var e,t,n,i,a=this.localeData().eras();for(e=0,t=a.length;e<t;++e)if(n=a[e].since<=a[e].until?1:-1,i=this.clone().startOf("day").valueOf(),a[e].since<=i&&i<=a[e].until||a[e].until<=i&&i<=a[e].since)return(this.year()-r(a[e].since).year())*n+a[e].offset;return this.year()}function Ai(e){return l(this,"_erasNameRegex")||Yi.call(this),e?this._erasNameRegex:this._erasRegex}function Ii(e){return l(this,"_erasAbbrRegex")||Yi.call(this),e?this._erasAbbrRegex:this._erasRegex}function Li(e){return l(this,"_erasNarrowRegex")||Yi.call(this),e?this._erasNarrowRegex:this._erasRegex}function ji(e,t){return t.erasAbbrRegex(e)}function Fi(e,t){return t.erasNameRegex(e)}function zi(e,t){return t.erasNarrowRegex(e)}function Wi(e,t){return t._eraYearOrdinalRegex||Oe}function Yi(){var e,t,n=[],r=[],i=[],a=[],o=this.eras();for(e=0,t=o.length;e<t;++e)r.push(je(o[e].name)),n.push(je(o[e].abbr)),i.push(je(o[e].narrow)),a.push(je(o[e].name)),a.push(je(o[e].abbr)),a.push(je(o[e].narrow));this._erasRegex=new RegExp("^("+a.join("|")+")","i"),this._erasNameRegex=new RegExp("^("+r.join("|")+")","i"),this._erasAbbrRegex=new RegExp("^("+n.join("|")+")","i"),this._erasNarrowRegex=new RegExp("^("+i.join("|")+")","i")}function Hi(e,t){W(0,[e,e.length],0,t)}function Ui(e){return Gi.call(this,e,this.week(),this.weekday(),this.localeData()._week.dow,this.localeData()._week.doy)}function Vi(e){return Gi.call(this,e,this.isoWeek(),this.isoWeekday(),1,4)}function Bi(){return kt(this.year(),1,4)}function $i(){return kt(this.isoWeekYear(),1,4)}function Xi(){var e=this.localeData()._week;return kt(this.year(),e.dow,e.doy)}function qi(){var e=this.localeData()._week;return kt(this.weekYear(),e.dow,e.doy)}function Gi(e,t,n,r,i){var a;return null==e?_t(this,r,i).year:(t>(a=kt(e,r,i))&&(t=a),Ki.call(this,e,t,n,r,i))}function Ki(e,t,n,r,i){var a=wt(e,t,n,r,i),o=bt(a.year,0,a.dayOfYear);return this.year(o.getUTCFullYear()),this.month(o.getUTCMonth()),this.date(o.getUTCDate()),this}function Qi(e){return null==e?Math.ceil((this.month()+1)/3):this.month(3*(e-1)+this.month()%3)}W("N",0,0,"eraAbbr"),W("NN",0,0,"eraAbbr"),W("NNN",0,0,"eraAbbr"),W("NNNN",0,0,"eraName"),W("NNNNN",0,0,"eraNarrow"),W("y",["y",1],"yo","eraYear"),W("y",["yy",2],0,"eraYear"),W("y",["yyy",3],0,"eraYear"),W("y",["yyyy",4],0,"eraYear"),Ae("N",ji),Ae("NN",ji),Ae("NNN",ji),Ae("NNNN",Fi),Ae("NNNNN",zi),ze(["N","NN","NNN","NNNN","NNNNN"],(function(e,t,n,r){var i=n._locale.erasParse(e,r,n._strict);i?m(n).era=i:m(n).invalidEra=e})),Ae("y",Oe),Ae("yy",Oe),Ae("yyy",Oe),Ae("yyyy",Oe),Ae("yo",Wi),ze(["y","yy","yyy","yyyy"],Ue),ze(["yo"],(function(e,t,n,r){var i;n._locale._eraYearOrdinalRegex&&(i=e.match(n._locale._eraYearOrdinalRegex)),n._locale.eraYearOrdinalParse?t[Ue]=n._locale.eraYearOrdinalParse(e,i):t[Ue]=parseInt(e,10)})),W(0,["gg",2],0,(function(){return this.weekYear()%100})),W(0,["GG",2],0,(function(){return this.isoWeekYear()%100})),Hi("gggg","weekYear"),Hi("ggggg","weekYear"),Hi("GGGG","isoWeekYear"),Hi("GGGGG","isoWeekYear"),ne("weekYear","gg"),ne("isoWeekYear","GG"),oe("weekYear",1),oe("isoWeekYear",1),Ae("G",Pe),Ae("g",Pe),Ae("GG",_e,ye),Ae("gg",_e,ye),Ae("GGGG",Ce,xe),Ae("gggg",Ce,xe),Ae("GGGGG",Ee,we),Ae("ggggg",Ee,we),We(["gggg","ggggg","GGGG","GGGGG"],(function(e,t,n,r){t[r.substr(0,2)]=ce(e)})),We(["gg","GG"],(function(e,t,n,i){t[i]=r.parseTwoDigitYear(e)})),W("Q",0,"Qo","quarter"),ne("quarter","Q"),oe("quarter",7),Ae("Q",ve),ze("Q",(function(e,t){t[Ve]=3*(ce(e)-1)})),W("D",["DD",2],"Do","date"),ne("date","D"),oe("date",9),Ae("D",_e),Ae("DD",_e,ye),Ae("Do",(function(e,t){return e?t._dayOfMonthOrdinalParse||t._ordinalParse:t._dayOfMonthOrdinalParseLenient})),ze(["D","DD"],Be),ze("Do",(function(e,t){t[Be]=ce(e.match(_e)[0])}));var Zi=de("Date",!0);function Ji(e){var t=Math.round((this.clone().startOf("day")-this.clone().startOf("year"))/864e5)+1;return null==e?t:this.add(e-t,"d")}W("DDD",["DDDD",3],"DDDo","dayOfYear"),ne("dayOfYear","DDD"),oe("dayOfYear",4),Ae("DDD",Me),Ae("DDDD",be),ze(["DDD","DDDD"],(function(e,t,n){n._dayOfYear=ce(e)})),W("m",["mm",2],0,"minute"),ne("minute","m"),oe("minute",14),Ae("m",_e),Ae("mm",_e,ye),ze(["m","mm"],Xe);var ea=de("Minutes",!1);W("s",["ss",2],0,"second"),ne("second","s"),oe("second",15),Ae("s",_e),Ae("ss",_e,ye),ze(["s","ss"],qe);var ta,na,ra=de("Seconds",!1);for(W("S",0,0,(function(){return~~(this.millisecond()/100)})),W(0,["SS",2],0,(function(){return~~(this.millisecond()/10)})),W(0,["SSS",3],0,"millisecond"),W(0,["SSSS",4],0,(function(){return 10*this.millisecond()})),W(0,["SSSSS",5],0,(function(){return 100*this.millisecond()})),W(0,["SSSSSS",6],0,(function(){return 1e3*this.millisecond()})),W(0,["SSSSSSS",7],0,(function(){return 1e4*this.millisecond()})),W(0,["SSSSSSSS",8],0,(function(){return 1e5*this.millisecond()})),W(0,["SSSSSSSSS",9],0,(function(){return 1e6*this.millisecond()})),ne("millisecond","ms"),oe("millisecond",16),Ae("S",Me,ve),Ae("SS",Me,ye),Ae("SSS",Me,be),ta="SSSS";ta.length<=9;ta+="S")Ae(ta,Oe);function ia(e,t){t[Ge]=ce(1e3*("0."+e))}for(ta="S";ta.length<=9;ta+="S")ze(ta,ia);function aa(){return this._isUTC?"UTC":""}function oa(){return this._isUTC?"Coordinated Universal Time":""}na=de("Milliseconds",!1),W("z",0,0,"zoneAbbr"),W("zz",0,0,"zoneName");var la=_.prototype;function sa(e){return qn(1e3*e)}function ua(){return qn.apply(null,arguments).parseZone()}function ca(e){return e}la.add=Rr,la.calendar=Yr,la.clone=Hr,la.diff=Gr,la.endOf=mi,la.format=ei,la.from=ti,la.fromNow=ni,la.to=ri,la.toNow=ii,la.get=pe,la.invalidAt=Mi,la.isAfter=Ur,la.isBefore=Vr,la.isBetween=Br,la.isSame=$r,la.isSameOrAfter=Xr,la.isSameOrBefore=qr,la.isValid=ki,la.lang=oi,la.locale=ai,la.localeData=li,la.max=Kn,la.min=Gn,la.parsingFlags=Si,la.set=ge,la.startOf=gi,la.subtract=Ar,la.toArray=xi,la.toObject=wi,la.toDate=bi,la.toISOString=Zr,la.inspect=Jr,"undefined"!==typeof Symbol&&null!=Symbol.for&&(la[Symbol.for("nodejs.util.inspect.custom")]=function(){return"Moment<"+this.format()+">"}),la.toJSON=_i,la.toString=Qr,la.unix=yi,la.valueOf=vi,la.creationData=Ci,la.eraName=Ti,la.eraNarrow=Di,la.eraAbbr=Ni,la.eraYear=Ri,la.year=mt,la.isLeapYear=vt,la.weekYear=Ui,la.isoWeekYear=Vi,la.quarter=la.quarters=Qi,la.month=ct,la.daysInMonth=dt,la.week=la.weeks=Ot,la.isoWeek=la.isoWeeks=Pt,la.weeksInYear=Xi,la.weeksInWeekYear=qi,la.isoWeeksInYear=Bi,la.isoWeeksInISOWeekYear=$i,la.date=Zi,la.day=la.days=Vt,la.weekday=Bt,la.isoWeekday=$t,la.dayOfYear=Ji,la.hour=la.hours=rn,la.minute=la.minutes=ea,la.second=la.seconds=ra,la.millisecond=la.milliseconds=na,la.utcOffset=pr,la.utc=mr,la.local=vr,la.parseZone=yr,la.hasAlignedHourOffset=br,la.isDST=xr,la.isLocal=_r,la.isUtcOffset=kr,la.isUtc=Sr,la.isUTC=Sr,la.zoneAbbr=aa,la.zoneName=oa,la.dates=M("dates accessor is deprecated. Use date instead.",Zi),la.months=M("months accessor is deprecated. Use month instead",ct),la.years=M("years accessor is deprecated. Use year instead",mt),la.zone=M("moment().zone is deprecated, use moment().utcOffset instead. http://momentjs.com/guides/#/warnings/zone/",gr),la.isDSTShifted=M("isDSTShifted is deprecated. See http://momentjs.com/guides/#/warnings/dst-shifted/ for more information",wr);var da=N.prototype;function fa(e,t,n,r){var i=vn(),a=p().set(r,t);return i[n](a,e)}function ha(e,t,n){if(c(e)&&(t=e,e=void 0),e=e||"",null!=t)return fa(e,t,n,"month");var r,i=[];for(r=0;r<12;r++)i[r]=fa(e,r,n,"month");return i}function pa(e,t,n,r){"boolean"===typeof e?(c(t)&&(n=t,t=void 0),t=t||""):(n=t=e,e=!1,c(t)&&(n=t,t=void 0),t=t||"");var i,a=vn(),o=e?a._week.dow:0,l=[];if(null!=n)return fa(t,(n+o)%7,r,"day");for(i=0;i<7;i++)l[i]=fa(t,(i+o)%7,r,"day");return l}function ga(e,t){return ha(e,t,"months")}function ma(e,t){return ha(e,t,"monthsShort")}function va(e,t,n){return pa(e,t,n,"weekdays")}function ya(e,t,n){return pa(e,t,n,"weekdaysShort")}function ba(e,t,n){return pa(e,t,n,"weekdaysMin")}da.calendar=A,da.longDateFormat=$,da.invalidDate=q,da.ordinal=Q,da.preparse=ca,da.postformat=ca,da.relativeTime=J,da.pastFuture=ee,da.set=T,da.eras=Ei,da.erasParse=Oi,da.erasConvertYear=Pi,da.erasAbbrRegex=Ii,da.erasNameRegex=Ai,da.erasNarrowRegex=Li,da.months=at,da.monthsShort=ot,da.monthsParse=st,da.monthsRegex=ht,da.monthsShortRegex=ft,da.week=St,da.firstDayOfYear=Et,da.firstDayOfWeek=Ct,da.weekdays=zt,da.weekdaysMin=Yt,da.weekdaysShort=Wt,da.weekdaysParse=Ut,da.weekdaysRegex=Xt,da.weekdaysShortRegex=qt,da.weekdaysMinRegex=Gt,da.isPM=tn,da.meridiem=an,pn("en",{eras:[{since:"0001-01-01",until:1/0,offset:1,name:"Anno Domini",narrow:"AD",abbr:"AD"},{since:"0000-12-31",until:-1/0,offset:1,name:"Before Christ",narrow:"BC",abbr:"BC"}],dayOfMonthOrdinalParse:/\d{1,2}(th|st|nd|rd)/,ordinal:function(e){var t=e%10;return e+(1===ce(e%100/10)?"th":1===t?"st":2===t?"nd":3===t?"rd":"th")}}),r.lang=M("moment.lang is deprecated. Use moment.locale instead.",pn),r.langData=M("moment.langData is deprecated. Use moment.localeData instead.",vn);var xa=Math.abs;function wa(){var e=this._data;return this._milliseconds=xa(this._milliseconds),this._days=xa(this._days),this._months=xa(this._months),e.milliseconds=xa(e.milliseconds),e.seconds=xa(e.seconds),e.minutes=xa(e.minutes),e.hours=xa(e.hours),e.months=xa(e.months),e.years=xa(e.years),this}function _a(e,t,n,r){var i=Er(t,n);return e._milliseconds+=r*i._milliseconds,e._days+=r*i._days,e._months+=r*i._months,e._bubble()}function ka(e,t){return _a(this,e,t,1)}function Sa(e,t){return _a(this,e,t,-1)}function Ma(e){return e<0?Math.floor(e):Math.ceil(e)}function Ca(){var e,t,n,r,i,a=this._milliseconds,o=this._days,l=this._months,s=this._data;return a>=0&&o>=0&&l>=0||a<=0&&o<=0&&l<=0||(a+=864e5*Ma(Oa(l)+o),o=0,l=0),s.milliseconds=a%1e3,e=ue(a/1e3),s.seconds=e%60,t=ue(e/60),s.minutes=t%60,n=ue(t/60),s.hours=n%24,o+=ue(n/24),l+=i=ue(Ea(o)),o-=Ma(Oa(i)),r=ue(l/12),l%=12,s.days=o,s.months=l,s.years=r,this}function Ea(e){return 4800*e/146097}function Oa(e){return 146097*e/4800}function Pa(e){if(!this.isValid())return NaN;var t,n,r=this._milliseconds;if("month"===(e=re(e))||"quarter"===e||"year"===e)switch(t=this._days+r/864e5,n=this._months+Ea(t),e){case"month":return n;case"quarter":return n/3;case"year":return n/12}else switch(t=this._days+Math.round(Oa(this._months)),e){case"week":return t/7+r/6048e5;case"day":return t+r/864e5;case"hour":return 24*t+r/36e5;case"minute":return 1440*t+r/6e4;case"second":return 86400*t+r/1e3;case"millisecond":return Math.floor(864e5*t)+r;default:throw new Error("Unknown unit "+e)}}function Ta(){return this.isValid()?this._milliseconds+864e5*this._days+this._months%12*2592e6+31536e6*ce(this._months/12):NaN}function Da(e){return function(){return this.as(e)}}var Na=Da("ms"),Ra=Da("s"),Aa=Da("m"),Ia=Da("h"),La=Da("d"),ja=Da("w"),Fa=Da("M"),za=Da("Q"),Wa=Da("y");function Ya(){return Er(this)}function Ha(e){return e=re(e),this.isValid()?this[e+"s"]():NaN}function Ua(e){return function(){return this.isValid()?this._data[e]:NaN}}var Va=Ua("milliseconds"),Ba=Ua("seconds"),$a=Ua("minutes"),Xa=Ua("hours"),qa=Ua("days"),Ga=Ua("months"),Ka=Ua("years");function Qa(){return ue(this.days()/7)}var Za=Math.round,Ja={ss:44,s:45,m:45,h:22,d:26,w:null,M:11};function eo(e,t,n,r,i){return i.relativeTime(t||1,!!n,e,r)}function to(e,t,n,r){var i=Er(e).abs(),a=Za(i.as("s")),o=Za(i.as("m")),l=Za(i.as("h")),s=Za(i.as("d")),u=Za(i.as("M")),c=Za(i.as("w")),d=Za(i.as("y")),f=a<=n.ss&&["s",a]||a<n.s&&["ss",a]||o<=1&&["m"]||o<n.m&&["mm",o]||l<=1&&["h"]||l<n.h&&["hh",l]||s<=1&&["d"]||s<n.d&&["dd",s];return null!=n.w&&(f=f||c<=1&&["w"]||c<n.w&&["ww",c]),(f=f||u<=1&&["M"]||u<n.M&&["MM",u]||d<=1&&["y"]||["yy",d])[2]=t,f[3]=+e>0,f[4]=r,eo.apply(null,f)}function no(e){return void 0===e?Za:"function"===typeof e&&(Za=e,!0)}function ro(e,t){return void 0!==Ja[e]&&(void 0===t?Ja[e]:(Ja[e]=t,"s"===e&&(Ja.ss=t-1),!0))}function io(e,t){if(!this.isValid())return this.localeData().invalidDate();var n,r,i=!1,a=Ja;return"object"===typeof e&&(t=e,e=!1),"boolean"===typeof e&&(i=e),"object"===typeof t&&(a=Object.assign({},Ja,t),null!=t.s&&null==t.ss&&(a.ss=t.s-1)),r=to(this,!i,a,n=this.localeData()),i&&(r=n.pastFuture(+this,r)),n.postformat(r)}var ao=Math.abs;function oo(e){return(e>0)-(e<0)||+e}function lo(){if(!this.isValid())return this.localeData().invalidDate();var e,t,n,r,i,a,o,l,s=ao(this._milliseconds)/1e3,u=ao(this._days),c=ao(this._months),d=this.asSeconds();return d?(e=ue(s/60),t=ue(e/60),s%=60,e%=60,n=ue(c/12),c%=12,r=s?s.toFixed(3).replace(/\.?0+$/,""):"",i=d<0?"-":"",a=oo(this._months)!==oo(d)?"-":"",o=oo(this._days)!==oo(d)?"-":"",l=oo(this._milliseconds)!==oo(d)?"-":"",i+"P"+(n?a+n+"Y":"")+(c?a+c+"M":"")+(u?o+u+"D":"")+(t||e||s?"T":"")+(t?l+t+"H":"")+(e?l+e+"M":"")+(s?l+r+"S":"")):"P0D"}var so=ar.prototype;return so.isValid=rr,so.abs=wa,so.add=ka,so.subtract=Sa,so.as=Pa,so.asMilliseconds=Na,so.asSeconds=Ra,so.asMinutes=Aa,so.asHours=Ia,so.asDays=La,so.asWeeks=ja,so.asMonths=Fa,so.asQuarters=za,so.asYears=Wa,so.valueOf=Ta,so._bubble=Ca,so.clone=Ya,so.get=Ha,so.milliseconds=Va,so.seconds=Ba,so.minutes=$a,so.hours=Xa,so.days=qa,so.weeks=Qa,so.months=Ga,so.years=Ka,so.humanize=io,so.toISOString=lo,so.toString=lo,so.toJSON=lo,so.locale=ai,so.localeData=li,so.toIsoString=M("toIsoString() is deprecated. Please use toISOString() instead (notice the capitals)",lo),so.lang=oi,W("X",0,0,"unix"),W("x",0,0,"valueOf"),Ae("x",Pe),Ae("X",Ne),ze("X",(function(e,t,n){n._d=new Date(1e3*parseFloat(e))})),ze("x",(function(e,t,n){n._d=new Date(ce(e))})),r.version="2.29.1",i(qn),r.fn=la,r.min=Zn,r.max=Jn,r.now=er,r.utc=p,r.unix=sa,r.months=ga,r.isDate=d,r.locale=pn,r.invalid=y,r.duration=Er,r.isMoment=k,r.weekdays=va,r.parseZone=ua,r.localeData=vn,r.isDuration=or,r.monthsShort=ma,r.weekdaysMin=ba,r.defineLocale=gn,r.updateLocale=mn,r.locales=yn,r.weekdaysShort=ya,r.normalizeUnits=re,r.relativeTimeRounding=no,r.relativeTimeThreshold=ro,r.calendarFormat=Wr,r.prototype=la,r.HTML5_FMT={DATETIME_LOCAL:"YYYY-MM-DDTHH:mm",DATETIME_LOCAL_SECONDS:"YYYY-MM-DDTHH:mm:ss",DATETIME_LOCAL_MS:"YYYY-MM-DDTHH:mm:ss.SSS",DATE:"YYYY-MM-DD",TIME:"HH:mm",TIME_SECONDS:"HH:mm:ss",TIME_MS:"HH:mm:ss.SSS",WEEK:"GGGG-[W]WW",MONTH:"YYYY-MM"},r}()}).call(this,n(37)(e))},function(e,t,n){var r=n(24),i=n(110),a=n(111),o=n(112),l=n(113),s=n(114);function u(e){var t=this.__data__=new r(e);this.size=t.size}u.prototype.clear=i,u.prototype.delete=a,u.prototype.get=o,u.prototype.has=l,u.prototype.set=s,e.exports=u},function(e,t){e.exports=function(e,t){return e===t||e!==e&&t!==t}},function(e,t,n){var r=n(21),i=n(40);e.exports=function(e){if(!i(e))return!1;var t=r(e);return"[object Function]"==t||"[object GeneratorFunction]"==t||"[object AsyncFunction]"==t||"[object Proxy]"==t}},function(e,t,n){(function(t){var n="object"==typeof t&&t&&t.Object===Object&&t;e.exports=n}).call(this,n(36))},function(e,t){var n=Function.prototype.toString;e.exports=function(e){if(null!=e){try{return n.call(e)}catch(t){}try{return e+""}catch(t){}}return""}},function(e,t,n){var r=n(133),i=n(136),a=n(137);e.exports=function(e,t,n,o,l,s){var u=1&n,c=e.length,d=t.length;if(c!=d&&!(u&&d>c))return!1;var f=s.get(e),h=s.get(t);if(f&&h)return f==t&&h==e;var p=-1,g=!0,m=2&n?new r:void 0;for(s.set(e,t),s.set(t,e);++p<c;){var v=e[p],y=t[p];if(o)var b=u?o(y,v,p,t,e,s):o(v,y,p,e,t,s);if(void 0!==b){if(b)continue;g=!1;break}if(m){if(!i(t,(function(e,t){if(!a(m,t)&&(v===e||l(v,e,n,o,s)))return m.push(t)}))){g=!1;break}}else if(v!==y&&!l(v,y,n,o,s)){g=!1;break}}return s.delete(e),s.delete(t),g}},function(e,t,n){var r=n(151),i=n(22),a=Object.prototype,o=a.hasOwnProperty,l=a.propertyIsEnumerable,s=r(function(){return arguments}())?r:function(e){return i(e)&&o.call(e,"callee")&&!l.call(e,"callee")};e.exports=s},function(e,t,n){(function(e){var r=n(13),i=n(152),a=t&&!t.nodeType&&t,o=a&&"object"==typeof e&&e&&!e.nodeType&&e,l=o&&o.exports===a?r.Buffer:void 0,s=(l?l.isBuffer:void 0)||i;e.exports=s}).call(this,n(37)(e))},function(e,t){var n=/^(?:0|[1-9]\d*)$/;e.exports=function(e,t){var r=typeof e;return!!(t=null==t?9007199254740991:t)&&("number"==r||"symbol"!=r&&n.test(e))&&e>-1&&e%1==0&&e<t}},function(e,t,n){var r=n(153),i=n(154),a=n(155),o=a&&a.isTypedArray,l=o?i(o):r;e.exports=l},function(e,t,n){var r=n(61),i=n(43);e.exports=function(e){return null!=e&&i(e.length)&&!r(e)}},function(e,t,n){var r=n(40);e.exports=function(e){return e===e&&!r(e)}},function(e,t){e.exports=function(e,t){return function(n){return null!=n&&(n[e]===t&&(void 0!==t||e in Object(n)))}}},function(e,t,n){var r=n(73),i=n(29);e.exports=function(e,t){for(var n=0,a=(t=r(t,e)).length;null!=e&&n<a;)e=e[i(t[n++])];return n&&n==a?e:void 0}},function(e,t,n){var r=n(14),i=n(44),a=n(182),o=n(185);e.exports=function(e,t){return r(e)?e:i(e,t)?[e]:a(o(e))}},function(e,t,n){"use strict";var r=n(56),i={childContextTypes:!0,contextType:!0,contextTypes:!0,defaultProps:!0,displayName:!0,getDefaultProps:!0,getDerivedStateFromError:!0,getDerivedStateFromProps:!0,mixins:!0,propTypes:!0,type:!0},a={name:!0,length:!0,prototype:!0,caller:!0,callee:!0,arguments:!0,arity:!0},o={$$typeof:!0,compare:!0,defaultProps:!0,displayName:!0,propTypes:!0,type:!0},l={};function s(e){return r.isMemo(e)?o:l[e.$$typeof]||i}l[r.ForwardRef]={$$typeof:!0,render:!0,defaultProps:!0,displayName:!0,propTypes:!0},l[r.Memo]=o;var u=Object.defineProperty,c=Object.getOwnPropertyNames,d=Object.getOwnPropertySymbols,f=Object.getOwnPropertyDescriptor,h=Object.getPrototypeOf,p=Object.prototype;e.exports=function e(t,n,r){if("string"!==typeof n){if(p){var i=h(n);i&&i!==p&&e(t,i,r)}var o=c(n);d&&(o=o.concat(d(n)));for(var l=s(t),g=s(n),m=0;m<o.length;++m){var v=o[m];if(!a[v]&&(!r||!r[v])&&(!g||!g[v])&&(!l||!l[v])){var y=f(n,v);try{u(t,v,y)}catch(b){}}}}return t}},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(3),p={active:c.a.bool,"aria-label":c.a.string,block:c.a.bool,color:c.a.string,disabled:c.a.bool,outline:c.a.bool,tag:h.i,innerRef:c.a.oneOfType([c.a.object,c.a.func,c.a.string]),onClick:c.a.func,size:c.a.string,children:c.a.node,className:c.a.string,cssModule:c.a.object,close:c.a.bool},g=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){if(!this.props.disabled)return this.props.onClick?this.props.onClick(e):void 0;e.preventDefault()},n.render=function(){var e=this.props,t=e.active,n=e["aria-label"],a=e.block,o=e.className,l=e.close,u=e.cssModule,c=e.color,d=e.outline,p=e.size,g=e.tag,m=e.innerRef,v=Object(i.a)(e,["active","aria-label","block","className","close","cssModule","color","outline","size","tag","innerRef"]);l&&"undefined"===typeof v.children&&(v.children=s.a.createElement("span",{"aria-hidden":!0},"\xd7"));var y="btn"+(d?"-outline":"")+"-"+c,b=Object(h.f)(f()(o,{close:l},l||"btn",l||y,!!p&&"btn-"+p,!!a&&"btn-block",{active:t,disabled:this.props.disabled}),u);v.href&&"button"===g&&(g="a");var x=l?"Close":null;return s.a.createElement(g,Object(r.a)({type:"button"===g&&v.onClick?"button":void 0},v,{className:b,ref:m,onClick:this.onClick,"aria-label":n||x}))},t}(s.a.Component);g.propTypes=p,g.defaultProps={color:"secondary",tag:"button"},t.a=g},function(e,t){function n(){return e.exports=n=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e},e.exports.default=e.exports,e.exports.__esModule=!0,n.apply(this,arguments)}e.exports=n,e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";function r(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}function i(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function a(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?i(Object(n),!0).forEach((function(t){r(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):i(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}n.d(t,"a",(function(){return a}))},,function(e,t,n){"use strict";var r=n(35),i=60103,a=60106;t.Fragment=60107,t.StrictMode=60108,t.Profiler=60114;var o=60109,l=60110,s=60112;t.Suspense=60113;var u=60115,c=60116;if("function"===typeof Symbol&&Symbol.for){var d=Symbol.for;i=d("react.element"),a=d("react.portal"),t.Fragment=d("react.fragment"),t.StrictMode=d("react.strict_mode"),t.Profiler=d("react.profiler"),o=d("react.provider"),l=d("react.context"),s=d("react.forward_ref"),t.Suspense=d("react.suspense"),u=d("react.memo"),c=d("react.lazy")}var f="function"===typeof Symbol&&Symbol.iterator;function h(e){for(var t="https://reactjs.org/docs/error-decoder.html?invariant="+e,n=1;n<arguments.length;n++)t+="&args[]="+encodeURIComponent(arguments[n]);return"Minified React error #"+e+"; visit "+t+" for the full message or use the non-minified dev environment for full errors and additional helpful warnings."}var p={isMounted:function(){return!1},enqueueForceUpdate:function(){},enqueueReplaceState:function(){},enqueueSetState:function(){}},g={};function m(e,t,n){this.props=e,this.context=t,this.refs=g,this.updater=n||p}function v(){}function y(e,t,n){this.props=e,this.context=t,this.refs=g,this.updater=n||p}m.prototype.isReactComponent={},m.prototype.setState=function(e,t){if("object"!==typeof e&&"function"!==typeof e&&null!=e)throw Error(h(85));this.updater.enqueueSetState(this,e,t,"setState")},m.prototype.forceUpdate=function(e){this.updater.enqueueForceUpdate(this,e,"forceUpdate")},v.prototype=m.prototype;var b=y.prototype=new v;b.constructor=y,r(b,m.prototype),b.isPureReactComponent=!0;var x={current:null},w=Object.prototype.hasOwnProperty,_={key:!0,ref:!0,__self:!0,__source:!0};function k(e,t,n){var r,a={},o=null,l=null;if(null!=t)for(r in void 0!==t.ref&&(l=t.ref),void 0!==t.key&&(o=""+t.key),t)w.call(t,r)&&!_.hasOwnProperty(r)&&(a[r]=t[r]);var s=arguments.length-2;if(1===s)a.children=n;else if(1<s){for(var u=Array(s),c=0;c<s;c++)u[c]=arguments[c+2];a.children=u}if(e&&e.defaultProps)for(r in s=e.defaultProps)void 0===a[r]&&(a[r]=s[r]);return{$$typeof:i,type:e,key:o,ref:l,props:a,_owner:x.current}}function S(e){return"object"===typeof e&&null!==e&&e.$$typeof===i}var M=/\/+/g;function C(e,t){return"object"===typeof e&&null!==e&&null!=e.key?function(e){var t={"=":"=0",":":"=2"};return"$"+e.replace(/[=:]/g,(function(e){return t[e]}))}(""+e.key):t.toString(36)}function E(e,t,n,r,o){var l=typeof e;"undefined"!==l&&"boolean"!==l||(e=null);var s=!1;if(null===e)s=!0;else switch(l){case"string":case"number":s=!0;break;case"object":switch(e.$$typeof){case i:case a:s=!0}}if(s)return o=o(s=e),e=""===r?"."+C(s,0):r,Array.isArray(o)?(n="",null!=e&&(n=e.replace(M,"$&/")+"/"),E(o,t,n,"",(function(e){return e}))):null!=o&&(S(o)&&(o=function(e,t){return{$$typeof:i,type:e.type,key:t,ref:e.ref,props:e.props,_owner:e._owner}}(o,n+(!o.key||s&&s.key===o.key?"":(""+o.key).replace(M,"$&/")+"/")+e)),t.push(o)),1;if(s=0,r=""===r?".":r+":",Array.isArray(e))for(var u=0;u<e.length;u++){var c=r+C(l=e[u],u);s+=E(l,t,n,c,o)}else if("function"===typeof(c=function(e){return null===e||"object"!==typeof e?null:"function"===typeof(e=f&&e[f]||e["@@iterator"])?e:null}(e)))for(e=c.call(e),u=0;!(l=e.next()).done;)s+=E(l=l.value,t,n,c=r+C(l,u++),o);else if("object"===l)throw t=""+e,Error(h(31,"[object Object]"===t?"object with keys {"+Object.keys(e).join(", ")+"}":t));return s}function O(e,t,n){if(null==e)return e;var r=[],i=0;return E(e,r,"","",(function(e){return t.call(n,e,i++)})),r}function P(e){if(-1===e._status){var t=e._result;t=t(),e._status=0,e._result=t,t.then((function(t){0===e._status&&(t=t.default,e._status=1,e._result=t)}),(function(t){0===e._status&&(e._status=2,e._result=t)}))}if(1===e._status)return e._result;throw e._result}var T={current:null};function D(){var e=T.current;if(null===e)throw Error(h(321));return e}var N={ReactCurrentDispatcher:T,ReactCurrentBatchConfig:{transition:0},ReactCurrentOwner:x,IsSomeRendererActing:{current:!1},assign:r};t.Children={map:O,forEach:function(e,t,n){O(e,(function(){t.apply(this,arguments)}),n)},count:function(e){var t=0;return O(e,(function(){t++})),t},toArray:function(e){return O(e,(function(e){return e}))||[]},only:function(e){if(!S(e))throw Error(h(143));return e}},t.Component=m,t.PureComponent=y,t.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=N,t.cloneElement=function(e,t,n){if(null===e||void 0===e)throw Error(h(267,e));var a=r({},e.props),o=e.key,l=e.ref,s=e._owner;if(null!=t){if(void 0!==t.ref&&(l=t.ref,s=x.current),void 0!==t.key&&(o=""+t.key),e.type&&e.type.defaultProps)var u=e.type.defaultProps;for(c in t)w.call(t,c)&&!_.hasOwnProperty(c)&&(a[c]=void 0===t[c]&&void 0!==u?u[c]:t[c])}var c=arguments.length-2;if(1===c)a.children=n;else if(1<c){u=Array(c);for(var d=0;d<c;d++)u[d]=arguments[d+2];a.children=u}return{$$typeof:i,type:e.type,key:o,ref:l,props:a,_owner:s}},t.createContext=function(e,t){return void 0===t&&(t=null),(e={$$typeof:l,_calculateChangedBits:t,_currentValue:e,_currentValue2:e,_threadCount:0,Provider:null,Consumer:null}).Provider={$$typeof:o,_context:e},e.Consumer=e},t.createElement=k,t.createFactory=function(e){var t=k.bind(null,e);return t.type=e,t},t.createRef=function(){return{current:null}},t.forwardRef=function(e){return{$$typeof:s,render:e}},t.isValidElement=S,t.lazy=function(e){return{$$typeof:c,_payload:{_status:-1,_result:e},_init:P}},t.memo=function(e,t){return{$$typeof:u,type:e,compare:void 0===t?null:t}},t.useCallback=function(e,t){return D().useCallback(e,t)},t.useContext=function(e,t){return D().useContext(e,t)},t.useDebugValue=function(){},t.useEffect=function(e,t){return D().useEffect(e,t)},t.useImperativeHandle=function(e,t,n){return D().useImperativeHandle(e,t,n)},t.useLayoutEffect=function(e,t){return D().useLayoutEffect(e,t)},t.useMemo=function(e,t){return D().useMemo(e,t)},t.useReducer=function(e,t,n){return D().useReducer(e,t,n)},t.useRef=function(e){return D().useRef(e)},t.useState=function(e){return D().useState(e)},t.version="17.0.1"},function(e,t,n){"use strict";var r=n(2),i=n(35),a=n(81);function o(e){for(var t="https://reactjs.org/docs/error-decoder.html?invariant="+e,n=1;n<arguments.length;n++)t+="&args[]="+encodeURIComponent(arguments[n]);return"Minified React error #"+e+"; visit "+t+" for the full message or use the non-minified dev environment for full errors and additional helpful warnings."}if(!r)throw Error(o(227));var l=new Set,s={};function u(e,t){c(e,t),c(e+"Capture",t)}function c(e,t){for(s[e]=t,e=0;e<t.length;e++)l.add(t[e])}var d=!("undefined"===typeof window||"undefined"===typeof window.document||"undefined"===typeof window.document.createElement),f=/^[:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD][:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD\-.0-9\u00B7\u0300-\u036F\u203F-\u2040]*$/,h=Object.prototype.hasOwnProperty,p={},g={};function m(e,t,n,r,i,a,o){this.acceptsBooleans=2===t||3===t||4===t,this.attributeName=r,this.attributeNamespace=i,this.mustUseProperty=n,this.propertyName=e,this.type=t,this.sanitizeURL=a,this.removeEmptyString=o}var v={};"children dangerouslySetInnerHTML defaultValue defaultChecked innerHTML suppressContentEditableWarning suppressHydrationWarning style".split(" ").forEach((function(e){v[e]=new m(e,0,!1,e,null,!1,!1)})),[["acceptCharset","accept-charset"],["className","class"],["htmlFor","for"],["httpEquiv","http-equiv"]].forEach((function(e){var t=e[0];v[t]=new m(t,1,!1,e[1],null,!1,!1)})),["contentEditable","draggable","spellCheck","value"].forEach((function(e){v[e]=new m(e,2,!1,e.toLowerCase(),null,!1,!1)})),["autoReverse","externalResourcesRequired","focusable","preserveAlpha"].forEach((function(e){v[e]=new m(e,2,!1,e,null,!1,!1)})),"allowFullScreen async autoFocus autoPlay controls default defer disabled disablePictureInPicture disableRemotePlayback formNoValidate hidden loop noModule noValidate open playsInline readOnly required reversed scoped seamless itemScope".split(" ").forEach((function(e){v[e]=new m(e,3,!1,e.toLowerCase(),null,!1,!1)})),["checked","multiple","muted","selected"].forEach((function(e){v[e]=new m(e,3,!0,e,null,!1,!1)})),["capture","download"].forEach((function(e){v[e]=new m(e,4,!1,e,null,!1,!1)})),["cols","rows","size","span"].forEach((function(e){v[e]=new m(e,6,!1,e,null,!1,!1)})),["rowSpan","start"].forEach((function(e){v[e]=new m(e,5,!1,e.toLowerCase(),null,!1,!1)}));var y=/[\-:]([a-z])/g;function x(e){return e[1].toUpperCase()}function w(e,t,n,r){var i=v.hasOwnProperty(t)?v[t]:null;(null!==i?0===i.type:!r&&(2<t.length&&("o"===t[0]||"O"===t[0])&&("n"===t[1]||"N"===t[1])))||(function(e,t,n,r){if(null===t||"undefined"===typeof t||function(e,t,n,r){if(null!==n&&0===n.type)return!1;switch(typeof t){case"function":case"symbol":return!0;case"boolean":return!r&&(null!==n?!n.acceptsBooleans:"data-"!==(e=e.toLowerCase().slice(0,5))&&"aria-"!==e);default:return!1}}(e,t,n,r))return!0;if(r)return!1;if(null!==n)switch(n.type){case 3:return!t;case 4:return!1===t;case 5:return isNaN(t);case 6:return isNaN(t)||1>t}return!1}(t,n,i,r)&&(n=null),r||null===i?function(e){return!!h.call(g,e)||!h.call(p,e)&&(f.test(e)?g[e]=!0:(p[e]=!0,!1))}(t)&&(null===n?e.removeAttribute(t):e.setAttribute(t,""+n)):i.mustUseProperty?e[i.propertyName]=null===n?3!==i.type&&"":n:(t=i.attributeName,r=i.attributeNamespace,null===n?e.removeAttribute(t):(n=3===(i=i.type)||4===i&&!0===n?"":""+n,r?e.setAttributeNS(r,t,n):e.setAttribute(t,n))))}"accent-height alignment-baseline arabic-form baseline-shift cap-height clip-path clip-rule color-interpolation color-interpolation-filters color-profile color-rendering dominant-baseline enable-background fill-opacity fill-rule flood-color flood-opacity font-family font-size font-size-adjust font-stretch font-style font-variant font-weight glyph-name glyph-orientation-horizontal glyph-orientation-vertical horiz-adv-x horiz-origin-x image-rendering letter-spacing lighting-color marker-end marker-mid marker-start overline-position overline-thickness paint-order panose-1 pointer-events rendering-intent shape-rendering stop-color stop-opacity strikethrough-position strikethrough-thickness stroke-dasharray stroke-dashoffset stroke-linecap stroke-linejoin stroke-miterlimit stroke-opacity stroke-width text-anchor text-decoration text-rendering underline-position underline-thickness unicode-bidi unicode-range units-per-em v-alphabetic v-hanging v-ideographic v-mathematical vector-effect vert-adv-y vert-origin-x vert-origin-y word-spacing writing-mode xmlns:xlink x-height".split(" ").forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,null,!1,!1)})),"xlink:actuate xlink:arcrole xlink:role xlink:show xlink:title xlink:type".split(" ").forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,"http://www.w3.org/1999/xlink",!1,!1)})),["xml:base","xml:lang","xml:space"].forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,"http://www.w3.org/XML/1998/namespace",!1,!1)})),["tabIndex","crossOrigin"].forEach((function(e){v[e]=new m(e,1,!1,e.toLowerCase(),null,!1,!1)})),v.xlinkHref=new m("xlinkHref",1,!1,"xlink:href","http://www.w3.org/1999/xlink",!0,!1),["src","href","action","formAction"].forEach((function(e){v[e]=new m(e,1,!1,e.toLowerCase(),null,!0,!0)}));var _=r.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED,k=60103,S=60106,M=60107,C=60108,E=60114,O=60109,P=60110,T=60112,D=60113,N=60120,R=60115,A=60116,I=60121,L=60128,j=60129,F=60130,z=60131;if("function"===typeof Symbol&&Symbol.for){var W=Symbol.for;k=W("react.element"),S=W("react.portal"),M=W("react.fragment"),C=W("react.strict_mode"),E=W("react.profiler"),O=W("react.provider"),P=W("react.context"),T=W("react.forward_ref"),D=W("react.suspense"),N=W("react.suspense_list"),R=W("react.memo"),A=W("react.lazy"),I=W("react.block"),W("react.scope"),L=W("react.opaque.id"),j=W("react.debug_trace_mode"),F=W("react.offscreen"),z=W("react.legacy_hidden")}var Y,H="function"===typeof Symbol&&Symbol.iterator;function U(e){return null===e||"object"!==typeof e?null:"function"===typeof(e=H&&e[H]||e["@@iterator"])?e:null}function V(e){if(void 0===Y)try{throw Error()}catch(n){var t=n.stack.trim().match(/\n( *(at )?)/);Y=t&&t[1]||""}return"\n"+Y+e}var B=!1;function $(e,t){if(!e||B)return"";B=!0;var n=Error.prepareStackTrace;Error.prepareStackTrace=void 0;try{if(t)if(t=function(){throw Error()},Object.defineProperty(t.prototype,"props",{set:function(){throw Error()}}),"object"===typeof Reflect&&Reflect.construct){try{Reflect.construct(t,[])}catch(s){var r=s}Reflect.construct(e,[],t)}else{try{t.call()}catch(s){r=s}e.call(t.prototype)}else{try{throw Error()}catch(s){r=s}e()}}catch(s){if(s&&r&&"string"===typeof s.stack){for(var i=s.stack.split("\n"),a=r.stack.split("\n"),o=i.length-1,l=a.length-1;1<=o&&0<=l&&i[o]!==a[l];)l--;for(;1<=o&&0<=l;o--,l--)if(i[o]!==a[l]){if(1!==o||1!==l)do{if(o--,0>--l||i[o]!==a[l])return"\n"+i[o].replace(" at new "," at ")}while(1<=o&&0<=l);break}}}finally{B=!1,Error.prepareStackTrace=n}return(e=e?e.displayName||e.name:"")?V(e):""}function X(e){switch(e.tag){case 5:return V(e.type);case 16:return V("Lazy");case 13:return V("Suspense");case 19:return V("SuspenseList");case 0:case 2:case 15:return e=$(e.type,!1);case 11:return e=$(e.type.render,!1);case 22:return e=$(e.type._render,!1);case 1:return e=$(e.type,!0);default:return""}}function q(e){if(null==e)return null;if("function"===typeof e)return e.displayName||e.name||null;if("string"===typeof e)return e;switch(e){case M:return"Fragment";case S:return"Portal";case E:return"Profiler";case C:return"StrictMode";case D:return"Suspense";case N:return"SuspenseList"}if("object"===typeof e)switch(e.$$typeof){case P:return(e.displayName||"Context")+".Consumer";case O:return(e._context.displayName||"Context")+".Provider";case T:var t=e.render;return t=t.displayName||t.name||"",e.displayName||(""!==t?"ForwardRef("+t+")":"ForwardRef");case R:return q(e.type);case I:return q(e._render);case A:t=e._payload,e=e._init;try{return q(e(t))}catch(n){}}return null}function G(e){switch(typeof e){case"boolean":case"number":case"object":case"string":case"undefined":return e;default:return""}}function K(e){var t=e.type;return(e=e.nodeName)&&"input"===e.toLowerCase()&&("checkbox"===t||"radio"===t)}function Q(e){e._valueTracker||(e._valueTracker=function(e){var t=K(e)?"checked":"value",n=Object.getOwnPropertyDescriptor(e.constructor.prototype,t),r=""+e[t];if(!e.hasOwnProperty(t)&&"undefined"!==typeof n&&"function"===typeof n.get&&"function"===typeof n.set){var i=n.get,a=n.set;return Object.defineProperty(e,t,{configurable:!0,get:function(){return i.call(this)},set:function(e){r=""+e,a.call(this,e)}}),Object.defineProperty(e,t,{enumerable:n.enumerable}),{getValue:function(){return r},setValue:function(e){r=""+e},stopTracking:function(){e._valueTracker=null,delete e[t]}}}}(e))}function Z(e){if(!e)return!1;var t=e._valueTracker;if(!t)return!0;var n=t.getValue(),r="";return e&&(r=K(e)?e.checked?"true":"false":e.value),(e=r)!==n&&(t.setValue(e),!0)}function J(e){if("undefined"===typeof(e=e||("undefined"!==typeof document?document:void 0)))return null;try{return e.activeElement||e.body}catch(b){return e.body}}function ee(e,t){var n=t.checked;return i({},t,{defaultChecked:void 0,defaultValue:void 0,value:void 0,checked:null!=n?n:e._wrapperState.initialChecked})}function te(e,t){var n=null==t.defaultValue?"":t.defaultValue,r=null!=t.checked?t.checked:t.defaultChecked;n=G(null!=t.value?t.value:n),e._wrapperState={initialChecked:r,initialValue:n,controlled:"checkbox"===t.type||"radio"===t.type?null!=t.checked:null!=t.value}}function ne(e,t){null!=(t=t.checked)&&w(e,"checked",t,!1)}function re(e,t){ne(e,t);var n=G(t.value),r=t.type;if(null!=n)"number"===r?(0===n&&""===e.value||e.value!=n)&&(e.value=""+n):e.value!==""+n&&(e.value=""+n);else if("submit"===r||"reset"===r)return void e.removeAttribute("value");t.hasOwnProperty("value")?ae(e,t.type,n):t.hasOwnProperty("defaultValue")&&ae(e,t.type,G(t.defaultValue)),null==t.checked&&null!=t.defaultChecked&&(e.defaultChecked=!!t.defaultChecked)}function ie(e,t,n){if(t.hasOwnProperty("value")||t.hasOwnProperty("defaultValue")){var r=t.type;if(!("submit"!==r&&"reset"!==r||void 0!==t.value&&null!==t.value))return;t=""+e._wrapperState.initialValue,n||t===e.value||(e.value=t),e.defaultValue=t}""!==(n=e.name)&&(e.name=""),e.defaultChecked=!!e._wrapperState.initialChecked,""!==n&&(e.name=n)}function ae(e,t,n){"number"===t&&J(e.ownerDocument)===e||(null==n?e.defaultValue=""+e._wrapperState.initialValue:e.defaultValue!==""+n&&(e.defaultValue=""+n))}function oe(e,t){return e=i({children:void 0},t),(t=function(e){var t="";return r.Children.forEach(e,(function(e){null!=e&&(t+=e)})),t}(t.children))&&(e.children=t),e}function le(e,t,n,r){if(e=e.options,t){t={};for(var i=0;i<n.length;i++)t["$"+n[i]]=!0;for(n=0;n<e.length;n++)i=t.hasOwnProperty("$"+e[n].value),e[n].selected!==i&&(e[n].selected=i),i&&r&&(e[n].defaultSelected=!0)}else{for(n=""+G(n),t=null,i=0;i<e.length;i++){if(e[i].value===n)return e[i].selected=!0,void(r&&(e[i].defaultSelected=!0));null!==t||e[i].disabled||(t=e[i])}null!==t&&(t.selected=!0)}}function se(e,t){if(null!=t.dangerouslySetInnerHTML)throw Error(o(91));return i({},t,{value:void 0,defaultValue:void 0,children:""+e._wrapperState.initialValue})}function ue(e,t){var n=t.value;if(null==n){if(n=t.children,t=t.defaultValue,null!=n){if(null!=t)throw Error(o(92));if(Array.isArray(n)){if(!(1>=n.length))throw Error(o(93));n=n[0]}t=n}null==t&&(t=""),n=t}e._wrapperState={initialValue:G(n)}}function ce(e,t){var n=G(t.value),r=G(t.defaultValue);null!=n&&((n=""+n)!==e.value&&(e.value=n),null==t.defaultValue&&e.defaultValue!==n&&(e.defaultValue=n)),null!=r&&(e.defaultValue=""+r)}function de(e){var t=e.textContent;t===e._wrapperState.initialValue&&""!==t&&null!==t&&(e.value=t)}var fe="http://www.w3.org/1999/xhtml",he="http://www.w3.org/2000/svg";function pe(e){switch(e){case"svg":return"http://www.w3.org/2000/svg";case"math":return"http://www.w3.org/1998/Math/MathML";default:return"http://www.w3.org/1999/xhtml"}}function ge(e,t){return null==e||"http://www.w3.org/1999/xhtml"===e?pe(t):"http://www.w3.org/2000/svg"===e&&"foreignObject"===t?"http://www.w3.org/1999/xhtml":e}var me,ve,ye=(ve=function(e,t){if(e.namespaceURI!==he||"innerHTML"in e)e.innerHTML=t;else{for((me=me||document.createElement("div")).innerHTML="<svg>"+t.valueOf().toString()+"</svg>",t=me.firstChild;e.firstChild;)e.removeChild(e.firstChild);for(;t.firstChild;)e.appendChild(t.firstChild)}},"undefined"!==typeof MSApp&&MSApp.execUnsafeLocalFunction?function(e,t,n,r){MSApp.execUnsafeLocalFunction((function(){return ve(e,t)}))}:ve);function be(e,t){if(t){var n=e.firstChild;if(n&&n===e.lastChild&&3===n.nodeType)return void(n.nodeValue=t)}e.textContent=t}var xe={animationIterationCount:!0,borderImageOutset:!0,borderImageSlice:!0,borderImageWidth:!0,boxFlex:!0,boxFlexGroup:!0,boxOrdinalGroup:!0,columnCount:!0,columns:!0,flex:!0,flexGrow:!0,flexPositive:!0,flexShrink:!0,flexNegative:!0,flexOrder:!0,gridArea:!0,gridRow:!0,gridRowEnd:!0,gridRowSpan:!0,gridRowStart:!0,gridColumn:!0,gridColumnEnd:!0,gridColumnSpan:!0,gridColumnStart:!0,fontWeight:!0,lineClamp:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,tabSize:!0,widows:!0,zIndex:!0,zoom:!0,fillOpacity:!0,floodOpacity:!0,stopOpacity:!0,strokeDasharray:!0,strokeDashoffset:!0,strokeMiterlimit:!0,strokeOpacity:!0,strokeWidth:!0},we=["Webkit","ms","Moz","O"];function _e(e,t,n){return null==t||"boolean"===typeof t||""===t?"":n||"number"!==typeof t||0===t||xe.hasOwnProperty(e)&&xe[e]?(""+t).trim():t+"px"}function ke(e,t){for(var n in e=e.style,t)if(t.hasOwnProperty(n)){var r=0===n.indexOf("--"),i=_e(n,t[n],r);"float"===n&&(n="cssFloat"),r?e.setProperty(n,i):e[n]=i}}Object.keys(xe).forEach((function(e){we.forEach((function(t){t=t+e.charAt(0).toUpperCase()+e.substring(1),xe[t]=xe[e]}))}));var Se=i({menuitem:!0},{area:!0,base:!0,br:!0,col:!0,embed:!0,hr:!0,img:!0,input:!0,keygen:!0,link:!0,meta:!0,param:!0,source:!0,track:!0,wbr:!0});function Me(e,t){if(t){if(Se[e]&&(null!=t.children||null!=t.dangerouslySetInnerHTML))throw Error(o(137,e));if(null!=t.dangerouslySetInnerHTML){if(null!=t.children)throw Error(o(60));if("object"!==typeof t.dangerouslySetInnerHTML||!("__html"in t.dangerouslySetInnerHTML))throw Error(o(61))}if(null!=t.style&&"object"!==typeof t.style)throw Error(o(62))}}function Ce(e,t){if(-1===e.indexOf("-"))return"string"===typeof t.is;switch(e){case"annotation-xml":case"color-profile":case"font-face":case"font-face-src":case"font-face-uri":case"font-face-format":case"font-face-name":case"missing-glyph":return!1;default:return!0}}function Ee(e){return(e=e.target||e.srcElement||window).correspondingUseElement&&(e=e.correspondingUseElement),3===e.nodeType?e.parentNode:e}var Oe=null,Pe=null,Te=null;function De(e){if(e=ti(e)){if("function"!==typeof Oe)throw Error(o(280));var t=e.stateNode;t&&(t=ri(t),Oe(e.stateNode,e.type,t))}}function Ne(e){Pe?Te?Te.push(e):Te=[e]:Pe=e}function Re(){if(Pe){var e=Pe,t=Te;if(Te=Pe=null,De(e),t)for(e=0;e<t.length;e++)De(t[e])}}function Ae(e,t){return e(t)}function Ie(e,t,n,r,i){return e(t,n,r,i)}function Le(){}var je=Ae,Fe=!1,ze=!1;function We(){null===Pe&&null===Te||(Le(),Re())}function Ye(e,t){var n=e.stateNode;if(null===n)return null;var r=ri(n);if(null===r)return null;n=r[t];e:switch(t){case"onClick":case"onClickCapture":case"onDoubleClick":case"onDoubleClickCapture":case"onMouseDown":case"onMouseDownCapture":case"onMouseMove":case"onMouseMoveCapture":case"onMouseUp":case"onMouseUpCapture":case"onMouseEnter":(r=!r.disabled)||(r=!("button"===(e=e.type)||"input"===e||"select"===e||"textarea"===e)),e=!r;break e;default:e=!1}if(e)return null;if(n&&"function"!==typeof n)throw Error(o(231,t,typeof n));return n}var He=!1;if(d)try{var Ue={};Object.defineProperty(Ue,"passive",{get:function(){He=!0}}),window.addEventListener("test",Ue,Ue),window.removeEventListener("test",Ue,Ue)}catch(ve){He=!1}function Ve(e,t,n,r,i,a,o,l,s){var u=Array.prototype.slice.call(arguments,3);try{t.apply(n,u)}catch(c){this.onError(c)}}var Be=!1,$e=null,Xe=!1,qe=null,Ge={onError:function(e){Be=!0,$e=e}};function Ke(e,t,n,r,i,a,o,l,s){Be=!1,$e=null,Ve.apply(Ge,arguments)}function Qe(e){var t=e,n=e;if(e.alternate)for(;t.return;)t=t.return;else{e=t;do{0!==(1026&(t=e).flags)&&(n=t.return),e=t.return}while(e)}return 3===t.tag?n:null}function Ze(e){if(13===e.tag){var t=e.memoizedState;if(null===t&&(null!==(e=e.alternate)&&(t=e.memoizedState)),null!==t)return t.dehydrated}return null}function Je(e){if(Qe(e)!==e)throw Error(o(188))}function et(e){if(!(e=function(e){var t=e.alternate;if(!t){if(null===(t=Qe(e)))throw Error(o(188));return t!==e?null:e}for(var n=e,r=t;;){var i=n.return;if(null===i)break;var a=i.alternate;if(null===a){if(null!==(r=i.return)){n=r;continue}break}if(i.child===a.child){for(a=i.child;a;){if(a===n)return Je(i),e;if(a===r)return Je(i),t;a=a.sibling}throw Error(o(188))}if(n.return!==r.return)n=i,r=a;else{for(var l=!1,s=i.child;s;){if(s===n){l=!0,n=i,r=a;break}if(s===r){l=!0,r=i,n=a;break}s=s.sibling}if(!l){for(s=a.child;s;){if(s===n){l=!0,n=a,r=i;break}if(s===r){l=!0,r=a,n=i;break}s=s.sibling}if(!l)throw Error(o(189))}}if(n.alternate!==r)throw Error(o(190))}if(3!==n.tag)throw Error(o(188));return n.stateNode.current===n?e:t}(e)))return null;for(var t=e;;){if(5===t.tag||6===t.tag)return t;if(t.child)t.child.return=t,t=t.child;else{if(t===e)break;for(;!t.sibling;){if(!t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}}return null}function tt(e,t){for(var n=e.alternate;null!==t;){if(t===e||t===n)return!0;t=t.return}return!1}var nt,rt,it,at,ot=!1,lt=[],st=null,ut=null,ct=null,dt=new Map,ft=new Map,ht=[],pt="mousedown mouseup touchcancel touchend touchstart auxclick dblclick pointercancel pointerdown pointerup dragend dragstart drop compositionend compositionstart keydown keypress keyup input textInput copy cut paste click change contextmenu reset submit".split(" ");function gt(e,t,n,r,i){return{blockedOn:e,domEventName:t,eventSystemFlags:16|n,nativeEvent:i,targetContainers:[r]}}function mt(e,t){switch(e){case"focusin":case"focusout":st=null;break;case"dragenter":case"dragleave":ut=null;break;case"mouseover":case"mouseout":ct=null;break;case"pointerover":case"pointerout":dt.delete(t.pointerId);break;case"gotpointercapture":case"lostpointercapture":ft.delete(t.pointerId)}}function vt(e,t,n,r,i,a){return null===e||e.nativeEvent!==a?(e=gt(t,n,r,i,a),null!==t&&(null!==(t=ti(t))&&rt(t)),e):(e.eventSystemFlags|=r,t=e.targetContainers,null!==i&&-1===t.indexOf(i)&&t.push(i),e)}function yt(e){var t=ei(e.target);if(null!==t){var n=Qe(t);if(null!==n)if(13===(t=n.tag)){if(null!==(t=Ze(n)))return e.blockedOn=t,void at(e.lanePriority,(function(){a.unstable_runWithPriority(e.priority,(function(){it(n)}))}))}else if(3===t&&n.stateNode.hydrate)return void(e.blockedOn=3===n.tag?n.stateNode.containerInfo:null)}e.blockedOn=null}function bt(e){if(null!==e.blockedOn)return!1;for(var t=e.targetContainers;0<t.length;){var n=en(e.domEventName,e.eventSystemFlags,t[0],e.nativeEvent);if(null!==n)return null!==(t=ti(n))&&rt(t),e.blockedOn=n,!1;t.shift()}return!0}function xt(e,t,n){bt(e)&&n.delete(t)}function wt(){for(ot=!1;0<lt.length;){var e=lt[0];if(null!==e.blockedOn){null!==(e=ti(e.blockedOn))&&nt(e);break}for(var t=e.targetContainers;0<t.length;){var n=en(e.domEventName,e.eventSystemFlags,t[0],e.nativeEvent);if(null!==n){e.blockedOn=n;break}t.shift()}null===e.blockedOn&&lt.shift()}null!==st&&bt(st)&&(st=null),null!==ut&&bt(ut)&&(ut=null),null!==ct&&bt(ct)&&(ct=null),dt.forEach(xt),ft.forEach(xt)}function _t(e,t){e.blockedOn===t&&(e.blockedOn=null,ot||(ot=!0,a.unstable_scheduleCallback(a.unstable_NormalPriority,wt)))}function kt(e){function t(t){return _t(t,e)}if(0<lt.length){_t(lt[0],e);for(var n=1;n<lt.length;n++){var r=lt[n];r.blockedOn===e&&(r.blockedOn=null)}}for(null!==st&&_t(st,e),null!==ut&&_t(ut,e),null!==ct&&_t(ct,e),dt.forEach(t),ft.forEach(t),n=0;n<ht.length;n++)(r=ht[n]).blockedOn===e&&(r.blockedOn=null);for(;0<ht.length&&null===(n=ht[0]).blockedOn;)yt(n),null===n.blockedOn&&ht.shift()}function St(e,t){var n={};return n[e.toLowerCase()]=t.toLowerCase(),n["Webkit"+e]="webkit"+t,n["Moz"+e]="moz"+t,n}var Mt={animationend:St("Animation","AnimationEnd"),animationiteration:St("Animation","AnimationIteration"),animationstart:St("Animation","AnimationStart"),transitionend:St("Transition","TransitionEnd")},Ct={},Et={};function Ot(e){if(Ct[e])return Ct[e];if(!Mt[e])return e;var t,n=Mt[e];for(t in n)if(n.hasOwnProperty(t)&&t in Et)return Ct[e]=n[t];return e}d&&(Et=document.createElement("div").style,"AnimationEvent"in window||(delete Mt.animationend.animation,delete Mt.animationiteration.animation,delete Mt.animationstart.animation),"TransitionEvent"in window||delete Mt.transitionend.transition);var Pt=Ot("animationend"),Tt=Ot("animationiteration"),Dt=Ot("animationstart"),Nt=Ot("transitionend"),Rt=new Map,At=new Map,It=["abort","abort",Pt,"animationEnd",Tt,"animationIteration",Dt,"animationStart","canplay","canPlay","canplaythrough","canPlayThrough","durationchange","durationChange","emptied","emptied","encrypted","encrypted","ended","ended","error","error","gotpointercapture","gotPointerCapture","load","load","loadeddata","loadedData","loadedmetadata","loadedMetadata","loadstart","loadStart","lostpointercapture","lostPointerCapture","playing","playing","progress","progress","seeking","seeking","stalled","stalled","suspend","suspend","timeupdate","timeUpdate",Nt,"transitionEnd","waiting","waiting"];function Lt(e,t){for(var n=0;n<e.length;n+=2){var r=e[n],i=e[n+1];i="on"+(i[0].toUpperCase()+i.slice(1)),At.set(r,t),Rt.set(r,i),u(i,[r])}}(0,a.unstable_now)();var jt=8;function Ft(e){if(0!==(1&e))return jt=15,1;if(0!==(2&e))return jt=14,2;if(0!==(4&e))return jt=13,4;var t=24&e;return 0!==t?(jt=12,t):0!==(32&e)?(jt=11,32):0!==(t=192&e)?(jt=10,t):0!==(256&e)?(jt=9,256):0!==(t=3584&e)?(jt=8,t):0!==(4096&e)?(jt=7,4096):0!==(t=4186112&e)?(jt=6,t):0!==(t=62914560&e)?(jt=5,t):67108864&e?(jt=4,67108864):0!==(134217728&e)?(jt=3,134217728):0!==(t=805306368&e)?(jt=2,t):0!==(1073741824&e)?(jt=1,1073741824):(jt=8,e)}function zt(e,t){var n=e.pendingLanes;if(0===n)return jt=0;var r=0,i=0,a=e.expiredLanes,o=e.suspendedLanes,l=e.pingedLanes;if(0!==a)r=a,i=jt=15;else if(0!==(a=134217727&n)){var s=a&~o;0!==s?(r=Ft(s),i=jt):0!==(l&=a)&&(r=Ft(l),i=jt)}else 0!==(a=n&~o)?(r=Ft(a),i=jt):0!==l&&(r=Ft(l),i=jt);if(0===r)return 0;if(r=n&((0>(r=31-Bt(r))?0:1<<r)<<1)-1,0!==t&&t!==r&&0===(t&o)){if(Ft(t),i<=jt)return t;jt=i}if(0!==(t=e.entangledLanes))for(e=e.entanglements,t&=r;0<t;)i=1<<(n=31-Bt(t)),r|=e[n],t&=~i;return r}function Wt(e){return 0!==(e=-1073741825&e.pendingLanes)?e:1073741824&e?1073741824:0}function Yt(e,t){switch(e){case 15:return 1;case 14:return 2;case 12:return 0===(e=Ht(24&~t))?Yt(10,t):e;case 10:return 0===(e=Ht(192&~t))?Yt(8,t):e;case 8:return 0===(e=Ht(3584&~t))&&(0===(e=Ht(4186112&~t))&&(e=512)),e;case 2:return 0===(t=Ht(805306368&~t))&&(t=268435456),t}throw Error(o(358,e))}function Ht(e){return e&-e}function Ut(e){for(var t=[],n=0;31>n;n++)t.push(e);return t}function Vt(e,t,n){e.pendingLanes|=t;var r=t-1;e.suspendedLanes&=r,e.pingedLanes&=r,(e=e.eventTimes)[t=31-Bt(t)]=n}var Bt=Math.clz32?Math.clz32:function(e){return 0===e?32:31-($t(e)/Xt|0)|0},$t=Math.log,Xt=Math.LN2;var qt=a.unstable_UserBlockingPriority,Gt=a.unstable_runWithPriority,Kt=!0;function Qt(e,t,n,r){Fe||Le();var i=Jt,a=Fe;Fe=!0;try{Ie(i,e,t,n,r)}finally{(Fe=a)||We()}}function Zt(e,t,n,r){Gt(qt,Jt.bind(null,e,t,n,r))}function Jt(e,t,n,r){var i;if(Kt)if((i=0===(4&t))&&0<lt.length&&-1<pt.indexOf(e))e=gt(null,e,t,n,r),lt.push(e);else{var a=en(e,t,n,r);if(null===a)i&&mt(e,r);else{if(i){if(-1<pt.indexOf(e))return e=gt(a,e,t,n,r),void lt.push(e);if(function(e,t,n,r,i){switch(t){case"focusin":return st=vt(st,e,t,n,r,i),!0;case"dragenter":return ut=vt(ut,e,t,n,r,i),!0;case"mouseover":return ct=vt(ct,e,t,n,r,i),!0;case"pointerover":var a=i.pointerId;return dt.set(a,vt(dt.get(a)||null,e,t,n,r,i)),!0;case"gotpointercapture":return a=i.pointerId,ft.set(a,vt(ft.get(a)||null,e,t,n,r,i)),!0}return!1}(a,e,t,n,r))return;mt(e,r)}Rr(e,t,r,null,n)}}}function en(e,t,n,r){var i=Ee(r);if(null!==(i=ei(i))){var a=Qe(i);if(null===a)i=null;else{var o=a.tag;if(13===o){if(null!==(i=Ze(a)))return i;i=null}else if(3===o){if(a.stateNode.hydrate)return 3===a.tag?a.stateNode.containerInfo:null;i=null}else a!==i&&(i=null)}}return Rr(e,t,r,i,n),null}var tn=null,nn=null,rn=null;function an(){if(rn)return rn;var e,t,n=nn,r=n.length,i="value"in tn?tn.value:tn.textContent,a=i.length;for(e=0;e<r&&n[e]===i[e];e++);var o=r-e;for(t=1;t<=o&&n[r-t]===i[a-t];t++);return rn=i.slice(e,1<t?1-t:void 0)}function on(e){var t=e.keyCode;return"charCode"in e?0===(e=e.charCode)&&13===t&&(e=13):e=t,10===e&&(e=13),32<=e||13===e?e:0}function ln(){return!0}function sn(){return!1}function un(e){function t(t,n,r,i,a){for(var o in this._reactName=t,this._targetInst=r,this.type=n,this.nativeEvent=i,this.target=a,this.currentTarget=null,e)e.hasOwnProperty(o)&&(t=e[o],this[o]=t?t(i):i[o]);return this.isDefaultPrevented=(null!=i.defaultPrevented?i.defaultPrevented:!1===i.returnValue)?ln:sn,this.isPropagationStopped=sn,this}return i(t.prototype,{preventDefault:function(){this.defaultPrevented=!0;var e=this.nativeEvent;e&&(e.preventDefault?e.preventDefault():"unknown"!==typeof e.returnValue&&(e.returnValue=!1),this.isDefaultPrevented=ln)},stopPropagation:function(){var e=this.nativeEvent;e&&(e.stopPropagation?e.stopPropagation():"unknown"!==typeof e.cancelBubble&&(e.cancelBubble=!0),this.isPropagationStopped=ln)},persist:function(){},isPersistent:ln}),t}var cn,dn,fn,hn={eventPhase:0,bubbles:0,cancelable:0,timeStamp:function(e){return e.timeStamp||Date.now()},defaultPrevented:0,isTrusted:0},pn=un(hn),gn=i({},hn,{view:0,detail:0}),mn=un(gn),vn=i({},gn,{screenX:0,screenY:0,clientX:0,clientY:0,pageX:0,pageY:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,getModifierState:On,button:0,buttons:0,relatedTarget:function(e){return void 0===e.relatedTarget?e.fromElement===e.srcElement?e.toElement:e.fromElement:e.relatedTarget},movementX:function(e){return"movementX"in e?e.movementX:(e!==fn&&(fn&&"mousemove"===e.type?(cn=e.screenX-fn.screenX,dn=e.screenY-fn.screenY):dn=cn=0,fn=e),cn)},movementY:function(e){return"movementY"in e?e.movementY:dn}}),yn=un(vn),bn=un(i({},vn,{dataTransfer:0})),xn=un(i({},gn,{relatedTarget:0})),wn=un(i({},hn,{animationName:0,elapsedTime:0,pseudoElement:0})),_n=un(i({},hn,{clipboardData:function(e){return"clipboardData"in e?e.clipboardData:window.clipboardData}})),kn=un(i({},hn,{data:0})),Sn={Esc:"Escape",Spacebar:" ",Left:"ArrowLeft",Up:"ArrowUp",Right:"ArrowRight",Down:"ArrowDown",Del:"Delete",Win:"OS",Menu:"ContextMenu",Apps:"ContextMenu",Scroll:"ScrollLock",MozPrintableKey:"Unidentified"},Mn={8:"Backspace",9:"Tab",12:"Clear",13:"Enter",16:"Shift",17:"Control",18:"Alt",19:"Pause",20:"CapsLock",27:"Escape",32:" ",33:"PageUp",34:"PageDown",35:"End",36:"Home",37:"ArrowLeft",38:"ArrowUp",39:"ArrowRight",40:"ArrowDown",45:"Insert",46:"Delete",112:"F1",113:"F2",114:"F3",115:"F4",116:"F5",117:"F6",118:"F7",119:"F8",120:"F9",121:"F10",122:"F11",123:"F12",144:"NumLock",145:"ScrollLock",224:"Meta"},Cn={Alt:"altKey",Control:"ctrlKey",Meta:"metaKey",Shift:"shiftKey"};function En(e){var t=this.nativeEvent;return t.getModifierState?t.getModifierState(e):!!(e=Cn[e])&&!!t[e]}function On(){return En}var Pn=un(i({},gn,{key:function(e){if(e.key){var t=Sn[e.key]||e.key;if("Unidentified"!==t)return t}return"keypress"===e.type?13===(e=on(e))?"Enter":String.fromCharCode(e):"keydown"===e.type||"keyup"===e.type?Mn[e.keyCode]||"Unidentified":""},code:0,location:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,repeat:0,locale:0,getModifierState:On,charCode:function(e){return"keypress"===e.type?on(e):0},keyCode:function(e){return"keydown"===e.type||"keyup"===e.type?e.keyCode:0},which:function(e){return"keypress"===e.type?on(e):"keydown"===e.type||"keyup"===e.type?e.keyCode:0}})),Tn=un(i({},vn,{pointerId:0,width:0,height:0,pressure:0,tangentialPressure:0,tiltX:0,tiltY:0,twist:0,pointerType:0,isPrimary:0})),Dn=un(i({},gn,{touches:0,targetTouches:0,changedTouches:0,altKey:0,metaKey:0,ctrlKey:0,shiftKey:0,getModifierState:On})),Nn=un(i({},hn,{propertyName:0,elapsedTime:0,pseudoElement:0})),Rn=un(i({},vn,{deltaX:function(e){return"deltaX"in e?e.deltaX:"wheelDeltaX"in e?-e.wheelDeltaX:0},deltaY:function(e){return"deltaY"in e?e.deltaY:"wheelDeltaY"in e?-e.wheelDeltaY:"wheelDelta"in e?-e.wheelDelta:0},deltaZ:0,deltaMode:0})),An=[9,13,27,32],In=d&&"CompositionEvent"in window,Ln=null;d&&"documentMode"in document&&(Ln=document.documentMode);var jn=d&&"TextEvent"in window&&!Ln,Fn=d&&(!In||Ln&&8<Ln&&11>=Ln),zn=String.fromCharCode(32),Wn=!1;function Yn(e,t){switch(e){case"keyup":return-1!==An.indexOf(t.keyCode);case"keydown":return 229!==t.keyCode;case"keypress":case"mousedown":case"focusout":return!0;default:return!1}}function Hn(e){return"object"===typeof(e=e.detail)&&"data"in e?e.data:null}var Un=!1;var Vn={color:!0,date:!0,datetime:!0,"datetime-local":!0,email:!0,month:!0,number:!0,password:!0,range:!0,search:!0,tel:!0,text:!0,time:!0,url:!0,week:!0};function Bn(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return"input"===t?!!Vn[e.type]:"textarea"===t}function $n(e,t,n,r){Ne(r),0<(t=Ir(t,"onChange")).length&&(n=new pn("onChange","change",null,n,r),e.push({event:n,listeners:t}))}var Xn=null,qn=null;function Gn(e){Er(e,0)}function Kn(e){if(Z(ni(e)))return e}function Qn(e,t){if("change"===e)return t}var Zn=!1;if(d){var Jn;if(d){var er="oninput"in document;if(!er){var tr=document.createElement("div");tr.setAttribute("oninput","return;"),er="function"===typeof tr.oninput}Jn=er}else Jn=!1;Zn=Jn&&(!document.documentMode||9<document.documentMode)}function nr(){Xn&&(Xn.detachEvent("onpropertychange",rr),qn=Xn=null)}function rr(e){if("value"===e.propertyName&&Kn(qn)){var t=[];if($n(t,qn,e,Ee(e)),e=Gn,Fe)e(t);else{Fe=!0;try{Ae(e,t)}finally{Fe=!1,We()}}}}function ir(e,t,n){"focusin"===e?(nr(),qn=n,(Xn=t).attachEvent("onpropertychange",rr)):"focusout"===e&&nr()}function ar(e){if("selectionchange"===e||"keyup"===e||"keydown"===e)return Kn(qn)}function or(e,t){if("click"===e)return Kn(t)}function lr(e,t){if("input"===e||"change"===e)return Kn(t)}var sr="function"===typeof Object.is?Object.is:function(e,t){return e===t&&(0!==e||1/e===1/t)||e!==e&&t!==t},ur=Object.prototype.hasOwnProperty;function cr(e,t){if(sr(e,t))return!0;if("object"!==typeof e||null===e||"object"!==typeof t||null===t)return!1;var n=Object.keys(e),r=Object.keys(t);if(n.length!==r.length)return!1;for(r=0;r<n.length;r++)if(!ur.call(t,n[r])||!sr(e[n[r]],t[n[r]]))return!1;return!0}function dr(e){for(;e&&e.firstChild;)e=e.firstChild;return e}function fr(e,t){var n,r=dr(e);for(e=0;r;){if(3===r.nodeType){if(n=e+r.textContent.length,e<=t&&n>=t)return{node:r,offset:t-e};e=n}e:{for(;r;){if(r.nextSibling){r=r.nextSibling;break e}r=r.parentNode}r=void 0}r=dr(r)}}function hr(e,t){return!(!e||!t)&&(e===t||(!e||3!==e.nodeType)&&(t&&3===t.nodeType?hr(e,t.parentNode):"contains"in e?e.contains(t):!!e.compareDocumentPosition&&!!(16&e.compareDocumentPosition(t))))}function pr(){for(var e=window,t=J();t instanceof e.HTMLIFrameElement;){try{var n="string"===typeof t.contentWindow.location.href}catch(r){n=!1}if(!n)break;t=J((e=t.contentWindow).document)}return t}function gr(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return t&&("input"===t&&("text"===e.type||"search"===e.type||"tel"===e.type||"url"===e.type||"password"===e.type)||"textarea"===t||"true"===e.contentEditable)}var mr=d&&"documentMode"in document&&11>=document.documentMode,vr=null,yr=null,br=null,xr=!1;function wr(e,t,n){var r=n.window===n?n.document:9===n.nodeType?n:n.ownerDocument;xr||null==vr||vr!==J(r)||("selectionStart"in(r=vr)&&gr(r)?r={start:r.selectionStart,end:r.selectionEnd}:r={anchorNode:(r=(r.ownerDocument&&r.ownerDocument.defaultView||window).getSelection()).anchorNode,anchorOffset:r.anchorOffset,focusNode:r.focusNode,focusOffset:r.focusOffset},br&&cr(br,r)||(br=r,0<(r=Ir(yr,"onSelect")).length&&(t=new pn("onSelect","select",null,t,n),e.push({event:t,listeners:r}),t.target=vr)))}Lt("cancel cancel click click close close contextmenu contextMenu copy copy cut cut auxclick auxClick dblclick doubleClick dragend dragEnd dragstart dragStart drop drop focusin focus focusout blur input input invalid invalid keydown keyDown keypress keyPress keyup keyUp mousedown mouseDown mouseup mouseUp paste paste pause pause play play pointercancel pointerCancel pointerdown pointerDown pointerup pointerUp ratechange rateChange reset reset seeked seeked submit submit touchcancel touchCancel touchend touchEnd touchstart touchStart volumechange volumeChange".split(" "),0),Lt("drag drag dragenter dragEnter dragexit dragExit dragleave dragLeave dragover dragOver mousemove mouseMove mouseout mouseOut mouseover mouseOver pointermove pointerMove pointerout pointerOut pointerover pointerOver scroll scroll toggle toggle touchmove touchMove wheel wheel".split(" "),1),Lt(It,2);for(var _r="change selectionchange textInput compositionstart compositionend compositionupdate".split(" "),kr=0;kr<_r.length;kr++)At.set(_r[kr],0);c("onMouseEnter",["mouseout","mouseover"]),c("onMouseLeave",["mouseout","mouseover"]),c("onPointerEnter",["pointerout","pointerover"]),c("onPointerLeave",["pointerout","pointerover"]),u("onChange","change click focusin focusout input keydown keyup selectionchange".split(" ")),u("onSelect","focusout contextmenu dragend focusin keydown keyup mousedown mouseup selectionchange".split(" ")),u("onBeforeInput",["compositionend","keypress","textInput","paste"]),u("onCompositionEnd","compositionend focusout keydown keypress keyup mousedown".split(" ")),u("onCompositionStart","compositionstart focusout keydown keypress keyup mousedown".split(" ")),u("onCompositionUpdate","compositionupdate focusout keydown keypress keyup mousedown".split(" "));var Sr="abort canplay canplaythrough durationchange emptied encrypted ended error loadeddata loadedmetadata loadstart pause play playing progress ratechange seeked seeking stalled suspend timeupdate volumechange waiting".split(" "),Mr=new Set("cancel close invalid load scroll toggle".split(" ").concat(Sr));function Cr(e,t,n){var r=e.type||"unknown-event";e.currentTarget=n,function(e,t,n,r,i,a,l,s,u){if(Ke.apply(this,arguments),Be){if(!Be)throw Error(o(198));var c=$e;Be=!1,$e=null,Xe||(Xe=!0,qe=c)}}(r,t,void 0,e),e.currentTarget=null}function Er(e,t){t=0!==(4&t);for(var n=0;n<e.length;n++){var r=e[n],i=r.event;r=r.listeners;e:{var a=void 0;if(t)for(var o=r.length-1;0<=o;o--){var l=r[o],s=l.instance,u=l.currentTarget;if(l=l.listener,s!==a&&i.isPropagationStopped())break e;Cr(i,l,u),a=s}else for(o=0;o<r.length;o++){if(s=(l=r[o]).instance,u=l.currentTarget,l=l.listener,s!==a&&i.isPropagationStopped())break e;Cr(i,l,u),a=s}}}if(Xe)throw e=qe,Xe=!1,qe=null,e}function Or(e,t){var n=ii(t),r=e+"__bubble";n.has(r)||(Nr(t,e,2,!1),n.add(r))}var Pr="_reactListening"+Math.random().toString(36).slice(2);function Tr(e){e[Pr]||(e[Pr]=!0,l.forEach((function(t){Mr.has(t)||Dr(t,!1,e,null),Dr(t,!0,e,null)})))}function Dr(e,t,n,r){var i=4<arguments.length&&void 0!==arguments[4]?arguments[4]:0,a=n;if("selectionchange"===e&&9!==n.nodeType&&(a=n.ownerDocument),null!==r&&!t&&Mr.has(e)){if("scroll"!==e)return;i|=2,a=r}var o=ii(a),l=e+"__"+(t?"capture":"bubble");o.has(l)||(t&&(i|=4),Nr(a,e,i,t),o.add(l))}function Nr(e,t,n,r){var i=At.get(t);switch(void 0===i?2:i){case 0:i=Qt;break;case 1:i=Zt;break;default:i=Jt}n=i.bind(null,t,n,e),i=void 0,!He||"touchstart"!==t&&"touchmove"!==t&&"wheel"!==t||(i=!0),r?void 0!==i?e.addEventListener(t,n,{capture:!0,passive:i}):e.addEventListener(t,n,!0):void 0!==i?e.addEventListener(t,n,{passive:i}):e.addEventListener(t,n,!1)}function Rr(e,t,n,r,i){var a=r;if(0===(1&t)&&0===(2&t)&&null!==r)e:for(;;){if(null===r)return;var o=r.tag;if(3===o||4===o){var l=r.stateNode.containerInfo;if(l===i||8===l.nodeType&&l.parentNode===i)break;if(4===o)for(o=r.return;null!==o;){var s=o.tag;if((3===s||4===s)&&((s=o.stateNode.containerInfo)===i||8===s.nodeType&&s.parentNode===i))return;o=o.return}for(;null!==l;){if(null===(o=ei(l)))return;if(5===(s=o.tag)||6===s){r=a=o;continue e}l=l.parentNode}}r=r.return}!function(e,t,n){if(ze)return e(t,n);ze=!0;try{je(e,t,n)}finally{ze=!1,We()}}((function(){var r=a,i=Ee(n),o=[];e:{var l=Rt.get(e);if(void 0!==l){var s=pn,u=e;switch(e){case"keypress":if(0===on(n))break e;case"keydown":case"keyup":s=Pn;break;case"focusin":u="focus",s=xn;break;case"focusout":u="blur",s=xn;break;case"beforeblur":case"afterblur":s=xn;break;case"click":if(2===n.button)break e;case"auxclick":case"dblclick":case"mousedown":case"mousemove":case"mouseup":case"mouseout":case"mouseover":case"contextmenu":s=yn;break;case"drag":case"dragend":case"dragenter":case"dragexit":case"dragleave":case"dragover":case"dragstart":case"drop":s=bn;break;case"touchcancel":case"touchend":case"touchmove":case"touchstart":s=Dn;break;case Pt:case Tt:case Dt:s=wn;break;case Nt:s=Nn;break;case"scroll":s=mn;break;case"wheel":s=Rn;break;case"copy":case"cut":case"paste":s=_n;break;case"gotpointercapture":case"lostpointercapture":case"pointercancel":case"pointerdown":case"pointermove":case"pointerout":case"pointerover":case"pointerup":s=Tn}var c=0!==(4&t),d=!c&&"scroll"===e,f=c?null!==l?l+"Capture":null:l;c=[];for(var h,p=r;null!==p;){var g=(h=p).stateNode;if(5===h.tag&&null!==g&&(h=g,null!==f&&(null!=(g=Ye(p,f))&&c.push(Ar(p,g,h)))),d)break;p=p.return}0<c.length&&(l=new s(l,u,null,n,i),o.push({event:l,listeners:c}))}}if(0===(7&t)){if(s="mouseout"===e||"pointerout"===e,(!(l="mouseover"===e||"pointerover"===e)||0!==(16&t)||!(u=n.relatedTarget||n.fromElement)||!ei(u)&&!u[Zr])&&(s||l)&&(l=i.window===i?i:(l=i.ownerDocument)?l.defaultView||l.parentWindow:window,s?(s=r,null!==(u=(u=n.relatedTarget||n.toElement)?ei(u):null)&&(u!==(d=Qe(u))||5!==u.tag&&6!==u.tag)&&(u=null)):(s=null,u=r),s!==u)){if(c=yn,g="onMouseLeave",f="onMouseEnter",p="mouse","pointerout"!==e&&"pointerover"!==e||(c=Tn,g="onPointerLeave",f="onPointerEnter",p="pointer"),d=null==s?l:ni(s),h=null==u?l:ni(u),(l=new c(g,p+"leave",s,n,i)).target=d,l.relatedTarget=h,g=null,ei(i)===r&&((c=new c(f,p+"enter",u,n,i)).target=h,c.relatedTarget=d,g=c),d=g,s&&u)e:{for(f=u,p=0,h=c=s;h;h=Lr(h))p++;for(h=0,g=f;g;g=Lr(g))h++;for(;0<p-h;)c=Lr(c),p--;for(;0<h-p;)f=Lr(f),h--;for(;p--;){if(c===f||null!==f&&c===f.alternate)break e;c=Lr(c),f=Lr(f)}c=null}else c=null;null!==s&&jr(o,l,s,c,!1),null!==u&&null!==d&&jr(o,d,u,c,!0)}if("select"===(s=(l=r?ni(r):window).nodeName&&l.nodeName.toLowerCase())||"input"===s&&"file"===l.type)var m=Qn;else if(Bn(l))if(Zn)m=lr;else{m=ar;var v=ir}else(s=l.nodeName)&&"input"===s.toLowerCase()&&("checkbox"===l.type||"radio"===l.type)&&(m=or);switch(m&&(m=m(e,r))?$n(o,m,n,i):(v&&v(e,l,r),"focusout"===e&&(v=l._wrapperState)&&v.controlled&&"number"===l.type&&ae(l,"number",l.value)),v=r?ni(r):window,e){case"focusin":(Bn(v)||"true"===v.contentEditable)&&(vr=v,yr=r,br=null);break;case"focusout":br=yr=vr=null;break;case"mousedown":xr=!0;break;case"contextmenu":case"mouseup":case"dragend":xr=!1,wr(o,n,i);break;case"selectionchange":if(mr)break;case"keydown":case"keyup":wr(o,n,i)}var y;if(In)e:{switch(e){case"compositionstart":var b="onCompositionStart";break e;case"compositionend":b="onCompositionEnd";break e;case"compositionupdate":b="onCompositionUpdate";break e}b=void 0}else Un?Yn(e,n)&&(b="onCompositionEnd"):"keydown"===e&&229===n.keyCode&&(b="onCompositionStart");b&&(Fn&&"ko"!==n.locale&&(Un||"onCompositionStart"!==b?"onCompositionEnd"===b&&Un&&(y=an()):(nn="value"in(tn=i)?tn.value:tn.textContent,Un=!0)),0<(v=Ir(r,b)).length&&(b=new kn(b,e,null,n,i),o.push({event:b,listeners:v}),y?b.data=y:null!==(y=Hn(n))&&(b.data=y))),(y=jn?function(e,t){switch(e){case"compositionend":return Hn(t);case"keypress":return 32!==t.which?null:(Wn=!0,zn);case"textInput":return(e=t.data)===zn&&Wn?null:e;default:return null}}(e,n):function(e,t){if(Un)return"compositionend"===e||!In&&Yn(e,t)?(e=an(),rn=nn=tn=null,Un=!1,e):null;switch(e){case"paste":return null;case"keypress":if(!(t.ctrlKey||t.altKey||t.metaKey)||t.ctrlKey&&t.altKey){if(t.char&&1<t.char.length)return t.char;if(t.which)return String.fromCharCode(t.which)}return null;case"compositionend":return Fn&&"ko"!==t.locale?null:t.data;default:return null}}(e,n))&&(0<(r=Ir(r,"onBeforeInput")).length&&(i=new kn("onBeforeInput","beforeinput",null,n,i),o.push({event:i,listeners:r}),i.data=y))}Er(o,t)}))}function Ar(e,t,n){return{instance:e,listener:t,currentTarget:n}}function Ir(e,t){for(var n=t+"Capture",r=[];null!==e;){var i=e,a=i.stateNode;5===i.tag&&null!==a&&(i=a,null!=(a=Ye(e,n))&&r.unshift(Ar(e,a,i)),null!=(a=Ye(e,t))&&r.push(Ar(e,a,i))),e=e.return}return r}function Lr(e){if(null===e)return null;do{e=e.return}while(e&&5!==e.tag);return e||null}function jr(e,t,n,r,i){for(var a=t._reactName,o=[];null!==n&&n!==r;){var l=n,s=l.alternate,u=l.stateNode;if(null!==s&&s===r)break;5===l.tag&&null!==u&&(l=u,i?null!=(s=Ye(n,a))&&o.unshift(Ar(n,s,l)):i||null!=(s=Ye(n,a))&&o.push(Ar(n,s,l))),n=n.return}0!==o.length&&e.push({event:t,listeners:o})}function Fr(){}var zr=null,Wr=null;function Yr(e,t){switch(e){case"button":case"input":case"select":case"textarea":return!!t.autoFocus}return!1}function Hr(e,t){return"textarea"===e||"option"===e||"noscript"===e||"string"===typeof t.children||"number"===typeof t.children||"object"===typeof t.dangerouslySetInnerHTML&&null!==t.dangerouslySetInnerHTML&&null!=t.dangerouslySetInnerHTML.__html}var Ur="function"===typeof setTimeout?setTimeout:void 0,Vr="function"===typeof clearTimeout?clearTimeout:void 0;function Br(e){1===e.nodeType?e.textContent="":9===e.nodeType&&(null!=(e=e.body)&&(e.textContent=""))}function $r(e){for(;null!=e;e=e.nextSibling){var t=e.nodeType;if(1===t||3===t)break}return e}function Xr(e){e=e.previousSibling;for(var t=0;e;){if(8===e.nodeType){var n=e.data;if("$"===n||"$!"===n||"$?"===n){if(0===t)return e;t--}else"/$"===n&&t++}e=e.previousSibling}return null}var qr=0;var Gr=Math.random().toString(36).slice(2),Kr="__reactFiber$"+Gr,Qr="__reactProps$"+Gr,Zr="__reactContainer$"+Gr,Jr="__reactEvents$"+Gr;function ei(e){var t=e[Kr];if(t)return t;for(var n=e.parentNode;n;){if(t=n[Zr]||n[Kr]){if(n=t.alternate,null!==t.child||null!==n&&null!==n.child)for(e=Xr(e);null!==e;){if(n=e[Kr])return n;e=Xr(e)}return t}n=(e=n).parentNode}return null}function ti(e){return!(e=e[Kr]||e[Zr])||5!==e.tag&&6!==e.tag&&13!==e.tag&&3!==e.tag?null:e}function ni(e){if(5===e.tag||6===e.tag)return e.stateNode;throw Error(o(33))}function ri(e){return e[Qr]||null}function ii(e){var t=e[Jr];return void 0===t&&(t=e[Jr]=new Set),t}var ai=[],oi=-1;function li(e){return{current:e}}function si(e){0>oi||(e.current=ai[oi],ai[oi]=null,oi--)}function ui(e,t){oi++,ai[oi]=e.current,e.current=t}var ci={},di=li(ci),fi=li(!1),hi=ci;function pi(e,t){var n=e.type.contextTypes;if(!n)return ci;var r=e.stateNode;if(r&&r.__reactInternalMemoizedUnmaskedChildContext===t)return r.__reactInternalMemoizedMaskedChildContext;var i,a={};for(i in n)a[i]=t[i];return r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=t,e.__reactInternalMemoizedMaskedChildContext=a),a}function gi(e){return null!==(e=e.childContextTypes)&&void 0!==e}function mi(){si(fi),si(di)}function vi(e,t,n){if(di.current!==ci)throw Error(o(168));ui(di,t),ui(fi,n)}function yi(e,t,n){var r=e.stateNode;if(e=t.childContextTypes,"function"!==typeof r.getChildContext)return n;for(var a in r=r.getChildContext())if(!(a in e))throw Error(o(108,q(t)||"Unknown",a));return i({},n,r)}function bi(e){return e=(e=e.stateNode)&&e.__reactInternalMemoizedMergedChildContext||ci,hi=di.current,ui(di,e),ui(fi,fi.current),!0}function xi(e,t,n){var r=e.stateNode;if(!r)throw Error(o(169));n?(e=yi(e,t,hi),r.__reactInternalMemoizedMergedChildContext=e,si(fi),si(di),ui(di,e)):si(fi),ui(fi,n)}var wi=null,_i=null,ki=a.unstable_runWithPriority,Si=a.unstable_scheduleCallback,Mi=a.unstable_cancelCallback,Ci=a.unstable_shouldYield,Ei=a.unstable_requestPaint,Oi=a.unstable_now,Pi=a.unstable_getCurrentPriorityLevel,Ti=a.unstable_ImmediatePriority,Di=a.unstable_UserBlockingPriority,Ni=a.unstable_NormalPriority,Ri=a.unstable_LowPriority,Ai=a.unstable_IdlePriority,Ii={},Li=void 0!==Ei?Ei:function(){},ji=null,Fi=null,zi=!1,Wi=Oi(),Yi=1e4>Wi?Oi:function(){return Oi()-Wi};function Hi(){switch(Pi()){case Ti:return 99;case Di:return 98;case Ni:return 97;case Ri:return 96;case Ai:return 95;default:throw Error(o(332))}}function Ui(e){switch(e){case 99:return Ti;case 98:return Di;case 97:return Ni;case 96:return Ri;case 95:return Ai;default:throw Error(o(332))}}function Vi(e,t){return e=Ui(e),ki(e,t)}function Bi(e,t,n){return e=Ui(e),Si(e,t,n)}function $i(){if(null!==Fi){var e=Fi;Fi=null,Mi(e)}Xi()}function Xi(){if(!zi&&null!==ji){zi=!0;var e=0;try{var t=ji;Vi(99,(function(){for(;e<t.length;e++){var n=t[e];do{n=n(!0)}while(null!==n)}})),ji=null}catch(n){throw null!==ji&&(ji=ji.slice(e+1)),Si(Ti,$i),n}finally{zi=!1}}}var qi=_.ReactCurrentBatchConfig;function Gi(e,t){if(e&&e.defaultProps){for(var n in t=i({},t),e=e.defaultProps)void 0===t[n]&&(t[n]=e[n]);return t}return t}var Ki=li(null),Qi=null,Zi=null,Ji=null;function ea(){Ji=Zi=Qi=null}function ta(e){var t=Ki.current;si(Ki),e.type._context._currentValue=t}function na(e,t){for(;null!==e;){var n=e.alternate;if((e.childLanes&t)===t){if(null===n||(n.childLanes&t)===t)break;n.childLanes|=t}else e.childLanes|=t,null!==n&&(n.childLanes|=t);e=e.return}}function ra(e,t){Qi=e,Ji=Zi=null,null!==(e=e.dependencies)&&null!==e.firstContext&&(0!==(e.lanes&t)&&(Io=!0),e.firstContext=null)}function ia(e,t){if(Ji!==e&&!1!==t&&0!==t)if("number"===typeof t&&1073741823!==t||(Ji=e,t=1073741823),t={context:e,observedBits:t,next:null},null===Zi){if(null===Qi)throw Error(o(308));Zi=t,Qi.dependencies={lanes:0,firstContext:t,responders:null}}else Zi=Zi.next=t;return e._currentValue}var aa=!1;function oa(e){e.updateQueue={baseState:e.memoizedState,firstBaseUpdate:null,lastBaseUpdate:null,shared:{pending:null},effects:null}}function la(e,t){e=e.updateQueue,t.updateQueue===e&&(t.updateQueue={baseState:e.baseState,firstBaseUpdate:e.firstBaseUpdate,lastBaseUpdate:e.lastBaseUpdate,shared:e.shared,effects:e.effects})}function sa(e,t){return{eventTime:e,lane:t,tag:0,payload:null,callback:null,next:null}}function ua(e,t){if(null!==(e=e.updateQueue)){var n=(e=e.shared).pending;null===n?t.next=t:(t.next=n.next,n.next=t),e.pending=t}}function ca(e,t){var n=e.updateQueue,r=e.alternate;if(null!==r&&n===(r=r.updateQueue)){var i=null,a=null;if(null!==(n=n.firstBaseUpdate)){do{var o={eventTime:n.eventTime,lane:n.lane,tag:n.tag,payload:n.payload,callback:n.callback,next:null};null===a?i=a=o:a=a.next=o,n=n.next}while(null!==n);null===a?i=a=t:a=a.next=t}else i=a=t;return n={baseState:r.baseState,firstBaseUpdate:i,lastBaseUpdate:a,shared:r.shared,effects:r.effects},void(e.updateQueue=n)}null===(e=n.lastBaseUpdate)?n.firstBaseUpdate=t:e.next=t,n.lastBaseUpdate=t}function da(e,t,n,r){var a=e.updateQueue;aa=!1;var o=a.firstBaseUpdate,l=a.lastBaseUpdate,s=a.shared.pending;if(null!==s){a.shared.pending=null;var u=s,c=u.next;u.next=null,null===l?o=c:l.next=c,l=u;var d=e.alternate;if(null!==d){var f=(d=d.updateQueue).lastBaseUpdate;f!==l&&(null===f?d.firstBaseUpdate=c:f.next=c,d.lastBaseUpdate=u)}}if(null!==o){for(f=a.baseState,l=0,d=c=u=null;;){s=o.lane;var h=o.eventTime;if((r&s)===s){null!==d&&(d=d.next={eventTime:h,lane:0,tag:o.tag,payload:o.payload,callback:o.callback,next:null});e:{var p=e,g=o;switch(s=t,h=n,g.tag){case 1:if("function"===typeof(p=g.payload)){f=p.call(h,f,s);break e}f=p;break e;case 3:p.flags=-4097&p.flags|64;case 0:if(null===(s="function"===typeof(p=g.payload)?p.call(h,f,s):p)||void 0===s)break e;f=i({},f,s);break e;case 2:aa=!0}}null!==o.callback&&(e.flags|=32,null===(s=a.effects)?a.effects=[o]:s.push(o))}else h={eventTime:h,lane:s,tag:o.tag,payload:o.payload,callback:o.callback,next:null},null===d?(c=d=h,u=f):d=d.next=h,l|=s;if(null===(o=o.next)){if(null===(s=a.shared.pending))break;o=s.next,s.next=null,a.lastBaseUpdate=s,a.shared.pending=null}}null===d&&(u=f),a.baseState=u,a.firstBaseUpdate=c,a.lastBaseUpdate=d,zl|=l,e.lanes=l,e.memoizedState=f}}function fa(e,t,n){if(e=t.effects,t.effects=null,null!==e)for(t=0;t<e.length;t++){var r=e[t],i=r.callback;if(null!==i){if(r.callback=null,r=n,"function"!==typeof i)throw Error(o(191,i));i.call(r)}}}var ha=(new r.Component).refs;function pa(e,t,n,r){n=null===(n=n(r,t=e.memoizedState))||void 0===n?t:i({},t,n),e.memoizedState=n,0===e.lanes&&(e.updateQueue.baseState=n)}var ga={isMounted:function(e){return!!(e=e._reactInternals)&&Qe(e)===e},enqueueSetState:function(e,t,n){e=e._reactInternals;var r=cs(),i=ds(e),a=sa(r,i);a.payload=t,void 0!==n&&null!==n&&(a.callback=n),ua(e,a),fs(e,i,r)},enqueueReplaceState:function(e,t,n){e=e._reactInternals;var r=cs(),i=ds(e),a=sa(r,i);a.tag=1,a.payload=t,void 0!==n&&null!==n&&(a.callback=n),ua(e,a),fs(e,i,r)},enqueueForceUpdate:function(e,t){e=e._reactInternals;var n=cs(),r=ds(e),i=sa(n,r);i.tag=2,void 0!==t&&null!==t&&(i.callback=t),ua(e,i),fs(e,r,n)}};function ma(e,t,n,r,i,a,o){return"function"===typeof(e=e.stateNode).shouldComponentUpdate?e.shouldComponentUpdate(r,a,o):!t.prototype||!t.prototype.isPureReactComponent||(!cr(n,r)||!cr(i,a))}function va(e,t,n){var r=!1,i=ci,a=t.contextType;return"object"===typeof a&&null!==a?a=ia(a):(i=gi(t)?hi:di.current,a=(r=null!==(r=t.contextTypes)&&void 0!==r)?pi(e,i):ci),t=new t(n,a),e.memoizedState=null!==t.state&&void 0!==t.state?t.state:null,t.updater=ga,e.stateNode=t,t._reactInternals=e,r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=i,e.__reactInternalMemoizedMaskedChildContext=a),t}function ya(e,t,n,r){e=t.state,"function"===typeof t.componentWillReceiveProps&&t.componentWillReceiveProps(n,r),"function"===typeof t.UNSAFE_componentWillReceiveProps&&t.UNSAFE_componentWillReceiveProps(n,r),t.state!==e&&ga.enqueueReplaceState(t,t.state,null)}function ba(e,t,n,r){var i=e.stateNode;i.props=n,i.state=e.memoizedState,i.refs=ha,oa(e);var a=t.contextType;"object"===typeof a&&null!==a?i.context=ia(a):(a=gi(t)?hi:di.current,i.context=pi(e,a)),da(e,n,i,r),i.state=e.memoizedState,"function"===typeof(a=t.getDerivedStateFromProps)&&(pa(e,t,a,n),i.state=e.memoizedState),"function"===typeof t.getDerivedStateFromProps||"function"===typeof i.getSnapshotBeforeUpdate||"function"!==typeof i.UNSAFE_componentWillMount&&"function"!==typeof i.componentWillMount||(t=i.state,"function"===typeof i.componentWillMount&&i.componentWillMount(),"function"===typeof i.UNSAFE_componentWillMount&&i.UNSAFE_componentWillMount(),t!==i.state&&ga.enqueueReplaceState(i,i.state,null),da(e,n,i,r),i.state=e.memoizedState),"function"===typeof i.componentDidMount&&(e.flags|=4)}var xa=Array.isArray;function wa(e,t,n){if(null!==(e=n.ref)&&"function"!==typeof e&&"object"!==typeof e){if(n._owner){if(n=n._owner){if(1!==n.tag)throw Error(o(309));var r=n.stateNode}if(!r)throw Error(o(147,e));var i=""+e;return null!==t&&null!==t.ref&&"function"===typeof t.ref&&t.ref._stringRef===i?t.ref:((t=function(e){var t=r.refs;t===ha&&(t=r.refs={}),null===e?delete t[i]:t[i]=e})._stringRef=i,t)}if("string"!==typeof e)throw Error(o(284));if(!n._owner)throw Error(o(290,e))}return e}function _a(e,t){if("textarea"!==e.type)throw Error(o(31,"[object Object]"===Object.prototype.toString.call(t)?"object with keys {"+Object.keys(t).join(", ")+"}":t))}function ka(e){function t(t,n){if(e){var r=t.lastEffect;null!==r?(r.nextEffect=n,t.lastEffect=n):t.firstEffect=t.lastEffect=n,n.nextEffect=null,n.flags=8}}function n(n,r){if(!e)return null;for(;null!==r;)t(n,r),r=r.sibling;return null}function r(e,t){for(e=new Map;null!==t;)null!==t.key?e.set(t.key,t):e.set(t.index,t),t=t.sibling;return e}function i(e,t){return(e=Vs(e,t)).index=0,e.sibling=null,e}function a(t,n,r){return t.index=r,e?null!==(r=t.alternate)?(r=r.index)<n?(t.flags=2,n):r:(t.flags=2,n):n}function l(t){return e&&null===t.alternate&&(t.flags=2),t}function s(e,t,n,r){return null===t||6!==t.tag?((t=qs(n,e.mode,r)).return=e,t):((t=i(t,n)).return=e,t)}function u(e,t,n,r){return null!==t&&t.elementType===n.type?((r=i(t,n.props)).ref=wa(e,t,n),r.return=e,r):((r=Bs(n.type,n.key,n.props,null,e.mode,r)).ref=wa(e,t,n),r.return=e,r)}function c(e,t,n,r){return null===t||4!==t.tag||t.stateNode.containerInfo!==n.containerInfo||t.stateNode.implementation!==n.implementation?((t=Gs(n,e.mode,r)).return=e,t):((t=i(t,n.children||[])).return=e,t)}function d(e,t,n,r,a){return null===t||7!==t.tag?((t=$s(n,e.mode,r,a)).return=e,t):((t=i(t,n)).return=e,t)}function f(e,t,n){if("string"===typeof t||"number"===typeof t)return(t=qs(""+t,e.mode,n)).return=e,t;if("object"===typeof t&&null!==t){switch(t.$$typeof){case k:return(n=Bs(t.type,t.key,t.props,null,e.mode,n)).ref=wa(e,null,t),n.return=e,n;case S:return(t=Gs(t,e.mode,n)).return=e,t}if(xa(t)||U(t))return(t=$s(t,e.mode,n,null)).return=e,t;_a(e,t)}return null}function h(e,t,n,r){var i=null!==t?t.key:null;if("string"===typeof n||"number"===typeof n)return null!==i?null:s(e,t,""+n,r);if("object"===typeof n&&null!==n){switch(n.$$typeof){case k:return n.key===i?n.type===M?d(e,t,n.props.children,r,i):u(e,t,n,r):null;case S:return n.key===i?c(e,t,n,r):null}if(xa(n)||U(n))return null!==i?null:d(e,t,n,r,null);_a(e,n)}return null}function p(e,t,n,r,i){if("string"===typeof r||"number"===typeof r)return s(t,e=e.get(n)||null,""+r,i);if("object"===typeof r&&null!==r){switch(r.$$typeof){case k:return e=e.get(null===r.key?n:r.key)||null,r.type===M?d(t,e,r.props.children,i,r.key):u(t,e,r,i);case S:return c(t,e=e.get(null===r.key?n:r.key)||null,r,i)}if(xa(r)||U(r))return d(t,e=e.get(n)||null,r,i,null);_a(t,r)}return null}function g(i,o,l,s){for(var u=null,c=null,d=o,g=o=0,m=null;null!==d&&g<l.length;g++){d.index>g?(m=d,d=null):m=d.sibling;var v=h(i,d,l[g],s);if(null===v){null===d&&(d=m);break}e&&d&&null===v.alternate&&t(i,d),o=a(v,o,g),null===c?u=v:c.sibling=v,c=v,d=m}if(g===l.length)return n(i,d),u;if(null===d){for(;g<l.length;g++)null!==(d=f(i,l[g],s))&&(o=a(d,o,g),null===c?u=d:c.sibling=d,c=d);return u}for(d=r(i,d);g<l.length;g++)null!==(m=p(d,i,g,l[g],s))&&(e&&null!==m.alternate&&d.delete(null===m.key?g:m.key),o=a(m,o,g),null===c?u=m:c.sibling=m,c=m);return e&&d.forEach((function(e){return t(i,e)})),u}function m(i,l,s,u){var c=U(s);if("function"!==typeof c)throw Error(o(150));if(null==(s=c.call(s)))throw Error(o(151));for(var d=c=null,g=l,m=l=0,v=null,y=s.next();null!==g&&!y.done;m++,y=s.next()){g.index>m?(v=g,g=null):v=g.sibling;var b=h(i,g,y.value,u);if(null===b){null===g&&(g=v);break}e&&g&&null===b.alternate&&t(i,g),l=a(b,l,m),null===d?c=b:d.sibling=b,d=b,g=v}if(y.done)return n(i,g),c;if(null===g){for(;!y.done;m++,y=s.next())null!==(y=f(i,y.value,u))&&(l=a(y,l,m),null===d?c=y:d.sibling=y,d=y);return c}for(g=r(i,g);!y.done;m++,y=s.next())null!==(y=p(g,i,m,y.value,u))&&(e&&null!==y.alternate&&g.delete(null===y.key?m:y.key),l=a(y,l,m),null===d?c=y:d.sibling=y,d=y);return e&&g.forEach((function(e){return t(i,e)})),c}return function(e,r,a,s){var u="object"===typeof a&&null!==a&&a.type===M&&null===a.key;u&&(a=a.props.children);var c="object"===typeof a&&null!==a;if(c)switch(a.$$typeof){case k:e:{for(c=a.key,u=r;null!==u;){if(u.key===c){switch(u.tag){case 7:if(a.type===M){n(e,u.sibling),(r=i(u,a.props.children)).return=e,e=r;break e}break;default:if(u.elementType===a.type){n(e,u.sibling),(r=i(u,a.props)).ref=wa(e,u,a),r.return=e,e=r;break e}}n(e,u);break}t(e,u),u=u.sibling}a.type===M?((r=$s(a.props.children,e.mode,s,a.key)).return=e,e=r):((s=Bs(a.type,a.key,a.props,null,e.mode,s)).ref=wa(e,r,a),s.return=e,e=s)}return l(e);case S:e:{for(u=a.key;null!==r;){if(r.key===u){if(4===r.tag&&r.stateNode.containerInfo===a.containerInfo&&r.stateNode.implementation===a.implementation){n(e,r.sibling),(r=i(r,a.children||[])).return=e,e=r;break e}n(e,r);break}t(e,r),r=r.sibling}(r=Gs(a,e.mode,s)).return=e,e=r}return l(e)}if("string"===typeof a||"number"===typeof a)return a=""+a,null!==r&&6===r.tag?(n(e,r.sibling),(r=i(r,a)).return=e,e=r):(n(e,r),(r=qs(a,e.mode,s)).return=e,e=r),l(e);if(xa(a))return g(e,r,a,s);if(U(a))return m(e,r,a,s);if(c&&_a(e,a),"undefined"===typeof a&&!u)switch(e.tag){case 1:case 22:case 0:case 11:case 15:throw Error(o(152,q(e.type)||"Component"))}return n(e,r)}}var Sa=ka(!0),Ma=ka(!1),Ca={},Ea=li(Ca),Oa=li(Ca),Pa=li(Ca);function Ta(e){if(e===Ca)throw Error(o(174));return e}function Da(e,t){switch(ui(Pa,t),ui(Oa,e),ui(Ea,Ca),e=t.nodeType){case 9:case 11:t=(t=t.documentElement)?t.namespaceURI:ge(null,"");break;default:t=ge(t=(e=8===e?t.parentNode:t).namespaceURI||null,e=e.tagName)}si(Ea),ui(Ea,t)}function Na(){si(Ea),si(Oa),si(Pa)}function Ra(e){Ta(Pa.current);var t=Ta(Ea.current),n=ge(t,e.type);t!==n&&(ui(Oa,e),ui(Ea,n))}function Aa(e){Oa.current===e&&(si(Ea),si(Oa))}var Ia=li(0);function La(e){for(var t=e;null!==t;){if(13===t.tag){var n=t.memoizedState;if(null!==n&&(null===(n=n.dehydrated)||"$?"===n.data||"$!"===n.data))return t}else if(19===t.tag&&void 0!==t.memoizedProps.revealOrder){if(0!==(64&t.flags))return t}else if(null!==t.child){t.child.return=t,t=t.child;continue}if(t===e)break;for(;null===t.sibling;){if(null===t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}return null}var ja=null,Fa=null,za=!1;function Wa(e,t){var n=Hs(5,null,null,0);n.elementType="DELETED",n.type="DELETED",n.stateNode=t,n.return=e,n.flags=8,null!==e.lastEffect?(e.lastEffect.nextEffect=n,e.lastEffect=n):e.firstEffect=e.lastEffect=n}function Ya(e,t){switch(e.tag){case 5:var n=e.type;return null!==(t=1!==t.nodeType||n.toLowerCase()!==t.nodeName.toLowerCase()?null:t)&&(e.stateNode=t,!0);case 6:return null!==(t=""===e.pendingProps||3!==t.nodeType?null:t)&&(e.stateNode=t,!0);case 13:default:return!1}}function Ha(e){if(za){var t=Fa;if(t){var n=t;if(!Ya(e,t)){if(!(t=$r(n.nextSibling))||!Ya(e,t))return e.flags=-1025&e.flags|2,za=!1,void(ja=e);Wa(ja,n)}ja=e,Fa=$r(t.firstChild)}else e.flags=-1025&e.flags|2,za=!1,ja=e}}function Ua(e){for(e=e.return;null!==e&&5!==e.tag&&3!==e.tag&&13!==e.tag;)e=e.return;ja=e}function Va(e){if(e!==ja)return!1;if(!za)return Ua(e),za=!0,!1;var t=e.type;if(5!==e.tag||"head"!==t&&"body"!==t&&!Hr(t,e.memoizedProps))for(t=Fa;t;)Wa(e,t),t=$r(t.nextSibling);if(Ua(e),13===e.tag){if(!(e=null!==(e=e.memoizedState)?e.dehydrated:null))throw Error(o(317));e:{for(e=e.nextSibling,t=0;e;){if(8===e.nodeType){var n=e.data;if("/$"===n){if(0===t){Fa=$r(e.nextSibling);break e}t--}else"$"!==n&&"$!"!==n&&"$?"!==n||t++}e=e.nextSibling}Fa=null}}else Fa=ja?$r(e.stateNode.nextSibling):null;return!0}function Ba(){Fa=ja=null,za=!1}var $a=[];function Xa(){for(var e=0;e<$a.length;e++)$a[e]._workInProgressVersionPrimary=null;$a.length=0}var qa=_.ReactCurrentDispatcher,Ga=_.ReactCurrentBatchConfig,Ka=0,Qa=null,Za=null,Ja=null,eo=!1,to=!1;function no(){throw Error(o(321))}function ro(e,t){if(null===t)return!1;for(var n=0;n<t.length&&n<e.length;n++)if(!sr(e[n],t[n]))return!1;return!0}function io(e,t,n,r,i,a){if(Ka=a,Qa=t,t.memoizedState=null,t.updateQueue=null,t.lanes=0,qa.current=null===e||null===e.memoizedState?Do:No,e=n(r,i),to){a=0;do{if(to=!1,!(25>a))throw Error(o(301));a+=1,Ja=Za=null,t.updateQueue=null,qa.current=Ro,e=n(r,i)}while(to)}if(qa.current=To,t=null!==Za&&null!==Za.next,Ka=0,Ja=Za=Qa=null,eo=!1,t)throw Error(o(300));return e}function ao(){var e={memoizedState:null,baseState:null,baseQueue:null,queue:null,next:null};return null===Ja?Qa.memoizedState=Ja=e:Ja=Ja.next=e,Ja}function oo(){if(null===Za){var e=Qa.alternate;e=null!==e?e.memoizedState:null}else e=Za.next;var t=null===Ja?Qa.memoizedState:Ja.next;if(null!==t)Ja=t,Za=e;else{if(null===e)throw Error(o(310));e={memoizedState:(Za=e).memoizedState,baseState:Za.baseState,baseQueue:Za.baseQueue,queue:Za.queue,next:null},null===Ja?Qa.memoizedState=Ja=e:Ja=Ja.next=e}return Ja}function lo(e,t){return"function"===typeof t?t(e):t}function so(e){var t=oo(),n=t.queue;if(null===n)throw Error(o(311));n.lastRenderedReducer=e;var r=Za,i=r.baseQueue,a=n.pending;if(null!==a){if(null!==i){var l=i.next;i.next=a.next,a.next=l}r.baseQueue=i=a,n.pending=null}if(null!==i){i=i.next,r=r.baseState;var s=l=a=null,u=i;do{var c=u.lane;if((Ka&c)===c)null!==s&&(s=s.next={lane:0,action:u.action,eagerReducer:u.eagerReducer,eagerState:u.eagerState,next:null}),r=u.eagerReducer===e?u.eagerState:e(r,u.action);else{var d={lane:c,action:u.action,eagerReducer:u.eagerReducer,eagerState:u.eagerState,next:null};null===s?(l=s=d,a=r):s=s.next=d,Qa.lanes|=c,zl|=c}u=u.next}while(null!==u&&u!==i);null===s?a=r:s.next=l,sr(r,t.memoizedState)||(Io=!0),t.memoizedState=r,t.baseState=a,t.baseQueue=s,n.lastRenderedState=r}return[t.memoizedState,n.dispatch]}function uo(e){var t=oo(),n=t.queue;if(null===n)throw Error(o(311));n.lastRenderedReducer=e;var r=n.dispatch,i=n.pending,a=t.memoizedState;if(null!==i){n.pending=null;var l=i=i.next;do{a=e(a,l.action),l=l.next}while(l!==i);sr(a,t.memoizedState)||(Io=!0),t.memoizedState=a,null===t.baseQueue&&(t.baseState=a),n.lastRenderedState=a}return[a,r]}function co(e,t,n){var r=t._getVersion;r=r(t._source);var i=t._workInProgressVersionPrimary;if(null!==i?e=i===r:(e=e.mutableReadLanes,(e=(Ka&e)===e)&&(t._workInProgressVersionPrimary=r,$a.push(t))),e)return n(t._source);throw $a.push(t),Error(o(350))}function fo(e,t,n,r){var i=Dl;if(null===i)throw Error(o(349));var a=t._getVersion,l=a(t._source),s=qa.current,u=s.useState((function(){return co(i,t,n)})),c=u[1],d=u[0];u=Ja;var f=e.memoizedState,h=f.refs,p=h.getSnapshot,g=f.source;f=f.subscribe;var m=Qa;return e.memoizedState={refs:h,source:t,subscribe:r},s.useEffect((function(){h.getSnapshot=n,h.setSnapshot=c;var e=a(t._source);if(!sr(l,e)){e=n(t._source),sr(d,e)||(c(e),e=ds(m),i.mutableReadLanes|=e&i.pendingLanes),e=i.mutableReadLanes,i.entangledLanes|=e;for(var r=i.entanglements,o=e;0<o;){var s=31-Bt(o),u=1<<s;r[s]|=e,o&=~u}}}),[n,t,r]),s.useEffect((function(){return r(t._source,(function(){var e=h.getSnapshot,n=h.setSnapshot;try{n(e(t._source));var r=ds(m);i.mutableReadLanes|=r&i.pendingLanes}catch(a){n((function(){throw a}))}}))}),[t,r]),sr(p,n)&&sr(g,t)&&sr(f,r)||((e={pending:null,dispatch:null,lastRenderedReducer:lo,lastRenderedState:d}).dispatch=c=Po.bind(null,Qa,e),u.queue=e,u.baseQueue=null,d=co(i,t,n),u.memoizedState=u.baseState=d),d}function ho(e,t,n){return fo(oo(),e,t,n)}function po(e){var t=ao();return"function"===typeof e&&(e=e()),t.memoizedState=t.baseState=e,e=(e=t.queue={pending:null,dispatch:null,lastRenderedReducer:lo,lastRenderedState:e}).dispatch=Po.bind(null,Qa,e),[t.memoizedState,e]}function go(e,t,n,r){return e={tag:e,create:t,destroy:n,deps:r,next:null},null===(t=Qa.updateQueue)?(t={lastEffect:null},Qa.updateQueue=t,t.lastEffect=e.next=e):null===(n=t.lastEffect)?t.lastEffect=e.next=e:(r=n.next,n.next=e,e.next=r,t.lastEffect=e),e}function mo(e){return e={current:e},ao().memoizedState=e}function vo(){return oo().memoizedState}function yo(e,t,n,r){var i=ao();Qa.flags|=e,i.memoizedState=go(1|t,n,void 0,void 0===r?null:r)}function bo(e,t,n,r){var i=oo();r=void 0===r?null:r;var a=void 0;if(null!==Za){var o=Za.memoizedState;if(a=o.destroy,null!==r&&ro(r,o.deps))return void go(t,n,a,r)}Qa.flags|=e,i.memoizedState=go(1|t,n,a,r)}function xo(e,t){return yo(516,4,e,t)}function wo(e,t){return bo(516,4,e,t)}function _o(e,t){return bo(4,2,e,t)}function ko(e,t){return"function"===typeof t?(e=e(),t(e),function(){t(null)}):null!==t&&void 0!==t?(e=e(),t.current=e,function(){t.current=null}):void 0}function So(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,bo(4,2,ko.bind(null,t,e),n)}function Mo(){}function Co(e,t){var n=oo();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ro(t,r[1])?r[0]:(n.memoizedState=[e,t],e)}function Eo(e,t){var n=oo();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ro(t,r[1])?r[0]:(e=e(),n.memoizedState=[e,t],e)}function Oo(e,t){var n=Hi();Vi(98>n?98:n,(function(){e(!0)})),Vi(97<n?97:n,(function(){var n=Ga.transition;Ga.transition=1;try{e(!1),t()}finally{Ga.transition=n}}))}function Po(e,t,n){var r=cs(),i=ds(e),a={lane:i,action:n,eagerReducer:null,eagerState:null,next:null},o=t.pending;if(null===o?a.next=a:(a.next=o.next,o.next=a),t.pending=a,o=e.alternate,e===Qa||null!==o&&o===Qa)to=eo=!0;else{if(0===e.lanes&&(null===o||0===o.lanes)&&null!==(o=t.lastRenderedReducer))try{var l=t.lastRenderedState,s=o(l,n);if(a.eagerReducer=o,a.eagerState=s,sr(s,l))return}catch(u){}fs(e,i,r)}}var To={readContext:ia,useCallback:no,useContext:no,useEffect:no,useImperativeHandle:no,useLayoutEffect:no,useMemo:no,useReducer:no,useRef:no,useState:no,useDebugValue:no,useDeferredValue:no,useTransition:no,useMutableSource:no,useOpaqueIdentifier:no,unstable_isNewReconciler:!1},Do={readContext:ia,useCallback:function(e,t){return ao().memoizedState=[e,void 0===t?null:t],e},useContext:ia,useEffect:xo,useImperativeHandle:function(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,yo(4,2,ko.bind(null,t,e),n)},useLayoutEffect:function(e,t){return yo(4,2,e,t)},useMemo:function(e,t){var n=ao();return t=void 0===t?null:t,e=e(),n.memoizedState=[e,t],e},useReducer:function(e,t,n){var r=ao();return t=void 0!==n?n(t):t,r.memoizedState=r.baseState=t,e=(e=r.queue={pending:null,dispatch:null,lastRenderedReducer:e,lastRenderedState:t}).dispatch=Po.bind(null,Qa,e),[r.memoizedState,e]},useRef:mo,useState:po,useDebugValue:Mo,useDeferredValue:function(e){var t=po(e),n=t[0],r=t[1];return xo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=po(!1),t=e[0];return mo(e=Oo.bind(null,e[1])),[e,t]},useMutableSource:function(e,t,n){var r=ao();return r.memoizedState={refs:{getSnapshot:t,setSnapshot:null},source:e,subscribe:n},fo(r,e,t,n)},useOpaqueIdentifier:function(){if(za){var e=!1,t=function(e){return{$$typeof:L,toString:e,valueOf:e}}((function(){throw e||(e=!0,n("r:"+(qr++).toString(36))),Error(o(355))})),n=po(t)[1];return 0===(2&Qa.mode)&&(Qa.flags|=516,go(5,(function(){n("r:"+(qr++).toString(36))}),void 0,null)),t}return po(t="r:"+(qr++).toString(36)),t},unstable_isNewReconciler:!1},No={readContext:ia,useCallback:Co,useContext:ia,useEffect:wo,useImperativeHandle:So,useLayoutEffect:_o,useMemo:Eo,useReducer:so,useRef:vo,useState:function(){return so(lo)},useDebugValue:Mo,useDeferredValue:function(e){var t=so(lo),n=t[0],r=t[1];return wo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=so(lo)[0];return[vo().current,e]},useMutableSource:ho,useOpaqueIdentifier:function(){return so(lo)[0]},unstable_isNewReconciler:!1},Ro={readContext:ia,useCallback:Co,useContext:ia,useEffect:wo,useImperativeHandle:So,useLayoutEffect:_o,useMemo:Eo,useReducer:uo,useRef:vo,useState:function(){return uo(lo)},useDebugValue:Mo,useDeferredValue:function(e){var t=uo(lo),n=t[0],r=t[1];return wo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=uo(lo)[0];return[vo().current,e]},useMutableSource:ho,useOpaqueIdentifier:function(){return uo(lo)[0]},unstable_isNewReconciler:!1},Ao=_.ReactCurrentOwner,Io=!1;function Lo(e,t,n,r){t.child=null===e?Ma(t,null,n,r):Sa(t,e.child,n,r)}function jo(e,t,n,r,i){n=n.render;var a=t.ref;return ra(t,i),r=io(e,t,n,r,a,i),null===e||Io?(t.flags|=1,Lo(e,t,r,i),t.child):(t.updateQueue=e.updateQueue,t.flags&=-517,e.lanes&=~i,rl(e,t,i))}function Fo(e,t,n,r,i,a){if(null===e){var o=n.type;return"function"!==typeof o||Us(o)||void 0!==o.defaultProps||null!==n.compare||void 0!==n.defaultProps?((e=Bs(n.type,null,r,t,t.mode,a)).ref=t.ref,e.return=t,t.child=e):(t.tag=15,t.type=o,zo(e,t,o,r,i,a))}return o=e.child,0===(i&a)&&(i=o.memoizedProps,(n=null!==(n=n.compare)?n:cr)(i,r)&&e.ref===t.ref)?rl(e,t,a):(t.flags|=1,(e=Vs(o,r)).ref=t.ref,e.return=t,t.child=e)}function zo(e,t,n,r,i,a){if(null!==e&&cr(e.memoizedProps,r)&&e.ref===t.ref){if(Io=!1,0===(a&i))return t.lanes=e.lanes,rl(e,t,a);0!==(16384&e.flags)&&(Io=!0)}return Ho(e,t,n,r,a)}function Wo(e,t,n){var r=t.pendingProps,i=r.children,a=null!==e?e.memoizedState:null;if("hidden"===r.mode||"unstable-defer-without-hiding"===r.mode)if(0===(4&t.mode))t.memoizedState={baseLanes:0},xs(t,n);else{if(0===(1073741824&n))return e=null!==a?a.baseLanes|n:n,t.lanes=t.childLanes=1073741824,t.memoizedState={baseLanes:e},xs(t,e),null;t.memoizedState={baseLanes:0},xs(t,null!==a?a.baseLanes:n)}else null!==a?(r=a.baseLanes|n,t.memoizedState=null):r=n,xs(t,r);return Lo(e,t,i,n),t.child}function Yo(e,t){var n=t.ref;(null===e&&null!==n||null!==e&&e.ref!==n)&&(t.flags|=128)}function Ho(e,t,n,r,i){var a=gi(n)?hi:di.current;return a=pi(t,a),ra(t,i),n=io(e,t,n,r,a,i),null===e||Io?(t.flags|=1,Lo(e,t,n,i),t.child):(t.updateQueue=e.updateQueue,t.flags&=-517,e.lanes&=~i,rl(e,t,i))}function Uo(e,t,n,r,i){if(gi(n)){var a=!0;bi(t)}else a=!1;if(ra(t,i),null===t.stateNode)null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),va(t,n,r),ba(t,n,r,i),r=!0;else if(null===e){var o=t.stateNode,l=t.memoizedProps;o.props=l;var s=o.context,u=n.contextType;"object"===typeof u&&null!==u?u=ia(u):u=pi(t,u=gi(n)?hi:di.current);var c=n.getDerivedStateFromProps,d="function"===typeof c||"function"===typeof o.getSnapshotBeforeUpdate;d||"function"!==typeof o.UNSAFE_componentWillReceiveProps&&"function"!==typeof o.componentWillReceiveProps||(l!==r||s!==u)&&ya(t,o,r,u),aa=!1;var f=t.memoizedState;o.state=f,da(t,r,o,i),s=t.memoizedState,l!==r||f!==s||fi.current||aa?("function"===typeof c&&(pa(t,n,c,r),s=t.memoizedState),(l=aa||ma(t,n,l,r,f,s,u))?(d||"function"!==typeof o.UNSAFE_componentWillMount&&"function"!==typeof o.componentWillMount||("function"===typeof o.componentWillMount&&o.componentWillMount(),"function"===typeof o.UNSAFE_componentWillMount&&o.UNSAFE_componentWillMount()),"function"===typeof o.componentDidMount&&(t.flags|=4)):("function"===typeof o.componentDidMount&&(t.flags|=4),t.memoizedProps=r,t.memoizedState=s),o.props=r,o.state=s,o.context=u,r=l):("function"===typeof o.componentDidMount&&(t.flags|=4),r=!1)}else{o=t.stateNode,la(e,t),l=t.memoizedProps,u=t.type===t.elementType?l:Gi(t.type,l),o.props=u,d=t.pendingProps,f=o.context,"object"===typeof(s=n.contextType)&&null!==s?s=ia(s):s=pi(t,s=gi(n)?hi:di.current);var h=n.getDerivedStateFromProps;(c="function"===typeof h||"function"===typeof o.getSnapshotBeforeUpdate)||"function"!==typeof o.UNSAFE_componentWillReceiveProps&&"function"!==typeof o.componentWillReceiveProps||(l!==d||f!==s)&&ya(t,o,r,s),aa=!1,f=t.memoizedState,o.state=f,da(t,r,o,i);var p=t.memoizedState;l!==d||f!==p||fi.current||aa?("function"===typeof h&&(pa(t,n,h,r),p=t.memoizedState),(u=aa||ma(t,n,u,r,f,p,s))?(c||"function"!==typeof o.UNSAFE_componentWillUpdate&&"function"!==typeof o.componentWillUpdate||("function"===typeof o.componentWillUpdate&&o.componentWillUpdate(r,p,s),"function"===typeof o.UNSAFE_componentWillUpdate&&o.UNSAFE_componentWillUpdate(r,p,s)),"function"===typeof o.componentDidUpdate&&(t.flags|=4),"function"===typeof o.getSnapshotBeforeUpdate&&(t.flags|=256)):("function"!==typeof o.componentDidUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=4),"function"!==typeof o.getSnapshotBeforeUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=256),t.memoizedProps=r,t.memoizedState=p),o.props=r,o.state=p,o.context=s,r=u):("function"!==typeof o.componentDidUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=4),"function"!==typeof o.getSnapshotBeforeUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=256),r=!1)}return Vo(e,t,n,r,a,i)}function Vo(e,t,n,r,i,a){Yo(e,t);var o=0!==(64&t.flags);if(!r&&!o)return i&&xi(t,n,!1),rl(e,t,a);r=t.stateNode,Ao.current=t;var l=o&&"function"!==typeof n.getDerivedStateFromError?null:r.render();return t.flags|=1,null!==e&&o?(t.child=Sa(t,e.child,null,a),t.child=Sa(t,null,l,a)):Lo(e,t,l,a),t.memoizedState=r.state,i&&xi(t,n,!0),t.child}function Bo(e){var t=e.stateNode;t.pendingContext?vi(0,t.pendingContext,t.pendingContext!==t.context):t.context&&vi(0,t.context,!1),Da(e,t.containerInfo)}var $o,Xo,qo,Go={dehydrated:null,retryLane:0};function Ko(e,t,n){var r,i=t.pendingProps,a=Ia.current,o=!1;return(r=0!==(64&t.flags))||(r=(null===e||null!==e.memoizedState)&&0!==(2&a)),r?(o=!0,t.flags&=-65):null!==e&&null===e.memoizedState||void 0===i.fallback||!0===i.unstable_avoidThisFallback||(a|=1),ui(Ia,1&a),null===e?(void 0!==i.fallback&&Ha(t),e=i.children,a=i.fallback,o?(e=Qo(t,e,a,n),t.child.memoizedState={baseLanes:n},t.memoizedState=Go,e):"number"===typeof i.unstable_expectedLoadTime?(e=Qo(t,e,a,n),t.child.memoizedState={baseLanes:n},t.memoizedState=Go,t.lanes=33554432,e):((n=Xs({mode:"visible",children:e},t.mode,n,null)).return=t,t.child=n)):(e.memoizedState,o?(i=Jo(e,t,i.children,i.fallback,n),o=t.child,a=e.child.memoizedState,o.memoizedState=null===a?{baseLanes:n}:{baseLanes:a.baseLanes|n},o.childLanes=e.childLanes&~n,t.memoizedState=Go,i):(n=Zo(e,t,i.children,n),t.memoizedState=null,n))}function Qo(e,t,n,r){var i=e.mode,a=e.child;return t={mode:"hidden",children:t},0===(2&i)&&null!==a?(a.childLanes=0,a.pendingProps=t):a=Xs(t,i,0,null),n=$s(n,i,r,null),a.return=e,n.return=e,a.sibling=n,e.child=a,n}function Zo(e,t,n,r){var i=e.child;return e=i.sibling,n=Vs(i,{mode:"visible",children:n}),0===(2&t.mode)&&(n.lanes=r),n.return=t,n.sibling=null,null!==e&&(e.nextEffect=null,e.flags=8,t.firstEffect=t.lastEffect=e),t.child=n}function Jo(e,t,n,r,i){var a=t.mode,o=e.child;e=o.sibling;var l={mode:"hidden",children:n};return 0===(2&a)&&t.child!==o?((n=t.child).childLanes=0,n.pendingProps=l,null!==(o=n.lastEffect)?(t.firstEffect=n.firstEffect,t.lastEffect=o,o.nextEffect=null):t.firstEffect=t.lastEffect=null):n=Vs(o,l),null!==e?r=Vs(e,r):(r=$s(r,a,i,null)).flags|=2,r.return=t,n.return=t,n.sibling=r,t.child=n,r}function el(e,t){e.lanes|=t;var n=e.alternate;null!==n&&(n.lanes|=t),na(e.return,t)}function tl(e,t,n,r,i,a){var o=e.memoizedState;null===o?e.memoizedState={isBackwards:t,rendering:null,renderingStartTime:0,last:r,tail:n,tailMode:i,lastEffect:a}:(o.isBackwards=t,o.rendering=null,o.renderingStartTime=0,o.last=r,o.tail=n,o.tailMode=i,o.lastEffect=a)}function nl(e,t,n){var r=t.pendingProps,i=r.revealOrder,a=r.tail;if(Lo(e,t,r.children,n),0!==(2&(r=Ia.current)))r=1&r|2,t.flags|=64;else{if(null!==e&&0!==(64&e.flags))e:for(e=t.child;null!==e;){if(13===e.tag)null!==e.memoizedState&&el(e,n);else if(19===e.tag)el(e,n);else if(null!==e.child){e.child.return=e,e=e.child;continue}if(e===t)break e;for(;null===e.sibling;){if(null===e.return||e.return===t)break e;e=e.return}e.sibling.return=e.return,e=e.sibling}r&=1}if(ui(Ia,r),0===(2&t.mode))t.memoizedState=null;else switch(i){case"forwards":for(n=t.child,i=null;null!==n;)null!==(e=n.alternate)&&null===La(e)&&(i=n),n=n.sibling;null===(n=i)?(i=t.child,t.child=null):(i=n.sibling,n.sibling=null),tl(t,!1,i,n,a,t.lastEffect);break;case"backwards":for(n=null,i=t.child,t.child=null;null!==i;){if(null!==(e=i.alternate)&&null===La(e)){t.child=i;break}e=i.sibling,i.sibling=n,n=i,i=e}tl(t,!0,n,null,a,t.lastEffect);break;case"together":tl(t,!1,null,null,void 0,t.lastEffect);break;default:t.memoizedState=null}return t.child}function rl(e,t,n){if(null!==e&&(t.dependencies=e.dependencies),zl|=t.lanes,0!==(n&t.childLanes)){if(null!==e&&t.child!==e.child)throw Error(o(153));if(null!==t.child){for(n=Vs(e=t.child,e.pendingProps),t.child=n,n.return=t;null!==e.sibling;)e=e.sibling,(n=n.sibling=Vs(e,e.pendingProps)).return=t;n.sibling=null}return t.child}return null}function il(e,t){if(!za)switch(e.tailMode){case"hidden":t=e.tail;for(var n=null;null!==t;)null!==t.alternate&&(n=t),t=t.sibling;null===n?e.tail=null:n.sibling=null;break;case"collapsed":n=e.tail;for(var r=null;null!==n;)null!==n.alternate&&(r=n),n=n.sibling;null===r?t||null===e.tail?e.tail=null:e.tail.sibling=null:r.sibling=null}}function al(e,t,n){var r=t.pendingProps;switch(t.tag){case 2:case 16:case 15:case 0:case 11:case 7:case 8:case 12:case 9:case 14:return null;case 1:return gi(t.type)&&mi(),null;case 3:return Na(),si(fi),si(di),Xa(),(r=t.stateNode).pendingContext&&(r.context=r.pendingContext,r.pendingContext=null),null!==e&&null!==e.child||(Va(t)?t.flags|=4:r.hydrate||(t.flags|=256)),null;case 5:Aa(t);var a=Ta(Pa.current);if(n=t.type,null!==e&&null!=t.stateNode)Xo(e,t,n,r),e.ref!==t.ref&&(t.flags|=128);else{if(!r){if(null===t.stateNode)throw Error(o(166));return null}if(e=Ta(Ea.current),Va(t)){r=t.stateNode,n=t.type;var l=t.memoizedProps;switch(r[Kr]=t,r[Qr]=l,n){case"dialog":Or("cancel",r),Or("close",r);break;case"iframe":case"object":case"embed":Or("load",r);break;case"video":case"audio":for(e=0;e<Sr.length;e++)Or(Sr[e],r);break;case"source":Or("error",r);break;case"img":case"image":case"link":Or("error",r),Or("load",r);break;case"details":Or("toggle",r);break;case"input":te(r,l),Or("invalid",r);break;case"select":r._wrapperState={wasMultiple:!!l.multiple},Or("invalid",r);break;case"textarea":ue(r,l),Or("invalid",r)}for(var u in Me(n,l),e=null,l)l.hasOwnProperty(u)&&(a=l[u],"children"===u?"string"===typeof a?r.textContent!==a&&(e=["children",a]):"number"===typeof a&&r.textContent!==""+a&&(e=["children",""+a]):s.hasOwnProperty(u)&&null!=a&&"onScroll"===u&&Or("scroll",r));switch(n){case"input":Q(r),ie(r,l,!0);break;case"textarea":Q(r),de(r);break;case"select":case"option":break;default:"function"===typeof l.onClick&&(r.onclick=Fr)}r=e,t.updateQueue=r,null!==r&&(t.flags|=4)}else{switch(u=9===a.nodeType?a:a.ownerDocument,e===fe&&(e=pe(n)),e===fe?"script"===n?((e=u.createElement("div")).innerHTML="<script><\/script>",e=e.removeChild(e.firstChild)):"string"===typeof r.is?e=u.createElement(n,{is:r.is}):(e=u.createElement(n),"select"===n&&(u=e,r.multiple?u.multiple=!0:r.size&&(u.size=r.size))):e=u.createElementNS(e,n),e[Kr]=t,e[Qr]=r,$o(e,t),t.stateNode=e,u=Ce(n,r),n){case"dialog":Or("cancel",e),Or("close",e),a=r;break;case"iframe":case"object":case"embed":Or("load",e),a=r;break;case"video":case"audio":for(a=0;a<Sr.length;a++)Or(Sr[a],e);a=r;break;case"source":Or("error",e),a=r;break;case"img":case"image":case"link":Or("error",e),Or("load",e),a=r;break;case"details":Or("toggle",e),a=r;break;case"input":te(e,r),a=ee(e,r),Or("invalid",e);break;case"option":a=oe(e,r);break;case"select":e._wrapperState={wasMultiple:!!r.multiple},a=i({},r,{value:void 0}),Or("invalid",e);break;case"textarea":ue(e,r),a=se(e,r),Or("invalid",e);break;default:a=r}Me(n,a);var c=a;for(l in c)if(c.hasOwnProperty(l)){var d=c[l];"style"===l?ke(e,d):"dangerouslySetInnerHTML"===l?null!=(d=d?d.__html:void 0)&&ye(e,d):"children"===l?"string"===typeof d?("textarea"!==n||""!==d)&&be(e,d):"number"===typeof d&&be(e,""+d):"suppressContentEditableWarning"!==l&&"suppressHydrationWarning"!==l&&"autoFocus"!==l&&(s.hasOwnProperty(l)?null!=d&&"onScroll"===l&&Or("scroll",e):null!=d&&w(e,l,d,u))}switch(n){case"input":Q(e),ie(e,r,!1);break;case"textarea":Q(e),de(e);break;case"option":null!=r.value&&e.setAttribute("value",""+G(r.value));break;case"select":e.multiple=!!r.multiple,null!=(l=r.value)?le(e,!!r.multiple,l,!1):null!=r.defaultValue&&le(e,!!r.multiple,r.defaultValue,!0);break;default:"function"===typeof a.onClick&&(e.onclick=Fr)}Yr(n,r)&&(t.flags|=4)}null!==t.ref&&(t.flags|=128)}return null;case 6:if(e&&null!=t.stateNode)qo(0,t,e.memoizedProps,r);else{if("string"!==typeof r&&null===t.stateNode)throw Error(o(166));n=Ta(Pa.current),Ta(Ea.current),Va(t)?(r=t.stateNode,n=t.memoizedProps,r[Kr]=t,r.nodeValue!==n&&(t.flags|=4)):((r=(9===n.nodeType?n:n.ownerDocument).createTextNode(r))[Kr]=t,t.stateNode=r)}return null;case 13:return si(Ia),r=t.memoizedState,0!==(64&t.flags)?(t.lanes=n,t):(r=null!==r,n=!1,null===e?void 0!==t.memoizedProps.fallback&&Va(t):n=null!==e.memoizedState,r&&!n&&0!==(2&t.mode)&&(null===e&&!0!==t.memoizedProps.unstable_avoidThisFallback||0!==(1&Ia.current)?0===Ll&&(Ll=3):(0!==Ll&&3!==Ll||(Ll=4),null===Dl||0===(134217727&zl)&&0===(134217727&Wl)||ms(Dl,Rl))),(r||n)&&(t.flags|=4),null);case 4:return Na(),null===e&&Tr(t.stateNode.containerInfo),null;case 10:return ta(t),null;case 17:return gi(t.type)&&mi(),null;case 19:if(si(Ia),null===(r=t.memoizedState))return null;if(l=0!==(64&t.flags),null===(u=r.rendering))if(l)il(r,!1);else{if(0!==Ll||null!==e&&0!==(64&e.flags))for(e=t.child;null!==e;){if(null!==(u=La(e))){for(t.flags|=64,il(r,!1),null!==(l=u.updateQueue)&&(t.updateQueue=l,t.flags|=4),null===r.lastEffect&&(t.firstEffect=null),t.lastEffect=r.lastEffect,r=n,n=t.child;null!==n;)e=r,(l=n).flags&=2,l.nextEffect=null,l.firstEffect=null,l.lastEffect=null,null===(u=l.alternate)?(l.childLanes=0,l.lanes=e,l.child=null,l.memoizedProps=null,l.memoizedState=null,l.updateQueue=null,l.dependencies=null,l.stateNode=null):(l.childLanes=u.childLanes,l.lanes=u.lanes,l.child=u.child,l.memoizedProps=u.memoizedProps,l.memoizedState=u.memoizedState,l.updateQueue=u.updateQueue,l.type=u.type,e=u.dependencies,l.dependencies=null===e?null:{lanes:e.lanes,firstContext:e.firstContext}),n=n.sibling;return ui(Ia,1&Ia.current|2),t.child}e=e.sibling}null!==r.tail&&Yi()>Vl&&(t.flags|=64,l=!0,il(r,!1),t.lanes=33554432)}else{if(!l)if(null!==(e=La(u))){if(t.flags|=64,l=!0,null!==(n=e.updateQueue)&&(t.updateQueue=n,t.flags|=4),il(r,!0),null===r.tail&&"hidden"===r.tailMode&&!u.alternate&&!za)return null!==(t=t.lastEffect=r.lastEffect)&&(t.nextEffect=null),null}else 2*Yi()-r.renderingStartTime>Vl&&1073741824!==n&&(t.flags|=64,l=!0,il(r,!1),t.lanes=33554432);r.isBackwards?(u.sibling=t.child,t.child=u):(null!==(n=r.last)?n.sibling=u:t.child=u,r.last=u)}return null!==r.tail?(n=r.tail,r.rendering=n,r.tail=n.sibling,r.lastEffect=t.lastEffect,r.renderingStartTime=Yi(),n.sibling=null,t=Ia.current,ui(Ia,l?1&t|2:1&t),n):null;case 23:case 24:return ws(),null!==e&&null!==e.memoizedState!==(null!==t.memoizedState)&&"unstable-defer-without-hiding"!==r.mode&&(t.flags|=4),null}throw Error(o(156,t.tag))}function ol(e){switch(e.tag){case 1:gi(e.type)&&mi();var t=e.flags;return 4096&t?(e.flags=-4097&t|64,e):null;case 3:if(Na(),si(fi),si(di),Xa(),0!==(64&(t=e.flags)))throw Error(o(285));return e.flags=-4097&t|64,e;case 5:return Aa(e),null;case 13:return si(Ia),4096&(t=e.flags)?(e.flags=-4097&t|64,e):null;case 19:return si(Ia),null;case 4:return Na(),null;case 10:return ta(e),null;case 23:case 24:return ws(),null;default:return null}}function ll(e,t){try{var n="",r=t;do{n+=X(r),r=r.return}while(r);var i=n}catch(a){i="\nError generating stack: "+a.message+"\n"+a.stack}return{value:e,source:t,stack:i}}function sl(e,t){try{console.error(t.value)}catch(n){setTimeout((function(){throw n}))}}$o=function(e,t){for(var n=t.child;null!==n;){if(5===n.tag||6===n.tag)e.appendChild(n.stateNode);else if(4!==n.tag&&null!==n.child){n.child.return=n,n=n.child;continue}if(n===t)break;for(;null===n.sibling;){if(null===n.return||n.return===t)return;n=n.return}n.sibling.return=n.return,n=n.sibling}},Xo=function(e,t,n,r){var a=e.memoizedProps;if(a!==r){e=t.stateNode,Ta(Ea.current);var o,l=null;switch(n){case"input":a=ee(e,a),r=ee(e,r),l=[];break;case"option":a=oe(e,a),r=oe(e,r),l=[];break;case"select":a=i({},a,{value:void 0}),r=i({},r,{value:void 0}),l=[];break;case"textarea":a=se(e,a),r=se(e,r),l=[];break;default:"function"!==typeof a.onClick&&"function"===typeof r.onClick&&(e.onclick=Fr)}for(d in Me(n,r),n=null,a)if(!r.hasOwnProperty(d)&&a.hasOwnProperty(d)&&null!=a[d])if("style"===d){var u=a[d];for(o in u)u.hasOwnProperty(o)&&(n||(n={}),n[o]="")}else"dangerouslySetInnerHTML"!==d&&"children"!==d&&"suppressContentEditableWarning"!==d&&"suppressHydrationWarning"!==d&&"autoFocus"!==d&&(s.hasOwnProperty(d)?l||(l=[]):(l=l||[]).push(d,null));for(d in r){var c=r[d];if(u=null!=a?a[d]:void 0,r.hasOwnProperty(d)&&c!==u&&(null!=c||null!=u))if("style"===d)if(u){for(o in u)!u.hasOwnProperty(o)||c&&c.hasOwnProperty(o)||(n||(n={}),n[o]="");for(o in c)c.hasOwnProperty(o)&&u[o]!==c[o]&&(n||(n={}),n[o]=c[o])}else n||(l||(l=[]),l.push(d,n)),n=c;else"dangerouslySetInnerHTML"===d?(c=c?c.__html:void 0,u=u?u.__html:void 0,null!=c&&u!==c&&(l=l||[]).push(d,c)):"children"===d?"string"!==typeof c&&"number"!==typeof c||(l=l||[]).push(d,""+c):"suppressContentEditableWarning"!==d&&"suppressHydrationWarning"!==d&&(s.hasOwnProperty(d)?(null!=c&&"onScroll"===d&&Or("scroll",e),l||u===c||(l=[])):"object"===typeof c&&null!==c&&c.$$typeof===L?c.toString():(l=l||[]).push(d,c))}n&&(l=l||[]).push("style",n);var d=l;(t.updateQueue=d)&&(t.flags|=4)}},qo=function(e,t,n,r){n!==r&&(t.flags|=4)};var ul="function"===typeof WeakMap?WeakMap:Map;function cl(e,t,n){(n=sa(-1,n)).tag=3,n.payload={element:null};var r=t.value;return n.callback=function(){ql||(ql=!0,Gl=r),sl(0,t)},n}function dl(e,t,n){(n=sa(-1,n)).tag=3;var r=e.type.getDerivedStateFromError;if("function"===typeof r){var i=t.value;n.payload=function(){return sl(0,t),r(i)}}var a=e.stateNode;return null!==a&&"function"===typeof a.componentDidCatch&&(n.callback=function(){"function"!==typeof r&&(null===Kl?Kl=new Set([this]):Kl.add(this),sl(0,t));var e=t.stack;this.componentDidCatch(t.value,{componentStack:null!==e?e:""})}),n}var fl="function"===typeof WeakSet?WeakSet:Set;function hl(e){var t=e.ref;if(null!==t)if("function"===typeof t)try{t(null)}catch(n){Fs(e,n)}else t.current=null}function pl(e,t){switch(t.tag){case 0:case 11:case 15:case 22:return;case 1:if(256&t.flags&&null!==e){var n=e.memoizedProps,r=e.memoizedState;t=(e=t.stateNode).getSnapshotBeforeUpdate(t.elementType===t.type?n:Gi(t.type,n),r),e.__reactInternalSnapshotBeforeUpdate=t}return;case 3:return void(256&t.flags&&Br(t.stateNode.containerInfo));case 5:case 6:case 4:case 17:return}throw Error(o(163))}function gl(e,t,n){switch(n.tag){case 0:case 11:case 15:case 22:if(null!==(t=null!==(t=n.updateQueue)?t.lastEffect:null)){e=t=t.next;do{if(3===(3&e.tag)){var r=e.create;e.destroy=r()}e=e.next}while(e!==t)}if(null!==(t=null!==(t=n.updateQueue)?t.lastEffect:null)){e=t=t.next;do{var i=e;r=i.next,0!==(4&(i=i.tag))&&0!==(1&i)&&(Is(n,e),As(n,e)),e=r}while(e!==t)}return;case 1:return e=n.stateNode,4&n.flags&&(null===t?e.componentDidMount():(r=n.elementType===n.type?t.memoizedProps:Gi(n.type,t.memoizedProps),e.componentDidUpdate(r,t.memoizedState,e.__reactInternalSnapshotBeforeUpdate))),void(null!==(t=n.updateQueue)&&fa(n,t,e));case 3:if(null!==(t=n.updateQueue)){if(e=null,null!==n.child)switch(n.child.tag){case 5:e=n.child.stateNode;break;case 1:e=n.child.stateNode}fa(n,t,e)}return;case 5:return e=n.stateNode,void(null===t&&4&n.flags&&Yr(n.type,n.memoizedProps)&&e.focus());case 6:case 4:case 12:return;case 13:return void(null===n.memoizedState&&(n=n.alternate,null!==n&&(n=n.memoizedState,null!==n&&(n=n.dehydrated,null!==n&&kt(n)))));case 19:case 17:case 20:case 21:case 23:case 24:return}throw Error(o(163))}function ml(e,t){for(var n=e;;){if(5===n.tag){var r=n.stateNode;if(t)"function"===typeof(r=r.style).setProperty?r.setProperty("display","none","important"):r.display="none";else{r=n.stateNode;var i=n.memoizedProps.style;i=void 0!==i&&null!==i&&i.hasOwnProperty("display")?i.display:null,r.style.display=_e("display",i)}}else if(6===n.tag)n.stateNode.nodeValue=t?"":n.memoizedProps;else if((23!==n.tag&&24!==n.tag||null===n.memoizedState||n===e)&&null!==n.child){n.child.return=n,n=n.child;continue}if(n===e)break;for(;null===n.sibling;){if(null===n.return||n.return===e)return;n=n.return}n.sibling.return=n.return,n=n.sibling}}function vl(e,t){if(_i&&"function"===typeof _i.onCommitFiberUnmount)try{_i.onCommitFiberUnmount(wi,t)}catch(a){}switch(t.tag){case 0:case 11:case 14:case 15:case 22:if(null!==(e=t.updateQueue)&&null!==(e=e.lastEffect)){var n=e=e.next;do{var r=n,i=r.destroy;if(r=r.tag,void 0!==i)if(0!==(4&r))Is(t,n);else{r=t;try{i()}catch(a){Fs(r,a)}}n=n.next}while(n!==e)}break;case 1:if(hl(t),"function"===typeof(e=t.stateNode).componentWillUnmount)try{e.props=t.memoizedProps,e.state=t.memoizedState,e.componentWillUnmount()}catch(a){Fs(t,a)}break;case 5:hl(t);break;case 4:kl(e,t)}}function yl(e){e.alternate=null,e.child=null,e.dependencies=null,e.firstEffect=null,e.lastEffect=null,e.memoizedProps=null,e.memoizedState=null,e.pendingProps=null,e.return=null,e.updateQueue=null}function bl(e){return 5===e.tag||3===e.tag||4===e.tag}function xl(e){e:{for(var t=e.return;null!==t;){if(bl(t))break e;t=t.return}throw Error(o(160))}var n=t;switch(t=n.stateNode,n.tag){case 5:var r=!1;break;case 3:case 4:t=t.containerInfo,r=!0;break;default:throw Error(o(161))}16&n.flags&&(be(t,""),n.flags&=-17);e:t:for(n=e;;){for(;null===n.sibling;){if(null===n.return||bl(n.return)){n=null;break e}n=n.return}for(n.sibling.return=n.return,n=n.sibling;5!==n.tag&&6!==n.tag&&18!==n.tag;){if(2&n.flags)continue t;if(null===n.child||4===n.tag)continue t;n.child.return=n,n=n.child}if(!(2&n.flags)){n=n.stateNode;break e}}r?wl(e,n,t):_l(e,n,t)}function wl(e,t,n){var r=e.tag,i=5===r||6===r;if(i)e=i?e.stateNode:e.stateNode.instance,t?8===n.nodeType?n.parentNode.insertBefore(e,t):n.insertBefore(e,t):(8===n.nodeType?(t=n.parentNode).insertBefore(e,n):(t=n).appendChild(e),null!==(n=n._reactRootContainer)&&void 0!==n||null!==t.onclick||(t.onclick=Fr));else if(4!==r&&null!==(e=e.child))for(wl(e,t,n),e=e.sibling;null!==e;)wl(e,t,n),e=e.sibling}function _l(e,t,n){var r=e.tag,i=5===r||6===r;if(i)e=i?e.stateNode:e.stateNode.instance,t?n.insertBefore(e,t):n.appendChild(e);else if(4!==r&&null!==(e=e.child))for(_l(e,t,n),e=e.sibling;null!==e;)_l(e,t,n),e=e.sibling}function kl(e,t){for(var n,r,i=t,a=!1;;){if(!a){a=i.return;e:for(;;){if(null===a)throw Error(o(160));switch(n=a.stateNode,a.tag){case 5:r=!1;break e;case 3:case 4:n=n.containerInfo,r=!0;break e}a=a.return}a=!0}if(5===i.tag||6===i.tag){e:for(var l=e,s=i,u=s;;)if(vl(l,u),null!==u.child&&4!==u.tag)u.child.return=u,u=u.child;else{if(u===s)break e;for(;null===u.sibling;){if(null===u.return||u.return===s)break e;u=u.return}u.sibling.return=u.return,u=u.sibling}r?(l=n,s=i.stateNode,8===l.nodeType?l.parentNode.removeChild(s):l.removeChild(s)):n.removeChild(i.stateNode)}else if(4===i.tag){if(null!==i.child){n=i.stateNode.containerInfo,r=!0,i.child.return=i,i=i.child;continue}}else if(vl(e,i),null!==i.child){i.child.return=i,i=i.child;continue}if(i===t)break;for(;null===i.sibling;){if(null===i.return||i.return===t)return;4===(i=i.return).tag&&(a=!1)}i.sibling.return=i.return,i=i.sibling}}function Sl(e,t){switch(t.tag){case 0:case 11:case 14:case 15:case 22:var n=t.updateQueue;if(null!==(n=null!==n?n.lastEffect:null)){var r=n=n.next;do{3===(3&r.tag)&&(e=r.destroy,r.destroy=void 0,void 0!==e&&e()),r=r.next}while(r!==n)}return;case 1:return;case 5:if(null!=(n=t.stateNode)){r=t.memoizedProps;var i=null!==e?e.memoizedProps:r;e=t.type;var a=t.updateQueue;if(t.updateQueue=null,null!==a){for(n[Qr]=r,"input"===e&&"radio"===r.type&&null!=r.name&&ne(n,r),Ce(e,i),t=Ce(e,r),i=0;i<a.length;i+=2){var l=a[i],s=a[i+1];"style"===l?ke(n,s):"dangerouslySetInnerHTML"===l?ye(n,s):"children"===l?be(n,s):w(n,l,s,t)}switch(e){case"input":re(n,r);break;case"textarea":ce(n,r);break;case"select":e=n._wrapperState.wasMultiple,n._wrapperState.wasMultiple=!!r.multiple,null!=(a=r.value)?le(n,!!r.multiple,a,!1):e!==!!r.multiple&&(null!=r.defaultValue?le(n,!!r.multiple,r.defaultValue,!0):le(n,!!r.multiple,r.multiple?[]:"",!1))}}}return;case 6:if(null===t.stateNode)throw Error(o(162));return void(t.stateNode.nodeValue=t.memoizedProps);case 3:return void((n=t.stateNode).hydrate&&(n.hydrate=!1,kt(n.containerInfo)));case 12:return;case 13:return null!==t.memoizedState&&(Ul=Yi(),ml(t.child,!0)),void Ml(t);case 19:return void Ml(t);case 17:return;case 23:case 24:return void ml(t,null!==t.memoizedState)}throw Error(o(163))}function Ml(e){var t=e.updateQueue;if(null!==t){e.updateQueue=null;var n=e.stateNode;null===n&&(n=e.stateNode=new fl),t.forEach((function(t){var r=Ws.bind(null,e,t);n.has(t)||(n.add(t),t.then(r,r))}))}}function Cl(e,t){return null!==e&&(null===(e=e.memoizedState)||null!==e.dehydrated)&&(null!==(t=t.memoizedState)&&null===t.dehydrated)}var El=Math.ceil,Ol=_.ReactCurrentDispatcher,Pl=_.ReactCurrentOwner,Tl=0,Dl=null,Nl=null,Rl=0,Al=0,Il=li(0),Ll=0,jl=null,Fl=0,zl=0,Wl=0,Yl=0,Hl=null,Ul=0,Vl=1/0;function Bl(){Vl=Yi()+500}var $l,Xl=null,ql=!1,Gl=null,Kl=null,Ql=!1,Zl=null,Jl=90,es=[],ts=[],ns=null,rs=0,is=null,as=-1,os=0,ls=0,ss=null,us=!1;function cs(){return 0!==(48&Tl)?Yi():-1!==as?as:as=Yi()}function ds(e){if(0===(2&(e=e.mode)))return 1;if(0===(4&e))return 99===Hi()?1:2;if(0===os&&(os=Fl),0!==qi.transition){0!==ls&&(ls=null!==Hl?Hl.pendingLanes:0),e=os;var t=4186112&~ls;return 0===(t&=-t)&&(0===(t=(e=4186112&~e)&-e)&&(t=8192)),t}return e=Hi(),0!==(4&Tl)&&98===e?e=Yt(12,os):e=Yt(e=function(e){switch(e){case 99:return 15;case 98:return 10;case 97:case 96:return 8;case 95:return 2;default:return 0}}(e),os),e}function fs(e,t,n){if(50<rs)throw rs=0,is=null,Error(o(185));if(null===(e=hs(e,t)))return null;Vt(e,t,n),e===Dl&&(Wl|=t,4===Ll&&ms(e,Rl));var r=Hi();1===t?0!==(8&Tl)&&0===(48&Tl)?vs(e):(ps(e,n),0===Tl&&(Bl(),$i())):(0===(4&Tl)||98!==r&&99!==r||(null===ns?ns=new Set([e]):ns.add(e)),ps(e,n)),Hl=e}function hs(e,t){e.lanes|=t;var n=e.alternate;for(null!==n&&(n.lanes|=t),n=e,e=e.return;null!==e;)e.childLanes|=t,null!==(n=e.alternate)&&(n.childLanes|=t),n=e,e=e.return;return 3===n.tag?n.stateNode:null}function ps(e,t){for(var n=e.callbackNode,r=e.suspendedLanes,i=e.pingedLanes,a=e.expirationTimes,l=e.pendingLanes;0<l;){var s=31-Bt(l),u=1<<s,c=a[s];if(-1===c){if(0===(u&r)||0!==(u&i)){c=t,Ft(u);var d=jt;a[s]=10<=d?c+250:6<=d?c+5e3:-1}}else c<=t&&(e.expiredLanes|=u);l&=~u}if(r=zt(e,e===Dl?Rl:0),t=jt,0===r)null!==n&&(n!==Ii&&Mi(n),e.callbackNode=null,e.callbackPriority=0);else{if(null!==n){if(e.callbackPriority===t)return;n!==Ii&&Mi(n)}15===t?(n=vs.bind(null,e),null===ji?(ji=[n],Fi=Si(Ti,Xi)):ji.push(n),n=Ii):14===t?n=Bi(99,vs.bind(null,e)):n=Bi(n=function(e){switch(e){case 15:case 14:return 99;case 13:case 12:case 11:case 10:return 98;case 9:case 8:case 7:case 6:case 4:case 5:return 97;case 3:case 2:case 1:return 95;case 0:return 90;default:throw Error(o(358,e))}}(t),gs.bind(null,e)),e.callbackPriority=t,e.callbackNode=n}}function gs(e){if(as=-1,ls=os=0,0!==(48&Tl))throw Error(o(327));var t=e.callbackNode;if(Rs()&&e.callbackNode!==t)return null;var n=zt(e,e===Dl?Rl:0);if(0===n)return null;var r=n,i=Tl;Tl|=16;var a=Ss();for(Dl===e&&Rl===r||(Bl(),_s(e,r));;)try{Es();break}catch(s){ks(e,s)}if(ea(),Ol.current=a,Tl=i,null!==Nl?r=0:(Dl=null,Rl=0,r=Ll),0!==(Fl&Wl))_s(e,0);else if(0!==r){if(2===r&&(Tl|=64,e.hydrate&&(e.hydrate=!1,Br(e.containerInfo)),0!==(n=Wt(e))&&(r=Ms(e,n))),1===r)throw t=jl,_s(e,0),ms(e,n),ps(e,Yi()),t;switch(e.finishedWork=e.current.alternate,e.finishedLanes=n,r){case 0:case 1:throw Error(o(345));case 2:Ts(e);break;case 3:if(ms(e,n),(62914560&n)===n&&10<(r=Ul+500-Yi())){if(0!==zt(e,0))break;if(((i=e.suspendedLanes)&n)!==n){cs(),e.pingedLanes|=e.suspendedLanes&i;break}e.timeoutHandle=Ur(Ts.bind(null,e),r);break}Ts(e);break;case 4:if(ms(e,n),(4186112&n)===n)break;for(r=e.eventTimes,i=-1;0<n;){var l=31-Bt(n);a=1<<l,(l=r[l])>i&&(i=l),n&=~a}if(n=i,10<(n=(120>(n=Yi()-n)?120:480>n?480:1080>n?1080:1920>n?1920:3e3>n?3e3:4320>n?4320:1960*El(n/1960))-n)){e.timeoutHandle=Ur(Ts.bind(null,e),n);break}Ts(e);break;case 5:Ts(e);break;default:throw Error(o(329))}}return ps(e,Yi()),e.callbackNode===t?gs.bind(null,e):null}function ms(e,t){for(t&=~Yl,t&=~Wl,e.suspendedLanes|=t,e.pingedLanes&=~t,e=e.expirationTimes;0<t;){var n=31-Bt(t),r=1<<n;e[n]=-1,t&=~r}}function vs(e){if(0!==(48&Tl))throw Error(o(327));if(Rs(),e===Dl&&0!==(e.expiredLanes&Rl)){var t=Rl,n=Ms(e,t);0!==(Fl&Wl)&&(n=Ms(e,t=zt(e,t)))}else n=Ms(e,t=zt(e,0));if(0!==e.tag&&2===n&&(Tl|=64,e.hydrate&&(e.hydrate=!1,Br(e.containerInfo)),0!==(t=Wt(e))&&(n=Ms(e,t))),1===n)throw n=jl,_s(e,0),ms(e,t),ps(e,Yi()),n;return e.finishedWork=e.current.alternate,e.finishedLanes=t,Ts(e),ps(e,Yi()),null}function ys(e,t){var n=Tl;Tl|=1;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}}function bs(e,t){var n=Tl;Tl&=-2,Tl|=8;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}}function xs(e,t){ui(Il,Al),Al|=t,Fl|=t}function ws(){Al=Il.current,si(Il)}function _s(e,t){e.finishedWork=null,e.finishedLanes=0;var n=e.timeoutHandle;if(-1!==n&&(e.timeoutHandle=-1,Vr(n)),null!==Nl)for(n=Nl.return;null!==n;){var r=n;switch(r.tag){case 1:null!==(r=r.type.childContextTypes)&&void 0!==r&&mi();break;case 3:Na(),si(fi),si(di),Xa();break;case 5:Aa(r);break;case 4:Na();break;case 13:case 19:si(Ia);break;case 10:ta(r);break;case 23:case 24:ws()}n=n.return}Dl=e,Nl=Vs(e.current,null),Rl=Al=Fl=t,Ll=0,jl=null,Yl=Wl=zl=0}function ks(e,t){for(;;){var n=Nl;try{if(ea(),qa.current=To,eo){for(var r=Qa.memoizedState;null!==r;){var i=r.queue;null!==i&&(i.pending=null),r=r.next}eo=!1}if(Ka=0,Ja=Za=Qa=null,to=!1,Pl.current=null,null===n||null===n.return){Ll=1,jl=t,Nl=null;break}e:{var a=e,o=n.return,l=n,s=t;if(t=Rl,l.flags|=2048,l.firstEffect=l.lastEffect=null,null!==s&&"object"===typeof s&&"function"===typeof s.then){var u=s;if(0===(2&l.mode)){var c=l.alternate;c?(l.updateQueue=c.updateQueue,l.memoizedState=c.memoizedState,l.lanes=c.lanes):(l.updateQueue=null,l.memoizedState=null)}var d=0!==(1&Ia.current),f=o;do{var h;if(h=13===f.tag){var p=f.memoizedState;if(null!==p)h=null!==p.dehydrated;else{var g=f.memoizedProps;h=void 0!==g.fallback&&(!0!==g.unstable_avoidThisFallback||!d)}}if(h){var m=f.updateQueue;if(null===m){var v=new Set;v.add(u),f.updateQueue=v}else m.add(u);if(0===(2&f.mode)){if(f.flags|=64,l.flags|=16384,l.flags&=-2981,1===l.tag)if(null===l.alternate)l.tag=17;else{var y=sa(-1,1);y.tag=2,ua(l,y)}l.lanes|=1;break e}s=void 0,l=t;var b=a.pingCache;if(null===b?(b=a.pingCache=new ul,s=new Set,b.set(u,s)):void 0===(s=b.get(u))&&(s=new Set,b.set(u,s)),!s.has(l)){s.add(l);var x=zs.bind(null,a,u,l);u.then(x,x)}f.flags|=4096,f.lanes=t;break e}f=f.return}while(null!==f);s=Error((q(l.type)||"A React component")+" suspended while rendering, but no fallback UI was specified.\n\nAdd a <Suspense fallback=...> component higher in the tree to provide a loading indicator or placeholder to display.")}5!==Ll&&(Ll=2),s=ll(s,l),f=o;do{switch(f.tag){case 3:a=s,f.flags|=4096,t&=-t,f.lanes|=t,ca(f,cl(0,a,t));break e;case 1:a=s;var w=f.type,_=f.stateNode;if(0===(64&f.flags)&&("function"===typeof w.getDerivedStateFromError||null!==_&&"function"===typeof _.componentDidCatch&&(null===Kl||!Kl.has(_)))){f.flags|=4096,t&=-t,f.lanes|=t,ca(f,dl(f,a,t));break e}}f=f.return}while(null!==f)}Ps(n)}catch(k){t=k,Nl===n&&null!==n&&(Nl=n=n.return);continue}break}}function Ss(){var e=Ol.current;return Ol.current=To,null===e?To:e}function Ms(e,t){var n=Tl;Tl|=16;var r=Ss();for(Dl===e&&Rl===t||_s(e,t);;)try{Cs();break}catch(i){ks(e,i)}if(ea(),Tl=n,Ol.current=r,null!==Nl)throw Error(o(261));return Dl=null,Rl=0,Ll}function Cs(){for(;null!==Nl;)Os(Nl)}function Es(){for(;null!==Nl&&!Ci();)Os(Nl)}function Os(e){var t=$l(e.alternate,e,Al);e.memoizedProps=e.pendingProps,null===t?Ps(e):Nl=t,Pl.current=null}function Ps(e){var t=e;do{var n=t.alternate;if(e=t.return,0===(2048&t.flags)){if(null!==(n=al(n,t,Al)))return void(Nl=n);if(24!==(n=t).tag&&23!==n.tag||null===n.memoizedState||0!==(1073741824&Al)||0===(4&n.mode)){for(var r=0,i=n.child;null!==i;)r|=i.lanes|i.childLanes,i=i.sibling;n.childLanes=r}null!==e&&0===(2048&e.flags)&&(null===e.firstEffect&&(e.firstEffect=t.firstEffect),null!==t.lastEffect&&(null!==e.lastEffect&&(e.lastEffect.nextEffect=t.firstEffect),e.lastEffect=t.lastEffect),1<t.flags&&(null!==e.lastEffect?e.lastEffect.nextEffect=t:e.firstEffect=t,e.lastEffect=t))}else{if(null!==(n=ol(t)))return n.flags&=2047,void(Nl=n);null!==e&&(e.firstEffect=e.lastEffect=null,e.flags|=2048)}if(null!==(t=t.sibling))return void(Nl=t);Nl=t=e}while(null!==t);0===Ll&&(Ll=5)}function Ts(e){var t=Hi();return Vi(99,Ds.bind(null,e,t)),null}function Ds(e,t){do{Rs()}while(null!==Zl);if(0!==(48&Tl))throw Error(o(327));var n=e.finishedWork;if(null===n)return null;if(e.finishedWork=null,e.finishedLanes=0,n===e.current)throw Error(o(177));e.callbackNode=null;var r=n.lanes|n.childLanes,i=r,a=e.pendingLanes&~i;e.pendingLanes=i,e.suspendedLanes=0,e.pingedLanes=0,e.expiredLanes&=i,e.mutableReadLanes&=i,e.entangledLanes&=i,i=e.entanglements;for(var l=e.eventTimes,s=e.expirationTimes;0<a;){var u=31-Bt(a),c=1<<u;i[u]=0,l[u]=-1,s[u]=-1,a&=~c}if(null!==ns&&0===(24&r)&&ns.has(e)&&ns.delete(e),e===Dl&&(Nl=Dl=null,Rl=0),1<n.flags?null!==n.lastEffect?(n.lastEffect.nextEffect=n,r=n.firstEffect):r=n:r=n.firstEffect,null!==r){if(i=Tl,Tl|=32,Pl.current=null,zr=Kt,gr(l=pr())){if("selectionStart"in l)s={start:l.selectionStart,end:l.selectionEnd};else e:if(s=(s=l.ownerDocument)&&s.defaultView||window,(c=s.getSelection&&s.getSelection())&&0!==c.rangeCount){s=c.anchorNode,a=c.anchorOffset,u=c.focusNode,c=c.focusOffset;try{s.nodeType,u.nodeType}catch(C){s=null;break e}var d=0,f=-1,h=-1,p=0,g=0,m=l,v=null;t:for(;;){for(var y;m!==s||0!==a&&3!==m.nodeType||(f=d+a),m!==u||0!==c&&3!==m.nodeType||(h=d+c),3===m.nodeType&&(d+=m.nodeValue.length),null!==(y=m.firstChild);)v=m,m=y;for(;;){if(m===l)break t;if(v===s&&++p===a&&(f=d),v===u&&++g===c&&(h=d),null!==(y=m.nextSibling))break;v=(m=v).parentNode}m=y}s=-1===f||-1===h?null:{start:f,end:h}}else s=null;s=s||{start:0,end:0}}else s=null;Wr={focusedElem:l,selectionRange:s},Kt=!1,ss=null,us=!1,Xl=r;do{try{Ns()}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);ss=null,Xl=r;do{try{for(l=e;null!==Xl;){var b=Xl.flags;if(16&b&&be(Xl.stateNode,""),128&b){var x=Xl.alternate;if(null!==x){var w=x.ref;null!==w&&("function"===typeof w?w(null):w.current=null)}}switch(1038&b){case 2:xl(Xl),Xl.flags&=-3;break;case 6:xl(Xl),Xl.flags&=-3,Sl(Xl.alternate,Xl);break;case 1024:Xl.flags&=-1025;break;case 1028:Xl.flags&=-1025,Sl(Xl.alternate,Xl);break;case 4:Sl(Xl.alternate,Xl);break;case 8:kl(l,s=Xl);var _=s.alternate;yl(s),null!==_&&yl(_)}Xl=Xl.nextEffect}}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);if(w=Wr,x=pr(),b=w.focusedElem,l=w.selectionRange,x!==b&&b&&b.ownerDocument&&hr(b.ownerDocument.documentElement,b)){null!==l&&gr(b)&&(x=l.start,void 0===(w=l.end)&&(w=x),"selectionStart"in b?(b.selectionStart=x,b.selectionEnd=Math.min(w,b.value.length)):(w=(x=b.ownerDocument||document)&&x.defaultView||window).getSelection&&(w=w.getSelection(),s=b.textContent.length,_=Math.min(l.start,s),l=void 0===l.end?_:Math.min(l.end,s),!w.extend&&_>l&&(s=l,l=_,_=s),s=fr(b,_),a=fr(b,l),s&&a&&(1!==w.rangeCount||w.anchorNode!==s.node||w.anchorOffset!==s.offset||w.focusNode!==a.node||w.focusOffset!==a.offset)&&((x=x.createRange()).setStart(s.node,s.offset),w.removeAllRanges(),_>l?(w.addRange(x),w.extend(a.node,a.offset)):(x.setEnd(a.node,a.offset),w.addRange(x))))),x=[];for(w=b;w=w.parentNode;)1===w.nodeType&&x.push({element:w,left:w.scrollLeft,top:w.scrollTop});for("function"===typeof b.focus&&b.focus(),b=0;b<x.length;b++)(w=x[b]).element.scrollLeft=w.left,w.element.scrollTop=w.top}Kt=!!zr,Wr=zr=null,e.current=n,Xl=r;do{try{for(b=e;null!==Xl;){var k=Xl.flags;if(36&k&&gl(b,Xl.alternate,Xl),128&k){x=void 0;var S=Xl.ref;if(null!==S){var M=Xl.stateNode;switch(Xl.tag){case 5:x=M;break;default:x=M}"function"===typeof S?S(x):S.current=x}}Xl=Xl.nextEffect}}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);Xl=null,Li(),Tl=i}else e.current=n;if(Ql)Ql=!1,Zl=e,Jl=t;else for(Xl=r;null!==Xl;)t=Xl.nextEffect,Xl.nextEffect=null,8&Xl.flags&&((k=Xl).sibling=null,k.stateNode=null),Xl=t;if(0===(r=e.pendingLanes)&&(Kl=null),1===r?e===is?rs++:(rs=0,is=e):rs=0,n=n.stateNode,_i&&"function"===typeof _i.onCommitFiberRoot)try{_i.onCommitFiberRoot(wi,n,void 0,64===(64&n.current.flags))}catch(C){}if(ps(e,Yi()),ql)throw ql=!1,e=Gl,Gl=null,e;return 0!==(8&Tl)||$i(),null}function Ns(){for(;null!==Xl;){var e=Xl.alternate;us||null===ss||(0!==(8&Xl.flags)?tt(Xl,ss)&&(us=!0):13===Xl.tag&&Cl(e,Xl)&&tt(Xl,ss)&&(us=!0));var t=Xl.flags;0!==(256&t)&&pl(e,Xl),0===(512&t)||Ql||(Ql=!0,Bi(97,(function(){return Rs(),null}))),Xl=Xl.nextEffect}}function Rs(){if(90!==Jl){var e=97<Jl?97:Jl;return Jl=90,Vi(e,Ls)}return!1}function As(e,t){es.push(t,e),Ql||(Ql=!0,Bi(97,(function(){return Rs(),null})))}function Is(e,t){ts.push(t,e),Ql||(Ql=!0,Bi(97,(function(){return Rs(),null})))}function Ls(){if(null===Zl)return!1;var e=Zl;if(Zl=null,0!==(48&Tl))throw Error(o(331));var t=Tl;Tl|=32;var n=ts;ts=[];for(var r=0;r<n.length;r+=2){var i=n[r],a=n[r+1],l=i.destroy;if(i.destroy=void 0,"function"===typeof l)try{l()}catch(u){if(null===a)throw Error(o(330));Fs(a,u)}}for(n=es,es=[],r=0;r<n.length;r+=2){i=n[r],a=n[r+1];try{var s=i.create;i.destroy=s()}catch(u){if(null===a)throw Error(o(330));Fs(a,u)}}for(s=e.current.firstEffect;null!==s;)e=s.nextEffect,s.nextEffect=null,8&s.flags&&(s.sibling=null,s.stateNode=null),s=e;return Tl=t,$i(),!0}function js(e,t,n){ua(e,t=cl(0,t=ll(n,t),1)),t=cs(),null!==(e=hs(e,1))&&(Vt(e,1,t),ps(e,t))}function Fs(e,t){if(3===e.tag)js(e,e,t);else for(var n=e.return;null!==n;){if(3===n.tag){js(n,e,t);break}if(1===n.tag){var r=n.stateNode;if("function"===typeof n.type.getDerivedStateFromError||"function"===typeof r.componentDidCatch&&(null===Kl||!Kl.has(r))){var i=dl(n,e=ll(t,e),1);if(ua(n,i),i=cs(),null!==(n=hs(n,1)))Vt(n,1,i),ps(n,i);else if("function"===typeof r.componentDidCatch&&(null===Kl||!Kl.has(r)))try{r.componentDidCatch(t,e)}catch(a){}break}}n=n.return}}function zs(e,t,n){var r=e.pingCache;null!==r&&r.delete(t),t=cs(),e.pingedLanes|=e.suspendedLanes&n,Dl===e&&(Rl&n)===n&&(4===Ll||3===Ll&&(62914560&Rl)===Rl&&500>Yi()-Ul?_s(e,0):Yl|=n),ps(e,t)}function Ws(e,t){var n=e.stateNode;null!==n&&n.delete(t),0===(t=0)&&(0===(2&(t=e.mode))?t=1:0===(4&t)?t=99===Hi()?1:2:(0===os&&(os=Fl),0===(t=Ht(62914560&~os))&&(t=4194304))),n=cs(),null!==(e=hs(e,t))&&(Vt(e,t,n),ps(e,n))}function Ys(e,t,n,r){this.tag=e,this.key=n,this.sibling=this.child=this.return=this.stateNode=this.type=this.elementType=null,this.index=0,this.ref=null,this.pendingProps=t,this.dependencies=this.memoizedState=this.updateQueue=this.memoizedProps=null,this.mode=r,this.flags=0,this.lastEffect=this.firstEffect=this.nextEffect=null,this.childLanes=this.lanes=0,this.alternate=null}function Hs(e,t,n,r){return new Ys(e,t,n,r)}function Us(e){return!(!(e=e.prototype)||!e.isReactComponent)}function Vs(e,t){var n=e.alternate;return null===n?((n=Hs(e.tag,t,e.key,e.mode)).elementType=e.elementType,n.type=e.type,n.stateNode=e.stateNode,n.alternate=e,e.alternate=n):(n.pendingProps=t,n.type=e.type,n.flags=0,n.nextEffect=null,n.firstEffect=null,n.lastEffect=null),n.childLanes=e.childLanes,n.lanes=e.lanes,n.child=e.child,n.memoizedProps=e.memoizedProps,n.memoizedState=e.memoizedState,n.updateQueue=e.updateQueue,t=e.dependencies,n.dependencies=null===t?null:{lanes:t.lanes,firstContext:t.firstContext},n.sibling=e.sibling,n.index=e.index,n.ref=e.ref,n}function Bs(e,t,n,r,i,a){var l=2;if(r=e,"function"===typeof e)Us(e)&&(l=1);else if("string"===typeof e)l=5;else e:switch(e){case M:return $s(n.children,i,a,t);case j:l=8,i|=16;break;case C:l=8,i|=1;break;case E:return(e=Hs(12,n,t,8|i)).elementType=E,e.type=E,e.lanes=a,e;case D:return(e=Hs(13,n,t,i)).type=D,e.elementType=D,e.lanes=a,e;case N:return(e=Hs(19,n,t,i)).elementType=N,e.lanes=a,e;case F:return Xs(n,i,a,t);case z:return(e=Hs(24,n,t,i)).elementType=z,e.lanes=a,e;default:if("object"===typeof e&&null!==e)switch(e.$$typeof){case O:l=10;break e;case P:l=9;break e;case T:l=11;break e;case R:l=14;break e;case A:l=16,r=null;break e;case I:l=22;break e}throw Error(o(130,null==e?e:typeof e,""))}return(t=Hs(l,n,t,i)).elementType=e,t.type=r,t.lanes=a,t}function $s(e,t,n,r){return(e=Hs(7,e,r,t)).lanes=n,e}function Xs(e,t,n,r){return(e=Hs(23,e,r,t)).elementType=F,e.lanes=n,e}function qs(e,t,n){return(e=Hs(6,e,null,t)).lanes=n,e}function Gs(e,t,n){return(t=Hs(4,null!==e.children?e.children:[],e.key,t)).lanes=n,t.stateNode={containerInfo:e.containerInfo,pendingChildren:null,implementation:e.implementation},t}function Ks(e,t,n){this.tag=t,this.containerInfo=e,this.finishedWork=this.pingCache=this.current=this.pendingChildren=null,this.timeoutHandle=-1,this.pendingContext=this.context=null,this.hydrate=n,this.callbackNode=null,this.callbackPriority=0,this.eventTimes=Ut(0),this.expirationTimes=Ut(-1),this.entangledLanes=this.finishedLanes=this.mutableReadLanes=this.expiredLanes=this.pingedLanes=this.suspendedLanes=this.pendingLanes=0,this.entanglements=Ut(0),this.mutableSourceEagerHydrationData=null}function Qs(e,t,n){var r=3<arguments.length&&void 0!==arguments[3]?arguments[3]:null;return{$$typeof:S,key:null==r?null:""+r,children:e,containerInfo:t,implementation:n}}function Zs(e,t,n,r){var i=t.current,a=cs(),l=ds(i);e:if(n){t:{if(Qe(n=n._reactInternals)!==n||1!==n.tag)throw Error(o(170));var s=n;do{switch(s.tag){case 3:s=s.stateNode.context;break t;case 1:if(gi(s.type)){s=s.stateNode.__reactInternalMemoizedMergedChildContext;break t}}s=s.return}while(null!==s);throw Error(o(171))}if(1===n.tag){var u=n.type;if(gi(u)){n=yi(n,u,s);break e}}n=s}else n=ci;return null===t.context?t.context=n:t.pendingContext=n,(t=sa(a,l)).payload={element:e},null!==(r=void 0===r?null:r)&&(t.callback=r),ua(i,t),fs(i,l,a),l}function Js(e){if(!(e=e.current).child)return null;switch(e.child.tag){case 5:default:return e.child.stateNode}}function eu(e,t){if(null!==(e=e.memoizedState)&&null!==e.dehydrated){var n=e.retryLane;e.retryLane=0!==n&&n<t?n:t}}function tu(e,t){eu(e,t),(e=e.alternate)&&eu(e,t)}function nu(e,t,n){var r=null!=n&&null!=n.hydrationOptions&&n.hydrationOptions.mutableSources||null;if(n=new Ks(e,t,null!=n&&!0===n.hydrate),t=Hs(3,null,null,2===t?7:1===t?3:0),n.current=t,t.stateNode=n,oa(t),e[Zr]=n.current,Tr(8===e.nodeType?e.parentNode:e),r)for(e=0;e<r.length;e++){var i=(t=r[e])._getVersion;i=i(t._source),null==n.mutableSourceEagerHydrationData?n.mutableSourceEagerHydrationData=[t,i]:n.mutableSourceEagerHydrationData.push(t,i)}this._internalRoot=n}function ru(e){return!(!e||1!==e.nodeType&&9!==e.nodeType&&11!==e.nodeType&&(8!==e.nodeType||" react-mount-point-unstable "!==e.nodeValue))}function iu(e,t,n,r,i){var a=n._reactRootContainer;if(a){var o=a._internalRoot;if("function"===typeof i){var l=i;i=function(){var e=Js(o);l.call(e)}}Zs(t,o,e,i)}else{if(a=n._reactRootContainer=function(e,t){if(t||(t=!(!(t=e?9===e.nodeType?e.documentElement:e.firstChild:null)||1!==t.nodeType||!t.hasAttribute("data-reactroot"))),!t)for(var n;n=e.lastChild;)e.removeChild(n);return new nu(e,0,t?{hydrate:!0}:void 0)}(n,r),o=a._internalRoot,"function"===typeof i){var s=i;i=function(){var e=Js(o);s.call(e)}}bs((function(){Zs(t,o,e,i)}))}return Js(o)}function au(e,t){var n=2<arguments.length&&void 0!==arguments[2]?arguments[2]:null;if(!ru(t))throw Error(o(200));return Qs(e,t,null,n)}$l=function(e,t,n){var r=t.lanes;if(null!==e)if(e.memoizedProps!==t.pendingProps||fi.current)Io=!0;else{if(0===(n&r)){switch(Io=!1,t.tag){case 3:Bo(t),Ba();break;case 5:Ra(t);break;case 1:gi(t.type)&&bi(t);break;case 4:Da(t,t.stateNode.containerInfo);break;case 10:r=t.memoizedProps.value;var i=t.type._context;ui(Ki,i._currentValue),i._currentValue=r;break;case 13:if(null!==t.memoizedState)return 0!==(n&t.child.childLanes)?Ko(e,t,n):(ui(Ia,1&Ia.current),null!==(t=rl(e,t,n))?t.sibling:null);ui(Ia,1&Ia.current);break;case 19:if(r=0!==(n&t.childLanes),0!==(64&e.flags)){if(r)return nl(e,t,n);t.flags|=64}if(null!==(i=t.memoizedState)&&(i.rendering=null,i.tail=null,i.lastEffect=null),ui(Ia,Ia.current),r)break;return null;case 23:case 24:return t.lanes=0,Wo(e,t,n)}return rl(e,t,n)}Io=0!==(16384&e.flags)}else Io=!1;switch(t.lanes=0,t.tag){case 2:if(r=t.type,null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),e=t.pendingProps,i=pi(t,di.current),ra(t,n),i=io(null,t,r,e,i,n),t.flags|=1,"object"===typeof i&&null!==i&&"function"===typeof i.render&&void 0===i.$$typeof){if(t.tag=1,t.memoizedState=null,t.updateQueue=null,gi(r)){var a=!0;bi(t)}else a=!1;t.memoizedState=null!==i.state&&void 0!==i.state?i.state:null,oa(t);var l=r.getDerivedStateFromProps;"function"===typeof l&&pa(t,r,l,e),i.updater=ga,t.stateNode=i,i._reactInternals=t,ba(t,r,e,n),t=Vo(null,t,r,!0,a,n)}else t.tag=0,Lo(null,t,i,n),t=t.child;return t;case 16:i=t.elementType;e:{switch(null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),e=t.pendingProps,i=(a=i._init)(i._payload),t.type=i,a=t.tag=function(e){if("function"===typeof e)return Us(e)?1:0;if(void 0!==e&&null!==e){if((e=e.$$typeof)===T)return 11;if(e===R)return 14}return 2}(i),e=Gi(i,e),a){case 0:t=Ho(null,t,i,e,n);break e;case 1:t=Uo(null,t,i,e,n);break e;case 11:t=jo(null,t,i,e,n);break e;case 14:t=Fo(null,t,i,Gi(i.type,e),r,n);break e}throw Error(o(306,i,""))}return t;case 0:return r=t.type,i=t.pendingProps,Ho(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 1:return r=t.type,i=t.pendingProps,Uo(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 3:if(Bo(t),r=t.updateQueue,null===e||null===r)throw Error(o(282));if(r=t.pendingProps,i=null!==(i=t.memoizedState)?i.element:null,la(e,t),da(t,r,null,n),(r=t.memoizedState.element)===i)Ba(),t=rl(e,t,n);else{if((a=(i=t.stateNode).hydrate)&&(Fa=$r(t.stateNode.containerInfo.firstChild),ja=t,a=za=!0),a){if(null!=(e=i.mutableSourceEagerHydrationData))for(i=0;i<e.length;i+=2)(a=e[i])._workInProgressVersionPrimary=e[i+1],$a.push(a);for(n=Ma(t,null,r,n),t.child=n;n;)n.flags=-3&n.flags|1024,n=n.sibling}else Lo(e,t,r,n),Ba();t=t.child}return t;case 5:return Ra(t),null===e&&Ha(t),r=t.type,i=t.pendingProps,a=null!==e?e.memoizedProps:null,l=i.children,Hr(r,i)?l=null:null!==a&&Hr(r,a)&&(t.flags|=16),Yo(e,t),Lo(e,t,l,n),t.child;case 6:return null===e&&Ha(t),null;case 13:return Ko(e,t,n);case 4:return Da(t,t.stateNode.containerInfo),r=t.pendingProps,null===e?t.child=Sa(t,null,r,n):Lo(e,t,r,n),t.child;case 11:return r=t.type,i=t.pendingProps,jo(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 7:return Lo(e,t,t.pendingProps,n),t.child;case 8:case 12:return Lo(e,t,t.pendingProps.children,n),t.child;case 10:e:{r=t.type._context,i=t.pendingProps,l=t.memoizedProps,a=i.value;var s=t.type._context;if(ui(Ki,s._currentValue),s._currentValue=a,null!==l)if(s=l.value,0===(a=sr(s,a)?0:0|("function"===typeof r._calculateChangedBits?r._calculateChangedBits(s,a):1073741823))){if(l.children===i.children&&!fi.current){t=rl(e,t,n);break e}}else for(null!==(s=t.child)&&(s.return=t);null!==s;){var u=s.dependencies;if(null!==u){l=s.child;for(var c=u.firstContext;null!==c;){if(c.context===r&&0!==(c.observedBits&a)){1===s.tag&&((c=sa(-1,n&-n)).tag=2,ua(s,c)),s.lanes|=n,null!==(c=s.alternate)&&(c.lanes|=n),na(s.return,n),u.lanes|=n;break}c=c.next}}else l=10===s.tag&&s.type===t.type?null:s.child;if(null!==l)l.return=s;else for(l=s;null!==l;){if(l===t){l=null;break}if(null!==(s=l.sibling)){s.return=l.return,l=s;break}l=l.return}s=l}Lo(e,t,i.children,n),t=t.child}return t;case 9:return i=t.type,r=(a=t.pendingProps).children,ra(t,n),r=r(i=ia(i,a.unstable_observedBits)),t.flags|=1,Lo(e,t,r,n),t.child;case 14:return a=Gi(i=t.type,t.pendingProps),Fo(e,t,i,a=Gi(i.type,a),r,n);case 15:return zo(e,t,t.type,t.pendingProps,r,n);case 17:return r=t.type,i=t.pendingProps,i=t.elementType===r?i:Gi(r,i),null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),t.tag=1,gi(r)?(e=!0,bi(t)):e=!1,ra(t,n),va(t,r,i),ba(t,r,i,n),Vo(null,t,r,!0,e,n);case 19:return nl(e,t,n);case 23:case 24:return Wo(e,t,n)}throw Error(o(156,t.tag))},nu.prototype.render=function(e){Zs(e,this._internalRoot,null,null)},nu.prototype.unmount=function(){var e=this._internalRoot,t=e.containerInfo;Zs(null,e,null,(function(){t[Zr]=null}))},nt=function(e){13===e.tag&&(fs(e,4,cs()),tu(e,4))},rt=function(e){13===e.tag&&(fs(e,67108864,cs()),tu(e,67108864))},it=function(e){if(13===e.tag){var t=cs(),n=ds(e);fs(e,n,t),tu(e,n)}},at=function(e,t){return t()},Oe=function(e,t,n){switch(t){case"input":if(re(e,n),t=n.name,"radio"===n.type&&null!=t){for(n=e;n.parentNode;)n=n.parentNode;for(n=n.querySelectorAll("input[name="+JSON.stringify(""+t)+'][type="radio"]'),t=0;t<n.length;t++){var r=n[t];if(r!==e&&r.form===e.form){var i=ri(r);if(!i)throw Error(o(90));Z(r),re(r,i)}}}break;case"textarea":ce(e,n);break;case"select":null!=(t=n.value)&&le(e,!!n.multiple,t,!1)}},Ae=ys,Ie=function(e,t,n,r,i){var a=Tl;Tl|=4;try{return Vi(98,e.bind(null,t,n,r,i))}finally{0===(Tl=a)&&(Bl(),$i())}},Le=function(){0===(49&Tl)&&(function(){if(null!==ns){var e=ns;ns=null,e.forEach((function(e){e.expiredLanes|=24&e.pendingLanes,ps(e,Yi())}))}$i()}(),Rs())},je=function(e,t){var n=Tl;Tl|=2;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}};var ou={Events:[ti,ni,ri,Ne,Re,Rs,{current:!1}]},lu={findFiberByHostInstance:ei,bundleType:0,version:"17.0.1",rendererPackageName:"react-dom"},su={bundleType:lu.bundleType,version:lu.version,rendererPackageName:lu.rendererPackageName,rendererConfig:lu.rendererConfig,overrideHookState:null,overrideHookStateDeletePath:null,overrideHookStateRenamePath:null,overrideProps:null,overridePropsDeletePath:null,overridePropsRenamePath:null,setSuspenseHandler:null,scheduleUpdate:null,currentDispatcherRef:_.ReactCurrentDispatcher,findHostInstanceByFiber:function(e){return null===(e=et(e))?null:e.stateNode},findFiberByHostInstance:lu.findFiberByHostInstance||function(){return null},findHostInstancesForRefresh:null,scheduleRefresh:null,scheduleRoot:null,setRefreshHandler:null,getCurrentFiber:null};if("undefined"!==typeof __REACT_DEVTOOLS_GLOBAL_HOOK__){var uu=__REACT_DEVTOOLS_GLOBAL_HOOK__;if(!uu.isDisabled&&uu.supportsFiber)try{wi=uu.inject(su),_i=uu}catch(ve){}}t.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=ou,t.createPortal=au,t.findDOMNode=function(e){if(null==e)return null;if(1===e.nodeType)return e;var t=e._reactInternals;if(void 0===t){if("function"===typeof e.render)throw Error(o(188));throw Error(o(268,Object.keys(e)))}return e=null===(e=et(t))?null:e.stateNode},t.flushSync=function(e,t){var n=Tl;if(0!==(48&n))return e(t);Tl|=1;try{if(e)return Vi(99,e.bind(null,t))}finally{Tl=n,$i()}},t.hydrate=function(e,t,n){if(!ru(t))throw Error(o(200));return iu(null,e,t,!0,n)},t.render=function(e,t,n){if(!ru(t))throw Error(o(200));return iu(null,e,t,!1,n)},t.unmountComponentAtNode=function(e){if(!ru(e))throw Error(o(40));return!!e._reactRootContainer&&(bs((function(){iu(null,null,e,!1,(function(){e._reactRootContainer=null,e[Zr]=null}))})),!0)},t.unstable_batchedUpdates=ys,t.unstable_createPortal=function(e,t){return au(e,t,2<arguments.length&&void 0!==arguments[2]?arguments[2]:null)},t.unstable_renderSubtreeIntoContainer=function(e,t,n,r){if(!ru(n))throw Error(o(200));if(null==e||void 0===e._reactInternals)throw Error(o(38));return iu(e,t,n,!1,r)},t.version="17.0.1"},function(e,t,n){"use strict";e.exports=n(82)},function(e,t,n){"use strict";var r,i,a,o;if("object"===typeof performance&&"function"===typeof performance.now){var l=performance;t.unstable_now=function(){return l.now()}}else{var s=Date,u=s.now();t.unstable_now=function(){return s.now()-u}}if("undefined"===typeof window||"function"!==typeof MessageChannel){var c=null,d=null,f=function e(){if(null!==c)try{var n=t.unstable_now();c(!0,n),c=null}catch(b){throw setTimeout(e,0),b}};r=function(e){null!==c?setTimeout(r,0,e):(c=e,setTimeout(f,0))},i=function(e,t){d=setTimeout(e,t)},a=function(){clearTimeout(d)},t.unstable_shouldYield=function(){return!1},o=t.unstable_forceFrameRate=function(){}}else{var h=window.setTimeout,p=window.clearTimeout;if("undefined"!==typeof console){var g=window.cancelAnimationFrame;"function"!==typeof window.requestAnimationFrame&&console.error("This browser doesn't support requestAnimationFrame. Make sure that you load a polyfill in older browsers. https://reactjs.org/link/react-polyfills"),"function"!==typeof g&&console.error("This browser doesn't support cancelAnimationFrame. Make sure that you load a polyfill in older browsers. https://reactjs.org/link/react-polyfills")}var m=!1,v=null,y=-1,x=5,w=0;t.unstable_shouldYield=function(){return t.unstable_now()>=w},o=function(){},t.unstable_forceFrameRate=function(e){0>e||125<e?console.error("forceFrameRate takes a positive int between 0 and 125, forcing frame rates higher than 125 fps is not supported"):x=0<e?Math.floor(1e3/e):5};var _=new MessageChannel,k=_.port2;_.port1.onmessage=function(){if(null!==v){var e=t.unstable_now();w=e+x;try{v(!0,e)?k.postMessage(null):(m=!1,v=null)}catch(b){throw k.postMessage(null),b}}else m=!1},r=function(e){v=e,m||(m=!0,k.postMessage(null))},i=function(e,n){y=h((function(){e(t.unstable_now())}),n)},a=function(){p(y),y=-1}}function S(e,t){var n=e.length;e.push(t);e:for(;;){var r=n-1>>>1,i=e[r];if(!(void 0!==i&&0<E(i,t)))break e;e[r]=t,e[n]=i,n=r}}function M(e){return void 0===(e=e[0])?null:e}function C(e){var t=e[0];if(void 0!==t){var n=e.pop();if(n!==t){e[0]=n;e:for(var r=0,i=e.length;r<i;){var a=2*(r+1)-1,o=e[a],l=a+1,s=e[l];if(void 0!==o&&0>E(o,n))void 0!==s&&0>E(s,o)?(e[r]=s,e[l]=n,r=l):(e[r]=o,e[a]=n,r=a);else{if(!(void 0!==s&&0>E(s,n)))break e;e[r]=s,e[l]=n,r=l}}}return t}return null}function E(e,t){var n=e.sortIndex-t.sortIndex;return 0!==n?n:e.id-t.id}var O=[],P=[],T=1,D=null,N=3,R=!1,A=!1,I=!1;function L(e){for(var t=M(P);null!==t;){if(null===t.callback)C(P);else{if(!(t.startTime<=e))break;C(P),t.sortIndex=t.expirationTime,S(O,t)}t=M(P)}}function j(e){if(I=!1,L(e),!A)if(null!==M(O))A=!0,r(F);else{var t=M(P);null!==t&&i(j,t.startTime-e)}}function F(e,n){A=!1,I&&(I=!1,a()),R=!0;var r=N;try{for(L(n),D=M(O);null!==D&&(!(D.expirationTime>n)||e&&!t.unstable_shouldYield());){var o=D.callback;if("function"===typeof o){D.callback=null,N=D.priorityLevel;var l=o(D.expirationTime<=n);n=t.unstable_now(),"function"===typeof l?D.callback=l:D===M(O)&&C(O),L(n)}else C(O);D=M(O)}if(null!==D)var s=!0;else{var u=M(P);null!==u&&i(j,u.startTime-n),s=!1}return s}finally{D=null,N=r,R=!1}}var z=o;t.unstable_IdlePriority=5,t.unstable_ImmediatePriority=1,t.unstable_LowPriority=4,t.unstable_NormalPriority=3,t.unstable_Profiling=null,t.unstable_UserBlockingPriority=2,t.unstable_cancelCallback=function(e){e.callback=null},t.unstable_continueExecution=function(){A||R||(A=!0,r(F))},t.unstable_getCurrentPriorityLevel=function(){return N},t.unstable_getFirstCallbackNode=function(){return M(O)},t.unstable_next=function(e){switch(N){case 1:case 2:case 3:var t=3;break;default:t=N}var n=N;N=t;try{return e()}finally{N=n}},t.unstable_pauseExecution=function(){},t.unstable_requestPaint=z,t.unstable_runWithPriority=function(e,t){switch(e){case 1:case 2:case 3:case 4:case 5:break;default:e=3}var n=N;N=e;try{return t()}finally{N=n}},t.unstable_scheduleCallback=function(e,n,o){var l=t.unstable_now();switch("object"===typeof o&&null!==o?o="number"===typeof(o=o.delay)&&0<o?l+o:l:o=l,e){case 1:var s=-1;break;case 2:s=250;break;case 5:s=1073741823;break;case 4:s=1e4;break;default:s=5e3}return e={id:T++,callback:n,priorityLevel:e,startTime:o,expirationTime:s=o+s,sortIndex:-1},o>l?(e.sortIndex=o,S(P,e),null===M(O)&&e===M(P)&&(I?a():I=!0,i(j,o-l))):(e.sortIndex=s,S(O,e),A||R||(A=!0,r(F))),e},t.unstable_wrapCallback=function(e){var t=N;return function(){var n=N;N=t;try{return e.apply(this,arguments)}finally{N=n}}}},,,,function(e,t,n){},function(e,t,n){"use strict";n(35);var r=n(2),i=60103;if(t.Fragment=60107,"function"===typeof Symbol&&Symbol.for){var a=Symbol.for;i=a("react.element"),t.Fragment=a("react.fragment")}var o=r.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED.ReactCurrentOwner,l=Object.prototype.hasOwnProperty,s={key:!0,ref:!0,__self:!0,__source:!0};function u(e,t,n){var r,a={},u=null,c=null;for(r in void 0!==n&&(u=""+n),void 0!==t.key&&(u=""+t.key),void 0!==t.ref&&(c=t.ref),t)l.call(t,r)&&!s.hasOwnProperty(r)&&(a[r]=t[r]);if(e&&e.defaultProps)for(r in t=e.defaultProps)void 0===a[r]&&(a[r]=t[r]);return{$$typeof:i,type:e,key:u,ref:c,props:a,_owner:o.current}}t.jsx=u,t.jsxs=u},function(e,t,n){"use strict";var r=n(89);function i(){}function a(){}a.resetWarningCache=i,e.exports=function(){function e(e,t,n,i,a,o){if(o!==r){var l=new Error("Calling PropTypes validators directly is not supported by the `prop-types` package. Use PropTypes.checkPropTypes() to call them. Read more at http://fb.me/use-check-prop-types");throw l.name="Invariant Violation",l}}function t(){return e}e.isRequired=e;var n={array:e,bool:e,func:e,number:e,object:e,string:e,symbol:e,any:e,arrayOf:t,element:e,elementType:e,instanceOf:t,node:e,objectOf:t,oneOf:t,oneOfType:t,shape:t,exact:t,checkPropTypes:a,resetWarningCache:i};return n.PropTypes=n,n}},function(e,t,n){"use strict";e.exports="SECRET_DO_NOT_PASS_THIS_OR_YOU_WILL_BE_FIRED"},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;!function(e){if(e&&e.__esModule)return e;var t={};if(null!=e)for(var n in e)if(Object.prototype.hasOwnProperty.call(e,n)){var r=Object.defineProperty&&Object.getOwnPropertyDescriptor?Object.getOwnPropertyDescriptor(e,n):{};r.get||r.set?Object.defineProperty(t,n,r):t[n]=e[n]}t.default=e}(n(1));var r=l(n(91)),i=l(n(94)),a=l(n(2)),o=l(n(52));n(54);function l(e){return e&&e.__esModule?e:{default:e}}function s(){return(s=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}var u=function(e,t){return e&&t&&t.split(" ").forEach((function(t){return(0,r.default)(e,t)}))},c=function(e,t){return e&&t&&t.split(" ").forEach((function(t){return(0,i.default)(e,t)}))},d=function(e){var t,n;function r(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).onEnter=function(e,n){var r=t.getClassNames(n?"appear":"enter").className;t.removeClasses(e,"exit"),u(e,r),t.props.onEnter&&t.props.onEnter(e,n)},t.onEntering=function(e,n){var r=t.getClassNames(n?"appear":"enter").activeClassName;t.reflowAndAddClass(e,r),t.props.onEntering&&t.props.onEntering(e,n)},t.onEntered=function(e,n){var r=t.getClassNames("appear").doneClassName,i=t.getClassNames("enter").doneClassName,a=n?r+" "+i:i;t.removeClasses(e,n?"appear":"enter"),u(e,a),t.props.onEntered&&t.props.onEntered(e,n)},t.onExit=function(e){var n=t.getClassNames("exit").className;t.removeClasses(e,"appear"),t.removeClasses(e,"enter"),u(e,n),t.props.onExit&&t.props.onExit(e)},t.onExiting=function(e){var n=t.getClassNames("exit").activeClassName;t.reflowAndAddClass(e,n),t.props.onExiting&&t.props.onExiting(e)},t.onExited=function(e){var n=t.getClassNames("exit").doneClassName;t.removeClasses(e,"exit"),u(e,n),t.props.onExited&&t.props.onExited(e)},t.getClassNames=function(e){var n=t.props.classNames,r="string"===typeof n,i=r?(r&&n?n+"-":"")+e:n[e];return{className:i,activeClassName:r?i+"-active":n[e+"Active"],doneClassName:r?i+"-done":n[e+"Done"]}},t}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var i=r.prototype;return i.removeClasses=function(e,t){var n=this.getClassNames(t),r=n.className,i=n.activeClassName,a=n.doneClassName;r&&c(e,r),i&&c(e,i),a&&c(e,a)},i.reflowAndAddClass=function(e,t){t&&(e&&e.scrollTop,u(e,t))},i.render=function(){var e=s({},this.props);return delete e.classNames,a.default.createElement(o.default,s({},e,{onEnter:this.onEnter,onEntered:this.onEntered,onEntering:this.onEntering,onExit:this.onExit,onExiting:this.onExiting,onExited:this.onExited}))},r}(a.default.Component);d.defaultProps={classNames:""},d.propTypes={};var f=d;t.default=f,e.exports=t.default},function(e,t,n){"use strict";var r=n(92);t.__esModule=!0,t.default=function(e,t){e.classList?e.classList.add(t):(0,i.default)(e,t)||("string"===typeof e.className?e.className=e.className+" "+t:e.setAttribute("class",(e.className&&e.className.baseVal||"")+" "+t))};var i=r(n(93));e.exports=t.default},function(e,t){e.exports=function(e){return e&&e.__esModule?e:{default:e}},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";t.__esModule=!0,t.default=function(e,t){return e.classList?!!t&&e.classList.contains(t):-1!==(" "+(e.className.baseVal||e.className)+" ").indexOf(" "+t+" ")},e.exports=t.default},function(e,t,n){"use strict";function r(e,t){return e.replace(new RegExp("(^|\\s)"+t+"(?:\\s|$)","g"),"$1").replace(/\s+/g," ").replace(/^\s*|\s*$/g,"")}e.exports=function(e,t){e.classList?e.classList.remove(t):"string"===typeof e.className?e.className=r(e.className,t):e.setAttribute("class",r(e.className&&e.className.baseVal||"",t))}},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;o(n(1));var r=o(n(2)),i=n(30),a=o(n(55));function o(e){return e&&e.__esModule?e:{default:e}}var l=function(e){var t,n;function o(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).handleEnter=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEnter",0,n)},t.handleEntering=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEntering",0,n)},t.handleEntered=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEntered",0,n)},t.handleExit=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExit",1,n)},t.handleExiting=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExiting",1,n)},t.handleExited=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExited",1,n)},t}n=e,(t=o).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var l=o.prototype;return l.handleLifecycle=function(e,t,n){var a,o=this.props.children,l=r.default.Children.toArray(o)[t];l.props[e]&&(a=l.props)[e].apply(a,n),this.props[e]&&this.props[e]((0,i.findDOMNode)(this))},l.render=function(){var e=this.props,t=e.children,n=e.in,i=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,["children","in"]),o=r.default.Children.toArray(t),l=o[0],s=o[1];return delete i.onEnter,delete i.onEntering,delete i.onEntered,delete i.onExit,delete i.onExiting,delete i.onExited,r.default.createElement(a.default,i,n?r.default.cloneElement(l,{key:"first",onEnter:this.handleEnter,onEntering:this.handleEntering,onEntered:this.handleEntered}):r.default.cloneElement(s,{key:"second",onEnter:this.handleExit,onEntering:this.handleExiting,onEntered:this.handleExited}))},o}(r.default.Component);l.propTypes={};var s=l;t.default=s,e.exports=t.default},function(e,t,n){"use strict";t.__esModule=!0,t.getChildMapping=i,t.mergeChildMappings=a,t.getInitialChildMapping=function(e,t){return i(e.children,(function(n){return(0,r.cloneElement)(n,{onExited:t.bind(null,n),in:!0,appear:o(n,"appear",e),enter:o(n,"enter",e),exit:o(n,"exit",e)})}))},t.getNextChildMapping=function(e,t,n){var l=i(e.children),s=a(t,l);return Object.keys(s).forEach((function(i){var a=s[i];if((0,r.isValidElement)(a)){var u=i in t,c=i in l,d=t[i],f=(0,r.isValidElement)(d)&&!d.props.in;!c||u&&!f?c||!u||f?c&&u&&(0,r.isValidElement)(d)&&(s[i]=(0,r.cloneElement)(a,{onExited:n.bind(null,a),in:d.props.in,exit:o(a,"exit",e),enter:o(a,"enter",e)})):s[i]=(0,r.cloneElement)(a,{in:!1}):s[i]=(0,r.cloneElement)(a,{onExited:n.bind(null,a),in:!0,exit:o(a,"exit",e),enter:o(a,"enter",e)})}})),s};var r=n(2);function i(e,t){var n=Object.create(null);return e&&r.Children.map(e,(function(e){return e})).forEach((function(e){n[e.key]=function(e){return t&&(0,r.isValidElement)(e)?t(e):e}(e)})),n}function a(e,t){function n(n){return n in t?t[n]:e[n]}e=e||{},t=t||{};var r,i=Object.create(null),a=[];for(var o in e)o in t?a.length&&(i[o]=a,a=[]):a.push(o);var l={};for(var s in t){if(i[s])for(r=0;r<i[s].length;r++){var u=i[s][r];l[i[s][r]]=n(u)}l[s]=n(s)}for(r=0;r<a.length;r++)l[a[r]]=n(a[r]);return l}function o(e,t,n){return null!=n[t]?n[t]:e.props[t]}},function(e,t){e.exports=Array.isArray||function(e){return"[object Array]"==Object.prototype.toString.call(e)}},function(e,t,n){"use strict";var r="function"===typeof Symbol&&Symbol.for,i=r?Symbol.for("react.element"):60103,a=r?Symbol.for("react.portal"):60106,o=r?Symbol.for("react.fragment"):60107,l=r?Symbol.for("react.strict_mode"):60108,s=r?Symbol.for("react.profiler"):60114,u=r?Symbol.for("react.provider"):60109,c=r?Symbol.for("react.context"):60110,d=r?Symbol.for("react.async_mode"):60111,f=r?Symbol.for("react.concurrent_mode"):60111,h=r?Symbol.for("react.forward_ref"):60112,p=r?Symbol.for("react.suspense"):60113,g=r?Symbol.for("react.suspense_list"):60120,m=r?Symbol.for("react.memo"):60115,v=r?Symbol.for("react.lazy"):60116,y=r?Symbol.for("react.block"):60121,b=r?Symbol.for("react.fundamental"):60117,x=r?Symbol.for("react.responder"):60118,w=r?Symbol.for("react.scope"):60119;function _(e){if("object"===typeof e&&null!==e){var t=e.$$typeof;switch(t){case i:switch(e=e.type){case d:case f:case o:case s:case l:case p:return e;default:switch(e=e&&e.$$typeof){case c:case h:case v:case m:case u:return e;default:return t}}case a:return t}}}function k(e){return _(e)===f}t.AsyncMode=d,t.ConcurrentMode=f,t.ContextConsumer=c,t.ContextProvider=u,t.Element=i,t.ForwardRef=h,t.Fragment=o,t.Lazy=v,t.Memo=m,t.Portal=a,t.Profiler=s,t.StrictMode=l,t.Suspense=p,t.isAsyncMode=function(e){return k(e)||_(e)===d},t.isConcurrentMode=k,t.isContextConsumer=function(e){return _(e)===c},t.isContextProvider=function(e){return _(e)===u},t.isElement=function(e){return"object"===typeof e&&null!==e&&e.$$typeof===i},t.isForwardRef=function(e){return _(e)===h},t.isFragment=function(e){return _(e)===o},t.isLazy=function(e){return _(e)===v},t.isMemo=function(e){return _(e)===m},t.isPortal=function(e){return _(e)===a},t.isProfiler=function(e){return _(e)===s},t.isStrictMode=function(e){return _(e)===l},t.isSuspense=function(e){return _(e)===p},t.isValidElementType=function(e){return"string"===typeof e||"function"===typeof e||e===o||e===f||e===s||e===l||e===p||e===g||"object"===typeof e&&null!==e&&(e.$$typeof===v||e.$$typeof===m||e.$$typeof===u||e.$$typeof===c||e.$$typeof===h||e.$$typeof===b||e.$$typeof===x||e.$$typeof===w||e.$$typeof===y)},t.typeOf=_},function(e,t){function n(t,r){return e.exports=n=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e},e.exports.default=e.exports,e.exports.__esModule=!0,n(t,r)}e.exports=n,e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";t.__esModule=!0;var r=n(2),i=(o(r),o(n(1))),a=o(n(101));o(n(47));function o(e){return e&&e.__esModule?e:{default:e}}function l(e,t){if(!(e instanceof t))throw new TypeError("Cannot call a class as a function")}function s(e,t){if(!e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return!t||"object"!==typeof t&&"function"!==typeof t?e:t}function u(e,t){if("function"!==typeof t&&null!==t)throw new TypeError("Super expression must either be null or a function, not "+typeof t);e.prototype=Object.create(t&&t.prototype,{constructor:{value:e,enumerable:!1,writable:!0,configurable:!0}}),t&&(Object.setPrototypeOf?Object.setPrototypeOf(e,t):e.__proto__=t)}var c=1073741823;function d(e){var t=[];return{on:function(e){t.push(e)},off:function(e){t=t.filter((function(t){return t!==e}))},get:function(){return e},set:function(n,r){e=n,t.forEach((function(t){return t(e,r)}))}}}t.default=function(e,t){var n,o,f="__create-react-context-"+(0,a.default)()+"__",h=function(e){function n(){var t,r;l(this,n);for(var i=arguments.length,a=Array(i),o=0;o<i;o++)a[o]=arguments[o];return t=r=s(this,e.call.apply(e,[this].concat(a))),r.emitter=d(r.props.value),s(r,t)}return u(n,e),n.prototype.getChildContext=function(){var e;return(e={})[f]=this.emitter,e},n.prototype.componentWillReceiveProps=function(e){if(this.props.value!==e.value){var n=this.props.value,r=e.value,i=void 0;((a=n)===(o=r)?0!==a||1/a===1/o:a!==a&&o!==o)?i=0:(i="function"===typeof t?t(n,r):c,0!==(i|=0)&&this.emitter.set(e.value,i))}var a,o},n.prototype.render=function(){return this.props.children},n}(r.Component);h.childContextTypes=((n={})[f]=i.default.object.isRequired,n);var p=function(t){function n(){var e,r;l(this,n);for(var i=arguments.length,a=Array(i),o=0;o<i;o++)a[o]=arguments[o];return e=r=s(this,t.call.apply(t,[this].concat(a))),r.state={value:r.getValue()},r.onUpdate=function(e,t){0!==((0|r.observedBits)&t)&&r.setState({value:r.getValue()})},s(r,e)}return u(n,t),n.prototype.componentWillReceiveProps=function(e){var t=e.observedBits;this.observedBits=void 0===t||null===t?c:t},n.prototype.componentDidMount=function(){this.context[f]&&this.context[f].on(this.onUpdate);var e=this.props.observedBits;this.observedBits=void 0===e||null===e?c:e},n.prototype.componentWillUnmount=function(){this.context[f]&&this.context[f].off(this.onUpdate)},n.prototype.getValue=function(){return this.context[f]?this.context[f].get():e},n.prototype.render=function(){return(e=this.props.children,Array.isArray(e)?e[0]:e)(this.state.value);var e},n}(r.Component);return p.contextTypes=((o={})[f]=i.default.object,o),{Provider:h,Consumer:p}},e.exports=t.default},function(e,t,n){"use strict";(function(t){var n="__global_unique_id__";e.exports=function(){return t[n]=(t[n]||0)+1}}).call(this,n(36))},function(e,t){var n,r,i=e.exports={};function a(){throw new Error("setTimeout has not been defined")}function o(){throw new Error("clearTimeout has not been defined")}function l(e){if(n===setTimeout)return setTimeout(e,0);if((n===a||!n)&&setTimeout)return n=setTimeout,setTimeout(e,0);try{return n(e,0)}catch(t){try{return n.call(null,e,0)}catch(t){return n.call(this,e,0)}}}!function(){try{n="function"===typeof setTimeout?setTimeout:a}catch(e){n=a}try{r="function"===typeof clearTimeout?clearTimeout:o}catch(e){r=o}}();var s,u=[],c=!1,d=-1;function f(){c&&s&&(c=!1,s.length?u=s.concat(u):d=-1,u.length&&h())}function h(){if(!c){var e=l(f);c=!0;for(var t=u.length;t;){for(s=u,u=[];++d<t;)s&&s[d].run();d=-1,t=u.length}s=null,c=!1,function(e){if(r===clearTimeout)return clearTimeout(e);if((r===o||!r)&&clearTimeout)return r=clearTimeout,clearTimeout(e);try{r(e)}catch(t){try{return r.call(null,e)}catch(t){return r.call(this,e)}}}(e)}}function p(e,t){this.fun=e,this.array=t}function g(){}i.nextTick=function(e){var t=new Array(arguments.length-1);if(arguments.length>1)for(var n=1;n<arguments.length;n++)t[n-1]=arguments[n];u.push(new p(e,t)),1!==u.length||c||l(h)},p.prototype.run=function(){this.fun.apply(null,this.array)},i.title="browser",i.browser=!0,i.env={},i.argv=[],i.version="",i.versions={},i.on=g,i.addListener=g,i.once=g,i.off=g,i.removeListener=g,i.removeAllListeners=g,i.emit=g,i.prependListener=g,i.prependOnceListener=g,i.listeners=function(e){return[]},i.binding=function(e){throw new Error("process.binding is not supported")},i.cwd=function(){return"/"},i.chdir=function(e){throw new Error("process.chdir is not supported")},i.umask=function(){return 0}},function(e,t,n){var r=n(38);e.exports=function(e,t){return r(e,t)}},function(e,t,n){var r=n(59),i=n(64),a=n(138),o=n(142),l=n(160),s=n(14),u=n(66),c=n(68),d="[object Arguments]",f="[object Array]",h="[object Object]",p=Object.prototype.hasOwnProperty;e.exports=function(e,t,n,g,m,v){var y=s(e),b=s(t),x=y?f:l(e),w=b?f:l(t),_=(x=x==d?h:x)==h,k=(w=w==d?h:w)==h,S=x==w;if(S&&u(e)){if(!u(t))return!1;y=!0,_=!1}if(S&&!_)return v||(v=new r),y||c(e)?i(e,t,n,g,m,v):a(e,t,x,n,g,m,v);if(!(1&n)){var M=_&&p.call(e,"__wrapped__"),C=k&&p.call(t,"__wrapped__");if(M||C){var E=M?e.value():e,O=C?t.value():t;return v||(v=new r),m(E,O,n,g,v)}}return!!S&&(v||(v=new r),o(e,t,n,g,m,v))}},function(e,t){e.exports=function(){this.__data__=[],this.size=0}},function(e,t,n){var r=n(25),i=Array.prototype.splice;e.exports=function(e){var t=this.__data__,n=r(t,e);return!(n<0)&&(n==t.length-1?t.pop():i.call(t,n,1),--this.size,!0)}},function(e,t,n){var r=n(25);e.exports=function(e){var t=this.__data__,n=r(t,e);return n<0?void 0:t[n][1]}},function(e,t,n){var r=n(25);e.exports=function(e){return r(this.__data__,e)>-1}},function(e,t,n){var r=n(25);e.exports=function(e,t){var n=this.__data__,i=r(n,e);return i<0?(++this.size,n.push([e,t])):n[i][1]=t,this}},function(e,t,n){var r=n(24);e.exports=function(){this.__data__=new r,this.size=0}},function(e,t){e.exports=function(e){var t=this.__data__,n=t.delete(e);return this.size=t.size,n}},function(e,t){e.exports=function(e){return this.__data__.get(e)}},function(e,t){e.exports=function(e){return this.__data__.has(e)}},function(e,t,n){var r=n(24),i=n(39),a=n(41);e.exports=function(e,t){var n=this.__data__;if(n instanceof r){var o=n.__data__;if(!i||o.length<199)return o.push([e,t]),this.size=++n.size,this;n=this.__data__=new a(o)}return n.set(e,t),this.size=n.size,this}},function(e,t,n){var r=n(61),i=n(118),a=n(40),o=n(63),l=/^\[object .+?Constructor\]$/,s=Function.prototype,u=Object.prototype,c=s.toString,d=u.hasOwnProperty,f=RegExp("^"+c.call(d).replace(/[\\^$.*+?()[\]{}|]/g,"\\$&").replace(/hasOwnProperty|(function).*?(?=\\\()| for .+?(?=\\\])/g,"$1.*?")+"$");e.exports=function(e){return!(!a(e)||i(e))&&(r(e)?f:l).test(o(e))}},function(e,t,n){var r=n(26),i=Object.prototype,a=i.hasOwnProperty,o=i.toString,l=r?r.toStringTag:void 0;e.exports=function(e){var t=a.call(e,l),n=e[l];try{e[l]=void 0;var r=!0}catch(s){}var i=o.call(e);return r&&(t?e[l]=n:delete e[l]),i}},function(e,t){var n=Object.prototype.toString;e.exports=function(e){return n.call(e)}},function(e,t,n){var r=n(119),i=function(){var e=/[^.]+$/.exec(r&&r.keys&&r.keys.IE_PROTO||"");return e?"Symbol(src)_1."+e:""}();e.exports=function(e){return!!i&&i in e}},function(e,t,n){var r=n(13)["__core-js_shared__"];e.exports=r},function(e,t){e.exports=function(e,t){return null==e?void 0:e[t]}},function(e,t,n){var r=n(122),i=n(24),a=n(39);e.exports=function(){this.size=0,this.__data__={hash:new r,map:new(a||i),string:new r}}},function(e,t,n){var r=n(123),i=n(124),a=n(125),o=n(126),l=n(127);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(27);e.exports=function(){this.__data__=r?r(null):{},this.size=0}},function(e,t){e.exports=function(e){var t=this.has(e)&&delete this.__data__[e];return this.size-=t?1:0,t}},function(e,t,n){var r=n(27),i=Object.prototype.hasOwnProperty;e.exports=function(e){var t=this.__data__;if(r){var n=t[e];return"__lodash_hash_undefined__"===n?void 0:n}return i.call(t,e)?t[e]:void 0}},function(e,t,n){var r=n(27),i=Object.prototype.hasOwnProperty;e.exports=function(e){var t=this.__data__;return r?void 0!==t[e]:i.call(t,e)}},function(e,t,n){var r=n(27);e.exports=function(e,t){var n=this.__data__;return this.size+=this.has(e)?0:1,n[e]=r&&void 0===t?"__lodash_hash_undefined__":t,this}},function(e,t,n){var r=n(28);e.exports=function(e){var t=r(this,e).delete(e);return this.size-=t?1:0,t}},function(e,t){e.exports=function(e){var t=typeof e;return"string"==t||"number"==t||"symbol"==t||"boolean"==t?"__proto__"!==e:null===e}},function(e,t,n){var r=n(28);e.exports=function(e){return r(this,e).get(e)}},function(e,t,n){var r=n(28);e.exports=function(e){return r(this,e).has(e)}},function(e,t,n){var r=n(28);e.exports=function(e,t){var n=r(this,e),i=n.size;return n.set(e,t),this.size+=n.size==i?0:1,this}},function(e,t,n){var r=n(41),i=n(134),a=n(135);function o(e){var t=-1,n=null==e?0:e.length;for(this.__data__=new r;++t<n;)this.add(e[t])}o.prototype.add=o.prototype.push=i,o.prototype.has=a,e.exports=o},function(e,t){e.exports=function(e){return this.__data__.set(e,"__lodash_hash_undefined__"),this}},function(e,t){e.exports=function(e){return this.__data__.has(e)}},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length;++n<r;)if(t(e[n],n,e))return!0;return!1}},function(e,t){e.exports=function(e,t){return e.has(t)}},function(e,t,n){var r=n(26),i=n(139),a=n(60),o=n(64),l=n(140),s=n(141),u=r?r.prototype:void 0,c=u?u.valueOf:void 0;e.exports=function(e,t,n,r,u,d,f){switch(n){case"[object DataView]":if(e.byteLength!=t.byteLength||e.byteOffset!=t.byteOffset)return!1;e=e.buffer,t=t.buffer;case"[object ArrayBuffer]":return!(e.byteLength!=t.byteLength||!d(new i(e),new i(t)));case"[object Boolean]":case"[object Date]":case"[object Number]":return a(+e,+t);case"[object Error]":return e.name==t.name&&e.message==t.message;case"[object RegExp]":case"[object String]":return e==t+"";case"[object Map]":var h=l;case"[object Set]":var p=1&r;if(h||(h=s),e.size!=t.size&&!p)return!1;var g=f.get(e);if(g)return g==t;r|=2,f.set(e,t);var m=o(h(e),h(t),r,u,d,f);return f.delete(e),m;case"[object Symbol]":if(c)return c.call(e)==c.call(t)}return!1}},function(e,t,n){var r=n(13).Uint8Array;e.exports=r},function(e,t){e.exports=function(e){var t=-1,n=Array(e.size);return e.forEach((function(e,r){n[++t]=[r,e]})),n}},function(e,t){e.exports=function(e){var t=-1,n=Array(e.size);return e.forEach((function(e){n[++t]=e})),n}},function(e,t,n){var r=n(143),i=Object.prototype.hasOwnProperty;e.exports=function(e,t,n,a,o,l){var s=1&n,u=r(e),c=u.length;if(c!=r(t).length&&!s)return!1;for(var d=c;d--;){var f=u[d];if(!(s?f in t:i.call(t,f)))return!1}var h=l.get(e),p=l.get(t);if(h&&p)return h==t&&p==e;var g=!0;l.set(e,t),l.set(t,e);for(var m=s;++d<c;){var v=e[f=u[d]],y=t[f];if(a)var b=s?a(y,v,f,t,e,l):a(v,y,f,e,t,l);if(!(void 0===b?v===y||o(v,y,n,a,l):b)){g=!1;break}m||(m="constructor"==f)}if(g&&!m){var x=e.constructor,w=t.constructor;x==w||!("constructor"in e)||!("constructor"in t)||"function"==typeof x&&x instanceof x&&"function"==typeof w&&w instanceof w||(g=!1)}return l.delete(e),l.delete(t),g}},function(e,t,n){var r=n(144),i=n(146),a=n(42);e.exports=function(e){return r(e,a,i)}},function(e,t,n){var r=n(145),i=n(14);e.exports=function(e,t,n){var a=t(e);return i(e)?a:r(a,n(e))}},function(e,t){e.exports=function(e,t){for(var n=-1,r=t.length,i=e.length;++n<r;)e[i+n]=t[n];return e}},function(e,t,n){var r=n(147),i=n(148),a=Object.prototype.propertyIsEnumerable,o=Object.getOwnPropertySymbols,l=o?function(e){return null==e?[]:(e=Object(e),r(o(e),(function(t){return a.call(e,t)})))}:i;e.exports=l},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length,i=0,a=[];++n<r;){var o=e[n];t(o,n,e)&&(a[i++]=o)}return a}},function(e,t){e.exports=function(){return[]}},function(e,t,n){var r=n(150),i=n(65),a=n(14),o=n(66),l=n(67),s=n(68),u=Object.prototype.hasOwnProperty;e.exports=function(e,t){var n=a(e),c=!n&&i(e),d=!n&&!c&&o(e),f=!n&&!c&&!d&&s(e),h=n||c||d||f,p=h?r(e.length,String):[],g=p.length;for(var m in e)!t&&!u.call(e,m)||h&&("length"==m||d&&("offset"==m||"parent"==m)||f&&("buffer"==m||"byteLength"==m||"byteOffset"==m)||l(m,g))||p.push(m);return p}},function(e,t){e.exports=function(e,t){for(var n=-1,r=Array(e);++n<e;)r[n]=t(n);return r}},function(e,t,n){var r=n(21),i=n(22);e.exports=function(e){return i(e)&&"[object Arguments]"==r(e)}},function(e,t){e.exports=function(){return!1}},function(e,t,n){var r=n(21),i=n(43),a=n(22),o={};o["[object Float32Array]"]=o["[object Float64Array]"]=o["[object Int8Array]"]=o["[object Int16Array]"]=o["[object Int32Array]"]=o["[object Uint8Array]"]=o["[object Uint8ClampedArray]"]=o["[object Uint16Array]"]=o["[object Uint32Array]"]=!0,o["[object Arguments]"]=o["[object Array]"]=o["[object ArrayBuffer]"]=o["[object Boolean]"]=o["[object DataView]"]=o["[object Date]"]=o["[object Error]"]=o["[object Function]"]=o["[object Map]"]=o["[object Number]"]=o["[object Object]"]=o["[object RegExp]"]=o["[object Set]"]=o["[object String]"]=o["[object WeakMap]"]=!1,e.exports=function(e){return a(e)&&i(e.length)&&!!o[r(e)]}},function(e,t){e.exports=function(e){return function(t){return e(t)}}},function(e,t,n){(function(e){var r=n(62),i=t&&!t.nodeType&&t,a=i&&"object"==typeof e&&e&&!e.nodeType&&e,o=a&&a.exports===i&&r.process,l=function(){try{var e=a&&a.require&&a.require("util").types;return e||o&&o.binding&&o.binding("util")}catch(t){}}();e.exports=l}).call(this,n(37)(e))},function(e,t,n){var r=n(157),i=n(158),a=Object.prototype.hasOwnProperty;e.exports=function(e){if(!r(e))return i(e);var t=[];for(var n in Object(e))a.call(e,n)&&"constructor"!=n&&t.push(n);return t}},function(e,t){var n=Object.prototype;e.exports=function(e){var t=e&&e.constructor;return e===("function"==typeof t&&t.prototype||n)}},function(e,t,n){var r=n(159)(Object.keys,Object);e.exports=r},function(e,t){e.exports=function(e,t){return function(n){return e(t(n))}}},function(e,t,n){var r=n(161),i=n(39),a=n(162),o=n(163),l=n(164),s=n(21),u=n(63),c="[object Map]",d="[object Promise]",f="[object Set]",h="[object WeakMap]",p="[object DataView]",g=u(r),m=u(i),v=u(a),y=u(o),b=u(l),x=s;(r&&x(new r(new ArrayBuffer(1)))!=p||i&&x(new i)!=c||a&&x(a.resolve())!=d||o&&x(new o)!=f||l&&x(new l)!=h)&&(x=function(e){var t=s(e),n="[object Object]"==t?e.constructor:void 0,r=n?u(n):"";if(r)switch(r){case g:return p;case m:return c;case v:return d;case y:return f;case b:return h}return t}),e.exports=x},function(e,t,n){var r=n(16)(n(13),"DataView");e.exports=r},function(e,t,n){var r=n(16)(n(13),"Promise");e.exports=r},function(e,t,n){var r=n(16)(n(13),"Set");e.exports=r},function(e,t,n){var r=n(16)(n(13),"WeakMap");e.exports=r},function(e,t,n){var r=n(166),i=n(168)((function(e,t,n){r(e,n,t)}));e.exports=i},function(e,t,n){var r=n(167);e.exports=function(e,t,n){"__proto__"==t&&r?r(e,t,{configurable:!0,enumerable:!0,value:n,writable:!0}):e[t]=n}},function(e,t,n){var r=n(16),i=function(){try{var e=r(Object,"defineProperty");return e({},"",{}),e}catch(t){}}();e.exports=i},function(e,t,n){var r=n(169),i=n(170),a=n(176),o=n(14);e.exports=function(e,t){return function(n,l){var s=o(n)?r:i,u=t?t():{};return s(n,e,a(l,2),u)}}},function(e,t){e.exports=function(e,t,n,r){for(var i=-1,a=null==e?0:e.length;++i<a;){var o=e[i];t(r,o,n(o),e)}return r}},function(e,t,n){var r=n(171);e.exports=function(e,t,n,i){return r(e,(function(e,r,a){t(i,e,n(e),a)})),i}},function(e,t,n){var r=n(172),i=n(175)(r);e.exports=i},function(e,t,n){var r=n(173),i=n(42);e.exports=function(e,t){return e&&r(e,t,i)}},function(e,t,n){var r=n(174)();e.exports=r},function(e,t){e.exports=function(e){return function(t,n,r){for(var i=-1,a=Object(t),o=r(t),l=o.length;l--;){var s=o[e?l:++i];if(!1===n(a[s],s,a))break}return t}}},function(e,t,n){var r=n(69);e.exports=function(e,t){return function(n,i){if(null==n)return n;if(!r(n))return e(n,i);for(var a=n.length,o=t?a:-1,l=Object(n);(t?o--:++o<a)&&!1!==i(l[o],o,l););return n}}},function(e,t,n){var r=n(177),i=n(180),a=n(191),o=n(14),l=n(192);e.exports=function(e){return"function"==typeof e?e:null==e?a:"object"==typeof e?o(e)?i(e[0],e[1]):r(e):l(e)}},function(e,t,n){var r=n(178),i=n(179),a=n(71);e.exports=function(e){var t=i(e);return 1==t.length&&t[0][2]?a(t[0][0],t[0][1]):function(n){return n===e||r(n,e,t)}}},function(e,t,n){var r=n(59),i=n(38);e.exports=function(e,t,n,a){var o=n.length,l=o,s=!a;if(null==e)return!l;for(e=Object(e);o--;){var u=n[o];if(s&&u[2]?u[1]!==e[u[0]]:!(u[0]in e))return!1}for(;++o<l;){var c=(u=n[o])[0],d=e[c],f=u[1];if(s&&u[2]){if(void 0===d&&!(c in e))return!1}else{var h=new r;if(a)var p=a(d,f,c,e,t,h);if(!(void 0===p?i(f,d,3,a,h):p))return!1}}return!0}},function(e,t,n){var r=n(70),i=n(42);e.exports=function(e){for(var t=i(e),n=t.length;n--;){var a=t[n],o=e[a];t[n]=[a,o,r(o)]}return t}},function(e,t,n){var r=n(38),i=n(181),a=n(188),o=n(44),l=n(70),s=n(71),u=n(29);e.exports=function(e,t){return o(e)&&l(t)?s(u(e),t):function(n){var o=i(n,e);return void 0===o&&o===t?a(n,e):r(t,o,3)}}},function(e,t,n){var r=n(72);e.exports=function(e,t,n){var i=null==e?void 0:r(e,t);return void 0===i?n:i}},function(e,t,n){var r=n(183),i=/[^.[\]]+|\[(?:(-?\d+(?:\.\d+)?)|(["'])((?:(?!\2)[^\\]|\\.)*?)\2)\]|(?=(?:\.|\[\])(?:\.|\[\]|$))/g,a=/\\(\\)?/g,o=r((function(e){var t=[];return 46===e.charCodeAt(0)&&t.push(""),e.replace(i,(function(e,n,r,i){t.push(r?i.replace(a,"$1"):n||e)})),t}));e.exports=o},function(e,t,n){var r=n(184);e.exports=function(e){var t=r(e,(function(e){return 500===n.size&&n.clear(),e})),n=t.cache;return t}},function(e,t,n){var r=n(41);function i(e,t){if("function"!=typeof e||null!=t&&"function"!=typeof t)throw new TypeError("Expected a function");var n=function n(){var r=arguments,i=t?t.apply(this,r):r[0],a=n.cache;if(a.has(i))return a.get(i);var o=e.apply(this,r);return n.cache=a.set(i,o)||a,o};return n.cache=new(i.Cache||r),n}i.Cache=r,e.exports=i},function(e,t,n){var r=n(186);e.exports=function(e){return null==e?"":r(e)}},function(e,t,n){var r=n(26),i=n(187),a=n(14),o=n(45),l=r?r.prototype:void 0,s=l?l.toString:void 0;e.exports=function e(t){if("string"==typeof t)return t;if(a(t))return i(t,e)+"";if(o(t))return s?s.call(t):"";var n=t+"";return"0"==n&&1/t==-Infinity?"-0":n}},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length,i=Array(r);++n<r;)i[n]=t(e[n],n,e);return i}},function(e,t,n){var r=n(189),i=n(190);e.exports=function(e,t){return null!=e&&i(e,t,r)}},function(e,t){e.exports=function(e,t){return null!=e&&t in Object(e)}},function(e,t,n){var r=n(73),i=n(65),a=n(14),o=n(67),l=n(43),s=n(29);e.exports=function(e,t,n){for(var u=-1,c=(t=r(t,e)).length,d=!1;++u<c;){var f=s(t[u]);if(!(d=null!=e&&n(e,f)))break;e=e[f]}return d||++u!=c?d:!!(c=null==e?0:e.length)&&l(c)&&o(f,c)&&(a(e)||i(e))}},function(e,t){e.exports=function(e){return e}},function(e,t,n){var r=n(193),i=n(194),a=n(44),o=n(29);e.exports=function(e){return a(e)?r(o(e)):i(e)}},function(e,t){e.exports=function(e){return function(t){return null==t?void 0:t[e]}}},function(e,t,n){var r=n(72);e.exports=function(e){return function(t){return r(t,e)}}},,function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={light:s.a.bool,dark:s.a.bool,full:s.a.bool,fixed:s.a.string,sticky:s.a.string,color:s.a.string,role:s.a.string,tag:d.i,className:s.a.string,cssModule:s.a.object,expand:s.a.oneOfType([s.a.bool,s.a.string])},h=function(e){var t,n=e.expand,a=e.className,l=e.cssModule,s=e.light,u=e.dark,f=e.fixed,h=e.sticky,p=e.color,g=e.tag,m=Object(i.a)(e,["expand","className","cssModule","light","dark","fixed","sticky","color","tag"]),v=Object(d.f)(c()(a,"navbar",function(e){return!1!==e&&(!0===e||"xs"===e?"navbar-expand":"navbar-expand-"+e)}(n),((t={"navbar-light":s,"navbar-dark":u})["bg-"+p]=p,t["fixed-"+f]=f,t["sticky-"+h]=h,t)),l);return o.a.createElement(g,Object(r.a)({},m,{className:v}))};h.propTypes=f,h.defaultProps={tag:"nav",expand:!1},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,fluid:s.a.oneOfType([s.a.bool,s.a.string]),className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.fluid,l=e.tag,s=Object(i.a)(e,["className","cssModule","fluid","tag"]),u="container";!0===a?u="container-fluid":a&&(u="container-"+a);var f=Object(d.f)(c()(t,u),n);return o.a.createElement(l,Object(r.a)({},s,{className:f}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,type:s.a.string,className:s.a.string,cssModule:s.a.object,children:s.a.node},h=function(e){var t=e.className,n=e.cssModule,a=e.children,l=e.tag,s=Object(i.a)(e,["className","cssModule","children","tag"]),u=Object(d.f)(c()(t,"navbar-toggler"),n);return o.a.createElement(l,Object(r.a)({"aria-label":"Toggle navigation"},s,{className:u}),a||o.a.createElement("span",{className:Object(d.f)("navbar-toggler-icon",n)}))};h.propTypes=f,h.defaultProps={tag:"button",type:"button"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"navbar-brand"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"a"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tabs:s.a.bool,pills:s.a.bool,vertical:s.a.oneOfType([s.a.bool,s.a.string]),horizontal:s.a.string,justified:s.a.bool,fill:s.a.bool,navbar:s.a.bool,card:s.a.bool,tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tabs,l=e.pills,s=e.vertical,u=e.horizontal,f=e.justified,h=e.fill,p=e.navbar,g=e.card,m=e.tag,v=Object(i.a)(e,["className","cssModule","tabs","pills","vertical","horizontal","justified","fill","navbar","card","tag"]),y=Object(d.f)(c()(t,p?"navbar-nav":"nav",!!u&&"justify-content-"+u,function(e){return!1!==e&&(!0===e||"xs"===e?"flex-column":"flex-"+e+"-column")}(s),{"nav-tabs":a,"card-header-tabs":g&&a,"nav-pills":l,"card-header-pills":g&&l,"nav-justified":f,"nav-fill":h}),n);return o.a.createElement(m,Object(r.a)({},v,{className:y}))};h.propTypes=f,h.defaultProps={tag:"ul",vertical:!1},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(3),p={tag:h.i,innerRef:c.a.oneOfType([c.a.object,c.a.func,c.a.string]),disabled:c.a.bool,active:c.a.bool,className:c.a.string,cssModule:c.a.object,onClick:c.a.func,href:c.a.any},g=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){this.props.disabled?e.preventDefault():("#"===this.props.href&&e.preventDefault(),this.props.onClick&&this.props.onClick(e))},n.render=function(){var e=this.props,t=e.className,n=e.cssModule,a=e.active,o=e.tag,l=e.innerRef,u=Object(i.a)(e,["className","cssModule","active","tag","innerRef"]),c=Object(h.f)(f()(t,"nav-link",{disabled:u.disabled,active:a}),n);return s.a.createElement(o,Object(r.a)({},u,{ref:l,onClick:this.onClick,className:c}))},t}(s.a.Component);g.propTypes=p,g.defaultProps={tag:"a"},t.a=g},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(50),f=n(5),h=n.n(f),p=n(31),g=n(3),m={a11y:c.a.bool,disabled:c.a.bool,direction:c.a.oneOf(["up","down","left","right"]),group:c.a.bool,isOpen:c.a.bool,nav:c.a.bool,active:c.a.bool,addonType:c.a.oneOfType([c.a.bool,c.a.oneOf(["prepend","append"])]),size:c.a.string,tag:g.i,toggle:c.a.func,children:c.a.node,className:c.a.string,cssModule:c.a.object,inNavbar:c.a.bool,setActiveFromChild:c.a.bool},v=[g.e.space,g.e.enter,g.e.up,g.e.down,g.e.end,g.e.home],y=function(e){function t(t){var n;return(n=e.call(this,t)||this).addEvents=n.addEvents.bind(Object(a.a)(n)),n.handleDocumentClick=n.handleDocumentClick.bind(Object(a.a)(n)),n.handleKeyDown=n.handleKeyDown.bind(Object(a.a)(n)),n.removeEvents=n.removeEvents.bind(Object(a.a)(n)),n.toggle=n.toggle.bind(Object(a.a)(n)),n.containerRef=s.a.createRef(),n}Object(o.a)(t,e);var n=t.prototype;return n.getContextValue=function(){return{toggle:this.toggle,isOpen:this.props.isOpen,direction:"down"===this.props.direction&&this.props.dropup?"up":this.props.direction,inNavbar:this.props.inNavbar,disabled:this.props.disabled}},n.componentDidMount=function(){this.handleProps()},n.componentDidUpdate=function(e){this.props.isOpen!==e.isOpen&&this.handleProps()},n.componentWillUnmount=function(){this.removeEvents()},n.getContainer=function(){return this.containerRef.current},n.getMenuCtrl=function(){return this._$menuCtrl||(this._$menuCtrl=this.getContainer().querySelector("[aria-expanded]")),this._$menuCtrl},n.getMenuItems=function(){return[].slice.call(this.getContainer().querySelectorAll('[role="menuitem"]'))},n.addEvents=function(){var e=this;["click","touchstart","keyup"].forEach((function(t){return document.addEventListener(t,e.handleDocumentClick,!0)}))},n.removeEvents=function(){var e=this;["click","touchstart","keyup"].forEach((function(t){return document.removeEventListener(t,e.handleDocumentClick,!0)}))},n.handleDocumentClick=function(e){if(!e||3!==e.which&&("keyup"!==e.type||e.which===g.e.tab)){var t=this.getContainer();(!t.contains(e.target)||t===e.target||"keyup"===e.type&&e.which!==g.e.tab)&&this.toggle(e)}},n.handleKeyDown=function(e){var t=this;if(!/input|textarea/i.test(e.target.tagName)&&(g.e.tab!==e.which||"menuitem"===e.target.getAttribute("role")&&this.props.a11y)&&((-1!==v.indexOf(e.which)||e.which>=48&&e.which<=90)&&e.preventDefault(),!this.props.disabled&&(this.getMenuCtrl()===e.target&&(!this.props.isOpen&&[g.e.space,g.e.enter,g.e.up,g.e.down].indexOf(e.which)>-1?(this.toggle(e),setTimeout((function(){return t.getMenuItems()[0].focus()}))):this.props.isOpen&&e.which===g.e.esc&&this.toggle(e)),this.props.isOpen&&"menuitem"===e.target.getAttribute("role"))))if([g.e.tab,g.e.esc].indexOf(e.which)>-1)this.toggle(e),this.getMenuCtrl().focus();else if([g.e.space,g.e.enter].indexOf(e.which)>-1)e.target.click(),this.getMenuCtrl().focus();else if([g.e.down,g.e.up].indexOf(e.which)>-1||[g.e.n,g.e.p].indexOf(e.which)>-1&&e.ctrlKey){var n=this.getMenuItems(),r=n.indexOf(e.target);g.e.up===e.which||g.e.p===e.which&&e.ctrlKey?r=0!==r?r-1:n.length-1:(g.e.down===e.which||g.e.n===e.which&&e.ctrlKey)&&(r=r===n.length-1?0:r+1),n[r].focus()}else if(g.e.end===e.which){var i=this.getMenuItems();i[i.length-1].focus()}else if(g.e.home===e.which){this.getMenuItems()[0].focus()}else if(e.which>=48&&e.which<=90)for(var a=this.getMenuItems(),o=String.fromCharCode(e.which).toLowerCase(),l=0;l<a.length;l+=1){if((a[l].textContent&&a[l].textContent[0].toLowerCase())===o){a[l].focus();break}}},n.handleProps=function(){this.props.isOpen?this.addEvents():this.removeEvents()},n.toggle=function(e){return this.props.disabled?e&&e.preventDefault():this.props.toggle(e)},n.render=function(){var e,t,n=Object(g.g)(this.props,["toggle","disabled","inNavbar","a11y"]),a=n.className,o=n.cssModule,l=n.direction,u=n.isOpen,c=n.group,f=n.size,m=n.nav,v=n.setActiveFromChild,y=n.active,b=n.addonType,x=n.tag,w=Object(i.a)(n,["className","cssModule","direction","isOpen","group","size","nav","setActiveFromChild","active","addonType","tag"]),_=x||(m?"li":"div"),k=!1;v&&s.a.Children.map(this.props.children[1].props.children,(function(e){e&&e.props.active&&(k=!0)}));var S=Object(g.f)(h()(a,"down"!==l&&"drop"+l,!(!m||!y)&&"active",!(!v||!k)&&"active",((e={})["input-group-"+b]=b,e["btn-group"]=c,e["btn-group-"+f]=!!f,e.dropdown=!c&&!b,e.show=u,e["nav-item"]=m,e)),o);return s.a.createElement(p.a.Provider,{value:this.getContextValue()},s.a.createElement(d.b,null,s.a.createElement(_,Object(r.a)({},w,((t={})["string"===typeof _?"ref":"innerRef"]=this.containerRef,t),{onKeyDown:this.handleKeyDown,className:S}))))},t}(s.a.Component);y.propTypes=m,y.defaultProps={a11y:!0,isOpen:!1,direction:"down",nav:!1,active:!1,addonType:!1,inNavbar:!1,setActiveFromChild:!1},t.a=y},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={color:s.a.string,pill:s.a.bool,tag:d.i,innerRef:s.a.oneOfType([s.a.object,s.a.func,s.a.string]),children:s.a.node,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.color,l=e.innerRef,s=e.pill,u=e.tag,f=Object(i.a)(e,["className","cssModule","color","innerRef","pill","tag"]),h=Object(d.f)(c()(t,"badge","badge-"+a,!!s&&"badge-pill"),n);return f.href&&"span"===u&&(u="a"),o.a.createElement(u,Object(r.a)({},f,{className:h,ref:l}))};h.propTypes=f,h.defaultProps={color:"secondary",pill:!1,tag:"span"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f=s.a.oneOfType([s.a.number,s.a.string]),h={tag:d.i,noGutters:s.a.bool,className:s.a.string,cssModule:s.a.object,form:s.a.bool,xs:f,sm:f,md:f,lg:f,xl:f},p={tag:"div",widths:["xs","sm","md","lg","xl"]},g=function(e){var t=e.className,n=e.cssModule,a=e.noGutters,l=e.tag,s=e.form,u=e.widths,f=Object(i.a)(e,["className","cssModule","noGutters","tag","form","widths"]),h=[];u.forEach((function(t,n){var r=e[t];if(delete f[t],r){var i=!n;h.push(i?"row-cols-"+r:"row-cols-"+t+"-"+r)}}));var p=Object(d.f)(c()(t,a?"no-gutters":null,s?"form-row":"row",h),n);return o.a.createElement(l,Object(r.a)({},f,{className:p}))};g.propTypes=h,g.defaultProps=p,t.a=g},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f=s.a.oneOfType([s.a.number,s.a.string]),h=s.a.oneOfType([s.a.bool,s.a.number,s.a.string,s.a.shape({size:s.a.oneOfType([s.a.bool,s.a.number,s.a.string]),order:f,offset:f})]),p={tag:d.i,xs:h,sm:h,md:h,lg:h,xl:h,className:s.a.string,cssModule:s.a.object,widths:s.a.array},g={tag:"div",widths:["xs","sm","md","lg","xl"]},m=function(e,t,n){return!0===n||""===n?e?"col":"col-"+t:"auto"===n?e?"col-auto":"col-"+t+"-auto":e?"col-"+n:"col-"+t+"-"+n},v=function(e){var t=e.className,n=e.cssModule,a=e.widths,l=e.tag,s=Object(i.a)(e,["className","cssModule","widths","tag"]),u=[];a.forEach((function(t,r){var i=e[t];if(delete s[t],i||""===i){var a=!r;if(Object(d.d)(i)){var o,l=a?"-":"-"+t+"-",f=m(a,t,i.size);u.push(Object(d.f)(c()(((o={})[f]=i.size||""===i.size,o["order"+l+i.order]=i.order||0===i.order,o["offset"+l+i.offset]=i.offset||0===i.offset,o)),n))}else{var h=m(a,t,i);u.push(h)}}})),u.length||u.push("col");var f=Object(d.f)(c()(t,u),n);return o.a.createElement(l,Object(r.a)({},s,{className:f}))};v.propTypes=p,v.defaultProps=g,t.a=v},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,inverse:s.a.bool,color:s.a.string,body:s.a.bool,outline:s.a.bool,className:s.a.string,cssModule:s.a.object,innerRef:s.a.oneOfType([s.a.object,s.a.string,s.a.func])},h=function(e){var t=e.className,n=e.cssModule,a=e.color,l=e.body,s=e.inverse,u=e.outline,f=e.tag,h=e.innerRef,p=Object(i.a)(e,["className","cssModule","color","body","inverse","outline","tag","innerRef"]),g=Object(d.f)(c()(t,"card",!!s&&"text-white",!!l&&"card-body",!!a&&(u?"border":"bg")+"-"+a),n);return o.a.createElement(f,Object(r.a)({},p,{className:g,ref:h}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"card-header"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"card-title"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,top:s.a.bool,bottom:s.a.bool,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.top,l=e.bottom,s=e.tag,u=Object(i.a)(e,["className","cssModule","top","bottom","tag"]),f="card-img";a&&(f="card-img-top"),l&&(f="card-img-bottom");var h=Object(d.f)(c()(t,f),n);return o.a.createElement(s,Object(r.a)({},u,{className:h}))};h.propTypes=f,h.defaultProps={tag:"img"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object,innerRef:s.a.oneOfType([s.a.object,s.a.string,s.a.func])},h=function(e){var t=e.className,n=e.cssModule,a=e.innerRef,l=e.tag,s=Object(i.a)(e,["className","cssModule","innerRef","tag"]),u=Object(d.f)(c()(t,"card-body"),n);return o.a.createElement(l,Object(r.a)({},s,{className:u,ref:a}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7);function l(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}var s,u=n(2),c=n.n(u),d=n(1),f=n.n(d),h=n(5),p=n.n(h),g=n(33),m=n(3);function v(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function y(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?v(Object(n),!0).forEach((function(t){l(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):v(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}var b=y(y({},g.Transition.propTypes),{},{isOpen:f.a.bool,children:f.a.oneOfType([f.a.arrayOf(f.a.node),f.a.node]),tag:m.i,className:f.a.node,navbar:f.a.bool,cssModule:f.a.object,innerRef:f.a.oneOfType([f.a.func,f.a.string,f.a.object])}),x=y(y({},g.Transition.defaultProps),{},{isOpen:!1,appear:!1,enter:!0,exit:!0,tag:"div",timeout:m.c.Collapse}),w=((s={})[m.b.ENTERING]="collapsing",s[m.b.ENTERED]="collapse show",s[m.b.EXITING]="collapsing",s[m.b.EXITED]="collapse",s);function _(e){return e.scrollHeight}var k=function(e){function t(t){var n;return(n=e.call(this,t)||this).state={height:null},["onEntering","onEntered","onExit","onExiting","onExited"].forEach((function(e){n[e]=n[e].bind(Object(a.a)(n))})),n}Object(o.a)(t,e);var n=t.prototype;return n.onEntering=function(e,t){this.setState({height:_(e)}),this.props.onEntering(e,t)},n.onEntered=function(e,t){this.setState({height:null}),this.props.onEntered(e,t)},n.onExit=function(e){this.setState({height:_(e)}),this.props.onExit(e)},n.onExiting=function(e){e.offsetHeight;this.setState({height:0}),this.props.onExiting(e)},n.onExited=function(e){this.setState({height:null}),this.props.onExited(e)},n.render=function(){var e=this,t=this.props,n=t.tag,a=t.isOpen,o=t.className,l=t.navbar,s=t.cssModule,u=t.children,d=(t.innerRef,Object(i.a)(t,["tag","isOpen","className","navbar","cssModule","children","innerRef"])),f=this.state.height,h=Object(m.h)(d,m.a),v=Object(m.g)(d,m.a);return c.a.createElement(g.Transition,Object(r.a)({},h,{in:a,onEntering:this.onEntering,onEntered:this.onEntered,onExit:this.onExit,onExiting:this.onExiting,onExited:this.onExited}),(function(t){var i=function(e){return w[e]||"collapse"}(t),a=Object(m.f)(p()(o,i,l&&"navbar-collapse"),s),d=null===f?null:{height:f};return c.a.createElement(n,Object(r.a)({},v,{style:y(y({},v.style),d),className:a,ref:e.props.innerRef}),u)}))},t}(u.Component);k.propTypes=b,k.defaultProps=x;t.a=k},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(76),p=n.n(h),g=n(32),m=n.n(g),v=n(15),y=n.n(v),b=n(23),x=n.n(b),w=n(47),_=n.n(w),k=n(50),S=function(e){if("function"===typeof e){for(var t=arguments.length,n=new Array(t>1?t-1:0),r=1;r<t;r++)n[r-1]=arguments[r];return e.apply(void 0,n)}},M=function(e,t){if("function"===typeof e)return S(e,t);null!=e&&(e.current=t)},C=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return t=e.call.apply(e,[this].concat(r))||this,x()(y()(y()(t)),"refHandler",(function(e){M(t.props.innerRef,e),S(t.props.setReferenceNode,e)})),t}m()(t,e);var n=t.prototype;return n.componentWillUnmount=function(){M(this.props.innerRef,null)},n.render=function(){return _()(Boolean(this.props.setReferenceNode),"`Reference` should not be used outside of a `Manager` component."),(e=this.props.children,Array.isArray(e)?e[0]:e)({ref:this.refHandler});var e},t}(l.Component);function E(e){return l.createElement(k.a.Consumer,null,(function(t){return l.createElement(C,p()({setReferenceNode:t},e))}))}var O=n(31),P=n(3),T=n(75),D={caret:c.a.bool,color:c.a.string,children:c.a.node,className:c.a.string,cssModule:c.a.object,disabled:c.a.bool,onClick:c.a.func,"aria-haspopup":c.a.bool,split:c.a.bool,tag:P.i,nav:c.a.bool},N=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){this.props.disabled||this.context.disabled?e.preventDefault():(this.props.nav&&!this.props.tag&&e.preventDefault(),this.props.onClick&&this.props.onClick(e),this.context.toggle(e))},n.render=function(){var e,t=this,n=this.props,a=n.className,o=n.color,l=n.cssModule,u=n.caret,c=n.split,d=n.nav,h=n.tag,p=n.innerRef,g=Object(i.a)(n,["className","color","cssModule","caret","split","nav","tag","innerRef"]),m=g["aria-label"]||"Toggle Dropdown",v=Object(P.f)(f()(a,{"dropdown-toggle":u||c,"dropdown-toggle-split":c,"nav-link":d}),l),y="undefined"!==typeof g.children?g.children:s.a.createElement("span",{className:"sr-only"},m);return d&&!h?(e="a",g.href="#"):h?e=h:(e=T.a,g.color=o,g.cssModule=l),this.context.inNavbar?s.a.createElement(e,Object(r.a)({},g,{className:v,onClick:this.onClick,"aria-expanded":this.context.isOpen,children:y})):s.a.createElement(E,{innerRef:p},(function(n){var i,a=n.ref;return s.a.createElement(e,Object(r.a)({},g,((i={})["string"===typeof e?"ref":"innerRef"]=a,i),{className:v,onClick:t.onClick,"aria-expanded":t.context.isOpen,children:y}))}))},t}(s.a.Component);N.propTypes=D,N.defaultProps={"aria-haspopup":!0,color:"secondary"},N.contextType=O.a;t.a=N}]]);
-//# sourceMappingURL=2.da35ac61.chunk.js.map
\ No newline at end of file
+(this["webpackJsonpblack-dashboard-react"]=this["webpackJsonpblack-dashboard-react"]||[]).push([[2],[function(e,t,n){"use strict";e.exports=n(87)},function(e,t,n){e.exports=n(88)()},function(e,t,n){"use strict";e.exports=n(79)},function(e,t,n){"use strict";n.d(t,"f",(function(){return o})),n.d(t,"g",(function(){return l})),n.d(t,"h",(function(){return s})),n.d(t,"i",(function(){return c})),n.d(t,"c",(function(){return d})),n.d(t,"a",(function(){return f})),n.d(t,"b",(function(){return h})),n.d(t,"e",(function(){return p})),n.d(t,"d",(function(){return g}));var r,i=n(1),a=n.n(i);function o(e,t){return void 0===e&&(e=""),void 0===t&&(t=r),t?e.split(" ").map((function(e){return t[e]||e})).join(" "):e}function l(e,t){var n={};return Object.keys(e).forEach((function(r){-1===t.indexOf(r)&&(n[r]=e[r])})),n}function s(e,t){for(var n,r=Array.isArray(t)?t:[t],i=r.length,a={};i>0;)a[n=r[i-=1]]=e[n];return a}var u="object"===typeof window&&window.Element||function(){};a.a.oneOfType([a.a.string,a.a.func,function(e,t,n){if(!(e[t]instanceof u))return new Error("Invalid prop `"+t+"` supplied to `"+n+"`. Expected prop to be an instance of Element. Validation failed.")},a.a.shape({current:a.a.any})]);var c=a.a.oneOfType([a.a.func,a.a.string,a.a.shape({$$typeof:a.a.symbol,render:a.a.func}),a.a.arrayOf(a.a.oneOfType([a.a.func,a.a.string,a.a.shape({$$typeof:a.a.symbol,render:a.a.func})]))]),d={Fade:150,Collapse:350,Modal:300,Carousel:600},f=["in","mountOnEnter","unmountOnExit","appear","enter","exit","timeout","onEnter","onEntering","onEntered","onExit","onExiting","onExited"],h={ENTERING:"entering",ENTERED:"entered",EXITING:"exiting",EXITED:"exited"},p={esc:27,space:32,enter:13,tab:9,up:38,down:40,home:36,end:35,n:78,p:80};"undefined"===typeof window||!window.document||window.document.createElement;function g(e){var t=typeof e;return null!=e&&("object"===t||"function"===t)}},function(e,t,n){"use strict";function r(){return(r=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}n.d(t,"a",(function(){return r}))},function(e,t,n){var r;!function(){"use strict";var n={}.hasOwnProperty;function i(){for(var e=[],t=0;t<arguments.length;t++){var r=arguments[t];if(r){var a=typeof r;if("string"===a||"number"===a)e.push(r);else if(Array.isArray(r)&&r.length){var o=i.apply(null,r);o&&e.push(o)}else if("object"===a)for(var l in r)n.call(r,l)&&r[l]&&e.push(l)}}return e.join(" ")}e.exports?(i.default=i,e.exports=i):void 0===(r=function(){return i}.apply(t,[]))||(e.exports=r)}()},function(e,t,n){"use strict";function r(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}n.d(t,"a",(function(){return r}))},function(e,t,n){"use strict";function r(e,t){return(r=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e})(e,t)}function i(e,t){e.prototype=Object.create(t.prototype),e.prototype.constructor=e,r(e,t)}n.d(t,"a",(function(){return i}))},function(e,t,n){"use strict";n.d(t,"a",(function(){return x})),n.d(t,"b",(function(){return S})),n.d(t,"c",(function(){return g})),n.d(t,"d",(function(){return T})),n.d(t,"e",(function(){return p})),n.d(t,"f",(function(){return k})),n.d(t,"g",(function(){return N}));var r=n(7),i=n(2),a=n.n(i),o=(n(1),n(12)),l=n(48),s=n(11),u=n(4),c=n(49),d=n.n(c),f=(n(56),n(6)),h=(n(74),function(e){var t=Object(l.a)();return t.displayName=e,t}("Router-History")),p=function(e){var t=Object(l.a)();return t.displayName=e,t}("Router"),g=function(e){function t(t){var n;return(n=e.call(this,t)||this).state={location:t.history.location},n._isMounted=!1,n._pendingLocation=null,t.staticContext||(n.unlisten=t.history.listen((function(e){n._isMounted?n.setState({location:e}):n._pendingLocation=e}))),n}Object(r.a)(t,e),t.computeRootMatch=function(e){return{path:"/",url:"/",params:{},isExact:"/"===e}};var n=t.prototype;return n.componentDidMount=function(){this._isMounted=!0,this._pendingLocation&&this.setState({location:this._pendingLocation})},n.componentWillUnmount=function(){this.unlisten&&this.unlisten()},n.render=function(){return a.a.createElement(p.Provider,{value:{history:this.props.history,location:this.state.location,match:t.computeRootMatch(this.state.location.pathname),staticContext:this.props.staticContext}},a.a.createElement(h.Provider,{children:this.props.children||null,value:this.props.history}))},t}(a.a.Component);a.a.Component;var m=function(e){function t(){return e.apply(this,arguments)||this}Object(r.a)(t,e);var n=t.prototype;return n.componentDidMount=function(){this.props.onMount&&this.props.onMount.call(this,this)},n.componentDidUpdate=function(e){this.props.onUpdate&&this.props.onUpdate.call(this,this,e)},n.componentWillUnmount=function(){this.props.onUnmount&&this.props.onUnmount.call(this,this)},n.render=function(){return null},t}(a.a.Component);var v={},y=0;function b(e,t){return void 0===e&&(e="/"),void 0===t&&(t={}),"/"===e?e:function(e){if(v[e])return v[e];var t=d.a.compile(e);return y<1e4&&(v[e]=t,y++),t}(e)(t,{pretty:!0})}function x(e){var t=e.computedMatch,n=e.to,r=e.push,i=void 0!==r&&r;return a.a.createElement(p.Consumer,null,(function(e){e||Object(s.a)(!1);var r=e.history,l=e.staticContext,c=i?r.push:r.replace,d=Object(o.c)(t?"string"===typeof n?b(n,t.params):Object(u.a)({},n,{pathname:b(n.pathname,t.params)}):n);return l?(c(d),null):a.a.createElement(m,{onMount:function(){c(d)},onUpdate:function(e,t){var n=Object(o.c)(t.to);Object(o.f)(n,Object(u.a)({},d,{key:n.key}))||c(d)},to:n})}))}var w={},_=0;function k(e,t){void 0===t&&(t={}),("string"===typeof t||Array.isArray(t))&&(t={path:t});var n=t,r=n.path,i=n.exact,a=void 0!==i&&i,o=n.strict,l=void 0!==o&&o,s=n.sensitive,u=void 0!==s&&s;return[].concat(r).reduce((function(t,n){if(!n&&""!==n)return null;if(t)return t;var r=function(e,t){var n=""+t.end+t.strict+t.sensitive,r=w[n]||(w[n]={});if(r[e])return r[e];var i=[],a={regexp:d()(e,i,t),keys:i};return _<1e4&&(r[e]=a,_++),a}(n,{end:a,strict:l,sensitive:u}),i=r.regexp,o=r.keys,s=i.exec(e);if(!s)return null;var c=s[0],f=s.slice(1),h=e===c;return a&&!h?null:{path:n,url:"/"===n&&""===c?"/":c,isExact:h,params:o.reduce((function(e,t,n){return e[t.name]=f[n],e}),{})}}),null)}var S=function(e){function t(){return e.apply(this,arguments)||this}return Object(r.a)(t,e),t.prototype.render=function(){var e=this;return a.a.createElement(p.Consumer,null,(function(t){t||Object(s.a)(!1);var n=e.props.location||t.location,r=e.props.computedMatch?e.props.computedMatch:e.props.path?k(n.pathname,e.props):t.match,i=Object(u.a)({},t,{location:n,match:r}),o=e.props,l=o.children,c=o.component,d=o.render;return Array.isArray(l)&&0===l.length&&(l=null),a.a.createElement(p.Provider,{value:i},i.match?l?"function"===typeof l?l(i):l:c?a.a.createElement(c,i):d?d(i):null:"function"===typeof l?l(i):null)}))},t}(a.a.Component);function M(e){return"/"===e.charAt(0)?e:"/"+e}function C(e,t){if(!e)return t;var n=M(e);return 0!==t.pathname.indexOf(n)?t:Object(u.a)({},t,{pathname:t.pathname.substr(n.length)})}function E(e){return"string"===typeof e?e:Object(o.e)(e)}function O(e){return function(){Object(s.a)(!1)}}function P(){}a.a.Component;var T=function(e){function t(){return e.apply(this,arguments)||this}return Object(r.a)(t,e),t.prototype.render=function(){var e=this;return a.a.createElement(p.Consumer,null,(function(t){t||Object(s.a)(!1);var n,r,i=e.props.location||t.location;return a.a.Children.forEach(e.props.children,(function(e){if(null==r&&a.a.isValidElement(e)){n=e;var o=e.props.path||e.props.from;r=o?k(i.pathname,Object(u.a)({},e.props,{path:o})):t.match}})),r?a.a.cloneElement(n,{location:i,computedMatch:r}):null}))},t}(a.a.Component);var D=a.a.useContext;function N(){return D(p).location}},function(e,t,n){"use strict";function r(e,t){(null==t||t>e.length)&&(t=e.length);for(var n=0,r=new Array(t);n<t;n++)r[n]=e[n];return r}function i(e,t){return function(e){if(Array.isArray(e))return e}(e)||function(e,t){if("undefined"!==typeof Symbol&&Symbol.iterator in Object(e)){var n=[],r=!0,i=!1,a=void 0;try{for(var o,l=e[Symbol.iterator]();!(r=(o=l.next()).done)&&(n.push(o.value),!t||n.length!==t);r=!0);}catch(s){i=!0,a=s}finally{try{r||null==l.return||l.return()}finally{if(i)throw a}}return n}}(e,t)||function(e,t){if(e){if("string"===typeof e)return r(e,t);var n=Object.prototype.toString.call(e).slice(8,-1);return"Object"===n&&e.constructor&&(n=e.constructor.name),"Map"===n||"Set"===n?Array.from(e):"Arguments"===n||/^(?:Ui|I)nt(?:8|16|32)(?:Clamped)?Array$/.test(n)?r(e,t):void 0}}(e,t)||function(){throw new TypeError("Invalid attempt to destructure non-iterable instance.\nIn order to be iterable, non-array objects must have a [Symbol.iterator]() method.")}()}n.d(t,"a",(function(){return i}))},function(e,t,n){"use strict";function r(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}n.d(t,"a",(function(){return r}))},function(e,t,n){"use strict";var r="Invariant failed";t.a=function(e,t){if(!e)throw new Error(r)}},function(e,t,n){"use strict";n.d(t,"a",(function(){return k})),n.d(t,"b",(function(){return P})),n.d(t,"d",(function(){return D})),n.d(t,"c",(function(){return g})),n.d(t,"f",(function(){return m})),n.d(t,"e",(function(){return p}));var r=n(4);function i(e){return"/"===e.charAt(0)}function a(e,t){for(var n=t,r=n+1,i=e.length;r<i;n+=1,r+=1)e[n]=e[r];e.pop()}var o=function(e,t){void 0===t&&(t="");var n,r=e&&e.split("/")||[],o=t&&t.split("/")||[],l=e&&i(e),s=t&&i(t),u=l||s;if(e&&i(e)?o=r:r.length&&(o.pop(),o=o.concat(r)),!o.length)return"/";if(o.length){var c=o[o.length-1];n="."===c||".."===c||""===c}else n=!1;for(var d=0,f=o.length;f>=0;f--){var h=o[f];"."===h?a(o,f):".."===h?(a(o,f),d++):d&&(a(o,f),d--)}if(!u)for(;d--;d)o.unshift("..");!u||""===o[0]||o[0]&&i(o[0])||o.unshift("");var p=o.join("/");return n&&"/"!==p.substr(-1)&&(p+="/"),p};function l(e){return e.valueOf?e.valueOf():Object.prototype.valueOf.call(e)}var s=function e(t,n){if(t===n)return!0;if(null==t||null==n)return!1;if(Array.isArray(t))return Array.isArray(n)&&t.length===n.length&&t.every((function(t,r){return e(t,n[r])}));if("object"===typeof t||"object"===typeof n){var r=l(t),i=l(n);return r!==t||i!==n?e(r,i):Object.keys(Object.assign({},t,n)).every((function(r){return e(t[r],n[r])}))}return!1},u=n(11);function c(e){return"/"===e.charAt(0)?e:"/"+e}function d(e){return"/"===e.charAt(0)?e.substr(1):e}function f(e,t){return function(e,t){return 0===e.toLowerCase().indexOf(t.toLowerCase())&&-1!=="/?#".indexOf(e.charAt(t.length))}(e,t)?e.substr(t.length):e}function h(e){return"/"===e.charAt(e.length-1)?e.slice(0,-1):e}function p(e){var t=e.pathname,n=e.search,r=e.hash,i=t||"/";return n&&"?"!==n&&(i+="?"===n.charAt(0)?n:"?"+n),r&&"#"!==r&&(i+="#"===r.charAt(0)?r:"#"+r),i}function g(e,t,n,i){var a;"string"===typeof e?(a=function(e){var t=e||"/",n="",r="",i=t.indexOf("#");-1!==i&&(r=t.substr(i),t=t.substr(0,i));var a=t.indexOf("?");return-1!==a&&(n=t.substr(a),t=t.substr(0,a)),{pathname:t,search:"?"===n?"":n,hash:"#"===r?"":r}}(e)).state=t:(void 0===(a=Object(r.a)({},e)).pathname&&(a.pathname=""),a.search?"?"!==a.search.charAt(0)&&(a.search="?"+a.search):a.search="",a.hash?"#"!==a.hash.charAt(0)&&(a.hash="#"+a.hash):a.hash="",void 0!==t&&void 0===a.state&&(a.state=t));try{a.pathname=decodeURI(a.pathname)}catch(l){throw l instanceof URIError?new URIError('Pathname "'+a.pathname+'" could not be decoded. This is likely caused by an invalid percent-encoding.'):l}return n&&(a.key=n),i?a.pathname?"/"!==a.pathname.charAt(0)&&(a.pathname=o(a.pathname,i.pathname)):a.pathname=i.pathname:a.pathname||(a.pathname="/"),a}function m(e,t){return e.pathname===t.pathname&&e.search===t.search&&e.hash===t.hash&&e.key===t.key&&s(e.state,t.state)}function v(){var e=null;var t=[];return{setPrompt:function(t){return e=t,function(){e===t&&(e=null)}},confirmTransitionTo:function(t,n,r,i){if(null!=e){var a="function"===typeof e?e(t,n):e;"string"===typeof a?"function"===typeof r?r(a,i):i(!0):i(!1!==a)}else i(!0)},appendListener:function(e){var n=!0;function r(){n&&e.apply(void 0,arguments)}return t.push(r),function(){n=!1,t=t.filter((function(e){return e!==r}))}},notifyListeners:function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];t.forEach((function(e){return e.apply(void 0,n)}))}}}var y=!("undefined"===typeof window||!window.document||!window.document.createElement);function b(e,t){t(window.confirm(e))}var x="popstate",w="hashchange";function _(){try{return window.history.state||{}}catch(e){return{}}}function k(e){void 0===e&&(e={}),y||Object(u.a)(!1);var t=window.history,n=function(){var e=window.navigator.userAgent;return(-1===e.indexOf("Android 2.")&&-1===e.indexOf("Android 4.0")||-1===e.indexOf("Mobile Safari")||-1!==e.indexOf("Chrome")||-1!==e.indexOf("Windows Phone"))&&window.history&&"pushState"in window.history}(),i=!(-1===window.navigator.userAgent.indexOf("Trident")),a=e,o=a.forceRefresh,l=void 0!==o&&o,s=a.getUserConfirmation,d=void 0===s?b:s,m=a.keyLength,k=void 0===m?6:m,S=e.basename?h(c(e.basename)):"";function M(e){var t=e||{},n=t.key,r=t.state,i=window.location,a=i.pathname+i.search+i.hash;return S&&(a=f(a,S)),g(a,r,n)}function C(){return Math.random().toString(36).substr(2,k)}var E=v();function O(e){Object(r.a)(W,e),W.length=t.length,E.notifyListeners(W.location,W.action)}function P(e){(function(e){return void 0===e.state&&-1===navigator.userAgent.indexOf("CriOS")})(e)||N(M(e.state))}function T(){N(M(_()))}var D=!1;function N(e){if(D)D=!1,O();else{E.confirmTransitionTo(e,"POP",d,(function(t){t?O({action:"POP",location:e}):function(e){var t=W.location,n=A.indexOf(t.key);-1===n&&(n=0);var r=A.indexOf(e.key);-1===r&&(r=0);var i=n-r;i&&(D=!0,L(i))}(e)}))}}var R=M(_()),A=[R.key];function I(e){return S+p(e)}function L(e){t.go(e)}var j=0;function F(e){1===(j+=e)&&1===e?(window.addEventListener(x,P),i&&window.addEventListener(w,T)):0===j&&(window.removeEventListener(x,P),i&&window.removeEventListener(w,T))}var z=!1;var W={length:t.length,action:"POP",location:R,createHref:I,push:function(e,r){var i="PUSH",a=g(e,r,C(),W.location);E.confirmTransitionTo(a,i,d,(function(e){if(e){var r=I(a),o=a.key,s=a.state;if(n)if(t.pushState({key:o,state:s},null,r),l)window.location.href=r;else{var u=A.indexOf(W.location.key),c=A.slice(0,u+1);c.push(a.key),A=c,O({action:i,location:a})}else window.location.href=r}}))},replace:function(e,r){var i="REPLACE",a=g(e,r,C(),W.location);E.confirmTransitionTo(a,i,d,(function(e){if(e){var r=I(a),o=a.key,s=a.state;if(n)if(t.replaceState({key:o,state:s},null,r),l)window.location.replace(r);else{var u=A.indexOf(W.location.key);-1!==u&&(A[u]=a.key),O({action:i,location:a})}else window.location.replace(r)}}))},go:L,goBack:function(){L(-1)},goForward:function(){L(1)},block:function(e){void 0===e&&(e=!1);var t=E.setPrompt(e);return z||(F(1),z=!0),function(){return z&&(z=!1,F(-1)),t()}},listen:function(e){var t=E.appendListener(e);return F(1),function(){F(-1),t()}}};return W}var S="hashchange",M={hashbang:{encodePath:function(e){return"!"===e.charAt(0)?e:"!/"+d(e)},decodePath:function(e){return"!"===e.charAt(0)?e.substr(1):e}},noslash:{encodePath:d,decodePath:c},slash:{encodePath:c,decodePath:c}};function C(e){var t=e.indexOf("#");return-1===t?e:e.slice(0,t)}function E(){var e=window.location.href,t=e.indexOf("#");return-1===t?"":e.substring(t+1)}function O(e){window.location.replace(C(window.location.href)+"#"+e)}function P(e){void 0===e&&(e={}),y||Object(u.a)(!1);var t=window.history,n=(window.navigator.userAgent.indexOf("Firefox"),e),i=n.getUserConfirmation,a=void 0===i?b:i,o=n.hashType,l=void 0===o?"slash":o,s=e.basename?h(c(e.basename)):"",d=M[l],m=d.encodePath,x=d.decodePath;function w(){var e=x(E());return s&&(e=f(e,s)),g(e)}var _=v();function k(e){Object(r.a)(W,e),W.length=t.length,_.notifyListeners(W.location,W.action)}var P=!1,T=null;function D(){var e=E(),t=m(e);if(e!==t)O(t);else{var n=w(),r=W.location;if(!P&&function(e,t){return e.pathname===t.pathname&&e.search===t.search&&e.hash===t.hash}(r,n))return;if(T===p(n))return;T=null,function(e){if(P)P=!1,k();else{var t="POP";_.confirmTransitionTo(e,t,a,(function(n){n?k({action:t,location:e}):function(e){var t=W.location,n=I.lastIndexOf(p(t));-1===n&&(n=0);var r=I.lastIndexOf(p(e));-1===r&&(r=0);var i=n-r;i&&(P=!0,L(i))}(e)}))}}(n)}}var N=E(),R=m(N);N!==R&&O(R);var A=w(),I=[p(A)];function L(e){t.go(e)}var j=0;function F(e){1===(j+=e)&&1===e?window.addEventListener(S,D):0===j&&window.removeEventListener(S,D)}var z=!1;var W={length:t.length,action:"POP",location:A,createHref:function(e){var t=document.querySelector("base"),n="";return t&&t.getAttribute("href")&&(n=C(window.location.href)),n+"#"+m(s+p(e))},push:function(e,t){var n="PUSH",r=g(e,void 0,void 0,W.location);_.confirmTransitionTo(r,n,a,(function(e){if(e){var t=p(r),i=m(s+t);if(E()!==i){T=t,function(e){window.location.hash=e}(i);var a=I.lastIndexOf(p(W.location)),o=I.slice(0,a+1);o.push(t),I=o,k({action:n,location:r})}else k()}}))},replace:function(e,t){var n="REPLACE",r=g(e,void 0,void 0,W.location);_.confirmTransitionTo(r,n,a,(function(e){if(e){var t=p(r),i=m(s+t);E()!==i&&(T=t,O(i));var a=I.indexOf(p(W.location));-1!==a&&(I[a]=t),k({action:n,location:r})}}))},go:L,goBack:function(){L(-1)},goForward:function(){L(1)},block:function(e){void 0===e&&(e=!1);var t=_.setPrompt(e);return z||(F(1),z=!0),function(){return z&&(z=!1,F(-1)),t()}},listen:function(e){var t=_.appendListener(e);return F(1),function(){F(-1),t()}}};return W}function T(e,t,n){return Math.min(Math.max(e,t),n)}function D(e){void 0===e&&(e={});var t=e,n=t.getUserConfirmation,i=t.initialEntries,a=void 0===i?["/"]:i,o=t.initialIndex,l=void 0===o?0:o,s=t.keyLength,u=void 0===s?6:s,c=v();function d(e){Object(r.a)(x,e),x.length=x.entries.length,c.notifyListeners(x.location,x.action)}function f(){return Math.random().toString(36).substr(2,u)}var h=T(l,0,a.length-1),m=a.map((function(e){return g(e,void 0,"string"===typeof e?f():e.key||f())})),y=p;function b(e){var t=T(x.index+e,0,x.entries.length-1),r=x.entries[t];c.confirmTransitionTo(r,"POP",n,(function(e){e?d({action:"POP",location:r,index:t}):d()}))}var x={length:m.length,action:"POP",location:m[h],index:h,entries:m,createHref:y,push:function(e,t){var r="PUSH",i=g(e,t,f(),x.location);c.confirmTransitionTo(i,r,n,(function(e){if(e){var t=x.index+1,n=x.entries.slice(0);n.length>t?n.splice(t,n.length-t,i):n.push(i),d({action:r,location:i,index:t,entries:n})}}))},replace:function(e,t){var r="REPLACE",i=g(e,t,f(),x.location);c.confirmTransitionTo(i,r,n,(function(e){e&&(x.entries[x.index]=i,d({action:r,location:i}))}))},go:b,goBack:function(){b(-1)},goForward:function(){b(1)},canGo:function(e){var t=x.index+e;return t>=0&&t<x.entries.length},block:function(e){return void 0===e&&(e=!1),c.setPrompt(e)},listen:function(e){return c.appendListener(e)}};return x}},function(e,t,n){var r=n(62),i="object"==typeof self&&self&&self.Object===Object&&self,a=r||i||Function("return this")();e.exports=a},function(e,t){var n=Array.isArray;e.exports=n},function(e,t){e.exports=function(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){var r=n(115),i=n(120);e.exports=function(e,t){var n=i(e,t);return r(n)?n:void 0}},function(e,t,n){"use strict";n.d(t,"a",(function(){return d})),n.d(t,"b",(function(){return v})),n.d(t,"c",(function(){return x}));var r=n(8),i=n(7),a=n(2),o=n.n(a),l=n(12),s=(n(1),n(4)),u=n(6),c=n(11);o.a.Component;var d=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).history=Object(l.b)(t.props),t}return Object(i.a)(t,e),t.prototype.render=function(){return o.a.createElement(r.c,{history:this.history,children:this.props.children})},t}(o.a.Component);var f=function(e,t){return"function"===typeof e?e(t):e},h=function(e,t){return"string"===typeof e?Object(l.c)(e,null,null,t):e},p=function(e){return e},g=o.a.forwardRef;"undefined"===typeof g&&(g=p);var m=g((function(e,t){var n=e.innerRef,r=e.navigate,i=e.onClick,a=Object(u.a)(e,["innerRef","navigate","onClick"]),l=a.target,c=Object(s.a)({},a,{onClick:function(e){try{i&&i(e)}catch(t){throw e.preventDefault(),t}e.defaultPrevented||0!==e.button||l&&"_self"!==l||function(e){return!!(e.metaKey||e.altKey||e.ctrlKey||e.shiftKey)}(e)||(e.preventDefault(),r())}});return c.ref=p!==g&&t||n,o.a.createElement("a",c)}));var v=g((function(e,t){var n=e.component,i=void 0===n?m:n,a=e.replace,l=e.to,d=e.innerRef,v=Object(u.a)(e,["component","replace","to","innerRef"]);return o.a.createElement(r.e.Consumer,null,(function(e){e||Object(c.a)(!1);var n=e.history,r=h(f(l,e.location),e.location),u=r?n.createHref(r):"",m=Object(s.a)({},v,{href:u,navigate:function(){var t=f(l,e.location);(a?n.replace:n.push)(t)}});return p!==g?m.ref=t||d:m.innerRef=d,o.a.createElement(i,m)}))})),y=function(e){return e},b=o.a.forwardRef;"undefined"===typeof b&&(b=y);var x=b((function(e,t){var n=e["aria-current"],i=void 0===n?"page":n,a=e.activeClassName,l=void 0===a?"active":a,d=e.activeStyle,p=e.className,g=e.exact,m=e.isActive,x=e.location,w=e.sensitive,_=e.strict,k=e.style,S=e.to,M=e.innerRef,C=Object(u.a)(e,["aria-current","activeClassName","activeStyle","className","exact","isActive","location","sensitive","strict","style","to","innerRef"]);return o.a.createElement(r.e.Consumer,null,(function(e){e||Object(c.a)(!1);var n=x||e.location,a=h(f(S,n),n),u=a.pathname,E=u&&u.replace(/([.+*?=^!:${}()[\]|/\\])/g,"\\$1"),O=E?Object(r.f)(n.pathname,{path:E,exact:g,sensitive:w,strict:_}):null,P=!!(m?m(O,n):O),T=P?function(){for(var e=arguments.length,t=new Array(e),n=0;n<e;n++)t[n]=arguments[n];return t.filter((function(e){return e})).join(" ")}(p,l):p,D=P?Object(s.a)({},k,{},d):k,N=Object(s.a)({"aria-current":P&&i||null,className:T,style:D,to:a},C);return y!==b?N.ref=t||M:N.innerRef=M,o.a.createElement(v,N)}))}))},,function(e,t,n){"use strict";(function(e){Object.defineProperty(t,"__esModule",{value:!0}),Object.defineProperty(t,"Chart",{enumerable:!0,get:function(){return a.default}}),t.defaults=t.Scatter=t.Bubble=t.Polar=t.Radar=t.HorizontalBar=t.Bar=t.Line=t.Pie=t.Doughnut=t.default=void 0;var r=s(n(2)),i=s(n(1)),a=s(n(57)),o=s(n(103)),l=s(n(165));function s(e){return e&&e.__esModule?e:{default:e}}function u(){return(u=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}function c(e){return(c="function"===typeof Symbol&&"symbol"===typeof Symbol.iterator?function(e){return typeof e}:function(e){return e&&"function"===typeof Symbol&&e.constructor===Symbol&&e!==Symbol.prototype?"symbol":typeof e})(e)}function d(e,t){if(null==e)return{};var n,r,i=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,t);if(Object.getOwnPropertySymbols){var a=Object.getOwnPropertySymbols(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||Object.prototype.propertyIsEnumerable.call(e,n)&&(i[n]=e[n])}return i}function f(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function h(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?f(Object(n),!0).forEach((function(t){k(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):f(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}function p(e,t){if(!(e instanceof t))throw new TypeError("Cannot call a class as a function")}function g(e,t){for(var n=0;n<t.length;n++){var r=t[n];r.enumerable=r.enumerable||!1,r.configurable=!0,"value"in r&&(r.writable=!0),Object.defineProperty(e,r.key,r)}}function m(e,t,n){return t&&g(e.prototype,t),n&&g(e,n),e}function v(e,t){if("function"!==typeof t&&null!==t)throw new TypeError("Super expression must either be null or a function");e.prototype=Object.create(t&&t.prototype,{constructor:{value:e,writable:!0,configurable:!0}}),t&&y(e,t)}function y(e,t){return(y=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e})(e,t)}function b(e){var t=function(){if("undefined"===typeof Reflect||!Reflect.construct)return!1;if(Reflect.construct.sham)return!1;if("function"===typeof Proxy)return!0;try{return Date.prototype.toString.call(Reflect.construct(Date,[],(function(){}))),!0}catch(e){return!1}}();return function(){var n,r=_(e);if(t){var i=_(this).constructor;n=Reflect.construct(r,arguments,i)}else n=r.apply(this,arguments);return x(this,n)}}function x(e,t){return!t||"object"!==c(t)&&"function"!==typeof t?w(e):t}function w(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}function _(e){return(_=Object.setPrototypeOf?Object.getPrototypeOf:function(e){return e.__proto__||Object.getPrototypeOf(e)})(e)}function k(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}var S="undefined"!==typeof e&&Object({NODE_ENV:"production",PUBLIC_URL:".",WDS_SOCKET_HOST:void 0,WDS_SOCKET_PATH:void 0,WDS_SOCKET_PORT:void 0,FAST_REFRESH:!0})&&"production",M=function(e){v(n,e);var t=b(n);function n(){var e;return p(this,n),k(w(e=t.call(this)),"handleOnClick",(function(t){var n=e.chartInstance,r=e.props,i=r.getDatasetAtEvent,a=r.getElementAtEvent,o=r.getElementsAtEvent,l=r.onElementsClick;i&&i(n.getDatasetAtEvent(t),t),a&&a(n.getElementAtEvent(t),t),o&&o(n.getElementsAtEvent(t),t),l&&l(n.getElementsAtEvent(t),t)})),k(w(e),"ref",(function(t){e.element=t})),e.chartInstance=void 0,e}return m(n,[{key:"componentDidMount",value:function(){this.renderChart()}},{key:"componentDidUpdate",value:function(){if(this.props.redraw)return this.destroyChart(),void this.renderChart();this.updateChart()}},{key:"shouldComponentUpdate",value:function(e){var t=this.props,n=(t.redraw,t.type),r=t.options,i=t.plugins,a=t.legend,l=t.height,s=t.width;if(!0===e.redraw)return!0;if(l!==e.height||s!==e.width)return!0;if(n!==e.type)return!0;if(!(0,o.default)(a,e.legend))return!0;if(!(0,o.default)(r,e.options))return!0;var u=this.transformDataProp(e);return!(0,o.default)(this.shadowDataProp,u)||!(0,o.default)(i,e.plugins)}},{key:"componentWillUnmount",value:function(){this.destroyChart()}},{key:"transformDataProp",value:function(e){var t=e.data;return"function"==typeof t?t(this.element):t}},{key:"memoizeDataProps",value:function(){if(this.props.data){var e=this.transformDataProp(this.props);return this.shadowDataProp=h(h({},e),{},{datasets:e.datasets&&e.datasets.map((function(e){return h({},e)}))}),this.saveCurrentDatasets(),e}}},{key:"checkDatasets",value:function(e){var t="production"!==S&&"prod"!==S,r=this.props.datasetKeyProvider!==n.getLabelAsKey,i=e.length>1;if(t&&i&&!r){var a=!1;e.forEach((function(e){e.label||(a=!0)})),a&&console.error('[react-chartjs-2] Warning: Each dataset needs a unique key. By default, the "label" property on each dataset is used. Alternatively, you may provide a "datasetKeyProvider" as a prop that returns a unique key.')}}},{key:"getCurrentDatasets",value:function(){return this.chartInstance&&this.chartInstance.config.data&&this.chartInstance.config.data.datasets||[]}},{key:"saveCurrentDatasets",value:function(){var e=this;this.datasets=this.datasets||{},this.getCurrentDatasets().forEach((function(t){e.datasets[e.props.datasetKeyProvider(t)]=t}))}},{key:"updateChart",value:function(){var e=this,t=this.props.options,n=this.memoizeDataProps(this.props);if(this.chartInstance){t&&(this.chartInstance.options=a.default.helpers.configMerge(this.chartInstance.options,t));var r=this.getCurrentDatasets(),i=n.datasets||[];this.checkDatasets(r);var o=(0,l.default)(r,this.props.datasetKeyProvider);this.chartInstance.config.data.datasets=i.map((function(t){var n=o[e.props.datasetKeyProvider(t)];if(n&&n.type===t.type&&t.data){n.data.splice(t.data.length),t.data.forEach((function(e,r){n.data[r]=t.data[r]}));t.data;var r=d(t,["data"]);return h(h({},n),r)}return t}));n.datasets;var s=d(n,["datasets"]);this.chartInstance.config.data=h(h({},this.chartInstance.config.data),s),this.chartInstance.update()}}},{key:"renderChart",value:function(){var e=this.props,t=e.options,r=e.legend,i=e.type,l=e.plugins,s=this.element,u=this.memoizeDataProps();"undefined"===typeof r||(0,o.default)(n.defaultProps.legend,r)||(t.legend=r),this.chartInstance=new a.default(s,{type:i,data:u,options:t,plugins:l})}},{key:"destroyChart",value:function(){if(this.chartInstance){this.saveCurrentDatasets();var e=Object.values(this.datasets);this.chartInstance.config.data.datasets=e,this.chartInstance.destroy()}}},{key:"render",value:function(){var e=this.props,t=e.height,n=e.width,i=e.id;return r.default.createElement("canvas",{ref:this.ref,height:t,width:n,id:i,onClick:this.handleOnClick})}}]),n}(r.default.Component);k(M,"getLabelAsKey",(function(e){return e.label})),k(M,"propTypes",{data:i.default.oneOfType([i.default.object,i.default.func]).isRequired,getDatasetAtEvent:i.default.func,getElementAtEvent:i.default.func,getElementsAtEvent:i.default.func,height:i.default.number,legend:i.default.object,onElementsClick:i.default.func,options:i.default.object,plugins:i.default.arrayOf(i.default.object),redraw:i.default.bool,type:function(e,t,n){if(!a.default.controllers[e[t]])return new Error("Invalid chart type `"+e[t]+"` supplied to `"+n+"`.")},width:i.default.number,datasetKeyProvider:i.default.func}),k(M,"defaultProps",{legend:{display:!0,position:"bottom"},type:"doughnut",height:150,width:300,redraw:!1,options:{},datasetKeyProvider:M.getLabelAsKey});var C=M;t.default=C;var E=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"doughnut"}))}}]),n}(r.default.Component);t.Doughnut=E;var O=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"pie"}))}}]),n}(r.default.Component);t.Pie=O;var P=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"line"}))}}]),n}(r.default.Component);t.Line=P;var T=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"bar"}))}}]),n}(r.default.Component);t.Bar=T;var D=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"horizontalBar"}))}}]),n}(r.default.Component);t.HorizontalBar=D;var N=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"radar"}))}}]),n}(r.default.Component);t.Radar=N;var R=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"polarArea"}))}}]),n}(r.default.Component);t.Polar=R;var A=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"bubble"}))}}]),n}(r.default.Component);t.Bubble=A;var I=function(e){v(n,e);var t=b(n);function n(){return p(this,n),t.apply(this,arguments)}return m(n,[{key:"render",value:function(){var e=this;return r.default.createElement(M,u({},this.props,{ref:function(t){return e.chartInstance=t&&t.chartInstance},type:"scatter"}))}}]),n}(r.default.Component);t.Scatter=I;var L=a.default.defaults;t.defaults=L}).call(this,n(102))},function(e,t,n){"use strict";function r(e){return getComputedStyle(e)}function i(e,t){for(var n in t){var r=t[n];"number"===typeof r&&(r+="px"),e.style[n]=r}return e}function a(e){var t=document.createElement("div");return t.className=e,t}var o="undefined"!==typeof Element&&(Element.prototype.matches||Element.prototype.webkitMatchesSelector||Element.prototype.mozMatchesSelector||Element.prototype.msMatchesSelector);function l(e,t){if(!o)throw new Error("No element matching method supported");return o.call(e,t)}function s(e){e.remove?e.remove():e.parentNode&&e.parentNode.removeChild(e)}function u(e,t){return Array.prototype.filter.call(e.children,(function(e){return l(e,t)}))}var c="ps",d="ps__rtl",f={thumb:function(e){return"ps__thumb-"+e},rail:function(e){return"ps__rail-"+e},consuming:"ps__child--consume"},h={focus:"ps--focus",clicking:"ps--clicking",active:function(e){return"ps--active-"+e},scrolling:function(e){return"ps--scrolling-"+e}},p={x:null,y:null};function g(e,t){var n=e.element.classList,r=h.scrolling(t);n.contains(r)?clearTimeout(p[t]):n.add(r)}function m(e,t){p[t]=setTimeout((function(){return e.isAlive&&e.element.classList.remove(h.scrolling(t))}),e.settings.scrollingThreshold)}var v=function(e){this.element=e,this.handlers={}},y={isEmpty:{configurable:!0}};v.prototype.bind=function(e,t){"undefined"===typeof this.handlers[e]&&(this.handlers[e]=[]),this.handlers[e].push(t),this.element.addEventListener(e,t,!1)},v.prototype.unbind=function(e,t){var n=this;this.handlers[e]=this.handlers[e].filter((function(r){return!(!t||r===t)||(n.element.removeEventListener(e,r,!1),!1)}))},v.prototype.unbindAll=function(){for(var e in this.handlers)this.unbind(e)},y.isEmpty.get=function(){var e=this;return Object.keys(this.handlers).every((function(t){return 0===e.handlers[t].length}))},Object.defineProperties(v.prototype,y);var b=function(){this.eventElements=[]};function x(e){if("function"===typeof window.CustomEvent)return new CustomEvent(e);var t=document.createEvent("CustomEvent");return t.initCustomEvent(e,!1,!1,void 0),t}function w(e,t,n,r,i){var a;if(void 0===r&&(r=!0),void 0===i&&(i=!1),"top"===t)a=["contentHeight","containerHeight","scrollTop","y","up","down"];else{if("left"!==t)throw new Error("A proper axis should be provided");a=["contentWidth","containerWidth","scrollLeft","x","left","right"]}!function(e,t,n,r,i){var a=n[0],o=n[1],l=n[2],s=n[3],u=n[4],c=n[5];void 0===r&&(r=!0);void 0===i&&(i=!1);var d=e.element;e.reach[s]=null,d[l]<1&&(e.reach[s]="start");d[l]>e[a]-e[o]-1&&(e.reach[s]="end");t&&(d.dispatchEvent(x("ps-scroll-"+s)),t<0?d.dispatchEvent(x("ps-scroll-"+u)):t>0&&d.dispatchEvent(x("ps-scroll-"+c)),r&&function(e,t){g(e,t),m(e,t)}(e,s));e.reach[s]&&(t||i)&&d.dispatchEvent(x("ps-"+s+"-reach-"+e.reach[s]))}(e,n,a,r,i)}function _(e){return parseInt(e,10)||0}b.prototype.eventElement=function(e){var t=this.eventElements.filter((function(t){return t.element===e}))[0];return t||(t=new v(e),this.eventElements.push(t)),t},b.prototype.bind=function(e,t,n){this.eventElement(e).bind(t,n)},b.prototype.unbind=function(e,t,n){var r=this.eventElement(e);r.unbind(t,n),r.isEmpty&&this.eventElements.splice(this.eventElements.indexOf(r),1)},b.prototype.unbindAll=function(){this.eventElements.forEach((function(e){return e.unbindAll()})),this.eventElements=[]},b.prototype.once=function(e,t,n){var r=this.eventElement(e);r.bind(t,(function e(i){r.unbind(t,e),n(i)}))};var k={isWebKit:"undefined"!==typeof document&&"WebkitAppearance"in document.documentElement.style,supportsTouch:"undefined"!==typeof window&&("ontouchstart"in window||"maxTouchPoints"in window.navigator&&window.navigator.maxTouchPoints>0||window.DocumentTouch&&document instanceof window.DocumentTouch),supportsIePointer:"undefined"!==typeof navigator&&navigator.msMaxTouchPoints,isChrome:"undefined"!==typeof navigator&&/Chrome/i.test(navigator&&navigator.userAgent)};function S(e){var t=e.element,n=Math.floor(t.scrollTop),r=t.getBoundingClientRect();e.containerWidth=Math.ceil(r.width),e.containerHeight=Math.ceil(r.height),e.contentWidth=t.scrollWidth,e.contentHeight=t.scrollHeight,t.contains(e.scrollbarXRail)||(u(t,f.rail("x")).forEach((function(e){return s(e)})),t.appendChild(e.scrollbarXRail)),t.contains(e.scrollbarYRail)||(u(t,f.rail("y")).forEach((function(e){return s(e)})),t.appendChild(e.scrollbarYRail)),!e.settings.suppressScrollX&&e.containerWidth+e.settings.scrollXMarginOffset<e.contentWidth?(e.scrollbarXActive=!0,e.railXWidth=e.containerWidth-e.railXMarginWidth,e.railXRatio=e.containerWidth/e.railXWidth,e.scrollbarXWidth=M(e,_(e.railXWidth*e.containerWidth/e.contentWidth)),e.scrollbarXLeft=_((e.negativeScrollAdjustment+t.scrollLeft)*(e.railXWidth-e.scrollbarXWidth)/(e.contentWidth-e.containerWidth))):e.scrollbarXActive=!1,!e.settings.suppressScrollY&&e.containerHeight+e.settings.scrollYMarginOffset<e.contentHeight?(e.scrollbarYActive=!0,e.railYHeight=e.containerHeight-e.railYMarginHeight,e.railYRatio=e.containerHeight/e.railYHeight,e.scrollbarYHeight=M(e,_(e.railYHeight*e.containerHeight/e.contentHeight)),e.scrollbarYTop=_(n*(e.railYHeight-e.scrollbarYHeight)/(e.contentHeight-e.containerHeight))):e.scrollbarYActive=!1,e.scrollbarXLeft>=e.railXWidth-e.scrollbarXWidth&&(e.scrollbarXLeft=e.railXWidth-e.scrollbarXWidth),e.scrollbarYTop>=e.railYHeight-e.scrollbarYHeight&&(e.scrollbarYTop=e.railYHeight-e.scrollbarYHeight),function(e,t){var n={width:t.railXWidth},r=Math.floor(e.scrollTop);t.isRtl?n.left=t.negativeScrollAdjustment+e.scrollLeft+t.containerWidth-t.contentWidth:n.left=e.scrollLeft;t.isScrollbarXUsingBottom?n.bottom=t.scrollbarXBottom-r:n.top=t.scrollbarXTop+r;i(t.scrollbarXRail,n);var a={top:r,height:t.railYHeight};t.isScrollbarYUsingRight?t.isRtl?a.right=t.contentWidth-(t.negativeScrollAdjustment+e.scrollLeft)-t.scrollbarYRight-t.scrollbarYOuterWidth-9:a.right=t.scrollbarYRight-e.scrollLeft:t.isRtl?a.left=t.negativeScrollAdjustment+e.scrollLeft+2*t.containerWidth-t.contentWidth-t.scrollbarYLeft-t.scrollbarYOuterWidth:a.left=t.scrollbarYLeft+e.scrollLeft;i(t.scrollbarYRail,a),i(t.scrollbarX,{left:t.scrollbarXLeft,width:t.scrollbarXWidth-t.railBorderXWidth}),i(t.scrollbarY,{top:t.scrollbarYTop,height:t.scrollbarYHeight-t.railBorderYWidth})}(t,e),e.scrollbarXActive?t.classList.add(h.active("x")):(t.classList.remove(h.active("x")),e.scrollbarXWidth=0,e.scrollbarXLeft=0,t.scrollLeft=!0===e.isRtl?e.contentWidth:0),e.scrollbarYActive?t.classList.add(h.active("y")):(t.classList.remove(h.active("y")),e.scrollbarYHeight=0,e.scrollbarYTop=0,t.scrollTop=0)}function M(e,t){return e.settings.minScrollbarLength&&(t=Math.max(t,e.settings.minScrollbarLength)),e.settings.maxScrollbarLength&&(t=Math.min(t,e.settings.maxScrollbarLength)),t}function C(e,t){var n=t[0],r=t[1],i=t[2],a=t[3],o=t[4],l=t[5],s=t[6],u=t[7],c=t[8],d=e.element,f=null,p=null,v=null;function y(t){t.touches&&t.touches[0]&&(t[i]=t.touches[0].pageY),d[s]=f+v*(t[i]-p),g(e,u),S(e),t.stopPropagation(),t.preventDefault()}function b(){m(e,u),e[c].classList.remove(h.clicking),e.event.unbind(e.ownerDocument,"mousemove",y)}function x(t,o){f=d[s],o&&t.touches&&(t[i]=t.touches[0].pageY),p=t[i],v=(e[r]-e[n])/(e[a]-e[l]),o?e.event.bind(e.ownerDocument,"touchmove",y):(e.event.bind(e.ownerDocument,"mousemove",y),e.event.once(e.ownerDocument,"mouseup",b),t.preventDefault()),e[c].classList.add(h.clicking),t.stopPropagation()}e.event.bind(e[o],"mousedown",(function(e){x(e)})),e.event.bind(e[o],"touchstart",(function(e){x(e,!0)}))}var E={"click-rail":function(e){e.element,e.event.bind(e.scrollbarY,"mousedown",(function(e){return e.stopPropagation()})),e.event.bind(e.scrollbarYRail,"mousedown",(function(t){var n=t.pageY-window.pageYOffset-e.scrollbarYRail.getBoundingClientRect().top>e.scrollbarYTop?1:-1;e.element.scrollTop+=n*e.containerHeight,S(e),t.stopPropagation()})),e.event.bind(e.scrollbarX,"mousedown",(function(e){return e.stopPropagation()})),e.event.bind(e.scrollbarXRail,"mousedown",(function(t){var n=t.pageX-window.pageXOffset-e.scrollbarXRail.getBoundingClientRect().left>e.scrollbarXLeft?1:-1;e.element.scrollLeft+=n*e.containerWidth,S(e),t.stopPropagation()}))},"drag-thumb":function(e){C(e,["containerWidth","contentWidth","pageX","railXWidth","scrollbarX","scrollbarXWidth","scrollLeft","x","scrollbarXRail"]),C(e,["containerHeight","contentHeight","pageY","railYHeight","scrollbarY","scrollbarYHeight","scrollTop","y","scrollbarYRail"])},keyboard:function(e){var t=e.element;e.event.bind(e.ownerDocument,"keydown",(function(n){if(!(n.isDefaultPrevented&&n.isDefaultPrevented()||n.defaultPrevented)&&(l(t,":hover")||l(e.scrollbarX,":focus")||l(e.scrollbarY,":focus"))){var r,i=document.activeElement?document.activeElement:e.ownerDocument.activeElement;if(i){if("IFRAME"===i.tagName)i=i.contentDocument.activeElement;else for(;i.shadowRoot;)i=i.shadowRoot.activeElement;if(l(r=i,"input,[contenteditable]")||l(r,"select,[contenteditable]")||l(r,"textarea,[contenteditable]")||l(r,"button,[contenteditable]"))return}var a=0,o=0;switch(n.which){case 37:a=n.metaKey?-e.contentWidth:n.altKey?-e.containerWidth:-30;break;case 38:o=n.metaKey?e.contentHeight:n.altKey?e.containerHeight:30;break;case 39:a=n.metaKey?e.contentWidth:n.altKey?e.containerWidth:30;break;case 40:o=n.metaKey?-e.contentHeight:n.altKey?-e.containerHeight:-30;break;case 32:o=n.shiftKey?e.containerHeight:-e.containerHeight;break;case 33:o=e.containerHeight;break;case 34:o=-e.containerHeight;break;case 36:o=e.contentHeight;break;case 35:o=-e.contentHeight;break;default:return}e.settings.suppressScrollX&&0!==a||e.settings.suppressScrollY&&0!==o||(t.scrollTop-=o,t.scrollLeft+=a,S(e),function(n,r){var i=Math.floor(t.scrollTop);if(0===n){if(!e.scrollbarYActive)return!1;if(0===i&&r>0||i>=e.contentHeight-e.containerHeight&&r<0)return!e.settings.wheelPropagation}var a=t.scrollLeft;if(0===r){if(!e.scrollbarXActive)return!1;if(0===a&&n<0||a>=e.contentWidth-e.containerWidth&&n>0)return!e.settings.wheelPropagation}return!0}(a,o)&&n.preventDefault())}}))},wheel:function(e){var t=e.element;function n(n){var i=function(e){var t=e.deltaX,n=-1*e.deltaY;return"undefined"!==typeof t&&"undefined"!==typeof n||(t=-1*e.wheelDeltaX/6,n=e.wheelDeltaY/6),e.deltaMode&&1===e.deltaMode&&(t*=10,n*=10),t!==t&&n!==n&&(t=0,n=e.wheelDelta),e.shiftKey?[-n,-t]:[t,n]}(n),a=i[0],o=i[1];if(!function(e,n,i){if(!k.isWebKit&&t.querySelector("select:focus"))return!0;if(!t.contains(e))return!1;for(var a=e;a&&a!==t;){if(a.classList.contains(f.consuming))return!0;var o=r(a);if(i&&o.overflowY.match(/(scroll|auto)/)){var l=a.scrollHeight-a.clientHeight;if(l>0&&(a.scrollTop>0&&i<0||a.scrollTop<l&&i>0))return!0}if(n&&o.overflowX.match(/(scroll|auto)/)){var s=a.scrollWidth-a.clientWidth;if(s>0&&(a.scrollLeft>0&&n<0||a.scrollLeft<s&&n>0))return!0}a=a.parentNode}return!1}(n.target,a,o)){var l=!1;e.settings.useBothWheelAxes?e.scrollbarYActive&&!e.scrollbarXActive?(o?t.scrollTop-=o*e.settings.wheelSpeed:t.scrollTop+=a*e.settings.wheelSpeed,l=!0):e.scrollbarXActive&&!e.scrollbarYActive&&(a?t.scrollLeft+=a*e.settings.wheelSpeed:t.scrollLeft-=o*e.settings.wheelSpeed,l=!0):(t.scrollTop-=o*e.settings.wheelSpeed,t.scrollLeft+=a*e.settings.wheelSpeed),S(e),(l=l||function(n,r){var i=Math.floor(t.scrollTop),a=0===t.scrollTop,o=i+t.offsetHeight===t.scrollHeight,l=0===t.scrollLeft,s=t.scrollLeft+t.offsetWidth===t.scrollWidth;return!(Math.abs(r)>Math.abs(n)?a||o:l||s)||!e.settings.wheelPropagation}(a,o))&&!n.ctrlKey&&(n.stopPropagation(),n.preventDefault())}}"undefined"!==typeof window.onwheel?e.event.bind(t,"wheel",n):"undefined"!==typeof window.onmousewheel&&e.event.bind(t,"mousewheel",n)},touch:function(e){if(k.supportsTouch||k.supportsIePointer){var t=e.element,n={},i=0,a={},o=null;k.supportsTouch?(e.event.bind(t,"touchstart",c),e.event.bind(t,"touchmove",d),e.event.bind(t,"touchend",h)):k.supportsIePointer&&(window.PointerEvent?(e.event.bind(t,"pointerdown",c),e.event.bind(t,"pointermove",d),e.event.bind(t,"pointerup",h)):window.MSPointerEvent&&(e.event.bind(t,"MSPointerDown",c),e.event.bind(t,"MSPointerMove",d),e.event.bind(t,"MSPointerUp",h)))}function l(n,r){t.scrollTop-=r,t.scrollLeft-=n,S(e)}function s(e){return e.targetTouches?e.targetTouches[0]:e}function u(e){return(!e.pointerType||"pen"!==e.pointerType||0!==e.buttons)&&(!(!e.targetTouches||1!==e.targetTouches.length)||!(!e.pointerType||"mouse"===e.pointerType||e.pointerType===e.MSPOINTER_TYPE_MOUSE))}function c(e){if(u(e)){var t=s(e);n.pageX=t.pageX,n.pageY=t.pageY,i=(new Date).getTime(),null!==o&&clearInterval(o)}}function d(o){if(u(o)){var c=s(o),d={pageX:c.pageX,pageY:c.pageY},h=d.pageX-n.pageX,p=d.pageY-n.pageY;if(function(e,n,i){if(!t.contains(e))return!1;for(var a=e;a&&a!==t;){if(a.classList.contains(f.consuming))return!0;var o=r(a);if(i&&o.overflowY.match(/(scroll|auto)/)){var l=a.scrollHeight-a.clientHeight;if(l>0&&(a.scrollTop>0&&i<0||a.scrollTop<l&&i>0))return!0}if(n&&o.overflowX.match(/(scroll|auto)/)){var s=a.scrollWidth-a.clientWidth;if(s>0&&(a.scrollLeft>0&&n<0||a.scrollLeft<s&&n>0))return!0}a=a.parentNode}return!1}(o.target,h,p))return;l(h,p),n=d;var g=(new Date).getTime(),m=g-i;m>0&&(a.x=h/m,a.y=p/m,i=g),function(n,r){var i=Math.floor(t.scrollTop),a=t.scrollLeft,o=Math.abs(n),l=Math.abs(r);if(l>o){if(r<0&&i===e.contentHeight-e.containerHeight||r>0&&0===i)return 0===window.scrollY&&r>0&&k.isChrome}else if(o>l&&(n<0&&a===e.contentWidth-e.containerWidth||n>0&&0===a))return!0;return!0}(h,p)&&o.preventDefault()}}function h(){e.settings.swipeEasing&&(clearInterval(o),o=setInterval((function(){e.isInitialized?clearInterval(o):a.x||a.y?Math.abs(a.x)<.01&&Math.abs(a.y)<.01?clearInterval(o):(l(30*a.x,30*a.y),a.x*=.8,a.y*=.8):clearInterval(o)}),10))}}},O=function(e,t){var n=this;if(void 0===t&&(t={}),"string"===typeof e&&(e=document.querySelector(e)),!e||!e.nodeName)throw new Error("no element is specified to initialize PerfectScrollbar");for(var o in this.element=e,e.classList.add(c),this.settings={handlers:["click-rail","drag-thumb","keyboard","wheel","touch"],maxScrollbarLength:null,minScrollbarLength:null,scrollingThreshold:1e3,scrollXMarginOffset:0,scrollYMarginOffset:0,suppressScrollX:!1,suppressScrollY:!1,swipeEasing:!0,useBothWheelAxes:!1,wheelPropagation:!0,wheelSpeed:1},t)this.settings[o]=t[o];this.containerWidth=null,this.containerHeight=null,this.contentWidth=null,this.contentHeight=null;var l=function(){return e.classList.add(h.focus)},s=function(){return e.classList.remove(h.focus)};this.isRtl="rtl"===r(e).direction,!0===this.isRtl&&e.classList.add(d),this.isNegativeScroll=function(){var t,n=e.scrollLeft;return e.scrollLeft=-1,t=e.scrollLeft<0,e.scrollLeft=n,t}(),this.negativeScrollAdjustment=this.isNegativeScroll?e.scrollWidth-e.clientWidth:0,this.event=new b,this.ownerDocument=e.ownerDocument||document,this.scrollbarXRail=a(f.rail("x")),e.appendChild(this.scrollbarXRail),this.scrollbarX=a(f.thumb("x")),this.scrollbarXRail.appendChild(this.scrollbarX),this.scrollbarX.setAttribute("tabindex",0),this.event.bind(this.scrollbarX,"focus",l),this.event.bind(this.scrollbarX,"blur",s),this.scrollbarXActive=null,this.scrollbarXWidth=null,this.scrollbarXLeft=null;var u=r(this.scrollbarXRail);this.scrollbarXBottom=parseInt(u.bottom,10),isNaN(this.scrollbarXBottom)?(this.isScrollbarXUsingBottom=!1,this.scrollbarXTop=_(u.top)):this.isScrollbarXUsingBottom=!0,this.railBorderXWidth=_(u.borderLeftWidth)+_(u.borderRightWidth),i(this.scrollbarXRail,{display:"block"}),this.railXMarginWidth=_(u.marginLeft)+_(u.marginRight),i(this.scrollbarXRail,{display:""}),this.railXWidth=null,this.railXRatio=null,this.scrollbarYRail=a(f.rail("y")),e.appendChild(this.scrollbarYRail),this.scrollbarY=a(f.thumb("y")),this.scrollbarYRail.appendChild(this.scrollbarY),this.scrollbarY.setAttribute("tabindex",0),this.event.bind(this.scrollbarY,"focus",l),this.event.bind(this.scrollbarY,"blur",s),this.scrollbarYActive=null,this.scrollbarYHeight=null,this.scrollbarYTop=null;var p=r(this.scrollbarYRail);this.scrollbarYRight=parseInt(p.right,10),isNaN(this.scrollbarYRight)?(this.isScrollbarYUsingRight=!1,this.scrollbarYLeft=_(p.left)):this.isScrollbarYUsingRight=!0,this.scrollbarYOuterWidth=this.isRtl?function(e){var t=r(e);return _(t.width)+_(t.paddingLeft)+_(t.paddingRight)+_(t.borderLeftWidth)+_(t.borderRightWidth)}(this.scrollbarY):null,this.railBorderYWidth=_(p.borderTopWidth)+_(p.borderBottomWidth),i(this.scrollbarYRail,{display:"block"}),this.railYMarginHeight=_(p.marginTop)+_(p.marginBottom),i(this.scrollbarYRail,{display:""}),this.railYHeight=null,this.railYRatio=null,this.reach={x:e.scrollLeft<=0?"start":e.scrollLeft>=this.contentWidth-this.containerWidth?"end":null,y:e.scrollTop<=0?"start":e.scrollTop>=this.contentHeight-this.containerHeight?"end":null},this.isAlive=!0,this.settings.handlers.forEach((function(e){return E[e](n)})),this.lastScrollTop=Math.floor(e.scrollTop),this.lastScrollLeft=e.scrollLeft,this.event.bind(this.element,"scroll",(function(e){return n.onScroll(e)})),S(this)};O.prototype.update=function(){this.isAlive&&(this.negativeScrollAdjustment=this.isNegativeScroll?this.element.scrollWidth-this.element.clientWidth:0,i(this.scrollbarXRail,{display:"block"}),i(this.scrollbarYRail,{display:"block"}),this.railXMarginWidth=_(r(this.scrollbarXRail).marginLeft)+_(r(this.scrollbarXRail).marginRight),this.railYMarginHeight=_(r(this.scrollbarYRail).marginTop)+_(r(this.scrollbarYRail).marginBottom),i(this.scrollbarXRail,{display:"none"}),i(this.scrollbarYRail,{display:"none"}),S(this),w(this,"top",0,!1,!0),w(this,"left",0,!1,!0),i(this.scrollbarXRail,{display:""}),i(this.scrollbarYRail,{display:""}))},O.prototype.onScroll=function(e){this.isAlive&&(S(this),w(this,"top",this.element.scrollTop-this.lastScrollTop),w(this,"left",this.element.scrollLeft-this.lastScrollLeft),this.lastScrollTop=Math.floor(this.element.scrollTop),this.lastScrollLeft=this.element.scrollLeft)},O.prototype.destroy=function(){this.isAlive&&(this.event.unbindAll(),s(this.scrollbarX),s(this.scrollbarY),s(this.scrollbarXRail),s(this.scrollbarYRail),this.removePsClasses(),this.element=null,this.scrollbarX=null,this.scrollbarY=null,this.scrollbarXRail=null,this.scrollbarYRail=null,this.isAlive=!1)},O.prototype.removePsClasses=function(){this.element.className=this.element.className.split(" ").filter((function(e){return!e.match(/^ps([-_].+|)$/)})).join(" ")},t.a=O},function(e,t,n){var r=n(26),i=n(116),a=n(117),o=r?r.toStringTag:void 0;e.exports=function(e){return null==e?void 0===e?"[object Undefined]":"[object Null]":o&&o in Object(e)?i(e):a(e)}},function(e,t){e.exports=function(e){return null!=e&&"object"==typeof e}},function(e,t){e.exports=function(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){var r=n(105),i=n(106),a=n(107),o=n(108),l=n(109);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(60);e.exports=function(e,t){for(var n=e.length;n--;)if(r(e[n][0],t))return n;return-1}},function(e,t,n){var r=n(13).Symbol;e.exports=r},function(e,t,n){var r=n(16)(Object,"create");e.exports=r},function(e,t,n){var r=n(129);e.exports=function(e,t){var n=e.__data__;return r(t)?n["string"==typeof t?"string":"hash"]:n.map}},function(e,t,n){var r=n(45);e.exports=function(e){if("string"==typeof e||r(e))return e;var t=e+"";return"0"==t&&1/e==-Infinity?"-0":t}},function(e,t,n){"use strict";!function e(){if("undefined"!==typeof __REACT_DEVTOOLS_GLOBAL_HOOK__&&"function"===typeof __REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE)try{__REACT_DEVTOOLS_GLOBAL_HOOK__.checkDCE(e)}catch(t){console.error(t)}}(),e.exports=n(80)},function(e,t,n){"use strict";n.d(t,"a",(function(){return i}));var r=n(2),i=n.n(r).a.createContext({})},function(e,t,n){var r=n(99);e.exports=function(e,t){e.prototype=Object.create(t.prototype),e.prototype.constructor=e,r(e,t)},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";var r=l(n(90)),i=l(n(95)),a=l(n(55)),o=l(n(52));function l(e){return e&&e.__esModule?e:{default:e}}e.exports={Transition:o.default,TransitionGroup:a.default,ReplaceTransition:i.default,CSSTransition:r.default}},,function(e,t,n){"use strict";var r=Object.getOwnPropertySymbols,i=Object.prototype.hasOwnProperty,a=Object.prototype.propertyIsEnumerable;function o(e){if(null===e||void 0===e)throw new TypeError("Object.assign cannot be called with null or undefined");return Object(e)}e.exports=function(){try{if(!Object.assign)return!1;var e=new String("abc");if(e[5]="de","5"===Object.getOwnPropertyNames(e)[0])return!1;for(var t={},n=0;n<10;n++)t["_"+String.fromCharCode(n)]=n;if("0123456789"!==Object.getOwnPropertyNames(t).map((function(e){return t[e]})).join(""))return!1;var r={};return"abcdefghijklmnopqrst".split("").forEach((function(e){r[e]=e})),"abcdefghijklmnopqrst"===Object.keys(Object.assign({},r)).join("")}catch(i){return!1}}()?Object.assign:function(e,t){for(var n,l,s=o(e),u=1;u<arguments.length;u++){for(var c in n=Object(arguments[u]))i.call(n,c)&&(s[c]=n[c]);if(r){l=r(n);for(var d=0;d<l.length;d++)a.call(n,l[d])&&(s[l[d]]=n[l[d]])}}return s}},function(e,t){var n;n=function(){return this}();try{n=n||new Function("return this")()}catch(r){"object"===typeof window&&(n=window)}e.exports=n},function(e,t){e.exports=function(e){return e.webpackPolyfill||(e.deprecate=function(){},e.paths=[],e.children||(e.children=[]),Object.defineProperty(e,"loaded",{enumerable:!0,get:function(){return e.l}}),Object.defineProperty(e,"id",{enumerable:!0,get:function(){return e.i}}),e.webpackPolyfill=1),e}},function(e,t,n){var r=n(104),i=n(22);e.exports=function e(t,n,a,o,l){return t===n||(null==t||null==n||!i(t)&&!i(n)?t!==t&&n!==n:r(t,n,a,o,e,l))}},function(e,t,n){var r=n(16)(n(13),"Map");e.exports=r},function(e,t){e.exports=function(e){var t=typeof e;return null!=e&&("object"==t||"function"==t)}},function(e,t,n){var r=n(121),i=n(128),a=n(130),o=n(131),l=n(132);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(149),i=n(156),a=n(69);e.exports=function(e){return a(e)?r(e):i(e)}},function(e,t){e.exports=function(e){return"number"==typeof e&&e>-1&&e%1==0&&e<=9007199254740991}},function(e,t,n){var r=n(14),i=n(45),a=/\.|\[(?:[^[\]]*|(["'])(?:(?!\1)[^\\]|\\.)*?\1)\]/,o=/^\w*$/;e.exports=function(e,t){if(r(e))return!1;var n=typeof e;return!("number"!=n&&"symbol"!=n&&"boolean"!=n&&null!=e&&!i(e))||(o.test(e)||!a.test(e)||null!=t&&e in Object(t))}},function(e,t,n){var r=n(21),i=n(22);e.exports=function(e){return"symbol"==typeof e||i(e)&&"[object Symbol]"==r(e)}},function(e,t,n){e.exports=function(e,t){"use strict";e=e&&e.hasOwnProperty("default")?e.default:e,t=t&&t.hasOwnProperty("default")?t.default:t;var n=e.helpers,r=function(){if("undefined"!==typeof window)return window.cancelAnimationFrame||window.webkitCancelAnimationFrame||window.mozCancelAnimationFrame||window.oCancelAnimationFrame||window.msCancelAnimationFrame||function(e){return window.clearTimeout(e)}}(),i={startFrameRefreshTimer:function(e,t){if(!e.frameRequestID){var r=function r(){t(),e.frameRequestID=n.requestAnimFrame.call(window,r)};e.frameRequestID=n.requestAnimFrame.call(window,r)}},stopFrameRefreshTimer:function(e){var t=e.frameRequestID;t&&(r.call(window,t),delete e.frameRequestID)}},a=e.helpers,o=a.canvas,l=e.scaleService,s=l.getScaleConstructor("time");l.getScaleConstructor=function(e){return"time"===e&&(e="realtime"),this.constructors.hasOwnProperty(e)?this.constructors[e]:void 0};var u={parse:function(e,n){return"string"===typeof e&&"string"===typeof n?e=t(e,n):e instanceof t||(e=t(e)),e.isValid()?e.valueOf():null}};function c(e,t){var n=e._adapter||u,r=e.options.time,i=r.parser,a=i||r.format,o=t;return"function"===typeof i&&(o=i(o)),("number"===typeof o||o instanceof Number)&&isFinite(o)||(o="string"===typeof a?n.parse(o,a):n.parse(o)),null!==o?+o:(i||"function"!==typeof a||("number"===typeof(o=a(t))||o instanceof Number)&&isFinite(o)||(o=n.parse(o)),o)}function d(e,t){if(a.isNullOrUndef(t))return null;var n=e.options.time,r=c(e,e.getRightValue(t));return null===r||n.round&&(r=+e._adapter.startOf(r,n.round)),r}function f(e,t){var n=e.options.realtime,r=e.chart.options.plugins.streaming;return a.valueOrDefault(n[t],r[t])}var h=["pointBackgroundColor","pointBorderColor","pointBorderWidth","pointRadius","pointRotation","pointStyle","pointHitRadius","pointHoverBackgroundColor","pointHoverBorderColor","pointHoverBorderWidth","pointHoverRadius","backgroundColor","borderColor","borderSkipped","borderWidth","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth","hoverRadius","hitRadius","radius","rotation"];function p(e){var t,n,r,i,o,l,s,u=e.chart,c=e.id,d=f(e,"duration"),p=f(e,"delay"),g=f(e,"ttl"),m=f(e,"pause"),v=f(e,"onRefresh"),y=e.max,b=Date.now()-(isNaN(g)?d+p:g);v&&v(u),u.data.datasets.forEach((function(d,f){if(t=u.getDatasetMeta(f),c===t.xAxisID||c===t.yAxisID){if(n=d.data,r=n.length,m){for(i=0;i<r&&e._getTimeForIndex(i,f)<y;++i);o=i+2}else o=0;for(i=o;i<r&&e._getTimeForIndex(i,f)<=b;++i);l=i-o,isNaN(g)&&(l=Math.max(l-2,0)),n.splice(o,l),h.forEach((function(e){d.hasOwnProperty(e)&&a.isArray(d[e])&&d[e].splice(o,l)})),a.each(d.datalabels,(function(e){a.isArray(e)&&e.splice(o,l)})),"object"!==typeof n[0]&&(s={start:o,count:l})}})),s&&u.data.labels.splice(s.start,s.count),u.update({preservation:!0})}function g(e){var t=e.realtime,n=t.refreshTimerID;n&&(clearInterval(n),delete t.refreshTimerID,delete t.refreshInterval)}function m(e){var t=e.realtime,n=f(e,"refresh");t.refreshTimerID=setInterval((function(){var n=f(e,"refresh");p(e),t.refreshInterval===n||isNaN(n)||(g(e),m(e))}),n),t.refreshInterval=n}var v={x:{data:["x","controlPointPreviousX","controlPointNextX"],dataset:["x"],tooltip:["x","caretX"]},y:{data:["y","controlPointPreviousY","controlPointNextY"],dataset:["y"],tooltip:["y","caretY"]}};function y(e,t,n){var r,i,a=e._start||{},o=e._view||{},l=e._model||{};for(r=0,i=t.length;r<i;++r){var s=t[r];a.hasOwnProperty(s)&&(a[s]-=n),o.hasOwnProperty(s)&&o!==a&&(o[s]-=n),l.hasOwnProperty(s)&&l!==o&&(l[s]-=n)}}function b(e){var t,n,r,i,o,l,s,u=e.chart,c=e.realtime,d=f(e,"duration"),h=f(e,"delay"),p=e.id,g=u.tooltip,m=g._active,b=Date.now();e.isHorizontal()?(t=e.width,n=v.x):(t=e.height,n=v.y),r=t*(b-c.head)/d,e.options.ticks.reverse&&(r=-r),a.each(u.data.datasets,(function(e,t){if(i=u.getDatasetMeta(t),p===i.xAxisID||p===i.yAxisID){for(o=i.data||[],l=0,s=o.length;l<s;++l)y(o[l],n.data,r);i.dataset&&y(i.dataset,n.dataset,r)}})),m&&m[0]&&(i=u.getDatasetMeta(m[0]._datasetIndex),p!==i.xAxisID&&p!==i.yAxisID||y(g,n.tooltip,r)),e.max=e._table[1].time=b-h,e.min=e._table[0].time=e.max-d,c.head=b}var x={position:"bottom",distribution:"linear",bounds:"data",adapters:{},time:{parser:!1,format:!1,unit:!1,round:!1,displayFormat:!1,isoWeekday:!1,minUnit:"millisecond",displayFormats:{millisecond:"h:mm:ss.SSS a",second:"h:mm:ss a",minute:"h:mm a",hour:"hA",day:"MMM D",week:"ll",month:"MMM YYYY",quarter:"[Q]Q - YYYY",year:"YYYY"}},realtime:{},ticks:{autoSkip:!1,source:"auto",major:{enabled:!0}}},w=s.extend({initialize:function(){var e=this;s.prototype.initialize.apply(e,arguments),("time"!==e.options.type||e.chart.options.plugins.streaming)&&(e.realtime=e.realtime||{},m(e))},update:function(){var e=this,t=e.realtime;return"time"!==e.options.type||e.chart.options.plugins.streaming?(f(e,"pause")?i.stopFrameRefreshTimer(t):(i.startFrameRefreshTimer(t,(function(){b(e)})),t.head=Date.now()),s.prototype.update.apply(e,arguments)):s.prototype.update.apply(e,arguments)},buildTicks:function(){var e=this,t=e.options;if("time"===t.type&&!e.chart.options.plugins.streaming)return s.prototype.buildTicks.apply(e,arguments);var n,r=t.time,i=t.ticks.major,o=f(e,"duration"),l=f(e,"delay"),u=f(e,"refresh"),c=t.bounds,d=t.distribution,h=t.offset,p=r.min,g=r.max,m=i.enabled,v=e.realtime.head-l,y=v-o,b=[v+u,v];return t.bounds=void 0,t.distribution="linear",t.offset=!1,r.min=-1e15,r.max=1e15,i.enabled=!0,Object.defineProperty(e,"min",{get:function(){return y},set:a.noop}),Object.defineProperty(e,"max",{get:function(){return b.shift()},set:a.noop}),n=s.prototype.buildTicks.apply(e,arguments),delete e.min,delete e.max,e.min=y,e.max=v,t.bounds=c,t.distribution=d,t.offset=h,r.min=p,r.max=g,i.enabled=m,e._table=[{time:y,pos:0},{time:v,pos:1}],n},fit:function(){var e=this,t=e.options;s.prototype.fit.apply(e,arguments),("time"!==t.type||e.chart.options.plugins.streaming)&&t.ticks.display&&t.display&&e.isHorizontal()&&(e.paddingLeft=3,e.paddingRight=3,e.handleMargins())},draw:function(e){var t=this,n=t.chart;if("time"!==t.options.type||n.options.plugins.streaming){var r=t.ctx,i=t.isHorizontal()?{left:e.left,top:0,right:e.right,bottom:n.height}:{left:0,top:e.top,right:n.width,bottom:e.bottom};o.clipArea(r,i),s.prototype.draw.apply(t,arguments),o.unclipArea(r)}else s.prototype.draw.apply(t,arguments)},destroy:function(){var e=this;("time"!==e.options.type||e.chart.options.plugins.streaming)&&(i.stopFrameRefreshTimer(e.realtime),g(e))},_getTimeForIndex:function(e,t){var n,r=this,i=r._timestamps,o=i.datasets[t][e];return a.isNullOrUndef(o)&&(n=r.chart.data.datasets[t].data[e],o=a.isObject(n)?d(r,n):d(r,i.labels[e])),o}});l.registerScaleType("realtime",w,x);var _=e.helpers,k=_.canvas;function S(t){var n,r,i,a,o=this,l=t&&t.preservation;l&&(n=o.tooltip,r=o.lastActive,i=n._lastActive,o._bufferedRender=!0),e.prototype.update.apply(o,arguments),l&&(o._bufferedRender=!1,o._bufferedRequest=null,o.lastActive=r,n._lastActive=i,o.animating?e.animationService.animations.forEach((function(e){e.chart===o&&o.render({duration:16.66*(e.numSteps-e.currentStep)})})):o.data.datasets.forEach((function(e,t){o.getDatasetMeta(t).controller.transition(1)})),n._active&&n.update(!0),(a=o.streaming.lastMouseEvent)&&o.eventHandler(a))}function M(e){var t=e.streaming,n=e.options.plugins.streaming.frameRate,r=1e3/(Math.max(n,0)||30),i=t.lastDrawn+r||0,a=Date.now(),o=t.lastMouseEvent;i<=a&&(e.animating||e.tooltip._start||e.draw(),o&&e.eventHandler(o),t.lastDrawn=i+r>a?i:a)}e.defaults.global.plugins.streaming={duration:1e4,delay:0,frameRate:30,refresh:1e3,onRefresh:null,pause:!1,ttl:void 0};var C={id:"streaming",beforeInit:function(e){var t=e.streaming=e.streaming||{},n=t.canvas=e.canvas,r=t.mouseEventListener=function(n){var r=_.getRelativePosition(n,e);t.lastMouseEvent={type:"mousemove",chart:e,native:n,x:r.x,y:r.y}};n.addEventListener("mousedown",r),n.addEventListener("mouseup",r)},afterInit:function(t){t.update=S,t.resetZoom&&e.Zoom.updateResetZoom(t)},beforeUpdate:function(e){var t=e.options,n=t.scales;return n&&n.xAxes.concat(n.yAxes).forEach((function(e){"realtime"!==e.type&&"time"!==e.type||(t.elements.line.capBezierPoints=!1)})),!0},afterUpdate:function(e,t){var n=e.streaming,r=!0;_.each(e.scales,(function(e){e instanceof w&&(r&=_.valueOrDefault(e.options.realtime.pause,t.pause))})),r?i.stopFrameRefreshTimer(n):i.startFrameRefreshTimer(n,(function(){M(e)}))},beforeDatasetDraw:function(e,t){var n=t.meta,r=e.chartArea,i={left:0,top:0,right:e.width,bottom:e.height};return n.xAxisID&&n.controller.getScaleForId(n.xAxisID)instanceof w&&(i.left=r.left,i.right=r.right),n.yAxisID&&n.controller.getScaleForId(n.yAxisID)instanceof w&&(i.top=r.top,i.bottom=r.bottom),k.clipArea(e.ctx,i),!0},afterDatasetDraw:function(e){k.unclipArea(e.ctx)},beforeEvent:function(e,t){var n=e.streaming;return"mousemove"===t.type?n.lastMouseEvent=t:"mouseout"===t.type&&delete n.lastMouseEvent,!0},destroy:function(e){var t=e.streaming,n=t.canvas,r=t.mouseEventListener;i.stopFrameRefreshTimer(t),n.removeEventListener("mousedown",r),n.removeEventListener("mouseup",r),_.each(e.scales,(function(e){e instanceof w&&e.destroy()}))}},E=e.helpers,O=e.Zoom=e.Zoom||{};function P(e,t){if(e.scaleAxes&&e.rangeMax&&!E.isNullOrUndef(e.rangeMax[e.scaleAxes])){var n=e.rangeMax[e.scaleAxes];t>n&&(t=n)}return t}function T(e,t){if(e.scaleAxes&&e.rangeMin&&!E.isNullOrUndef(e.rangeMin[e.scaleAxes])){var n=e.rangeMin[e.scaleAxes];t<n&&(t=n)}return t}function D(e,t,n,r){var i,a,o=e.options.realtime,l=e.chart.options.plugins.streaming,s=E.valueOrDefault(o.duration,l.duration),u=E.valueOrDefault(o.delay,l.delay),c=s*(2-t);i=e.isHorizontal()?(e.right-n.x)/(e.right-e.left):(e.bottom-n.y)/(e.bottom-e.top),a=t<1?P(r,c):T(r,c),o.duration=a,o.delay=u+i*(s-a)}function N(e,t,n){var r=e.options.realtime,i=e.chart.options.plugins.streaming,a=E.valueOrDefault(r.delay,i.delay)+(e.getValueForPixel(t)-e.getValueForPixel(0));r.delay=t>0?P(n,a):T(n,a)}function R(e){var t=e.$zoom||{_originalOptions:{}},n=e.resetZoom,r=e.update,i=function(){E.each(e.scales,(function(e){var n=e.options.realtime,r=t._originalOptions[e.id]||e.originalOptions;n&&(r?(n.duration=r.realtime.duration,n.delay=r.realtime.delay):(delete n.duration,delete n.delay))})),r.call(e,{duration:0})};e.resetZoom=function(){e.update=i,n(),e.update=r}}return O.zoomFunctions=O.zoomFunctions||{},O.panFunctions=O.panFunctions||{},O.zoomFunctions.realtime=D,O.panFunctions.realtime=N,O.updateResetZoom=R,e.helpers.streaming=i,e.plugins.register(C),C}(n(57),n(58))},function(e,t,n){"use strict";var r=function(){};e.exports=r},function(e,t,n){"use strict";(function(e){var r=n(2),i=n.n(r),a=n(7),o=n(1),l=n.n(o),s=1073741823,u="undefined"!==typeof globalThis?globalThis:"undefined"!==typeof window?window:"undefined"!==typeof e?e:{};function c(e){var t=[];return{on:function(e){t.push(e)},off:function(e){t=t.filter((function(t){return t!==e}))},get:function(){return e},set:function(n,r){e=n,t.forEach((function(t){return t(e,r)}))}}}var d=i.a.createContext||function(e,t){var n,i,o="__create-react-context-"+function(){var e="__global_unique_id__";return u[e]=(u[e]||0)+1}()+"__",d=function(e){function n(){var t;return(t=e.apply(this,arguments)||this).emitter=c(t.props.value),t}Object(a.a)(n,e);var r=n.prototype;return r.getChildContext=function(){var e;return(e={})[o]=this.emitter,e},r.componentWillReceiveProps=function(e){if(this.props.value!==e.value){var n,r=this.props.value,i=e.value;((a=r)===(o=i)?0!==a||1/a===1/o:a!==a&&o!==o)?n=0:(n="function"===typeof t?t(r,i):s,0!==(n|=0)&&this.emitter.set(e.value,n))}var a,o},r.render=function(){return this.props.children},n}(r.Component);d.childContextTypes=((n={})[o]=l.a.object.isRequired,n);var f=function(t){function n(){var e;return(e=t.apply(this,arguments)||this).state={value:e.getValue()},e.onUpdate=function(t,n){0!==((0|e.observedBits)&n)&&e.setState({value:e.getValue()})},e}Object(a.a)(n,t);var r=n.prototype;return r.componentWillReceiveProps=function(e){var t=e.observedBits;this.observedBits=void 0===t||null===t?s:t},r.componentDidMount=function(){this.context[o]&&this.context[o].on(this.onUpdate);var e=this.props.observedBits;this.observedBits=void 0===e||null===e?s:e},r.componentWillUnmount=function(){this.context[o]&&this.context[o].off(this.onUpdate)},r.getValue=function(){return this.context[o]?this.context[o].get():e},r.render=function(){return(e=this.props.children,Array.isArray(e)?e[0]:e)(this.state.value);var e},n}(r.Component);return f.contextTypes=((i={})[o]=l.a.object,i),{Provider:d,Consumer:f}};t.a=d}).call(this,n(36))},function(e,t,n){var r=n(97);e.exports=h,e.exports.parse=a,e.exports.compile=function(e,t){return l(a(e,t),t)},e.exports.tokensToFunction=l,e.exports.tokensToRegExp=f;var i=new RegExp(["(\\\\.)","([\\/.])?(?:(?:\\:(\\w+)(?:\\(((?:\\\\.|[^\\\\()])+)\\))?|\\(((?:\\\\.|[^\\\\()])+)\\))([+*?])?|(\\*))"].join("|"),"g");function a(e,t){for(var n,r=[],a=0,o=0,l="",c=t&&t.delimiter||"/";null!=(n=i.exec(e));){var d=n[0],f=n[1],h=n.index;if(l+=e.slice(o,h),o=h+d.length,f)l+=f[1];else{var p=e[o],g=n[2],m=n[3],v=n[4],y=n[5],b=n[6],x=n[7];l&&(r.push(l),l="");var w=null!=g&&null!=p&&p!==g,_="+"===b||"*"===b,k="?"===b||"*"===b,S=n[2]||c,M=v||y;r.push({name:m||a++,prefix:g||"",delimiter:S,optional:k,repeat:_,partial:w,asterisk:!!x,pattern:M?u(M):x?".*":"[^"+s(S)+"]+?"})}}return o<e.length&&(l+=e.substr(o)),l&&r.push(l),r}function o(e){return encodeURI(e).replace(/[\/?#]/g,(function(e){return"%"+e.charCodeAt(0).toString(16).toUpperCase()}))}function l(e,t){for(var n=new Array(e.length),i=0;i<e.length;i++)"object"===typeof e[i]&&(n[i]=new RegExp("^(?:"+e[i].pattern+")$",d(t)));return function(t,i){for(var a="",l=t||{},s=(i||{}).pretty?o:encodeURIComponent,u=0;u<e.length;u++){var c=e[u];if("string"!==typeof c){var d,f=l[c.name];if(null==f){if(c.optional){c.partial&&(a+=c.prefix);continue}throw new TypeError('Expected "'+c.name+'" to be defined')}if(r(f)){if(!c.repeat)throw new TypeError('Expected "'+c.name+'" to not repeat, but received `'+JSON.stringify(f)+"`");if(0===f.length){if(c.optional)continue;throw new TypeError('Expected "'+c.name+'" to not be empty')}for(var h=0;h<f.length;h++){if(d=s(f[h]),!n[u].test(d))throw new TypeError('Expected all "'+c.name+'" to match "'+c.pattern+'", but received `'+JSON.stringify(d)+"`");a+=(0===h?c.prefix:c.delimiter)+d}}else{if(d=c.asterisk?encodeURI(f).replace(/[?#]/g,(function(e){return"%"+e.charCodeAt(0).toString(16).toUpperCase()})):s(f),!n[u].test(d))throw new TypeError('Expected "'+c.name+'" to match "'+c.pattern+'", but received "'+d+'"');a+=c.prefix+d}}else a+=c}return a}}function s(e){return e.replace(/([.+*?=^!:${}()[\]|\/\\])/g,"\\$1")}function u(e){return e.replace(/([=!:$\/()])/g,"\\$1")}function c(e,t){return e.keys=t,e}function d(e){return e&&e.sensitive?"":"i"}function f(e,t,n){r(t)||(n=t||n,t=[]);for(var i=(n=n||{}).strict,a=!1!==n.end,o="",l=0;l<e.length;l++){var u=e[l];if("string"===typeof u)o+=s(u);else{var f=s(u.prefix),h="(?:"+u.pattern+")";t.push(u),u.repeat&&(h+="(?:"+f+h+")*"),o+=h=u.optional?u.partial?f+"("+h+")?":"(?:"+f+"("+h+"))?":f+"("+h+")"}}var p=s(n.delimiter||"/"),g=o.slice(-p.length)===p;return i||(o=(g?o.slice(0,-p.length):o)+"(?:"+p+"(?=$))?"),o+=a?"$":i&&g?"":"(?="+p+"|$)",c(new RegExp("^"+o,d(n)),t)}function h(e,t,n){return r(t)||(n=t||n,t=[]),n=n||{},e instanceof RegExp?function(e,t){var n=e.source.match(/\((?!\?)/g);if(n)for(var r=0;r<n.length;r++)t.push({name:r,prefix:null,delimiter:null,optional:!1,repeat:!1,partial:!1,asterisk:!1,pattern:null});return c(e,t)}(e,t):r(e)?function(e,t,n){for(var r=[],i=0;i<e.length;i++)r.push(h(e[i],t,n).source);return c(new RegExp("(?:"+r.join("|")+")",d(n)),t)}(e,t,n):function(e,t,n){return f(a(e,n),t,n)}(e,t,n)}},function(e,t,n){"use strict";n.d(t,"a",(function(){return h})),n.d(t,"b",(function(){return p}));var r=n(32),i=n.n(r),a=n(15),o=n.n(a),l=n(23),s=n.n(l),u=n(2),c=n(51),d=n.n(c),f=d()(),h=d()(),p=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return t=e.call.apply(e,[this].concat(r))||this,s()(o()(o()(t)),"referenceNode",void 0),s()(o()(o()(t)),"setReferenceNode",(function(e){e&&t.referenceNode!==e&&(t.referenceNode=e,t.forceUpdate())})),t}i()(t,e);var n=t.prototype;return n.componentWillUnmount=function(){this.referenceNode=null},n.render=function(){return u.createElement(f.Provider,{value:this.referenceNode},u.createElement(h.Provider,{value:this.setReferenceNode},this.props.children))},t}(u.Component)},function(e,t,n){"use strict";t.__esModule=!0;var r=a(n(2)),i=a(n(100));function a(e){return e&&e.__esModule?e:{default:e}}t.default=r.default.createContext||i.default,e.exports=t.default},function(e,t,n){"use strict";t.__esModule=!0,t.default=t.EXITING=t.ENTERED=t.ENTERING=t.EXITED=t.UNMOUNTED=void 0;var r=function(e){if(e&&e.__esModule)return e;var t={};if(null!=e)for(var n in e)if(Object.prototype.hasOwnProperty.call(e,n)){var r=Object.defineProperty&&Object.getOwnPropertyDescriptor?Object.getOwnPropertyDescriptor(e,n):{};r.get||r.set?Object.defineProperty(t,n,r):t[n]=e[n]}return t.default=e,t}(n(1)),i=l(n(2)),a=l(n(30)),o=n(53);n(54);function l(e){return e&&e.__esModule?e:{default:e}}var s="unmounted";t.UNMOUNTED=s;var u="exited";t.EXITED=u;var c="entering";t.ENTERING=c;var d="entered";t.ENTERED=d;var f="exiting";t.EXITING=f;var h=function(e){var t,n;function r(t,n){var r;r=e.call(this,t,n)||this;var i,a=n.transitionGroup,o=a&&!a.isMounting?t.enter:t.appear;return r.appearStatus=null,t.in?o?(i=u,r.appearStatus=c):i=d:i=t.unmountOnExit||t.mountOnEnter?s:u,r.state={status:i},r.nextCallback=null,r}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var o=r.prototype;return o.getChildContext=function(){return{transitionGroup:null}},r.getDerivedStateFromProps=function(e,t){return e.in&&t.status===s?{status:u}:null},o.componentDidMount=function(){this.updateStatus(!0,this.appearStatus)},o.componentDidUpdate=function(e){var t=null;if(e!==this.props){var n=this.state.status;this.props.in?n!==c&&n!==d&&(t=c):n!==c&&n!==d||(t=f)}this.updateStatus(!1,t)},o.componentWillUnmount=function(){this.cancelNextCallback()},o.getTimeouts=function(){var e,t,n,r=this.props.timeout;return e=t=n=r,null!=r&&"number"!==typeof r&&(e=r.exit,t=r.enter,n=void 0!==r.appear?r.appear:t),{exit:e,enter:t,appear:n}},o.updateStatus=function(e,t){if(void 0===e&&(e=!1),null!==t){this.cancelNextCallback();var n=a.default.findDOMNode(this);t===c?this.performEnter(n,e):this.performExit(n)}else this.props.unmountOnExit&&this.state.status===u&&this.setState({status:s})},o.performEnter=function(e,t){var n=this,r=this.props.enter,i=this.context.transitionGroup?this.context.transitionGroup.isMounting:t,a=this.getTimeouts(),o=i?a.appear:a.enter;t||r?(this.props.onEnter(e,i),this.safeSetState({status:c},(function(){n.props.onEntering(e,i),n.onTransitionEnd(e,o,(function(){n.safeSetState({status:d},(function(){n.props.onEntered(e,i)}))}))}))):this.safeSetState({status:d},(function(){n.props.onEntered(e)}))},o.performExit=function(e){var t=this,n=this.props.exit,r=this.getTimeouts();n?(this.props.onExit(e),this.safeSetState({status:f},(function(){t.props.onExiting(e),t.onTransitionEnd(e,r.exit,(function(){t.safeSetState({status:u},(function(){t.props.onExited(e)}))}))}))):this.safeSetState({status:u},(function(){t.props.onExited(e)}))},o.cancelNextCallback=function(){null!==this.nextCallback&&(this.nextCallback.cancel(),this.nextCallback=null)},o.safeSetState=function(e,t){t=this.setNextCallback(t),this.setState(e,t)},o.setNextCallback=function(e){var t=this,n=!0;return this.nextCallback=function(r){n&&(n=!1,t.nextCallback=null,e(r))},this.nextCallback.cancel=function(){n=!1},this.nextCallback},o.onTransitionEnd=function(e,t,n){this.setNextCallback(n);var r=null==t&&!this.props.addEndListener;e&&!r?(this.props.addEndListener&&this.props.addEndListener(e,this.nextCallback),null!=t&&setTimeout(this.nextCallback,t)):setTimeout(this.nextCallback,0)},o.render=function(){var e=this.state.status;if(e===s)return null;var t=this.props,n=t.children,r=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(t,["children"]);if(delete r.in,delete r.mountOnEnter,delete r.unmountOnExit,delete r.appear,delete r.enter,delete r.exit,delete r.timeout,delete r.addEndListener,delete r.onEnter,delete r.onEntering,delete r.onEntered,delete r.onExit,delete r.onExiting,delete r.onExited,"function"===typeof n)return n(e,r);var a=i.default.Children.only(n);return i.default.cloneElement(a,r)},r}(i.default.Component);function p(){}h.contextTypes={transitionGroup:r.object},h.childContextTypes={transitionGroup:function(){}},h.propTypes={},h.defaultProps={in:!1,mountOnEnter:!1,unmountOnExit:!1,appear:!1,enter:!0,exit:!0,onEnter:p,onEntering:p,onEntered:p,onExit:p,onExiting:p,onExited:p},h.UNMOUNTED=0,h.EXITED=1,h.ENTERING=2,h.ENTERED=3,h.EXITING=4;var g=(0,o.polyfill)(h);t.default=g},function(e,t,n){"use strict";function r(){var e=this.constructor.getDerivedStateFromProps(this.props,this.state);null!==e&&void 0!==e&&this.setState(e)}function i(e){this.setState(function(t){var n=this.constructor.getDerivedStateFromProps(e,t);return null!==n&&void 0!==n?n:null}.bind(this))}function a(e,t){try{var n=this.props,r=this.state;this.props=e,this.state=t,this.__reactInternalSnapshotFlag=!0,this.__reactInternalSnapshot=this.getSnapshotBeforeUpdate(n,r)}finally{this.props=n,this.state=r}}function o(e){var t=e.prototype;if(!t||!t.isReactComponent)throw new Error("Can only polyfill class components");if("function"!==typeof e.getDerivedStateFromProps&&"function"!==typeof t.getSnapshotBeforeUpdate)return e;var n=null,o=null,l=null;if("function"===typeof t.componentWillMount?n="componentWillMount":"function"===typeof t.UNSAFE_componentWillMount&&(n="UNSAFE_componentWillMount"),"function"===typeof t.componentWillReceiveProps?o="componentWillReceiveProps":"function"===typeof t.UNSAFE_componentWillReceiveProps&&(o="UNSAFE_componentWillReceiveProps"),"function"===typeof t.componentWillUpdate?l="componentWillUpdate":"function"===typeof t.UNSAFE_componentWillUpdate&&(l="UNSAFE_componentWillUpdate"),null!==n||null!==o||null!==l){var s=e.displayName||e.name,u="function"===typeof e.getDerivedStateFromProps?"getDerivedStateFromProps()":"getSnapshotBeforeUpdate()";throw Error("Unsafe legacy lifecycles will not be called for components using new component APIs.\n\n"+s+" uses "+u+" but also contains the following legacy lifecycles:"+(null!==n?"\n  "+n:"")+(null!==o?"\n  "+o:"")+(null!==l?"\n  "+l:"")+"\n\nThe above lifecycles should be removed. Learn more about this warning here:\nhttps://fb.me/react-async-component-lifecycle-hooks")}if("function"===typeof e.getDerivedStateFromProps&&(t.componentWillMount=r,t.componentWillReceiveProps=i),"function"===typeof t.getSnapshotBeforeUpdate){if("function"!==typeof t.componentDidUpdate)throw new Error("Cannot polyfill getSnapshotBeforeUpdate() for components that do not define componentDidUpdate() on the prototype");t.componentWillUpdate=a;var c=t.componentDidUpdate;t.componentDidUpdate=function(e,t,n){var r=this.__reactInternalSnapshotFlag?this.__reactInternalSnapshot:n;c.call(this,e,t,r)}}return e}n.r(t),n.d(t,"polyfill",(function(){return o})),r.__suppressDeprecationWarning=!0,i.__suppressDeprecationWarning=!0,a.__suppressDeprecationWarning=!0},function(e,t,n){"use strict";t.__esModule=!0,t.classNamesShape=t.timeoutsShape=void 0;var r;(r=n(1))&&r.__esModule;t.timeoutsShape=null;t.classNamesShape=null},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;var r=l(n(1)),i=l(n(2)),a=n(53),o=n(96);function l(e){return e&&e.__esModule?e:{default:e}}function s(){return(s=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}function u(e){if(void 0===e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return e}var c=Object.values||function(e){return Object.keys(e).map((function(t){return e[t]}))},d=function(e){var t,n;function r(t,n){var r,i=(r=e.call(this,t,n)||this).handleExited.bind(u(u(r)));return r.state={handleExited:i,firstRender:!0},r}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var a=r.prototype;return a.getChildContext=function(){return{transitionGroup:{isMounting:!this.appeared}}},a.componentDidMount=function(){this.appeared=!0,this.mounted=!0},a.componentWillUnmount=function(){this.mounted=!1},r.getDerivedStateFromProps=function(e,t){var n=t.children,r=t.handleExited;return{children:t.firstRender?(0,o.getInitialChildMapping)(e,r):(0,o.getNextChildMapping)(e,n,r),firstRender:!1}},a.handleExited=function(e,t){var n=(0,o.getChildMapping)(this.props.children);e.key in n||(e.props.onExited&&e.props.onExited(t),this.mounted&&this.setState((function(t){var n=s({},t.children);return delete n[e.key],{children:n}})))},a.render=function(){var e=this.props,t=e.component,n=e.childFactory,r=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,["component","childFactory"]),a=c(this.state.children).map(n);return delete r.appear,delete r.enter,delete r.exit,null===t?a:i.default.createElement(t,r,a)},r}(i.default.Component);d.childContextTypes={transitionGroup:r.default.object.isRequired},d.propTypes={},d.defaultProps={component:"div",childFactory:function(e){return e}};var f=(0,a.polyfill)(d);t.default=f,e.exports=t.default},function(e,t,n){"use strict";e.exports=n(98)},function(e,t,n){e.exports=function(e){"use strict";e=e&&e.hasOwnProperty("default")?e.default:e;var t={rgb2hsl:n,rgb2hsv:i,rgb2hwb:a,rgb2cmyk:o,rgb2keyword:l,rgb2xyz:s,rgb2lab:u,rgb2lch:c,hsl2rgb:d,hsl2hsv:f,hsl2hwb:h,hsl2cmyk:p,hsl2keyword:m,hsv2rgb:v,hsv2hsl:y,hsv2hwb:x,hsv2cmyk:w,hsv2keyword:_,hwb2rgb:k,hwb2hsl:S,hwb2hsv:M,hwb2cmyk:C,hwb2keyword:E,cmyk2rgb:O,cmyk2hsl:P,cmyk2hsv:T,cmyk2hwb:D,cmyk2keyword:N,keyword2rgb:H,keyword2hsl:U,keyword2hsv:V,keyword2hwb:B,keyword2cmyk:$,keyword2lab:X,keyword2xyz:q,xyz2rgb:R,xyz2lab:A,xyz2lch:I,lab2xyz:L,lab2rgb:F,lab2lch:j,lch2lab:z,lch2xyz:W,lch2rgb:Y};function n(e){var t,n,r=e[0]/255,i=e[1]/255,a=e[2]/255,o=Math.min(r,i,a),l=Math.max(r,i,a),s=l-o;return l==o?t=0:r==l?t=(i-a)/s:i==l?t=2+(a-r)/s:a==l&&(t=4+(r-i)/s),(t=Math.min(60*t,360))<0&&(t+=360),n=(o+l)/2,[t,100*(l==o?0:n<=.5?s/(l+o):s/(2-l-o)),100*n]}function i(e){var t,n,r=e[0],i=e[1],a=e[2],o=Math.min(r,i,a),l=Math.max(r,i,a),s=l-o;return n=0==l?0:s/l*1e3/10,l==o?t=0:r==l?t=(i-a)/s:i==l?t=2+(a-r)/s:a==l&&(t=4+(r-i)/s),(t=Math.min(60*t,360))<0&&(t+=360),[t,n,l/255*1e3/10]}function a(e){var t=e[0],r=e[1],i=e[2];return[n(e)[0],1/255*Math.min(t,Math.min(r,i))*100,100*(i=1-1/255*Math.max(t,Math.max(r,i)))]}function o(e){var t,n=e[0]/255,r=e[1]/255,i=e[2]/255;return[100*((1-n-(t=Math.min(1-n,1-r,1-i)))/(1-t)||0),100*((1-r-t)/(1-t)||0),100*((1-i-t)/(1-t)||0),100*t]}function l(e){return K[JSON.stringify(e)]}function s(e){var t=e[0]/255,n=e[1]/255,r=e[2]/255;return[100*(.4124*(t=t>.04045?Math.pow((t+.055)/1.055,2.4):t/12.92)+.3576*(n=n>.04045?Math.pow((n+.055)/1.055,2.4):n/12.92)+.1805*(r=r>.04045?Math.pow((r+.055)/1.055,2.4):r/12.92)),100*(.2126*t+.7152*n+.0722*r),100*(.0193*t+.1192*n+.9505*r)]}function u(e){var t=s(e),n=t[0],r=t[1],i=t[2];return r/=100,i/=108.883,n=(n/=95.047)>.008856?Math.pow(n,1/3):7.787*n+16/116,[116*(r=r>.008856?Math.pow(r,1/3):7.787*r+16/116)-16,500*(n-r),200*(r-(i=i>.008856?Math.pow(i,1/3):7.787*i+16/116))]}function c(e){return j(u(e))}function d(e){var t,n,r,i,a,o=e[0]/360,l=e[1]/100,s=e[2]/100;if(0==l)return[a=255*s,a,a];t=2*s-(n=s<.5?s*(1+l):s+l-s*l),i=[0,0,0];for(var u=0;u<3;u++)(r=o+1/3*-(u-1))<0&&r++,r>1&&r--,a=6*r<1?t+6*(n-t)*r:2*r<1?n:3*r<2?t+(n-t)*(2/3-r)*6:t,i[u]=255*a;return i}function f(e){var t=e[0],n=e[1]/100,r=e[2]/100;return 0===r?[0,0,0]:[t,2*(n*=(r*=2)<=1?r:2-r)/(r+n)*100,(r+n)/2*100]}function h(e){return a(d(e))}function p(e){return o(d(e))}function m(e){return l(d(e))}function v(e){var t=e[0]/60,n=e[1]/100,r=e[2]/100,i=Math.floor(t)%6,a=t-Math.floor(t),o=255*r*(1-n),l=255*r*(1-n*a),s=255*r*(1-n*(1-a));switch(r*=255,i){case 0:return[r,s,o];case 1:return[l,r,o];case 2:return[o,r,s];case 3:return[o,l,r];case 4:return[s,o,r];case 5:return[r,o,l]}}function y(e){var t,n,r=e[0],i=e[1]/100,a=e[2]/100;return t=i*a,[r,100*(t=(t/=(n=(2-i)*a)<=1?n:2-n)||0),100*(n/=2)]}function x(e){return a(v(e))}function w(e){return o(v(e))}function _(e){return l(v(e))}function k(e){var t,n,i,a,o=e[0]/360,l=e[1]/100,s=e[2]/100,u=l+s;switch(u>1&&(l/=u,s/=u),i=6*o-(t=Math.floor(6*o)),0!=(1&t)&&(i=1-i),a=l+i*((n=1-s)-l),t){default:case 6:case 0:r=n,g=a,b=l;break;case 1:r=a,g=n,b=l;break;case 2:r=l,g=n,b=a;break;case 3:r=l,g=a,b=n;break;case 4:r=a,g=l,b=n;break;case 5:r=n,g=l,b=a}return[255*r,255*g,255*b]}function S(e){return n(k(e))}function M(e){return i(k(e))}function C(e){return o(k(e))}function E(e){return l(k(e))}function O(e){var t=e[0]/100,n=e[1]/100,r=e[2]/100,i=e[3]/100;return[255*(1-Math.min(1,t*(1-i)+i)),255*(1-Math.min(1,n*(1-i)+i)),255*(1-Math.min(1,r*(1-i)+i))]}function P(e){return n(O(e))}function T(e){return i(O(e))}function D(e){return a(O(e))}function N(e){return l(O(e))}function R(e){var t,n,r,i=e[0]/100,a=e[1]/100,o=e[2]/100;return n=-.9689*i+1.8758*a+.0415*o,r=.0557*i+-.204*a+1.057*o,t=(t=3.2406*i+-1.5372*a+-.4986*o)>.0031308?1.055*Math.pow(t,1/2.4)-.055:t*=12.92,n=n>.0031308?1.055*Math.pow(n,1/2.4)-.055:n*=12.92,r=r>.0031308?1.055*Math.pow(r,1/2.4)-.055:r*=12.92,[255*(t=Math.min(Math.max(0,t),1)),255*(n=Math.min(Math.max(0,n),1)),255*(r=Math.min(Math.max(0,r),1))]}function A(e){var t=e[0],n=e[1],r=e[2];return n/=100,r/=108.883,t=(t/=95.047)>.008856?Math.pow(t,1/3):7.787*t+16/116,[116*(n=n>.008856?Math.pow(n,1/3):7.787*n+16/116)-16,500*(t-n),200*(n-(r=r>.008856?Math.pow(r,1/3):7.787*r+16/116))]}function I(e){return j(A(e))}function L(e){var t,n,r,i,a=e[0],o=e[1],l=e[2];return a<=8?i=(n=100*a/903.3)/100*7.787+16/116:(n=100*Math.pow((a+16)/116,3),i=Math.pow(n/100,1/3)),[t=t/95.047<=.008856?t=95.047*(o/500+i-16/116)/7.787:95.047*Math.pow(o/500+i,3),n,r=r/108.883<=.008859?r=108.883*(i-l/200-16/116)/7.787:108.883*Math.pow(i-l/200,3)]}function j(e){var t,n=e[0],r=e[1],i=e[2];return(t=360*Math.atan2(i,r)/2/Math.PI)<0&&(t+=360),[n,Math.sqrt(r*r+i*i),t]}function F(e){return R(L(e))}function z(e){var t,n=e[0],r=e[1];return t=e[2]/360*2*Math.PI,[n,r*Math.cos(t),r*Math.sin(t)]}function W(e){return L(z(e))}function Y(e){return F(z(e))}function H(e){return G[e]}function U(e){return n(H(e))}function V(e){return i(H(e))}function B(e){return a(H(e))}function $(e){return o(H(e))}function X(e){return u(H(e))}function q(e){return s(H(e))}var G={aliceblue:[240,248,255],antiquewhite:[250,235,215],aqua:[0,255,255],aquamarine:[127,255,212],azure:[240,255,255],beige:[245,245,220],bisque:[255,228,196],black:[0,0,0],blanchedalmond:[255,235,205],blue:[0,0,255],blueviolet:[138,43,226],brown:[165,42,42],burlywood:[222,184,135],cadetblue:[95,158,160],chartreuse:[127,255,0],chocolate:[210,105,30],coral:[255,127,80],cornflowerblue:[100,149,237],cornsilk:[255,248,220],crimson:[220,20,60],cyan:[0,255,255],darkblue:[0,0,139],darkcyan:[0,139,139],darkgoldenrod:[184,134,11],darkgray:[169,169,169],darkgreen:[0,100,0],darkgrey:[169,169,169],darkkhaki:[189,183,107],darkmagenta:[139,0,139],darkolivegreen:[85,107,47],darkorange:[255,140,0],darkorchid:[153,50,204],darkred:[139,0,0],darksalmon:[233,150,122],darkseagreen:[143,188,143],darkslateblue:[72,61,139],darkslategray:[47,79,79],darkslategrey:[47,79,79],darkturquoise:[0,206,209],darkviolet:[148,0,211],deeppink:[255,20,147],deepskyblue:[0,191,255],dimgray:[105,105,105],dimgrey:[105,105,105],dodgerblue:[30,144,255],firebrick:[178,34,34],floralwhite:[255,250,240],forestgreen:[34,139,34],fuchsia:[255,0,255],gainsboro:[220,220,220],ghostwhite:[248,248,255],gold:[255,215,0],goldenrod:[218,165,32],gray:[128,128,128],green:[0,128,0],greenyellow:[173,255,47],grey:[128,128,128],honeydew:[240,255,240],hotpink:[255,105,180],indianred:[205,92,92],indigo:[75,0,130],ivory:[255,255,240],khaki:[240,230,140],lavender:[230,230,250],lavenderblush:[255,240,245],lawngreen:[124,252,0],lemonchiffon:[255,250,205],lightblue:[173,216,230],lightcoral:[240,128,128],lightcyan:[224,255,255],lightgoldenrodyellow:[250,250,210],lightgray:[211,211,211],lightgreen:[144,238,144],lightgrey:[211,211,211],lightpink:[255,182,193],lightsalmon:[255,160,122],lightseagreen:[32,178,170],lightskyblue:[135,206,250],lightslategray:[119,136,153],lightslategrey:[119,136,153],lightsteelblue:[176,196,222],lightyellow:[255,255,224],lime:[0,255,0],limegreen:[50,205,50],linen:[250,240,230],magenta:[255,0,255],maroon:[128,0,0],mediumaquamarine:[102,205,170],mediumblue:[0,0,205],mediumorchid:[186,85,211],mediumpurple:[147,112,219],mediumseagreen:[60,179,113],mediumslateblue:[123,104,238],mediumspringgreen:[0,250,154],mediumturquoise:[72,209,204],mediumvioletred:[199,21,133],midnightblue:[25,25,112],mintcream:[245,255,250],mistyrose:[255,228,225],moccasin:[255,228,181],navajowhite:[255,222,173],navy:[0,0,128],oldlace:[253,245,230],olive:[128,128,0],olivedrab:[107,142,35],orange:[255,165,0],orangered:[255,69,0],orchid:[218,112,214],palegoldenrod:[238,232,170],palegreen:[152,251,152],paleturquoise:[175,238,238],palevioletred:[219,112,147],papayawhip:[255,239,213],peachpuff:[255,218,185],peru:[205,133,63],pink:[255,192,203],plum:[221,160,221],powderblue:[176,224,230],purple:[128,0,128],rebeccapurple:[102,51,153],red:[255,0,0],rosybrown:[188,143,143],royalblue:[65,105,225],saddlebrown:[139,69,19],salmon:[250,128,114],sandybrown:[244,164,96],seagreen:[46,139,87],seashell:[255,245,238],sienna:[160,82,45],silver:[192,192,192],skyblue:[135,206,235],slateblue:[106,90,205],slategray:[112,128,144],slategrey:[112,128,144],snow:[255,250,250],springgreen:[0,255,127],steelblue:[70,130,180],tan:[210,180,140],teal:[0,128,128],thistle:[216,191,216],tomato:[255,99,71],turquoise:[64,224,208],violet:[238,130,238],wheat:[245,222,179],white:[255,255,255],whitesmoke:[245,245,245],yellow:[255,255,0],yellowgreen:[154,205,50]},K={};for(var Q in G)K[JSON.stringify(G[Q])]=Q;var Z=function(){return new re};for(var J in t){Z[J+"Raw"]=function(e){return function(n){return"number"==typeof n&&(n=Array.prototype.slice.call(arguments)),t[e](n)}}(J);var ee=/(\w+)2(\w+)/.exec(J),te=ee[1],ne=ee[2];Z[te]=Z[te]||{},Z[te][ne]=Z[J]=function(e){return function(n){"number"==typeof n&&(n=Array.prototype.slice.call(arguments));var r=t[e](n);if("string"==typeof r||void 0===r)return r;for(var i=0;i<r.length;i++)r[i]=Math.round(r[i]);return r}}(J)}var re=function(){this.convs={}};re.prototype.routeSpace=function(e,t){var n=t[0];return void 0===n?this.getValues(e):("number"==typeof n&&(n=Array.prototype.slice.call(t)),this.setValues(e,n))},re.prototype.setValues=function(e,t){return this.space=e,this.convs={},this.convs[e]=t,this},re.prototype.getValues=function(e){var t=this.convs[e];if(!t){var n=this.space,r=this.convs[n];t=Z[n][e](r),this.convs[e]=t}return t},["rgb","hsl","hsv","cmyk","keyword"].forEach((function(e){re.prototype[e]=function(t){return this.routeSpace(e,arguments)}}));var ie=Z,ae={aliceblue:[240,248,255],antiquewhite:[250,235,215],aqua:[0,255,255],aquamarine:[127,255,212],azure:[240,255,255],beige:[245,245,220],bisque:[255,228,196],black:[0,0,0],blanchedalmond:[255,235,205],blue:[0,0,255],blueviolet:[138,43,226],brown:[165,42,42],burlywood:[222,184,135],cadetblue:[95,158,160],chartreuse:[127,255,0],chocolate:[210,105,30],coral:[255,127,80],cornflowerblue:[100,149,237],cornsilk:[255,248,220],crimson:[220,20,60],cyan:[0,255,255],darkblue:[0,0,139],darkcyan:[0,139,139],darkgoldenrod:[184,134,11],darkgray:[169,169,169],darkgreen:[0,100,0],darkgrey:[169,169,169],darkkhaki:[189,183,107],darkmagenta:[139,0,139],darkolivegreen:[85,107,47],darkorange:[255,140,0],darkorchid:[153,50,204],darkred:[139,0,0],darksalmon:[233,150,122],darkseagreen:[143,188,143],darkslateblue:[72,61,139],darkslategray:[47,79,79],darkslategrey:[47,79,79],darkturquoise:[0,206,209],darkviolet:[148,0,211],deeppink:[255,20,147],deepskyblue:[0,191,255],dimgray:[105,105,105],dimgrey:[105,105,105],dodgerblue:[30,144,255],firebrick:[178,34,34],floralwhite:[255,250,240],forestgreen:[34,139,34],fuchsia:[255,0,255],gainsboro:[220,220,220],ghostwhite:[248,248,255],gold:[255,215,0],goldenrod:[218,165,32],gray:[128,128,128],green:[0,128,0],greenyellow:[173,255,47],grey:[128,128,128],honeydew:[240,255,240],hotpink:[255,105,180],indianred:[205,92,92],indigo:[75,0,130],ivory:[255,255,240],khaki:[240,230,140],lavender:[230,230,250],lavenderblush:[255,240,245],lawngreen:[124,252,0],lemonchiffon:[255,250,205],lightblue:[173,216,230],lightcoral:[240,128,128],lightcyan:[224,255,255],lightgoldenrodyellow:[250,250,210],lightgray:[211,211,211],lightgreen:[144,238,144],lightgrey:[211,211,211],lightpink:[255,182,193],lightsalmon:[255,160,122],lightseagreen:[32,178,170],lightskyblue:[135,206,250],lightslategray:[119,136,153],lightslategrey:[119,136,153],lightsteelblue:[176,196,222],lightyellow:[255,255,224],lime:[0,255,0],limegreen:[50,205,50],linen:[250,240,230],magenta:[255,0,255],maroon:[128,0,0],mediumaquamarine:[102,205,170],mediumblue:[0,0,205],mediumorchid:[186,85,211],mediumpurple:[147,112,219],mediumseagreen:[60,179,113],mediumslateblue:[123,104,238],mediumspringgreen:[0,250,154],mediumturquoise:[72,209,204],mediumvioletred:[199,21,133],midnightblue:[25,25,112],mintcream:[245,255,250],mistyrose:[255,228,225],moccasin:[255,228,181],navajowhite:[255,222,173],navy:[0,0,128],oldlace:[253,245,230],olive:[128,128,0],olivedrab:[107,142,35],orange:[255,165,0],orangered:[255,69,0],orchid:[218,112,214],palegoldenrod:[238,232,170],palegreen:[152,251,152],paleturquoise:[175,238,238],palevioletred:[219,112,147],papayawhip:[255,239,213],peachpuff:[255,218,185],peru:[205,133,63],pink:[255,192,203],plum:[221,160,221],powderblue:[176,224,230],purple:[128,0,128],rebeccapurple:[102,51,153],red:[255,0,0],rosybrown:[188,143,143],royalblue:[65,105,225],saddlebrown:[139,69,19],salmon:[250,128,114],sandybrown:[244,164,96],seagreen:[46,139,87],seashell:[255,245,238],sienna:[160,82,45],silver:[192,192,192],skyblue:[135,206,235],slateblue:[106,90,205],slategray:[112,128,144],slategrey:[112,128,144],snow:[255,250,250],springgreen:[0,255,127],steelblue:[70,130,180],tan:[210,180,140],teal:[0,128,128],thistle:[216,191,216],tomato:[255,99,71],turquoise:[64,224,208],violet:[238,130,238],wheat:[245,222,179],white:[255,255,255],whitesmoke:[245,245,245],yellow:[255,255,0],yellowgreen:[154,205,50]},oe={getRgba:le,getHsla:se,getRgb:ce,getHsl:de,getHwb:ue,getAlpha:fe,hexString:he,rgbString:pe,rgbaString:ge,percentString:me,percentaString:ve,hslString:ye,hslaString:be,hwbString:xe,keyword:we};function le(e){if(e){var t=/^#([a-fA-F0-9]{3,4})$/i,n=/^#([a-fA-F0-9]{6}([a-fA-F0-9]{2})?)$/i,r=/^rgba?\(\s*([+-]?\d+)\s*,\s*([+-]?\d+)\s*,\s*([+-]?\d+)\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)$/i,i=/^rgba?\(\s*([+-]?[\d\.]+)\%\s*,\s*([+-]?[\d\.]+)\%\s*,\s*([+-]?[\d\.]+)\%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)$/i,a=/(\w+)/,o=[0,0,0],l=1,s=e.match(t),u="";if(s){u=(s=s[1])[3];for(var c=0;c<o.length;c++)o[c]=parseInt(s[c]+s[c],16);u&&(l=Math.round(parseInt(u+u,16)/255*100)/100)}else if(s=e.match(n)){for(u=s[2],s=s[1],c=0;c<o.length;c++)o[c]=parseInt(s.slice(2*c,2*c+2),16);u&&(l=Math.round(parseInt(u,16)/255*100)/100)}else if(s=e.match(r)){for(c=0;c<o.length;c++)o[c]=parseInt(s[c+1]);l=parseFloat(s[4])}else if(s=e.match(i)){for(c=0;c<o.length;c++)o[c]=Math.round(2.55*parseFloat(s[c+1]));l=parseFloat(s[4])}else if(s=e.match(a)){if("transparent"==s[1])return[0,0,0,0];if(!(o=ae[s[1]]))return}for(c=0;c<o.length;c++)o[c]=_e(o[c],0,255);return l=l||0==l?_e(l,0,1):1,o[3]=l,o}}function se(e){if(e){var t=/^hsla?\(\s*([+-]?\d+)(?:deg)?\s*,\s*([+-]?[\d\.]+)%\s*,\s*([+-]?[\d\.]+)%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)/,n=e.match(t);if(n){var r=parseFloat(n[4]);return[_e(parseInt(n[1]),0,360),_e(parseFloat(n[2]),0,100),_e(parseFloat(n[3]),0,100),_e(isNaN(r)?1:r,0,1)]}}}function ue(e){if(e){var t=/^hwb\(\s*([+-]?\d+)(?:deg)?\s*,\s*([+-]?[\d\.]+)%\s*,\s*([+-]?[\d\.]+)%\s*(?:,\s*([+-]?[\d\.]+)\s*)?\)/,n=e.match(t);if(n){var r=parseFloat(n[4]);return[_e(parseInt(n[1]),0,360),_e(parseFloat(n[2]),0,100),_e(parseFloat(n[3]),0,100),_e(isNaN(r)?1:r,0,1)]}}}function ce(e){var t=le(e);return t&&t.slice(0,3)}function de(e){var t=se(e);return t&&t.slice(0,3)}function fe(e){var t=le(e);return t||(t=se(e))||(t=ue(e))?t[3]:void 0}function he(e,t){return t=void 0!==t&&3===e.length?t:e[3],"#"+ke(e[0])+ke(e[1])+ke(e[2])+(t>=0&&t<1?ke(Math.round(255*t)):"")}function pe(e,t){return t<1||e[3]&&e[3]<1?ge(e,t):"rgb("+e[0]+", "+e[1]+", "+e[2]+")"}function ge(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"rgba("+e[0]+", "+e[1]+", "+e[2]+", "+t+")"}function me(e,t){return t<1||e[3]&&e[3]<1?ve(e,t):"rgb("+Math.round(e[0]/255*100)+"%, "+Math.round(e[1]/255*100)+"%, "+Math.round(e[2]/255*100)+"%)"}function ve(e,t){return"rgba("+Math.round(e[0]/255*100)+"%, "+Math.round(e[1]/255*100)+"%, "+Math.round(e[2]/255*100)+"%, "+(t||e[3]||1)+")"}function ye(e,t){return t<1||e[3]&&e[3]<1?be(e,t):"hsl("+e[0]+", "+e[1]+"%, "+e[2]+"%)"}function be(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"hsla("+e[0]+", "+e[1]+"%, "+e[2]+"%, "+t+")"}function xe(e,t){return void 0===t&&(t=void 0!==e[3]?e[3]:1),"hwb("+e[0]+", "+e[1]+"%, "+e[2]+"%"+(void 0!==t&&1!==t?", "+t:"")+")"}function we(e){return Se[e.slice(0,3)]}function _e(e,t,n){return Math.min(Math.max(t,e),n)}function ke(e){var t=e.toString(16).toUpperCase();return t.length<2?"0"+t:t}var Se={};for(var Me in ae)Se[ae[Me]]=Me;var Ce=function e(t){return t instanceof e?t:this instanceof e?(this.valid=!1,this.values={rgb:[0,0,0],hsl:[0,0,0],hsv:[0,0,0],hwb:[0,0,0],cmyk:[0,0,0,0],alpha:1},void("string"===typeof t?(n=oe.getRgba(t))?this.setValues("rgb",n):(n=oe.getHsla(t))?this.setValues("hsl",n):(n=oe.getHwb(t))&&this.setValues("hwb",n):"object"===typeof t&&(void 0!==(n=t).r||void 0!==n.red?this.setValues("rgb",n):void 0!==n.l||void 0!==n.lightness?this.setValues("hsl",n):void 0!==n.v||void 0!==n.value?this.setValues("hsv",n):void 0!==n.w||void 0!==n.whiteness?this.setValues("hwb",n):void 0===n.c&&void 0===n.cyan||this.setValues("cmyk",n)))):new e(t);var n};Ce.prototype={isValid:function(){return this.valid},rgb:function(){return this.setSpace("rgb",arguments)},hsl:function(){return this.setSpace("hsl",arguments)},hsv:function(){return this.setSpace("hsv",arguments)},hwb:function(){return this.setSpace("hwb",arguments)},cmyk:function(){return this.setSpace("cmyk",arguments)},rgbArray:function(){return this.values.rgb},hslArray:function(){return this.values.hsl},hsvArray:function(){return this.values.hsv},hwbArray:function(){var e=this.values;return 1!==e.alpha?e.hwb.concat([e.alpha]):e.hwb},cmykArray:function(){return this.values.cmyk},rgbaArray:function(){var e=this.values;return e.rgb.concat([e.alpha])},hslaArray:function(){var e=this.values;return e.hsl.concat([e.alpha])},alpha:function(e){return void 0===e?this.values.alpha:(this.setValues("alpha",e),this)},red:function(e){return this.setChannel("rgb",0,e)},green:function(e){return this.setChannel("rgb",1,e)},blue:function(e){return this.setChannel("rgb",2,e)},hue:function(e){return e&&(e=(e%=360)<0?360+e:e),this.setChannel("hsl",0,e)},saturation:function(e){return this.setChannel("hsl",1,e)},lightness:function(e){return this.setChannel("hsl",2,e)},saturationv:function(e){return this.setChannel("hsv",1,e)},whiteness:function(e){return this.setChannel("hwb",1,e)},blackness:function(e){return this.setChannel("hwb",2,e)},value:function(e){return this.setChannel("hsv",2,e)},cyan:function(e){return this.setChannel("cmyk",0,e)},magenta:function(e){return this.setChannel("cmyk",1,e)},yellow:function(e){return this.setChannel("cmyk",2,e)},black:function(e){return this.setChannel("cmyk",3,e)},hexString:function(){return oe.hexString(this.values.rgb)},rgbString:function(){return oe.rgbString(this.values.rgb,this.values.alpha)},rgbaString:function(){return oe.rgbaString(this.values.rgb,this.values.alpha)},percentString:function(){return oe.percentString(this.values.rgb,this.values.alpha)},hslString:function(){return oe.hslString(this.values.hsl,this.values.alpha)},hslaString:function(){return oe.hslaString(this.values.hsl,this.values.alpha)},hwbString:function(){return oe.hwbString(this.values.hwb,this.values.alpha)},keyword:function(){return oe.keyword(this.values.rgb,this.values.alpha)},rgbNumber:function(){var e=this.values.rgb;return e[0]<<16|e[1]<<8|e[2]},luminosity:function(){for(var e=this.values.rgb,t=[],n=0;n<e.length;n++){var r=e[n]/255;t[n]=r<=.03928?r/12.92:Math.pow((r+.055)/1.055,2.4)}return.2126*t[0]+.7152*t[1]+.0722*t[2]},contrast:function(e){var t=this.luminosity(),n=e.luminosity();return t>n?(t+.05)/(n+.05):(n+.05)/(t+.05)},level:function(e){var t=this.contrast(e);return t>=7.1?"AAA":t>=4.5?"AA":""},dark:function(){var e=this.values.rgb;return(299*e[0]+587*e[1]+114*e[2])/1e3<128},light:function(){return!this.dark()},negate:function(){for(var e=[],t=0;t<3;t++)e[t]=255-this.values.rgb[t];return this.setValues("rgb",e),this},lighten:function(e){var t=this.values.hsl;return t[2]+=t[2]*e,this.setValues("hsl",t),this},darken:function(e){var t=this.values.hsl;return t[2]-=t[2]*e,this.setValues("hsl",t),this},saturate:function(e){var t=this.values.hsl;return t[1]+=t[1]*e,this.setValues("hsl",t),this},desaturate:function(e){var t=this.values.hsl;return t[1]-=t[1]*e,this.setValues("hsl",t),this},whiten:function(e){var t=this.values.hwb;return t[1]+=t[1]*e,this.setValues("hwb",t),this},blacken:function(e){var t=this.values.hwb;return t[2]+=t[2]*e,this.setValues("hwb",t),this},greyscale:function(){var e=this.values.rgb,t=.3*e[0]+.59*e[1]+.11*e[2];return this.setValues("rgb",[t,t,t]),this},clearer:function(e){var t=this.values.alpha;return this.setValues("alpha",t-t*e),this},opaquer:function(e){var t=this.values.alpha;return this.setValues("alpha",t+t*e),this},rotate:function(e){var t=this.values.hsl,n=(t[0]+e)%360;return t[0]=n<0?360+n:n,this.setValues("hsl",t),this},mix:function(e,t){var n=this,r=e,i=void 0===t?.5:t,a=2*i-1,o=n.alpha()-r.alpha(),l=((a*o===-1?a:(a+o)/(1+a*o))+1)/2,s=1-l;return this.rgb(l*n.red()+s*r.red(),l*n.green()+s*r.green(),l*n.blue()+s*r.blue()).alpha(n.alpha()*i+r.alpha()*(1-i))},toJSON:function(){return this.rgb()},clone:function(){var e,t,n=new Ce,r=this.values,i=n.values;for(var a in r)r.hasOwnProperty(a)&&(e=r[a],"[object Array]"===(t={}.toString.call(e))?i[a]=e.slice(0):"[object Number]"===t?i[a]=e:console.error("unexpected color value:",e));return n}},Ce.prototype.spaces={rgb:["red","green","blue"],hsl:["hue","saturation","lightness"],hsv:["hue","saturation","value"],hwb:["hue","whiteness","blackness"],cmyk:["cyan","magenta","yellow","black"]},Ce.prototype.maxes={rgb:[255,255,255],hsl:[360,100,100],hsv:[360,100,100],hwb:[360,100,100],cmyk:[100,100,100,100]},Ce.prototype.getValues=function(e){for(var t=this.values,n={},r=0;r<e.length;r++)n[e.charAt(r)]=t[e][r];return 1!==t.alpha&&(n.a=t.alpha),n},Ce.prototype.setValues=function(e,t){var n,r,i=this.values,a=this.spaces,o=this.maxes,l=1;if(this.valid=!0,"alpha"===e)l=t;else if(t.length)i[e]=t.slice(0,e.length),l=t[e.length];else if(void 0!==t[e.charAt(0)]){for(n=0;n<e.length;n++)i[e][n]=t[e.charAt(n)];l=t.a}else if(void 0!==t[a[e][0]]){var s=a[e];for(n=0;n<e.length;n++)i[e][n]=t[s[n]];l=t.alpha}if(i.alpha=Math.max(0,Math.min(1,void 0===l?i.alpha:l)),"alpha"===e)return!1;for(n=0;n<e.length;n++)r=Math.max(0,Math.min(o[e][n],i[e][n])),i[e][n]=Math.round(r);for(var u in a)u!==e&&(i[u]=ie[e][u](i[e]));return!0},Ce.prototype.setSpace=function(e,t){var n=t[0];return void 0===n?this.getValues(e):("number"===typeof n&&(n=Array.prototype.slice.call(t)),this.setValues(e,n),this)},Ce.prototype.setChannel=function(e,t,n){var r=this.values[e];return void 0===n?r[t]:(n===r[t]||(r[t]=n,this.setValues(e,r)),this)},"undefined"!==typeof window&&(window.Color=Ce);var Ee=Ce,Oe={noop:function(){},uid:function(){var e=0;return function(){return e++}}(),isNullOrUndef:function(e){return null===e||"undefined"===typeof e},isArray:function(e){if(Array.isArray&&Array.isArray(e))return!0;var t=Object.prototype.toString.call(e);return"[object"===t.substr(0,7)&&"Array]"===t.substr(-6)},isObject:function(e){return null!==e&&"[object Object]"===Object.prototype.toString.call(e)},isFinite:function(e){function t(t){return e.apply(this,arguments)}return t.toString=function(){return e.toString()},t}((function(e){return("number"===typeof e||e instanceof Number)&&isFinite(e)})),valueOrDefault:function(e,t){return"undefined"===typeof e?t:e},valueAtIndexOrDefault:function(e,t,n){return Oe.valueOrDefault(Oe.isArray(e)?e[t]:e,n)},callback:function(e,t,n){if(e&&"function"===typeof e.call)return e.apply(n,t)},each:function(e,t,n,r){var i,a,o;if(Oe.isArray(e))if(a=e.length,r)for(i=a-1;i>=0;i--)t.call(n,e[i],i);else for(i=0;i<a;i++)t.call(n,e[i],i);else if(Oe.isObject(e))for(a=(o=Object.keys(e)).length,i=0;i<a;i++)t.call(n,e[o[i]],o[i])},arrayEquals:function(e,t){var n,r,i,a;if(!e||!t||e.length!==t.length)return!1;for(n=0,r=e.length;n<r;++n)if(i=e[n],a=t[n],i instanceof Array&&a instanceof Array){if(!Oe.arrayEquals(i,a))return!1}else if(i!==a)return!1;return!0},clone:function(e){if(Oe.isArray(e))return e.map(Oe.clone);if(Oe.isObject(e)){for(var t={},n=Object.keys(e),r=n.length,i=0;i<r;++i)t[n[i]]=Oe.clone(e[n[i]]);return t}return e},_merger:function(e,t,n,r){var i=t[e],a=n[e];Oe.isObject(i)&&Oe.isObject(a)?Oe.merge(i,a,r):t[e]=Oe.clone(a)},_mergerIf:function(e,t,n){var r=t[e],i=n[e];Oe.isObject(r)&&Oe.isObject(i)?Oe.mergeIf(r,i):t.hasOwnProperty(e)||(t[e]=Oe.clone(i))},merge:function(e,t,n){var r,i,a,o,l,s=Oe.isArray(t)?t:[t],u=s.length;if(!Oe.isObject(e))return e;for(r=(n=n||{}).merger||Oe._merger,i=0;i<u;++i)if(t=s[i],Oe.isObject(t))for(l=0,o=(a=Object.keys(t)).length;l<o;++l)r(a[l],e,t,n);return e},mergeIf:function(e,t){return Oe.merge(e,t,{merger:Oe._mergerIf})},extend:function(e){for(var t=function(t,n){e[n]=t},n=1,r=arguments.length;n<r;++n)Oe.each(arguments[n],t);return e},inherits:function(e){var t=this,n=e&&e.hasOwnProperty("constructor")?e.constructor:function(){return t.apply(this,arguments)},r=function(){this.constructor=n};return r.prototype=t.prototype,n.prototype=new r,n.extend=Oe.inherits,e&&Oe.extend(n.prototype,e),n.__super__=t.prototype,n}},Pe=Oe;Oe.callCallback=Oe.callback,Oe.indexOf=function(e,t,n){return Array.prototype.indexOf.call(e,t,n)},Oe.getValueOrDefault=Oe.valueOrDefault,Oe.getValueAtIndexOrDefault=Oe.valueAtIndexOrDefault;var Te={linear:function(e){return e},easeInQuad:function(e){return e*e},easeOutQuad:function(e){return-e*(e-2)},easeInOutQuad:function(e){return(e/=.5)<1?.5*e*e:-.5*(--e*(e-2)-1)},easeInCubic:function(e){return e*e*e},easeOutCubic:function(e){return(e-=1)*e*e+1},easeInOutCubic:function(e){return(e/=.5)<1?.5*e*e*e:.5*((e-=2)*e*e+2)},easeInQuart:function(e){return e*e*e*e},easeOutQuart:function(e){return-((e-=1)*e*e*e-1)},easeInOutQuart:function(e){return(e/=.5)<1?.5*e*e*e*e:-.5*((e-=2)*e*e*e-2)},easeInQuint:function(e){return e*e*e*e*e},easeOutQuint:function(e){return(e-=1)*e*e*e*e+1},easeInOutQuint:function(e){return(e/=.5)<1?.5*e*e*e*e*e:.5*((e-=2)*e*e*e*e+2)},easeInSine:function(e){return 1-Math.cos(e*(Math.PI/2))},easeOutSine:function(e){return Math.sin(e*(Math.PI/2))},easeInOutSine:function(e){return-.5*(Math.cos(Math.PI*e)-1)},easeInExpo:function(e){return 0===e?0:Math.pow(2,10*(e-1))},easeOutExpo:function(e){return 1===e?1:1-Math.pow(2,-10*e)},easeInOutExpo:function(e){return 0===e?0:1===e?1:(e/=.5)<1?.5*Math.pow(2,10*(e-1)):.5*(2-Math.pow(2,-10*--e))},easeInCirc:function(e){return e>=1?e:-(Math.sqrt(1-e*e)-1)},easeOutCirc:function(e){return Math.sqrt(1-(e-=1)*e)},easeInOutCirc:function(e){return(e/=.5)<1?-.5*(Math.sqrt(1-e*e)-1):.5*(Math.sqrt(1-(e-=2)*e)+1)},easeInElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:1===e?1:(n||(n=.3),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),-r*Math.pow(2,10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n))},easeOutElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:1===e?1:(n||(n=.3),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),r*Math.pow(2,-10*e)*Math.sin((e-t)*(2*Math.PI)/n)+1)},easeInOutElastic:function(e){var t=1.70158,n=0,r=1;return 0===e?0:2===(e/=.5)?1:(n||(n=.45),r<1?(r=1,t=n/4):t=n/(2*Math.PI)*Math.asin(1/r),e<1?r*Math.pow(2,10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n)*-.5:r*Math.pow(2,-10*(e-=1))*Math.sin((e-t)*(2*Math.PI)/n)*.5+1)},easeInBack:function(e){var t=1.70158;return e*e*((t+1)*e-t)},easeOutBack:function(e){var t=1.70158;return(e-=1)*e*((t+1)*e+t)+1},easeInOutBack:function(e){var t=1.70158;return(e/=.5)<1?e*e*((1+(t*=1.525))*e-t)*.5:.5*((e-=2)*e*((1+(t*=1.525))*e+t)+2)},easeInBounce:function(e){return 1-Te.easeOutBounce(1-e)},easeOutBounce:function(e){return e<1/2.75?7.5625*e*e:e<2/2.75?7.5625*(e-=1.5/2.75)*e+.75:e<2.5/2.75?7.5625*(e-=2.25/2.75)*e+.9375:7.5625*(e-=2.625/2.75)*e+.984375},easeInOutBounce:function(e){return e<.5?.5*Te.easeInBounce(2*e):.5*Te.easeOutBounce(2*e-1)+.5}},De={effects:Te};Pe.easingEffects=Te;var Ne=Math.PI,Re=Ne/180,Ae=2*Ne,Ie=Ne/2,Le=Ne/4,je=2*Ne/3,Fe={clear:function(e){e.ctx.clearRect(0,0,e.width,e.height)},roundedRect:function(e,t,n,r,i,a){if(a){var o=Math.min(a,i/2,r/2),l=t+o,s=n+o,u=t+r-o,c=n+i-o;e.moveTo(t,s),l<u&&s<c?(e.arc(l,s,o,-Ne,-Ie),e.arc(u,s,o,-Ie,0),e.arc(u,c,o,0,Ie),e.arc(l,c,o,Ie,Ne)):l<u?(e.moveTo(l,n),e.arc(u,s,o,-Ie,Ie),e.arc(l,s,o,Ie,Ne+Ie)):s<c?(e.arc(l,s,o,-Ne,0),e.arc(l,c,o,0,Ne)):e.arc(l,s,o,-Ne,Ne),e.closePath(),e.moveTo(t,n)}else e.rect(t,n,r,i)},drawPoint:function(e,t,n,r,i,a){var o,l,s,u,c,d=(a||0)*Re;if(!t||"object"!==typeof t||"[object HTMLImageElement]"!==(o=t.toString())&&"[object HTMLCanvasElement]"!==o){if(!(isNaN(n)||n<=0)){switch(e.beginPath(),t){default:e.arc(r,i,n,0,Ae),e.closePath();break;case"triangle":e.moveTo(r+Math.sin(d)*n,i-Math.cos(d)*n),d+=je,e.lineTo(r+Math.sin(d)*n,i-Math.cos(d)*n),d+=je,e.lineTo(r+Math.sin(d)*n,i-Math.cos(d)*n),e.closePath();break;case"rectRounded":u=n-(c=.516*n),l=Math.cos(d+Le)*u,s=Math.sin(d+Le)*u,e.arc(r-l,i-s,c,d-Ne,d-Ie),e.arc(r+s,i-l,c,d-Ie,d),e.arc(r+l,i+s,c,d,d+Ie),e.arc(r-s,i+l,c,d+Ie,d+Ne),e.closePath();break;case"rect":if(!a){u=Math.SQRT1_2*n,e.rect(r-u,i-u,2*u,2*u);break}d+=Le;case"rectRot":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+s,i-l),e.lineTo(r+l,i+s),e.lineTo(r-s,i+l),e.closePath();break;case"crossRot":d+=Le;case"cross":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l);break;case"star":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l),d+=Le,l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s),e.moveTo(r+s,i-l),e.lineTo(r-s,i+l);break;case"line":l=Math.cos(d)*n,s=Math.sin(d)*n,e.moveTo(r-l,i-s),e.lineTo(r+l,i+s);break;case"dash":e.moveTo(r,i),e.lineTo(r+Math.cos(d)*n,i+Math.sin(d)*n)}e.fill(),e.stroke()}}else e.drawImage(t,r-t.width/2,i-t.height/2,t.width,t.height)},_isPointInArea:function(e,t){var n=1e-6;return e.x>t.left-n&&e.x<t.right+n&&e.y>t.top-n&&e.y<t.bottom+n},clipArea:function(e,t){e.save(),e.beginPath(),e.rect(t.left,t.top,t.right-t.left,t.bottom-t.top),e.clip()},unclipArea:function(e){e.restore()},lineTo:function(e,t,n,r){var i=n.steppedLine;if(i){if("middle"===i){var a=(t.x+n.x)/2;e.lineTo(a,r?n.y:t.y),e.lineTo(a,r?t.y:n.y)}else"after"===i&&!r||"after"!==i&&r?e.lineTo(t.x,n.y):e.lineTo(n.x,t.y);e.lineTo(n.x,n.y)}else n.tension?e.bezierCurveTo(r?t.controlPointPreviousX:t.controlPointNextX,r?t.controlPointPreviousY:t.controlPointNextY,r?n.controlPointNextX:n.controlPointPreviousX,r?n.controlPointNextY:n.controlPointPreviousY,n.x,n.y):e.lineTo(n.x,n.y)}},ze=Fe;Pe.clear=Fe.clear,Pe.drawRoundedRectangle=function(e){e.beginPath(),Fe.roundedRect.apply(Fe,arguments)};var We={_set:function(e,t){return Pe.merge(this[e]||(this[e]={}),t)}};We._set("global",{defaultColor:"rgba(0,0,0,0.1)",defaultFontColor:"#666",defaultFontFamily:"'Helvetica Neue', 'Helvetica', 'Arial', sans-serif",defaultFontSize:12,defaultFontStyle:"normal",defaultLineHeight:1.2,showLines:!0});var Ye=We,He=Pe.valueOrDefault;function Ue(e){return!e||Pe.isNullOrUndef(e.size)||Pe.isNullOrUndef(e.family)?null:(e.style?e.style+" ":"")+(e.weight?e.weight+" ":"")+e.size+"px "+e.family}var Ve={toLineHeight:function(e,t){var n=(""+e).match(/^(normal|(\d+(?:\.\d+)?)(px|em|%)?)$/);if(!n||"normal"===n[1])return 1.2*t;switch(e=+n[2],n[3]){case"px":return e;case"%":e/=100}return t*e},toPadding:function(e){var t,n,r,i;return Pe.isObject(e)?(t=+e.top||0,n=+e.right||0,r=+e.bottom||0,i=+e.left||0):t=n=r=i=+e||0,{top:t,right:n,bottom:r,left:i,height:t+r,width:i+n}},_parseFont:function(e){var t=Ye.global,n=He(e.fontSize,t.defaultFontSize),r={family:He(e.fontFamily,t.defaultFontFamily),lineHeight:Pe.options.toLineHeight(He(e.lineHeight,t.defaultLineHeight),n),size:n,style:He(e.fontStyle,t.defaultFontStyle),weight:null,string:""};return r.string=Ue(r),r},resolve:function(e,t,n){var r,i,a;for(r=0,i=e.length;r<i;++r)if(void 0!==(a=e[r])&&(void 0!==t&&"function"===typeof a&&(a=a(t)),void 0!==n&&Pe.isArray(a)&&(a=a[n]),void 0!==a))return a}},Be=Pe,$e=De,Xe=ze,qe=Ve;function Ge(e,t,n,r){var i,a,o,l,s,u,c,d,f,h=Object.keys(n);for(i=0,a=h.length;i<a;++i)if(u=n[o=h[i]],t.hasOwnProperty(o)||(t[o]=u),(l=t[o])!==u&&"_"!==o[0]){if(e.hasOwnProperty(o)||(e[o]=l),(c=typeof u)===typeof(s=e[o]))if("string"===c){if((d=Ee(s)).valid&&(f=Ee(u)).valid){t[o]=f.mix(d,r).rgbString();continue}}else if(Be.isFinite(s)&&Be.isFinite(u)){t[o]=s+(u-s)*r;continue}t[o]=u}}Be.easing=$e,Be.canvas=Xe,Be.options=qe;var Ke=function(e){Be.extend(this,e),this.initialize.apply(this,arguments)};Be.extend(Ke.prototype,{initialize:function(){this.hidden=!1},pivot:function(){var e=this;return e._view||(e._view=Be.clone(e._model)),e._start={},e},transition:function(e){var t=this,n=t._model,r=t._start,i=t._view;return n&&1!==e?(i||(i=t._view={}),r||(r=t._start={}),Ge(r,i,n,e),t):(t._view=n,t._start=null,t)},tooltipPosition:function(){return{x:this._model.x,y:this._model.y}},hasValue:function(){return Be.isNumber(this._model.x)&&Be.isNumber(this._model.y)}}),Ke.extend=Be.inherits;var Qe=Ke,Ze=Qe.extend({chart:null,currentStep:0,numSteps:60,easing:"",render:null,onAnimationProgress:null,onAnimationComplete:null}),Je=Ze;Object.defineProperty(Ze.prototype,"animationObject",{get:function(){return this}}),Object.defineProperty(Ze.prototype,"chartInstance",{get:function(){return this.chart},set:function(e){this.chart=e}}),Ye._set("global",{animation:{duration:1e3,easing:"easeOutQuart",onProgress:Be.noop,onComplete:Be.noop}});var et={animations:[],request:null,addAnimation:function(e,t,n,r){var i,a,o=this.animations;for(t.chart=e,t.startTime=Date.now(),t.duration=n,r||(e.animating=!0),i=0,a=o.length;i<a;++i)if(o[i].chart===e)return void(o[i]=t);o.push(t),1===o.length&&this.requestAnimationFrame()},cancelAnimation:function(e){var t=Be.findIndex(this.animations,(function(t){return t.chart===e}));-1!==t&&(this.animations.splice(t,1),e.animating=!1)},requestAnimationFrame:function(){var e=this;null===e.request&&(e.request=Be.requestAnimFrame.call(window,(function(){e.request=null,e.startDigest()})))},startDigest:function(){var e=this;e.advance(),e.animations.length>0&&e.requestAnimationFrame()},advance:function(){for(var e,t,n,r,i=this.animations,a=0;a<i.length;)t=(e=i[a]).chart,n=e.numSteps,r=Math.floor((Date.now()-e.startTime)/e.duration*n)+1,e.currentStep=Math.min(r,n),Be.callback(e.render,[t,e],t),Be.callback(e.onAnimationProgress,[e],t),e.currentStep>=n?(Be.callback(e.onAnimationComplete,[e],t),t.animating=!1,i.splice(a,1)):++a}},tt=Be.options.resolve,nt=["push","pop","shift","splice","unshift"];function rt(e,t){e._chartjs?e._chartjs.listeners.push(t):(Object.defineProperty(e,"_chartjs",{configurable:!0,enumerable:!1,value:{listeners:[t]}}),nt.forEach((function(t){var n="onData"+t.charAt(0).toUpperCase()+t.slice(1),r=e[t];Object.defineProperty(e,t,{configurable:!0,enumerable:!1,value:function(){var t=Array.prototype.slice.call(arguments),i=r.apply(this,t);return Be.each(e._chartjs.listeners,(function(e){"function"===typeof e[n]&&e[n].apply(e,t)})),i}})})))}function it(e,t){var n=e._chartjs;if(n){var r=n.listeners,i=r.indexOf(t);-1!==i&&r.splice(i,1),r.length>0||(nt.forEach((function(t){delete e[t]})),delete e._chartjs)}}var at=function(e,t){this.initialize(e,t)};Be.extend(at.prototype,{datasetElementType:null,dataElementType:null,initialize:function(e,t){var n=this;n.chart=e,n.index=t,n.linkScales(),n.addElements()},updateIndex:function(e){this.index=e},linkScales:function(){var e=this,t=e.getMeta(),n=e.getDataset();null!==t.xAxisID&&t.xAxisID in e.chart.scales||(t.xAxisID=n.xAxisID||e.chart.options.scales.xAxes[0].id),null!==t.yAxisID&&t.yAxisID in e.chart.scales||(t.yAxisID=n.yAxisID||e.chart.options.scales.yAxes[0].id)},getDataset:function(){return this.chart.data.datasets[this.index]},getMeta:function(){return this.chart.getDatasetMeta(this.index)},getScaleForId:function(e){return this.chart.scales[e]},_getValueScaleId:function(){return this.getMeta().yAxisID},_getIndexScaleId:function(){return this.getMeta().xAxisID},_getValueScale:function(){return this.getScaleForId(this._getValueScaleId())},_getIndexScale:function(){return this.getScaleForId(this._getIndexScaleId())},reset:function(){this.update(!0)},destroy:function(){this._data&&it(this._data,this)},createMetaDataset:function(){var e=this,t=e.datasetElementType;return t&&new t({_chart:e.chart,_datasetIndex:e.index})},createMetaData:function(e){var t=this,n=t.dataElementType;return n&&new n({_chart:t.chart,_datasetIndex:t.index,_index:e})},addElements:function(){var e,t,n=this,r=n.getMeta(),i=n.getDataset().data||[],a=r.data;for(e=0,t=i.length;e<t;++e)a[e]=a[e]||n.createMetaData(e);r.dataset=r.dataset||n.createMetaDataset()},addElementAndReset:function(e){var t=this.createMetaData(e);this.getMeta().data.splice(e,0,t),this.updateElement(t,e,!0)},buildOrUpdateElements:function(){var e=this,t=e.getDataset(),n=t.data||(t.data=[]);e._data!==n&&(e._data&&it(e._data,e),n&&Object.isExtensible(n)&&rt(n,e),e._data=n),e.resyncElements()},update:Be.noop,transition:function(e){for(var t=this.getMeta(),n=t.data||[],r=n.length,i=0;i<r;++i)n[i].transition(e);t.dataset&&t.dataset.transition(e)},draw:function(){var e=this.getMeta(),t=e.data||[],n=t.length,r=0;for(e.dataset&&e.dataset.draw();r<n;++r)t[r].draw()},removeHoverStyle:function(e){Be.merge(e._model,e.$previousStyle||{}),delete e.$previousStyle},setHoverStyle:function(e){var t=this.chart.data.datasets[e._datasetIndex],n=e._index,r=e.custom||{},i=e._model,a=Be.getHoverColor;e.$previousStyle={backgroundColor:i.backgroundColor,borderColor:i.borderColor,borderWidth:i.borderWidth},i.backgroundColor=tt([r.hoverBackgroundColor,t.hoverBackgroundColor,a(i.backgroundColor)],void 0,n),i.borderColor=tt([r.hoverBorderColor,t.hoverBorderColor,a(i.borderColor)],void 0,n),i.borderWidth=tt([r.hoverBorderWidth,t.hoverBorderWidth,i.borderWidth],void 0,n)},resyncElements:function(){var e=this,t=e.getMeta(),n=e.getDataset().data,r=t.data.length,i=n.length;i<r?t.data.splice(i,r-i):i>r&&e.insertElements(r,i-r)},insertElements:function(e,t){for(var n=0;n<t;++n)this.addElementAndReset(e+n)},onDataPush:function(){var e=arguments.length;this.insertElements(this.getDataset().data.length-e,e)},onDataPop:function(){this.getMeta().data.pop()},onDataShift:function(){this.getMeta().data.shift()},onDataSplice:function(e,t){this.getMeta().data.splice(e,t),this.insertElements(e,arguments.length-2)},onDataUnshift:function(){this.insertElements(0,arguments.length)}}),at.extend=Be.inherits;var ot=at;Ye._set("global",{elements:{arc:{backgroundColor:Ye.global.defaultColor,borderColor:"#fff",borderWidth:2,borderAlign:"center"}}});var lt=Qe.extend({inLabelRange:function(e){var t=this._view;return!!t&&Math.pow(e-t.x,2)<Math.pow(t.radius+t.hoverRadius,2)},inRange:function(e,t){var n=this._view;if(n){for(var r=Be.getAngleFromPoint(n,{x:e,y:t}),i=r.angle,a=r.distance,o=n.startAngle,l=n.endAngle;l<o;)l+=2*Math.PI;for(;i>l;)i-=2*Math.PI;for(;i<o;)i+=2*Math.PI;var s=i>=o&&i<=l,u=a>=n.innerRadius&&a<=n.outerRadius;return s&&u}return!1},getCenterPoint:function(){var e=this._view,t=(e.startAngle+e.endAngle)/2,n=(e.innerRadius+e.outerRadius)/2;return{x:e.x+Math.cos(t)*n,y:e.y+Math.sin(t)*n}},getArea:function(){var e=this._view;return Math.PI*((e.endAngle-e.startAngle)/(2*Math.PI))*(Math.pow(e.outerRadius,2)-Math.pow(e.innerRadius,2))},tooltipPosition:function(){var e=this._view,t=e.startAngle+(e.endAngle-e.startAngle)/2,n=(e.outerRadius-e.innerRadius)/2+e.innerRadius;return{x:e.x+Math.cos(t)*n,y:e.y+Math.sin(t)*n}},draw:function(){var e,t=this._chart.ctx,n=this._view,r=n.startAngle,i=n.endAngle,a="inner"===n.borderAlign?.33:0;t.save(),t.beginPath(),t.arc(n.x,n.y,Math.max(n.outerRadius-a,0),r,i),t.arc(n.x,n.y,n.innerRadius,i,r,!0),t.closePath(),t.fillStyle=n.backgroundColor,t.fill(),n.borderWidth&&("inner"===n.borderAlign?(t.beginPath(),e=a/n.outerRadius,t.arc(n.x,n.y,n.outerRadius,r-e,i+e),n.innerRadius>a?(e=a/n.innerRadius,t.arc(n.x,n.y,n.innerRadius-a,i+e,r-e,!0)):t.arc(n.x,n.y,a,i+Math.PI/2,r-Math.PI/2),t.closePath(),t.clip(),t.beginPath(),t.arc(n.x,n.y,n.outerRadius,r,i),t.arc(n.x,n.y,n.innerRadius,i,r,!0),t.closePath(),t.lineWidth=2*n.borderWidth,t.lineJoin="round"):(t.lineWidth=n.borderWidth,t.lineJoin="bevel"),t.strokeStyle=n.borderColor,t.stroke()),t.restore()}}),st=Be.valueOrDefault,ut=Ye.global.defaultColor;Ye._set("global",{elements:{line:{tension:.4,backgroundColor:ut,borderWidth:3,borderColor:ut,borderCapStyle:"butt",borderDash:[],borderDashOffset:0,borderJoinStyle:"miter",capBezierPoints:!0,fill:!0}}});var ct=Qe.extend({draw:function(){var e,t,n,r,i=this,a=i._view,o=i._chart.ctx,l=a.spanGaps,s=i._children.slice(),u=Ye.global,c=u.elements.line,d=-1;for(i._loop&&s.length&&s.push(s[0]),o.save(),o.lineCap=a.borderCapStyle||c.borderCapStyle,o.setLineDash&&o.setLineDash(a.borderDash||c.borderDash),o.lineDashOffset=st(a.borderDashOffset,c.borderDashOffset),o.lineJoin=a.borderJoinStyle||c.borderJoinStyle,o.lineWidth=st(a.borderWidth,c.borderWidth),o.strokeStyle=a.borderColor||u.defaultColor,o.beginPath(),d=-1,e=0;e<s.length;++e)t=s[e],n=Be.previousItem(s,e),r=t._view,0===e?r.skip||(o.moveTo(r.x,r.y),d=e):(n=-1===d?n:s[d],r.skip||(d!==e-1&&!l||-1===d?o.moveTo(r.x,r.y):Be.canvas.lineTo(o,n._view,t._view),d=e));o.stroke(),o.restore()}}),dt=Be.valueOrDefault,ft=Ye.global.defaultColor;function ht(e){var t=this._view;return!!t&&Math.abs(e-t.x)<t.radius+t.hitRadius}function pt(e){var t=this._view;return!!t&&Math.abs(e-t.y)<t.radius+t.hitRadius}Ye._set("global",{elements:{point:{radius:3,pointStyle:"circle",backgroundColor:ft,borderColor:ft,borderWidth:1,hitRadius:1,hoverRadius:4,hoverBorderWidth:1}}});var gt=Qe.extend({inRange:function(e,t){var n=this._view;return!!n&&Math.pow(e-n.x,2)+Math.pow(t-n.y,2)<Math.pow(n.hitRadius+n.radius,2)},inLabelRange:ht,inXRange:ht,inYRange:pt,getCenterPoint:function(){var e=this._view;return{x:e.x,y:e.y}},getArea:function(){return Math.PI*Math.pow(this._view.radius,2)},tooltipPosition:function(){var e=this._view;return{x:e.x,y:e.y,padding:e.radius+e.borderWidth}},draw:function(e){var t=this._view,n=this._chart.ctx,r=t.pointStyle,i=t.rotation,a=t.radius,o=t.x,l=t.y,s=Ye.global,u=s.defaultColor;t.skip||(void 0===e||Be.canvas._isPointInArea(t,e))&&(n.strokeStyle=t.borderColor||u,n.lineWidth=dt(t.borderWidth,s.elements.point.borderWidth),n.fillStyle=t.backgroundColor||u,Be.canvas.drawPoint(n,r,a,o,l,i))}}),mt=Ye.global.defaultColor;function vt(e){return e&&void 0!==e.width}function yt(e){var t,n,r,i,a;return vt(e)?(a=e.width/2,t=e.x-a,n=e.x+a,r=Math.min(e.y,e.base),i=Math.max(e.y,e.base)):(a=e.height/2,t=Math.min(e.x,e.base),n=Math.max(e.x,e.base),r=e.y-a,i=e.y+a),{left:t,top:r,right:n,bottom:i}}function bt(e,t,n){return e===t?n:e===n?t:e}function xt(e){var t=e.borderSkipped,n={};return t?(e.horizontal?e.base>e.x&&(t=bt(t,"left","right")):e.base<e.y&&(t=bt(t,"bottom","top")),n[t]=!0,n):n}function wt(e,t,n){var r,i,a,o,l=e.borderWidth,s=xt(e);return Be.isObject(l)?(r=+l.top||0,i=+l.right||0,a=+l.bottom||0,o=+l.left||0):r=i=a=o=+l||0,{t:s.top||r<0?0:r>n?n:r,r:s.right||i<0?0:i>t?t:i,b:s.bottom||a<0?0:a>n?n:a,l:s.left||o<0?0:o>t?t:o}}function _t(e){var t=yt(e),n=t.right-t.left,r=t.bottom-t.top,i=wt(e,n/2,r/2);return{outer:{x:t.left,y:t.top,w:n,h:r},inner:{x:t.left+i.l,y:t.top+i.t,w:n-i.l-i.r,h:r-i.t-i.b}}}function kt(e,t,n){var r=null===t,i=null===n,a=!(!e||r&&i)&&yt(e);return a&&(r||t>=a.left&&t<=a.right)&&(i||n>=a.top&&n<=a.bottom)}Ye._set("global",{elements:{rectangle:{backgroundColor:mt,borderColor:mt,borderSkipped:"bottom",borderWidth:0}}});var St=Qe.extend({draw:function(){var e=this._chart.ctx,t=this._view,n=_t(t),r=n.outer,i=n.inner;e.fillStyle=t.backgroundColor,e.fillRect(r.x,r.y,r.w,r.h),r.w===i.w&&r.h===i.h||(e.save(),e.beginPath(),e.rect(r.x,r.y,r.w,r.h),e.clip(),e.fillStyle=t.borderColor,e.rect(i.x,i.y,i.w,i.h),e.fill("evenodd"),e.restore())},height:function(){var e=this._view;return e.base-e.y},inRange:function(e,t){return kt(this._view,e,t)},inLabelRange:function(e,t){var n=this._view;return vt(n)?kt(n,e,null):kt(n,null,t)},inXRange:function(e){return kt(this._view,e,null)},inYRange:function(e){return kt(this._view,null,e)},getCenterPoint:function(){var e,t,n=this._view;return vt(n)?(e=n.x,t=(n.y+n.base)/2):(e=(n.x+n.base)/2,t=n.y),{x:e,y:t}},getArea:function(){var e=this._view;return vt(e)?e.width*Math.abs(e.y-e.base):e.height*Math.abs(e.x-e.base)},tooltipPosition:function(){var e=this._view;return{x:e.x,y:e.y}}}),Mt={},Ct=lt,Et=ct,Ot=gt,Pt=St;Mt.Arc=Ct,Mt.Line=Et,Mt.Point=Ot,Mt.Rectangle=Pt;var Tt=Be.options.resolve;function Dt(e,t){var n,r,i,a,o=e.isHorizontal()?e.width:e.height,l=e.getTicks();for(i=1,a=t.length;i<a;++i)o=Math.min(o,Math.abs(t[i]-t[i-1]));for(i=0,a=l.length;i<a;++i)r=e.getPixelForTick(i),o=i>0?Math.min(o,r-n):o,n=r;return o}function Nt(e,t,n){var r,i,a=n.barThickness,o=t.stackCount,l=t.pixels[e];return Be.isNullOrUndef(a)?(r=t.min*n.categoryPercentage,i=n.barPercentage):(r=a*o,i=1),{chunk:r/o,ratio:i,start:l-r/2}}function Rt(e,t,n){var r,i=t.pixels,a=i[e],o=e>0?i[e-1]:null,l=e<i.length-1?i[e+1]:null,s=n.categoryPercentage;return null===o&&(o=a-(null===l?t.end-t.start:l-a)),null===l&&(l=a+a-o),r=a-(a-Math.min(o,l))/2*s,{chunk:Math.abs(l-o)/2*s/t.stackCount,ratio:n.barPercentage,start:r}}Ye._set("bar",{hover:{mode:"label"},scales:{xAxes:[{type:"category",categoryPercentage:.8,barPercentage:.9,offset:!0,gridLines:{offsetGridLines:!0}}],yAxes:[{type:"linear"}]}});var At=ot.extend({dataElementType:Mt.Rectangle,initialize:function(){var e,t=this;ot.prototype.initialize.apply(t,arguments),(e=t.getMeta()).stack=t.getDataset().stack,e.bar=!0},update:function(e){var t,n,r=this,i=r.getMeta().data;for(r._ruler=r.getRuler(),t=0,n=i.length;t<n;++t)r.updateElement(i[t],t,e)},updateElement:function(e,t,n){var r=this,i=r.getMeta(),a=r.getDataset(),o=r._resolveElementOptions(e,t);e._xScale=r.getScaleForId(i.xAxisID),e._yScale=r.getScaleForId(i.yAxisID),e._datasetIndex=r.index,e._index=t,e._model={backgroundColor:o.backgroundColor,borderColor:o.borderColor,borderSkipped:o.borderSkipped,borderWidth:o.borderWidth,datasetLabel:a.label,label:r.chart.data.labels[t]},r._updateElementGeometry(e,t,n),e.pivot()},_updateElementGeometry:function(e,t,n){var r=this,i=e._model,a=r._getValueScale(),o=a.getBasePixel(),l=a.isHorizontal(),s=r._ruler||r.getRuler(),u=r.calculateBarValuePixels(r.index,t),c=r.calculateBarIndexPixels(r.index,t,s);i.horizontal=l,i.base=n?o:u.base,i.x=l?n?o:u.head:c.center,i.y=l?c.center:n?o:u.head,i.height=l?c.size:void 0,i.width=l?void 0:c.size},_getStacks:function(e){var t,n,r=this,i=r.chart,a=r._getIndexScale().options.stacked,o=void 0===e?i.data.datasets.length:e+1,l=[];for(t=0;t<o;++t)(n=i.getDatasetMeta(t)).bar&&i.isDatasetVisible(t)&&(!1===a||!0===a&&-1===l.indexOf(n.stack)||void 0===a&&(void 0===n.stack||-1===l.indexOf(n.stack)))&&l.push(n.stack);return l},getStackCount:function(){return this._getStacks().length},getStackIndex:function(e,t){var n=this._getStacks(e),r=void 0!==t?n.indexOf(t):-1;return-1===r?n.length-1:r},getRuler:function(){var e,t,n=this,r=n._getIndexScale(),i=n.getStackCount(),a=n.index,o=r.isHorizontal(),l=o?r.left:r.top,s=l+(o?r.width:r.height),u=[];for(e=0,t=n.getMeta().data.length;e<t;++e)u.push(r.getPixelForValue(null,e,a));return{min:Be.isNullOrUndef(r.options.barThickness)?Dt(r,u):-1,pixels:u,start:l,end:s,stackCount:i,scale:r}},calculateBarValuePixels:function(e,t){var n,r,i,a,o,l,s=this,u=s.chart,c=s.getMeta(),d=s._getValueScale(),f=d.isHorizontal(),h=u.data.datasets,p=+d.getRightValue(h[e].data[t]),g=d.options.minBarLength,m=d.options.stacked,v=c.stack,y=0;if(m||void 0===m&&void 0!==v)for(n=0;n<e;++n)(r=u.getDatasetMeta(n)).bar&&r.stack===v&&r.controller._getValueScaleId()===d.id&&u.isDatasetVisible(n)&&(i=+d.getRightValue(h[n].data[t]),(p<0&&i<0||p>=0&&i>0)&&(y+=i));return a=d.getPixelForValue(y),l=(o=d.getPixelForValue(y+p))-a,void 0!==g&&Math.abs(l)<g&&(l=g,o=p>=0&&!f||p<0&&f?a-g:a+g),{size:l,base:a,head:o,center:o+l/2}},calculateBarIndexPixels:function(e,t,n){var r=this,i=n.scale.options,a="flex"===i.barThickness?Rt(t,n,i):Nt(t,n,i),o=r.getStackIndex(e,r.getMeta().stack),l=a.start+a.chunk*o+a.chunk/2,s=Math.min(Be.valueOrDefault(i.maxBarThickness,1/0),a.chunk*a.ratio);return{base:l-s/2,head:l+s/2,center:l,size:s}},draw:function(){var e=this,t=e.chart,n=e._getValueScale(),r=e.getMeta().data,i=e.getDataset(),a=r.length,o=0;for(Be.canvas.clipArea(t.ctx,t.chartArea);o<a;++o)isNaN(n.getRightValue(i.data[o]))||r[o].draw();Be.canvas.unclipArea(t.ctx)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.rectangle,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderSkipped","borderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Tt([s[i],l[i],u[i]],d,t);return c}}),It=Be.valueOrDefault,Lt=Be.options.resolve;Ye._set("bubble",{hover:{mode:"single"},scales:{xAxes:[{type:"linear",position:"bottom",id:"x-axis-0"}],yAxes:[{type:"linear",position:"left",id:"y-axis-0"}]},tooltips:{callbacks:{title:function(){return""},label:function(e,t){var n=t.datasets[e.datasetIndex].label||"",r=t.datasets[e.datasetIndex].data[e.index];return n+": ("+e.xLabel+", "+e.yLabel+", "+r.r+")"}}}});var jt=ot.extend({dataElementType:Mt.Point,update:function(e){var t=this,n=t.getMeta().data;Be.each(n,(function(n,r){t.updateElement(n,r,e)}))},updateElement:function(e,t,n){var r=this,i=r.getMeta(),a=e.custom||{},o=r.getScaleForId(i.xAxisID),l=r.getScaleForId(i.yAxisID),s=r._resolveElementOptions(e,t),u=r.getDataset().data[t],c=r.index,d=n?o.getPixelForDecimal(.5):o.getPixelForValue("object"===typeof u?u:NaN,t,c),f=n?l.getBasePixel():l.getPixelForValue(u,t,c);e._xScale=o,e._yScale=l,e._options=s,e._datasetIndex=c,e._index=t,e._model={backgroundColor:s.backgroundColor,borderColor:s.borderColor,borderWidth:s.borderWidth,hitRadius:s.hitRadius,pointStyle:s.pointStyle,rotation:s.rotation,radius:n?0:s.radius,skip:a.skip||isNaN(d)||isNaN(f),x:d,y:f},e.pivot()},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=It(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=It(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=It(n.hoverBorderWidth,n.borderWidth),t.radius=n.radius+n.hoverRadius},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c=l.data[t],d={},f={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},h=["backgroundColor","borderColor","borderWidth","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth","hoverRadius","hitRadius","pointStyle","rotation"];for(n=0,r=h.length;n<r;++n)d[i=h[n]]=Lt([s[i],l[i],u[i]],f,t);return d.radius=Lt([s.radius,c?c.r:void 0,l.radius,u.radius],f,t),d}}),Ft=Be.options.resolve,zt=Be.valueOrDefault;Ye._set("doughnut",{animation:{animateRotate:!0,animateScale:!1},hover:{mode:"single"},legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');var n=e.data,r=n.datasets,i=n.labels;if(r.length)for(var a=0;a<r[0].data.length;++a)t.push('<li><span style="background-color:'+r[0].backgroundColor[a]+'"></span>'),i[a]&&t.push(i[a]),t.push("</li>");return t.push("</ul>"),t.join("")},legend:{labels:{generateLabels:function(e){var t=e.data;return t.labels.length&&t.datasets.length?t.labels.map((function(n,r){var i=e.getDatasetMeta(0),a=t.datasets[0],o=i.data[r],l=o&&o.custom||{},s=e.options.elements.arc;return{text:n,fillStyle:Ft([l.backgroundColor,a.backgroundColor,s.backgroundColor],void 0,r),strokeStyle:Ft([l.borderColor,a.borderColor,s.borderColor],void 0,r),lineWidth:Ft([l.borderWidth,a.borderWidth,s.borderWidth],void 0,r),hidden:isNaN(a.data[r])||i.data[r].hidden,index:r}})):[]}},onClick:function(e,t){var n,r,i,a=t.index,o=this.chart;for(n=0,r=(o.data.datasets||[]).length;n<r;++n)(i=o.getDatasetMeta(n)).data[a]&&(i.data[a].hidden=!i.data[a].hidden);o.update()}},cutoutPercentage:50,rotation:-.5*Math.PI,circumference:2*Math.PI,tooltips:{callbacks:{title:function(){return""},label:function(e,t){var n=t.labels[e.index],r=": "+t.datasets[e.datasetIndex].data[e.index];return Be.isArray(n)?(n=n.slice())[0]+=r:n+=r,n}}}});var Wt=ot.extend({dataElementType:Mt.Arc,linkScales:Be.noop,getRingIndex:function(e){for(var t=0,n=0;n<e;++n)this.chart.isDatasetVisible(n)&&++t;return t},update:function(e){var t,n,r=this,i=r.chart,a=i.chartArea,o=i.options,l=a.right-a.left,s=a.bottom-a.top,u=Math.min(l,s),c={x:0,y:0},d=r.getMeta(),f=d.data,h=o.cutoutPercentage,p=o.circumference,g=r._getRingWeight(r.index);if(p<2*Math.PI){var m=o.rotation%(2*Math.PI),v=(m+=2*Math.PI*(m>=Math.PI?-1:m<-Math.PI?1:0))+p,y={x:Math.cos(m),y:Math.sin(m)},b={x:Math.cos(v),y:Math.sin(v)},x=m<=0&&v>=0||m<=2*Math.PI&&2*Math.PI<=v,w=m<=.5*Math.PI&&.5*Math.PI<=v||m<=2.5*Math.PI&&2.5*Math.PI<=v,_=m<=-Math.PI&&-Math.PI<=v||m<=Math.PI&&Math.PI<=v,k=m<=.5*-Math.PI&&.5*-Math.PI<=v||m<=1.5*Math.PI&&1.5*Math.PI<=v,S=h/100,M={x:_?-1:Math.min(y.x*(y.x<0?1:S),b.x*(b.x<0?1:S)),y:k?-1:Math.min(y.y*(y.y<0?1:S),b.y*(b.y<0?1:S))},C={x:x?1:Math.max(y.x*(y.x>0?1:S),b.x*(b.x>0?1:S)),y:w?1:Math.max(y.y*(y.y>0?1:S),b.y*(b.y>0?1:S))},E={width:.5*(C.x-M.x),height:.5*(C.y-M.y)};u=Math.min(l/E.width,s/E.height),c={x:-.5*(C.x+M.x),y:-.5*(C.y+M.y)}}for(t=0,n=f.length;t<n;++t)f[t]._options=r._resolveElementOptions(f[t],t);for(i.borderWidth=r.getMaxBorderWidth(),i.outerRadius=Math.max((u-i.borderWidth)/2,0),i.innerRadius=Math.max(h?i.outerRadius/100*h:0,0),i.radiusLength=(i.outerRadius-i.innerRadius)/(r._getVisibleDatasetWeightTotal()||1),i.offsetX=c.x*i.outerRadius,i.offsetY=c.y*i.outerRadius,d.total=r.calculateTotal(),r.outerRadius=i.outerRadius-i.radiusLength*r._getRingWeightOffset(r.index),r.innerRadius=Math.max(r.outerRadius-i.radiusLength*g,0),t=0,n=f.length;t<n;++t)r.updateElement(f[t],t,e)},updateElement:function(e,t,n){var r=this,i=r.chart,a=i.chartArea,o=i.options,l=o.animation,s=(a.left+a.right)/2,u=(a.top+a.bottom)/2,c=o.rotation,d=o.rotation,f=r.getDataset(),h=n&&l.animateRotate||e.hidden?0:r.calculateCircumference(f.data[t])*(o.circumference/(2*Math.PI)),p=n&&l.animateScale?0:r.innerRadius,g=n&&l.animateScale?0:r.outerRadius,m=e._options||{};Be.extend(e,{_datasetIndex:r.index,_index:t,_model:{backgroundColor:m.backgroundColor,borderColor:m.borderColor,borderWidth:m.borderWidth,borderAlign:m.borderAlign,x:s+i.offsetX,y:u+i.offsetY,startAngle:c,endAngle:d,circumference:h,outerRadius:g,innerRadius:p,label:Be.valueAtIndexOrDefault(f.label,t,i.data.labels[t])}});var v=e._model;n&&l.animateRotate||(v.startAngle=0===t?o.rotation:r.getMeta().data[t-1]._model.endAngle,v.endAngle=v.startAngle+v.circumference),e.pivot()},calculateTotal:function(){var e,t=this.getDataset(),n=this.getMeta(),r=0;return Be.each(n.data,(function(n,i){e=t.data[i],isNaN(e)||n.hidden||(r+=Math.abs(e))})),r},calculateCircumference:function(e){var t=this.getMeta().total;return t>0&&!isNaN(e)?2*Math.PI*(Math.abs(e)/t):0},getMaxBorderWidth:function(e){var t,n,r,i,a,o,l,s,u=this,c=0,d=u.chart;if(!e)for(t=0,n=d.data.datasets.length;t<n;++t)if(d.isDatasetVisible(t)){e=(r=d.getDatasetMeta(t)).data,t!==u.index&&(a=r.controller);break}if(!e)return 0;for(t=0,n=e.length;t<n;++t)i=e[t],"inner"!==(o=a?a._resolveElementOptions(i,t):i._options).borderAlign&&(l=o.borderWidth,c=(s=o.hoverBorderWidth)>(c=l>c?l:c)?s:c);return c},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth},t.backgroundColor=zt(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=zt(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=zt(n.hoverBorderWidth,n.borderWidth)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=a.getDataset(),s=e.custom||{},u=o.options.elements.arc,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderWidth","borderAlign","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Ft([s[i],l[i],u[i]],d,t);return c},_getRingWeightOffset:function(e){for(var t=0,n=0;n<e;++n)this.chart.isDatasetVisible(n)&&(t+=this._getRingWeight(n));return t},_getRingWeight:function(e){return Math.max(zt(this.chart.data.datasets[e].weight,1),0)},_getVisibleDatasetWeightTotal:function(){return this._getRingWeightOffset(this.chart.data.datasets.length)}});Ye._set("horizontalBar",{hover:{mode:"index",axis:"y"},scales:{xAxes:[{type:"linear",position:"bottom"}],yAxes:[{type:"category",position:"left",categoryPercentage:.8,barPercentage:.9,offset:!0,gridLines:{offsetGridLines:!0}}]},elements:{rectangle:{borderSkipped:"left"}},tooltips:{mode:"index",axis:"y"}});var Yt=At.extend({_getValueScaleId:function(){return this.getMeta().xAxisID},_getIndexScaleId:function(){return this.getMeta().yAxisID}}),Ht=Be.valueOrDefault,Ut=Be.options.resolve,Vt=Be.canvas._isPointInArea;function Bt(e,t){return Ht(e.showLine,t.showLines)}Ye._set("line",{showLines:!0,spanGaps:!1,hover:{mode:"label"},scales:{xAxes:[{type:"category",id:"x-axis-0"}],yAxes:[{type:"linear",id:"y-axis-0"}]}});var $t=ot.extend({datasetElementType:Mt.Line,dataElementType:Mt.Point,update:function(e){var t,n,r=this,i=r.getMeta(),a=i.dataset,o=i.data||[],l=r.getScaleForId(i.yAxisID),s=r.getDataset(),u=Bt(s,r.chart.options);for(u&&(void 0!==s.tension&&void 0===s.lineTension&&(s.lineTension=s.tension),a._scale=l,a._datasetIndex=r.index,a._children=o,a._model=r._resolveLineOptions(a),a.pivot()),t=0,n=o.length;t<n;++t)r.updateElement(o[t],t,e);for(u&&0!==a._model.tension&&r.updateBezierControlPoints(),t=0,n=o.length;t<n;++t)o[t].pivot()},updateElement:function(e,t,n){var r,i,a=this,o=a.getMeta(),l=e.custom||{},s=a.getDataset(),u=a.index,c=s.data[t],d=a.getScaleForId(o.yAxisID),f=a.getScaleForId(o.xAxisID),h=o.dataset._model,p=a._resolvePointOptions(e,t);r=f.getPixelForValue("object"===typeof c?c:NaN,t,u),i=n?d.getBasePixel():a.calculatePointY(c,t,u),e._xScale=f,e._yScale=d,e._options=p,e._datasetIndex=u,e._index=t,e._model={x:r,y:i,skip:l.skip||isNaN(r)||isNaN(i),radius:p.radius,pointStyle:p.pointStyle,rotation:p.rotation,backgroundColor:p.backgroundColor,borderColor:p.borderColor,borderWidth:p.borderWidth,tension:Ht(l.tension,h?h.tension:0),steppedLine:!!h&&h.steppedLine,hitRadius:p.hitRadius}},_resolvePointOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f={backgroundColor:"pointBackgroundColor",borderColor:"pointBorderColor",borderWidth:"pointBorderWidth",hitRadius:"pointHitRadius",hoverBackgroundColor:"pointHoverBackgroundColor",hoverBorderColor:"pointHoverBorderColor",hoverBorderWidth:"pointHoverBorderWidth",hoverRadius:"pointHoverRadius",pointStyle:"pointStyle",radius:"pointRadius",rotation:"pointRotation"},h=Object.keys(f);for(n=0,r=h.length;n<r;++n)c[i=h[n]]=Ut([s[i],l[f[i]],l[i],u[i]],d,t);return c},_resolveLineOptions:function(e){var t,n,r,i=this,a=i.chart,o=a.data.datasets[i.index],l=e.custom||{},s=a.options,u=s.elements.line,c={},d=["backgroundColor","borderWidth","borderColor","borderCapStyle","borderDash","borderDashOffset","borderJoinStyle","fill","cubicInterpolationMode"];for(t=0,n=d.length;t<n;++t)c[r=d[t]]=Ut([l[r],o[r],u[r]]);return c.spanGaps=Ht(o.spanGaps,s.spanGaps),c.tension=Ht(o.lineTension,u.tension),c.steppedLine=Ut([l.steppedLine,o.steppedLine,u.stepped]),c},calculatePointY:function(e,t,n){var r,i,a,o=this,l=o.chart,s=o.getMeta(),u=o.getScaleForId(s.yAxisID),c=0,d=0;if(u.options.stacked){for(r=0;r<n;r++)if(i=l.data.datasets[r],"line"===(a=l.getDatasetMeta(r)).type&&a.yAxisID===u.id&&l.isDatasetVisible(r)){var f=Number(u.getRightValue(i.data[t]));f<0?d+=f||0:c+=f||0}var h=Number(u.getRightValue(e));return h<0?u.getPixelForValue(d+h):u.getPixelForValue(c+h)}return u.getPixelForValue(e)},updateBezierControlPoints:function(){var e,t,n,r,i=this,a=i.chart,o=i.getMeta(),l=o.dataset._model,s=a.chartArea,u=o.data||[];function c(e,t,n){return Math.max(Math.min(e,n),t)}if(l.spanGaps&&(u=u.filter((function(e){return!e._model.skip}))),"monotone"===l.cubicInterpolationMode)Be.splineCurveMonotone(u);else for(e=0,t=u.length;e<t;++e)n=u[e]._model,r=Be.splineCurve(Be.previousItem(u,e)._model,n,Be.nextItem(u,e)._model,l.tension),n.controlPointPreviousX=r.previous.x,n.controlPointPreviousY=r.previous.y,n.controlPointNextX=r.next.x,n.controlPointNextY=r.next.y;if(a.options.elements.line.capBezierPoints)for(e=0,t=u.length;e<t;++e)n=u[e]._model,Vt(n,s)&&(e>0&&Vt(u[e-1]._model,s)&&(n.controlPointPreviousX=c(n.controlPointPreviousX,s.left,s.right),n.controlPointPreviousY=c(n.controlPointPreviousY,s.top,s.bottom)),e<u.length-1&&Vt(u[e+1]._model,s)&&(n.controlPointNextX=c(n.controlPointNextX,s.left,s.right),n.controlPointNextY=c(n.controlPointNextY,s.top,s.bottom)))},draw:function(){var e,t=this,n=t.chart,r=t.getMeta(),i=r.data||[],a=n.chartArea,o=i.length,l=0;for(Bt(t.getDataset(),n.options)&&(e=(r.dataset._model.borderWidth||0)/2,Be.canvas.clipArea(n.ctx,{left:a.left,right:a.right,top:a.top-e,bottom:a.bottom+e}),r.dataset.draw(),Be.canvas.unclipArea(n.ctx));l<o;++l)i[l].draw(a)},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=Ht(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=Ht(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=Ht(n.hoverBorderWidth,n.borderWidth),t.radius=Ht(n.hoverRadius,n.radius)}}),Xt=Be.options.resolve;Ye._set("polarArea",{scale:{type:"radialLinear",angleLines:{display:!1},gridLines:{circular:!0},pointLabels:{display:!1},ticks:{beginAtZero:!0}},animation:{animateRotate:!0,animateScale:!0},startAngle:-.5*Math.PI,legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');var n=e.data,r=n.datasets,i=n.labels;if(r.length)for(var a=0;a<r[0].data.length;++a)t.push('<li><span style="background-color:'+r[0].backgroundColor[a]+'"></span>'),i[a]&&t.push(i[a]),t.push("</li>");return t.push("</ul>"),t.join("")},legend:{labels:{generateLabels:function(e){var t=e.data;return t.labels.length&&t.datasets.length?t.labels.map((function(n,r){var i=e.getDatasetMeta(0),a=t.datasets[0],o=i.data[r].custom||{},l=e.options.elements.arc;return{text:n,fillStyle:Xt([o.backgroundColor,a.backgroundColor,l.backgroundColor],void 0,r),strokeStyle:Xt([o.borderColor,a.borderColor,l.borderColor],void 0,r),lineWidth:Xt([o.borderWidth,a.borderWidth,l.borderWidth],void 0,r),hidden:isNaN(a.data[r])||i.data[r].hidden,index:r}})):[]}},onClick:function(e,t){var n,r,i,a=t.index,o=this.chart;for(n=0,r=(o.data.datasets||[]).length;n<r;++n)(i=o.getDatasetMeta(n)).data[a].hidden=!i.data[a].hidden;o.update()}},tooltips:{callbacks:{title:function(){return""},label:function(e,t){return t.labels[e.index]+": "+e.yLabel}}}});var qt=ot.extend({dataElementType:Mt.Arc,linkScales:Be.noop,update:function(e){var t,n,r,i=this,a=i.getDataset(),o=i.getMeta(),l=i.chart.options.startAngle||0,s=i._starts=[],u=i._angles=[],c=o.data;for(i._updateRadius(),o.count=i.countVisibleElements(),t=0,n=a.data.length;t<n;t++)s[t]=l,r=i._computeAngle(t),u[t]=r,l+=r;for(t=0,n=c.length;t<n;++t)c[t]._options=i._resolveElementOptions(c[t],t),i.updateElement(c[t],t,e)},_updateRadius:function(){var e=this,t=e.chart,n=t.chartArea,r=t.options,i=Math.min(n.right-n.left,n.bottom-n.top);t.outerRadius=Math.max(i/2,0),t.innerRadius=Math.max(r.cutoutPercentage?t.outerRadius/100*r.cutoutPercentage:1,0),t.radiusLength=(t.outerRadius-t.innerRadius)/t.getVisibleDatasetCount(),e.outerRadius=t.outerRadius-t.radiusLength*e.index,e.innerRadius=e.outerRadius-t.radiusLength},updateElement:function(e,t,n){var r=this,i=r.chart,a=r.getDataset(),o=i.options,l=o.animation,s=i.scale,u=i.data.labels,c=s.xCenter,d=s.yCenter,f=o.startAngle,h=e.hidden?0:s.getDistanceFromCenterForValue(a.data[t]),p=r._starts[t],g=p+(e.hidden?0:r._angles[t]),m=l.animateScale?0:s.getDistanceFromCenterForValue(a.data[t]),v=e._options||{};Be.extend(e,{_datasetIndex:r.index,_index:t,_scale:s,_model:{backgroundColor:v.backgroundColor,borderColor:v.borderColor,borderWidth:v.borderWidth,borderAlign:v.borderAlign,x:c,y:d,innerRadius:0,outerRadius:n?m:h,startAngle:n&&l.animateRotate?f:p,endAngle:n&&l.animateRotate?f:g,label:Be.valueAtIndexOrDefault(u,t,u[t])}}),e.pivot()},countVisibleElements:function(){var e=this.getDataset(),t=this.getMeta(),n=0;return Be.each(t.data,(function(t,r){isNaN(e.data[r])||t.hidden||n++})),n},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor,i=Be.valueOrDefault;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth},t.backgroundColor=i(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=i(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=i(n.hoverBorderWidth,n.borderWidth)},_resolveElementOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=a.getDataset(),s=e.custom||{},u=o.options.elements.arc,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f=["backgroundColor","borderColor","borderWidth","borderAlign","hoverBackgroundColor","hoverBorderColor","hoverBorderWidth"];for(n=0,r=f.length;n<r;++n)c[i=f[n]]=Xt([s[i],l[i],u[i]],d,t);return c},_computeAngle:function(e){var t=this,n=this.getMeta().count,r=t.getDataset(),i=t.getMeta();if(isNaN(r.data[e])||i.data[e].hidden)return 0;var a={chart:t.chart,dataIndex:e,dataset:r,datasetIndex:t.index};return Xt([t.chart.options.elements.arc.angle,2*Math.PI/n],a,e)}});Ye._set("pie",Be.clone(Ye.doughnut)),Ye._set("pie",{cutoutPercentage:0});var Gt=Wt,Kt=Be.valueOrDefault,Qt=Be.options.resolve;Ye._set("radar",{scale:{type:"radialLinear"},elements:{line:{tension:0}}});var Zt=ot.extend({datasetElementType:Mt.Line,dataElementType:Mt.Point,linkScales:Be.noop,update:function(e){var t,n,r=this,i=r.getMeta(),a=i.dataset,o=i.data||[],l=r.chart.scale,s=r.getDataset();for(void 0!==s.tension&&void 0===s.lineTension&&(s.lineTension=s.tension),a._scale=l,a._datasetIndex=r.index,a._children=o,a._loop=!0,a._model=r._resolveLineOptions(a),a.pivot(),t=0,n=o.length;t<n;++t)r.updateElement(o[t],t,e);for(r.updateBezierControlPoints(),t=0,n=o.length;t<n;++t)o[t].pivot()},updateElement:function(e,t,n){var r=this,i=e.custom||{},a=r.getDataset(),o=r.chart.scale,l=o.getPointPositionForValue(t,a.data[t]),s=r._resolvePointOptions(e,t),u=r.getMeta().dataset._model,c=n?o.xCenter:l.x,d=n?o.yCenter:l.y;e._scale=o,e._options=s,e._datasetIndex=r.index,e._index=t,e._model={x:c,y:d,skip:i.skip||isNaN(c)||isNaN(d),radius:s.radius,pointStyle:s.pointStyle,rotation:s.rotation,backgroundColor:s.backgroundColor,borderColor:s.borderColor,borderWidth:s.borderWidth,tension:Kt(i.tension,u?u.tension:0),hitRadius:s.hitRadius}},_resolvePointOptions:function(e,t){var n,r,i,a=this,o=a.chart,l=o.data.datasets[a.index],s=e.custom||{},u=o.options.elements.point,c={},d={chart:o,dataIndex:t,dataset:l,datasetIndex:a.index},f={backgroundColor:"pointBackgroundColor",borderColor:"pointBorderColor",borderWidth:"pointBorderWidth",hitRadius:"pointHitRadius",hoverBackgroundColor:"pointHoverBackgroundColor",hoverBorderColor:"pointHoverBorderColor",hoverBorderWidth:"pointHoverBorderWidth",hoverRadius:"pointHoverRadius",pointStyle:"pointStyle",radius:"pointRadius",rotation:"pointRotation"},h=Object.keys(f);for(n=0,r=h.length;n<r;++n)c[i=h[n]]=Qt([s[i],l[f[i]],l[i],u[i]],d,t);return c},_resolveLineOptions:function(e){var t,n,r,i=this,a=i.chart,o=a.data.datasets[i.index],l=e.custom||{},s=a.options.elements.line,u={},c=["backgroundColor","borderWidth","borderColor","borderCapStyle","borderDash","borderDashOffset","borderJoinStyle","fill"];for(t=0,n=c.length;t<n;++t)u[r=c[t]]=Qt([l[r],o[r],s[r]]);return u.tension=Kt(o.lineTension,s.tension),u},updateBezierControlPoints:function(){var e,t,n,r,i=this,a=i.getMeta(),o=i.chart.chartArea,l=a.data||[];function s(e,t,n){return Math.max(Math.min(e,n),t)}for(e=0,t=l.length;e<t;++e)n=l[e]._model,r=Be.splineCurve(Be.previousItem(l,e,!0)._model,n,Be.nextItem(l,e,!0)._model,n.tension),n.controlPointPreviousX=s(r.previous.x,o.left,o.right),n.controlPointPreviousY=s(r.previous.y,o.top,o.bottom),n.controlPointNextX=s(r.next.x,o.left,o.right),n.controlPointNextY=s(r.next.y,o.top,o.bottom)},setHoverStyle:function(e){var t=e._model,n=e._options,r=Be.getHoverColor;e.$previousStyle={backgroundColor:t.backgroundColor,borderColor:t.borderColor,borderWidth:t.borderWidth,radius:t.radius},t.backgroundColor=Kt(n.hoverBackgroundColor,r(n.backgroundColor)),t.borderColor=Kt(n.hoverBorderColor,r(n.borderColor)),t.borderWidth=Kt(n.hoverBorderWidth,n.borderWidth),t.radius=Kt(n.hoverRadius,n.radius)}});Ye._set("scatter",{hover:{mode:"single"},scales:{xAxes:[{id:"x-axis-1",type:"linear",position:"bottom"}],yAxes:[{id:"y-axis-1",type:"linear",position:"left"}]},showLines:!1,tooltips:{callbacks:{title:function(){return""},label:function(e){return"("+e.xLabel+", "+e.yLabel+")"}}}});var Jt={bar:At,bubble:jt,doughnut:Wt,horizontalBar:Yt,line:$t,polarArea:qt,pie:Gt,radar:Zt,scatter:$t};function en(e,t){return e.native?{x:e.x,y:e.y}:Be.getRelativePosition(e,t)}function tn(e,t){var n,r,i,a,o;for(r=0,a=e.data.datasets.length;r<a;++r)if(e.isDatasetVisible(r))for(i=0,o=(n=e.getDatasetMeta(r)).data.length;i<o;++i){var l=n.data[i];l._view.skip||t(l)}}function nn(e,t){var n=[];return tn(e,(function(e){e.inRange(t.x,t.y)&&n.push(e)})),n}function rn(e,t,n,r){var i=Number.POSITIVE_INFINITY,a=[];return tn(e,(function(e){if(!n||e.inRange(t.x,t.y)){var o=e.getCenterPoint(),l=r(t,o);l<i?(a=[e],i=l):l===i&&a.push(e)}})),a}function an(e){var t=-1!==e.indexOf("x"),n=-1!==e.indexOf("y");return function(e,r){var i=t?Math.abs(e.x-r.x):0,a=n?Math.abs(e.y-r.y):0;return Math.sqrt(Math.pow(i,2)+Math.pow(a,2))}}function on(e,t,n){var r=en(t,e);n.axis=n.axis||"x";var i=an(n.axis),a=n.intersect?nn(e,r):rn(e,r,!1,i),o=[];return a.length?(e.data.datasets.forEach((function(t,n){if(e.isDatasetVisible(n)){var r=e.getDatasetMeta(n).data[a[0]._index];r&&!r._view.skip&&o.push(r)}})),o):[]}var ln={modes:{single:function(e,t){var n=en(t,e),r=[];return tn(e,(function(e){if(e.inRange(n.x,n.y))return r.push(e),r})),r.slice(0,1)},label:on,index:on,dataset:function(e,t,n){var r=en(t,e);n.axis=n.axis||"xy";var i=an(n.axis),a=n.intersect?nn(e,r):rn(e,r,!1,i);return a.length>0&&(a=e.getDatasetMeta(a[0]._datasetIndex).data),a},"x-axis":function(e,t){return on(e,t,{intersect:!1})},point:function(e,t){return nn(e,en(t,e))},nearest:function(e,t,n){var r=en(t,e);n.axis=n.axis||"xy";var i=an(n.axis);return rn(e,r,n.intersect,i)},x:function(e,t,n){var r=en(t,e),i=[],a=!1;return tn(e,(function(e){e.inXRange(r.x)&&i.push(e),e.inRange(r.x,r.y)&&(a=!0)})),n.intersect&&!a&&(i=[]),i},y:function(e,t,n){var r=en(t,e),i=[],a=!1;return tn(e,(function(e){e.inYRange(r.y)&&i.push(e),e.inRange(r.x,r.y)&&(a=!0)})),n.intersect&&!a&&(i=[]),i}}};function sn(e,t){return Be.where(e,(function(e){return e.position===t}))}function un(e,t){e.forEach((function(e,t){return e._tmpIndex_=t,e})),e.sort((function(e,n){var r=t?n:e,i=t?e:n;return r.weight===i.weight?r._tmpIndex_-i._tmpIndex_:r.weight-i.weight})),e.forEach((function(e){delete e._tmpIndex_}))}function cn(e){var t=0,n=0,r=0,i=0;return Be.each(e,(function(e){if(e.getPadding){var a=e.getPadding();t=Math.max(t,a.top),n=Math.max(n,a.left),r=Math.max(r,a.bottom),i=Math.max(i,a.right)}})),{top:t,left:n,bottom:r,right:i}}function dn(e,t){Be.each(e,(function(e){t[e.position]+=e.isHorizontal()?e.height:e.width}))}Ye._set("global",{layout:{padding:{top:0,right:0,bottom:0,left:0}}});var fn={defaults:{},addBox:function(e,t){e.boxes||(e.boxes=[]),t.fullWidth=t.fullWidth||!1,t.position=t.position||"top",t.weight=t.weight||0,e.boxes.push(t)},removeBox:function(e,t){var n=e.boxes?e.boxes.indexOf(t):-1;-1!==n&&e.boxes.splice(n,1)},configure:function(e,t,n){for(var r,i=["fullWidth","position","weight"],a=i.length,o=0;o<a;++o)r=i[o],n.hasOwnProperty(r)&&(t[r]=n[r])},update:function(e,t,n){if(e){var r=e.options.layout||{},i=Be.options.toPadding(r.padding),a=i.left,o=i.right,l=i.top,s=i.bottom,u=sn(e.boxes,"left"),c=sn(e.boxes,"right"),d=sn(e.boxes,"top"),f=sn(e.boxes,"bottom"),h=sn(e.boxes,"chartArea");un(u,!0),un(c,!1),un(d,!0),un(f,!1);var p,g=u.concat(c),m=d.concat(f),v=g.concat(m),y=t-a-o,b=n-l-s,x=(t-y/2)/g.length,w=y,_=b,k={top:l,left:a,bottom:s,right:o},S=[];Be.each(v,D),p=cn(v),Be.each(g,N),dn(g,k),Be.each(m,N),dn(m,k),Be.each(g,R),dn(v,k={top:l,left:a,bottom:s,right:o});var M=Math.max(p.left-k.left,0);k.left+=M,k.right+=Math.max(p.right-k.right,0);var C=Math.max(p.top-k.top,0);k.top+=C,k.bottom+=Math.max(p.bottom-k.bottom,0);var E=n-k.top-k.bottom,O=t-k.left-k.right;O===w&&E===_||(Be.each(g,(function(e){e.height=E})),Be.each(m,(function(e){e.fullWidth||(e.width=O)})),_=E,w=O);var P=a+M,T=l+C;Be.each(u.concat(d),A),P+=w,T+=_,Be.each(c,A),Be.each(f,A),e.chartArea={left:k.left,top:k.top,right:k.left+w,bottom:k.top+_},Be.each(h,(function(t){t.left=e.chartArea.left,t.top=e.chartArea.top,t.right=e.chartArea.right,t.bottom=e.chartArea.bottom,t.update(w,_)}))}function D(e){var t,n=e.isHorizontal();n?(t=e.update(e.fullWidth?y:w,b/2),_-=t.height):(t=e.update(x,_),w-=t.width),S.push({horizontal:n,width:t.width,box:e})}function N(e){var t=Be.findNextWhere(S,(function(t){return t.box===e}));if(t)if(t.horizontal){var n={left:Math.max(k.left,p.left),right:Math.max(k.right,p.right),top:0,bottom:0};e.update(e.fullWidth?y:w,b/2,n)}else e.update(t.width,_)}function R(e){var t=Be.findNextWhere(S,(function(t){return t.box===e})),n={left:0,right:0,top:k.top,bottom:k.bottom};t&&e.update(t.width,_,n)}function A(e){e.isHorizontal()?(e.left=e.fullWidth?a:k.left,e.right=e.fullWidth?t-o:k.left+w,e.top=T,e.bottom=T+e.height,T=e.bottom):(e.left=P,e.right=P+e.width,e.top=k.top,e.bottom=k.top+_,P=e.right)}}},hn={acquireContext:function(e){return e&&e.canvas&&(e=e.canvas),e&&e.getContext("2d")||null}},pn="/*\n * DOM element rendering detection\n * https://davidwalsh.name/detect-node-insertion\n */\n@keyframes chartjs-render-animation {\n\tfrom { opacity: 0.99; }\n\tto { opacity: 1; }\n}\n\n.chartjs-render-monitor {\n\tanimation: chartjs-render-animation 0.001s;\n}\n\n/*\n * DOM element resizing detection\n * https://github.com/marcj/css-element-queries\n */\n.chartjs-size-monitor,\n.chartjs-size-monitor-expand,\n.chartjs-size-monitor-shrink {\n\tposition: absolute;\n\tdirection: ltr;\n\tleft: 0;\n\ttop: 0;\n\tright: 0;\n\tbottom: 0;\n\toverflow: hidden;\n\tpointer-events: none;\n\tvisibility: hidden;\n\tz-index: -1;\n}\n\n.chartjs-size-monitor-expand > div {\n\tposition: absolute;\n\twidth: 1000000px;\n\theight: 1000000px;\n\tleft: 0;\n\ttop: 0;\n}\n\n.chartjs-size-monitor-shrink > div {\n\tposition: absolute;\n\twidth: 200%;\n\theight: 200%;\n\tleft: 0;\n\ttop: 0;\n}\n";function gn(e){return e&&e.default||e}var mn=gn(Object.freeze({default:pn})),vn="$chartjs",yn="chartjs-",bn=yn+"size-monitor",xn=yn+"render-monitor",wn=yn+"render-animation",_n=["animationstart","webkitAnimationStart"],kn={touchstart:"mousedown",touchmove:"mousemove",touchend:"mouseup",pointerenter:"mouseenter",pointerdown:"mousedown",pointermove:"mousemove",pointerup:"mouseup",pointerleave:"mouseout",pointerout:"mouseout"};function Sn(e,t){var n=Be.getStyle(e,t),r=n&&n.match(/^(\d+)(\.\d+)?px$/);return r?Number(r[1]):void 0}function Mn(e,t){var n=e.style,r=e.getAttribute("height"),i=e.getAttribute("width");if(e[vn]={initial:{height:r,width:i,style:{display:n.display,height:n.height,width:n.width}}},n.display=n.display||"block",null===i||""===i){var a=Sn(e,"width");void 0!==a&&(e.width=a)}if(null===r||""===r)if(""===e.style.height)e.height=e.width/(t.options.aspectRatio||2);else{var o=Sn(e,"height");void 0!==a&&(e.height=o)}return e}var Cn=!!function(){var e=!1;try{var t=Object.defineProperty({},"passive",{get:function(){e=!0}});window.addEventListener("e",null,t)}catch(n){}return e}()&&{passive:!0};function En(e,t,n){e.addEventListener(t,n,Cn)}function On(e,t,n){e.removeEventListener(t,n,Cn)}function Pn(e,t,n,r,i){return{type:e,chart:t,native:i||null,x:void 0!==n?n:null,y:void 0!==r?r:null}}function Tn(e,t){var n=kn[e.type]||e.type,r=Be.getRelativePosition(e,t);return Pn(n,t,r.x,r.y,e)}function Dn(e,t){var n=!1,r=[];return function(){r=Array.prototype.slice.call(arguments),t=t||this,n||(n=!0,Be.requestAnimFrame.call(window,(function(){n=!1,e.apply(t,r)})))}}function Nn(e){var t=document.createElement("div");return t.className=e||"",t}function Rn(e){var t=1e6,n=Nn(bn),r=Nn(bn+"-expand"),i=Nn(bn+"-shrink");r.appendChild(Nn()),i.appendChild(Nn()),n.appendChild(r),n.appendChild(i),n._reset=function(){r.scrollLeft=t,r.scrollTop=t,i.scrollLeft=t,i.scrollTop=t};var a=function(){n._reset(),e()};return En(r,"scroll",a.bind(r,"expand")),En(i,"scroll",a.bind(i,"shrink")),n}function An(e,t){var n=e[vn]||(e[vn]={}),r=n.renderProxy=function(e){e.animationName===wn&&t()};Be.each(_n,(function(t){En(e,t,r)})),n.reflow=!!e.offsetParent,e.classList.add(xn)}function In(e){var t=e[vn]||{},n=t.renderProxy;n&&(Be.each(_n,(function(t){On(e,t,n)})),delete t.renderProxy),e.classList.remove(xn)}function Ln(e,t,n){var r=e[vn]||(e[vn]={}),i=r.resizer=Rn(Dn((function(){if(r.resizer){var i=n.options.maintainAspectRatio&&e.parentNode,a=i?i.clientWidth:0;t(Pn("resize",n)),i&&i.clientWidth<a&&n.canvas&&t(Pn("resize",n))}})));An(e,(function(){if(r.resizer){var t=e.parentNode;t&&t!==i.parentNode&&t.insertBefore(i,t.firstChild),i._reset()}}))}function jn(e){var t=e[vn]||{},n=t.resizer;delete t.resizer,In(e),n&&n.parentNode&&n.parentNode.removeChild(n)}function Fn(e,t){var n=e._style||document.createElement("style");e._style||(e._style=n,t="/* Chart.js */\n"+t,n.setAttribute("type","text/css"),document.getElementsByTagName("head")[0].appendChild(n)),n.appendChild(document.createTextNode(t))}var zn={disableCSSInjection:!1,_enabled:"undefined"!==typeof window&&"undefined"!==typeof document,_ensureLoaded:function(){this._loaded||(this._loaded=!0,this.disableCSSInjection||Fn(this,mn))},acquireContext:function(e,t){"string"===typeof e?e=document.getElementById(e):e.length&&(e=e[0]),e&&e.canvas&&(e=e.canvas);var n=e&&e.getContext&&e.getContext("2d");return this._ensureLoaded(),n&&n.canvas===e?(Mn(e,t),n):null},releaseContext:function(e){var t=e.canvas;if(t[vn]){var n=t[vn].initial;["height","width"].forEach((function(e){var r=n[e];Be.isNullOrUndef(r)?t.removeAttribute(e):t.setAttribute(e,r)})),Be.each(n.style||{},(function(e,n){t.style[n]=e})),t.width=t.width,delete t[vn]}},addEventListener:function(e,t,n){var r=e.canvas;if("resize"!==t){var i=n[vn]||(n[vn]={});En(r,t,(i.proxies||(i.proxies={}))[e.id+"_"+t]=function(t){n(Tn(t,e))})}else Ln(r,n,e)},removeEventListener:function(e,t,n){var r=e.canvas;if("resize"!==t){var i=((n[vn]||{}).proxies||{})[e.id+"_"+t];i&&On(r,t,i)}else jn(r)}};Be.addEvent=En,Be.removeEvent=On;var Wn=zn._enabled?zn:hn,Yn=Be.extend({initialize:function(){},acquireContext:function(){},releaseContext:function(){},addEventListener:function(){},removeEventListener:function(){}},Wn);Ye._set("global",{plugins:{}});var Hn={_plugins:[],_cacheId:0,register:function(e){var t=this._plugins;[].concat(e).forEach((function(e){-1===t.indexOf(e)&&t.push(e)})),this._cacheId++},unregister:function(e){var t=this._plugins;[].concat(e).forEach((function(e){var n=t.indexOf(e);-1!==n&&t.splice(n,1)})),this._cacheId++},clear:function(){this._plugins=[],this._cacheId++},count:function(){return this._plugins.length},getAll:function(){return this._plugins},notify:function(e,t,n){var r,i,a,o,l,s=this.descriptors(e),u=s.length;for(r=0;r<u;++r)if("function"===typeof(l=(a=(i=s[r]).plugin)[t])&&((o=[e].concat(n||[])).push(i.options),!1===l.apply(a,o)))return!1;return!0},descriptors:function(e){var t=e.$plugins||(e.$plugins={});if(t.id===this._cacheId)return t.descriptors;var n=[],r=[],i=e&&e.config||{},a=i.options&&i.options.plugins||{};return this._plugins.concat(i.plugins||[]).forEach((function(e){if(-1===n.indexOf(e)){var t=e.id,i=a[t];!1!==i&&(!0===i&&(i=Be.clone(Ye.global.plugins[t])),n.push(e),r.push({plugin:e,options:i||{}}))}})),t.descriptors=r,t.id=this._cacheId,r},_invalidate:function(e){delete e.$plugins}},Un={constructors:{},defaults:{},registerScaleType:function(e,t,n){this.constructors[e]=t,this.defaults[e]=Be.clone(n)},getScaleConstructor:function(e){return this.constructors.hasOwnProperty(e)?this.constructors[e]:void 0},getScaleDefaults:function(e){return this.defaults.hasOwnProperty(e)?Be.merge({},[Ye.scale,this.defaults[e]]):{}},updateScaleDefaults:function(e,t){var n=this;n.defaults.hasOwnProperty(e)&&(n.defaults[e]=Be.extend(n.defaults[e],t))},addScalesToLayout:function(e){Be.each(e.scales,(function(t){t.fullWidth=t.options.fullWidth,t.position=t.options.position,t.weight=t.options.weight,fn.addBox(e,t)}))}},Vn=Be.valueOrDefault;Ye._set("global",{tooltips:{enabled:!0,custom:null,mode:"nearest",position:"average",intersect:!0,backgroundColor:"rgba(0,0,0,0.8)",titleFontStyle:"bold",titleSpacing:2,titleMarginBottom:6,titleFontColor:"#fff",titleAlign:"left",bodySpacing:2,bodyFontColor:"#fff",bodyAlign:"left",footerFontStyle:"bold",footerSpacing:2,footerMarginTop:6,footerFontColor:"#fff",footerAlign:"left",yPadding:6,xPadding:6,caretPadding:2,caretSize:5,cornerRadius:6,multiKeyBackground:"#fff",displayColors:!0,borderColor:"rgba(0,0,0,0)",borderWidth:0,callbacks:{beforeTitle:Be.noop,title:function(e,t){var n="",r=t.labels,i=r?r.length:0;if(e.length>0){var a=e[0];a.label?n=a.label:a.xLabel?n=a.xLabel:i>0&&a.index<i&&(n=r[a.index])}return n},afterTitle:Be.noop,beforeBody:Be.noop,beforeLabel:Be.noop,label:function(e,t){var n=t.datasets[e.datasetIndex].label||"";return n&&(n+=": "),Be.isNullOrUndef(e.value)?n+=e.yLabel:n+=e.value,n},labelColor:function(e,t){var n=t.getDatasetMeta(e.datasetIndex).data[e.index]._view;return{borderColor:n.borderColor,backgroundColor:n.backgroundColor}},labelTextColor:function(){return this._options.bodyFontColor},afterLabel:Be.noop,afterBody:Be.noop,beforeFooter:Be.noop,footer:Be.noop,afterFooter:Be.noop}}});var Bn={average:function(e){if(!e.length)return!1;var t,n,r=0,i=0,a=0;for(t=0,n=e.length;t<n;++t){var o=e[t];if(o&&o.hasValue()){var l=o.tooltipPosition();r+=l.x,i+=l.y,++a}}return{x:r/a,y:i/a}},nearest:function(e,t){var n,r,i,a=t.x,o=t.y,l=Number.POSITIVE_INFINITY;for(n=0,r=e.length;n<r;++n){var s=e[n];if(s&&s.hasValue()){var u=s.getCenterPoint(),c=Be.distanceBetweenPoints(t,u);c<l&&(l=c,i=s)}}if(i){var d=i.tooltipPosition();a=d.x,o=d.y}return{x:a,y:o}}};function $n(e,t){return t&&(Be.isArray(t)?Array.prototype.push.apply(e,t):e.push(t)),e}function Xn(e){return("string"===typeof e||e instanceof String)&&e.indexOf("\n")>-1?e.split("\n"):e}function qn(e){var t=e._xScale,n=e._yScale||e._scale,r=e._index,i=e._datasetIndex,a=e._chart.getDatasetMeta(i).controller,o=a._getIndexScale(),l=a._getValueScale();return{xLabel:t?t.getLabelForIndex(r,i):"",yLabel:n?n.getLabelForIndex(r,i):"",label:o?""+o.getLabelForIndex(r,i):"",value:l?""+l.getLabelForIndex(r,i):"",index:r,datasetIndex:i,x:e._model.x,y:e._model.y}}function Gn(e){var t=Ye.global;return{xPadding:e.xPadding,yPadding:e.yPadding,xAlign:e.xAlign,yAlign:e.yAlign,bodyFontColor:e.bodyFontColor,_bodyFontFamily:Vn(e.bodyFontFamily,t.defaultFontFamily),_bodyFontStyle:Vn(e.bodyFontStyle,t.defaultFontStyle),_bodyAlign:e.bodyAlign,bodyFontSize:Vn(e.bodyFontSize,t.defaultFontSize),bodySpacing:e.bodySpacing,titleFontColor:e.titleFontColor,_titleFontFamily:Vn(e.titleFontFamily,t.defaultFontFamily),_titleFontStyle:Vn(e.titleFontStyle,t.defaultFontStyle),titleFontSize:Vn(e.titleFontSize,t.defaultFontSize),_titleAlign:e.titleAlign,titleSpacing:e.titleSpacing,titleMarginBottom:e.titleMarginBottom,footerFontColor:e.footerFontColor,_footerFontFamily:Vn(e.footerFontFamily,t.defaultFontFamily),_footerFontStyle:Vn(e.footerFontStyle,t.defaultFontStyle),footerFontSize:Vn(e.footerFontSize,t.defaultFontSize),_footerAlign:e.footerAlign,footerSpacing:e.footerSpacing,footerMarginTop:e.footerMarginTop,caretSize:e.caretSize,cornerRadius:e.cornerRadius,backgroundColor:e.backgroundColor,opacity:0,legendColorBackground:e.multiKeyBackground,displayColors:e.displayColors,borderColor:e.borderColor,borderWidth:e.borderWidth}}function Kn(e,t){var n=e._chart.ctx,r=2*t.yPadding,i=0,a=t.body,o=a.reduce((function(e,t){return e+t.before.length+t.lines.length+t.after.length}),0);o+=t.beforeBody.length+t.afterBody.length;var l=t.title.length,s=t.footer.length,u=t.titleFontSize,c=t.bodyFontSize,d=t.footerFontSize;r+=l*u,r+=l?(l-1)*t.titleSpacing:0,r+=l?t.titleMarginBottom:0,r+=o*c,r+=o?(o-1)*t.bodySpacing:0,r+=s?t.footerMarginTop:0,r+=s*d,r+=s?(s-1)*t.footerSpacing:0;var f=0,h=function(e){i=Math.max(i,n.measureText(e).width+f)};return n.font=Be.fontString(u,t._titleFontStyle,t._titleFontFamily),Be.each(t.title,h),n.font=Be.fontString(c,t._bodyFontStyle,t._bodyFontFamily),Be.each(t.beforeBody.concat(t.afterBody),h),f=t.displayColors?c+2:0,Be.each(a,(function(e){Be.each(e.before,h),Be.each(e.lines,h),Be.each(e.after,h)})),f=0,n.font=Be.fontString(d,t._footerFontStyle,t._footerFontFamily),Be.each(t.footer,h),{width:i+=2*t.xPadding,height:r}}function Qn(e,t){var n,r,i,a,o,l=e._model,s=e._chart,u=e._chart.chartArea,c="center",d="center";l.y<t.height?d="top":l.y>s.height-t.height&&(d="bottom");var f=(u.left+u.right)/2,h=(u.top+u.bottom)/2;"center"===d?(n=function(e){return e<=f},r=function(e){return e>f}):(n=function(e){return e<=t.width/2},r=function(e){return e>=s.width-t.width/2}),i=function(e){return e+t.width+l.caretSize+l.caretPadding>s.width},a=function(e){return e-t.width-l.caretSize-l.caretPadding<0},o=function(e){return e<=h?"top":"bottom"},n(l.x)?(c="left",i(l.x)&&(c="center",d=o(l.y))):r(l.x)&&(c="right",a(l.x)&&(c="center",d=o(l.y)));var p=e._options;return{xAlign:p.xAlign?p.xAlign:c,yAlign:p.yAlign?p.yAlign:d}}function Zn(e,t,n,r){var i=e.x,a=e.y,o=e.caretSize,l=e.caretPadding,s=e.cornerRadius,u=n.xAlign,c=n.yAlign,d=o+l,f=s+l;return"right"===u?i-=t.width:"center"===u&&((i-=t.width/2)+t.width>r.width&&(i=r.width-t.width),i<0&&(i=0)),"top"===c?a+=d:a-="bottom"===c?t.height+d:t.height/2,"center"===c?"left"===u?i+=d:"right"===u&&(i-=d):"left"===u?i-=f:"right"===u&&(i+=f),{x:i,y:a}}function Jn(e,t){return"center"===t?e.x+e.width/2:"right"===t?e.x+e.width-e.xPadding:e.x+e.xPadding}function er(e){return $n([],Xn(e))}var tr=Qe.extend({initialize:function(){this._model=Gn(this._options),this._lastActive=[]},getTitle:function(){var e=this,t=e._options.callbacks,n=t.beforeTitle.apply(e,arguments),r=t.title.apply(e,arguments),i=t.afterTitle.apply(e,arguments),a=[];return a=$n(a,Xn(n)),a=$n(a,Xn(r)),a=$n(a,Xn(i))},getBeforeBody:function(){return er(this._options.callbacks.beforeBody.apply(this,arguments))},getBody:function(e,t){var n=this,r=n._options.callbacks,i=[];return Be.each(e,(function(e){var a={before:[],lines:[],after:[]};$n(a.before,Xn(r.beforeLabel.call(n,e,t))),$n(a.lines,r.label.call(n,e,t)),$n(a.after,Xn(r.afterLabel.call(n,e,t))),i.push(a)})),i},getAfterBody:function(){return er(this._options.callbacks.afterBody.apply(this,arguments))},getFooter:function(){var e=this,t=e._options.callbacks,n=t.beforeFooter.apply(e,arguments),r=t.footer.apply(e,arguments),i=t.afterFooter.apply(e,arguments),a=[];return a=$n(a,Xn(n)),a=$n(a,Xn(r)),a=$n(a,Xn(i))},update:function(e){var t,n,r=this,i=r._options,a=r._model,o=r._model=Gn(i),l=r._active,s=r._data,u={xAlign:a.xAlign,yAlign:a.yAlign},c={x:a.x,y:a.y},d={width:a.width,height:a.height},f={x:a.caretX,y:a.caretY};if(l.length){o.opacity=1;var h=[],p=[];f=Bn[i.position].call(r,l,r._eventPosition);var g=[];for(t=0,n=l.length;t<n;++t)g.push(qn(l[t]));i.filter&&(g=g.filter((function(e){return i.filter(e,s)}))),i.itemSort&&(g=g.sort((function(e,t){return i.itemSort(e,t,s)}))),Be.each(g,(function(e){h.push(i.callbacks.labelColor.call(r,e,r._chart)),p.push(i.callbacks.labelTextColor.call(r,e,r._chart))})),o.title=r.getTitle(g,s),o.beforeBody=r.getBeforeBody(g,s),o.body=r.getBody(g,s),o.afterBody=r.getAfterBody(g,s),o.footer=r.getFooter(g,s),o.x=f.x,o.y=f.y,o.caretPadding=i.caretPadding,o.labelColors=h,o.labelTextColors=p,o.dataPoints=g,c=Zn(o,d=Kn(this,o),u=Qn(this,d),r._chart)}else o.opacity=0;return o.xAlign=u.xAlign,o.yAlign=u.yAlign,o.x=c.x,o.y=c.y,o.width=d.width,o.height=d.height,o.caretX=f.x,o.caretY=f.y,r._model=o,e&&i.custom&&i.custom.call(r,o),r},drawCaret:function(e,t){var n=this._chart.ctx,r=this._view,i=this.getCaretPosition(e,t,r);n.lineTo(i.x1,i.y1),n.lineTo(i.x2,i.y2),n.lineTo(i.x3,i.y3)},getCaretPosition:function(e,t,n){var r,i,a,o,l,s,u=n.caretSize,c=n.cornerRadius,d=n.xAlign,f=n.yAlign,h=e.x,p=e.y,g=t.width,m=t.height;if("center"===f)l=p+m/2,"left"===d?(i=(r=h)-u,a=r,o=l+u,s=l-u):(i=(r=h+g)+u,a=r,o=l-u,s=l+u);else if("left"===d?(r=(i=h+c+u)-u,a=i+u):"right"===d?(r=(i=h+g-c-u)-u,a=i+u):(r=(i=n.caretX)-u,a=i+u),"top"===f)l=(o=p)-u,s=o;else{l=(o=p+m)+u,s=o;var v=a;a=r,r=v}return{x1:r,x2:i,x3:a,y1:o,y2:l,y3:s}},drawTitle:function(e,t,n){var r=t.title;if(r.length){e.x=Jn(t,t._titleAlign),n.textAlign=t._titleAlign,n.textBaseline="top";var i,a,o=t.titleFontSize,l=t.titleSpacing;for(n.fillStyle=t.titleFontColor,n.font=Be.fontString(o,t._titleFontStyle,t._titleFontFamily),i=0,a=r.length;i<a;++i)n.fillText(r[i],e.x,e.y),e.y+=o+l,i+1===r.length&&(e.y+=t.titleMarginBottom-l)}},drawBody:function(e,t,n){var r,i=t.bodyFontSize,a=t.bodySpacing,o=t._bodyAlign,l=t.body,s=t.displayColors,u=t.labelColors,c=0,d=s?Jn(t,"left"):0;n.textAlign=o,n.textBaseline="top",n.font=Be.fontString(i,t._bodyFontStyle,t._bodyFontFamily),e.x=Jn(t,o);var f=function(t){n.fillText(t,e.x+c,e.y),e.y+=i+a};n.fillStyle=t.bodyFontColor,Be.each(t.beforeBody,f),c=s&&"right"!==o?"center"===o?i/2+1:i+2:0,Be.each(l,(function(a,o){r=t.labelTextColors[o],n.fillStyle=r,Be.each(a.before,f),Be.each(a.lines,(function(a){s&&(n.fillStyle=t.legendColorBackground,n.fillRect(d,e.y,i,i),n.lineWidth=1,n.strokeStyle=u[o].borderColor,n.strokeRect(d,e.y,i,i),n.fillStyle=u[o].backgroundColor,n.fillRect(d+1,e.y+1,i-2,i-2),n.fillStyle=r),f(a)})),Be.each(a.after,f)})),c=0,Be.each(t.afterBody,f),e.y-=a},drawFooter:function(e,t,n){var r=t.footer;r.length&&(e.x=Jn(t,t._footerAlign),e.y+=t.footerMarginTop,n.textAlign=t._footerAlign,n.textBaseline="top",n.fillStyle=t.footerFontColor,n.font=Be.fontString(t.footerFontSize,t._footerFontStyle,t._footerFontFamily),Be.each(r,(function(r){n.fillText(r,e.x,e.y),e.y+=t.footerFontSize+t.footerSpacing})))},drawBackground:function(e,t,n,r){n.fillStyle=t.backgroundColor,n.strokeStyle=t.borderColor,n.lineWidth=t.borderWidth;var i=t.xAlign,a=t.yAlign,o=e.x,l=e.y,s=r.width,u=r.height,c=t.cornerRadius;n.beginPath(),n.moveTo(o+c,l),"top"===a&&this.drawCaret(e,r),n.lineTo(o+s-c,l),n.quadraticCurveTo(o+s,l,o+s,l+c),"center"===a&&"right"===i&&this.drawCaret(e,r),n.lineTo(o+s,l+u-c),n.quadraticCurveTo(o+s,l+u,o+s-c,l+u),"bottom"===a&&this.drawCaret(e,r),n.lineTo(o+c,l+u),n.quadraticCurveTo(o,l+u,o,l+u-c),"center"===a&&"left"===i&&this.drawCaret(e,r),n.lineTo(o,l+c),n.quadraticCurveTo(o,l,o+c,l),n.closePath(),n.fill(),t.borderWidth>0&&n.stroke()},draw:function(){var e=this._chart.ctx,t=this._view;if(0!==t.opacity){var n={width:t.width,height:t.height},r={x:t.x,y:t.y},i=Math.abs(t.opacity<.001)?0:t.opacity,a=t.title.length||t.beforeBody.length||t.body.length||t.afterBody.length||t.footer.length;this._options.enabled&&a&&(e.save(),e.globalAlpha=i,this.drawBackground(r,t,e,n),r.y+=t.yPadding,this.drawTitle(r,t,e),this.drawBody(r,t,e),this.drawFooter(r,t,e),e.restore())}},handleEvent:function(e){var t=this,n=t._options,r=!1;return t._lastActive=t._lastActive||[],"mouseout"===e.type?t._active=[]:t._active=t._chart.getElementsAtEventForMode(e,n.mode,n),(r=!Be.arrayEquals(t._active,t._lastActive))&&(t._lastActive=t._active,(n.enabled||n.custom)&&(t._eventPosition={x:e.x,y:e.y},t.update(!0),t.pivot())),r}}),nr=Bn,rr=tr;rr.positioners=nr;var ir=Be.valueOrDefault;function ar(){return Be.merge({},[].slice.call(arguments),{merger:function(e,t,n,r){if("xAxes"===e||"yAxes"===e){var i,a,o,l=n[e].length;for(t[e]||(t[e]=[]),i=0;i<l;++i)o=n[e][i],a=ir(o.type,"xAxes"===e?"category":"linear"),i>=t[e].length&&t[e].push({}),!t[e][i].type||o.type&&o.type!==t[e][i].type?Be.merge(t[e][i],[Un.getScaleDefaults(a),o]):Be.merge(t[e][i],o)}else Be._merger(e,t,n,r)}})}function or(){return Be.merge({},[].slice.call(arguments),{merger:function(e,t,n,r){var i=t[e]||{},a=n[e];"scales"===e?t[e]=ar(i,a):"scale"===e?t[e]=Be.merge(i,[Un.getScaleDefaults(a.type),a]):Be._merger(e,t,n,r)}})}function lr(e){var t=(e=e||{}).data=e.data||{};return t.datasets=t.datasets||[],t.labels=t.labels||[],e.options=or(Ye.global,Ye[e.type],e.options||{}),e}function sr(e){var t=e.options;Be.each(e.scales,(function(t){fn.removeBox(e,t)})),t=or(Ye.global,Ye[e.config.type],t),e.options=e.config.options=t,e.ensureScalesHaveIDs(),e.buildOrUpdateScales(),e.tooltip._options=t.tooltips,e.tooltip.initialize()}function ur(e){return"top"===e||"bottom"===e}Ye._set("global",{elements:{},events:["mousemove","mouseout","click","touchstart","touchmove"],hover:{onHover:null,mode:"nearest",intersect:!0,animationDuration:400},onClick:null,maintainAspectRatio:!0,responsive:!0,responsiveAnimationDuration:0});var cr=function(e,t){return this.construct(e,t),this};Be.extend(cr.prototype,{construct:function(e,t){var n=this;t=lr(t);var r=Yn.acquireContext(e,t),i=r&&r.canvas,a=i&&i.height,o=i&&i.width;n.id=Be.uid(),n.ctx=r,n.canvas=i,n.config=t,n.width=o,n.height=a,n.aspectRatio=a?o/a:null,n.options=t.options,n._bufferedRender=!1,n.chart=n,n.controller=n,cr.instances[n.id]=n,Object.defineProperty(n,"data",{get:function(){return n.config.data},set:function(e){n.config.data=e}}),r&&i?(n.initialize(),n.update()):console.error("Failed to create chart: can't acquire context from the given item")},initialize:function(){var e=this;return Hn.notify(e,"beforeInit"),Be.retinaScale(e,e.options.devicePixelRatio),e.bindEvents(),e.options.responsive&&e.resize(!0),e.ensureScalesHaveIDs(),e.buildOrUpdateScales(),e.initToolTip(),Hn.notify(e,"afterInit"),e},clear:function(){return Be.canvas.clear(this),this},stop:function(){return et.cancelAnimation(this),this},resize:function(e){var t=this,n=t.options,r=t.canvas,i=n.maintainAspectRatio&&t.aspectRatio||null,a=Math.max(0,Math.floor(Be.getMaximumWidth(r))),o=Math.max(0,Math.floor(i?a/i:Be.getMaximumHeight(r)));if((t.width!==a||t.height!==o)&&(r.width=t.width=a,r.height=t.height=o,r.style.width=a+"px",r.style.height=o+"px",Be.retinaScale(t,n.devicePixelRatio),!e)){var l={width:a,height:o};Hn.notify(t,"resize",[l]),n.onResize&&n.onResize(t,l),t.stop(),t.update({duration:n.responsiveAnimationDuration})}},ensureScalesHaveIDs:function(){var e=this.options,t=e.scales||{},n=e.scale;Be.each(t.xAxes,(function(e,t){e.id=e.id||"x-axis-"+t})),Be.each(t.yAxes,(function(e,t){e.id=e.id||"y-axis-"+t})),n&&(n.id=n.id||"scale")},buildOrUpdateScales:function(){var e=this,t=e.options,n=e.scales||{},r=[],i=Object.keys(n).reduce((function(e,t){return e[t]=!1,e}),{});t.scales&&(r=r.concat((t.scales.xAxes||[]).map((function(e){return{options:e,dtype:"category",dposition:"bottom"}})),(t.scales.yAxes||[]).map((function(e){return{options:e,dtype:"linear",dposition:"left"}})))),t.scale&&r.push({options:t.scale,dtype:"radialLinear",isDefault:!0,dposition:"chartArea"}),Be.each(r,(function(t){var r=t.options,a=r.id,o=ir(r.type,t.dtype);ur(r.position)!==ur(t.dposition)&&(r.position=t.dposition),i[a]=!0;var l=null;if(a in n&&n[a].type===o)(l=n[a]).options=r,l.ctx=e.ctx,l.chart=e;else{var s=Un.getScaleConstructor(o);if(!s)return;l=new s({id:a,type:o,options:r,ctx:e.ctx,chart:e}),n[l.id]=l}l.mergeTicksOptions(),t.isDefault&&(e.scale=l)})),Be.each(i,(function(e,t){e||delete n[t]})),e.scales=n,Un.addScalesToLayout(this)},buildOrUpdateControllers:function(){var e=this,t=[];return Be.each(e.data.datasets,(function(n,r){var i=e.getDatasetMeta(r),a=n.type||e.config.type;if(i.type&&i.type!==a&&(e.destroyDatasetMeta(r),i=e.getDatasetMeta(r)),i.type=a,i.controller)i.controller.updateIndex(r),i.controller.linkScales();else{var o=Jt[i.type];if(void 0===o)throw new Error('"'+i.type+'" is not a chart type.');i.controller=new o(e,r),t.push(i.controller)}}),e),t},resetElements:function(){var e=this;Be.each(e.data.datasets,(function(t,n){e.getDatasetMeta(n).controller.reset()}),e)},reset:function(){this.resetElements(),this.tooltip.initialize()},update:function(e){var t=this;if(e&&"object"===typeof e||(e={duration:e,lazy:arguments[1]}),sr(t),Hn._invalidate(t),!1!==Hn.notify(t,"beforeUpdate")){t.tooltip._data=t.data;var n=t.buildOrUpdateControllers();Be.each(t.data.datasets,(function(e,n){t.getDatasetMeta(n).controller.buildOrUpdateElements()}),t),t.updateLayout(),t.options.animation&&t.options.animation.duration&&Be.each(n,(function(e){e.reset()})),t.updateDatasets(),t.tooltip.initialize(),t.lastActive=[],Hn.notify(t,"afterUpdate"),t._bufferedRender?t._bufferedRequest={duration:e.duration,easing:e.easing,lazy:e.lazy}:t.render(e)}},updateLayout:function(){var e=this;!1!==Hn.notify(e,"beforeLayout")&&(fn.update(this,this.width,this.height),Hn.notify(e,"afterScaleUpdate"),Hn.notify(e,"afterLayout"))},updateDatasets:function(){var e=this;if(!1!==Hn.notify(e,"beforeDatasetsUpdate")){for(var t=0,n=e.data.datasets.length;t<n;++t)e.updateDataset(t);Hn.notify(e,"afterDatasetsUpdate")}},updateDataset:function(e){var t=this,n=t.getDatasetMeta(e),r={meta:n,index:e};!1!==Hn.notify(t,"beforeDatasetUpdate",[r])&&(n.controller.update(),Hn.notify(t,"afterDatasetUpdate",[r]))},render:function(e){var t=this;e&&"object"===typeof e||(e={duration:e,lazy:arguments[1]});var n=t.options.animation,r=ir(e.duration,n&&n.duration),i=e.lazy;if(!1!==Hn.notify(t,"beforeRender")){var a=function(e){Hn.notify(t,"afterRender"),Be.callback(n&&n.onComplete,[e],t)};if(n&&r){var o=new Je({numSteps:r/16.66,easing:e.easing||n.easing,render:function(e,t){var n=Be.easing.effects[t.easing],r=t.currentStep,i=r/t.numSteps;e.draw(n(i),i,r)},onAnimationProgress:n.onProgress,onAnimationComplete:a});et.addAnimation(t,o,r,i)}else t.draw(),a(new Je({numSteps:0,chart:t}));return t}},draw:function(e){var t=this;t.clear(),Be.isNullOrUndef(e)&&(e=1),t.transition(e),t.width<=0||t.height<=0||!1!==Hn.notify(t,"beforeDraw",[e])&&(Be.each(t.boxes,(function(e){e.draw(t.chartArea)}),t),t.drawDatasets(e),t._drawTooltip(e),Hn.notify(t,"afterDraw",[e]))},transition:function(e){for(var t=this,n=0,r=(t.data.datasets||[]).length;n<r;++n)t.isDatasetVisible(n)&&t.getDatasetMeta(n).controller.transition(e);t.tooltip.transition(e)},drawDatasets:function(e){var t=this;if(!1!==Hn.notify(t,"beforeDatasetsDraw",[e])){for(var n=(t.data.datasets||[]).length-1;n>=0;--n)t.isDatasetVisible(n)&&t.drawDataset(n,e);Hn.notify(t,"afterDatasetsDraw",[e])}},drawDataset:function(e,t){var n=this,r=n.getDatasetMeta(e),i={meta:r,index:e,easingValue:t};!1!==Hn.notify(n,"beforeDatasetDraw",[i])&&(r.controller.draw(t),Hn.notify(n,"afterDatasetDraw",[i]))},_drawTooltip:function(e){var t=this,n=t.tooltip,r={tooltip:n,easingValue:e};!1!==Hn.notify(t,"beforeTooltipDraw",[r])&&(n.draw(),Hn.notify(t,"afterTooltipDraw",[r]))},getElementAtEvent:function(e){return ln.modes.single(this,e)},getElementsAtEvent:function(e){return ln.modes.label(this,e,{intersect:!0})},getElementsAtXAxis:function(e){return ln.modes["x-axis"](this,e,{intersect:!0})},getElementsAtEventForMode:function(e,t,n){var r=ln.modes[t];return"function"===typeof r?r(this,e,n):[]},getDatasetAtEvent:function(e){return ln.modes.dataset(this,e,{intersect:!0})},getDatasetMeta:function(e){var t=this,n=t.data.datasets[e];n._meta||(n._meta={});var r=n._meta[t.id];return r||(r=n._meta[t.id]={type:null,data:[],dataset:null,controller:null,hidden:null,xAxisID:null,yAxisID:null}),r},getVisibleDatasetCount:function(){for(var e=0,t=0,n=this.data.datasets.length;t<n;++t)this.isDatasetVisible(t)&&e++;return e},isDatasetVisible:function(e){var t=this.getDatasetMeta(e);return"boolean"===typeof t.hidden?!t.hidden:!this.data.datasets[e].hidden},generateLegend:function(){return this.options.legendCallback(this)},destroyDatasetMeta:function(e){var t=this.id,n=this.data.datasets[e],r=n._meta&&n._meta[t];r&&(r.controller.destroy(),delete n._meta[t])},destroy:function(){var e,t,n=this,r=n.canvas;for(n.stop(),e=0,t=n.data.datasets.length;e<t;++e)n.destroyDatasetMeta(e);r&&(n.unbindEvents(),Be.canvas.clear(n),Yn.releaseContext(n.ctx),n.canvas=null,n.ctx=null),Hn.notify(n,"destroy"),delete cr.instances[n.id]},toBase64Image:function(){return this.canvas.toDataURL.apply(this.canvas,arguments)},initToolTip:function(){var e=this;e.tooltip=new rr({_chart:e,_chartInstance:e,_data:e.data,_options:e.options.tooltips},e)},bindEvents:function(){var e=this,t=e._listeners={},n=function(){e.eventHandler.apply(e,arguments)};Be.each(e.options.events,(function(r){Yn.addEventListener(e,r,n),t[r]=n})),e.options.responsive&&(n=function(){e.resize()},Yn.addEventListener(e,"resize",n),t.resize=n)},unbindEvents:function(){var e=this,t=e._listeners;t&&(delete e._listeners,Be.each(t,(function(t,n){Yn.removeEventListener(e,n,t)})))},updateHoverStyle:function(e,t,n){var r,i,a,o=n?"setHoverStyle":"removeHoverStyle";for(i=0,a=e.length;i<a;++i)(r=e[i])&&this.getDatasetMeta(r._datasetIndex).controller[o](r)},eventHandler:function(e){var t=this,n=t.tooltip;if(!1!==Hn.notify(t,"beforeEvent",[e])){t._bufferedRender=!0,t._bufferedRequest=null;var r=t.handleEvent(e);n&&(r=n._start?n.handleEvent(e):r|n.handleEvent(e)),Hn.notify(t,"afterEvent",[e]);var i=t._bufferedRequest;return i?t.render(i):r&&!t.animating&&(t.stop(),t.render({duration:t.options.hover.animationDuration,lazy:!0})),t._bufferedRender=!1,t._bufferedRequest=null,t}},handleEvent:function(e){var t=this,n=t.options||{},r=n.hover,i=!1;return t.lastActive=t.lastActive||[],"mouseout"===e.type?t.active=[]:t.active=t.getElementsAtEventForMode(e,r.mode,r),Be.callback(n.onHover||n.hover.onHover,[e.native,t.active],t),"mouseup"!==e.type&&"click"!==e.type||n.onClick&&n.onClick.call(t,e.native,t.active),t.lastActive.length&&t.updateHoverStyle(t.lastActive,r.mode,!1),t.active.length&&r.mode&&t.updateHoverStyle(t.active,r.mode,!0),i=!Be.arrayEquals(t.active,t.lastActive),t.lastActive=t.active,i}}),cr.instances={};var dr=cr;cr.Controller=cr,cr.types={},Be.configMerge=or,Be.scaleMerge=ar;var fr=function(){function e(e,t,n){var r;return"string"===typeof e?(r=parseInt(e,10),-1!==e.indexOf("%")&&(r=r/100*t.parentNode[n])):r=e,r}function t(e){return void 0!==e&&null!==e&&"none"!==e}function n(n,r,i){var a=document.defaultView,o=Be._getParentNode(n),l=a.getComputedStyle(n)[r],s=a.getComputedStyle(o)[r],u=t(l),c=t(s),d=Number.POSITIVE_INFINITY;return u||c?Math.min(u?e(l,n,i):d,c?e(s,o,i):d):"none"}Be.where=function(e,t){if(Be.isArray(e)&&Array.prototype.filter)return e.filter(t);var n=[];return Be.each(e,(function(e){t(e)&&n.push(e)})),n},Be.findIndex=Array.prototype.findIndex?function(e,t,n){return e.findIndex(t,n)}:function(e,t,n){n=void 0===n?e:n;for(var r=0,i=e.length;r<i;++r)if(t.call(n,e[r],r,e))return r;return-1},Be.findNextWhere=function(e,t,n){Be.isNullOrUndef(n)&&(n=-1);for(var r=n+1;r<e.length;r++){var i=e[r];if(t(i))return i}},Be.findPreviousWhere=function(e,t,n){Be.isNullOrUndef(n)&&(n=e.length);for(var r=n-1;r>=0;r--){var i=e[r];if(t(i))return i}},Be.isNumber=function(e){return!isNaN(parseFloat(e))&&isFinite(e)},Be.almostEquals=function(e,t,n){return Math.abs(e-t)<n},Be.almostWhole=function(e,t){var n=Math.round(e);return n-t<e&&n+t>e},Be.max=function(e){return e.reduce((function(e,t){return isNaN(t)?e:Math.max(e,t)}),Number.NEGATIVE_INFINITY)},Be.min=function(e){return e.reduce((function(e,t){return isNaN(t)?e:Math.min(e,t)}),Number.POSITIVE_INFINITY)},Be.sign=Math.sign?function(e){return Math.sign(e)}:function(e){return 0===(e=+e)||isNaN(e)?e:e>0?1:-1},Be.log10=Math.log10?function(e){return Math.log10(e)}:function(e){var t=Math.log(e)*Math.LOG10E,n=Math.round(t);return e===Math.pow(10,n)?n:t},Be.toRadians=function(e){return e*(Math.PI/180)},Be.toDegrees=function(e){return e*(180/Math.PI)},Be._decimalPlaces=function(e){if(Be.isFinite(e)){for(var t=1,n=0;Math.round(e*t)/t!==e;)t*=10,n++;return n}},Be.getAngleFromPoint=function(e,t){var n=t.x-e.x,r=t.y-e.y,i=Math.sqrt(n*n+r*r),a=Math.atan2(r,n);return a<-.5*Math.PI&&(a+=2*Math.PI),{angle:a,distance:i}},Be.distanceBetweenPoints=function(e,t){return Math.sqrt(Math.pow(t.x-e.x,2)+Math.pow(t.y-e.y,2))},Be.aliasPixel=function(e){return e%2===0?0:.5},Be._alignPixel=function(e,t,n){var r=e.currentDevicePixelRatio,i=n/2;return Math.round((t-i)*r)/r+i},Be.splineCurve=function(e,t,n,r){var i=e.skip?t:e,a=t,o=n.skip?t:n,l=Math.sqrt(Math.pow(a.x-i.x,2)+Math.pow(a.y-i.y,2)),s=Math.sqrt(Math.pow(o.x-a.x,2)+Math.pow(o.y-a.y,2)),u=l/(l+s),c=s/(l+s),d=r*(u=isNaN(u)?0:u),f=r*(c=isNaN(c)?0:c);return{previous:{x:a.x-d*(o.x-i.x),y:a.y-d*(o.y-i.y)},next:{x:a.x+f*(o.x-i.x),y:a.y+f*(o.y-i.y)}}},Be.EPSILON=Number.EPSILON||1e-14,Be.splineCurveMonotone=function(e){var t,n,r,i,a,o,l,s,u,c=(e||[]).map((function(e){return{model:e._model,deltaK:0,mK:0}})),d=c.length;for(t=0;t<d;++t)if(!(r=c[t]).model.skip){if(n=t>0?c[t-1]:null,(i=t<d-1?c[t+1]:null)&&!i.model.skip){var f=i.model.x-r.model.x;r.deltaK=0!==f?(i.model.y-r.model.y)/f:0}!n||n.model.skip?r.mK=r.deltaK:!i||i.model.skip?r.mK=n.deltaK:this.sign(n.deltaK)!==this.sign(r.deltaK)?r.mK=0:r.mK=(n.deltaK+r.deltaK)/2}for(t=0;t<d-1;++t)r=c[t],i=c[t+1],r.model.skip||i.model.skip||(Be.almostEquals(r.deltaK,0,this.EPSILON)?r.mK=i.mK=0:(a=r.mK/r.deltaK,o=i.mK/r.deltaK,(s=Math.pow(a,2)+Math.pow(o,2))<=9||(l=3/Math.sqrt(s),r.mK=a*l*r.deltaK,i.mK=o*l*r.deltaK)));for(t=0;t<d;++t)(r=c[t]).model.skip||(n=t>0?c[t-1]:null,i=t<d-1?c[t+1]:null,n&&!n.model.skip&&(u=(r.model.x-n.model.x)/3,r.model.controlPointPreviousX=r.model.x-u,r.model.controlPointPreviousY=r.model.y-u*r.mK),i&&!i.model.skip&&(u=(i.model.x-r.model.x)/3,r.model.controlPointNextX=r.model.x+u,r.model.controlPointNextY=r.model.y+u*r.mK))},Be.nextItem=function(e,t,n){return n?t>=e.length-1?e[0]:e[t+1]:t>=e.length-1?e[e.length-1]:e[t+1]},Be.previousItem=function(e,t,n){return n?t<=0?e[e.length-1]:e[t-1]:t<=0?e[0]:e[t-1]},Be.niceNum=function(e,t){var n=Math.floor(Be.log10(e)),r=e/Math.pow(10,n);return(t?r<1.5?1:r<3?2:r<7?5:10:r<=1?1:r<=2?2:r<=5?5:10)*Math.pow(10,n)},Be.requestAnimFrame="undefined"===typeof window?function(e){e()}:window.requestAnimationFrame||window.webkitRequestAnimationFrame||window.mozRequestAnimationFrame||window.oRequestAnimationFrame||window.msRequestAnimationFrame||function(e){return window.setTimeout(e,1e3/60)},Be.getRelativePosition=function(e,t){var n,r,i=e.originalEvent||e,a=e.target||e.srcElement,o=a.getBoundingClientRect(),l=i.touches;l&&l.length>0?(n=l[0].clientX,r=l[0].clientY):(n=i.clientX,r=i.clientY);var s=parseFloat(Be.getStyle(a,"padding-left")),u=parseFloat(Be.getStyle(a,"padding-top")),c=parseFloat(Be.getStyle(a,"padding-right")),d=parseFloat(Be.getStyle(a,"padding-bottom")),f=o.right-o.left-s-c,h=o.bottom-o.top-u-d;return{x:n=Math.round((n-o.left-s)/f*a.width/t.currentDevicePixelRatio),y:r=Math.round((r-o.top-u)/h*a.height/t.currentDevicePixelRatio)}},Be.getConstraintWidth=function(e){return n(e,"max-width","clientWidth")},Be.getConstraintHeight=function(e){return n(e,"max-height","clientHeight")},Be._calculatePadding=function(e,t,n){return(t=Be.getStyle(e,t)).indexOf("%")>-1?n*parseInt(t,10)/100:parseInt(t,10)},Be._getParentNode=function(e){var t=e.parentNode;return t&&"[object ShadowRoot]"===t.toString()&&(t=t.host),t},Be.getMaximumWidth=function(e){var t=Be._getParentNode(e);if(!t)return e.clientWidth;var n=t.clientWidth,r=n-Be._calculatePadding(t,"padding-left",n)-Be._calculatePadding(t,"padding-right",n),i=Be.getConstraintWidth(e);return isNaN(i)?r:Math.min(r,i)},Be.getMaximumHeight=function(e){var t=Be._getParentNode(e);if(!t)return e.clientHeight;var n=t.clientHeight,r=n-Be._calculatePadding(t,"padding-top",n)-Be._calculatePadding(t,"padding-bottom",n),i=Be.getConstraintHeight(e);return isNaN(i)?r:Math.min(r,i)},Be.getStyle=function(e,t){return e.currentStyle?e.currentStyle[t]:document.defaultView.getComputedStyle(e,null).getPropertyValue(t)},Be.retinaScale=function(e,t){var n=e.currentDevicePixelRatio=t||"undefined"!==typeof window&&window.devicePixelRatio||1;if(1!==n){var r=e.canvas,i=e.height,a=e.width;r.height=i*n,r.width=a*n,e.ctx.scale(n,n),r.style.height||r.style.width||(r.style.height=i+"px",r.style.width=a+"px")}},Be.fontString=function(e,t,n){return t+" "+e+"px "+n},Be.longestText=function(e,t,n,r){var i=(r=r||{}).data=r.data||{},a=r.garbageCollect=r.garbageCollect||[];r.font!==t&&(i=r.data={},a=r.garbageCollect=[],r.font=t),e.font=t;var o=0;Be.each(n,(function(t){void 0!==t&&null!==t&&!0!==Be.isArray(t)?o=Be.measureText(e,i,a,o,t):Be.isArray(t)&&Be.each(t,(function(t){void 0===t||null===t||Be.isArray(t)||(o=Be.measureText(e,i,a,o,t))}))}));var l=a.length/2;if(l>n.length){for(var s=0;s<l;s++)delete i[a[s]];a.splice(0,l)}return o},Be.measureText=function(e,t,n,r,i){var a=t[i];return a||(a=t[i]=e.measureText(i).width,n.push(i)),a>r&&(r=a),r},Be.numberOfLabelLines=function(e){var t=1;return Be.each(e,(function(e){Be.isArray(e)&&e.length>t&&(t=e.length)})),t},Be.color=Ee?function(e){return e instanceof CanvasGradient&&(e=Ye.global.defaultColor),Ee(e)}:function(e){return console.error("Color.js not found!"),e},Be.getHoverColor=function(e){return e instanceof CanvasPattern||e instanceof CanvasGradient?e:Be.color(e).saturate(.5).darken(.1).rgbString()}};function hr(){throw new Error("This method is not implemented: either no adapter can be found or an incomplete integration was provided.")}function pr(e){this.options=e||{}}Be.extend(pr.prototype,{formats:hr,parse:hr,format:hr,add:hr,diff:hr,startOf:hr,endOf:hr,_create:function(e){return e}}),pr.override=function(e){Be.extend(pr.prototype,e)};var gr={_date:pr},mr={formatters:{values:function(e){return Be.isArray(e)?e:""+e},linear:function(e,t,n){var r=n.length>3?n[2]-n[1]:n[1]-n[0];Math.abs(r)>1&&e!==Math.floor(e)&&(r=e-Math.floor(e));var i=Be.log10(Math.abs(r)),a="";if(0!==e)if(Math.max(Math.abs(n[0]),Math.abs(n[n.length-1]))<1e-4){var o=Be.log10(Math.abs(e));a=e.toExponential(Math.floor(o)-Math.floor(i))}else{var l=-1*Math.floor(i);l=Math.max(Math.min(l,20),0),a=e.toFixed(l)}else a="0";return a},logarithmic:function(e,t,n){var r=e/Math.pow(10,Math.floor(Be.log10(e)));return 0===e?"0":1===r||2===r||5===r||0===t||t===n.length-1?e.toExponential():""}}},vr=Be.valueOrDefault,yr=Be.valueAtIndexOrDefault;function br(e){var t,n,r=[];for(t=0,n=e.length;t<n;++t)r.push(e[t].label);return r}function xr(e,t,n){var r=e.getPixelForTick(t);return n&&(1===e.getTicks().length?r-=e.isHorizontal()?Math.max(r-e.left,e.right-r):Math.max(r-e.top,e.bottom-r):r-=0===t?(e.getPixelForTick(1)-r)/2:(r-e.getPixelForTick(t-1))/2),r}function wr(e,t,n){return Be.isArray(t)?Be.longestText(e,n,t):e.measureText(t).width}Ye._set("scale",{display:!0,position:"left",offset:!1,gridLines:{display:!0,color:"rgba(0, 0, 0, 0.1)",lineWidth:1,drawBorder:!0,drawOnChartArea:!0,drawTicks:!0,tickMarkLength:10,zeroLineWidth:1,zeroLineColor:"rgba(0,0,0,0.25)",zeroLineBorderDash:[],zeroLineBorderDashOffset:0,offsetGridLines:!1,borderDash:[],borderDashOffset:0},scaleLabel:{display:!1,labelString:"",padding:{top:4,bottom:4}},ticks:{beginAtZero:!1,minRotation:0,maxRotation:50,mirror:!1,padding:0,reverse:!1,display:!0,autoSkip:!0,autoSkipPadding:0,labelOffset:0,callback:mr.formatters.values,minor:{},major:{}}});var _r=Qe.extend({getPadding:function(){var e=this;return{left:e.paddingLeft||0,top:e.paddingTop||0,right:e.paddingRight||0,bottom:e.paddingBottom||0}},getTicks:function(){return this._ticks},mergeTicksOptions:function(){var e=this.options.ticks;for(var t in!1===e.minor&&(e.minor={display:!1}),!1===e.major&&(e.major={display:!1}),e)"major"!==t&&"minor"!==t&&("undefined"===typeof e.minor[t]&&(e.minor[t]=e[t]),"undefined"===typeof e.major[t]&&(e.major[t]=e[t]))},beforeUpdate:function(){Be.callback(this.options.beforeUpdate,[this])},update:function(e,t,n){var r,i,a,o,l,s,u=this;for(u.beforeUpdate(),u.maxWidth=e,u.maxHeight=t,u.margins=Be.extend({left:0,right:0,top:0,bottom:0},n),u._maxLabelLines=0,u.longestLabelWidth=0,u.longestTextCache=u.longestTextCache||{},u.beforeSetDimensions(),u.setDimensions(),u.afterSetDimensions(),u.beforeDataLimits(),u.determineDataLimits(),u.afterDataLimits(),u.beforeBuildTicks(),l=u.buildTicks()||[],l=u.afterBuildTicks(l)||l,u.beforeTickToLabelConversion(),a=u.convertTicksToLabels(l)||u.ticks,u.afterTickToLabelConversion(),u.ticks=a,r=0,i=a.length;r<i;++r)o=a[r],(s=l[r])?s.label=o:l.push(s={label:o,major:!1});return u._ticks=l,u.beforeCalculateTickRotation(),u.calculateTickRotation(),u.afterCalculateTickRotation(),u.beforeFit(),u.fit(),u.afterFit(),u.afterUpdate(),u.minSize},afterUpdate:function(){Be.callback(this.options.afterUpdate,[this])},beforeSetDimensions:function(){Be.callback(this.options.beforeSetDimensions,[this])},setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0},afterSetDimensions:function(){Be.callback(this.options.afterSetDimensions,[this])},beforeDataLimits:function(){Be.callback(this.options.beforeDataLimits,[this])},determineDataLimits:Be.noop,afterDataLimits:function(){Be.callback(this.options.afterDataLimits,[this])},beforeBuildTicks:function(){Be.callback(this.options.beforeBuildTicks,[this])},buildTicks:Be.noop,afterBuildTicks:function(e){var t=this;return Be.isArray(e)&&e.length?Be.callback(t.options.afterBuildTicks,[t,e]):(t.ticks=Be.callback(t.options.afterBuildTicks,[t,t.ticks])||t.ticks,e)},beforeTickToLabelConversion:function(){Be.callback(this.options.beforeTickToLabelConversion,[this])},convertTicksToLabels:function(){var e=this,t=e.options.ticks;e.ticks=e.ticks.map(t.userCallback||t.callback,this)},afterTickToLabelConversion:function(){Be.callback(this.options.afterTickToLabelConversion,[this])},beforeCalculateTickRotation:function(){Be.callback(this.options.beforeCalculateTickRotation,[this])},calculateTickRotation:function(){var e=this,t=e.ctx,n=e.options.ticks,r=br(e._ticks),i=Be.options._parseFont(n);t.font=i.string;var a=n.minRotation||0;if(r.length&&e.options.display&&e.isHorizontal())for(var o,l=Be.longestText(t,i.string,r,e.longestTextCache),s=l,u=e.getPixelForTick(1)-e.getPixelForTick(0)-6;s>u&&a<n.maxRotation;){var c=Be.toRadians(a);if(o=Math.cos(c),Math.sin(c)*l>e.maxHeight){a--;break}a++,s=o*l}e.labelRotation=a},afterCalculateTickRotation:function(){Be.callback(this.options.afterCalculateTickRotation,[this])},beforeFit:function(){Be.callback(this.options.beforeFit,[this])},fit:function(){var e=this,t=e.minSize={width:0,height:0},n=br(e._ticks),r=e.options,i=r.ticks,a=r.scaleLabel,o=r.gridLines,l=e._isVisible(),s=r.position,u=e.isHorizontal(),c=Be.options._parseFont,d=c(i),f=r.gridLines.tickMarkLength;if(t.width=u?e.isFullWidth()?e.maxWidth-e.margins.left-e.margins.right:e.maxWidth:l&&o.drawTicks?f:0,t.height=u?l&&o.drawTicks?f:0:e.maxHeight,a.display&&l){var h=c(a),p=Be.options.toPadding(a.padding),g=h.lineHeight+p.height;u?t.height+=g:t.width+=g}if(i.display&&l){var m=Be.longestText(e.ctx,d.string,n,e.longestTextCache),v=Be.numberOfLabelLines(n),y=.5*d.size,b=e.options.ticks.padding;if(e._maxLabelLines=v,e.longestLabelWidth=m,u){var x=Be.toRadians(e.labelRotation),w=Math.cos(x),_=Math.sin(x)*m+d.lineHeight*v+y;t.height=Math.min(e.maxHeight,t.height+_+b),e.ctx.font=d.string;var k,S,M=wr(e.ctx,n[0],d.string),C=wr(e.ctx,n[n.length-1],d.string),E=e.getPixelForTick(0)-e.left,O=e.right-e.getPixelForTick(n.length-1);0!==e.labelRotation?(k="bottom"===s?w*M:w*y,S="bottom"===s?w*y:w*C):(k=M/2,S=C/2),e.paddingLeft=Math.max(k-E,0)+3,e.paddingRight=Math.max(S-O,0)+3}else i.mirror?m=0:m+=b+y,t.width=Math.min(e.maxWidth,t.width+m),e.paddingTop=d.size/2,e.paddingBottom=d.size/2}e.handleMargins(),e.width=t.width,e.height=t.height},handleMargins:function(){var e=this;e.margins&&(e.paddingLeft=Math.max(e.paddingLeft-e.margins.left,0),e.paddingTop=Math.max(e.paddingTop-e.margins.top,0),e.paddingRight=Math.max(e.paddingRight-e.margins.right,0),e.paddingBottom=Math.max(e.paddingBottom-e.margins.bottom,0))},afterFit:function(){Be.callback(this.options.afterFit,[this])},isHorizontal:function(){return"top"===this.options.position||"bottom"===this.options.position},isFullWidth:function(){return this.options.fullWidth},getRightValue:function(e){if(Be.isNullOrUndef(e))return NaN;if(("number"===typeof e||e instanceof Number)&&!isFinite(e))return NaN;if(e)if(this.isHorizontal()){if(void 0!==e.x)return this.getRightValue(e.x)}else if(void 0!==e.y)return this.getRightValue(e.y);return e},getLabelForIndex:Be.noop,getPixelForValue:Be.noop,getValueForPixel:Be.noop,getPixelForTick:function(e){var t=this,n=t.options.offset;if(t.isHorizontal()){var r=(t.width-(t.paddingLeft+t.paddingRight))/Math.max(t._ticks.length-(n?0:1),1),i=r*e+t.paddingLeft;n&&(i+=r/2);var a=t.left+i;return a+=t.isFullWidth()?t.margins.left:0}var o=t.height-(t.paddingTop+t.paddingBottom);return t.top+e*(o/(t._ticks.length-1))},getPixelForDecimal:function(e){var t=this;if(t.isHorizontal()){var n=(t.width-(t.paddingLeft+t.paddingRight))*e+t.paddingLeft,r=t.left+n;return r+=t.isFullWidth()?t.margins.left:0}return t.top+e*t.height},getBasePixel:function(){return this.getPixelForValue(this.getBaseValue())},getBaseValue:function(){var e=this,t=e.min,n=e.max;return e.beginAtZero?0:t<0&&n<0?n:t>0&&n>0?t:0},_autoSkip:function(e){var t,n,r=this,i=r.isHorizontal(),a=r.options.ticks.minor,o=e.length,l=!1,s=a.maxTicksLimit,u=r._tickSize()*(o-1),c=i?r.width-(r.paddingLeft+r.paddingRight):r.height-(r.paddingTop+r.PaddingBottom),d=[];for(u>c&&(l=1+Math.floor(u/c)),o>s&&(l=Math.max(l,1+Math.floor(o/s))),t=0;t<o;t++)n=e[t],l>1&&t%l>0&&delete n.label,d.push(n);return d},_tickSize:function(){var e=this,t=e.isHorizontal(),n=e.options.ticks.minor,r=Be.toRadians(e.labelRotation),i=Math.abs(Math.cos(r)),a=Math.abs(Math.sin(r)),o=n.autoSkipPadding||0,l=e.longestLabelWidth+o||0,s=Be.options._parseFont(n),u=e._maxLabelLines*s.lineHeight+o||0;return t?u*i>l*a?l/i:u/a:u*a<l*i?u/i:l/a},_isVisible:function(){var e,t,n,r=this,i=r.chart,a=r.options.display;if("auto"!==a)return!!a;for(e=0,t=i.data.datasets.length;e<t;++e)if(i.isDatasetVisible(e)&&((n=i.getDatasetMeta(e)).xAxisID===r.id||n.yAxisID===r.id))return!0;return!1},draw:function(e){var t=this,n=t.options;if(t._isVisible()){var r,i,a,o=t.chart,l=t.ctx,s=Ye.global.defaultFontColor,u=n.ticks.minor,c=n.ticks.major||u,d=n.gridLines,f=n.scaleLabel,h=n.position,p=0!==t.labelRotation,g=u.mirror,m=t.isHorizontal(),v=Be.options._parseFont,y=u.display&&u.autoSkip?t._autoSkip(t.getTicks()):t.getTicks(),b=vr(u.fontColor,s),x=v(u),w=x.lineHeight,_=vr(c.fontColor,s),k=v(c),S=u.padding,M=u.labelOffset,C=d.drawTicks?d.tickMarkLength:0,E=vr(f.fontColor,s),O=v(f),P=Be.options.toPadding(f.padding),T=Be.toRadians(t.labelRotation),D=[],N=d.drawBorder?yr(d.lineWidth,0,0):0,R=Be._alignPixel;"top"===h?(r=R(o,t.bottom,N),i=t.bottom-C,a=r-N/2):"bottom"===h?(r=R(o,t.top,N),i=r+N/2,a=t.top+C):"left"===h?(r=R(o,t.right,N),i=t.right-C,a=r-N/2):(r=R(o,t.left,N),i=r+N/2,a=t.left+C);var A=1e-7;if(Be.each(y,(function(r,l){if(!Be.isNullOrUndef(r.label)){var s,u,c,f,v,y,b,x,_,k,E,O,P,I,L,j,F=r.label;l===t.zeroLineIndex&&n.offset===d.offsetGridLines?(s=d.zeroLineWidth,u=d.zeroLineColor,c=d.zeroLineBorderDash||[],f=d.zeroLineBorderDashOffset||0):(s=yr(d.lineWidth,l),u=yr(d.color,l),c=d.borderDash||[],f=d.borderDashOffset||0);var z=Be.isArray(F)?F.length:1,W=xr(t,l,d.offsetGridLines);if(m){var Y=C+S;W<t.left-A&&(u="rgba(0,0,0,0)"),v=b=_=E=R(o,W,s),y=i,x=a,P=t.getPixelForTick(l)+M,"top"===h?(k=R(o,e.top,N)+N/2,O=e.bottom,L=((p?1:.5)-z)*w,j=p?"left":"center",I=t.bottom-Y):(k=e.top,O=R(o,e.bottom,N)-N/2,L=(p?0:.5)*w,j=p?"right":"center",I=t.top+Y)}else{var H=(g?0:C)+S;W<t.top-A&&(u="rgba(0,0,0,0)"),v=i,b=a,y=x=k=O=R(o,W,s),I=t.getPixelForTick(l)+M,L=(1-z)*w/2,"left"===h?(_=R(o,e.left,N)+N/2,E=e.right,j=g?"left":"right",P=t.right-H):(_=e.left,E=R(o,e.right,N)-N/2,j=g?"right":"left",P=t.left+H)}D.push({tx1:v,ty1:y,tx2:b,ty2:x,x1:_,y1:k,x2:E,y2:O,labelX:P,labelY:I,glWidth:s,glColor:u,glBorderDash:c,glBorderDashOffset:f,rotation:-1*T,label:F,major:r.major,textOffset:L,textAlign:j})}})),Be.each(D,(function(e){var t=e.glWidth,n=e.glColor;if(d.display&&t&&n&&(l.save(),l.lineWidth=t,l.strokeStyle=n,l.setLineDash&&(l.setLineDash(e.glBorderDash),l.lineDashOffset=e.glBorderDashOffset),l.beginPath(),d.drawTicks&&(l.moveTo(e.tx1,e.ty1),l.lineTo(e.tx2,e.ty2)),d.drawOnChartArea&&(l.moveTo(e.x1,e.y1),l.lineTo(e.x2,e.y2)),l.stroke(),l.restore()),u.display){l.save(),l.translate(e.labelX,e.labelY),l.rotate(e.rotation),l.font=e.major?k.string:x.string,l.fillStyle=e.major?_:b,l.textBaseline="middle",l.textAlign=e.textAlign;var r=e.label,i=e.textOffset;if(Be.isArray(r))for(var a=0;a<r.length;++a)l.fillText(""+r[a],0,i),i+=w;else l.fillText(r,0,i);l.restore()}})),f.display){var I,L,j=0,F=O.lineHeight/2;if(m)I=t.left+(t.right-t.left)/2,L="bottom"===h?t.bottom-F-P.bottom:t.top+F+P.top;else{var z="left"===h;I=z?t.left+F+P.top:t.right-F-P.top,L=t.top+(t.bottom-t.top)/2,j=z?-.5*Math.PI:.5*Math.PI}l.save(),l.translate(I,L),l.rotate(j),l.textAlign="center",l.textBaseline="middle",l.fillStyle=E,l.font=O.string,l.fillText(f.labelString,0,0),l.restore()}if(N){var W,Y,H,U,V=N,B=yr(d.lineWidth,y.length-1,0);m?(W=R(o,t.left,V)-V/2,Y=R(o,t.right,B)+B/2,H=U=r):(H=R(o,t.top,V)-V/2,U=R(o,t.bottom,B)+B/2,W=Y=r),l.lineWidth=N,l.strokeStyle=yr(d.color,0),l.beginPath(),l.moveTo(W,H),l.lineTo(Y,U),l.stroke()}}}}),kr={position:"bottom"},Sr=_r.extend({getLabels:function(){var e=this.chart.data;return this.options.labels||(this.isHorizontal()?e.xLabels:e.yLabels)||e.labels},determineDataLimits:function(){var e,t=this,n=t.getLabels();t.minIndex=0,t.maxIndex=n.length-1,void 0!==t.options.ticks.min&&(e=n.indexOf(t.options.ticks.min),t.minIndex=-1!==e?e:t.minIndex),void 0!==t.options.ticks.max&&(e=n.indexOf(t.options.ticks.max),t.maxIndex=-1!==e?e:t.maxIndex),t.min=n[t.minIndex],t.max=n[t.maxIndex]},buildTicks:function(){var e=this,t=e.getLabels();e.ticks=0===e.minIndex&&e.maxIndex===t.length-1?t:t.slice(e.minIndex,e.maxIndex+1)},getLabelForIndex:function(e,t){var n=this,r=n.chart;return r.getDatasetMeta(t).controller._getValueScaleId()===n.id?n.getRightValue(r.data.datasets[t].data[e]):n.ticks[e-n.minIndex]},getPixelForValue:function(e,t){var n,r=this,i=r.options.offset,a=Math.max(r.maxIndex+1-r.minIndex-(i?0:1),1);if(void 0!==e&&null!==e&&(n=r.isHorizontal()?e.x:e.y),void 0!==n||void 0!==e&&isNaN(t)){e=n||e;var o=r.getLabels().indexOf(e);t=-1!==o?o:t}if(r.isHorizontal()){var l=r.width/a,s=l*(t-r.minIndex);return i&&(s+=l/2),r.left+s}var u=r.height/a,c=u*(t-r.minIndex);return i&&(c+=u/2),r.top+c},getPixelForTick:function(e){return this.getPixelForValue(this.ticks[e],e+this.minIndex,null)},getValueForPixel:function(e){var t=this,n=t.options.offset,r=Math.max(t._ticks.length-(n?0:1),1),i=t.isHorizontal(),a=(i?t.width:t.height)/r;return e-=i?t.left:t.top,n&&(e-=a/2),(e<=0?0:Math.round(e/a))+t.minIndex},getBasePixel:function(){return this.bottom}}),Mr=kr;Sr._defaults=Mr;var Cr=Be.noop,Er=Be.isNullOrUndef;function Or(e,t){var n,r,i,a,o=[],l=1e-14,s=e.stepSize,u=s||1,c=e.maxTicks-1,d=e.min,f=e.max,h=e.precision,p=t.min,g=t.max,m=Be.niceNum((g-p)/c/u)*u;if(m<l&&Er(d)&&Er(f))return[p,g];(a=Math.ceil(g/m)-Math.floor(p/m))>c&&(m=Be.niceNum(a*m/c/u)*u),s||Er(h)?n=Math.pow(10,Be._decimalPlaces(m)):(n=Math.pow(10,h),m=Math.ceil(m*n)/n),r=Math.floor(p/m)*m,i=Math.ceil(g/m)*m,s&&(!Er(d)&&Be.almostWhole(d/m,m/1e3)&&(r=d),!Er(f)&&Be.almostWhole(f/m,m/1e3)&&(i=f)),a=(i-r)/m,a=Be.almostEquals(a,Math.round(a),m/1e3)?Math.round(a):Math.ceil(a),r=Math.round(r*n)/n,i=Math.round(i*n)/n,o.push(Er(d)?r:d);for(var v=1;v<a;++v)o.push(Math.round((r+v*m)*n)/n);return o.push(Er(f)?i:f),o}var Pr=_r.extend({getRightValue:function(e){return"string"===typeof e?+e:_r.prototype.getRightValue.call(this,e)},handleTickRangeOptions:function(){var e=this,t=e.options.ticks;if(t.beginAtZero){var n=Be.sign(e.min),r=Be.sign(e.max);n<0&&r<0?e.max=0:n>0&&r>0&&(e.min=0)}var i=void 0!==t.min||void 0!==t.suggestedMin,a=void 0!==t.max||void 0!==t.suggestedMax;void 0!==t.min?e.min=t.min:void 0!==t.suggestedMin&&(null===e.min?e.min=t.suggestedMin:e.min=Math.min(e.min,t.suggestedMin)),void 0!==t.max?e.max=t.max:void 0!==t.suggestedMax&&(null===e.max?e.max=t.suggestedMax:e.max=Math.max(e.max,t.suggestedMax)),i!==a&&e.min>=e.max&&(i?e.max=e.min+1:e.min=e.max-1),e.min===e.max&&(e.max++,t.beginAtZero||e.min--)},getTickLimit:function(){var e,t=this,n=t.options.ticks,r=n.stepSize,i=n.maxTicksLimit;return r?e=Math.ceil(t.max/r)-Math.floor(t.min/r)+1:(e=t._computeTickLimit(),i=i||11),i&&(e=Math.min(i,e)),e},_computeTickLimit:function(){return Number.POSITIVE_INFINITY},handleDirectionalChanges:Cr,buildTicks:function(){var e=this,t=e.options.ticks,n=e.getTickLimit(),r={maxTicks:n=Math.max(2,n),min:t.min,max:t.max,precision:t.precision,stepSize:Be.valueOrDefault(t.fixedStepSize,t.stepSize)},i=e.ticks=Or(r,e);e.handleDirectionalChanges(),e.max=Be.max(i),e.min=Be.min(i),t.reverse?(i.reverse(),e.start=e.max,e.end=e.min):(e.start=e.min,e.end=e.max)},convertTicksToLabels:function(){var e=this;e.ticksAsNumbers=e.ticks.slice(),e.zeroLineIndex=e.ticks.indexOf(0),_r.prototype.convertTicksToLabels.call(e)}}),Tr={position:"left",ticks:{callback:mr.formatters.linear}},Dr=Pr.extend({determineDataLimits:function(){var e=this,t=e.options,n=e.chart,r=n.data.datasets,i=e.isHorizontal(),a=0,o=1;function l(t){return i?t.xAxisID===e.id:t.yAxisID===e.id}e.min=null,e.max=null;var s=t.stacked;if(void 0===s&&Be.each(r,(function(e,t){if(!s){var r=n.getDatasetMeta(t);n.isDatasetVisible(t)&&l(r)&&void 0!==r.stack&&(s=!0)}})),t.stacked||s){var u={};Be.each(r,(function(r,i){var a=n.getDatasetMeta(i),o=[a.type,void 0===t.stacked&&void 0===a.stack?i:"",a.stack].join(".");void 0===u[o]&&(u[o]={positiveValues:[],negativeValues:[]});var s=u[o].positiveValues,c=u[o].negativeValues;n.isDatasetVisible(i)&&l(a)&&Be.each(r.data,(function(n,r){var i=+e.getRightValue(n);isNaN(i)||a.data[r].hidden||(s[r]=s[r]||0,c[r]=c[r]||0,t.relativePoints?s[r]=100:i<0?c[r]+=i:s[r]+=i)}))})),Be.each(u,(function(t){var n=t.positiveValues.concat(t.negativeValues),r=Be.min(n),i=Be.max(n);e.min=null===e.min?r:Math.min(e.min,r),e.max=null===e.max?i:Math.max(e.max,i)}))}else Be.each(r,(function(t,r){var i=n.getDatasetMeta(r);n.isDatasetVisible(r)&&l(i)&&Be.each(t.data,(function(t,n){var r=+e.getRightValue(t);isNaN(r)||i.data[n].hidden||((null===e.min||r<e.min)&&(e.min=r),(null===e.max||r>e.max)&&(e.max=r))}))}));e.min=isFinite(e.min)&&!isNaN(e.min)?e.min:a,e.max=isFinite(e.max)&&!isNaN(e.max)?e.max:o,this.handleTickRangeOptions()},_computeTickLimit:function(){var e,t=this;return t.isHorizontal()?Math.ceil(t.width/40):(e=Be.options._parseFont(t.options.ticks),Math.ceil(t.height/e.lineHeight))},handleDirectionalChanges:function(){this.isHorizontal()||this.ticks.reverse()},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},getPixelForValue:function(e){var t=this,n=t.start,r=+t.getRightValue(e),i=t.end-n;return t.isHorizontal()?t.left+t.width/i*(r-n):t.bottom-t.height/i*(r-n)},getValueForPixel:function(e){var t=this,n=t.isHorizontal(),r=n?t.width:t.height,i=(n?e-t.left:t.bottom-e)/r;return t.start+(t.end-t.start)*i},getPixelForTick:function(e){return this.getPixelForValue(this.ticksAsNumbers[e])}}),Nr=Tr;Dr._defaults=Nr;var Rr=Be.valueOrDefault;function Ar(e,t){var n,r,i=[],a=Rr(e.min,Math.pow(10,Math.floor(Be.log10(t.min)))),o=Math.floor(Be.log10(t.max)),l=Math.ceil(t.max/Math.pow(10,o));0===a?(n=Math.floor(Be.log10(t.minNotZero)),r=Math.floor(t.minNotZero/Math.pow(10,n)),i.push(a),a=r*Math.pow(10,n)):(n=Math.floor(Be.log10(a)),r=Math.floor(a/Math.pow(10,n)));var s=n<0?Math.pow(10,Math.abs(n)):1;do{i.push(a),10===++r&&(r=1,s=++n>=0?1:s),a=Math.round(r*Math.pow(10,n)*s)/s}while(n<o||n===o&&r<l);var u=Rr(e.max,a);return i.push(u),i}var Ir={position:"left",ticks:{callback:mr.formatters.logarithmic}};function Lr(e,t){return Be.isFinite(e)&&e>=0?e:t}var jr=_r.extend({determineDataLimits:function(){var e=this,t=e.options,n=e.chart,r=n.data.datasets,i=e.isHorizontal();function a(t){return i?t.xAxisID===e.id:t.yAxisID===e.id}e.min=null,e.max=null,e.minNotZero=null;var o=t.stacked;if(void 0===o&&Be.each(r,(function(e,t){if(!o){var r=n.getDatasetMeta(t);n.isDatasetVisible(t)&&a(r)&&void 0!==r.stack&&(o=!0)}})),t.stacked||o){var l={};Be.each(r,(function(r,i){var o=n.getDatasetMeta(i),s=[o.type,void 0===t.stacked&&void 0===o.stack?i:"",o.stack].join(".");n.isDatasetVisible(i)&&a(o)&&(void 0===l[s]&&(l[s]=[]),Be.each(r.data,(function(t,n){var r=l[s],i=+e.getRightValue(t);isNaN(i)||o.data[n].hidden||i<0||(r[n]=r[n]||0,r[n]+=i)})))})),Be.each(l,(function(t){if(t.length>0){var n=Be.min(t),r=Be.max(t);e.min=null===e.min?n:Math.min(e.min,n),e.max=null===e.max?r:Math.max(e.max,r)}}))}else Be.each(r,(function(t,r){var i=n.getDatasetMeta(r);n.isDatasetVisible(r)&&a(i)&&Be.each(t.data,(function(t,n){var r=+e.getRightValue(t);isNaN(r)||i.data[n].hidden||r<0||((null===e.min||r<e.min)&&(e.min=r),(null===e.max||r>e.max)&&(e.max=r),0!==r&&(null===e.minNotZero||r<e.minNotZero)&&(e.minNotZero=r))}))}));this.handleTickRangeOptions()},handleTickRangeOptions:function(){var e=this,t=e.options.ticks,n=1,r=10;e.min=Lr(t.min,e.min),e.max=Lr(t.max,e.max),e.min===e.max&&(0!==e.min&&null!==e.min?(e.min=Math.pow(10,Math.floor(Be.log10(e.min))-1),e.max=Math.pow(10,Math.floor(Be.log10(e.max))+1)):(e.min=n,e.max=r)),null===e.min&&(e.min=Math.pow(10,Math.floor(Be.log10(e.max))-1)),null===e.max&&(e.max=0!==e.min?Math.pow(10,Math.floor(Be.log10(e.min))+1):r),null===e.minNotZero&&(e.min>0?e.minNotZero=e.min:e.max<1?e.minNotZero=Math.pow(10,Math.floor(Be.log10(e.max))):e.minNotZero=n)},buildTicks:function(){var e=this,t=e.options.ticks,n=!e.isHorizontal(),r={min:Lr(t.min),max:Lr(t.max)},i=e.ticks=Ar(r,e);e.max=Be.max(i),e.min=Be.min(i),t.reverse?(n=!n,e.start=e.max,e.end=e.min):(e.start=e.min,e.end=e.max),n&&i.reverse()},convertTicksToLabels:function(){this.tickValues=this.ticks.slice(),_r.prototype.convertTicksToLabels.call(this)},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},getPixelForTick:function(e){return this.getPixelForValue(this.tickValues[e])},_getFirstTickValue:function(e){var t=Math.floor(Be.log10(e));return Math.floor(e/Math.pow(10,t))*Math.pow(10,t)},getPixelForValue:function(e){var t,n,r,i,a,o=this,l=o.options.ticks,s=l.reverse,u=Be.log10,c=o._getFirstTickValue(o.minNotZero),d=0;return e=+o.getRightValue(e),s?(r=o.end,i=o.start,a=-1):(r=o.start,i=o.end,a=1),o.isHorizontal()?(t=o.width,n=s?o.right:o.left):(t=o.height,a*=-1,n=s?o.top:o.bottom),e!==r&&(0===r&&(t-=d=Rr(l.fontSize,Ye.global.defaultFontSize),r=c),0!==e&&(d+=t/(u(i)-u(r))*(u(e)-u(r))),n+=a*d),n},getValueForPixel:function(e){var t,n,r,i,a=this,o=a.options.ticks,l=o.reverse,s=Be.log10,u=a._getFirstTickValue(a.minNotZero);if(l?(n=a.end,r=a.start):(n=a.start,r=a.end),a.isHorizontal()?(t=a.width,i=l?a.right-e:e-a.left):(t=a.height,i=l?e-a.top:a.bottom-e),i!==n){if(0===n){var c=Rr(o.fontSize,Ye.global.defaultFontSize);i-=c,t-=c,n=u}i*=s(r)-s(n),i/=t,i=Math.pow(10,s(n)+i)}return i}}),Fr=Ir;jr._defaults=Fr;var zr=Be.valueOrDefault,Wr=Be.valueAtIndexOrDefault,Yr=Be.options.resolve,Hr={display:!0,animate:!0,position:"chartArea",angleLines:{display:!0,color:"rgba(0, 0, 0, 0.1)",lineWidth:1,borderDash:[],borderDashOffset:0},gridLines:{circular:!1},ticks:{showLabelBackdrop:!0,backdropColor:"rgba(255,255,255,0.75)",backdropPaddingY:2,backdropPaddingX:2,callback:mr.formatters.linear},pointLabels:{display:!0,fontSize:10,callback:function(e){return e}}};function Ur(e){var t=e.options;return t.angleLines.display||t.pointLabels.display?e.chart.data.labels.length:0}function Vr(e){var t=e.ticks;return t.display&&e.display?zr(t.fontSize,Ye.global.defaultFontSize)+2*t.backdropPaddingY:0}function Br(e,t,n){return Be.isArray(n)?{w:Be.longestText(e,e.font,n),h:n.length*t}:{w:e.measureText(n).width,h:t}}function $r(e,t,n,r,i){return e===r||e===i?{start:t-n/2,end:t+n/2}:e<r||e>i?{start:t-n,end:t}:{start:t,end:t+n}}function Xr(e){var t,n,r,i=Be.options._parseFont(e.options.pointLabels),a={l:0,r:e.width,t:0,b:e.height-e.paddingTop},o={};e.ctx.font=i.string,e._pointLabelSizes=[];var l=Ur(e);for(t=0;t<l;t++){r=e.getPointPosition(t,e.drawingArea+5),n=Br(e.ctx,i.lineHeight,e.pointLabels[t]||""),e._pointLabelSizes[t]=n;var s=e.getIndexAngle(t),u=Be.toDegrees(s)%360,c=$r(u,r.x,n.w,0,180),d=$r(u,r.y,n.h,90,270);c.start<a.l&&(a.l=c.start,o.l=s),c.end>a.r&&(a.r=c.end,o.r=s),d.start<a.t&&(a.t=d.start,o.t=s),d.end>a.b&&(a.b=d.end,o.b=s)}e.setReductions(e.drawingArea,a,o)}function qr(e){return 0===e||180===e?"center":e<180?"left":"right"}function Gr(e,t,n,r){var i,a,o=n.y+r/2;if(Be.isArray(t))for(i=0,a=t.length;i<a;++i)e.fillText(t[i],n.x,o),o+=r;else e.fillText(t,n.x,o)}function Kr(e,t,n){90===e||270===e?n.y-=t.h/2:(e>270||e<90)&&(n.y-=t.h)}function Qr(e){var t=e.ctx,n=e.options,r=n.angleLines,i=n.gridLines,a=n.pointLabels,o=zr(r.lineWidth,i.lineWidth),l=zr(r.color,i.color),s=Vr(n);t.save(),t.lineWidth=o,t.strokeStyle=l,t.setLineDash&&(t.setLineDash(Yr([r.borderDash,i.borderDash,[]])),t.lineDashOffset=Yr([r.borderDashOffset,i.borderDashOffset,0]));var u=e.getDistanceFromCenterForValue(n.ticks.reverse?e.min:e.max),c=Be.options._parseFont(a);t.font=c.string,t.textBaseline="middle";for(var d=Ur(e)-1;d>=0;d--){if(r.display&&o&&l){var f=e.getPointPosition(d,u);t.beginPath(),t.moveTo(e.xCenter,e.yCenter),t.lineTo(f.x,f.y),t.stroke()}if(a.display){var h=0===d?s/2:0,p=e.getPointPosition(d,u+h+5),g=Wr(a.fontColor,d,Ye.global.defaultFontColor);t.fillStyle=g;var m=e.getIndexAngle(d),v=Be.toDegrees(m);t.textAlign=qr(v),Kr(v,e._pointLabelSizes[d],p),Gr(t,e.pointLabels[d]||"",p,c.lineHeight)}}t.restore()}function Zr(e,t,n,r){var i,a=e.ctx,o=t.circular,l=Ur(e),s=Wr(t.color,r-1),u=Wr(t.lineWidth,r-1);if((o||l)&&s&&u){if(a.save(),a.strokeStyle=s,a.lineWidth=u,a.setLineDash&&(a.setLineDash(t.borderDash||[]),a.lineDashOffset=t.borderDashOffset||0),a.beginPath(),o)a.arc(e.xCenter,e.yCenter,n,0,2*Math.PI);else{i=e.getPointPosition(0,n),a.moveTo(i.x,i.y);for(var c=1;c<l;c++)i=e.getPointPosition(c,n),a.lineTo(i.x,i.y)}a.closePath(),a.stroke(),a.restore()}}function Jr(e){return Be.isNumber(e)?e:0}var ei=Pr.extend({setDimensions:function(){var e=this;e.width=e.maxWidth,e.height=e.maxHeight,e.paddingTop=Vr(e.options)/2,e.xCenter=Math.floor(e.width/2),e.yCenter=Math.floor((e.height-e.paddingTop)/2),e.drawingArea=Math.min(e.height-e.paddingTop,e.width)/2},determineDataLimits:function(){var e=this,t=e.chart,n=Number.POSITIVE_INFINITY,r=Number.NEGATIVE_INFINITY;Be.each(t.data.datasets,(function(i,a){if(t.isDatasetVisible(a)){var o=t.getDatasetMeta(a);Be.each(i.data,(function(t,i){var a=+e.getRightValue(t);isNaN(a)||o.data[i].hidden||(n=Math.min(a,n),r=Math.max(a,r))}))}})),e.min=n===Number.POSITIVE_INFINITY?0:n,e.max=r===Number.NEGATIVE_INFINITY?0:r,e.handleTickRangeOptions()},_computeTickLimit:function(){return Math.ceil(this.drawingArea/Vr(this.options))},convertTicksToLabels:function(){var e=this;Pr.prototype.convertTicksToLabels.call(e),e.pointLabels=e.chart.data.labels.map(e.options.pointLabels.callback,e)},getLabelForIndex:function(e,t){return+this.getRightValue(this.chart.data.datasets[t].data[e])},fit:function(){var e=this,t=e.options;t.display&&t.pointLabels.display?Xr(e):e.setCenterPoint(0,0,0,0)},setReductions:function(e,t,n){var r=this,i=t.l/Math.sin(n.l),a=Math.max(t.r-r.width,0)/Math.sin(n.r),o=-t.t/Math.cos(n.t),l=-Math.max(t.b-(r.height-r.paddingTop),0)/Math.cos(n.b);i=Jr(i),a=Jr(a),o=Jr(o),l=Jr(l),r.drawingArea=Math.min(Math.floor(e-(i+a)/2),Math.floor(e-(o+l)/2)),r.setCenterPoint(i,a,o,l)},setCenterPoint:function(e,t,n,r){var i=this,a=i.width-t-i.drawingArea,o=e+i.drawingArea,l=n+i.drawingArea,s=i.height-i.paddingTop-r-i.drawingArea;i.xCenter=Math.floor((o+a)/2+i.left),i.yCenter=Math.floor((l+s)/2+i.top+i.paddingTop)},getIndexAngle:function(e){return e*(2*Math.PI/Ur(this))+(this.chart.options&&this.chart.options.startAngle?this.chart.options.startAngle:0)*Math.PI*2/360},getDistanceFromCenterForValue:function(e){var t=this;if(null===e)return 0;var n=t.drawingArea/(t.max-t.min);return t.options.ticks.reverse?(t.max-e)*n:(e-t.min)*n},getPointPosition:function(e,t){var n=this,r=n.getIndexAngle(e)-Math.PI/2;return{x:Math.cos(r)*t+n.xCenter,y:Math.sin(r)*t+n.yCenter}},getPointPositionForValue:function(e,t){return this.getPointPosition(e,this.getDistanceFromCenterForValue(t))},getBasePosition:function(){var e=this,t=e.min,n=e.max;return e.getPointPositionForValue(0,e.beginAtZero?0:t<0&&n<0?n:t>0&&n>0?t:0)},draw:function(){var e=this,t=e.options,n=t.gridLines,r=t.ticks;if(t.display){var i=e.ctx,a=this.getIndexAngle(0),o=Be.options._parseFont(r);(t.angleLines.display||t.pointLabels.display)&&Qr(e),Be.each(e.ticks,(function(t,l){if(l>0||r.reverse){var s=e.getDistanceFromCenterForValue(e.ticksAsNumbers[l]);if(n.display&&0!==l&&Zr(e,n,s,l),r.display){var u=zr(r.fontColor,Ye.global.defaultFontColor);if(i.font=o.string,i.save(),i.translate(e.xCenter,e.yCenter),i.rotate(a),r.showLabelBackdrop){var c=i.measureText(t).width;i.fillStyle=r.backdropColor,i.fillRect(-c/2-r.backdropPaddingX,-s-o.size/2-r.backdropPaddingY,c+2*r.backdropPaddingX,o.size+2*r.backdropPaddingY)}i.textAlign="center",i.textBaseline="middle",i.fillStyle=u,i.fillText(t,0,-s),i.restore()}}}))}}}),ti=Hr;ei._defaults=ti;var ni=Be.valueOrDefault,ri=Number.MIN_SAFE_INTEGER||-9007199254740991,ii=Number.MAX_SAFE_INTEGER||9007199254740991,ai={millisecond:{common:!0,size:1,steps:[1,2,5,10,20,50,100,250,500]},second:{common:!0,size:1e3,steps:[1,2,5,10,15,30]},minute:{common:!0,size:6e4,steps:[1,2,5,10,15,30]},hour:{common:!0,size:36e5,steps:[1,2,3,6,12]},day:{common:!0,size:864e5,steps:[1,2,5]},week:{common:!1,size:6048e5,steps:[1,2,3,4]},month:{common:!0,size:2628e6,steps:[1,2,3]},quarter:{common:!1,size:7884e6,steps:[1,2,3,4]},year:{common:!0,size:3154e7}},oi=Object.keys(ai);function li(e,t){return e-t}function si(e){var t,n,r,i={},a=[];for(t=0,n=e.length;t<n;++t)i[r=e[t]]||(i[r]=!0,a.push(r));return a}function ui(e,t,n,r){if("linear"===r||!e.length)return[{time:t,pos:0},{time:n,pos:1}];var i,a,o,l,s,u=[],c=[t];for(i=0,a=e.length;i<a;++i)(l=e[i])>t&&l<n&&c.push(l);for(c.push(n),i=0,a=c.length;i<a;++i)s=c[i+1],o=c[i-1],l=c[i],void 0!==o&&void 0!==s&&Math.round((s+o)/2)===l||u.push({time:l,pos:i/(a-1)});return u}function ci(e,t,n){for(var r,i,a,o=0,l=e.length-1;o>=0&&o<=l;){if(i=e[(r=o+l>>1)-1]||null,a=e[r],!i)return{lo:null,hi:a};if(a[t]<n)o=r+1;else{if(!(i[t]>n))return{lo:i,hi:a};l=r-1}}return{lo:a,hi:null}}function di(e,t,n,r){var i=ci(e,t,n),a=i.lo?i.hi?i.lo:e[e.length-2]:e[0],o=i.lo?i.hi?i.hi:e[e.length-1]:e[1],l=o[t]-a[t],s=l?(n-a[t])/l:0,u=(o[r]-a[r])*s;return a[r]+u}function fi(e,t){var n=e._adapter,r=e.options.time,i=r.parser,a=i||r.format,o=t;return"function"===typeof i&&(o=i(o)),Be.isFinite(o)||(o="string"===typeof a?n.parse(o,a):n.parse(o)),null!==o?+o:(i||"function"!==typeof a||(o=a(t),Be.isFinite(o)||(o=n.parse(o))),o)}function hi(e,t){if(Be.isNullOrUndef(t))return null;var n=e.options.time,r=fi(e,e.getRightValue(t));return null===r||n.round&&(r=+e._adapter.startOf(r,n.round)),r}function pi(e,t,n,r){var i,a,o,l=t-e,s=ai[n],u=s.size,c=s.steps;if(!c)return Math.ceil(l/(r*u));for(i=0,a=c.length;i<a&&(o=c[i],!(Math.ceil(l/(u*o))<=r));++i);return o}function gi(e,t,n,r){var i,a,o,l=oi.length;for(i=oi.indexOf(e);i<l-1;++i)if(o=(a=ai[oi[i]]).steps?a.steps[a.steps.length-1]:ii,a.common&&Math.ceil((n-t)/(o*a.size))<=r)return oi[i];return oi[l-1]}function mi(e,t,n,r,i){var a,o;for(a=oi.length-1;a>=oi.indexOf(n);a--)if(o=oi[a],ai[o].common&&e._adapter.diff(i,r,o)>=t.length)return o;return oi[n?oi.indexOf(n):0]}function vi(e){for(var t=oi.indexOf(e)+1,n=oi.length;t<n;++t)if(ai[oi[t]].common)return oi[t]}function yi(e,t,n,r){var i,a=e._adapter,o=e.options,l=o.time,s=l.unit||gi(l.minUnit,t,n,r),u=vi(s),c=ni(l.stepSize,l.unitStepSize),d="week"===s&&l.isoWeekday,f=o.ticks.major.enabled,h=ai[s],p=t,g=n,m=[];for(c||(c=pi(t,n,s,r)),d&&(p=+a.startOf(p,"isoWeek",d),g=+a.startOf(g,"isoWeek",d)),p=+a.startOf(p,d?"day":s),(g=+a.startOf(g,d?"day":s))<n&&(g=+a.add(g,1,s)),i=p,f&&u&&!d&&!l.round&&(i=+a.startOf(i,u),i=+a.add(i,~~((p-i)/(h.size*c))*c,s));i<g;i=+a.add(i,c,s))m.push(+i);return m.push(+i),m}function bi(e,t,n,r,i){var a,o,l=0,s=0;return i.offset&&t.length&&(i.time.min||(a=di(e,"time",t[0],"pos"),l=1===t.length?1-a:(di(e,"time",t[1],"pos")-a)/2),i.time.max||(o=di(e,"time",t[t.length-1],"pos"),s=1===t.length?o:(o-di(e,"time",t[t.length-2],"pos"))/2)),{start:l,end:s}}function xi(e,t,n){var r,i,a,o,l=[];for(r=0,i=t.length;r<i;++r)a=t[r],o=!!n&&a===+e._adapter.startOf(a,n),l.push({value:a,major:o});return l}var wi={position:"bottom",distribution:"linear",bounds:"data",adapters:{},time:{parser:!1,format:!1,unit:!1,round:!1,displayFormat:!1,isoWeekday:!1,minUnit:"millisecond",displayFormats:{}},ticks:{autoSkip:!1,source:"auto",major:{enabled:!1}}},_i=_r.extend({initialize:function(){this.mergeTicksOptions(),_r.prototype.initialize.call(this)},update:function(){var e=this,t=e.options,n=t.time||(t.time={}),r=e._adapter=new gr._date(t.adapters.date);return n.format&&console.warn("options.time.format is deprecated and replaced by options.time.parser."),Be.mergeIf(n.displayFormats,r.formats()),_r.prototype.update.apply(e,arguments)},getRightValue:function(e){return e&&void 0!==e.t&&(e=e.t),_r.prototype.getRightValue.call(this,e)},determineDataLimits:function(){var e,t,n,r,i,a,o=this,l=o.chart,s=o._adapter,u=o.options.time,c=u.unit||"day",d=ii,f=ri,h=[],p=[],g=[],m=l.data.labels||[];for(e=0,n=m.length;e<n;++e)g.push(hi(o,m[e]));for(e=0,n=(l.data.datasets||[]).length;e<n;++e)if(l.isDatasetVisible(e))if(i=l.data.datasets[e].data,Be.isObject(i[0]))for(p[e]=[],t=0,r=i.length;t<r;++t)a=hi(o,i[t]),h.push(a),p[e][t]=a;else{for(t=0,r=g.length;t<r;++t)h.push(g[t]);p[e]=g.slice(0)}else p[e]=[];g.length&&(g=si(g).sort(li),d=Math.min(d,g[0]),f=Math.max(f,g[g.length-1])),h.length&&(h=si(h).sort(li),d=Math.min(d,h[0]),f=Math.max(f,h[h.length-1])),d=hi(o,u.min)||d,f=hi(o,u.max)||f,d=d===ii?+s.startOf(Date.now(),c):d,f=f===ri?+s.endOf(Date.now(),c)+1:f,o.min=Math.min(d,f),o.max=Math.max(d+1,f),o._horizontal=o.isHorizontal(),o._table=[],o._timestamps={data:h,datasets:p,labels:g}},buildTicks:function(){var e,t,n,r=this,i=r.min,a=r.max,o=r.options,l=o.time,s=[],u=[];switch(o.ticks.source){case"data":s=r._timestamps.data;break;case"labels":s=r._timestamps.labels;break;case"auto":default:s=yi(r,i,a,r.getLabelCapacity(i),o)}for("ticks"===o.bounds&&s.length&&(i=s[0],a=s[s.length-1]),i=hi(r,l.min)||i,a=hi(r,l.max)||a,e=0,t=s.length;e<t;++e)(n=s[e])>=i&&n<=a&&u.push(n);return r.min=i,r.max=a,r._unit=l.unit||mi(r,u,l.minUnit,r.min,r.max),r._majorUnit=vi(r._unit),r._table=ui(r._timestamps.data,i,a,o.distribution),r._offsets=bi(r._table,u,i,a,o),o.ticks.reverse&&u.reverse(),xi(r,u,r._majorUnit)},getLabelForIndex:function(e,t){var n=this,r=n._adapter,i=n.chart.data,a=n.options.time,o=i.labels&&e<i.labels.length?i.labels[e]:"",l=i.datasets[t].data[e];return Be.isObject(l)&&(o=n.getRightValue(l)),a.tooltipFormat?r.format(fi(n,o),a.tooltipFormat):"string"===typeof o?o:r.format(fi(n,o),a.displayFormats.datetime)},tickFormatFunction:function(e,t,n,r){var i=this,a=i._adapter,o=i.options,l=o.time.displayFormats,s=l[i._unit],u=i._majorUnit,c=l[u],d=+a.startOf(e,u),f=o.ticks.major,h=f.enabled&&u&&c&&e===d,p=a.format(e,r||(h?c:s)),g=h?f:o.ticks.minor,m=ni(g.callback,g.userCallback);return m?m(p,t,n):p},convertTicksToLabels:function(e){var t,n,r=[];for(t=0,n=e.length;t<n;++t)r.push(this.tickFormatFunction(e[t].value,t,e));return r},getPixelForOffset:function(e){var t=this,n=t.options.ticks.reverse,r=t._horizontal?t.width:t.height,i=t._horizontal?n?t.right:t.left:n?t.bottom:t.top,a=di(t._table,"time",e,"pos"),o=r*(t._offsets.start+a)/(t._offsets.start+1+t._offsets.end);return n?i-o:i+o},getPixelForValue:function(e,t,n){var r=this,i=null;if(void 0!==t&&void 0!==n&&(i=r._timestamps.datasets[n][t]),null===i&&(i=hi(r,e)),null!==i)return r.getPixelForOffset(i)},getPixelForTick:function(e){var t=this.getTicks();return e>=0&&e<t.length?this.getPixelForOffset(t[e].value):null},getValueForPixel:function(e){var t=this,n=t._horizontal?t.width:t.height,r=t._horizontal?t.left:t.top,i=(n?(e-r)/n:0)*(t._offsets.start+1+t._offsets.start)-t._offsets.end,a=di(t._table,"pos",i,"time");return t._adapter._create(a)},getLabelWidth:function(e){var t=this,n=t.options.ticks,r=t.ctx.measureText(e).width,i=Be.toRadians(n.maxRotation),a=Math.cos(i),o=Math.sin(i);return r*a+ni(n.fontSize,Ye.global.defaultFontSize)*o},getLabelCapacity:function(e){var t=this,n=t.options.time.displayFormats.millisecond,r=t.tickFormatFunction(e,0,[],n),i=t.getLabelWidth(r),a=t.isHorizontal()?t.width:t.height,o=Math.floor(a/i);return o>0?o:1}}),ki=wi;_i._defaults=ki;var Si={category:Sr,linear:Dr,logarithmic:jr,radialLinear:ei,time:_i},Mi={datetime:"MMM D, YYYY, h:mm:ss a",millisecond:"h:mm:ss.SSS a",second:"h:mm:ss a",minute:"h:mm a",hour:"hA",day:"MMM D",week:"ll",month:"MMM YYYY",quarter:"[Q]Q - YYYY",year:"YYYY"};gr._date.override("function"===typeof e?{_id:"moment",formats:function(){return Mi},parse:function(t,n){return"string"===typeof t&&"string"===typeof n?t=e(t,n):t instanceof e||(t=e(t)),t.isValid()?t.valueOf():null},format:function(t,n){return e(t).format(n)},add:function(t,n,r){return e(t).add(n,r).valueOf()},diff:function(t,n,r){return e.duration(e(t).diff(e(n))).as(r)},startOf:function(t,n,r){return t=e(t),"isoWeek"===n?t.isoWeekday(r).valueOf():t.startOf(n).valueOf()},endOf:function(t,n){return e(t).endOf(n).valueOf()},_create:function(t){return e(t)}}:{}),Ye._set("global",{plugins:{filler:{propagate:!0}}});var Ci={dataset:function(e){var t=e.fill,n=e.chart,r=n.getDatasetMeta(t),i=r&&n.isDatasetVisible(t)&&r.dataset._children||[],a=i.length||0;return a?function(e,t){return t<a&&i[t]._view||null}:null},boundary:function(e){var t=e.boundary,n=t?t.x:null,r=t?t.y:null;return function(e){return{x:null===n?e.x:n,y:null===r?e.y:r}}}};function Ei(e,t,n){var r,i=e._model||{},a=i.fill;if(void 0===a&&(a=!!i.backgroundColor),!1===a||null===a)return!1;if(!0===a)return"origin";if(r=parseFloat(a,10),isFinite(r)&&Math.floor(r)===r)return"-"!==a[0]&&"+"!==a[0]||(r=t+r),!(r===t||r<0||r>=n)&&r;switch(a){case"bottom":return"start";case"top":return"end";case"zero":return"origin";case"origin":case"start":case"end":return a;default:return!1}}function Oi(e){var t,n=e.el._model||{},r=e.el._scale||{},i=e.fill,a=null;if(isFinite(i))return null;if("start"===i?a=void 0===n.scaleBottom?r.bottom:n.scaleBottom:"end"===i?a=void 0===n.scaleTop?r.top:n.scaleTop:void 0!==n.scaleZero?a=n.scaleZero:r.getBasePosition?a=r.getBasePosition():r.getBasePixel&&(a=r.getBasePixel()),void 0!==a&&null!==a){if(void 0!==a.x&&void 0!==a.y)return a;if(Be.isFinite(a))return{x:(t=r.isHorizontal())?a:null,y:t?null:a}}return null}function Pi(e,t,n){var r,i=e[t].fill,a=[t];if(!n)return i;for(;!1!==i&&-1===a.indexOf(i);){if(!isFinite(i))return i;if(!(r=e[i]))return!1;if(r.visible)return i;a.push(i),i=r.fill}return!1}function Ti(e){var t=e.fill,n="dataset";return!1===t?null:(isFinite(t)||(n="boundary"),Ci[n](e))}function Di(e){return e&&!e.skip}function Ni(e,t,n,r,i){var a;if(r&&i){for(e.moveTo(t[0].x,t[0].y),a=1;a<r;++a)Be.canvas.lineTo(e,t[a-1],t[a]);for(e.lineTo(n[i-1].x,n[i-1].y),a=i-1;a>0;--a)Be.canvas.lineTo(e,n[a],n[a-1],!0)}}function Ri(e,t,n,r,i,a){var o,l,s,u,c,d,f,h=t.length,p=r.spanGaps,g=[],m=[],v=0,y=0;for(e.beginPath(),o=0,l=h+!!a;o<l;++o)c=n(u=t[s=o%h]._view,s,r),d=Di(u),f=Di(c),d&&f?(v=g.push(u),y=m.push(c)):v&&y&&(p?(d&&g.push(u),f&&m.push(c)):(Ni(e,g,m,v,y),v=y=0,g=[],m=[]));Ni(e,g,m,v,y),e.closePath(),e.fillStyle=i,e.fill()}var Ai={id:"filler",afterDatasetsUpdate:function(e,t){var n,r,i,a,o=(e.data.datasets||[]).length,l=t.propagate,s=[];for(r=0;r<o;++r)a=null,(i=(n=e.getDatasetMeta(r)).dataset)&&i._model&&i instanceof Mt.Line&&(a={visible:e.isDatasetVisible(r),fill:Ei(i,r,o),chart:e,el:i}),n.$filler=a,s.push(a);for(r=0;r<o;++r)(a=s[r])&&(a.fill=Pi(s,r,l),a.boundary=Oi(a),a.mapper=Ti(a))},beforeDatasetDraw:function(e,t){var n=t.meta.$filler;if(n){var r=e.ctx,i=n.el,a=i._view,o=i._children||[],l=n.mapper,s=a.backgroundColor||Ye.global.defaultColor;l&&s&&o.length&&(Be.canvas.clipArea(r,e.chartArea),Ri(r,o,l,a,s,i._loop),Be.canvas.unclipArea(r))}}},Ii=Be.noop,Li=Be.valueOrDefault;function ji(e,t){return e.usePointStyle&&e.boxWidth>t?t:e.boxWidth}Ye._set("global",{legend:{display:!0,position:"top",fullWidth:!0,reverse:!1,weight:1e3,onClick:function(e,t){var n=t.datasetIndex,r=this.chart,i=r.getDatasetMeta(n);i.hidden=null===i.hidden?!r.data.datasets[n].hidden:null,r.update()},onHover:null,onLeave:null,labels:{boxWidth:40,padding:10,generateLabels:function(e){var t=e.data;return Be.isArray(t.datasets)?t.datasets.map((function(t,n){return{text:t.label,fillStyle:Be.isArray(t.backgroundColor)?t.backgroundColor[0]:t.backgroundColor,hidden:!e.isDatasetVisible(n),lineCap:t.borderCapStyle,lineDash:t.borderDash,lineDashOffset:t.borderDashOffset,lineJoin:t.borderJoinStyle,lineWidth:t.borderWidth,strokeStyle:t.borderColor,pointStyle:t.pointStyle,datasetIndex:n}}),this):[]}}},legendCallback:function(e){var t=[];t.push('<ul class="'+e.id+'-legend">');for(var n=0;n<e.data.datasets.length;n++)t.push('<li><span style="background-color:'+e.data.datasets[n].backgroundColor+'"></span>'),e.data.datasets[n].label&&t.push(e.data.datasets[n].label),t.push("</li>");return t.push("</ul>"),t.join("")}});var Fi=Qe.extend({initialize:function(e){Be.extend(this,e),this.legendHitBoxes=[],this._hoveredItem=null,this.doughnutMode=!1},beforeUpdate:Ii,update:function(e,t,n){var r=this;return r.beforeUpdate(),r.maxWidth=e,r.maxHeight=t,r.margins=n,r.beforeSetDimensions(),r.setDimensions(),r.afterSetDimensions(),r.beforeBuildLabels(),r.buildLabels(),r.afterBuildLabels(),r.beforeFit(),r.fit(),r.afterFit(),r.afterUpdate(),r.minSize},afterUpdate:Ii,beforeSetDimensions:Ii,setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0,e.minSize={width:0,height:0}},afterSetDimensions:Ii,beforeBuildLabels:Ii,buildLabels:function(){var e=this,t=e.options.labels||{},n=Be.callback(t.generateLabels,[e.chart],e)||[];t.filter&&(n=n.filter((function(n){return t.filter(n,e.chart.data)}))),e.options.reverse&&n.reverse(),e.legendItems=n},afterBuildLabels:Ii,beforeFit:Ii,fit:function(){var e=this,t=e.options,n=t.labels,r=t.display,i=e.ctx,a=Be.options._parseFont(n),o=a.size,l=e.legendHitBoxes=[],s=e.minSize,u=e.isHorizontal();if(u?(s.width=e.maxWidth,s.height=r?10:0):(s.width=r?10:0,s.height=e.maxHeight),r)if(i.font=a.string,u){var c=e.lineWidths=[0],d=0;i.textAlign="left",i.textBaseline="top",Be.each(e.legendItems,(function(e,t){var r=ji(n,o)+o/2+i.measureText(e.text).width;(0===t||c[c.length-1]+r+n.padding>s.width)&&(d+=o+n.padding,c[c.length-(t>0?0:1)]=n.padding),l[t]={left:0,top:0,width:r,height:o},c[c.length-1]+=r+n.padding})),s.height+=d}else{var f=n.padding,h=e.columnWidths=[],p=n.padding,g=0,m=0,v=o+f;Be.each(e.legendItems,(function(e,t){var r=ji(n,o)+o/2+i.measureText(e.text).width;t>0&&m+v>s.height-f&&(p+=g+n.padding,h.push(g),g=0,m=0),g=Math.max(g,r),m+=v,l[t]={left:0,top:0,width:r,height:o}})),p+=g,h.push(g),s.width+=p}e.width=s.width,e.height=s.height},afterFit:Ii,isHorizontal:function(){return"top"===this.options.position||"bottom"===this.options.position},draw:function(){var e=this,t=e.options,n=t.labels,r=Ye.global,i=r.defaultColor,a=r.elements.line,o=e.width,l=e.lineWidths;if(t.display){var s,u=e.ctx,c=Li(n.fontColor,r.defaultFontColor),d=Be.options._parseFont(n),f=d.size;u.textAlign="left",u.textBaseline="middle",u.lineWidth=.5,u.strokeStyle=c,u.fillStyle=c,u.font=d.string;var h=ji(n,f),p=e.legendHitBoxes,g=function(e,n,r){if(!(isNaN(h)||h<=0)){u.save();var o=Li(r.lineWidth,a.borderWidth);if(u.fillStyle=Li(r.fillStyle,i),u.lineCap=Li(r.lineCap,a.borderCapStyle),u.lineDashOffset=Li(r.lineDashOffset,a.borderDashOffset),u.lineJoin=Li(r.lineJoin,a.borderJoinStyle),u.lineWidth=o,u.strokeStyle=Li(r.strokeStyle,i),u.setLineDash&&u.setLineDash(Li(r.lineDash,a.borderDash)),t.labels&&t.labels.usePointStyle){var l=h*Math.SQRT2/2,s=e+h/2,c=n+f/2;Be.canvas.drawPoint(u,r.pointStyle,l,s,c)}else 0!==o&&u.strokeRect(e,n,h,f),u.fillRect(e,n,h,f);u.restore()}},m=function(e,t,n,r){var i=f/2,a=h+i+e,o=t+i;u.fillText(n.text,a,o),n.hidden&&(u.beginPath(),u.lineWidth=2,u.moveTo(a,o),u.lineTo(a+r,o),u.stroke())},v=e.isHorizontal();s=v?{x:e.left+(o-l[0])/2+n.padding,y:e.top+n.padding,line:0}:{x:e.left+n.padding,y:e.top+n.padding,line:0};var y=f+n.padding;Be.each(e.legendItems,(function(t,r){var i=u.measureText(t.text).width,a=h+f/2+i,c=s.x,d=s.y;v?r>0&&c+a+n.padding>e.left+e.minSize.width&&(d=s.y+=y,s.line++,c=s.x=e.left+(o-l[s.line])/2+n.padding):r>0&&d+y>e.top+e.minSize.height&&(c=s.x=c+e.columnWidths[s.line]+n.padding,d=s.y=e.top+n.padding,s.line++),g(c,d,t),p[r].left=c,p[r].top=d,m(c,d,t,i),v?s.x+=a+n.padding:s.y+=y}))}},_getLegendItemAt:function(e,t){var n,r,i,a=this;if(e>=a.left&&e<=a.right&&t>=a.top&&t<=a.bottom)for(i=a.legendHitBoxes,n=0;n<i.length;++n)if(e>=(r=i[n]).left&&e<=r.left+r.width&&t>=r.top&&t<=r.top+r.height)return a.legendItems[n];return null},handleEvent:function(e){var t,n=this,r=n.options,i="mouseup"===e.type?"click":e.type;if("mousemove"===i){if(!r.onHover&&!r.onLeave)return}else{if("click"!==i)return;if(!r.onClick)return}t=n._getLegendItemAt(e.x,e.y),"click"===i?t&&r.onClick&&r.onClick.call(n,e.native,t):(r.onLeave&&t!==n._hoveredItem&&(n._hoveredItem&&r.onLeave.call(n,e.native,n._hoveredItem),n._hoveredItem=t),r.onHover&&t&&r.onHover.call(n,e.native,t))}});function zi(e,t){var n=new Fi({ctx:e.ctx,options:t,chart:e});fn.configure(e,n,t),fn.addBox(e,n),e.legend=n}var Wi={id:"legend",_element:Fi,beforeInit:function(e){var t=e.options.legend;t&&zi(e,t)},beforeUpdate:function(e){var t=e.options.legend,n=e.legend;t?(Be.mergeIf(t,Ye.global.legend),n?(fn.configure(e,n,t),n.options=t):zi(e,t)):n&&(fn.removeBox(e,n),delete e.legend)},afterEvent:function(e,t){var n=e.legend;n&&n.handleEvent(t)}},Yi=Be.noop;Ye._set("global",{title:{display:!1,fontStyle:"bold",fullWidth:!0,padding:10,position:"top",text:"",weight:2e3}});var Hi=Qe.extend({initialize:function(e){var t=this;Be.extend(t,e),t.legendHitBoxes=[]},beforeUpdate:Yi,update:function(e,t,n){var r=this;return r.beforeUpdate(),r.maxWidth=e,r.maxHeight=t,r.margins=n,r.beforeSetDimensions(),r.setDimensions(),r.afterSetDimensions(),r.beforeBuildLabels(),r.buildLabels(),r.afterBuildLabels(),r.beforeFit(),r.fit(),r.afterFit(),r.afterUpdate(),r.minSize},afterUpdate:Yi,beforeSetDimensions:Yi,setDimensions:function(){var e=this;e.isHorizontal()?(e.width=e.maxWidth,e.left=0,e.right=e.width):(e.height=e.maxHeight,e.top=0,e.bottom=e.height),e.paddingLeft=0,e.paddingTop=0,e.paddingRight=0,e.paddingBottom=0,e.minSize={width:0,height:0}},afterSetDimensions:Yi,beforeBuildLabels:Yi,buildLabels:Yi,afterBuildLabels:Yi,beforeFit:Yi,fit:function(){var e=this,t=e.options,n=t.display,r=e.minSize,i=Be.isArray(t.text)?t.text.length:1,a=Be.options._parseFont(t),o=n?i*a.lineHeight+2*t.padding:0;e.isHorizontal()?(r.width=e.maxWidth,r.height=o):(r.width=o,r.height=e.maxHeight),e.width=r.width,e.height=r.height},afterFit:Yi,isHorizontal:function(){var e=this.options.position;return"top"===e||"bottom"===e},draw:function(){var e=this,t=e.ctx,n=e.options;if(n.display){var r,i,a,o=Be.options._parseFont(n),l=o.lineHeight,s=l/2+n.padding,u=0,c=e.top,d=e.left,f=e.bottom,h=e.right;t.fillStyle=Be.valueOrDefault(n.fontColor,Ye.global.defaultFontColor),t.font=o.string,e.isHorizontal()?(i=d+(h-d)/2,a=c+s,r=h-d):(i="left"===n.position?d+s:h-s,a=c+(f-c)/2,r=f-c,u=Math.PI*("left"===n.position?-.5:.5)),t.save(),t.translate(i,a),t.rotate(u),t.textAlign="center",t.textBaseline="middle";var p=n.text;if(Be.isArray(p))for(var g=0,m=0;m<p.length;++m)t.fillText(p[m],0,g,r),g+=l;else t.fillText(p,0,0,r);t.restore()}}});function Ui(e,t){var n=new Hi({ctx:e.ctx,options:t,chart:e});fn.configure(e,n,t),fn.addBox(e,n),e.titleBlock=n}var Vi={},Bi=Ai,$i=Wi,Xi={id:"title",_element:Hi,beforeInit:function(e){var t=e.options.title;t&&Ui(e,t)},beforeUpdate:function(e){var t=e.options.title,n=e.titleBlock;t?(Be.mergeIf(t,Ye.global.title),n?(fn.configure(e,n,t),n.options=t):Ui(e,t)):n&&(fn.removeBox(e,n),delete e.titleBlock)}};for(var qi in Vi.filler=Bi,Vi.legend=$i,Vi.title=Xi,dr.helpers=Be,fr(dr),dr._adapters=gr,dr.Animation=Je,dr.animationService=et,dr.controllers=Jt,dr.DatasetController=ot,dr.defaults=Ye,dr.Element=Qe,dr.elements=Mt,dr.Interaction=ln,dr.layouts=fn,dr.platform=Yn,dr.plugins=Hn,dr.Scale=_r,dr.scaleService=Un,dr.Ticks=mr,dr.Tooltip=rr,dr.helpers.each(Si,(function(e,t){dr.scaleService.registerScaleType(t,e,e._defaults)})),Vi)Vi.hasOwnProperty(qi)&&dr.plugins.register(Vi[qi]);dr.platform.initialize();var Gi=dr;return"undefined"!==typeof window&&(window.Chart=dr),dr.Chart=dr,dr.Legend=Vi.legend._element,dr.Title=Vi.title._element,dr.pluginService=dr.plugins,dr.PluginBase=dr.Element.extend({}),dr.canvasHelpers=dr.helpers.canvas,dr.layoutService=dr.layouts,dr.LinearScaleBase=Pr,dr.helpers.each(["Bar","Bubble","Doughnut","Line","PolarArea","Radar","Scatter"],(function(e){dr[e]=function(t,n){return new dr(t,dr.helpers.merge(n||{},{type:e.charAt(0).toLowerCase()+e.slice(1)}))}})),Gi}(function(){try{return n(58)}catch(e){}}())},function(e,t,n){(function(e){e.exports=function(){"use strict";var t,n;function r(){return t.apply(null,arguments)}function i(e){t=e}function a(e){return e instanceof Array||"[object Array]"===Object.prototype.toString.call(e)}function o(e){return null!=e&&"[object Object]"===Object.prototype.toString.call(e)}function l(e,t){return Object.prototype.hasOwnProperty.call(e,t)}function s(e){if(Object.getOwnPropertyNames)return 0===Object.getOwnPropertyNames(e).length;var t;for(t in e)if(l(e,t))return!1;return!0}function u(e){return void 0===e}function c(e){return"number"===typeof e||"[object Number]"===Object.prototype.toString.call(e)}function d(e){return e instanceof Date||"[object Date]"===Object.prototype.toString.call(e)}function f(e,t){var n,r=[];for(n=0;n<e.length;++n)r.push(t(e[n],n));return r}function h(e,t){for(var n in t)l(t,n)&&(e[n]=t[n]);return l(t,"toString")&&(e.toString=t.toString),l(t,"valueOf")&&(e.valueOf=t.valueOf),e}function p(e,t,n,r){return Xn(e,t,n,r,!0).utc()}function g(){return{empty:!1,unusedTokens:[],unusedInput:[],overflow:-2,charsLeftOver:0,nullInput:!1,invalidEra:null,invalidMonth:null,invalidFormat:!1,userInvalidated:!1,iso:!1,parsedDateParts:[],era:null,meridiem:null,rfc2822:!1,weekdayMismatch:!1}}function m(e){return null==e._pf&&(e._pf=g()),e._pf}function v(e){if(null==e._isValid){var t=m(e),r=n.call(t.parsedDateParts,(function(e){return null!=e})),i=!isNaN(e._d.getTime())&&t.overflow<0&&!t.empty&&!t.invalidEra&&!t.invalidMonth&&!t.invalidWeekday&&!t.weekdayMismatch&&!t.nullInput&&!t.invalidFormat&&!t.userInvalidated&&(!t.meridiem||t.meridiem&&r);if(e._strict&&(i=i&&0===t.charsLeftOver&&0===t.unusedTokens.length&&void 0===t.bigHour),null!=Object.isFrozen&&Object.isFrozen(e))return i;e._isValid=i}return e._isValid}function y(e){var t=p(NaN);return null!=e?h(m(t),e):m(t).userInvalidated=!0,t}n=Array.prototype.some?Array.prototype.some:function(e){var t,n=Object(this),r=n.length>>>0;for(t=0;t<r;t++)if(t in n&&e.call(this,n[t],t,n))return!0;return!1};var b=r.momentProperties=[],x=!1;function w(e,t){var n,r,i;if(u(t._isAMomentObject)||(e._isAMomentObject=t._isAMomentObject),u(t._i)||(e._i=t._i),u(t._f)||(e._f=t._f),u(t._l)||(e._l=t._l),u(t._strict)||(e._strict=t._strict),u(t._tzm)||(e._tzm=t._tzm),u(t._isUTC)||(e._isUTC=t._isUTC),u(t._offset)||(e._offset=t._offset),u(t._pf)||(e._pf=m(t)),u(t._locale)||(e._locale=t._locale),b.length>0)for(n=0;n<b.length;n++)u(i=t[r=b[n]])||(e[r]=i);return e}function _(e){w(this,e),this._d=new Date(null!=e._d?e._d.getTime():NaN),this.isValid()||(this._d=new Date(NaN)),!1===x&&(x=!0,r.updateOffset(this),x=!1)}function k(e){return e instanceof _||null!=e&&null!=e._isAMomentObject}function S(e){!1===r.suppressDeprecationWarnings&&"undefined"!==typeof console&&console.warn&&console.warn("Deprecation warning: "+e)}function M(e,t){var n=!0;return h((function(){if(null!=r.deprecationHandler&&r.deprecationHandler(null,e),n){var i,a,o,s=[];for(a=0;a<arguments.length;a++){if(i="","object"===typeof arguments[a]){for(o in i+="\n["+a+"] ",arguments[0])l(arguments[0],o)&&(i+=o+": "+arguments[0][o]+", ");i=i.slice(0,-2)}else i=arguments[a];s.push(i)}S(e+"\nArguments: "+Array.prototype.slice.call(s).join("")+"\n"+(new Error).stack),n=!1}return t.apply(this,arguments)}),t)}var C,E={};function O(e,t){null!=r.deprecationHandler&&r.deprecationHandler(e,t),E[e]||(S(t),E[e]=!0)}function P(e){return"undefined"!==typeof Function&&e instanceof Function||"[object Function]"===Object.prototype.toString.call(e)}function T(e){var t,n;for(n in e)l(e,n)&&(P(t=e[n])?this[n]=t:this["_"+n]=t);this._config=e,this._dayOfMonthOrdinalParseLenient=new RegExp((this._dayOfMonthOrdinalParse.source||this._ordinalParse.source)+"|"+/\d{1,2}/.source)}function D(e,t){var n,r=h({},e);for(n in t)l(t,n)&&(o(e[n])&&o(t[n])?(r[n]={},h(r[n],e[n]),h(r[n],t[n])):null!=t[n]?r[n]=t[n]:delete r[n]);for(n in e)l(e,n)&&!l(t,n)&&o(e[n])&&(r[n]=h({},r[n]));return r}function N(e){null!=e&&this.set(e)}r.suppressDeprecationWarnings=!1,r.deprecationHandler=null,C=Object.keys?Object.keys:function(e){var t,n=[];for(t in e)l(e,t)&&n.push(t);return n};var R={sameDay:"[Today at] LT",nextDay:"[Tomorrow at] LT",nextWeek:"dddd [at] LT",lastDay:"[Yesterday at] LT",lastWeek:"[Last] dddd [at] LT",sameElse:"L"};function A(e,t,n){var r=this._calendar[e]||this._calendar.sameElse;return P(r)?r.call(t,n):r}function I(e,t,n){var r=""+Math.abs(e),i=t-r.length;return(e>=0?n?"+":"":"-")+Math.pow(10,Math.max(0,i)).toString().substr(1)+r}var L=/(\[[^\[]*\])|(\\)?([Hh]mm(ss)?|Mo|MM?M?M?|Do|DDDo|DD?D?D?|ddd?d?|do?|w[o|w]?|W[o|W]?|Qo?|N{1,5}|YYYYYY|YYYYY|YYYY|YY|y{2,4}|yo?|gg(ggg?)?|GG(GGG?)?|e|E|a|A|hh?|HH?|kk?|mm?|ss?|S{1,9}|x|X|zz?|ZZ?|.)/g,j=/(\[[^\[]*\])|(\\)?(LTS|LT|LL?L?L?|l{1,4})/g,F={},z={};function W(e,t,n,r){var i=r;"string"===typeof r&&(i=function(){return this[r]()}),e&&(z[e]=i),t&&(z[t[0]]=function(){return I(i.apply(this,arguments),t[1],t[2])}),n&&(z[n]=function(){return this.localeData().ordinal(i.apply(this,arguments),e)})}function Y(e){return e.match(/\[[\s\S]/)?e.replace(/^\[|\]$/g,""):e.replace(/\\/g,"")}function H(e){var t,n,r=e.match(L);for(t=0,n=r.length;t<n;t++)z[r[t]]?r[t]=z[r[t]]:r[t]=Y(r[t]);return function(t){var i,a="";for(i=0;i<n;i++)a+=P(r[i])?r[i].call(t,e):r[i];return a}}function U(e,t){return e.isValid()?(t=V(t,e.localeData()),F[t]=F[t]||H(t),F[t](e)):e.localeData().invalidDate()}function V(e,t){var n=5;function r(e){return t.longDateFormat(e)||e}for(j.lastIndex=0;n>=0&&j.test(e);)e=e.replace(j,r),j.lastIndex=0,n-=1;return e}var B={LTS:"h:mm:ss A",LT:"h:mm A",L:"MM/DD/YYYY",LL:"MMMM D, YYYY",LLL:"MMMM D, YYYY h:mm A",LLLL:"dddd, MMMM D, YYYY h:mm A"};function $(e){var t=this._longDateFormat[e],n=this._longDateFormat[e.toUpperCase()];return t||!n?t:(this._longDateFormat[e]=n.match(L).map((function(e){return"MMMM"===e||"MM"===e||"DD"===e||"dddd"===e?e.slice(1):e})).join(""),this._longDateFormat[e])}var X="Invalid date";function q(){return this._invalidDate}var G="%d",K=/\d{1,2}/;function Q(e){return this._ordinal.replace("%d",e)}var Z={future:"in %s",past:"%s ago",s:"a few seconds",ss:"%d seconds",m:"a minute",mm:"%d minutes",h:"an hour",hh:"%d hours",d:"a day",dd:"%d days",w:"a week",ww:"%d weeks",M:"a month",MM:"%d months",y:"a year",yy:"%d years"};function J(e,t,n,r){var i=this._relativeTime[n];return P(i)?i(e,t,n,r):i.replace(/%d/i,e)}function ee(e,t){var n=this._relativeTime[e>0?"future":"past"];return P(n)?n(t):n.replace(/%s/i,t)}var te={};function ne(e,t){var n=e.toLowerCase();te[n]=te[n+"s"]=te[t]=e}function re(e){return"string"===typeof e?te[e]||te[e.toLowerCase()]:void 0}function ie(e){var t,n,r={};for(n in e)l(e,n)&&(t=re(n))&&(r[t]=e[n]);return r}var ae={};function oe(e,t){ae[e]=t}function le(e){var t,n=[];for(t in e)l(e,t)&&n.push({unit:t,priority:ae[t]});return n.sort((function(e,t){return e.priority-t.priority})),n}function se(e){return e%4===0&&e%100!==0||e%400===0}function ue(e){return e<0?Math.ceil(e)||0:Math.floor(e)}function ce(e){var t=+e,n=0;return 0!==t&&isFinite(t)&&(n=ue(t)),n}function de(e,t){return function(n){return null!=n?(he(this,e,n),r.updateOffset(this,t),this):fe(this,e)}}function fe(e,t){return e.isValid()?e._d["get"+(e._isUTC?"UTC":"")+t]():NaN}function he(e,t,n){e.isValid()&&!isNaN(n)&&("FullYear"===t&&se(e.year())&&1===e.month()&&29===e.date()?(n=ce(n),e._d["set"+(e._isUTC?"UTC":"")+t](n,e.month(),Je(n,e.month()))):e._d["set"+(e._isUTC?"UTC":"")+t](n))}function pe(e){return P(this[e=re(e)])?this[e]():this}function ge(e,t){if("object"===typeof e){var n,r=le(e=ie(e));for(n=0;n<r.length;n++)this[r[n].unit](e[r[n].unit])}else if(P(this[e=re(e)]))return this[e](t);return this}var me,ve=/\d/,ye=/\d\d/,be=/\d{3}/,xe=/\d{4}/,we=/[+-]?\d{6}/,_e=/\d\d?/,ke=/\d\d\d\d?/,Se=/\d\d\d\d\d\d?/,Me=/\d{1,3}/,Ce=/\d{1,4}/,Ee=/[+-]?\d{1,6}/,Oe=/\d+/,Pe=/[+-]?\d+/,Te=/Z|[+-]\d\d:?\d\d/gi,De=/Z|[+-]\d\d(?::?\d\d)?/gi,Ne=/[+-]?\d+(\.\d{1,3})?/,Re=/[0-9]{0,256}['a-z\u00A0-\u05FF\u0700-\uD7FF\uF900-\uFDCF\uFDF0-\uFF07\uFF10-\uFFEF]{1,256}|[\u0600-\u06FF\/]{1,256}(\s*?[\u0600-\u06FF]{1,256}){1,2}/i;function Ae(e,t,n){me[e]=P(t)?t:function(e,r){return e&&n?n:t}}function Ie(e,t){return l(me,e)?me[e](t._strict,t._locale):new RegExp(Le(e))}function Le(e){return je(e.replace("\\","").replace(/\\(\[)|\\(\])|\[([^\]\[]*)\]|\\(.)/g,(function(e,t,n,r,i){return t||n||r||i})))}function je(e){return e.replace(/[-\/\\^$*+?.()|[\]{}]/g,"\\$&")}me={};var Fe={};function ze(e,t){var n,r=t;for("string"===typeof e&&(e=[e]),c(t)&&(r=function(e,n){n[t]=ce(e)}),n=0;n<e.length;n++)Fe[e[n]]=r}function We(e,t){ze(e,(function(e,n,r,i){r._w=r._w||{},t(e,r._w,r,i)}))}function Ye(e,t,n){null!=t&&l(Fe,e)&&Fe[e](t,n._a,n,e)}var He,Ue=0,Ve=1,Be=2,$e=3,Xe=4,qe=5,Ge=6,Ke=7,Qe=8;function Ze(e,t){return(e%t+t)%t}function Je(e,t){if(isNaN(e)||isNaN(t))return NaN;var n=Ze(t,12);return e+=(t-n)/12,1===n?se(e)?29:28:31-n%7%2}He=Array.prototype.indexOf?Array.prototype.indexOf:function(e){var t;for(t=0;t<this.length;++t)if(this[t]===e)return t;return-1},W("M",["MM",2],"Mo",(function(){return this.month()+1})),W("MMM",0,0,(function(e){return this.localeData().monthsShort(this,e)})),W("MMMM",0,0,(function(e){return this.localeData().months(this,e)})),ne("month","M"),oe("month",8),Ae("M",_e),Ae("MM",_e,ye),Ae("MMM",(function(e,t){return t.monthsShortRegex(e)})),Ae("MMMM",(function(e,t){return t.monthsRegex(e)})),ze(["M","MM"],(function(e,t){t[Ve]=ce(e)-1})),ze(["MMM","MMMM"],(function(e,t,n,r){var i=n._locale.monthsParse(e,r,n._strict);null!=i?t[Ve]=i:m(n).invalidMonth=e}));var et="January_February_March_April_May_June_July_August_September_October_November_December".split("_"),tt="Jan_Feb_Mar_Apr_May_Jun_Jul_Aug_Sep_Oct_Nov_Dec".split("_"),nt=/D[oD]?(\[[^\[\]]*\]|\s)+MMMM?/,rt=Re,it=Re;function at(e,t){return e?a(this._months)?this._months[e.month()]:this._months[(this._months.isFormat||nt).test(t)?"format":"standalone"][e.month()]:a(this._months)?this._months:this._months.standalone}function ot(e,t){return e?a(this._monthsShort)?this._monthsShort[e.month()]:this._monthsShort[nt.test(t)?"format":"standalone"][e.month()]:a(this._monthsShort)?this._monthsShort:this._monthsShort.standalone}function lt(e,t,n){var r,i,a,o=e.toLocaleLowerCase();if(!this._monthsParse)for(this._monthsParse=[],this._longMonthsParse=[],this._shortMonthsParse=[],r=0;r<12;++r)a=p([2e3,r]),this._shortMonthsParse[r]=this.monthsShort(a,"").toLocaleLowerCase(),this._longMonthsParse[r]=this.months(a,"").toLocaleLowerCase();return n?"MMM"===t?-1!==(i=He.call(this._shortMonthsParse,o))?i:null:-1!==(i=He.call(this._longMonthsParse,o))?i:null:"MMM"===t?-1!==(i=He.call(this._shortMonthsParse,o))||-1!==(i=He.call(this._longMonthsParse,o))?i:null:-1!==(i=He.call(this._longMonthsParse,o))||-1!==(i=He.call(this._shortMonthsParse,o))?i:null}function st(e,t,n){var r,i,a;if(this._monthsParseExact)return lt.call(this,e,t,n);for(this._monthsParse||(this._monthsParse=[],this._longMonthsParse=[],this._shortMonthsParse=[]),r=0;r<12;r++){if(i=p([2e3,r]),n&&!this._longMonthsParse[r]&&(this._longMonthsParse[r]=new RegExp("^"+this.months(i,"").replace(".","")+"$","i"),this._shortMonthsParse[r]=new RegExp("^"+this.monthsShort(i,"").replace(".","")+"$","i")),n||this._monthsParse[r]||(a="^"+this.months(i,"")+"|^"+this.monthsShort(i,""),this._monthsParse[r]=new RegExp(a.replace(".",""),"i")),n&&"MMMM"===t&&this._longMonthsParse[r].test(e))return r;if(n&&"MMM"===t&&this._shortMonthsParse[r].test(e))return r;if(!n&&this._monthsParse[r].test(e))return r}}function ut(e,t){var n;if(!e.isValid())return e;if("string"===typeof t)if(/^\d+$/.test(t))t=ce(t);else if(!c(t=e.localeData().monthsParse(t)))return e;return n=Math.min(e.date(),Je(e.year(),t)),e._d["set"+(e._isUTC?"UTC":"")+"Month"](t,n),e}function ct(e){return null!=e?(ut(this,e),r.updateOffset(this,!0),this):fe(this,"Month")}function dt(){return Je(this.year(),this.month())}function ft(e){return this._monthsParseExact?(l(this,"_monthsRegex")||pt.call(this),e?this._monthsShortStrictRegex:this._monthsShortRegex):(l(this,"_monthsShortRegex")||(this._monthsShortRegex=rt),this._monthsShortStrictRegex&&e?this._monthsShortStrictRegex:this._monthsShortRegex)}function ht(e){return this._monthsParseExact?(l(this,"_monthsRegex")||pt.call(this),e?this._monthsStrictRegex:this._monthsRegex):(l(this,"_monthsRegex")||(this._monthsRegex=it),this._monthsStrictRegex&&e?this._monthsStrictRegex:this._monthsRegex)}function pt(){function e(e,t){return t.length-e.length}var t,n,r=[],i=[],a=[];for(t=0;t<12;t++)n=p([2e3,t]),r.push(this.monthsShort(n,"")),i.push(this.months(n,"")),a.push(this.months(n,"")),a.push(this.monthsShort(n,""));for(r.sort(e),i.sort(e),a.sort(e),t=0;t<12;t++)r[t]=je(r[t]),i[t]=je(i[t]);for(t=0;t<24;t++)a[t]=je(a[t]);this._monthsRegex=new RegExp("^("+a.join("|")+")","i"),this._monthsShortRegex=this._monthsRegex,this._monthsStrictRegex=new RegExp("^("+i.join("|")+")","i"),this._monthsShortStrictRegex=new RegExp("^("+r.join("|")+")","i")}function gt(e){return se(e)?366:365}W("Y",0,0,(function(){var e=this.year();return e<=9999?I(e,4):"+"+e})),W(0,["YY",2],0,(function(){return this.year()%100})),W(0,["YYYY",4],0,"year"),W(0,["YYYYY",5],0,"year"),W(0,["YYYYYY",6,!0],0,"year"),ne("year","y"),oe("year",1),Ae("Y",Pe),Ae("YY",_e,ye),Ae("YYYY",Ce,xe),Ae("YYYYY",Ee,we),Ae("YYYYYY",Ee,we),ze(["YYYYY","YYYYYY"],Ue),ze("YYYY",(function(e,t){t[Ue]=2===e.length?r.parseTwoDigitYear(e):ce(e)})),ze("YY",(function(e,t){t[Ue]=r.parseTwoDigitYear(e)})),ze("Y",(function(e,t){t[Ue]=parseInt(e,10)})),r.parseTwoDigitYear=function(e){return ce(e)+(ce(e)>68?1900:2e3)};var mt=de("FullYear",!0);function vt(){return se(this.year())}function yt(e,t,n,r,i,a,o){var l;return e<100&&e>=0?(l=new Date(e+400,t,n,r,i,a,o),isFinite(l.getFullYear())&&l.setFullYear(e)):l=new Date(e,t,n,r,i,a,o),l}function bt(e){var t,n;return e<100&&e>=0?((n=Array.prototype.slice.call(arguments))[0]=e+400,t=new Date(Date.UTC.apply(null,n)),isFinite(t.getUTCFullYear())&&t.setUTCFullYear(e)):t=new Date(Date.UTC.apply(null,arguments)),t}function xt(e,t,n){var r=7+t-n;return-(7+bt(e,0,r).getUTCDay()-t)%7+r-1}function wt(e,t,n,r,i){var a,o,l=1+7*(t-1)+(7+n-r)%7+xt(e,r,i);return l<=0?o=gt(a=e-1)+l:l>gt(e)?(a=e+1,o=l-gt(e)):(a=e,o=l),{year:a,dayOfYear:o}}function _t(e,t,n){var r,i,a=xt(e.year(),t,n),o=Math.floor((e.dayOfYear()-a-1)/7)+1;return o<1?r=o+kt(i=e.year()-1,t,n):o>kt(e.year(),t,n)?(r=o-kt(e.year(),t,n),i=e.year()+1):(i=e.year(),r=o),{week:r,year:i}}function kt(e,t,n){var r=xt(e,t,n),i=xt(e+1,t,n);return(gt(e)-r+i)/7}function St(e){return _t(e,this._week.dow,this._week.doy).week}W("w",["ww",2],"wo","week"),W("W",["WW",2],"Wo","isoWeek"),ne("week","w"),ne("isoWeek","W"),oe("week",5),oe("isoWeek",5),Ae("w",_e),Ae("ww",_e,ye),Ae("W",_e),Ae("WW",_e,ye),We(["w","ww","W","WW"],(function(e,t,n,r){t[r.substr(0,1)]=ce(e)}));var Mt={dow:0,doy:6};function Ct(){return this._week.dow}function Et(){return this._week.doy}function Ot(e){var t=this.localeData().week(this);return null==e?t:this.add(7*(e-t),"d")}function Pt(e){var t=_t(this,1,4).week;return null==e?t:this.add(7*(e-t),"d")}function Tt(e,t){return"string"!==typeof e?e:isNaN(e)?"number"===typeof(e=t.weekdaysParse(e))?e:null:parseInt(e,10)}function Dt(e,t){return"string"===typeof e?t.weekdaysParse(e)%7||7:isNaN(e)?null:e}function Nt(e,t){return e.slice(t,7).concat(e.slice(0,t))}W("d",0,"do","day"),W("dd",0,0,(function(e){return this.localeData().weekdaysMin(this,e)})),W("ddd",0,0,(function(e){return this.localeData().weekdaysShort(this,e)})),W("dddd",0,0,(function(e){return this.localeData().weekdays(this,e)})),W("e",0,0,"weekday"),W("E",0,0,"isoWeekday"),ne("day","d"),ne("weekday","e"),ne("isoWeekday","E"),oe("day",11),oe("weekday",11),oe("isoWeekday",11),Ae("d",_e),Ae("e",_e),Ae("E",_e),Ae("dd",(function(e,t){return t.weekdaysMinRegex(e)})),Ae("ddd",(function(e,t){return t.weekdaysShortRegex(e)})),Ae("dddd",(function(e,t){return t.weekdaysRegex(e)})),We(["dd","ddd","dddd"],(function(e,t,n,r){var i=n._locale.weekdaysParse(e,r,n._strict);null!=i?t.d=i:m(n).invalidWeekday=e})),We(["d","e","E"],(function(e,t,n,r){t[r]=ce(e)}));var Rt="Sunday_Monday_Tuesday_Wednesday_Thursday_Friday_Saturday".split("_"),At="Sun_Mon_Tue_Wed_Thu_Fri_Sat".split("_"),It="Su_Mo_Tu_We_Th_Fr_Sa".split("_"),Lt=Re,jt=Re,Ft=Re;function zt(e,t){var n=a(this._weekdays)?this._weekdays:this._weekdays[e&&!0!==e&&this._weekdays.isFormat.test(t)?"format":"standalone"];return!0===e?Nt(n,this._week.dow):e?n[e.day()]:n}function Wt(e){return!0===e?Nt(this._weekdaysShort,this._week.dow):e?this._weekdaysShort[e.day()]:this._weekdaysShort}function Yt(e){return!0===e?Nt(this._weekdaysMin,this._week.dow):e?this._weekdaysMin[e.day()]:this._weekdaysMin}function Ht(e,t,n){var r,i,a,o=e.toLocaleLowerCase();if(!this._weekdaysParse)for(this._weekdaysParse=[],this._shortWeekdaysParse=[],this._minWeekdaysParse=[],r=0;r<7;++r)a=p([2e3,1]).day(r),this._minWeekdaysParse[r]=this.weekdaysMin(a,"").toLocaleLowerCase(),this._shortWeekdaysParse[r]=this.weekdaysShort(a,"").toLocaleLowerCase(),this._weekdaysParse[r]=this.weekdays(a,"").toLocaleLowerCase();return n?"dddd"===t?-1!==(i=He.call(this._weekdaysParse,o))?i:null:"ddd"===t?-1!==(i=He.call(this._shortWeekdaysParse,o))?i:null:-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:"dddd"===t?-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._shortWeekdaysParse,o))||-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:"ddd"===t?-1!==(i=He.call(this._shortWeekdaysParse,o))||-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._minWeekdaysParse,o))?i:null:-1!==(i=He.call(this._minWeekdaysParse,o))||-1!==(i=He.call(this._weekdaysParse,o))||-1!==(i=He.call(this._shortWeekdaysParse,o))?i:null}function Ut(e,t,n){var r,i,a;if(this._weekdaysParseExact)return Ht.call(this,e,t,n);for(this._weekdaysParse||(this._weekdaysParse=[],this._minWeekdaysParse=[],this._shortWeekdaysParse=[],this._fullWeekdaysParse=[]),r=0;r<7;r++){if(i=p([2e3,1]).day(r),n&&!this._fullWeekdaysParse[r]&&(this._fullWeekdaysParse[r]=new RegExp("^"+this.weekdays(i,"").replace(".","\\.?")+"$","i"),this._shortWeekdaysParse[r]=new RegExp("^"+this.weekdaysShort(i,"").replace(".","\\.?")+"$","i"),this._minWeekdaysParse[r]=new RegExp("^"+this.weekdaysMin(i,"").replace(".","\\.?")+"$","i")),this._weekdaysParse[r]||(a="^"+this.weekdays(i,"")+"|^"+this.weekdaysShort(i,"")+"|^"+this.weekdaysMin(i,""),this._weekdaysParse[r]=new RegExp(a.replace(".",""),"i")),n&&"dddd"===t&&this._fullWeekdaysParse[r].test(e))return r;if(n&&"ddd"===t&&this._shortWeekdaysParse[r].test(e))return r;if(n&&"dd"===t&&this._minWeekdaysParse[r].test(e))return r;if(!n&&this._weekdaysParse[r].test(e))return r}}function Vt(e){if(!this.isValid())return null!=e?this:NaN;var t=this._isUTC?this._d.getUTCDay():this._d.getDay();return null!=e?(e=Tt(e,this.localeData()),this.add(e-t,"d")):t}function Bt(e){if(!this.isValid())return null!=e?this:NaN;var t=(this.day()+7-this.localeData()._week.dow)%7;return null==e?t:this.add(e-t,"d")}function $t(e){if(!this.isValid())return null!=e?this:NaN;if(null!=e){var t=Dt(e,this.localeData());return this.day(this.day()%7?t:t-7)}return this.day()||7}function Xt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysStrictRegex:this._weekdaysRegex):(l(this,"_weekdaysRegex")||(this._weekdaysRegex=Lt),this._weekdaysStrictRegex&&e?this._weekdaysStrictRegex:this._weekdaysRegex)}function qt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysShortStrictRegex:this._weekdaysShortRegex):(l(this,"_weekdaysShortRegex")||(this._weekdaysShortRegex=jt),this._weekdaysShortStrictRegex&&e?this._weekdaysShortStrictRegex:this._weekdaysShortRegex)}function Gt(e){return this._weekdaysParseExact?(l(this,"_weekdaysRegex")||Kt.call(this),e?this._weekdaysMinStrictRegex:this._weekdaysMinRegex):(l(this,"_weekdaysMinRegex")||(this._weekdaysMinRegex=Ft),this._weekdaysMinStrictRegex&&e?this._weekdaysMinStrictRegex:this._weekdaysMinRegex)}function Kt(){function e(e,t){return t.length-e.length}var t,n,r,i,a,o=[],l=[],s=[],u=[];for(t=0;t<7;t++)n=p([2e3,1]).day(t),r=je(this.weekdaysMin(n,"")),i=je(this.weekdaysShort(n,"")),a=je(this.weekdays(n,"")),o.push(r),l.push(i),s.push(a),u.push(r),u.push(i),u.push(a);o.sort(e),l.sort(e),s.sort(e),u.sort(e),this._weekdaysRegex=new RegExp("^("+u.join("|")+")","i"),this._weekdaysShortRegex=this._weekdaysRegex,this._weekdaysMinRegex=this._weekdaysRegex,this._weekdaysStrictRegex=new RegExp("^("+s.join("|")+")","i"),this._weekdaysShortStrictRegex=new RegExp("^("+l.join("|")+")","i"),this._weekdaysMinStrictRegex=new RegExp("^("+o.join("|")+")","i")}function Qt(){return this.hours()%12||12}function Zt(){return this.hours()||24}function Jt(e,t){W(e,0,0,(function(){return this.localeData().meridiem(this.hours(),this.minutes(),t)}))}function en(e,t){return t._meridiemParse}function tn(e){return"p"===(e+"").toLowerCase().charAt(0)}W("H",["HH",2],0,"hour"),W("h",["hh",2],0,Qt),W("k",["kk",2],0,Zt),W("hmm",0,0,(function(){return""+Qt.apply(this)+I(this.minutes(),2)})),W("hmmss",0,0,(function(){return""+Qt.apply(this)+I(this.minutes(),2)+I(this.seconds(),2)})),W("Hmm",0,0,(function(){return""+this.hours()+I(this.minutes(),2)})),W("Hmmss",0,0,(function(){return""+this.hours()+I(this.minutes(),2)+I(this.seconds(),2)})),Jt("a",!0),Jt("A",!1),ne("hour","h"),oe("hour",13),Ae("a",en),Ae("A",en),Ae("H",_e),Ae("h",_e),Ae("k",_e),Ae("HH",_e,ye),Ae("hh",_e,ye),Ae("kk",_e,ye),Ae("hmm",ke),Ae("hmmss",Se),Ae("Hmm",ke),Ae("Hmmss",Se),ze(["H","HH"],$e),ze(["k","kk"],(function(e,t,n){var r=ce(e);t[$e]=24===r?0:r})),ze(["a","A"],(function(e,t,n){n._isPm=n._locale.isPM(e),n._meridiem=e})),ze(["h","hh"],(function(e,t,n){t[$e]=ce(e),m(n).bigHour=!0})),ze("hmm",(function(e,t,n){var r=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r)),m(n).bigHour=!0})),ze("hmmss",(function(e,t,n){var r=e.length-4,i=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r,2)),t[qe]=ce(e.substr(i)),m(n).bigHour=!0})),ze("Hmm",(function(e,t,n){var r=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r))})),ze("Hmmss",(function(e,t,n){var r=e.length-4,i=e.length-2;t[$e]=ce(e.substr(0,r)),t[Xe]=ce(e.substr(r,2)),t[qe]=ce(e.substr(i))}));var nn=/[ap]\.?m?\.?/i,rn=de("Hours",!0);function an(e,t,n){return e>11?n?"pm":"PM":n?"am":"AM"}var on,ln={calendar:R,longDateFormat:B,invalidDate:X,ordinal:G,dayOfMonthOrdinalParse:K,relativeTime:Z,months:et,monthsShort:tt,week:Mt,weekdays:Rt,weekdaysMin:It,weekdaysShort:At,meridiemParse:nn},sn={},un={};function cn(e,t){var n,r=Math.min(e.length,t.length);for(n=0;n<r;n+=1)if(e[n]!==t[n])return n;return r}function dn(e){return e?e.toLowerCase().replace("_","-"):e}function fn(e){for(var t,n,r,i,a=0;a<e.length;){for(t=(i=dn(e[a]).split("-")).length,n=(n=dn(e[a+1]))?n.split("-"):null;t>0;){if(r=hn(i.slice(0,t).join("-")))return r;if(n&&n.length>=t&&cn(i,n)>=t-1)break;t--}a++}return on}function hn(t){var n=null;if(void 0===sn[t]&&"undefined"!==typeof e&&e&&e.exports)try{n=on._abbr,function(){var e=new Error("Cannot find module 'undefined'");throw e.code="MODULE_NOT_FOUND",e}(),pn(n)}catch(r){sn[t]=null}return sn[t]}function pn(e,t){var n;return e&&((n=u(t)?vn(e):gn(e,t))?on=n:"undefined"!==typeof console&&console.warn&&console.warn("Locale "+e+" not found. Did you forget to load it?")),on._abbr}function gn(e,t){if(null!==t){var n,r=ln;if(t.abbr=e,null!=sn[e])O("defineLocaleOverride","use moment.updateLocale(localeName, config) to change an existing locale. moment.defineLocale(localeName, config) should only be used for creating a new locale See http://momentjs.com/guides/#/warnings/define-locale/ for more info."),r=sn[e]._config;else if(null!=t.parentLocale)if(null!=sn[t.parentLocale])r=sn[t.parentLocale]._config;else{if(null==(n=hn(t.parentLocale)))return un[t.parentLocale]||(un[t.parentLocale]=[]),un[t.parentLocale].push({name:e,config:t}),null;r=n._config}return sn[e]=new N(D(r,t)),un[e]&&un[e].forEach((function(e){gn(e.name,e.config)})),pn(e),sn[e]}return delete sn[e],null}function mn(e,t){if(null!=t){var n,r,i=ln;null!=sn[e]&&null!=sn[e].parentLocale?sn[e].set(D(sn[e]._config,t)):(null!=(r=hn(e))&&(i=r._config),t=D(i,t),null==r&&(t.abbr=e),(n=new N(t)).parentLocale=sn[e],sn[e]=n),pn(e)}else null!=sn[e]&&(null!=sn[e].parentLocale?(sn[e]=sn[e].parentLocale,e===pn()&&pn(e)):null!=sn[e]&&delete sn[e]);return sn[e]}function vn(e){var t;if(e&&e._locale&&e._locale._abbr&&(e=e._locale._abbr),!e)return on;if(!a(e)){if(t=hn(e))return t;e=[e]}return fn(e)}function yn(){return C(sn)}function bn(e){var t,n=e._a;return n&&-2===m(e).overflow&&(t=n[Ve]<0||n[Ve]>11?Ve:n[Be]<1||n[Be]>Je(n[Ue],n[Ve])?Be:n[$e]<0||n[$e]>24||24===n[$e]&&(0!==n[Xe]||0!==n[qe]||0!==n[Ge])?$e:n[Xe]<0||n[Xe]>59?Xe:n[qe]<0||n[qe]>59?qe:n[Ge]<0||n[Ge]>999?Ge:-1,m(e)._overflowDayOfYear&&(t<Ue||t>Be)&&(t=Be),m(e)._overflowWeeks&&-1===t&&(t=Ke),m(e)._overflowWeekday&&-1===t&&(t=Qe),m(e).overflow=t),e}var xn=/^\s*((?:[+-]\d{6}|\d{4})-(?:\d\d-\d\d|W\d\d-\d|W\d\d|\d\d\d|\d\d))(?:(T| )(\d\d(?::\d\d(?::\d\d(?:[.,]\d+)?)?)?)([+-]\d\d(?::?\d\d)?|\s*Z)?)?$/,wn=/^\s*((?:[+-]\d{6}|\d{4})(?:\d\d\d\d|W\d\d\d|W\d\d|\d\d\d|\d\d|))(?:(T| )(\d\d(?:\d\d(?:\d\d(?:[.,]\d+)?)?)?)([+-]\d\d(?::?\d\d)?|\s*Z)?)?$/,_n=/Z|[+-]\d\d(?::?\d\d)?/,kn=[["YYYYYY-MM-DD",/[+-]\d{6}-\d\d-\d\d/],["YYYY-MM-DD",/\d{4}-\d\d-\d\d/],["GGGG-[W]WW-E",/\d{4}-W\d\d-\d/],["GGGG-[W]WW",/\d{4}-W\d\d/,!1],["YYYY-DDD",/\d{4}-\d{3}/],["YYYY-MM",/\d{4}-\d\d/,!1],["YYYYYYMMDD",/[+-]\d{10}/],["YYYYMMDD",/\d{8}/],["GGGG[W]WWE",/\d{4}W\d{3}/],["GGGG[W]WW",/\d{4}W\d{2}/,!1],["YYYYDDD",/\d{7}/],["YYYYMM",/\d{6}/,!1],["YYYY",/\d{4}/,!1]],Sn=[["HH:mm:ss.SSSS",/\d\d:\d\d:\d\d\.\d+/],["HH:mm:ss,SSSS",/\d\d:\d\d:\d\d,\d+/],["HH:mm:ss",/\d\d:\d\d:\d\d/],["HH:mm",/\d\d:\d\d/],["HHmmss.SSSS",/\d\d\d\d\d\d\.\d+/],["HHmmss,SSSS",/\d\d\d\d\d\d,\d+/],["HHmmss",/\d\d\d\d\d\d/],["HHmm",/\d\d\d\d/],["HH",/\d\d/]],Mn=/^\/?Date\((-?\d+)/i,Cn=/^(?:(Mon|Tue|Wed|Thu|Fri|Sat|Sun),?\s)?(\d{1,2})\s(Jan|Feb|Mar|Apr|May|Jun|Jul|Aug|Sep|Oct|Nov|Dec)\s(\d{2,4})\s(\d\d):(\d\d)(?::(\d\d))?\s(?:(UT|GMT|[ECMP][SD]T)|([Zz])|([+-]\d{4}))$/,En={UT:0,GMT:0,EDT:-240,EST:-300,CDT:-300,CST:-360,MDT:-360,MST:-420,PDT:-420,PST:-480};function On(e){var t,n,r,i,a,o,l=e._i,s=xn.exec(l)||wn.exec(l);if(s){for(m(e).iso=!0,t=0,n=kn.length;t<n;t++)if(kn[t][1].exec(s[1])){i=kn[t][0],r=!1!==kn[t][2];break}if(null==i)return void(e._isValid=!1);if(s[3]){for(t=0,n=Sn.length;t<n;t++)if(Sn[t][1].exec(s[3])){a=(s[2]||" ")+Sn[t][0];break}if(null==a)return void(e._isValid=!1)}if(!r&&null!=a)return void(e._isValid=!1);if(s[4]){if(!_n.exec(s[4]))return void(e._isValid=!1);o="Z"}e._f=i+(a||"")+(o||""),Wn(e)}else e._isValid=!1}function Pn(e,t,n,r,i,a){var o=[Tn(e),tt.indexOf(t),parseInt(n,10),parseInt(r,10),parseInt(i,10)];return a&&o.push(parseInt(a,10)),o}function Tn(e){var t=parseInt(e,10);return t<=49?2e3+t:t<=999?1900+t:t}function Dn(e){return e.replace(/\([^)]*\)|[\n\t]/g," ").replace(/(\s\s+)/g," ").replace(/^\s\s*/,"").replace(/\s\s*$/,"")}function Nn(e,t,n){return!e||At.indexOf(e)===new Date(t[0],t[1],t[2]).getDay()||(m(n).weekdayMismatch=!0,n._isValid=!1,!1)}function Rn(e,t,n){if(e)return En[e];if(t)return 0;var r=parseInt(n,10),i=r%100;return(r-i)/100*60+i}function An(e){var t,n=Cn.exec(Dn(e._i));if(n){if(t=Pn(n[4],n[3],n[2],n[5],n[6],n[7]),!Nn(n[1],t,e))return;e._a=t,e._tzm=Rn(n[8],n[9],n[10]),e._d=bt.apply(null,e._a),e._d.setUTCMinutes(e._d.getUTCMinutes()-e._tzm),m(e).rfc2822=!0}else e._isValid=!1}function In(e){var t=Mn.exec(e._i);null===t?(On(e),!1===e._isValid&&(delete e._isValid,An(e),!1===e._isValid&&(delete e._isValid,e._strict?e._isValid=!1:r.createFromInputFallback(e)))):e._d=new Date(+t[1])}function Ln(e,t,n){return null!=e?e:null!=t?t:n}function jn(e){var t=new Date(r.now());return e._useUTC?[t.getUTCFullYear(),t.getUTCMonth(),t.getUTCDate()]:[t.getFullYear(),t.getMonth(),t.getDate()]}function Fn(e){var t,n,r,i,a,o=[];if(!e._d){for(r=jn(e),e._w&&null==e._a[Be]&&null==e._a[Ve]&&zn(e),null!=e._dayOfYear&&(a=Ln(e._a[Ue],r[Ue]),(e._dayOfYear>gt(a)||0===e._dayOfYear)&&(m(e)._overflowDayOfYear=!0),n=bt(a,0,e._dayOfYear),e._a[Ve]=n.getUTCMonth(),e._a[Be]=n.getUTCDate()),t=0;t<3&&null==e._a[t];++t)e._a[t]=o[t]=r[t];for(;t<7;t++)e._a[t]=o[t]=null==e._a[t]?2===t?1:0:e._a[t];24===e._a[$e]&&0===e._a[Xe]&&0===e._a[qe]&&0===e._a[Ge]&&(e._nextDay=!0,e._a[$e]=0),e._d=(e._useUTC?bt:yt).apply(null,o),i=e._useUTC?e._d.getUTCDay():e._d.getDay(),null!=e._tzm&&e._d.setUTCMinutes(e._d.getUTCMinutes()-e._tzm),e._nextDay&&(e._a[$e]=24),e._w&&"undefined"!==typeof e._w.d&&e._w.d!==i&&(m(e).weekdayMismatch=!0)}}function zn(e){var t,n,r,i,a,o,l,s,u;null!=(t=e._w).GG||null!=t.W||null!=t.E?(a=1,o=4,n=Ln(t.GG,e._a[Ue],_t(qn(),1,4).year),r=Ln(t.W,1),((i=Ln(t.E,1))<1||i>7)&&(s=!0)):(a=e._locale._week.dow,o=e._locale._week.doy,u=_t(qn(),a,o),n=Ln(t.gg,e._a[Ue],u.year),r=Ln(t.w,u.week),null!=t.d?((i=t.d)<0||i>6)&&(s=!0):null!=t.e?(i=t.e+a,(t.e<0||t.e>6)&&(s=!0)):i=a),r<1||r>kt(n,a,o)?m(e)._overflowWeeks=!0:null!=s?m(e)._overflowWeekday=!0:(l=wt(n,r,i,a,o),e._a[Ue]=l.year,e._dayOfYear=l.dayOfYear)}function Wn(e){if(e._f!==r.ISO_8601)if(e._f!==r.RFC_2822){e._a=[],m(e).empty=!0;var t,n,i,a,o,l,s=""+e._i,u=s.length,c=0;for(i=V(e._f,e._locale).match(L)||[],t=0;t<i.length;t++)a=i[t],(n=(s.match(Ie(a,e))||[])[0])&&((o=s.substr(0,s.indexOf(n))).length>0&&m(e).unusedInput.push(o),s=s.slice(s.indexOf(n)+n.length),c+=n.length),z[a]?(n?m(e).empty=!1:m(e).unusedTokens.push(a),Ye(a,n,e)):e._strict&&!n&&m(e).unusedTokens.push(a);m(e).charsLeftOver=u-c,s.length>0&&m(e).unusedInput.push(s),e._a[$e]<=12&&!0===m(e).bigHour&&e._a[$e]>0&&(m(e).bigHour=void 0),m(e).parsedDateParts=e._a.slice(0),m(e).meridiem=e._meridiem,e._a[$e]=Yn(e._locale,e._a[$e],e._meridiem),null!==(l=m(e).era)&&(e._a[Ue]=e._locale.erasConvertYear(l,e._a[Ue])),Fn(e),bn(e)}else An(e);else On(e)}function Yn(e,t,n){var r;return null==n?t:null!=e.meridiemHour?e.meridiemHour(t,n):null!=e.isPM?((r=e.isPM(n))&&t<12&&(t+=12),r||12!==t||(t=0),t):t}function Hn(e){var t,n,r,i,a,o,l=!1;if(0===e._f.length)return m(e).invalidFormat=!0,void(e._d=new Date(NaN));for(i=0;i<e._f.length;i++)a=0,o=!1,t=w({},e),null!=e._useUTC&&(t._useUTC=e._useUTC),t._f=e._f[i],Wn(t),v(t)&&(o=!0),a+=m(t).charsLeftOver,a+=10*m(t).unusedTokens.length,m(t).score=a,l?a<r&&(r=a,n=t):(null==r||a<r||o)&&(r=a,n=t,o&&(l=!0));h(e,n||t)}function Un(e){if(!e._d){var t=ie(e._i),n=void 0===t.day?t.date:t.day;e._a=f([t.year,t.month,n,t.hour,t.minute,t.second,t.millisecond],(function(e){return e&&parseInt(e,10)})),Fn(e)}}function Vn(e){var t=new _(bn(Bn(e)));return t._nextDay&&(t.add(1,"d"),t._nextDay=void 0),t}function Bn(e){var t=e._i,n=e._f;return e._locale=e._locale||vn(e._l),null===t||void 0===n&&""===t?y({nullInput:!0}):("string"===typeof t&&(e._i=t=e._locale.preparse(t)),k(t)?new _(bn(t)):(d(t)?e._d=t:a(n)?Hn(e):n?Wn(e):$n(e),v(e)||(e._d=null),e))}function $n(e){var t=e._i;u(t)?e._d=new Date(r.now()):d(t)?e._d=new Date(t.valueOf()):"string"===typeof t?In(e):a(t)?(e._a=f(t.slice(0),(function(e){return parseInt(e,10)})),Fn(e)):o(t)?Un(e):c(t)?e._d=new Date(t):r.createFromInputFallback(e)}function Xn(e,t,n,r,i){var l={};return!0!==t&&!1!==t||(r=t,t=void 0),!0!==n&&!1!==n||(r=n,n=void 0),(o(e)&&s(e)||a(e)&&0===e.length)&&(e=void 0),l._isAMomentObject=!0,l._useUTC=l._isUTC=i,l._l=n,l._i=e,l._f=t,l._strict=r,Vn(l)}function qn(e,t,n,r){return Xn(e,t,n,r,!1)}r.createFromInputFallback=M("value provided is not in a recognized RFC2822 or ISO format. moment construction falls back to js Date(), which is not reliable across all browsers and versions. Non RFC2822/ISO date formats are discouraged. Please refer to http://momentjs.com/guides/#/warnings/js-date/ for more info.",(function(e){e._d=new Date(e._i+(e._useUTC?" UTC":""))})),r.ISO_8601=function(){},r.RFC_2822=function(){};var Gn=M("moment().min is deprecated, use moment.max instead. http://momentjs.com/guides/#/warnings/min-max/",(function(){var e=qn.apply(null,arguments);return this.isValid()&&e.isValid()?e<this?this:e:y()})),Kn=M("moment().max is deprecated, use moment.min instead. http://momentjs.com/guides/#/warnings/min-max/",(function(){var e=qn.apply(null,arguments);return this.isValid()&&e.isValid()?e>this?this:e:y()}));function Qn(e,t){var n,r;if(1===t.length&&a(t[0])&&(t=t[0]),!t.length)return qn();for(n=t[0],r=1;r<t.length;++r)t[r].isValid()&&!t[r][e](n)||(n=t[r]);return n}function Zn(){return Qn("isBefore",[].slice.call(arguments,0))}function Jn(){return Qn("isAfter",[].slice.call(arguments,0))}var er=function(){return Date.now?Date.now():+new Date},tr=["year","quarter","month","week","day","hour","minute","second","millisecond"];function nr(e){var t,n,r=!1;for(t in e)if(l(e,t)&&(-1===He.call(tr,t)||null!=e[t]&&isNaN(e[t])))return!1;for(n=0;n<tr.length;++n)if(e[tr[n]]){if(r)return!1;parseFloat(e[tr[n]])!==ce(e[tr[n]])&&(r=!0)}return!0}function rr(){return this._isValid}function ir(){return Er(NaN)}function ar(e){var t=ie(e),n=t.year||0,r=t.quarter||0,i=t.month||0,a=t.week||t.isoWeek||0,o=t.day||0,l=t.hour||0,s=t.minute||0,u=t.second||0,c=t.millisecond||0;this._isValid=nr(t),this._milliseconds=+c+1e3*u+6e4*s+1e3*l*60*60,this._days=+o+7*a,this._months=+i+3*r+12*n,this._data={},this._locale=vn(),this._bubble()}function or(e){return e instanceof ar}function lr(e){return e<0?-1*Math.round(-1*e):Math.round(e)}function sr(e,t,n){var r,i=Math.min(e.length,t.length),a=Math.abs(e.length-t.length),o=0;for(r=0;r<i;r++)(n&&e[r]!==t[r]||!n&&ce(e[r])!==ce(t[r]))&&o++;return o+a}function ur(e,t){W(e,0,0,(function(){var e=this.utcOffset(),n="+";return e<0&&(e=-e,n="-"),n+I(~~(e/60),2)+t+I(~~e%60,2)}))}ur("Z",":"),ur("ZZ",""),Ae("Z",De),Ae("ZZ",De),ze(["Z","ZZ"],(function(e,t,n){n._useUTC=!0,n._tzm=dr(De,e)}));var cr=/([\+\-]|\d\d)/gi;function dr(e,t){var n,r,i=(t||"").match(e);return null===i?null:0===(r=60*(n=((i[i.length-1]||[])+"").match(cr)||["-",0,0])[1]+ce(n[2]))?0:"+"===n[0]?r:-r}function fr(e,t){var n,i;return t._isUTC?(n=t.clone(),i=(k(e)||d(e)?e.valueOf():qn(e).valueOf())-n.valueOf(),n._d.setTime(n._d.valueOf()+i),r.updateOffset(n,!1),n):qn(e).local()}function hr(e){return-Math.round(e._d.getTimezoneOffset())}function pr(e,t,n){var i,a=this._offset||0;if(!this.isValid())return null!=e?this:NaN;if(null!=e){if("string"===typeof e){if(null===(e=dr(De,e)))return this}else Math.abs(e)<16&&!n&&(e*=60);return!this._isUTC&&t&&(i=hr(this)),this._offset=e,this._isUTC=!0,null!=i&&this.add(i,"m"),a!==e&&(!t||this._changeInProgress?Nr(this,Er(e-a,"m"),1,!1):this._changeInProgress||(this._changeInProgress=!0,r.updateOffset(this,!0),this._changeInProgress=null)),this}return this._isUTC?a:hr(this)}function gr(e,t){return null!=e?("string"!==typeof e&&(e=-e),this.utcOffset(e,t),this):-this.utcOffset()}function mr(e){return this.utcOffset(0,e)}function vr(e){return this._isUTC&&(this.utcOffset(0,e),this._isUTC=!1,e&&this.subtract(hr(this),"m")),this}function yr(){if(null!=this._tzm)this.utcOffset(this._tzm,!1,!0);else if("string"===typeof this._i){var e=dr(Te,this._i);null!=e?this.utcOffset(e):this.utcOffset(0,!0)}return this}function br(e){return!!this.isValid()&&(e=e?qn(e).utcOffset():0,(this.utcOffset()-e)%60===0)}function xr(){return this.utcOffset()>this.clone().month(0).utcOffset()||this.utcOffset()>this.clone().month(5).utcOffset()}function wr(){if(!u(this._isDSTShifted))return this._isDSTShifted;var e,t={};return w(t,this),(t=Bn(t))._a?(e=t._isUTC?p(t._a):qn(t._a),this._isDSTShifted=this.isValid()&&sr(t._a,e.toArray())>0):this._isDSTShifted=!1,this._isDSTShifted}function _r(){return!!this.isValid()&&!this._isUTC}function kr(){return!!this.isValid()&&this._isUTC}function Sr(){return!!this.isValid()&&this._isUTC&&0===this._offset}r.updateOffset=function(){};var Mr=/^(-|\+)?(?:(\d*)[. ])?(\d+):(\d+)(?::(\d+)(\.\d*)?)?$/,Cr=/^(-|\+)?P(?:([-+]?[0-9,.]*)Y)?(?:([-+]?[0-9,.]*)M)?(?:([-+]?[0-9,.]*)W)?(?:([-+]?[0-9,.]*)D)?(?:T(?:([-+]?[0-9,.]*)H)?(?:([-+]?[0-9,.]*)M)?(?:([-+]?[0-9,.]*)S)?)?$/;function Er(e,t){var n,r,i,a=e,o=null;return or(e)?a={ms:e._milliseconds,d:e._days,M:e._months}:c(e)||!isNaN(+e)?(a={},t?a[t]=+e:a.milliseconds=+e):(o=Mr.exec(e))?(n="-"===o[1]?-1:1,a={y:0,d:ce(o[Be])*n,h:ce(o[$e])*n,m:ce(o[Xe])*n,s:ce(o[qe])*n,ms:ce(lr(1e3*o[Ge]))*n}):(o=Cr.exec(e))?(n="-"===o[1]?-1:1,a={y:Or(o[2],n),M:Or(o[3],n),w:Or(o[4],n),d:Or(o[5],n),h:Or(o[6],n),m:Or(o[7],n),s:Or(o[8],n)}):null==a?a={}:"object"===typeof a&&("from"in a||"to"in a)&&(i=Tr(qn(a.from),qn(a.to)),(a={}).ms=i.milliseconds,a.M=i.months),r=new ar(a),or(e)&&l(e,"_locale")&&(r._locale=e._locale),or(e)&&l(e,"_isValid")&&(r._isValid=e._isValid),r}function Or(e,t){var n=e&&parseFloat(e.replace(",","."));return(isNaN(n)?0:n)*t}function Pr(e,t){var n={};return n.months=t.month()-e.month()+12*(t.year()-e.year()),e.clone().add(n.months,"M").isAfter(t)&&--n.months,n.milliseconds=+t-+e.clone().add(n.months,"M"),n}function Tr(e,t){var n;return e.isValid()&&t.isValid()?(t=fr(t,e),e.isBefore(t)?n=Pr(e,t):((n=Pr(t,e)).milliseconds=-n.milliseconds,n.months=-n.months),n):{milliseconds:0,months:0}}function Dr(e,t){return function(n,r){var i;return null===r||isNaN(+r)||(O(t,"moment()."+t+"(period, number) is deprecated. Please use moment()."+t+"(number, period). See http://momentjs.com/guides/#/warnings/add-inverted-param/ for more info."),i=n,n=r,r=i),Nr(this,Er(n,r),e),this}}function Nr(e,t,n,i){var a=t._milliseconds,o=lr(t._days),l=lr(t._months);e.isValid()&&(i=null==i||i,l&&ut(e,fe(e,"Month")+l*n),o&&he(e,"Date",fe(e,"Date")+o*n),a&&e._d.setTime(e._d.valueOf()+a*n),i&&r.updateOffset(e,o||l))}Er.fn=ar.prototype,Er.invalid=ir;var Rr=Dr(1,"add"),Ar=Dr(-1,"subtract");function Ir(e){return"string"===typeof e||e instanceof String}function Lr(e){return k(e)||d(e)||Ir(e)||c(e)||Fr(e)||jr(e)||null===e||void 0===e}function jr(e){var t,n,r=o(e)&&!s(e),i=!1,a=["years","year","y","months","month","M","days","day","d","dates","date","D","hours","hour","h","minutes","minute","m","seconds","second","s","milliseconds","millisecond","ms"];for(t=0;t<a.length;t+=1)n=a[t],i=i||l(e,n);return r&&i}function Fr(e){var t=a(e),n=!1;return t&&(n=0===e.filter((function(t){return!c(t)&&Ir(e)})).length),t&&n}function zr(e){var t,n,r=o(e)&&!s(e),i=!1,a=["sameDay","nextDay","lastDay","nextWeek","lastWeek","sameElse"];for(t=0;t<a.length;t+=1)n=a[t],i=i||l(e,n);return r&&i}function Wr(e,t){var n=e.diff(t,"days",!0);return n<-6?"sameElse":n<-1?"lastWeek":n<0?"lastDay":n<1?"sameDay":n<2?"nextDay":n<7?"nextWeek":"sameElse"}function Yr(e,t){1===arguments.length&&(arguments[0]?Lr(arguments[0])?(e=arguments[0],t=void 0):zr(arguments[0])&&(t=arguments[0],e=void 0):(e=void 0,t=void 0));var n=e||qn(),i=fr(n,this).startOf("day"),a=r.calendarFormat(this,i)||"sameElse",o=t&&(P(t[a])?t[a].call(this,n):t[a]);return this.format(o||this.localeData().calendar(a,this,qn(n)))}function Hr(){return new _(this)}function Ur(e,t){var n=k(e)?e:qn(e);return!(!this.isValid()||!n.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()>n.valueOf():n.valueOf()<this.clone().startOf(t).valueOf())}function Vr(e,t){var n=k(e)?e:qn(e);return!(!this.isValid()||!n.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()<n.valueOf():this.clone().endOf(t).valueOf()<n.valueOf())}function Br(e,t,n,r){var i=k(e)?e:qn(e),a=k(t)?t:qn(t);return!!(this.isValid()&&i.isValid()&&a.isValid())&&("("===(r=r||"()")[0]?this.isAfter(i,n):!this.isBefore(i,n))&&(")"===r[1]?this.isBefore(a,n):!this.isAfter(a,n))}function $r(e,t){var n,r=k(e)?e:qn(e);return!(!this.isValid()||!r.isValid())&&("millisecond"===(t=re(t)||"millisecond")?this.valueOf()===r.valueOf():(n=r.valueOf(),this.clone().startOf(t).valueOf()<=n&&n<=this.clone().endOf(t).valueOf()))}function Xr(e,t){return this.isSame(e,t)||this.isAfter(e,t)}function qr(e,t){return this.isSame(e,t)||this.isBefore(e,t)}function Gr(e,t,n){var r,i,a;if(!this.isValid())return NaN;if(!(r=fr(e,this)).isValid())return NaN;switch(i=6e4*(r.utcOffset()-this.utcOffset()),t=re(t)){case"year":a=Kr(this,r)/12;break;case"month":a=Kr(this,r);break;case"quarter":a=Kr(this,r)/3;break;case"second":a=(this-r)/1e3;break;case"minute":a=(this-r)/6e4;break;case"hour":a=(this-r)/36e5;break;case"day":a=(this-r-i)/864e5;break;case"week":a=(this-r-i)/6048e5;break;default:a=this-r}return n?a:ue(a)}function Kr(e,t){if(e.date()<t.date())return-Kr(t,e);var n=12*(t.year()-e.year())+(t.month()-e.month()),r=e.clone().add(n,"months");return-(n+(t-r<0?(t-r)/(r-e.clone().add(n-1,"months")):(t-r)/(e.clone().add(n+1,"months")-r)))||0}function Qr(){return this.clone().locale("en").format("ddd MMM DD YYYY HH:mm:ss [GMT]ZZ")}function Zr(e){if(!this.isValid())return null;var t=!0!==e,n=t?this.clone().utc():this;return n.year()<0||n.year()>9999?U(n,t?"YYYYYY-MM-DD[T]HH:mm:ss.SSS[Z]":"YYYYYY-MM-DD[T]HH:mm:ss.SSSZ"):P(Date.prototype.toISOString)?t?this.toDate().toISOString():new Date(this.valueOf()+60*this.utcOffset()*1e3).toISOString().replace("Z",U(n,"Z")):U(n,t?"YYYY-MM-DD[T]HH:mm:ss.SSS[Z]":"YYYY-MM-DD[T]HH:mm:ss.SSSZ")}function Jr(){if(!this.isValid())return"moment.invalid(/* "+this._i+" */)";var e,t,n,r,i="moment",a="";return this.isLocal()||(i=0===this.utcOffset()?"moment.utc":"moment.parseZone",a="Z"),e="["+i+'("]',t=0<=this.year()&&this.year()<=9999?"YYYY":"YYYYYY",n="-MM-DD[T]HH:mm:ss.SSS",r=a+'[")]',this.format(e+t+n+r)}function ei(e){e||(e=this.isUtc()?r.defaultFormatUtc:r.defaultFormat);var t=U(this,e);return this.localeData().postformat(t)}function ti(e,t){return this.isValid()&&(k(e)&&e.isValid()||qn(e).isValid())?Er({to:this,from:e}).locale(this.locale()).humanize(!t):this.localeData().invalidDate()}function ni(e){return this.from(qn(),e)}function ri(e,t){return this.isValid()&&(k(e)&&e.isValid()||qn(e).isValid())?Er({from:this,to:e}).locale(this.locale()).humanize(!t):this.localeData().invalidDate()}function ii(e){return this.to(qn(),e)}function ai(e){var t;return void 0===e?this._locale._abbr:(null!=(t=vn(e))&&(this._locale=t),this)}r.defaultFormat="YYYY-MM-DDTHH:mm:ssZ",r.defaultFormatUtc="YYYY-MM-DDTHH:mm:ss[Z]";var oi=M("moment().lang() is deprecated. Instead, use moment().localeData() to get the language configuration. Use moment().locale() to change languages.",(function(e){return void 0===e?this.localeData():this.locale(e)}));function li(){return this._locale}var si=1e3,ui=60*si,ci=60*ui,di=3506328*ci;function fi(e,t){return(e%t+t)%t}function hi(e,t,n){return e<100&&e>=0?new Date(e+400,t,n)-di:new Date(e,t,n).valueOf()}function pi(e,t,n){return e<100&&e>=0?Date.UTC(e+400,t,n)-di:Date.UTC(e,t,n)}function gi(e){var t,n;if(void 0===(e=re(e))||"millisecond"===e||!this.isValid())return this;switch(n=this._isUTC?pi:hi,e){case"year":t=n(this.year(),0,1);break;case"quarter":t=n(this.year(),this.month()-this.month()%3,1);break;case"month":t=n(this.year(),this.month(),1);break;case"week":t=n(this.year(),this.month(),this.date()-this.weekday());break;case"isoWeek":t=n(this.year(),this.month(),this.date()-(this.isoWeekday()-1));break;case"day":case"date":t=n(this.year(),this.month(),this.date());break;case"hour":t=this._d.valueOf(),t-=fi(t+(this._isUTC?0:this.utcOffset()*ui),ci);break;case"minute":t=this._d.valueOf(),t-=fi(t,ui);break;case"second":t=this._d.valueOf(),t-=fi(t,si)}return this._d.setTime(t),r.updateOffset(this,!0),this}function mi(e){var t,n;if(void 0===(e=re(e))||"millisecond"===e||!this.isValid())return this;switch(n=this._isUTC?pi:hi,e){case"year":t=n(this.year()+1,0,1)-1;break;case"quarter":t=n(this.year(),this.month()-this.month()%3+3,1)-1;break;case"month":t=n(this.year(),this.month()+1,1)-1;break;case"week":t=n(this.year(),this.month(),this.date()-this.weekday()+7)-1;break;case"isoWeek":t=n(this.year(),this.month(),this.date()-(this.isoWeekday()-1)+7)-1;break;case"day":case"date":t=n(this.year(),this.month(),this.date()+1)-1;break;case"hour":t=this._d.valueOf(),t+=ci-fi(t+(this._isUTC?0:this.utcOffset()*ui),ci)-1;break;case"minute":t=this._d.valueOf(),t+=ui-fi(t,ui)-1;break;case"second":t=this._d.valueOf(),t+=si-fi(t,si)-1}return this._d.setTime(t),r.updateOffset(this,!0),this}function vi(){return this._d.valueOf()-6e4*(this._offset||0)}function yi(){return Math.floor(this.valueOf()/1e3)}function bi(){return new Date(this.valueOf())}function xi(){var e=this;return[e.year(),e.month(),e.date(),e.hour(),e.minute(),e.second(),e.millisecond()]}function wi(){var e=this;return{years:e.year(),months:e.month(),date:e.date(),hours:e.hours(),minutes:e.minutes(),seconds:e.seconds(),milliseconds:e.milliseconds()}}function _i(){return this.isValid()?this.toISOString():null}function ki(){return v(this)}function Si(){return h({},m(this))}function Mi(){return m(this).overflow}function Ci(){return{input:this._i,format:this._f,locale:this._locale,isUTC:this._isUTC,strict:this._strict}}function Ei(e,t){var n,i,a,o=this._eras||vn("en")._eras;for(n=0,i=o.length;n<i;++n){switch(typeof o[n].since){case"string":a=r(o[n].since).startOf("day"),o[n].since=a.valueOf()}switch(typeof o[n].until){case"undefined":o[n].until=1/0;break;case"string":a=r(o[n].until).startOf("day").valueOf(),o[n].until=a.valueOf()}}return o}function Oi(e,t,n){var r,i,a,o,l,s=this.eras();for(e=e.toUpperCase(),r=0,i=s.length;r<i;++r)if(a=s[r].name.toUpperCase(),o=s[r].abbr.toUpperCase(),l=s[r].narrow.toUpperCase(),n)switch(t){case"N":case"NN":case"NNN":if(o===e)return s[r];break;case"NNNN":if(a===e)return s[r];break;case"NNNNN":if(l===e)return s[r]}else if([a,o,l].indexOf(e)>=0)return s[r]}function Pi(e,t){var n=e.since<=e.until?1:-1;return void 0===t?r(e.since).year():r(e.since).year()+(t-e.offset)*n}function Ti(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].name;if(r[e].until<=n&&n<=r[e].since)return r[e].name}return""}function Di(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].narrow;if(r[e].until<=n&&n<=r[e].since)return r[e].narrow}return""}function Ni(){var e,t,n,r=this.localeData().eras();for(e=0,t=r.length;e<t;++e){if(n=this.clone().startOf("day").valueOf(),r[e].since<=n&&n<=r[e].until)return r[e].abbr;if(r[e].until<=n&&n<=r[e].since)return r[e].abbr}return""}function Ri(){var e,t,n,i,a=this.localeData().eras();for(e=0,t=a.length;e<t;++e)if(n=a[e].since<=a[e].until?1:-1,i=this.clone().startOf("day").valueOf(),a[e].since<=i&&i<=a[e].until||a[e].until<=i&&i<=a[e].since)return(this.year()-r(a[e].since).year())*n+a[e].offset;return this.year()}function Ai(e){return l(this,"_erasNameRegex")||Yi.call(this),e?this._erasNameRegex:this._erasRegex}function Ii(e){return l(this,"_erasAbbrRegex")||Yi.call(this),e?this._erasAbbrRegex:this._erasRegex}function Li(e){return l(this,"_erasNarrowRegex")||Yi.call(this),e?this._erasNarrowRegex:this._erasRegex}function ji(e,t){return t.erasAbbrRegex(e)}function Fi(e,t){return t.erasNameRegex(e)}function zi(e,t){return t.erasNarrowRegex(e)}function Wi(e,t){return t._eraYearOrdinalRegex||Oe}function Yi(){var e,t,n=[],r=[],i=[],a=[],o=this.eras();for(e=0,t=o.length;e<t;++e)r.push(je(o[e].name)),n.push(je(o[e].abbr)),i.push(je(o[e].narrow)),a.push(je(o[e].name)),a.push(je(o[e].abbr)),a.push(je(o[e].narrow));this._erasRegex=new RegExp("^("+a.join("|")+")","i"),this._erasNameRegex=new RegExp("^("+r.join("|")+")","i"),this._erasAbbrRegex=new RegExp("^("+n.join("|")+")","i"),this._erasNarrowRegex=new RegExp("^("+i.join("|")+")","i")}function Hi(e,t){W(0,[e,e.length],0,t)}function Ui(e){return Gi.call(this,e,this.week(),this.weekday(),this.localeData()._week.dow,this.localeData()._week.doy)}function Vi(e){return Gi.call(this,e,this.isoWeek(),this.isoWeekday(),1,4)}function Bi(){return kt(this.year(),1,4)}function $i(){return kt(this.isoWeekYear(),1,4)}function Xi(){var e=this.localeData()._week;return kt(this.year(),e.dow,e.doy)}function qi(){var e=this.localeData()._week;return kt(this.weekYear(),e.dow,e.doy)}function Gi(e,t,n,r,i){var a;return null==e?_t(this,r,i).year:(t>(a=kt(e,r,i))&&(t=a),Ki.call(this,e,t,n,r,i))}function Ki(e,t,n,r,i){var a=wt(e,t,n,r,i),o=bt(a.year,0,a.dayOfYear);return this.year(o.getUTCFullYear()),this.month(o.getUTCMonth()),this.date(o.getUTCDate()),this}function Qi(e){return null==e?Math.ceil((this.month()+1)/3):this.month(3*(e-1)+this.month()%3)}W("N",0,0,"eraAbbr"),W("NN",0,0,"eraAbbr"),W("NNN",0,0,"eraAbbr"),W("NNNN",0,0,"eraName"),W("NNNNN",0,0,"eraNarrow"),W("y",["y",1],"yo","eraYear"),W("y",["yy",2],0,"eraYear"),W("y",["yyy",3],0,"eraYear"),W("y",["yyyy",4],0,"eraYear"),Ae("N",ji),Ae("NN",ji),Ae("NNN",ji),Ae("NNNN",Fi),Ae("NNNNN",zi),ze(["N","NN","NNN","NNNN","NNNNN"],(function(e,t,n,r){var i=n._locale.erasParse(e,r,n._strict);i?m(n).era=i:m(n).invalidEra=e})),Ae("y",Oe),Ae("yy",Oe),Ae("yyy",Oe),Ae("yyyy",Oe),Ae("yo",Wi),ze(["y","yy","yyy","yyyy"],Ue),ze(["yo"],(function(e,t,n,r){var i;n._locale._eraYearOrdinalRegex&&(i=e.match(n._locale._eraYearOrdinalRegex)),n._locale.eraYearOrdinalParse?t[Ue]=n._locale.eraYearOrdinalParse(e,i):t[Ue]=parseInt(e,10)})),W(0,["gg",2],0,(function(){return this.weekYear()%100})),W(0,["GG",2],0,(function(){return this.isoWeekYear()%100})),Hi("gggg","weekYear"),Hi("ggggg","weekYear"),Hi("GGGG","isoWeekYear"),Hi("GGGGG","isoWeekYear"),ne("weekYear","gg"),ne("isoWeekYear","GG"),oe("weekYear",1),oe("isoWeekYear",1),Ae("G",Pe),Ae("g",Pe),Ae("GG",_e,ye),Ae("gg",_e,ye),Ae("GGGG",Ce,xe),Ae("gggg",Ce,xe),Ae("GGGGG",Ee,we),Ae("ggggg",Ee,we),We(["gggg","ggggg","GGGG","GGGGG"],(function(e,t,n,r){t[r.substr(0,2)]=ce(e)})),We(["gg","GG"],(function(e,t,n,i){t[i]=r.parseTwoDigitYear(e)})),W("Q",0,"Qo","quarter"),ne("quarter","Q"),oe("quarter",7),Ae("Q",ve),ze("Q",(function(e,t){t[Ve]=3*(ce(e)-1)})),W("D",["DD",2],"Do","date"),ne("date","D"),oe("date",9),Ae("D",_e),Ae("DD",_e,ye),Ae("Do",(function(e,t){return e?t._dayOfMonthOrdinalParse||t._ordinalParse:t._dayOfMonthOrdinalParseLenient})),ze(["D","DD"],Be),ze("Do",(function(e,t){t[Be]=ce(e.match(_e)[0])}));var Zi=de("Date",!0);function Ji(e){var t=Math.round((this.clone().startOf("day")-this.clone().startOf("year"))/864e5)+1;return null==e?t:this.add(e-t,"d")}W("DDD",["DDDD",3],"DDDo","dayOfYear"),ne("dayOfYear","DDD"),oe("dayOfYear",4),Ae("DDD",Me),Ae("DDDD",be),ze(["DDD","DDDD"],(function(e,t,n){n._dayOfYear=ce(e)})),W("m",["mm",2],0,"minute"),ne("minute","m"),oe("minute",14),Ae("m",_e),Ae("mm",_e,ye),ze(["m","mm"],Xe);var ea=de("Minutes",!1);W("s",["ss",2],0,"second"),ne("second","s"),oe("second",15),Ae("s",_e),Ae("ss",_e,ye),ze(["s","ss"],qe);var ta,na,ra=de("Seconds",!1);for(W("S",0,0,(function(){return~~(this.millisecond()/100)})),W(0,["SS",2],0,(function(){return~~(this.millisecond()/10)})),W(0,["SSS",3],0,"millisecond"),W(0,["SSSS",4],0,(function(){return 10*this.millisecond()})),W(0,["SSSSS",5],0,(function(){return 100*this.millisecond()})),W(0,["SSSSSS",6],0,(function(){return 1e3*this.millisecond()})),W(0,["SSSSSSS",7],0,(function(){return 1e4*this.millisecond()})),W(0,["SSSSSSSS",8],0,(function(){return 1e5*this.millisecond()})),W(0,["SSSSSSSSS",9],0,(function(){return 1e6*this.millisecond()})),ne("millisecond","ms"),oe("millisecond",16),Ae("S",Me,ve),Ae("SS",Me,ye),Ae("SSS",Me,be),ta="SSSS";ta.length<=9;ta+="S")Ae(ta,Oe);function ia(e,t){t[Ge]=ce(1e3*("0."+e))}for(ta="S";ta.length<=9;ta+="S")ze(ta,ia);function aa(){return this._isUTC?"UTC":""}function oa(){return this._isUTC?"Coordinated Universal Time":""}na=de("Milliseconds",!1),W("z",0,0,"zoneAbbr"),W("zz",0,0,"zoneName");var la=_.prototype;function sa(e){return qn(1e3*e)}function ua(){return qn.apply(null,arguments).parseZone()}function ca(e){return e}la.add=Rr,la.calendar=Yr,la.clone=Hr,la.diff=Gr,la.endOf=mi,la.format=ei,la.from=ti,la.fromNow=ni,la.to=ri,la.toNow=ii,la.get=pe,la.invalidAt=Mi,la.isAfter=Ur,la.isBefore=Vr,la.isBetween=Br,la.isSame=$r,la.isSameOrAfter=Xr,la.isSameOrBefore=qr,la.isValid=ki,la.lang=oi,la.locale=ai,la.localeData=li,la.max=Kn,la.min=Gn,la.parsingFlags=Si,la.set=ge,la.startOf=gi,la.subtract=Ar,la.toArray=xi,la.toObject=wi,la.toDate=bi,la.toISOString=Zr,la.inspect=Jr,"undefined"!==typeof Symbol&&null!=Symbol.for&&(la[Symbol.for("nodejs.util.inspect.custom")]=function(){return"Moment<"+this.format()+">"}),la.toJSON=_i,la.toString=Qr,la.unix=yi,la.valueOf=vi,la.creationData=Ci,la.eraName=Ti,la.eraNarrow=Di,la.eraAbbr=Ni,la.eraYear=Ri,la.year=mt,la.isLeapYear=vt,la.weekYear=Ui,la.isoWeekYear=Vi,la.quarter=la.quarters=Qi,la.month=ct,la.daysInMonth=dt,la.week=la.weeks=Ot,la.isoWeek=la.isoWeeks=Pt,la.weeksInYear=Xi,la.weeksInWeekYear=qi,la.isoWeeksInYear=Bi,la.isoWeeksInISOWeekYear=$i,la.date=Zi,la.day=la.days=Vt,la.weekday=Bt,la.isoWeekday=$t,la.dayOfYear=Ji,la.hour=la.hours=rn,la.minute=la.minutes=ea,la.second=la.seconds=ra,la.millisecond=la.milliseconds=na,la.utcOffset=pr,la.utc=mr,la.local=vr,la.parseZone=yr,la.hasAlignedHourOffset=br,la.isDST=xr,la.isLocal=_r,la.isUtcOffset=kr,la.isUtc=Sr,la.isUTC=Sr,la.zoneAbbr=aa,la.zoneName=oa,la.dates=M("dates accessor is deprecated. Use date instead.",Zi),la.months=M("months accessor is deprecated. Use month instead",ct),la.years=M("years accessor is deprecated. Use year instead",mt),la.zone=M("moment().zone is deprecated, use moment().utcOffset instead. http://momentjs.com/guides/#/warnings/zone/",gr),la.isDSTShifted=M("isDSTShifted is deprecated. See http://momentjs.com/guides/#/warnings/dst-shifted/ for more information",wr);var da=N.prototype;function fa(e,t,n,r){var i=vn(),a=p().set(r,t);return i[n](a,e)}function ha(e,t,n){if(c(e)&&(t=e,e=void 0),e=e||"",null!=t)return fa(e,t,n,"month");var r,i=[];for(r=0;r<12;r++)i[r]=fa(e,r,n,"month");return i}function pa(e,t,n,r){"boolean"===typeof e?(c(t)&&(n=t,t=void 0),t=t||""):(n=t=e,e=!1,c(t)&&(n=t,t=void 0),t=t||"");var i,a=vn(),o=e?a._week.dow:0,l=[];if(null!=n)return fa(t,(n+o)%7,r,"day");for(i=0;i<7;i++)l[i]=fa(t,(i+o)%7,r,"day");return l}function ga(e,t){return ha(e,t,"months")}function ma(e,t){return ha(e,t,"monthsShort")}function va(e,t,n){return pa(e,t,n,"weekdays")}function ya(e,t,n){return pa(e,t,n,"weekdaysShort")}function ba(e,t,n){return pa(e,t,n,"weekdaysMin")}da.calendar=A,da.longDateFormat=$,da.invalidDate=q,da.ordinal=Q,da.preparse=ca,da.postformat=ca,da.relativeTime=J,da.pastFuture=ee,da.set=T,da.eras=Ei,da.erasParse=Oi,da.erasConvertYear=Pi,da.erasAbbrRegex=Ii,da.erasNameRegex=Ai,da.erasNarrowRegex=Li,da.months=at,da.monthsShort=ot,da.monthsParse=st,da.monthsRegex=ht,da.monthsShortRegex=ft,da.week=St,da.firstDayOfYear=Et,da.firstDayOfWeek=Ct,da.weekdays=zt,da.weekdaysMin=Yt,da.weekdaysShort=Wt,da.weekdaysParse=Ut,da.weekdaysRegex=Xt,da.weekdaysShortRegex=qt,da.weekdaysMinRegex=Gt,da.isPM=tn,da.meridiem=an,pn("en",{eras:[{since:"0001-01-01",until:1/0,offset:1,name:"Anno Domini",narrow:"AD",abbr:"AD"},{since:"0000-12-31",until:-1/0,offset:1,name:"Before Christ",narrow:"BC",abbr:"BC"}],dayOfMonthOrdinalParse:/\d{1,2}(th|st|nd|rd)/,ordinal:function(e){var t=e%10;return e+(1===ce(e%100/10)?"th":1===t?"st":2===t?"nd":3===t?"rd":"th")}}),r.lang=M("moment.lang is deprecated. Use moment.locale instead.",pn),r.langData=M("moment.langData is deprecated. Use moment.localeData instead.",vn);var xa=Math.abs;function wa(){var e=this._data;return this._milliseconds=xa(this._milliseconds),this._days=xa(this._days),this._months=xa(this._months),e.milliseconds=xa(e.milliseconds),e.seconds=xa(e.seconds),e.minutes=xa(e.minutes),e.hours=xa(e.hours),e.months=xa(e.months),e.years=xa(e.years),this}function _a(e,t,n,r){var i=Er(t,n);return e._milliseconds+=r*i._milliseconds,e._days+=r*i._days,e._months+=r*i._months,e._bubble()}function ka(e,t){return _a(this,e,t,1)}function Sa(e,t){return _a(this,e,t,-1)}function Ma(e){return e<0?Math.floor(e):Math.ceil(e)}function Ca(){var e,t,n,r,i,a=this._milliseconds,o=this._days,l=this._months,s=this._data;return a>=0&&o>=0&&l>=0||a<=0&&o<=0&&l<=0||(a+=864e5*Ma(Oa(l)+o),o=0,l=0),s.milliseconds=a%1e3,e=ue(a/1e3),s.seconds=e%60,t=ue(e/60),s.minutes=t%60,n=ue(t/60),s.hours=n%24,o+=ue(n/24),l+=i=ue(Ea(o)),o-=Ma(Oa(i)),r=ue(l/12),l%=12,s.days=o,s.months=l,s.years=r,this}function Ea(e){return 4800*e/146097}function Oa(e){return 146097*e/4800}function Pa(e){if(!this.isValid())return NaN;var t,n,r=this._milliseconds;if("month"===(e=re(e))||"quarter"===e||"year"===e)switch(t=this._days+r/864e5,n=this._months+Ea(t),e){case"month":return n;case"quarter":return n/3;case"year":return n/12}else switch(t=this._days+Math.round(Oa(this._months)),e){case"week":return t/7+r/6048e5;case"day":return t+r/864e5;case"hour":return 24*t+r/36e5;case"minute":return 1440*t+r/6e4;case"second":return 86400*t+r/1e3;case"millisecond":return Math.floor(864e5*t)+r;default:throw new Error("Unknown unit "+e)}}function Ta(){return this.isValid()?this._milliseconds+864e5*this._days+this._months%12*2592e6+31536e6*ce(this._months/12):NaN}function Da(e){return function(){return this.as(e)}}var Na=Da("ms"),Ra=Da("s"),Aa=Da("m"),Ia=Da("h"),La=Da("d"),ja=Da("w"),Fa=Da("M"),za=Da("Q"),Wa=Da("y");function Ya(){return Er(this)}function Ha(e){return e=re(e),this.isValid()?this[e+"s"]():NaN}function Ua(e){return function(){return this.isValid()?this._data[e]:NaN}}var Va=Ua("milliseconds"),Ba=Ua("seconds"),$a=Ua("minutes"),Xa=Ua("hours"),qa=Ua("days"),Ga=Ua("months"),Ka=Ua("years");function Qa(){return ue(this.days()/7)}var Za=Math.round,Ja={ss:44,s:45,m:45,h:22,d:26,w:null,M:11};function eo(e,t,n,r,i){return i.relativeTime(t||1,!!n,e,r)}function to(e,t,n,r){var i=Er(e).abs(),a=Za(i.as("s")),o=Za(i.as("m")),l=Za(i.as("h")),s=Za(i.as("d")),u=Za(i.as("M")),c=Za(i.as("w")),d=Za(i.as("y")),f=a<=n.ss&&["s",a]||a<n.s&&["ss",a]||o<=1&&["m"]||o<n.m&&["mm",o]||l<=1&&["h"]||l<n.h&&["hh",l]||s<=1&&["d"]||s<n.d&&["dd",s];return null!=n.w&&(f=f||c<=1&&["w"]||c<n.w&&["ww",c]),(f=f||u<=1&&["M"]||u<n.M&&["MM",u]||d<=1&&["y"]||["yy",d])[2]=t,f[3]=+e>0,f[4]=r,eo.apply(null,f)}function no(e){return void 0===e?Za:"function"===typeof e&&(Za=e,!0)}function ro(e,t){return void 0!==Ja[e]&&(void 0===t?Ja[e]:(Ja[e]=t,"s"===e&&(Ja.ss=t-1),!0))}function io(e,t){if(!this.isValid())return this.localeData().invalidDate();var n,r,i=!1,a=Ja;return"object"===typeof e&&(t=e,e=!1),"boolean"===typeof e&&(i=e),"object"===typeof t&&(a=Object.assign({},Ja,t),null!=t.s&&null==t.ss&&(a.ss=t.s-1)),r=to(this,!i,a,n=this.localeData()),i&&(r=n.pastFuture(+this,r)),n.postformat(r)}var ao=Math.abs;function oo(e){return(e>0)-(e<0)||+e}function lo(){if(!this.isValid())return this.localeData().invalidDate();var e,t,n,r,i,a,o,l,s=ao(this._milliseconds)/1e3,u=ao(this._days),c=ao(this._months),d=this.asSeconds();return d?(e=ue(s/60),t=ue(e/60),s%=60,e%=60,n=ue(c/12),c%=12,r=s?s.toFixed(3).replace(/\.?0+$/,""):"",i=d<0?"-":"",a=oo(this._months)!==oo(d)?"-":"",o=oo(this._days)!==oo(d)?"-":"",l=oo(this._milliseconds)!==oo(d)?"-":"",i+"P"+(n?a+n+"Y":"")+(c?a+c+"M":"")+(u?o+u+"D":"")+(t||e||s?"T":"")+(t?l+t+"H":"")+(e?l+e+"M":"")+(s?l+r+"S":"")):"P0D"}var so=ar.prototype;return so.isValid=rr,so.abs=wa,so.add=ka,so.subtract=Sa,so.as=Pa,so.asMilliseconds=Na,so.asSeconds=Ra,so.asMinutes=Aa,so.asHours=Ia,so.asDays=La,so.asWeeks=ja,so.asMonths=Fa,so.asQuarters=za,so.asYears=Wa,so.valueOf=Ta,so._bubble=Ca,so.clone=Ya,so.get=Ha,so.milliseconds=Va,so.seconds=Ba,so.minutes=$a,so.hours=Xa,so.days=qa,so.weeks=Qa,so.months=Ga,so.years=Ka,so.humanize=io,so.toISOString=lo,so.toString=lo,so.toJSON=lo,so.locale=ai,so.localeData=li,so.toIsoString=M("toIsoString() is deprecated. Please use toISOString() instead (notice the capitals)",lo),so.lang=oi,W("X",0,0,"unix"),W("x",0,0,"valueOf"),Ae("x",Pe),Ae("X",Ne),ze("X",(function(e,t,n){n._d=new Date(1e3*parseFloat(e))})),ze("x",(function(e,t,n){n._d=new Date(ce(e))})),r.version="2.29.1",i(qn),r.fn=la,r.min=Zn,r.max=Jn,r.now=er,r.utc=p,r.unix=sa,r.months=ga,r.isDate=d,r.locale=pn,r.invalid=y,r.duration=Er,r.isMoment=k,r.weekdays=va,r.parseZone=ua,r.localeData=vn,r.isDuration=or,r.monthsShort=ma,r.weekdaysMin=ba,r.defineLocale=gn,r.updateLocale=mn,r.locales=yn,r.weekdaysShort=ya,r.normalizeUnits=re,r.relativeTimeRounding=no,r.relativeTimeThreshold=ro,r.calendarFormat=Wr,r.prototype=la,r.HTML5_FMT={DATETIME_LOCAL:"YYYY-MM-DDTHH:mm",DATETIME_LOCAL_SECONDS:"YYYY-MM-DDTHH:mm:ss",DATETIME_LOCAL_MS:"YYYY-MM-DDTHH:mm:ss.SSS",DATE:"YYYY-MM-DD",TIME:"HH:mm",TIME_SECONDS:"HH:mm:ss",TIME_MS:"HH:mm:ss.SSS",WEEK:"GGGG-[W]WW",MONTH:"YYYY-MM"},r}()}).call(this,n(37)(e))},function(e,t,n){var r=n(24),i=n(110),a=n(111),o=n(112),l=n(113),s=n(114);function u(e){var t=this.__data__=new r(e);this.size=t.size}u.prototype.clear=i,u.prototype.delete=a,u.prototype.get=o,u.prototype.has=l,u.prototype.set=s,e.exports=u},function(e,t){e.exports=function(e,t){return e===t||e!==e&&t!==t}},function(e,t,n){var r=n(21),i=n(40);e.exports=function(e){if(!i(e))return!1;var t=r(e);return"[object Function]"==t||"[object GeneratorFunction]"==t||"[object AsyncFunction]"==t||"[object Proxy]"==t}},function(e,t,n){(function(t){var n="object"==typeof t&&t&&t.Object===Object&&t;e.exports=n}).call(this,n(36))},function(e,t){var n=Function.prototype.toString;e.exports=function(e){if(null!=e){try{return n.call(e)}catch(t){}try{return e+""}catch(t){}}return""}},function(e,t,n){var r=n(133),i=n(136),a=n(137);e.exports=function(e,t,n,o,l,s){var u=1&n,c=e.length,d=t.length;if(c!=d&&!(u&&d>c))return!1;var f=s.get(e),h=s.get(t);if(f&&h)return f==t&&h==e;var p=-1,g=!0,m=2&n?new r:void 0;for(s.set(e,t),s.set(t,e);++p<c;){var v=e[p],y=t[p];if(o)var b=u?o(y,v,p,t,e,s):o(v,y,p,e,t,s);if(void 0!==b){if(b)continue;g=!1;break}if(m){if(!i(t,(function(e,t){if(!a(m,t)&&(v===e||l(v,e,n,o,s)))return m.push(t)}))){g=!1;break}}else if(v!==y&&!l(v,y,n,o,s)){g=!1;break}}return s.delete(e),s.delete(t),g}},function(e,t,n){var r=n(151),i=n(22),a=Object.prototype,o=a.hasOwnProperty,l=a.propertyIsEnumerable,s=r(function(){return arguments}())?r:function(e){return i(e)&&o.call(e,"callee")&&!l.call(e,"callee")};e.exports=s},function(e,t,n){(function(e){var r=n(13),i=n(152),a=t&&!t.nodeType&&t,o=a&&"object"==typeof e&&e&&!e.nodeType&&e,l=o&&o.exports===a?r.Buffer:void 0,s=(l?l.isBuffer:void 0)||i;e.exports=s}).call(this,n(37)(e))},function(e,t){var n=/^(?:0|[1-9]\d*)$/;e.exports=function(e,t){var r=typeof e;return!!(t=null==t?9007199254740991:t)&&("number"==r||"symbol"!=r&&n.test(e))&&e>-1&&e%1==0&&e<t}},function(e,t,n){var r=n(153),i=n(154),a=n(155),o=a&&a.isTypedArray,l=o?i(o):r;e.exports=l},function(e,t,n){var r=n(61),i=n(43);e.exports=function(e){return null!=e&&i(e.length)&&!r(e)}},function(e,t,n){var r=n(40);e.exports=function(e){return e===e&&!r(e)}},function(e,t){e.exports=function(e,t){return function(n){return null!=n&&(n[e]===t&&(void 0!==t||e in Object(n)))}}},function(e,t,n){var r=n(73),i=n(29);e.exports=function(e,t){for(var n=0,a=(t=r(t,e)).length;null!=e&&n<a;)e=e[i(t[n++])];return n&&n==a?e:void 0}},function(e,t,n){var r=n(14),i=n(44),a=n(182),o=n(185);e.exports=function(e,t){return r(e)?e:i(e,t)?[e]:a(o(e))}},function(e,t,n){"use strict";var r=n(56),i={childContextTypes:!0,contextType:!0,contextTypes:!0,defaultProps:!0,displayName:!0,getDefaultProps:!0,getDerivedStateFromError:!0,getDerivedStateFromProps:!0,mixins:!0,propTypes:!0,type:!0},a={name:!0,length:!0,prototype:!0,caller:!0,callee:!0,arguments:!0,arity:!0},o={$$typeof:!0,compare:!0,defaultProps:!0,displayName:!0,propTypes:!0,type:!0},l={};function s(e){return r.isMemo(e)?o:l[e.$$typeof]||i}l[r.ForwardRef]={$$typeof:!0,render:!0,defaultProps:!0,displayName:!0,propTypes:!0},l[r.Memo]=o;var u=Object.defineProperty,c=Object.getOwnPropertyNames,d=Object.getOwnPropertySymbols,f=Object.getOwnPropertyDescriptor,h=Object.getPrototypeOf,p=Object.prototype;e.exports=function e(t,n,r){if("string"!==typeof n){if(p){var i=h(n);i&&i!==p&&e(t,i,r)}var o=c(n);d&&(o=o.concat(d(n)));for(var l=s(t),g=s(n),m=0;m<o.length;++m){var v=o[m];if(!a[v]&&(!r||!r[v])&&(!g||!g[v])&&(!l||!l[v])){var y=f(n,v);try{u(t,v,y)}catch(b){}}}}return t}},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(3),p={active:c.a.bool,"aria-label":c.a.string,block:c.a.bool,color:c.a.string,disabled:c.a.bool,outline:c.a.bool,tag:h.i,innerRef:c.a.oneOfType([c.a.object,c.a.func,c.a.string]),onClick:c.a.func,size:c.a.string,children:c.a.node,className:c.a.string,cssModule:c.a.object,close:c.a.bool},g=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){if(!this.props.disabled)return this.props.onClick?this.props.onClick(e):void 0;e.preventDefault()},n.render=function(){var e=this.props,t=e.active,n=e["aria-label"],a=e.block,o=e.className,l=e.close,u=e.cssModule,c=e.color,d=e.outline,p=e.size,g=e.tag,m=e.innerRef,v=Object(i.a)(e,["active","aria-label","block","className","close","cssModule","color","outline","size","tag","innerRef"]);l&&"undefined"===typeof v.children&&(v.children=s.a.createElement("span",{"aria-hidden":!0},"\xd7"));var y="btn"+(d?"-outline":"")+"-"+c,b=Object(h.f)(f()(o,{close:l},l||"btn",l||y,!!p&&"btn-"+p,!!a&&"btn-block",{active:t,disabled:this.props.disabled}),u);v.href&&"button"===g&&(g="a");var x=l?"Close":null;return s.a.createElement(g,Object(r.a)({type:"button"===g&&v.onClick?"button":void 0},v,{className:b,ref:m,onClick:this.onClick,"aria-label":n||x}))},t}(s.a.Component);g.propTypes=p,g.defaultProps={color:"secondary",tag:"button"},t.a=g},function(e,t){function n(){return e.exports=n=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e},e.exports.default=e.exports,e.exports.__esModule=!0,n.apply(this,arguments)}e.exports=n,e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";function r(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}function i(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function a(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?i(Object(n),!0).forEach((function(t){r(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):i(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}n.d(t,"a",(function(){return a}))},,function(e,t,n){"use strict";var r=n(35),i=60103,a=60106;t.Fragment=60107,t.StrictMode=60108,t.Profiler=60114;var o=60109,l=60110,s=60112;t.Suspense=60113;var u=60115,c=60116;if("function"===typeof Symbol&&Symbol.for){var d=Symbol.for;i=d("react.element"),a=d("react.portal"),t.Fragment=d("react.fragment"),t.StrictMode=d("react.strict_mode"),t.Profiler=d("react.profiler"),o=d("react.provider"),l=d("react.context"),s=d("react.forward_ref"),t.Suspense=d("react.suspense"),u=d("react.memo"),c=d("react.lazy")}var f="function"===typeof Symbol&&Symbol.iterator;function h(e){for(var t="https://reactjs.org/docs/error-decoder.html?invariant="+e,n=1;n<arguments.length;n++)t+="&args[]="+encodeURIComponent(arguments[n]);return"Minified React error #"+e+"; visit "+t+" for the full message or use the non-minified dev environment for full errors and additional helpful warnings."}var p={isMounted:function(){return!1},enqueueForceUpdate:function(){},enqueueReplaceState:function(){},enqueueSetState:function(){}},g={};function m(e,t,n){this.props=e,this.context=t,this.refs=g,this.updater=n||p}function v(){}function y(e,t,n){this.props=e,this.context=t,this.refs=g,this.updater=n||p}m.prototype.isReactComponent={},m.prototype.setState=function(e,t){if("object"!==typeof e&&"function"!==typeof e&&null!=e)throw Error(h(85));this.updater.enqueueSetState(this,e,t,"setState")},m.prototype.forceUpdate=function(e){this.updater.enqueueForceUpdate(this,e,"forceUpdate")},v.prototype=m.prototype;var b=y.prototype=new v;b.constructor=y,r(b,m.prototype),b.isPureReactComponent=!0;var x={current:null},w=Object.prototype.hasOwnProperty,_={key:!0,ref:!0,__self:!0,__source:!0};function k(e,t,n){var r,a={},o=null,l=null;if(null!=t)for(r in void 0!==t.ref&&(l=t.ref),void 0!==t.key&&(o=""+t.key),t)w.call(t,r)&&!_.hasOwnProperty(r)&&(a[r]=t[r]);var s=arguments.length-2;if(1===s)a.children=n;else if(1<s){for(var u=Array(s),c=0;c<s;c++)u[c]=arguments[c+2];a.children=u}if(e&&e.defaultProps)for(r in s=e.defaultProps)void 0===a[r]&&(a[r]=s[r]);return{$$typeof:i,type:e,key:o,ref:l,props:a,_owner:x.current}}function S(e){return"object"===typeof e&&null!==e&&e.$$typeof===i}var M=/\/+/g;function C(e,t){return"object"===typeof e&&null!==e&&null!=e.key?function(e){var t={"=":"=0",":":"=2"};return"$"+e.replace(/[=:]/g,(function(e){return t[e]}))}(""+e.key):t.toString(36)}function E(e,t,n,r,o){var l=typeof e;"undefined"!==l&&"boolean"!==l||(e=null);var s=!1;if(null===e)s=!0;else switch(l){case"string":case"number":s=!0;break;case"object":switch(e.$$typeof){case i:case a:s=!0}}if(s)return o=o(s=e),e=""===r?"."+C(s,0):r,Array.isArray(o)?(n="",null!=e&&(n=e.replace(M,"$&/")+"/"),E(o,t,n,"",(function(e){return e}))):null!=o&&(S(o)&&(o=function(e,t){return{$$typeof:i,type:e.type,key:t,ref:e.ref,props:e.props,_owner:e._owner}}(o,n+(!o.key||s&&s.key===o.key?"":(""+o.key).replace(M,"$&/")+"/")+e)),t.push(o)),1;if(s=0,r=""===r?".":r+":",Array.isArray(e))for(var u=0;u<e.length;u++){var c=r+C(l=e[u],u);s+=E(l,t,n,c,o)}else if("function"===typeof(c=function(e){return null===e||"object"!==typeof e?null:"function"===typeof(e=f&&e[f]||e["@@iterator"])?e:null}(e)))for(e=c.call(e),u=0;!(l=e.next()).done;)s+=E(l=l.value,t,n,c=r+C(l,u++),o);else if("object"===l)throw t=""+e,Error(h(31,"[object Object]"===t?"object with keys {"+Object.keys(e).join(", ")+"}":t));return s}function O(e,t,n){if(null==e)return e;var r=[],i=0;return E(e,r,"","",(function(e){return t.call(n,e,i++)})),r}function P(e){if(-1===e._status){var t=e._result;t=t(),e._status=0,e._result=t,t.then((function(t){0===e._status&&(t=t.default,e._status=1,e._result=t)}),(function(t){0===e._status&&(e._status=2,e._result=t)}))}if(1===e._status)return e._result;throw e._result}var T={current:null};function D(){var e=T.current;if(null===e)throw Error(h(321));return e}var N={ReactCurrentDispatcher:T,ReactCurrentBatchConfig:{transition:0},ReactCurrentOwner:x,IsSomeRendererActing:{current:!1},assign:r};t.Children={map:O,forEach:function(e,t,n){O(e,(function(){t.apply(this,arguments)}),n)},count:function(e){var t=0;return O(e,(function(){t++})),t},toArray:function(e){return O(e,(function(e){return e}))||[]},only:function(e){if(!S(e))throw Error(h(143));return e}},t.Component=m,t.PureComponent=y,t.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=N,t.cloneElement=function(e,t,n){if(null===e||void 0===e)throw Error(h(267,e));var a=r({},e.props),o=e.key,l=e.ref,s=e._owner;if(null!=t){if(void 0!==t.ref&&(l=t.ref,s=x.current),void 0!==t.key&&(o=""+t.key),e.type&&e.type.defaultProps)var u=e.type.defaultProps;for(c in t)w.call(t,c)&&!_.hasOwnProperty(c)&&(a[c]=void 0===t[c]&&void 0!==u?u[c]:t[c])}var c=arguments.length-2;if(1===c)a.children=n;else if(1<c){u=Array(c);for(var d=0;d<c;d++)u[d]=arguments[d+2];a.children=u}return{$$typeof:i,type:e.type,key:o,ref:l,props:a,_owner:s}},t.createContext=function(e,t){return void 0===t&&(t=null),(e={$$typeof:l,_calculateChangedBits:t,_currentValue:e,_currentValue2:e,_threadCount:0,Provider:null,Consumer:null}).Provider={$$typeof:o,_context:e},e.Consumer=e},t.createElement=k,t.createFactory=function(e){var t=k.bind(null,e);return t.type=e,t},t.createRef=function(){return{current:null}},t.forwardRef=function(e){return{$$typeof:s,render:e}},t.isValidElement=S,t.lazy=function(e){return{$$typeof:c,_payload:{_status:-1,_result:e},_init:P}},t.memo=function(e,t){return{$$typeof:u,type:e,compare:void 0===t?null:t}},t.useCallback=function(e,t){return D().useCallback(e,t)},t.useContext=function(e,t){return D().useContext(e,t)},t.useDebugValue=function(){},t.useEffect=function(e,t){return D().useEffect(e,t)},t.useImperativeHandle=function(e,t,n){return D().useImperativeHandle(e,t,n)},t.useLayoutEffect=function(e,t){return D().useLayoutEffect(e,t)},t.useMemo=function(e,t){return D().useMemo(e,t)},t.useReducer=function(e,t,n){return D().useReducer(e,t,n)},t.useRef=function(e){return D().useRef(e)},t.useState=function(e){return D().useState(e)},t.version="17.0.1"},function(e,t,n){"use strict";var r=n(2),i=n(35),a=n(81);function o(e){for(var t="https://reactjs.org/docs/error-decoder.html?invariant="+e,n=1;n<arguments.length;n++)t+="&args[]="+encodeURIComponent(arguments[n]);return"Minified React error #"+e+"; visit "+t+" for the full message or use the non-minified dev environment for full errors and additional helpful warnings."}if(!r)throw Error(o(227));var l=new Set,s={};function u(e,t){c(e,t),c(e+"Capture",t)}function c(e,t){for(s[e]=t,e=0;e<t.length;e++)l.add(t[e])}var d=!("undefined"===typeof window||"undefined"===typeof window.document||"undefined"===typeof window.document.createElement),f=/^[:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD][:A-Z_a-z\u00C0-\u00D6\u00D8-\u00F6\u00F8-\u02FF\u0370-\u037D\u037F-\u1FFF\u200C-\u200D\u2070-\u218F\u2C00-\u2FEF\u3001-\uD7FF\uF900-\uFDCF\uFDF0-\uFFFD\-.0-9\u00B7\u0300-\u036F\u203F-\u2040]*$/,h=Object.prototype.hasOwnProperty,p={},g={};function m(e,t,n,r,i,a,o){this.acceptsBooleans=2===t||3===t||4===t,this.attributeName=r,this.attributeNamespace=i,this.mustUseProperty=n,this.propertyName=e,this.type=t,this.sanitizeURL=a,this.removeEmptyString=o}var v={};"children dangerouslySetInnerHTML defaultValue defaultChecked innerHTML suppressContentEditableWarning suppressHydrationWarning style".split(" ").forEach((function(e){v[e]=new m(e,0,!1,e,null,!1,!1)})),[["acceptCharset","accept-charset"],["className","class"],["htmlFor","for"],["httpEquiv","http-equiv"]].forEach((function(e){var t=e[0];v[t]=new m(t,1,!1,e[1],null,!1,!1)})),["contentEditable","draggable","spellCheck","value"].forEach((function(e){v[e]=new m(e,2,!1,e.toLowerCase(),null,!1,!1)})),["autoReverse","externalResourcesRequired","focusable","preserveAlpha"].forEach((function(e){v[e]=new m(e,2,!1,e,null,!1,!1)})),"allowFullScreen async autoFocus autoPlay controls default defer disabled disablePictureInPicture disableRemotePlayback formNoValidate hidden loop noModule noValidate open playsInline readOnly required reversed scoped seamless itemScope".split(" ").forEach((function(e){v[e]=new m(e,3,!1,e.toLowerCase(),null,!1,!1)})),["checked","multiple","muted","selected"].forEach((function(e){v[e]=new m(e,3,!0,e,null,!1,!1)})),["capture","download"].forEach((function(e){v[e]=new m(e,4,!1,e,null,!1,!1)})),["cols","rows","size","span"].forEach((function(e){v[e]=new m(e,6,!1,e,null,!1,!1)})),["rowSpan","start"].forEach((function(e){v[e]=new m(e,5,!1,e.toLowerCase(),null,!1,!1)}));var y=/[\-:]([a-z])/g;function x(e){return e[1].toUpperCase()}function w(e,t,n,r){var i=v.hasOwnProperty(t)?v[t]:null;(null!==i?0===i.type:!r&&(2<t.length&&("o"===t[0]||"O"===t[0])&&("n"===t[1]||"N"===t[1])))||(function(e,t,n,r){if(null===t||"undefined"===typeof t||function(e,t,n,r){if(null!==n&&0===n.type)return!1;switch(typeof t){case"function":case"symbol":return!0;case"boolean":return!r&&(null!==n?!n.acceptsBooleans:"data-"!==(e=e.toLowerCase().slice(0,5))&&"aria-"!==e);default:return!1}}(e,t,n,r))return!0;if(r)return!1;if(null!==n)switch(n.type){case 3:return!t;case 4:return!1===t;case 5:return isNaN(t);case 6:return isNaN(t)||1>t}return!1}(t,n,i,r)&&(n=null),r||null===i?function(e){return!!h.call(g,e)||!h.call(p,e)&&(f.test(e)?g[e]=!0:(p[e]=!0,!1))}(t)&&(null===n?e.removeAttribute(t):e.setAttribute(t,""+n)):i.mustUseProperty?e[i.propertyName]=null===n?3!==i.type&&"":n:(t=i.attributeName,r=i.attributeNamespace,null===n?e.removeAttribute(t):(n=3===(i=i.type)||4===i&&!0===n?"":""+n,r?e.setAttributeNS(r,t,n):e.setAttribute(t,n))))}"accent-height alignment-baseline arabic-form baseline-shift cap-height clip-path clip-rule color-interpolation color-interpolation-filters color-profile color-rendering dominant-baseline enable-background fill-opacity fill-rule flood-color flood-opacity font-family font-size font-size-adjust font-stretch font-style font-variant font-weight glyph-name glyph-orientation-horizontal glyph-orientation-vertical horiz-adv-x horiz-origin-x image-rendering letter-spacing lighting-color marker-end marker-mid marker-start overline-position overline-thickness paint-order panose-1 pointer-events rendering-intent shape-rendering stop-color stop-opacity strikethrough-position strikethrough-thickness stroke-dasharray stroke-dashoffset stroke-linecap stroke-linejoin stroke-miterlimit stroke-opacity stroke-width text-anchor text-decoration text-rendering underline-position underline-thickness unicode-bidi unicode-range units-per-em v-alphabetic v-hanging v-ideographic v-mathematical vector-effect vert-adv-y vert-origin-x vert-origin-y word-spacing writing-mode xmlns:xlink x-height".split(" ").forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,null,!1,!1)})),"xlink:actuate xlink:arcrole xlink:role xlink:show xlink:title xlink:type".split(" ").forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,"http://www.w3.org/1999/xlink",!1,!1)})),["xml:base","xml:lang","xml:space"].forEach((function(e){var t=e.replace(y,x);v[t]=new m(t,1,!1,e,"http://www.w3.org/XML/1998/namespace",!1,!1)})),["tabIndex","crossOrigin"].forEach((function(e){v[e]=new m(e,1,!1,e.toLowerCase(),null,!1,!1)})),v.xlinkHref=new m("xlinkHref",1,!1,"xlink:href","http://www.w3.org/1999/xlink",!0,!1),["src","href","action","formAction"].forEach((function(e){v[e]=new m(e,1,!1,e.toLowerCase(),null,!0,!0)}));var _=r.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED,k=60103,S=60106,M=60107,C=60108,E=60114,O=60109,P=60110,T=60112,D=60113,N=60120,R=60115,A=60116,I=60121,L=60128,j=60129,F=60130,z=60131;if("function"===typeof Symbol&&Symbol.for){var W=Symbol.for;k=W("react.element"),S=W("react.portal"),M=W("react.fragment"),C=W("react.strict_mode"),E=W("react.profiler"),O=W("react.provider"),P=W("react.context"),T=W("react.forward_ref"),D=W("react.suspense"),N=W("react.suspense_list"),R=W("react.memo"),A=W("react.lazy"),I=W("react.block"),W("react.scope"),L=W("react.opaque.id"),j=W("react.debug_trace_mode"),F=W("react.offscreen"),z=W("react.legacy_hidden")}var Y,H="function"===typeof Symbol&&Symbol.iterator;function U(e){return null===e||"object"!==typeof e?null:"function"===typeof(e=H&&e[H]||e["@@iterator"])?e:null}function V(e){if(void 0===Y)try{throw Error()}catch(n){var t=n.stack.trim().match(/\n( *(at )?)/);Y=t&&t[1]||""}return"\n"+Y+e}var B=!1;function $(e,t){if(!e||B)return"";B=!0;var n=Error.prepareStackTrace;Error.prepareStackTrace=void 0;try{if(t)if(t=function(){throw Error()},Object.defineProperty(t.prototype,"props",{set:function(){throw Error()}}),"object"===typeof Reflect&&Reflect.construct){try{Reflect.construct(t,[])}catch(s){var r=s}Reflect.construct(e,[],t)}else{try{t.call()}catch(s){r=s}e.call(t.prototype)}else{try{throw Error()}catch(s){r=s}e()}}catch(s){if(s&&r&&"string"===typeof s.stack){for(var i=s.stack.split("\n"),a=r.stack.split("\n"),o=i.length-1,l=a.length-1;1<=o&&0<=l&&i[o]!==a[l];)l--;for(;1<=o&&0<=l;o--,l--)if(i[o]!==a[l]){if(1!==o||1!==l)do{if(o--,0>--l||i[o]!==a[l])return"\n"+i[o].replace(" at new "," at ")}while(1<=o&&0<=l);break}}}finally{B=!1,Error.prepareStackTrace=n}return(e=e?e.displayName||e.name:"")?V(e):""}function X(e){switch(e.tag){case 5:return V(e.type);case 16:return V("Lazy");case 13:return V("Suspense");case 19:return V("SuspenseList");case 0:case 2:case 15:return e=$(e.type,!1);case 11:return e=$(e.type.render,!1);case 22:return e=$(e.type._render,!1);case 1:return e=$(e.type,!0);default:return""}}function q(e){if(null==e)return null;if("function"===typeof e)return e.displayName||e.name||null;if("string"===typeof e)return e;switch(e){case M:return"Fragment";case S:return"Portal";case E:return"Profiler";case C:return"StrictMode";case D:return"Suspense";case N:return"SuspenseList"}if("object"===typeof e)switch(e.$$typeof){case P:return(e.displayName||"Context")+".Consumer";case O:return(e._context.displayName||"Context")+".Provider";case T:var t=e.render;return t=t.displayName||t.name||"",e.displayName||(""!==t?"ForwardRef("+t+")":"ForwardRef");case R:return q(e.type);case I:return q(e._render);case A:t=e._payload,e=e._init;try{return q(e(t))}catch(n){}}return null}function G(e){switch(typeof e){case"boolean":case"number":case"object":case"string":case"undefined":return e;default:return""}}function K(e){var t=e.type;return(e=e.nodeName)&&"input"===e.toLowerCase()&&("checkbox"===t||"radio"===t)}function Q(e){e._valueTracker||(e._valueTracker=function(e){var t=K(e)?"checked":"value",n=Object.getOwnPropertyDescriptor(e.constructor.prototype,t),r=""+e[t];if(!e.hasOwnProperty(t)&&"undefined"!==typeof n&&"function"===typeof n.get&&"function"===typeof n.set){var i=n.get,a=n.set;return Object.defineProperty(e,t,{configurable:!0,get:function(){return i.call(this)},set:function(e){r=""+e,a.call(this,e)}}),Object.defineProperty(e,t,{enumerable:n.enumerable}),{getValue:function(){return r},setValue:function(e){r=""+e},stopTracking:function(){e._valueTracker=null,delete e[t]}}}}(e))}function Z(e){if(!e)return!1;var t=e._valueTracker;if(!t)return!0;var n=t.getValue(),r="";return e&&(r=K(e)?e.checked?"true":"false":e.value),(e=r)!==n&&(t.setValue(e),!0)}function J(e){if("undefined"===typeof(e=e||("undefined"!==typeof document?document:void 0)))return null;try{return e.activeElement||e.body}catch(b){return e.body}}function ee(e,t){var n=t.checked;return i({},t,{defaultChecked:void 0,defaultValue:void 0,value:void 0,checked:null!=n?n:e._wrapperState.initialChecked})}function te(e,t){var n=null==t.defaultValue?"":t.defaultValue,r=null!=t.checked?t.checked:t.defaultChecked;n=G(null!=t.value?t.value:n),e._wrapperState={initialChecked:r,initialValue:n,controlled:"checkbox"===t.type||"radio"===t.type?null!=t.checked:null!=t.value}}function ne(e,t){null!=(t=t.checked)&&w(e,"checked",t,!1)}function re(e,t){ne(e,t);var n=G(t.value),r=t.type;if(null!=n)"number"===r?(0===n&&""===e.value||e.value!=n)&&(e.value=""+n):e.value!==""+n&&(e.value=""+n);else if("submit"===r||"reset"===r)return void e.removeAttribute("value");t.hasOwnProperty("value")?ae(e,t.type,n):t.hasOwnProperty("defaultValue")&&ae(e,t.type,G(t.defaultValue)),null==t.checked&&null!=t.defaultChecked&&(e.defaultChecked=!!t.defaultChecked)}function ie(e,t,n){if(t.hasOwnProperty("value")||t.hasOwnProperty("defaultValue")){var r=t.type;if(!("submit"!==r&&"reset"!==r||void 0!==t.value&&null!==t.value))return;t=""+e._wrapperState.initialValue,n||t===e.value||(e.value=t),e.defaultValue=t}""!==(n=e.name)&&(e.name=""),e.defaultChecked=!!e._wrapperState.initialChecked,""!==n&&(e.name=n)}function ae(e,t,n){"number"===t&&J(e.ownerDocument)===e||(null==n?e.defaultValue=""+e._wrapperState.initialValue:e.defaultValue!==""+n&&(e.defaultValue=""+n))}function oe(e,t){return e=i({children:void 0},t),(t=function(e){var t="";return r.Children.forEach(e,(function(e){null!=e&&(t+=e)})),t}(t.children))&&(e.children=t),e}function le(e,t,n,r){if(e=e.options,t){t={};for(var i=0;i<n.length;i++)t["$"+n[i]]=!0;for(n=0;n<e.length;n++)i=t.hasOwnProperty("$"+e[n].value),e[n].selected!==i&&(e[n].selected=i),i&&r&&(e[n].defaultSelected=!0)}else{for(n=""+G(n),t=null,i=0;i<e.length;i++){if(e[i].value===n)return e[i].selected=!0,void(r&&(e[i].defaultSelected=!0));null!==t||e[i].disabled||(t=e[i])}null!==t&&(t.selected=!0)}}function se(e,t){if(null!=t.dangerouslySetInnerHTML)throw Error(o(91));return i({},t,{value:void 0,defaultValue:void 0,children:""+e._wrapperState.initialValue})}function ue(e,t){var n=t.value;if(null==n){if(n=t.children,t=t.defaultValue,null!=n){if(null!=t)throw Error(o(92));if(Array.isArray(n)){if(!(1>=n.length))throw Error(o(93));n=n[0]}t=n}null==t&&(t=""),n=t}e._wrapperState={initialValue:G(n)}}function ce(e,t){var n=G(t.value),r=G(t.defaultValue);null!=n&&((n=""+n)!==e.value&&(e.value=n),null==t.defaultValue&&e.defaultValue!==n&&(e.defaultValue=n)),null!=r&&(e.defaultValue=""+r)}function de(e){var t=e.textContent;t===e._wrapperState.initialValue&&""!==t&&null!==t&&(e.value=t)}var fe="http://www.w3.org/1999/xhtml",he="http://www.w3.org/2000/svg";function pe(e){switch(e){case"svg":return"http://www.w3.org/2000/svg";case"math":return"http://www.w3.org/1998/Math/MathML";default:return"http://www.w3.org/1999/xhtml"}}function ge(e,t){return null==e||"http://www.w3.org/1999/xhtml"===e?pe(t):"http://www.w3.org/2000/svg"===e&&"foreignObject"===t?"http://www.w3.org/1999/xhtml":e}var me,ve,ye=(ve=function(e,t){if(e.namespaceURI!==he||"innerHTML"in e)e.innerHTML=t;else{for((me=me||document.createElement("div")).innerHTML="<svg>"+t.valueOf().toString()+"</svg>",t=me.firstChild;e.firstChild;)e.removeChild(e.firstChild);for(;t.firstChild;)e.appendChild(t.firstChild)}},"undefined"!==typeof MSApp&&MSApp.execUnsafeLocalFunction?function(e,t,n,r){MSApp.execUnsafeLocalFunction((function(){return ve(e,t)}))}:ve);function be(e,t){if(t){var n=e.firstChild;if(n&&n===e.lastChild&&3===n.nodeType)return void(n.nodeValue=t)}e.textContent=t}var xe={animationIterationCount:!0,borderImageOutset:!0,borderImageSlice:!0,borderImageWidth:!0,boxFlex:!0,boxFlexGroup:!0,boxOrdinalGroup:!0,columnCount:!0,columns:!0,flex:!0,flexGrow:!0,flexPositive:!0,flexShrink:!0,flexNegative:!0,flexOrder:!0,gridArea:!0,gridRow:!0,gridRowEnd:!0,gridRowSpan:!0,gridRowStart:!0,gridColumn:!0,gridColumnEnd:!0,gridColumnSpan:!0,gridColumnStart:!0,fontWeight:!0,lineClamp:!0,lineHeight:!0,opacity:!0,order:!0,orphans:!0,tabSize:!0,widows:!0,zIndex:!0,zoom:!0,fillOpacity:!0,floodOpacity:!0,stopOpacity:!0,strokeDasharray:!0,strokeDashoffset:!0,strokeMiterlimit:!0,strokeOpacity:!0,strokeWidth:!0},we=["Webkit","ms","Moz","O"];function _e(e,t,n){return null==t||"boolean"===typeof t||""===t?"":n||"number"!==typeof t||0===t||xe.hasOwnProperty(e)&&xe[e]?(""+t).trim():t+"px"}function ke(e,t){for(var n in e=e.style,t)if(t.hasOwnProperty(n)){var r=0===n.indexOf("--"),i=_e(n,t[n],r);"float"===n&&(n="cssFloat"),r?e.setProperty(n,i):e[n]=i}}Object.keys(xe).forEach((function(e){we.forEach((function(t){t=t+e.charAt(0).toUpperCase()+e.substring(1),xe[t]=xe[e]}))}));var Se=i({menuitem:!0},{area:!0,base:!0,br:!0,col:!0,embed:!0,hr:!0,img:!0,input:!0,keygen:!0,link:!0,meta:!0,param:!0,source:!0,track:!0,wbr:!0});function Me(e,t){if(t){if(Se[e]&&(null!=t.children||null!=t.dangerouslySetInnerHTML))throw Error(o(137,e));if(null!=t.dangerouslySetInnerHTML){if(null!=t.children)throw Error(o(60));if("object"!==typeof t.dangerouslySetInnerHTML||!("__html"in t.dangerouslySetInnerHTML))throw Error(o(61))}if(null!=t.style&&"object"!==typeof t.style)throw Error(o(62))}}function Ce(e,t){if(-1===e.indexOf("-"))return"string"===typeof t.is;switch(e){case"annotation-xml":case"color-profile":case"font-face":case"font-face-src":case"font-face-uri":case"font-face-format":case"font-face-name":case"missing-glyph":return!1;default:return!0}}function Ee(e){return(e=e.target||e.srcElement||window).correspondingUseElement&&(e=e.correspondingUseElement),3===e.nodeType?e.parentNode:e}var Oe=null,Pe=null,Te=null;function De(e){if(e=ti(e)){if("function"!==typeof Oe)throw Error(o(280));var t=e.stateNode;t&&(t=ri(t),Oe(e.stateNode,e.type,t))}}function Ne(e){Pe?Te?Te.push(e):Te=[e]:Pe=e}function Re(){if(Pe){var e=Pe,t=Te;if(Te=Pe=null,De(e),t)for(e=0;e<t.length;e++)De(t[e])}}function Ae(e,t){return e(t)}function Ie(e,t,n,r,i){return e(t,n,r,i)}function Le(){}var je=Ae,Fe=!1,ze=!1;function We(){null===Pe&&null===Te||(Le(),Re())}function Ye(e,t){var n=e.stateNode;if(null===n)return null;var r=ri(n);if(null===r)return null;n=r[t];e:switch(t){case"onClick":case"onClickCapture":case"onDoubleClick":case"onDoubleClickCapture":case"onMouseDown":case"onMouseDownCapture":case"onMouseMove":case"onMouseMoveCapture":case"onMouseUp":case"onMouseUpCapture":case"onMouseEnter":(r=!r.disabled)||(r=!("button"===(e=e.type)||"input"===e||"select"===e||"textarea"===e)),e=!r;break e;default:e=!1}if(e)return null;if(n&&"function"!==typeof n)throw Error(o(231,t,typeof n));return n}var He=!1;if(d)try{var Ue={};Object.defineProperty(Ue,"passive",{get:function(){He=!0}}),window.addEventListener("test",Ue,Ue),window.removeEventListener("test",Ue,Ue)}catch(ve){He=!1}function Ve(e,t,n,r,i,a,o,l,s){var u=Array.prototype.slice.call(arguments,3);try{t.apply(n,u)}catch(c){this.onError(c)}}var Be=!1,$e=null,Xe=!1,qe=null,Ge={onError:function(e){Be=!0,$e=e}};function Ke(e,t,n,r,i,a,o,l,s){Be=!1,$e=null,Ve.apply(Ge,arguments)}function Qe(e){var t=e,n=e;if(e.alternate)for(;t.return;)t=t.return;else{e=t;do{0!==(1026&(t=e).flags)&&(n=t.return),e=t.return}while(e)}return 3===t.tag?n:null}function Ze(e){if(13===e.tag){var t=e.memoizedState;if(null===t&&(null!==(e=e.alternate)&&(t=e.memoizedState)),null!==t)return t.dehydrated}return null}function Je(e){if(Qe(e)!==e)throw Error(o(188))}function et(e){if(!(e=function(e){var t=e.alternate;if(!t){if(null===(t=Qe(e)))throw Error(o(188));return t!==e?null:e}for(var n=e,r=t;;){var i=n.return;if(null===i)break;var a=i.alternate;if(null===a){if(null!==(r=i.return)){n=r;continue}break}if(i.child===a.child){for(a=i.child;a;){if(a===n)return Je(i),e;if(a===r)return Je(i),t;a=a.sibling}throw Error(o(188))}if(n.return!==r.return)n=i,r=a;else{for(var l=!1,s=i.child;s;){if(s===n){l=!0,n=i,r=a;break}if(s===r){l=!0,r=i,n=a;break}s=s.sibling}if(!l){for(s=a.child;s;){if(s===n){l=!0,n=a,r=i;break}if(s===r){l=!0,r=a,n=i;break}s=s.sibling}if(!l)throw Error(o(189))}}if(n.alternate!==r)throw Error(o(190))}if(3!==n.tag)throw Error(o(188));return n.stateNode.current===n?e:t}(e)))return null;for(var t=e;;){if(5===t.tag||6===t.tag)return t;if(t.child)t.child.return=t,t=t.child;else{if(t===e)break;for(;!t.sibling;){if(!t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}}return null}function tt(e,t){for(var n=e.alternate;null!==t;){if(t===e||t===n)return!0;t=t.return}return!1}var nt,rt,it,at,ot=!1,lt=[],st=null,ut=null,ct=null,dt=new Map,ft=new Map,ht=[],pt="mousedown mouseup touchcancel touchend touchstart auxclick dblclick pointercancel pointerdown pointerup dragend dragstart drop compositionend compositionstart keydown keypress keyup input textInput copy cut paste click change contextmenu reset submit".split(" ");function gt(e,t,n,r,i){return{blockedOn:e,domEventName:t,eventSystemFlags:16|n,nativeEvent:i,targetContainers:[r]}}function mt(e,t){switch(e){case"focusin":case"focusout":st=null;break;case"dragenter":case"dragleave":ut=null;break;case"mouseover":case"mouseout":ct=null;break;case"pointerover":case"pointerout":dt.delete(t.pointerId);break;case"gotpointercapture":case"lostpointercapture":ft.delete(t.pointerId)}}function vt(e,t,n,r,i,a){return null===e||e.nativeEvent!==a?(e=gt(t,n,r,i,a),null!==t&&(null!==(t=ti(t))&&rt(t)),e):(e.eventSystemFlags|=r,t=e.targetContainers,null!==i&&-1===t.indexOf(i)&&t.push(i),e)}function yt(e){var t=ei(e.target);if(null!==t){var n=Qe(t);if(null!==n)if(13===(t=n.tag)){if(null!==(t=Ze(n)))return e.blockedOn=t,void at(e.lanePriority,(function(){a.unstable_runWithPriority(e.priority,(function(){it(n)}))}))}else if(3===t&&n.stateNode.hydrate)return void(e.blockedOn=3===n.tag?n.stateNode.containerInfo:null)}e.blockedOn=null}function bt(e){if(null!==e.blockedOn)return!1;for(var t=e.targetContainers;0<t.length;){var n=en(e.domEventName,e.eventSystemFlags,t[0],e.nativeEvent);if(null!==n)return null!==(t=ti(n))&&rt(t),e.blockedOn=n,!1;t.shift()}return!0}function xt(e,t,n){bt(e)&&n.delete(t)}function wt(){for(ot=!1;0<lt.length;){var e=lt[0];if(null!==e.blockedOn){null!==(e=ti(e.blockedOn))&&nt(e);break}for(var t=e.targetContainers;0<t.length;){var n=en(e.domEventName,e.eventSystemFlags,t[0],e.nativeEvent);if(null!==n){e.blockedOn=n;break}t.shift()}null===e.blockedOn&&lt.shift()}null!==st&&bt(st)&&(st=null),null!==ut&&bt(ut)&&(ut=null),null!==ct&&bt(ct)&&(ct=null),dt.forEach(xt),ft.forEach(xt)}function _t(e,t){e.blockedOn===t&&(e.blockedOn=null,ot||(ot=!0,a.unstable_scheduleCallback(a.unstable_NormalPriority,wt)))}function kt(e){function t(t){return _t(t,e)}if(0<lt.length){_t(lt[0],e);for(var n=1;n<lt.length;n++){var r=lt[n];r.blockedOn===e&&(r.blockedOn=null)}}for(null!==st&&_t(st,e),null!==ut&&_t(ut,e),null!==ct&&_t(ct,e),dt.forEach(t),ft.forEach(t),n=0;n<ht.length;n++)(r=ht[n]).blockedOn===e&&(r.blockedOn=null);for(;0<ht.length&&null===(n=ht[0]).blockedOn;)yt(n),null===n.blockedOn&&ht.shift()}function St(e,t){var n={};return n[e.toLowerCase()]=t.toLowerCase(),n["Webkit"+e]="webkit"+t,n["Moz"+e]="moz"+t,n}var Mt={animationend:St("Animation","AnimationEnd"),animationiteration:St("Animation","AnimationIteration"),animationstart:St("Animation","AnimationStart"),transitionend:St("Transition","TransitionEnd")},Ct={},Et={};function Ot(e){if(Ct[e])return Ct[e];if(!Mt[e])return e;var t,n=Mt[e];for(t in n)if(n.hasOwnProperty(t)&&t in Et)return Ct[e]=n[t];return e}d&&(Et=document.createElement("div").style,"AnimationEvent"in window||(delete Mt.animationend.animation,delete Mt.animationiteration.animation,delete Mt.animationstart.animation),"TransitionEvent"in window||delete Mt.transitionend.transition);var Pt=Ot("animationend"),Tt=Ot("animationiteration"),Dt=Ot("animationstart"),Nt=Ot("transitionend"),Rt=new Map,At=new Map,It=["abort","abort",Pt,"animationEnd",Tt,"animationIteration",Dt,"animationStart","canplay","canPlay","canplaythrough","canPlayThrough","durationchange","durationChange","emptied","emptied","encrypted","encrypted","ended","ended","error","error","gotpointercapture","gotPointerCapture","load","load","loadeddata","loadedData","loadedmetadata","loadedMetadata","loadstart","loadStart","lostpointercapture","lostPointerCapture","playing","playing","progress","progress","seeking","seeking","stalled","stalled","suspend","suspend","timeupdate","timeUpdate",Nt,"transitionEnd","waiting","waiting"];function Lt(e,t){for(var n=0;n<e.length;n+=2){var r=e[n],i=e[n+1];i="on"+(i[0].toUpperCase()+i.slice(1)),At.set(r,t),Rt.set(r,i),u(i,[r])}}(0,a.unstable_now)();var jt=8;function Ft(e){if(0!==(1&e))return jt=15,1;if(0!==(2&e))return jt=14,2;if(0!==(4&e))return jt=13,4;var t=24&e;return 0!==t?(jt=12,t):0!==(32&e)?(jt=11,32):0!==(t=192&e)?(jt=10,t):0!==(256&e)?(jt=9,256):0!==(t=3584&e)?(jt=8,t):0!==(4096&e)?(jt=7,4096):0!==(t=4186112&e)?(jt=6,t):0!==(t=62914560&e)?(jt=5,t):67108864&e?(jt=4,67108864):0!==(134217728&e)?(jt=3,134217728):0!==(t=805306368&e)?(jt=2,t):0!==(1073741824&e)?(jt=1,1073741824):(jt=8,e)}function zt(e,t){var n=e.pendingLanes;if(0===n)return jt=0;var r=0,i=0,a=e.expiredLanes,o=e.suspendedLanes,l=e.pingedLanes;if(0!==a)r=a,i=jt=15;else if(0!==(a=134217727&n)){var s=a&~o;0!==s?(r=Ft(s),i=jt):0!==(l&=a)&&(r=Ft(l),i=jt)}else 0!==(a=n&~o)?(r=Ft(a),i=jt):0!==l&&(r=Ft(l),i=jt);if(0===r)return 0;if(r=n&((0>(r=31-Bt(r))?0:1<<r)<<1)-1,0!==t&&t!==r&&0===(t&o)){if(Ft(t),i<=jt)return t;jt=i}if(0!==(t=e.entangledLanes))for(e=e.entanglements,t&=r;0<t;)i=1<<(n=31-Bt(t)),r|=e[n],t&=~i;return r}function Wt(e){return 0!==(e=-1073741825&e.pendingLanes)?e:1073741824&e?1073741824:0}function Yt(e,t){switch(e){case 15:return 1;case 14:return 2;case 12:return 0===(e=Ht(24&~t))?Yt(10,t):e;case 10:return 0===(e=Ht(192&~t))?Yt(8,t):e;case 8:return 0===(e=Ht(3584&~t))&&(0===(e=Ht(4186112&~t))&&(e=512)),e;case 2:return 0===(t=Ht(805306368&~t))&&(t=268435456),t}throw Error(o(358,e))}function Ht(e){return e&-e}function Ut(e){for(var t=[],n=0;31>n;n++)t.push(e);return t}function Vt(e,t,n){e.pendingLanes|=t;var r=t-1;e.suspendedLanes&=r,e.pingedLanes&=r,(e=e.eventTimes)[t=31-Bt(t)]=n}var Bt=Math.clz32?Math.clz32:function(e){return 0===e?32:31-($t(e)/Xt|0)|0},$t=Math.log,Xt=Math.LN2;var qt=a.unstable_UserBlockingPriority,Gt=a.unstable_runWithPriority,Kt=!0;function Qt(e,t,n,r){Fe||Le();var i=Jt,a=Fe;Fe=!0;try{Ie(i,e,t,n,r)}finally{(Fe=a)||We()}}function Zt(e,t,n,r){Gt(qt,Jt.bind(null,e,t,n,r))}function Jt(e,t,n,r){var i;if(Kt)if((i=0===(4&t))&&0<lt.length&&-1<pt.indexOf(e))e=gt(null,e,t,n,r),lt.push(e);else{var a=en(e,t,n,r);if(null===a)i&&mt(e,r);else{if(i){if(-1<pt.indexOf(e))return e=gt(a,e,t,n,r),void lt.push(e);if(function(e,t,n,r,i){switch(t){case"focusin":return st=vt(st,e,t,n,r,i),!0;case"dragenter":return ut=vt(ut,e,t,n,r,i),!0;case"mouseover":return ct=vt(ct,e,t,n,r,i),!0;case"pointerover":var a=i.pointerId;return dt.set(a,vt(dt.get(a)||null,e,t,n,r,i)),!0;case"gotpointercapture":return a=i.pointerId,ft.set(a,vt(ft.get(a)||null,e,t,n,r,i)),!0}return!1}(a,e,t,n,r))return;mt(e,r)}Rr(e,t,r,null,n)}}}function en(e,t,n,r){var i=Ee(r);if(null!==(i=ei(i))){var a=Qe(i);if(null===a)i=null;else{var o=a.tag;if(13===o){if(null!==(i=Ze(a)))return i;i=null}else if(3===o){if(a.stateNode.hydrate)return 3===a.tag?a.stateNode.containerInfo:null;i=null}else a!==i&&(i=null)}}return Rr(e,t,r,i,n),null}var tn=null,nn=null,rn=null;function an(){if(rn)return rn;var e,t,n=nn,r=n.length,i="value"in tn?tn.value:tn.textContent,a=i.length;for(e=0;e<r&&n[e]===i[e];e++);var o=r-e;for(t=1;t<=o&&n[r-t]===i[a-t];t++);return rn=i.slice(e,1<t?1-t:void 0)}function on(e){var t=e.keyCode;return"charCode"in e?0===(e=e.charCode)&&13===t&&(e=13):e=t,10===e&&(e=13),32<=e||13===e?e:0}function ln(){return!0}function sn(){return!1}function un(e){function t(t,n,r,i,a){for(var o in this._reactName=t,this._targetInst=r,this.type=n,this.nativeEvent=i,this.target=a,this.currentTarget=null,e)e.hasOwnProperty(o)&&(t=e[o],this[o]=t?t(i):i[o]);return this.isDefaultPrevented=(null!=i.defaultPrevented?i.defaultPrevented:!1===i.returnValue)?ln:sn,this.isPropagationStopped=sn,this}return i(t.prototype,{preventDefault:function(){this.defaultPrevented=!0;var e=this.nativeEvent;e&&(e.preventDefault?e.preventDefault():"unknown"!==typeof e.returnValue&&(e.returnValue=!1),this.isDefaultPrevented=ln)},stopPropagation:function(){var e=this.nativeEvent;e&&(e.stopPropagation?e.stopPropagation():"unknown"!==typeof e.cancelBubble&&(e.cancelBubble=!0),this.isPropagationStopped=ln)},persist:function(){},isPersistent:ln}),t}var cn,dn,fn,hn={eventPhase:0,bubbles:0,cancelable:0,timeStamp:function(e){return e.timeStamp||Date.now()},defaultPrevented:0,isTrusted:0},pn=un(hn),gn=i({},hn,{view:0,detail:0}),mn=un(gn),vn=i({},gn,{screenX:0,screenY:0,clientX:0,clientY:0,pageX:0,pageY:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,getModifierState:On,button:0,buttons:0,relatedTarget:function(e){return void 0===e.relatedTarget?e.fromElement===e.srcElement?e.toElement:e.fromElement:e.relatedTarget},movementX:function(e){return"movementX"in e?e.movementX:(e!==fn&&(fn&&"mousemove"===e.type?(cn=e.screenX-fn.screenX,dn=e.screenY-fn.screenY):dn=cn=0,fn=e),cn)},movementY:function(e){return"movementY"in e?e.movementY:dn}}),yn=un(vn),bn=un(i({},vn,{dataTransfer:0})),xn=un(i({},gn,{relatedTarget:0})),wn=un(i({},hn,{animationName:0,elapsedTime:0,pseudoElement:0})),_n=un(i({},hn,{clipboardData:function(e){return"clipboardData"in e?e.clipboardData:window.clipboardData}})),kn=un(i({},hn,{data:0})),Sn={Esc:"Escape",Spacebar:" ",Left:"ArrowLeft",Up:"ArrowUp",Right:"ArrowRight",Down:"ArrowDown",Del:"Delete",Win:"OS",Menu:"ContextMenu",Apps:"ContextMenu",Scroll:"ScrollLock",MozPrintableKey:"Unidentified"},Mn={8:"Backspace",9:"Tab",12:"Clear",13:"Enter",16:"Shift",17:"Control",18:"Alt",19:"Pause",20:"CapsLock",27:"Escape",32:" ",33:"PageUp",34:"PageDown",35:"End",36:"Home",37:"ArrowLeft",38:"ArrowUp",39:"ArrowRight",40:"ArrowDown",45:"Insert",46:"Delete",112:"F1",113:"F2",114:"F3",115:"F4",116:"F5",117:"F6",118:"F7",119:"F8",120:"F9",121:"F10",122:"F11",123:"F12",144:"NumLock",145:"ScrollLock",224:"Meta"},Cn={Alt:"altKey",Control:"ctrlKey",Meta:"metaKey",Shift:"shiftKey"};function En(e){var t=this.nativeEvent;return t.getModifierState?t.getModifierState(e):!!(e=Cn[e])&&!!t[e]}function On(){return En}var Pn=un(i({},gn,{key:function(e){if(e.key){var t=Sn[e.key]||e.key;if("Unidentified"!==t)return t}return"keypress"===e.type?13===(e=on(e))?"Enter":String.fromCharCode(e):"keydown"===e.type||"keyup"===e.type?Mn[e.keyCode]||"Unidentified":""},code:0,location:0,ctrlKey:0,shiftKey:0,altKey:0,metaKey:0,repeat:0,locale:0,getModifierState:On,charCode:function(e){return"keypress"===e.type?on(e):0},keyCode:function(e){return"keydown"===e.type||"keyup"===e.type?e.keyCode:0},which:function(e){return"keypress"===e.type?on(e):"keydown"===e.type||"keyup"===e.type?e.keyCode:0}})),Tn=un(i({},vn,{pointerId:0,width:0,height:0,pressure:0,tangentialPressure:0,tiltX:0,tiltY:0,twist:0,pointerType:0,isPrimary:0})),Dn=un(i({},gn,{touches:0,targetTouches:0,changedTouches:0,altKey:0,metaKey:0,ctrlKey:0,shiftKey:0,getModifierState:On})),Nn=un(i({},hn,{propertyName:0,elapsedTime:0,pseudoElement:0})),Rn=un(i({},vn,{deltaX:function(e){return"deltaX"in e?e.deltaX:"wheelDeltaX"in e?-e.wheelDeltaX:0},deltaY:function(e){return"deltaY"in e?e.deltaY:"wheelDeltaY"in e?-e.wheelDeltaY:"wheelDelta"in e?-e.wheelDelta:0},deltaZ:0,deltaMode:0})),An=[9,13,27,32],In=d&&"CompositionEvent"in window,Ln=null;d&&"documentMode"in document&&(Ln=document.documentMode);var jn=d&&"TextEvent"in window&&!Ln,Fn=d&&(!In||Ln&&8<Ln&&11>=Ln),zn=String.fromCharCode(32),Wn=!1;function Yn(e,t){switch(e){case"keyup":return-1!==An.indexOf(t.keyCode);case"keydown":return 229!==t.keyCode;case"keypress":case"mousedown":case"focusout":return!0;default:return!1}}function Hn(e){return"object"===typeof(e=e.detail)&&"data"in e?e.data:null}var Un=!1;var Vn={color:!0,date:!0,datetime:!0,"datetime-local":!0,email:!0,month:!0,number:!0,password:!0,range:!0,search:!0,tel:!0,text:!0,time:!0,url:!0,week:!0};function Bn(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return"input"===t?!!Vn[e.type]:"textarea"===t}function $n(e,t,n,r){Ne(r),0<(t=Ir(t,"onChange")).length&&(n=new pn("onChange","change",null,n,r),e.push({event:n,listeners:t}))}var Xn=null,qn=null;function Gn(e){Er(e,0)}function Kn(e){if(Z(ni(e)))return e}function Qn(e,t){if("change"===e)return t}var Zn=!1;if(d){var Jn;if(d){var er="oninput"in document;if(!er){var tr=document.createElement("div");tr.setAttribute("oninput","return;"),er="function"===typeof tr.oninput}Jn=er}else Jn=!1;Zn=Jn&&(!document.documentMode||9<document.documentMode)}function nr(){Xn&&(Xn.detachEvent("onpropertychange",rr),qn=Xn=null)}function rr(e){if("value"===e.propertyName&&Kn(qn)){var t=[];if($n(t,qn,e,Ee(e)),e=Gn,Fe)e(t);else{Fe=!0;try{Ae(e,t)}finally{Fe=!1,We()}}}}function ir(e,t,n){"focusin"===e?(nr(),qn=n,(Xn=t).attachEvent("onpropertychange",rr)):"focusout"===e&&nr()}function ar(e){if("selectionchange"===e||"keyup"===e||"keydown"===e)return Kn(qn)}function or(e,t){if("click"===e)return Kn(t)}function lr(e,t){if("input"===e||"change"===e)return Kn(t)}var sr="function"===typeof Object.is?Object.is:function(e,t){return e===t&&(0!==e||1/e===1/t)||e!==e&&t!==t},ur=Object.prototype.hasOwnProperty;function cr(e,t){if(sr(e,t))return!0;if("object"!==typeof e||null===e||"object"!==typeof t||null===t)return!1;var n=Object.keys(e),r=Object.keys(t);if(n.length!==r.length)return!1;for(r=0;r<n.length;r++)if(!ur.call(t,n[r])||!sr(e[n[r]],t[n[r]]))return!1;return!0}function dr(e){for(;e&&e.firstChild;)e=e.firstChild;return e}function fr(e,t){var n,r=dr(e);for(e=0;r;){if(3===r.nodeType){if(n=e+r.textContent.length,e<=t&&n>=t)return{node:r,offset:t-e};e=n}e:{for(;r;){if(r.nextSibling){r=r.nextSibling;break e}r=r.parentNode}r=void 0}r=dr(r)}}function hr(e,t){return!(!e||!t)&&(e===t||(!e||3!==e.nodeType)&&(t&&3===t.nodeType?hr(e,t.parentNode):"contains"in e?e.contains(t):!!e.compareDocumentPosition&&!!(16&e.compareDocumentPosition(t))))}function pr(){for(var e=window,t=J();t instanceof e.HTMLIFrameElement;){try{var n="string"===typeof t.contentWindow.location.href}catch(r){n=!1}if(!n)break;t=J((e=t.contentWindow).document)}return t}function gr(e){var t=e&&e.nodeName&&e.nodeName.toLowerCase();return t&&("input"===t&&("text"===e.type||"search"===e.type||"tel"===e.type||"url"===e.type||"password"===e.type)||"textarea"===t||"true"===e.contentEditable)}var mr=d&&"documentMode"in document&&11>=document.documentMode,vr=null,yr=null,br=null,xr=!1;function wr(e,t,n){var r=n.window===n?n.document:9===n.nodeType?n:n.ownerDocument;xr||null==vr||vr!==J(r)||("selectionStart"in(r=vr)&&gr(r)?r={start:r.selectionStart,end:r.selectionEnd}:r={anchorNode:(r=(r.ownerDocument&&r.ownerDocument.defaultView||window).getSelection()).anchorNode,anchorOffset:r.anchorOffset,focusNode:r.focusNode,focusOffset:r.focusOffset},br&&cr(br,r)||(br=r,0<(r=Ir(yr,"onSelect")).length&&(t=new pn("onSelect","select",null,t,n),e.push({event:t,listeners:r}),t.target=vr)))}Lt("cancel cancel click click close close contextmenu contextMenu copy copy cut cut auxclick auxClick dblclick doubleClick dragend dragEnd dragstart dragStart drop drop focusin focus focusout blur input input invalid invalid keydown keyDown keypress keyPress keyup keyUp mousedown mouseDown mouseup mouseUp paste paste pause pause play play pointercancel pointerCancel pointerdown pointerDown pointerup pointerUp ratechange rateChange reset reset seeked seeked submit submit touchcancel touchCancel touchend touchEnd touchstart touchStart volumechange volumeChange".split(" "),0),Lt("drag drag dragenter dragEnter dragexit dragExit dragleave dragLeave dragover dragOver mousemove mouseMove mouseout mouseOut mouseover mouseOver pointermove pointerMove pointerout pointerOut pointerover pointerOver scroll scroll toggle toggle touchmove touchMove wheel wheel".split(" "),1),Lt(It,2);for(var _r="change selectionchange textInput compositionstart compositionend compositionupdate".split(" "),kr=0;kr<_r.length;kr++)At.set(_r[kr],0);c("onMouseEnter",["mouseout","mouseover"]),c("onMouseLeave",["mouseout","mouseover"]),c("onPointerEnter",["pointerout","pointerover"]),c("onPointerLeave",["pointerout","pointerover"]),u("onChange","change click focusin focusout input keydown keyup selectionchange".split(" ")),u("onSelect","focusout contextmenu dragend focusin keydown keyup mousedown mouseup selectionchange".split(" ")),u("onBeforeInput",["compositionend","keypress","textInput","paste"]),u("onCompositionEnd","compositionend focusout keydown keypress keyup mousedown".split(" ")),u("onCompositionStart","compositionstart focusout keydown keypress keyup mousedown".split(" ")),u("onCompositionUpdate","compositionupdate focusout keydown keypress keyup mousedown".split(" "));var Sr="abort canplay canplaythrough durationchange emptied encrypted ended error loadeddata loadedmetadata loadstart pause play playing progress ratechange seeked seeking stalled suspend timeupdate volumechange waiting".split(" "),Mr=new Set("cancel close invalid load scroll toggle".split(" ").concat(Sr));function Cr(e,t,n){var r=e.type||"unknown-event";e.currentTarget=n,function(e,t,n,r,i,a,l,s,u){if(Ke.apply(this,arguments),Be){if(!Be)throw Error(o(198));var c=$e;Be=!1,$e=null,Xe||(Xe=!0,qe=c)}}(r,t,void 0,e),e.currentTarget=null}function Er(e,t){t=0!==(4&t);for(var n=0;n<e.length;n++){var r=e[n],i=r.event;r=r.listeners;e:{var a=void 0;if(t)for(var o=r.length-1;0<=o;o--){var l=r[o],s=l.instance,u=l.currentTarget;if(l=l.listener,s!==a&&i.isPropagationStopped())break e;Cr(i,l,u),a=s}else for(o=0;o<r.length;o++){if(s=(l=r[o]).instance,u=l.currentTarget,l=l.listener,s!==a&&i.isPropagationStopped())break e;Cr(i,l,u),a=s}}}if(Xe)throw e=qe,Xe=!1,qe=null,e}function Or(e,t){var n=ii(t),r=e+"__bubble";n.has(r)||(Nr(t,e,2,!1),n.add(r))}var Pr="_reactListening"+Math.random().toString(36).slice(2);function Tr(e){e[Pr]||(e[Pr]=!0,l.forEach((function(t){Mr.has(t)||Dr(t,!1,e,null),Dr(t,!0,e,null)})))}function Dr(e,t,n,r){var i=4<arguments.length&&void 0!==arguments[4]?arguments[4]:0,a=n;if("selectionchange"===e&&9!==n.nodeType&&(a=n.ownerDocument),null!==r&&!t&&Mr.has(e)){if("scroll"!==e)return;i|=2,a=r}var o=ii(a),l=e+"__"+(t?"capture":"bubble");o.has(l)||(t&&(i|=4),Nr(a,e,i,t),o.add(l))}function Nr(e,t,n,r){var i=At.get(t);switch(void 0===i?2:i){case 0:i=Qt;break;case 1:i=Zt;break;default:i=Jt}n=i.bind(null,t,n,e),i=void 0,!He||"touchstart"!==t&&"touchmove"!==t&&"wheel"!==t||(i=!0),r?void 0!==i?e.addEventListener(t,n,{capture:!0,passive:i}):e.addEventListener(t,n,!0):void 0!==i?e.addEventListener(t,n,{passive:i}):e.addEventListener(t,n,!1)}function Rr(e,t,n,r,i){var a=r;if(0===(1&t)&&0===(2&t)&&null!==r)e:for(;;){if(null===r)return;var o=r.tag;if(3===o||4===o){var l=r.stateNode.containerInfo;if(l===i||8===l.nodeType&&l.parentNode===i)break;if(4===o)for(o=r.return;null!==o;){var s=o.tag;if((3===s||4===s)&&((s=o.stateNode.containerInfo)===i||8===s.nodeType&&s.parentNode===i))return;o=o.return}for(;null!==l;){if(null===(o=ei(l)))return;if(5===(s=o.tag)||6===s){r=a=o;continue e}l=l.parentNode}}r=r.return}!function(e,t,n){if(ze)return e(t,n);ze=!0;try{je(e,t,n)}finally{ze=!1,We()}}((function(){var r=a,i=Ee(n),o=[];e:{var l=Rt.get(e);if(void 0!==l){var s=pn,u=e;switch(e){case"keypress":if(0===on(n))break e;case"keydown":case"keyup":s=Pn;break;case"focusin":u="focus",s=xn;break;case"focusout":u="blur",s=xn;break;case"beforeblur":case"afterblur":s=xn;break;case"click":if(2===n.button)break e;case"auxclick":case"dblclick":case"mousedown":case"mousemove":case"mouseup":case"mouseout":case"mouseover":case"contextmenu":s=yn;break;case"drag":case"dragend":case"dragenter":case"dragexit":case"dragleave":case"dragover":case"dragstart":case"drop":s=bn;break;case"touchcancel":case"touchend":case"touchmove":case"touchstart":s=Dn;break;case Pt:case Tt:case Dt:s=wn;break;case Nt:s=Nn;break;case"scroll":s=mn;break;case"wheel":s=Rn;break;case"copy":case"cut":case"paste":s=_n;break;case"gotpointercapture":case"lostpointercapture":case"pointercancel":case"pointerdown":case"pointermove":case"pointerout":case"pointerover":case"pointerup":s=Tn}var c=0!==(4&t),d=!c&&"scroll"===e,f=c?null!==l?l+"Capture":null:l;c=[];for(var h,p=r;null!==p;){var g=(h=p).stateNode;if(5===h.tag&&null!==g&&(h=g,null!==f&&(null!=(g=Ye(p,f))&&c.push(Ar(p,g,h)))),d)break;p=p.return}0<c.length&&(l=new s(l,u,null,n,i),o.push({event:l,listeners:c}))}}if(0===(7&t)){if(s="mouseout"===e||"pointerout"===e,(!(l="mouseover"===e||"pointerover"===e)||0!==(16&t)||!(u=n.relatedTarget||n.fromElement)||!ei(u)&&!u[Zr])&&(s||l)&&(l=i.window===i?i:(l=i.ownerDocument)?l.defaultView||l.parentWindow:window,s?(s=r,null!==(u=(u=n.relatedTarget||n.toElement)?ei(u):null)&&(u!==(d=Qe(u))||5!==u.tag&&6!==u.tag)&&(u=null)):(s=null,u=r),s!==u)){if(c=yn,g="onMouseLeave",f="onMouseEnter",p="mouse","pointerout"!==e&&"pointerover"!==e||(c=Tn,g="onPointerLeave",f="onPointerEnter",p="pointer"),d=null==s?l:ni(s),h=null==u?l:ni(u),(l=new c(g,p+"leave",s,n,i)).target=d,l.relatedTarget=h,g=null,ei(i)===r&&((c=new c(f,p+"enter",u,n,i)).target=h,c.relatedTarget=d,g=c),d=g,s&&u)e:{for(f=u,p=0,h=c=s;h;h=Lr(h))p++;for(h=0,g=f;g;g=Lr(g))h++;for(;0<p-h;)c=Lr(c),p--;for(;0<h-p;)f=Lr(f),h--;for(;p--;){if(c===f||null!==f&&c===f.alternate)break e;c=Lr(c),f=Lr(f)}c=null}else c=null;null!==s&&jr(o,l,s,c,!1),null!==u&&null!==d&&jr(o,d,u,c,!0)}if("select"===(s=(l=r?ni(r):window).nodeName&&l.nodeName.toLowerCase())||"input"===s&&"file"===l.type)var m=Qn;else if(Bn(l))if(Zn)m=lr;else{m=ar;var v=ir}else(s=l.nodeName)&&"input"===s.toLowerCase()&&("checkbox"===l.type||"radio"===l.type)&&(m=or);switch(m&&(m=m(e,r))?$n(o,m,n,i):(v&&v(e,l,r),"focusout"===e&&(v=l._wrapperState)&&v.controlled&&"number"===l.type&&ae(l,"number",l.value)),v=r?ni(r):window,e){case"focusin":(Bn(v)||"true"===v.contentEditable)&&(vr=v,yr=r,br=null);break;case"focusout":br=yr=vr=null;break;case"mousedown":xr=!0;break;case"contextmenu":case"mouseup":case"dragend":xr=!1,wr(o,n,i);break;case"selectionchange":if(mr)break;case"keydown":case"keyup":wr(o,n,i)}var y;if(In)e:{switch(e){case"compositionstart":var b="onCompositionStart";break e;case"compositionend":b="onCompositionEnd";break e;case"compositionupdate":b="onCompositionUpdate";break e}b=void 0}else Un?Yn(e,n)&&(b="onCompositionEnd"):"keydown"===e&&229===n.keyCode&&(b="onCompositionStart");b&&(Fn&&"ko"!==n.locale&&(Un||"onCompositionStart"!==b?"onCompositionEnd"===b&&Un&&(y=an()):(nn="value"in(tn=i)?tn.value:tn.textContent,Un=!0)),0<(v=Ir(r,b)).length&&(b=new kn(b,e,null,n,i),o.push({event:b,listeners:v}),y?b.data=y:null!==(y=Hn(n))&&(b.data=y))),(y=jn?function(e,t){switch(e){case"compositionend":return Hn(t);case"keypress":return 32!==t.which?null:(Wn=!0,zn);case"textInput":return(e=t.data)===zn&&Wn?null:e;default:return null}}(e,n):function(e,t){if(Un)return"compositionend"===e||!In&&Yn(e,t)?(e=an(),rn=nn=tn=null,Un=!1,e):null;switch(e){case"paste":return null;case"keypress":if(!(t.ctrlKey||t.altKey||t.metaKey)||t.ctrlKey&&t.altKey){if(t.char&&1<t.char.length)return t.char;if(t.which)return String.fromCharCode(t.which)}return null;case"compositionend":return Fn&&"ko"!==t.locale?null:t.data;default:return null}}(e,n))&&(0<(r=Ir(r,"onBeforeInput")).length&&(i=new kn("onBeforeInput","beforeinput",null,n,i),o.push({event:i,listeners:r}),i.data=y))}Er(o,t)}))}function Ar(e,t,n){return{instance:e,listener:t,currentTarget:n}}function Ir(e,t){for(var n=t+"Capture",r=[];null!==e;){var i=e,a=i.stateNode;5===i.tag&&null!==a&&(i=a,null!=(a=Ye(e,n))&&r.unshift(Ar(e,a,i)),null!=(a=Ye(e,t))&&r.push(Ar(e,a,i))),e=e.return}return r}function Lr(e){if(null===e)return null;do{e=e.return}while(e&&5!==e.tag);return e||null}function jr(e,t,n,r,i){for(var a=t._reactName,o=[];null!==n&&n!==r;){var l=n,s=l.alternate,u=l.stateNode;if(null!==s&&s===r)break;5===l.tag&&null!==u&&(l=u,i?null!=(s=Ye(n,a))&&o.unshift(Ar(n,s,l)):i||null!=(s=Ye(n,a))&&o.push(Ar(n,s,l))),n=n.return}0!==o.length&&e.push({event:t,listeners:o})}function Fr(){}var zr=null,Wr=null;function Yr(e,t){switch(e){case"button":case"input":case"select":case"textarea":return!!t.autoFocus}return!1}function Hr(e,t){return"textarea"===e||"option"===e||"noscript"===e||"string"===typeof t.children||"number"===typeof t.children||"object"===typeof t.dangerouslySetInnerHTML&&null!==t.dangerouslySetInnerHTML&&null!=t.dangerouslySetInnerHTML.__html}var Ur="function"===typeof setTimeout?setTimeout:void 0,Vr="function"===typeof clearTimeout?clearTimeout:void 0;function Br(e){1===e.nodeType?e.textContent="":9===e.nodeType&&(null!=(e=e.body)&&(e.textContent=""))}function $r(e){for(;null!=e;e=e.nextSibling){var t=e.nodeType;if(1===t||3===t)break}return e}function Xr(e){e=e.previousSibling;for(var t=0;e;){if(8===e.nodeType){var n=e.data;if("$"===n||"$!"===n||"$?"===n){if(0===t)return e;t--}else"/$"===n&&t++}e=e.previousSibling}return null}var qr=0;var Gr=Math.random().toString(36).slice(2),Kr="__reactFiber$"+Gr,Qr="__reactProps$"+Gr,Zr="__reactContainer$"+Gr,Jr="__reactEvents$"+Gr;function ei(e){var t=e[Kr];if(t)return t;for(var n=e.parentNode;n;){if(t=n[Zr]||n[Kr]){if(n=t.alternate,null!==t.child||null!==n&&null!==n.child)for(e=Xr(e);null!==e;){if(n=e[Kr])return n;e=Xr(e)}return t}n=(e=n).parentNode}return null}function ti(e){return!(e=e[Kr]||e[Zr])||5!==e.tag&&6!==e.tag&&13!==e.tag&&3!==e.tag?null:e}function ni(e){if(5===e.tag||6===e.tag)return e.stateNode;throw Error(o(33))}function ri(e){return e[Qr]||null}function ii(e){var t=e[Jr];return void 0===t&&(t=e[Jr]=new Set),t}var ai=[],oi=-1;function li(e){return{current:e}}function si(e){0>oi||(e.current=ai[oi],ai[oi]=null,oi--)}function ui(e,t){oi++,ai[oi]=e.current,e.current=t}var ci={},di=li(ci),fi=li(!1),hi=ci;function pi(e,t){var n=e.type.contextTypes;if(!n)return ci;var r=e.stateNode;if(r&&r.__reactInternalMemoizedUnmaskedChildContext===t)return r.__reactInternalMemoizedMaskedChildContext;var i,a={};for(i in n)a[i]=t[i];return r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=t,e.__reactInternalMemoizedMaskedChildContext=a),a}function gi(e){return null!==(e=e.childContextTypes)&&void 0!==e}function mi(){si(fi),si(di)}function vi(e,t,n){if(di.current!==ci)throw Error(o(168));ui(di,t),ui(fi,n)}function yi(e,t,n){var r=e.stateNode;if(e=t.childContextTypes,"function"!==typeof r.getChildContext)return n;for(var a in r=r.getChildContext())if(!(a in e))throw Error(o(108,q(t)||"Unknown",a));return i({},n,r)}function bi(e){return e=(e=e.stateNode)&&e.__reactInternalMemoizedMergedChildContext||ci,hi=di.current,ui(di,e),ui(fi,fi.current),!0}function xi(e,t,n){var r=e.stateNode;if(!r)throw Error(o(169));n?(e=yi(e,t,hi),r.__reactInternalMemoizedMergedChildContext=e,si(fi),si(di),ui(di,e)):si(fi),ui(fi,n)}var wi=null,_i=null,ki=a.unstable_runWithPriority,Si=a.unstable_scheduleCallback,Mi=a.unstable_cancelCallback,Ci=a.unstable_shouldYield,Ei=a.unstable_requestPaint,Oi=a.unstable_now,Pi=a.unstable_getCurrentPriorityLevel,Ti=a.unstable_ImmediatePriority,Di=a.unstable_UserBlockingPriority,Ni=a.unstable_NormalPriority,Ri=a.unstable_LowPriority,Ai=a.unstable_IdlePriority,Ii={},Li=void 0!==Ei?Ei:function(){},ji=null,Fi=null,zi=!1,Wi=Oi(),Yi=1e4>Wi?Oi:function(){return Oi()-Wi};function Hi(){switch(Pi()){case Ti:return 99;case Di:return 98;case Ni:return 97;case Ri:return 96;case Ai:return 95;default:throw Error(o(332))}}function Ui(e){switch(e){case 99:return Ti;case 98:return Di;case 97:return Ni;case 96:return Ri;case 95:return Ai;default:throw Error(o(332))}}function Vi(e,t){return e=Ui(e),ki(e,t)}function Bi(e,t,n){return e=Ui(e),Si(e,t,n)}function $i(){if(null!==Fi){var e=Fi;Fi=null,Mi(e)}Xi()}function Xi(){if(!zi&&null!==ji){zi=!0;var e=0;try{var t=ji;Vi(99,(function(){for(;e<t.length;e++){var n=t[e];do{n=n(!0)}while(null!==n)}})),ji=null}catch(n){throw null!==ji&&(ji=ji.slice(e+1)),Si(Ti,$i),n}finally{zi=!1}}}var qi=_.ReactCurrentBatchConfig;function Gi(e,t){if(e&&e.defaultProps){for(var n in t=i({},t),e=e.defaultProps)void 0===t[n]&&(t[n]=e[n]);return t}return t}var Ki=li(null),Qi=null,Zi=null,Ji=null;function ea(){Ji=Zi=Qi=null}function ta(e){var t=Ki.current;si(Ki),e.type._context._currentValue=t}function na(e,t){for(;null!==e;){var n=e.alternate;if((e.childLanes&t)===t){if(null===n||(n.childLanes&t)===t)break;n.childLanes|=t}else e.childLanes|=t,null!==n&&(n.childLanes|=t);e=e.return}}function ra(e,t){Qi=e,Ji=Zi=null,null!==(e=e.dependencies)&&null!==e.firstContext&&(0!==(e.lanes&t)&&(Io=!0),e.firstContext=null)}function ia(e,t){if(Ji!==e&&!1!==t&&0!==t)if("number"===typeof t&&1073741823!==t||(Ji=e,t=1073741823),t={context:e,observedBits:t,next:null},null===Zi){if(null===Qi)throw Error(o(308));Zi=t,Qi.dependencies={lanes:0,firstContext:t,responders:null}}else Zi=Zi.next=t;return e._currentValue}var aa=!1;function oa(e){e.updateQueue={baseState:e.memoizedState,firstBaseUpdate:null,lastBaseUpdate:null,shared:{pending:null},effects:null}}function la(e,t){e=e.updateQueue,t.updateQueue===e&&(t.updateQueue={baseState:e.baseState,firstBaseUpdate:e.firstBaseUpdate,lastBaseUpdate:e.lastBaseUpdate,shared:e.shared,effects:e.effects})}function sa(e,t){return{eventTime:e,lane:t,tag:0,payload:null,callback:null,next:null}}function ua(e,t){if(null!==(e=e.updateQueue)){var n=(e=e.shared).pending;null===n?t.next=t:(t.next=n.next,n.next=t),e.pending=t}}function ca(e,t){var n=e.updateQueue,r=e.alternate;if(null!==r&&n===(r=r.updateQueue)){var i=null,a=null;if(null!==(n=n.firstBaseUpdate)){do{var o={eventTime:n.eventTime,lane:n.lane,tag:n.tag,payload:n.payload,callback:n.callback,next:null};null===a?i=a=o:a=a.next=o,n=n.next}while(null!==n);null===a?i=a=t:a=a.next=t}else i=a=t;return n={baseState:r.baseState,firstBaseUpdate:i,lastBaseUpdate:a,shared:r.shared,effects:r.effects},void(e.updateQueue=n)}null===(e=n.lastBaseUpdate)?n.firstBaseUpdate=t:e.next=t,n.lastBaseUpdate=t}function da(e,t,n,r){var a=e.updateQueue;aa=!1;var o=a.firstBaseUpdate,l=a.lastBaseUpdate,s=a.shared.pending;if(null!==s){a.shared.pending=null;var u=s,c=u.next;u.next=null,null===l?o=c:l.next=c,l=u;var d=e.alternate;if(null!==d){var f=(d=d.updateQueue).lastBaseUpdate;f!==l&&(null===f?d.firstBaseUpdate=c:f.next=c,d.lastBaseUpdate=u)}}if(null!==o){for(f=a.baseState,l=0,d=c=u=null;;){s=o.lane;var h=o.eventTime;if((r&s)===s){null!==d&&(d=d.next={eventTime:h,lane:0,tag:o.tag,payload:o.payload,callback:o.callback,next:null});e:{var p=e,g=o;switch(s=t,h=n,g.tag){case 1:if("function"===typeof(p=g.payload)){f=p.call(h,f,s);break e}f=p;break e;case 3:p.flags=-4097&p.flags|64;case 0:if(null===(s="function"===typeof(p=g.payload)?p.call(h,f,s):p)||void 0===s)break e;f=i({},f,s);break e;case 2:aa=!0}}null!==o.callback&&(e.flags|=32,null===(s=a.effects)?a.effects=[o]:s.push(o))}else h={eventTime:h,lane:s,tag:o.tag,payload:o.payload,callback:o.callback,next:null},null===d?(c=d=h,u=f):d=d.next=h,l|=s;if(null===(o=o.next)){if(null===(s=a.shared.pending))break;o=s.next,s.next=null,a.lastBaseUpdate=s,a.shared.pending=null}}null===d&&(u=f),a.baseState=u,a.firstBaseUpdate=c,a.lastBaseUpdate=d,zl|=l,e.lanes=l,e.memoizedState=f}}function fa(e,t,n){if(e=t.effects,t.effects=null,null!==e)for(t=0;t<e.length;t++){var r=e[t],i=r.callback;if(null!==i){if(r.callback=null,r=n,"function"!==typeof i)throw Error(o(191,i));i.call(r)}}}var ha=(new r.Component).refs;function pa(e,t,n,r){n=null===(n=n(r,t=e.memoizedState))||void 0===n?t:i({},t,n),e.memoizedState=n,0===e.lanes&&(e.updateQueue.baseState=n)}var ga={isMounted:function(e){return!!(e=e._reactInternals)&&Qe(e)===e},enqueueSetState:function(e,t,n){e=e._reactInternals;var r=cs(),i=ds(e),a=sa(r,i);a.payload=t,void 0!==n&&null!==n&&(a.callback=n),ua(e,a),fs(e,i,r)},enqueueReplaceState:function(e,t,n){e=e._reactInternals;var r=cs(),i=ds(e),a=sa(r,i);a.tag=1,a.payload=t,void 0!==n&&null!==n&&(a.callback=n),ua(e,a),fs(e,i,r)},enqueueForceUpdate:function(e,t){e=e._reactInternals;var n=cs(),r=ds(e),i=sa(n,r);i.tag=2,void 0!==t&&null!==t&&(i.callback=t),ua(e,i),fs(e,r,n)}};function ma(e,t,n,r,i,a,o){return"function"===typeof(e=e.stateNode).shouldComponentUpdate?e.shouldComponentUpdate(r,a,o):!t.prototype||!t.prototype.isPureReactComponent||(!cr(n,r)||!cr(i,a))}function va(e,t,n){var r=!1,i=ci,a=t.contextType;return"object"===typeof a&&null!==a?a=ia(a):(i=gi(t)?hi:di.current,a=(r=null!==(r=t.contextTypes)&&void 0!==r)?pi(e,i):ci),t=new t(n,a),e.memoizedState=null!==t.state&&void 0!==t.state?t.state:null,t.updater=ga,e.stateNode=t,t._reactInternals=e,r&&((e=e.stateNode).__reactInternalMemoizedUnmaskedChildContext=i,e.__reactInternalMemoizedMaskedChildContext=a),t}function ya(e,t,n,r){e=t.state,"function"===typeof t.componentWillReceiveProps&&t.componentWillReceiveProps(n,r),"function"===typeof t.UNSAFE_componentWillReceiveProps&&t.UNSAFE_componentWillReceiveProps(n,r),t.state!==e&&ga.enqueueReplaceState(t,t.state,null)}function ba(e,t,n,r){var i=e.stateNode;i.props=n,i.state=e.memoizedState,i.refs=ha,oa(e);var a=t.contextType;"object"===typeof a&&null!==a?i.context=ia(a):(a=gi(t)?hi:di.current,i.context=pi(e,a)),da(e,n,i,r),i.state=e.memoizedState,"function"===typeof(a=t.getDerivedStateFromProps)&&(pa(e,t,a,n),i.state=e.memoizedState),"function"===typeof t.getDerivedStateFromProps||"function"===typeof i.getSnapshotBeforeUpdate||"function"!==typeof i.UNSAFE_componentWillMount&&"function"!==typeof i.componentWillMount||(t=i.state,"function"===typeof i.componentWillMount&&i.componentWillMount(),"function"===typeof i.UNSAFE_componentWillMount&&i.UNSAFE_componentWillMount(),t!==i.state&&ga.enqueueReplaceState(i,i.state,null),da(e,n,i,r),i.state=e.memoizedState),"function"===typeof i.componentDidMount&&(e.flags|=4)}var xa=Array.isArray;function wa(e,t,n){if(null!==(e=n.ref)&&"function"!==typeof e&&"object"!==typeof e){if(n._owner){if(n=n._owner){if(1!==n.tag)throw Error(o(309));var r=n.stateNode}if(!r)throw Error(o(147,e));var i=""+e;return null!==t&&null!==t.ref&&"function"===typeof t.ref&&t.ref._stringRef===i?t.ref:((t=function(e){var t=r.refs;t===ha&&(t=r.refs={}),null===e?delete t[i]:t[i]=e})._stringRef=i,t)}if("string"!==typeof e)throw Error(o(284));if(!n._owner)throw Error(o(290,e))}return e}function _a(e,t){if("textarea"!==e.type)throw Error(o(31,"[object Object]"===Object.prototype.toString.call(t)?"object with keys {"+Object.keys(t).join(", ")+"}":t))}function ka(e){function t(t,n){if(e){var r=t.lastEffect;null!==r?(r.nextEffect=n,t.lastEffect=n):t.firstEffect=t.lastEffect=n,n.nextEffect=null,n.flags=8}}function n(n,r){if(!e)return null;for(;null!==r;)t(n,r),r=r.sibling;return null}function r(e,t){for(e=new Map;null!==t;)null!==t.key?e.set(t.key,t):e.set(t.index,t),t=t.sibling;return e}function i(e,t){return(e=Vs(e,t)).index=0,e.sibling=null,e}function a(t,n,r){return t.index=r,e?null!==(r=t.alternate)?(r=r.index)<n?(t.flags=2,n):r:(t.flags=2,n):n}function l(t){return e&&null===t.alternate&&(t.flags=2),t}function s(e,t,n,r){return null===t||6!==t.tag?((t=qs(n,e.mode,r)).return=e,t):((t=i(t,n)).return=e,t)}function u(e,t,n,r){return null!==t&&t.elementType===n.type?((r=i(t,n.props)).ref=wa(e,t,n),r.return=e,r):((r=Bs(n.type,n.key,n.props,null,e.mode,r)).ref=wa(e,t,n),r.return=e,r)}function c(e,t,n,r){return null===t||4!==t.tag||t.stateNode.containerInfo!==n.containerInfo||t.stateNode.implementation!==n.implementation?((t=Gs(n,e.mode,r)).return=e,t):((t=i(t,n.children||[])).return=e,t)}function d(e,t,n,r,a){return null===t||7!==t.tag?((t=$s(n,e.mode,r,a)).return=e,t):((t=i(t,n)).return=e,t)}function f(e,t,n){if("string"===typeof t||"number"===typeof t)return(t=qs(""+t,e.mode,n)).return=e,t;if("object"===typeof t&&null!==t){switch(t.$$typeof){case k:return(n=Bs(t.type,t.key,t.props,null,e.mode,n)).ref=wa(e,null,t),n.return=e,n;case S:return(t=Gs(t,e.mode,n)).return=e,t}if(xa(t)||U(t))return(t=$s(t,e.mode,n,null)).return=e,t;_a(e,t)}return null}function h(e,t,n,r){var i=null!==t?t.key:null;if("string"===typeof n||"number"===typeof n)return null!==i?null:s(e,t,""+n,r);if("object"===typeof n&&null!==n){switch(n.$$typeof){case k:return n.key===i?n.type===M?d(e,t,n.props.children,r,i):u(e,t,n,r):null;case S:return n.key===i?c(e,t,n,r):null}if(xa(n)||U(n))return null!==i?null:d(e,t,n,r,null);_a(e,n)}return null}function p(e,t,n,r,i){if("string"===typeof r||"number"===typeof r)return s(t,e=e.get(n)||null,""+r,i);if("object"===typeof r&&null!==r){switch(r.$$typeof){case k:return e=e.get(null===r.key?n:r.key)||null,r.type===M?d(t,e,r.props.children,i,r.key):u(t,e,r,i);case S:return c(t,e=e.get(null===r.key?n:r.key)||null,r,i)}if(xa(r)||U(r))return d(t,e=e.get(n)||null,r,i,null);_a(t,r)}return null}function g(i,o,l,s){for(var u=null,c=null,d=o,g=o=0,m=null;null!==d&&g<l.length;g++){d.index>g?(m=d,d=null):m=d.sibling;var v=h(i,d,l[g],s);if(null===v){null===d&&(d=m);break}e&&d&&null===v.alternate&&t(i,d),o=a(v,o,g),null===c?u=v:c.sibling=v,c=v,d=m}if(g===l.length)return n(i,d),u;if(null===d){for(;g<l.length;g++)null!==(d=f(i,l[g],s))&&(o=a(d,o,g),null===c?u=d:c.sibling=d,c=d);return u}for(d=r(i,d);g<l.length;g++)null!==(m=p(d,i,g,l[g],s))&&(e&&null!==m.alternate&&d.delete(null===m.key?g:m.key),o=a(m,o,g),null===c?u=m:c.sibling=m,c=m);return e&&d.forEach((function(e){return t(i,e)})),u}function m(i,l,s,u){var c=U(s);if("function"!==typeof c)throw Error(o(150));if(null==(s=c.call(s)))throw Error(o(151));for(var d=c=null,g=l,m=l=0,v=null,y=s.next();null!==g&&!y.done;m++,y=s.next()){g.index>m?(v=g,g=null):v=g.sibling;var b=h(i,g,y.value,u);if(null===b){null===g&&(g=v);break}e&&g&&null===b.alternate&&t(i,g),l=a(b,l,m),null===d?c=b:d.sibling=b,d=b,g=v}if(y.done)return n(i,g),c;if(null===g){for(;!y.done;m++,y=s.next())null!==(y=f(i,y.value,u))&&(l=a(y,l,m),null===d?c=y:d.sibling=y,d=y);return c}for(g=r(i,g);!y.done;m++,y=s.next())null!==(y=p(g,i,m,y.value,u))&&(e&&null!==y.alternate&&g.delete(null===y.key?m:y.key),l=a(y,l,m),null===d?c=y:d.sibling=y,d=y);return e&&g.forEach((function(e){return t(i,e)})),c}return function(e,r,a,s){var u="object"===typeof a&&null!==a&&a.type===M&&null===a.key;u&&(a=a.props.children);var c="object"===typeof a&&null!==a;if(c)switch(a.$$typeof){case k:e:{for(c=a.key,u=r;null!==u;){if(u.key===c){switch(u.tag){case 7:if(a.type===M){n(e,u.sibling),(r=i(u,a.props.children)).return=e,e=r;break e}break;default:if(u.elementType===a.type){n(e,u.sibling),(r=i(u,a.props)).ref=wa(e,u,a),r.return=e,e=r;break e}}n(e,u);break}t(e,u),u=u.sibling}a.type===M?((r=$s(a.props.children,e.mode,s,a.key)).return=e,e=r):((s=Bs(a.type,a.key,a.props,null,e.mode,s)).ref=wa(e,r,a),s.return=e,e=s)}return l(e);case S:e:{for(u=a.key;null!==r;){if(r.key===u){if(4===r.tag&&r.stateNode.containerInfo===a.containerInfo&&r.stateNode.implementation===a.implementation){n(e,r.sibling),(r=i(r,a.children||[])).return=e,e=r;break e}n(e,r);break}t(e,r),r=r.sibling}(r=Gs(a,e.mode,s)).return=e,e=r}return l(e)}if("string"===typeof a||"number"===typeof a)return a=""+a,null!==r&&6===r.tag?(n(e,r.sibling),(r=i(r,a)).return=e,e=r):(n(e,r),(r=qs(a,e.mode,s)).return=e,e=r),l(e);if(xa(a))return g(e,r,a,s);if(U(a))return m(e,r,a,s);if(c&&_a(e,a),"undefined"===typeof a&&!u)switch(e.tag){case 1:case 22:case 0:case 11:case 15:throw Error(o(152,q(e.type)||"Component"))}return n(e,r)}}var Sa=ka(!0),Ma=ka(!1),Ca={},Ea=li(Ca),Oa=li(Ca),Pa=li(Ca);function Ta(e){if(e===Ca)throw Error(o(174));return e}function Da(e,t){switch(ui(Pa,t),ui(Oa,e),ui(Ea,Ca),e=t.nodeType){case 9:case 11:t=(t=t.documentElement)?t.namespaceURI:ge(null,"");break;default:t=ge(t=(e=8===e?t.parentNode:t).namespaceURI||null,e=e.tagName)}si(Ea),ui(Ea,t)}function Na(){si(Ea),si(Oa),si(Pa)}function Ra(e){Ta(Pa.current);var t=Ta(Ea.current),n=ge(t,e.type);t!==n&&(ui(Oa,e),ui(Ea,n))}function Aa(e){Oa.current===e&&(si(Ea),si(Oa))}var Ia=li(0);function La(e){for(var t=e;null!==t;){if(13===t.tag){var n=t.memoizedState;if(null!==n&&(null===(n=n.dehydrated)||"$?"===n.data||"$!"===n.data))return t}else if(19===t.tag&&void 0!==t.memoizedProps.revealOrder){if(0!==(64&t.flags))return t}else if(null!==t.child){t.child.return=t,t=t.child;continue}if(t===e)break;for(;null===t.sibling;){if(null===t.return||t.return===e)return null;t=t.return}t.sibling.return=t.return,t=t.sibling}return null}var ja=null,Fa=null,za=!1;function Wa(e,t){var n=Hs(5,null,null,0);n.elementType="DELETED",n.type="DELETED",n.stateNode=t,n.return=e,n.flags=8,null!==e.lastEffect?(e.lastEffect.nextEffect=n,e.lastEffect=n):e.firstEffect=e.lastEffect=n}function Ya(e,t){switch(e.tag){case 5:var n=e.type;return null!==(t=1!==t.nodeType||n.toLowerCase()!==t.nodeName.toLowerCase()?null:t)&&(e.stateNode=t,!0);case 6:return null!==(t=""===e.pendingProps||3!==t.nodeType?null:t)&&(e.stateNode=t,!0);case 13:default:return!1}}function Ha(e){if(za){var t=Fa;if(t){var n=t;if(!Ya(e,t)){if(!(t=$r(n.nextSibling))||!Ya(e,t))return e.flags=-1025&e.flags|2,za=!1,void(ja=e);Wa(ja,n)}ja=e,Fa=$r(t.firstChild)}else e.flags=-1025&e.flags|2,za=!1,ja=e}}function Ua(e){for(e=e.return;null!==e&&5!==e.tag&&3!==e.tag&&13!==e.tag;)e=e.return;ja=e}function Va(e){if(e!==ja)return!1;if(!za)return Ua(e),za=!0,!1;var t=e.type;if(5!==e.tag||"head"!==t&&"body"!==t&&!Hr(t,e.memoizedProps))for(t=Fa;t;)Wa(e,t),t=$r(t.nextSibling);if(Ua(e),13===e.tag){if(!(e=null!==(e=e.memoizedState)?e.dehydrated:null))throw Error(o(317));e:{for(e=e.nextSibling,t=0;e;){if(8===e.nodeType){var n=e.data;if("/$"===n){if(0===t){Fa=$r(e.nextSibling);break e}t--}else"$"!==n&&"$!"!==n&&"$?"!==n||t++}e=e.nextSibling}Fa=null}}else Fa=ja?$r(e.stateNode.nextSibling):null;return!0}function Ba(){Fa=ja=null,za=!1}var $a=[];function Xa(){for(var e=0;e<$a.length;e++)$a[e]._workInProgressVersionPrimary=null;$a.length=0}var qa=_.ReactCurrentDispatcher,Ga=_.ReactCurrentBatchConfig,Ka=0,Qa=null,Za=null,Ja=null,eo=!1,to=!1;function no(){throw Error(o(321))}function ro(e,t){if(null===t)return!1;for(var n=0;n<t.length&&n<e.length;n++)if(!sr(e[n],t[n]))return!1;return!0}function io(e,t,n,r,i,a){if(Ka=a,Qa=t,t.memoizedState=null,t.updateQueue=null,t.lanes=0,qa.current=null===e||null===e.memoizedState?Do:No,e=n(r,i),to){a=0;do{if(to=!1,!(25>a))throw Error(o(301));a+=1,Ja=Za=null,t.updateQueue=null,qa.current=Ro,e=n(r,i)}while(to)}if(qa.current=To,t=null!==Za&&null!==Za.next,Ka=0,Ja=Za=Qa=null,eo=!1,t)throw Error(o(300));return e}function ao(){var e={memoizedState:null,baseState:null,baseQueue:null,queue:null,next:null};return null===Ja?Qa.memoizedState=Ja=e:Ja=Ja.next=e,Ja}function oo(){if(null===Za){var e=Qa.alternate;e=null!==e?e.memoizedState:null}else e=Za.next;var t=null===Ja?Qa.memoizedState:Ja.next;if(null!==t)Ja=t,Za=e;else{if(null===e)throw Error(o(310));e={memoizedState:(Za=e).memoizedState,baseState:Za.baseState,baseQueue:Za.baseQueue,queue:Za.queue,next:null},null===Ja?Qa.memoizedState=Ja=e:Ja=Ja.next=e}return Ja}function lo(e,t){return"function"===typeof t?t(e):t}function so(e){var t=oo(),n=t.queue;if(null===n)throw Error(o(311));n.lastRenderedReducer=e;var r=Za,i=r.baseQueue,a=n.pending;if(null!==a){if(null!==i){var l=i.next;i.next=a.next,a.next=l}r.baseQueue=i=a,n.pending=null}if(null!==i){i=i.next,r=r.baseState;var s=l=a=null,u=i;do{var c=u.lane;if((Ka&c)===c)null!==s&&(s=s.next={lane:0,action:u.action,eagerReducer:u.eagerReducer,eagerState:u.eagerState,next:null}),r=u.eagerReducer===e?u.eagerState:e(r,u.action);else{var d={lane:c,action:u.action,eagerReducer:u.eagerReducer,eagerState:u.eagerState,next:null};null===s?(l=s=d,a=r):s=s.next=d,Qa.lanes|=c,zl|=c}u=u.next}while(null!==u&&u!==i);null===s?a=r:s.next=l,sr(r,t.memoizedState)||(Io=!0),t.memoizedState=r,t.baseState=a,t.baseQueue=s,n.lastRenderedState=r}return[t.memoizedState,n.dispatch]}function uo(e){var t=oo(),n=t.queue;if(null===n)throw Error(o(311));n.lastRenderedReducer=e;var r=n.dispatch,i=n.pending,a=t.memoizedState;if(null!==i){n.pending=null;var l=i=i.next;do{a=e(a,l.action),l=l.next}while(l!==i);sr(a,t.memoizedState)||(Io=!0),t.memoizedState=a,null===t.baseQueue&&(t.baseState=a),n.lastRenderedState=a}return[a,r]}function co(e,t,n){var r=t._getVersion;r=r(t._source);var i=t._workInProgressVersionPrimary;if(null!==i?e=i===r:(e=e.mutableReadLanes,(e=(Ka&e)===e)&&(t._workInProgressVersionPrimary=r,$a.push(t))),e)return n(t._source);throw $a.push(t),Error(o(350))}function fo(e,t,n,r){var i=Dl;if(null===i)throw Error(o(349));var a=t._getVersion,l=a(t._source),s=qa.current,u=s.useState((function(){return co(i,t,n)})),c=u[1],d=u[0];u=Ja;var f=e.memoizedState,h=f.refs,p=h.getSnapshot,g=f.source;f=f.subscribe;var m=Qa;return e.memoizedState={refs:h,source:t,subscribe:r},s.useEffect((function(){h.getSnapshot=n,h.setSnapshot=c;var e=a(t._source);if(!sr(l,e)){e=n(t._source),sr(d,e)||(c(e),e=ds(m),i.mutableReadLanes|=e&i.pendingLanes),e=i.mutableReadLanes,i.entangledLanes|=e;for(var r=i.entanglements,o=e;0<o;){var s=31-Bt(o),u=1<<s;r[s]|=e,o&=~u}}}),[n,t,r]),s.useEffect((function(){return r(t._source,(function(){var e=h.getSnapshot,n=h.setSnapshot;try{n(e(t._source));var r=ds(m);i.mutableReadLanes|=r&i.pendingLanes}catch(a){n((function(){throw a}))}}))}),[t,r]),sr(p,n)&&sr(g,t)&&sr(f,r)||((e={pending:null,dispatch:null,lastRenderedReducer:lo,lastRenderedState:d}).dispatch=c=Po.bind(null,Qa,e),u.queue=e,u.baseQueue=null,d=co(i,t,n),u.memoizedState=u.baseState=d),d}function ho(e,t,n){return fo(oo(),e,t,n)}function po(e){var t=ao();return"function"===typeof e&&(e=e()),t.memoizedState=t.baseState=e,e=(e=t.queue={pending:null,dispatch:null,lastRenderedReducer:lo,lastRenderedState:e}).dispatch=Po.bind(null,Qa,e),[t.memoizedState,e]}function go(e,t,n,r){return e={tag:e,create:t,destroy:n,deps:r,next:null},null===(t=Qa.updateQueue)?(t={lastEffect:null},Qa.updateQueue=t,t.lastEffect=e.next=e):null===(n=t.lastEffect)?t.lastEffect=e.next=e:(r=n.next,n.next=e,e.next=r,t.lastEffect=e),e}function mo(e){return e={current:e},ao().memoizedState=e}function vo(){return oo().memoizedState}function yo(e,t,n,r){var i=ao();Qa.flags|=e,i.memoizedState=go(1|t,n,void 0,void 0===r?null:r)}function bo(e,t,n,r){var i=oo();r=void 0===r?null:r;var a=void 0;if(null!==Za){var o=Za.memoizedState;if(a=o.destroy,null!==r&&ro(r,o.deps))return void go(t,n,a,r)}Qa.flags|=e,i.memoizedState=go(1|t,n,a,r)}function xo(e,t){return yo(516,4,e,t)}function wo(e,t){return bo(516,4,e,t)}function _o(e,t){return bo(4,2,e,t)}function ko(e,t){return"function"===typeof t?(e=e(),t(e),function(){t(null)}):null!==t&&void 0!==t?(e=e(),t.current=e,function(){t.current=null}):void 0}function So(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,bo(4,2,ko.bind(null,t,e),n)}function Mo(){}function Co(e,t){var n=oo();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ro(t,r[1])?r[0]:(n.memoizedState=[e,t],e)}function Eo(e,t){var n=oo();t=void 0===t?null:t;var r=n.memoizedState;return null!==r&&null!==t&&ro(t,r[1])?r[0]:(e=e(),n.memoizedState=[e,t],e)}function Oo(e,t){var n=Hi();Vi(98>n?98:n,(function(){e(!0)})),Vi(97<n?97:n,(function(){var n=Ga.transition;Ga.transition=1;try{e(!1),t()}finally{Ga.transition=n}}))}function Po(e,t,n){var r=cs(),i=ds(e),a={lane:i,action:n,eagerReducer:null,eagerState:null,next:null},o=t.pending;if(null===o?a.next=a:(a.next=o.next,o.next=a),t.pending=a,o=e.alternate,e===Qa||null!==o&&o===Qa)to=eo=!0;else{if(0===e.lanes&&(null===o||0===o.lanes)&&null!==(o=t.lastRenderedReducer))try{var l=t.lastRenderedState,s=o(l,n);if(a.eagerReducer=o,a.eagerState=s,sr(s,l))return}catch(u){}fs(e,i,r)}}var To={readContext:ia,useCallback:no,useContext:no,useEffect:no,useImperativeHandle:no,useLayoutEffect:no,useMemo:no,useReducer:no,useRef:no,useState:no,useDebugValue:no,useDeferredValue:no,useTransition:no,useMutableSource:no,useOpaqueIdentifier:no,unstable_isNewReconciler:!1},Do={readContext:ia,useCallback:function(e,t){return ao().memoizedState=[e,void 0===t?null:t],e},useContext:ia,useEffect:xo,useImperativeHandle:function(e,t,n){return n=null!==n&&void 0!==n?n.concat([e]):null,yo(4,2,ko.bind(null,t,e),n)},useLayoutEffect:function(e,t){return yo(4,2,e,t)},useMemo:function(e,t){var n=ao();return t=void 0===t?null:t,e=e(),n.memoizedState=[e,t],e},useReducer:function(e,t,n){var r=ao();return t=void 0!==n?n(t):t,r.memoizedState=r.baseState=t,e=(e=r.queue={pending:null,dispatch:null,lastRenderedReducer:e,lastRenderedState:t}).dispatch=Po.bind(null,Qa,e),[r.memoizedState,e]},useRef:mo,useState:po,useDebugValue:Mo,useDeferredValue:function(e){var t=po(e),n=t[0],r=t[1];return xo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=po(!1),t=e[0];return mo(e=Oo.bind(null,e[1])),[e,t]},useMutableSource:function(e,t,n){var r=ao();return r.memoizedState={refs:{getSnapshot:t,setSnapshot:null},source:e,subscribe:n},fo(r,e,t,n)},useOpaqueIdentifier:function(){if(za){var e=!1,t=function(e){return{$$typeof:L,toString:e,valueOf:e}}((function(){throw e||(e=!0,n("r:"+(qr++).toString(36))),Error(o(355))})),n=po(t)[1];return 0===(2&Qa.mode)&&(Qa.flags|=516,go(5,(function(){n("r:"+(qr++).toString(36))}),void 0,null)),t}return po(t="r:"+(qr++).toString(36)),t},unstable_isNewReconciler:!1},No={readContext:ia,useCallback:Co,useContext:ia,useEffect:wo,useImperativeHandle:So,useLayoutEffect:_o,useMemo:Eo,useReducer:so,useRef:vo,useState:function(){return so(lo)},useDebugValue:Mo,useDeferredValue:function(e){var t=so(lo),n=t[0],r=t[1];return wo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=so(lo)[0];return[vo().current,e]},useMutableSource:ho,useOpaqueIdentifier:function(){return so(lo)[0]},unstable_isNewReconciler:!1},Ro={readContext:ia,useCallback:Co,useContext:ia,useEffect:wo,useImperativeHandle:So,useLayoutEffect:_o,useMemo:Eo,useReducer:uo,useRef:vo,useState:function(){return uo(lo)},useDebugValue:Mo,useDeferredValue:function(e){var t=uo(lo),n=t[0],r=t[1];return wo((function(){var t=Ga.transition;Ga.transition=1;try{r(e)}finally{Ga.transition=t}}),[e]),n},useTransition:function(){var e=uo(lo)[0];return[vo().current,e]},useMutableSource:ho,useOpaqueIdentifier:function(){return uo(lo)[0]},unstable_isNewReconciler:!1},Ao=_.ReactCurrentOwner,Io=!1;function Lo(e,t,n,r){t.child=null===e?Ma(t,null,n,r):Sa(t,e.child,n,r)}function jo(e,t,n,r,i){n=n.render;var a=t.ref;return ra(t,i),r=io(e,t,n,r,a,i),null===e||Io?(t.flags|=1,Lo(e,t,r,i),t.child):(t.updateQueue=e.updateQueue,t.flags&=-517,e.lanes&=~i,rl(e,t,i))}function Fo(e,t,n,r,i,a){if(null===e){var o=n.type;return"function"!==typeof o||Us(o)||void 0!==o.defaultProps||null!==n.compare||void 0!==n.defaultProps?((e=Bs(n.type,null,r,t,t.mode,a)).ref=t.ref,e.return=t,t.child=e):(t.tag=15,t.type=o,zo(e,t,o,r,i,a))}return o=e.child,0===(i&a)&&(i=o.memoizedProps,(n=null!==(n=n.compare)?n:cr)(i,r)&&e.ref===t.ref)?rl(e,t,a):(t.flags|=1,(e=Vs(o,r)).ref=t.ref,e.return=t,t.child=e)}function zo(e,t,n,r,i,a){if(null!==e&&cr(e.memoizedProps,r)&&e.ref===t.ref){if(Io=!1,0===(a&i))return t.lanes=e.lanes,rl(e,t,a);0!==(16384&e.flags)&&(Io=!0)}return Ho(e,t,n,r,a)}function Wo(e,t,n){var r=t.pendingProps,i=r.children,a=null!==e?e.memoizedState:null;if("hidden"===r.mode||"unstable-defer-without-hiding"===r.mode)if(0===(4&t.mode))t.memoizedState={baseLanes:0},xs(t,n);else{if(0===(1073741824&n))return e=null!==a?a.baseLanes|n:n,t.lanes=t.childLanes=1073741824,t.memoizedState={baseLanes:e},xs(t,e),null;t.memoizedState={baseLanes:0},xs(t,null!==a?a.baseLanes:n)}else null!==a?(r=a.baseLanes|n,t.memoizedState=null):r=n,xs(t,r);return Lo(e,t,i,n),t.child}function Yo(e,t){var n=t.ref;(null===e&&null!==n||null!==e&&e.ref!==n)&&(t.flags|=128)}function Ho(e,t,n,r,i){var a=gi(n)?hi:di.current;return a=pi(t,a),ra(t,i),n=io(e,t,n,r,a,i),null===e||Io?(t.flags|=1,Lo(e,t,n,i),t.child):(t.updateQueue=e.updateQueue,t.flags&=-517,e.lanes&=~i,rl(e,t,i))}function Uo(e,t,n,r,i){if(gi(n)){var a=!0;bi(t)}else a=!1;if(ra(t,i),null===t.stateNode)null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),va(t,n,r),ba(t,n,r,i),r=!0;else if(null===e){var o=t.stateNode,l=t.memoizedProps;o.props=l;var s=o.context,u=n.contextType;"object"===typeof u&&null!==u?u=ia(u):u=pi(t,u=gi(n)?hi:di.current);var c=n.getDerivedStateFromProps,d="function"===typeof c||"function"===typeof o.getSnapshotBeforeUpdate;d||"function"!==typeof o.UNSAFE_componentWillReceiveProps&&"function"!==typeof o.componentWillReceiveProps||(l!==r||s!==u)&&ya(t,o,r,u),aa=!1;var f=t.memoizedState;o.state=f,da(t,r,o,i),s=t.memoizedState,l!==r||f!==s||fi.current||aa?("function"===typeof c&&(pa(t,n,c,r),s=t.memoizedState),(l=aa||ma(t,n,l,r,f,s,u))?(d||"function"!==typeof o.UNSAFE_componentWillMount&&"function"!==typeof o.componentWillMount||("function"===typeof o.componentWillMount&&o.componentWillMount(),"function"===typeof o.UNSAFE_componentWillMount&&o.UNSAFE_componentWillMount()),"function"===typeof o.componentDidMount&&(t.flags|=4)):("function"===typeof o.componentDidMount&&(t.flags|=4),t.memoizedProps=r,t.memoizedState=s),o.props=r,o.state=s,o.context=u,r=l):("function"===typeof o.componentDidMount&&(t.flags|=4),r=!1)}else{o=t.stateNode,la(e,t),l=t.memoizedProps,u=t.type===t.elementType?l:Gi(t.type,l),o.props=u,d=t.pendingProps,f=o.context,"object"===typeof(s=n.contextType)&&null!==s?s=ia(s):s=pi(t,s=gi(n)?hi:di.current);var h=n.getDerivedStateFromProps;(c="function"===typeof h||"function"===typeof o.getSnapshotBeforeUpdate)||"function"!==typeof o.UNSAFE_componentWillReceiveProps&&"function"!==typeof o.componentWillReceiveProps||(l!==d||f!==s)&&ya(t,o,r,s),aa=!1,f=t.memoizedState,o.state=f,da(t,r,o,i);var p=t.memoizedState;l!==d||f!==p||fi.current||aa?("function"===typeof h&&(pa(t,n,h,r),p=t.memoizedState),(u=aa||ma(t,n,u,r,f,p,s))?(c||"function"!==typeof o.UNSAFE_componentWillUpdate&&"function"!==typeof o.componentWillUpdate||("function"===typeof o.componentWillUpdate&&o.componentWillUpdate(r,p,s),"function"===typeof o.UNSAFE_componentWillUpdate&&o.UNSAFE_componentWillUpdate(r,p,s)),"function"===typeof o.componentDidUpdate&&(t.flags|=4),"function"===typeof o.getSnapshotBeforeUpdate&&(t.flags|=256)):("function"!==typeof o.componentDidUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=4),"function"!==typeof o.getSnapshotBeforeUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=256),t.memoizedProps=r,t.memoizedState=p),o.props=r,o.state=p,o.context=s,r=u):("function"!==typeof o.componentDidUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=4),"function"!==typeof o.getSnapshotBeforeUpdate||l===e.memoizedProps&&f===e.memoizedState||(t.flags|=256),r=!1)}return Vo(e,t,n,r,a,i)}function Vo(e,t,n,r,i,a){Yo(e,t);var o=0!==(64&t.flags);if(!r&&!o)return i&&xi(t,n,!1),rl(e,t,a);r=t.stateNode,Ao.current=t;var l=o&&"function"!==typeof n.getDerivedStateFromError?null:r.render();return t.flags|=1,null!==e&&o?(t.child=Sa(t,e.child,null,a),t.child=Sa(t,null,l,a)):Lo(e,t,l,a),t.memoizedState=r.state,i&&xi(t,n,!0),t.child}function Bo(e){var t=e.stateNode;t.pendingContext?vi(0,t.pendingContext,t.pendingContext!==t.context):t.context&&vi(0,t.context,!1),Da(e,t.containerInfo)}var $o,Xo,qo,Go={dehydrated:null,retryLane:0};function Ko(e,t,n){var r,i=t.pendingProps,a=Ia.current,o=!1;return(r=0!==(64&t.flags))||(r=(null===e||null!==e.memoizedState)&&0!==(2&a)),r?(o=!0,t.flags&=-65):null!==e&&null===e.memoizedState||void 0===i.fallback||!0===i.unstable_avoidThisFallback||(a|=1),ui(Ia,1&a),null===e?(void 0!==i.fallback&&Ha(t),e=i.children,a=i.fallback,o?(e=Qo(t,e,a,n),t.child.memoizedState={baseLanes:n},t.memoizedState=Go,e):"number"===typeof i.unstable_expectedLoadTime?(e=Qo(t,e,a,n),t.child.memoizedState={baseLanes:n},t.memoizedState=Go,t.lanes=33554432,e):((n=Xs({mode:"visible",children:e},t.mode,n,null)).return=t,t.child=n)):(e.memoizedState,o?(i=Jo(e,t,i.children,i.fallback,n),o=t.child,a=e.child.memoizedState,o.memoizedState=null===a?{baseLanes:n}:{baseLanes:a.baseLanes|n},o.childLanes=e.childLanes&~n,t.memoizedState=Go,i):(n=Zo(e,t,i.children,n),t.memoizedState=null,n))}function Qo(e,t,n,r){var i=e.mode,a=e.child;return t={mode:"hidden",children:t},0===(2&i)&&null!==a?(a.childLanes=0,a.pendingProps=t):a=Xs(t,i,0,null),n=$s(n,i,r,null),a.return=e,n.return=e,a.sibling=n,e.child=a,n}function Zo(e,t,n,r){var i=e.child;return e=i.sibling,n=Vs(i,{mode:"visible",children:n}),0===(2&t.mode)&&(n.lanes=r),n.return=t,n.sibling=null,null!==e&&(e.nextEffect=null,e.flags=8,t.firstEffect=t.lastEffect=e),t.child=n}function Jo(e,t,n,r,i){var a=t.mode,o=e.child;e=o.sibling;var l={mode:"hidden",children:n};return 0===(2&a)&&t.child!==o?((n=t.child).childLanes=0,n.pendingProps=l,null!==(o=n.lastEffect)?(t.firstEffect=n.firstEffect,t.lastEffect=o,o.nextEffect=null):t.firstEffect=t.lastEffect=null):n=Vs(o,l),null!==e?r=Vs(e,r):(r=$s(r,a,i,null)).flags|=2,r.return=t,n.return=t,n.sibling=r,t.child=n,r}function el(e,t){e.lanes|=t;var n=e.alternate;null!==n&&(n.lanes|=t),na(e.return,t)}function tl(e,t,n,r,i,a){var o=e.memoizedState;null===o?e.memoizedState={isBackwards:t,rendering:null,renderingStartTime:0,last:r,tail:n,tailMode:i,lastEffect:a}:(o.isBackwards=t,o.rendering=null,o.renderingStartTime=0,o.last=r,o.tail=n,o.tailMode=i,o.lastEffect=a)}function nl(e,t,n){var r=t.pendingProps,i=r.revealOrder,a=r.tail;if(Lo(e,t,r.children,n),0!==(2&(r=Ia.current)))r=1&r|2,t.flags|=64;else{if(null!==e&&0!==(64&e.flags))e:for(e=t.child;null!==e;){if(13===e.tag)null!==e.memoizedState&&el(e,n);else if(19===e.tag)el(e,n);else if(null!==e.child){e.child.return=e,e=e.child;continue}if(e===t)break e;for(;null===e.sibling;){if(null===e.return||e.return===t)break e;e=e.return}e.sibling.return=e.return,e=e.sibling}r&=1}if(ui(Ia,r),0===(2&t.mode))t.memoizedState=null;else switch(i){case"forwards":for(n=t.child,i=null;null!==n;)null!==(e=n.alternate)&&null===La(e)&&(i=n),n=n.sibling;null===(n=i)?(i=t.child,t.child=null):(i=n.sibling,n.sibling=null),tl(t,!1,i,n,a,t.lastEffect);break;case"backwards":for(n=null,i=t.child,t.child=null;null!==i;){if(null!==(e=i.alternate)&&null===La(e)){t.child=i;break}e=i.sibling,i.sibling=n,n=i,i=e}tl(t,!0,n,null,a,t.lastEffect);break;case"together":tl(t,!1,null,null,void 0,t.lastEffect);break;default:t.memoizedState=null}return t.child}function rl(e,t,n){if(null!==e&&(t.dependencies=e.dependencies),zl|=t.lanes,0!==(n&t.childLanes)){if(null!==e&&t.child!==e.child)throw Error(o(153));if(null!==t.child){for(n=Vs(e=t.child,e.pendingProps),t.child=n,n.return=t;null!==e.sibling;)e=e.sibling,(n=n.sibling=Vs(e,e.pendingProps)).return=t;n.sibling=null}return t.child}return null}function il(e,t){if(!za)switch(e.tailMode){case"hidden":t=e.tail;for(var n=null;null!==t;)null!==t.alternate&&(n=t),t=t.sibling;null===n?e.tail=null:n.sibling=null;break;case"collapsed":n=e.tail;for(var r=null;null!==n;)null!==n.alternate&&(r=n),n=n.sibling;null===r?t||null===e.tail?e.tail=null:e.tail.sibling=null:r.sibling=null}}function al(e,t,n){var r=t.pendingProps;switch(t.tag){case 2:case 16:case 15:case 0:case 11:case 7:case 8:case 12:case 9:case 14:return null;case 1:return gi(t.type)&&mi(),null;case 3:return Na(),si(fi),si(di),Xa(),(r=t.stateNode).pendingContext&&(r.context=r.pendingContext,r.pendingContext=null),null!==e&&null!==e.child||(Va(t)?t.flags|=4:r.hydrate||(t.flags|=256)),null;case 5:Aa(t);var a=Ta(Pa.current);if(n=t.type,null!==e&&null!=t.stateNode)Xo(e,t,n,r),e.ref!==t.ref&&(t.flags|=128);else{if(!r){if(null===t.stateNode)throw Error(o(166));return null}if(e=Ta(Ea.current),Va(t)){r=t.stateNode,n=t.type;var l=t.memoizedProps;switch(r[Kr]=t,r[Qr]=l,n){case"dialog":Or("cancel",r),Or("close",r);break;case"iframe":case"object":case"embed":Or("load",r);break;case"video":case"audio":for(e=0;e<Sr.length;e++)Or(Sr[e],r);break;case"source":Or("error",r);break;case"img":case"image":case"link":Or("error",r),Or("load",r);break;case"details":Or("toggle",r);break;case"input":te(r,l),Or("invalid",r);break;case"select":r._wrapperState={wasMultiple:!!l.multiple},Or("invalid",r);break;case"textarea":ue(r,l),Or("invalid",r)}for(var u in Me(n,l),e=null,l)l.hasOwnProperty(u)&&(a=l[u],"children"===u?"string"===typeof a?r.textContent!==a&&(e=["children",a]):"number"===typeof a&&r.textContent!==""+a&&(e=["children",""+a]):s.hasOwnProperty(u)&&null!=a&&"onScroll"===u&&Or("scroll",r));switch(n){case"input":Q(r),ie(r,l,!0);break;case"textarea":Q(r),de(r);break;case"select":case"option":break;default:"function"===typeof l.onClick&&(r.onclick=Fr)}r=e,t.updateQueue=r,null!==r&&(t.flags|=4)}else{switch(u=9===a.nodeType?a:a.ownerDocument,e===fe&&(e=pe(n)),e===fe?"script"===n?((e=u.createElement("div")).innerHTML="<script><\/script>",e=e.removeChild(e.firstChild)):"string"===typeof r.is?e=u.createElement(n,{is:r.is}):(e=u.createElement(n),"select"===n&&(u=e,r.multiple?u.multiple=!0:r.size&&(u.size=r.size))):e=u.createElementNS(e,n),e[Kr]=t,e[Qr]=r,$o(e,t),t.stateNode=e,u=Ce(n,r),n){case"dialog":Or("cancel",e),Or("close",e),a=r;break;case"iframe":case"object":case"embed":Or("load",e),a=r;break;case"video":case"audio":for(a=0;a<Sr.length;a++)Or(Sr[a],e);a=r;break;case"source":Or("error",e),a=r;break;case"img":case"image":case"link":Or("error",e),Or("load",e),a=r;break;case"details":Or("toggle",e),a=r;break;case"input":te(e,r),a=ee(e,r),Or("invalid",e);break;case"option":a=oe(e,r);break;case"select":e._wrapperState={wasMultiple:!!r.multiple},a=i({},r,{value:void 0}),Or("invalid",e);break;case"textarea":ue(e,r),a=se(e,r),Or("invalid",e);break;default:a=r}Me(n,a);var c=a;for(l in c)if(c.hasOwnProperty(l)){var d=c[l];"style"===l?ke(e,d):"dangerouslySetInnerHTML"===l?null!=(d=d?d.__html:void 0)&&ye(e,d):"children"===l?"string"===typeof d?("textarea"!==n||""!==d)&&be(e,d):"number"===typeof d&&be(e,""+d):"suppressContentEditableWarning"!==l&&"suppressHydrationWarning"!==l&&"autoFocus"!==l&&(s.hasOwnProperty(l)?null!=d&&"onScroll"===l&&Or("scroll",e):null!=d&&w(e,l,d,u))}switch(n){case"input":Q(e),ie(e,r,!1);break;case"textarea":Q(e),de(e);break;case"option":null!=r.value&&e.setAttribute("value",""+G(r.value));break;case"select":e.multiple=!!r.multiple,null!=(l=r.value)?le(e,!!r.multiple,l,!1):null!=r.defaultValue&&le(e,!!r.multiple,r.defaultValue,!0);break;default:"function"===typeof a.onClick&&(e.onclick=Fr)}Yr(n,r)&&(t.flags|=4)}null!==t.ref&&(t.flags|=128)}return null;case 6:if(e&&null!=t.stateNode)qo(0,t,e.memoizedProps,r);else{if("string"!==typeof r&&null===t.stateNode)throw Error(o(166));n=Ta(Pa.current),Ta(Ea.current),Va(t)?(r=t.stateNode,n=t.memoizedProps,r[Kr]=t,r.nodeValue!==n&&(t.flags|=4)):((r=(9===n.nodeType?n:n.ownerDocument).createTextNode(r))[Kr]=t,t.stateNode=r)}return null;case 13:return si(Ia),r=t.memoizedState,0!==(64&t.flags)?(t.lanes=n,t):(r=null!==r,n=!1,null===e?void 0!==t.memoizedProps.fallback&&Va(t):n=null!==e.memoizedState,r&&!n&&0!==(2&t.mode)&&(null===e&&!0!==t.memoizedProps.unstable_avoidThisFallback||0!==(1&Ia.current)?0===Ll&&(Ll=3):(0!==Ll&&3!==Ll||(Ll=4),null===Dl||0===(134217727&zl)&&0===(134217727&Wl)||ms(Dl,Rl))),(r||n)&&(t.flags|=4),null);case 4:return Na(),null===e&&Tr(t.stateNode.containerInfo),null;case 10:return ta(t),null;case 17:return gi(t.type)&&mi(),null;case 19:if(si(Ia),null===(r=t.memoizedState))return null;if(l=0!==(64&t.flags),null===(u=r.rendering))if(l)il(r,!1);else{if(0!==Ll||null!==e&&0!==(64&e.flags))for(e=t.child;null!==e;){if(null!==(u=La(e))){for(t.flags|=64,il(r,!1),null!==(l=u.updateQueue)&&(t.updateQueue=l,t.flags|=4),null===r.lastEffect&&(t.firstEffect=null),t.lastEffect=r.lastEffect,r=n,n=t.child;null!==n;)e=r,(l=n).flags&=2,l.nextEffect=null,l.firstEffect=null,l.lastEffect=null,null===(u=l.alternate)?(l.childLanes=0,l.lanes=e,l.child=null,l.memoizedProps=null,l.memoizedState=null,l.updateQueue=null,l.dependencies=null,l.stateNode=null):(l.childLanes=u.childLanes,l.lanes=u.lanes,l.child=u.child,l.memoizedProps=u.memoizedProps,l.memoizedState=u.memoizedState,l.updateQueue=u.updateQueue,l.type=u.type,e=u.dependencies,l.dependencies=null===e?null:{lanes:e.lanes,firstContext:e.firstContext}),n=n.sibling;return ui(Ia,1&Ia.current|2),t.child}e=e.sibling}null!==r.tail&&Yi()>Vl&&(t.flags|=64,l=!0,il(r,!1),t.lanes=33554432)}else{if(!l)if(null!==(e=La(u))){if(t.flags|=64,l=!0,null!==(n=e.updateQueue)&&(t.updateQueue=n,t.flags|=4),il(r,!0),null===r.tail&&"hidden"===r.tailMode&&!u.alternate&&!za)return null!==(t=t.lastEffect=r.lastEffect)&&(t.nextEffect=null),null}else 2*Yi()-r.renderingStartTime>Vl&&1073741824!==n&&(t.flags|=64,l=!0,il(r,!1),t.lanes=33554432);r.isBackwards?(u.sibling=t.child,t.child=u):(null!==(n=r.last)?n.sibling=u:t.child=u,r.last=u)}return null!==r.tail?(n=r.tail,r.rendering=n,r.tail=n.sibling,r.lastEffect=t.lastEffect,r.renderingStartTime=Yi(),n.sibling=null,t=Ia.current,ui(Ia,l?1&t|2:1&t),n):null;case 23:case 24:return ws(),null!==e&&null!==e.memoizedState!==(null!==t.memoizedState)&&"unstable-defer-without-hiding"!==r.mode&&(t.flags|=4),null}throw Error(o(156,t.tag))}function ol(e){switch(e.tag){case 1:gi(e.type)&&mi();var t=e.flags;return 4096&t?(e.flags=-4097&t|64,e):null;case 3:if(Na(),si(fi),si(di),Xa(),0!==(64&(t=e.flags)))throw Error(o(285));return e.flags=-4097&t|64,e;case 5:return Aa(e),null;case 13:return si(Ia),4096&(t=e.flags)?(e.flags=-4097&t|64,e):null;case 19:return si(Ia),null;case 4:return Na(),null;case 10:return ta(e),null;case 23:case 24:return ws(),null;default:return null}}function ll(e,t){try{var n="",r=t;do{n+=X(r),r=r.return}while(r);var i=n}catch(a){i="\nError generating stack: "+a.message+"\n"+a.stack}return{value:e,source:t,stack:i}}function sl(e,t){try{console.error(t.value)}catch(n){setTimeout((function(){throw n}))}}$o=function(e,t){for(var n=t.child;null!==n;){if(5===n.tag||6===n.tag)e.appendChild(n.stateNode);else if(4!==n.tag&&null!==n.child){n.child.return=n,n=n.child;continue}if(n===t)break;for(;null===n.sibling;){if(null===n.return||n.return===t)return;n=n.return}n.sibling.return=n.return,n=n.sibling}},Xo=function(e,t,n,r){var a=e.memoizedProps;if(a!==r){e=t.stateNode,Ta(Ea.current);var o,l=null;switch(n){case"input":a=ee(e,a),r=ee(e,r),l=[];break;case"option":a=oe(e,a),r=oe(e,r),l=[];break;case"select":a=i({},a,{value:void 0}),r=i({},r,{value:void 0}),l=[];break;case"textarea":a=se(e,a),r=se(e,r),l=[];break;default:"function"!==typeof a.onClick&&"function"===typeof r.onClick&&(e.onclick=Fr)}for(d in Me(n,r),n=null,a)if(!r.hasOwnProperty(d)&&a.hasOwnProperty(d)&&null!=a[d])if("style"===d){var u=a[d];for(o in u)u.hasOwnProperty(o)&&(n||(n={}),n[o]="")}else"dangerouslySetInnerHTML"!==d&&"children"!==d&&"suppressContentEditableWarning"!==d&&"suppressHydrationWarning"!==d&&"autoFocus"!==d&&(s.hasOwnProperty(d)?l||(l=[]):(l=l||[]).push(d,null));for(d in r){var c=r[d];if(u=null!=a?a[d]:void 0,r.hasOwnProperty(d)&&c!==u&&(null!=c||null!=u))if("style"===d)if(u){for(o in u)!u.hasOwnProperty(o)||c&&c.hasOwnProperty(o)||(n||(n={}),n[o]="");for(o in c)c.hasOwnProperty(o)&&u[o]!==c[o]&&(n||(n={}),n[o]=c[o])}else n||(l||(l=[]),l.push(d,n)),n=c;else"dangerouslySetInnerHTML"===d?(c=c?c.__html:void 0,u=u?u.__html:void 0,null!=c&&u!==c&&(l=l||[]).push(d,c)):"children"===d?"string"!==typeof c&&"number"!==typeof c||(l=l||[]).push(d,""+c):"suppressContentEditableWarning"!==d&&"suppressHydrationWarning"!==d&&(s.hasOwnProperty(d)?(null!=c&&"onScroll"===d&&Or("scroll",e),l||u===c||(l=[])):"object"===typeof c&&null!==c&&c.$$typeof===L?c.toString():(l=l||[]).push(d,c))}n&&(l=l||[]).push("style",n);var d=l;(t.updateQueue=d)&&(t.flags|=4)}},qo=function(e,t,n,r){n!==r&&(t.flags|=4)};var ul="function"===typeof WeakMap?WeakMap:Map;function cl(e,t,n){(n=sa(-1,n)).tag=3,n.payload={element:null};var r=t.value;return n.callback=function(){ql||(ql=!0,Gl=r),sl(0,t)},n}function dl(e,t,n){(n=sa(-1,n)).tag=3;var r=e.type.getDerivedStateFromError;if("function"===typeof r){var i=t.value;n.payload=function(){return sl(0,t),r(i)}}var a=e.stateNode;return null!==a&&"function"===typeof a.componentDidCatch&&(n.callback=function(){"function"!==typeof r&&(null===Kl?Kl=new Set([this]):Kl.add(this),sl(0,t));var e=t.stack;this.componentDidCatch(t.value,{componentStack:null!==e?e:""})}),n}var fl="function"===typeof WeakSet?WeakSet:Set;function hl(e){var t=e.ref;if(null!==t)if("function"===typeof t)try{t(null)}catch(n){Fs(e,n)}else t.current=null}function pl(e,t){switch(t.tag){case 0:case 11:case 15:case 22:return;case 1:if(256&t.flags&&null!==e){var n=e.memoizedProps,r=e.memoizedState;t=(e=t.stateNode).getSnapshotBeforeUpdate(t.elementType===t.type?n:Gi(t.type,n),r),e.__reactInternalSnapshotBeforeUpdate=t}return;case 3:return void(256&t.flags&&Br(t.stateNode.containerInfo));case 5:case 6:case 4:case 17:return}throw Error(o(163))}function gl(e,t,n){switch(n.tag){case 0:case 11:case 15:case 22:if(null!==(t=null!==(t=n.updateQueue)?t.lastEffect:null)){e=t=t.next;do{if(3===(3&e.tag)){var r=e.create;e.destroy=r()}e=e.next}while(e!==t)}if(null!==(t=null!==(t=n.updateQueue)?t.lastEffect:null)){e=t=t.next;do{var i=e;r=i.next,0!==(4&(i=i.tag))&&0!==(1&i)&&(Is(n,e),As(n,e)),e=r}while(e!==t)}return;case 1:return e=n.stateNode,4&n.flags&&(null===t?e.componentDidMount():(r=n.elementType===n.type?t.memoizedProps:Gi(n.type,t.memoizedProps),e.componentDidUpdate(r,t.memoizedState,e.__reactInternalSnapshotBeforeUpdate))),void(null!==(t=n.updateQueue)&&fa(n,t,e));case 3:if(null!==(t=n.updateQueue)){if(e=null,null!==n.child)switch(n.child.tag){case 5:e=n.child.stateNode;break;case 1:e=n.child.stateNode}fa(n,t,e)}return;case 5:return e=n.stateNode,void(null===t&&4&n.flags&&Yr(n.type,n.memoizedProps)&&e.focus());case 6:case 4:case 12:return;case 13:return void(null===n.memoizedState&&(n=n.alternate,null!==n&&(n=n.memoizedState,null!==n&&(n=n.dehydrated,null!==n&&kt(n)))));case 19:case 17:case 20:case 21:case 23:case 24:return}throw Error(o(163))}function ml(e,t){for(var n=e;;){if(5===n.tag){var r=n.stateNode;if(t)"function"===typeof(r=r.style).setProperty?r.setProperty("display","none","important"):r.display="none";else{r=n.stateNode;var i=n.memoizedProps.style;i=void 0!==i&&null!==i&&i.hasOwnProperty("display")?i.display:null,r.style.display=_e("display",i)}}else if(6===n.tag)n.stateNode.nodeValue=t?"":n.memoizedProps;else if((23!==n.tag&&24!==n.tag||null===n.memoizedState||n===e)&&null!==n.child){n.child.return=n,n=n.child;continue}if(n===e)break;for(;null===n.sibling;){if(null===n.return||n.return===e)return;n=n.return}n.sibling.return=n.return,n=n.sibling}}function vl(e,t){if(_i&&"function"===typeof _i.onCommitFiberUnmount)try{_i.onCommitFiberUnmount(wi,t)}catch(a){}switch(t.tag){case 0:case 11:case 14:case 15:case 22:if(null!==(e=t.updateQueue)&&null!==(e=e.lastEffect)){var n=e=e.next;do{var r=n,i=r.destroy;if(r=r.tag,void 0!==i)if(0!==(4&r))Is(t,n);else{r=t;try{i()}catch(a){Fs(r,a)}}n=n.next}while(n!==e)}break;case 1:if(hl(t),"function"===typeof(e=t.stateNode).componentWillUnmount)try{e.props=t.memoizedProps,e.state=t.memoizedState,e.componentWillUnmount()}catch(a){Fs(t,a)}break;case 5:hl(t);break;case 4:kl(e,t)}}function yl(e){e.alternate=null,e.child=null,e.dependencies=null,e.firstEffect=null,e.lastEffect=null,e.memoizedProps=null,e.memoizedState=null,e.pendingProps=null,e.return=null,e.updateQueue=null}function bl(e){return 5===e.tag||3===e.tag||4===e.tag}function xl(e){e:{for(var t=e.return;null!==t;){if(bl(t))break e;t=t.return}throw Error(o(160))}var n=t;switch(t=n.stateNode,n.tag){case 5:var r=!1;break;case 3:case 4:t=t.containerInfo,r=!0;break;default:throw Error(o(161))}16&n.flags&&(be(t,""),n.flags&=-17);e:t:for(n=e;;){for(;null===n.sibling;){if(null===n.return||bl(n.return)){n=null;break e}n=n.return}for(n.sibling.return=n.return,n=n.sibling;5!==n.tag&&6!==n.tag&&18!==n.tag;){if(2&n.flags)continue t;if(null===n.child||4===n.tag)continue t;n.child.return=n,n=n.child}if(!(2&n.flags)){n=n.stateNode;break e}}r?wl(e,n,t):_l(e,n,t)}function wl(e,t,n){var r=e.tag,i=5===r||6===r;if(i)e=i?e.stateNode:e.stateNode.instance,t?8===n.nodeType?n.parentNode.insertBefore(e,t):n.insertBefore(e,t):(8===n.nodeType?(t=n.parentNode).insertBefore(e,n):(t=n).appendChild(e),null!==(n=n._reactRootContainer)&&void 0!==n||null!==t.onclick||(t.onclick=Fr));else if(4!==r&&null!==(e=e.child))for(wl(e,t,n),e=e.sibling;null!==e;)wl(e,t,n),e=e.sibling}function _l(e,t,n){var r=e.tag,i=5===r||6===r;if(i)e=i?e.stateNode:e.stateNode.instance,t?n.insertBefore(e,t):n.appendChild(e);else if(4!==r&&null!==(e=e.child))for(_l(e,t,n),e=e.sibling;null!==e;)_l(e,t,n),e=e.sibling}function kl(e,t){for(var n,r,i=t,a=!1;;){if(!a){a=i.return;e:for(;;){if(null===a)throw Error(o(160));switch(n=a.stateNode,a.tag){case 5:r=!1;break e;case 3:case 4:n=n.containerInfo,r=!0;break e}a=a.return}a=!0}if(5===i.tag||6===i.tag){e:for(var l=e,s=i,u=s;;)if(vl(l,u),null!==u.child&&4!==u.tag)u.child.return=u,u=u.child;else{if(u===s)break e;for(;null===u.sibling;){if(null===u.return||u.return===s)break e;u=u.return}u.sibling.return=u.return,u=u.sibling}r?(l=n,s=i.stateNode,8===l.nodeType?l.parentNode.removeChild(s):l.removeChild(s)):n.removeChild(i.stateNode)}else if(4===i.tag){if(null!==i.child){n=i.stateNode.containerInfo,r=!0,i.child.return=i,i=i.child;continue}}else if(vl(e,i),null!==i.child){i.child.return=i,i=i.child;continue}if(i===t)break;for(;null===i.sibling;){if(null===i.return||i.return===t)return;4===(i=i.return).tag&&(a=!1)}i.sibling.return=i.return,i=i.sibling}}function Sl(e,t){switch(t.tag){case 0:case 11:case 14:case 15:case 22:var n=t.updateQueue;if(null!==(n=null!==n?n.lastEffect:null)){var r=n=n.next;do{3===(3&r.tag)&&(e=r.destroy,r.destroy=void 0,void 0!==e&&e()),r=r.next}while(r!==n)}return;case 1:return;case 5:if(null!=(n=t.stateNode)){r=t.memoizedProps;var i=null!==e?e.memoizedProps:r;e=t.type;var a=t.updateQueue;if(t.updateQueue=null,null!==a){for(n[Qr]=r,"input"===e&&"radio"===r.type&&null!=r.name&&ne(n,r),Ce(e,i),t=Ce(e,r),i=0;i<a.length;i+=2){var l=a[i],s=a[i+1];"style"===l?ke(n,s):"dangerouslySetInnerHTML"===l?ye(n,s):"children"===l?be(n,s):w(n,l,s,t)}switch(e){case"input":re(n,r);break;case"textarea":ce(n,r);break;case"select":e=n._wrapperState.wasMultiple,n._wrapperState.wasMultiple=!!r.multiple,null!=(a=r.value)?le(n,!!r.multiple,a,!1):e!==!!r.multiple&&(null!=r.defaultValue?le(n,!!r.multiple,r.defaultValue,!0):le(n,!!r.multiple,r.multiple?[]:"",!1))}}}return;case 6:if(null===t.stateNode)throw Error(o(162));return void(t.stateNode.nodeValue=t.memoizedProps);case 3:return void((n=t.stateNode).hydrate&&(n.hydrate=!1,kt(n.containerInfo)));case 12:return;case 13:return null!==t.memoizedState&&(Ul=Yi(),ml(t.child,!0)),void Ml(t);case 19:return void Ml(t);case 17:return;case 23:case 24:return void ml(t,null!==t.memoizedState)}throw Error(o(163))}function Ml(e){var t=e.updateQueue;if(null!==t){e.updateQueue=null;var n=e.stateNode;null===n&&(n=e.stateNode=new fl),t.forEach((function(t){var r=Ws.bind(null,e,t);n.has(t)||(n.add(t),t.then(r,r))}))}}function Cl(e,t){return null!==e&&(null===(e=e.memoizedState)||null!==e.dehydrated)&&(null!==(t=t.memoizedState)&&null===t.dehydrated)}var El=Math.ceil,Ol=_.ReactCurrentDispatcher,Pl=_.ReactCurrentOwner,Tl=0,Dl=null,Nl=null,Rl=0,Al=0,Il=li(0),Ll=0,jl=null,Fl=0,zl=0,Wl=0,Yl=0,Hl=null,Ul=0,Vl=1/0;function Bl(){Vl=Yi()+500}var $l,Xl=null,ql=!1,Gl=null,Kl=null,Ql=!1,Zl=null,Jl=90,es=[],ts=[],ns=null,rs=0,is=null,as=-1,os=0,ls=0,ss=null,us=!1;function cs(){return 0!==(48&Tl)?Yi():-1!==as?as:as=Yi()}function ds(e){if(0===(2&(e=e.mode)))return 1;if(0===(4&e))return 99===Hi()?1:2;if(0===os&&(os=Fl),0!==qi.transition){0!==ls&&(ls=null!==Hl?Hl.pendingLanes:0),e=os;var t=4186112&~ls;return 0===(t&=-t)&&(0===(t=(e=4186112&~e)&-e)&&(t=8192)),t}return e=Hi(),0!==(4&Tl)&&98===e?e=Yt(12,os):e=Yt(e=function(e){switch(e){case 99:return 15;case 98:return 10;case 97:case 96:return 8;case 95:return 2;default:return 0}}(e),os),e}function fs(e,t,n){if(50<rs)throw rs=0,is=null,Error(o(185));if(null===(e=hs(e,t)))return null;Vt(e,t,n),e===Dl&&(Wl|=t,4===Ll&&ms(e,Rl));var r=Hi();1===t?0!==(8&Tl)&&0===(48&Tl)?vs(e):(ps(e,n),0===Tl&&(Bl(),$i())):(0===(4&Tl)||98!==r&&99!==r||(null===ns?ns=new Set([e]):ns.add(e)),ps(e,n)),Hl=e}function hs(e,t){e.lanes|=t;var n=e.alternate;for(null!==n&&(n.lanes|=t),n=e,e=e.return;null!==e;)e.childLanes|=t,null!==(n=e.alternate)&&(n.childLanes|=t),n=e,e=e.return;return 3===n.tag?n.stateNode:null}function ps(e,t){for(var n=e.callbackNode,r=e.suspendedLanes,i=e.pingedLanes,a=e.expirationTimes,l=e.pendingLanes;0<l;){var s=31-Bt(l),u=1<<s,c=a[s];if(-1===c){if(0===(u&r)||0!==(u&i)){c=t,Ft(u);var d=jt;a[s]=10<=d?c+250:6<=d?c+5e3:-1}}else c<=t&&(e.expiredLanes|=u);l&=~u}if(r=zt(e,e===Dl?Rl:0),t=jt,0===r)null!==n&&(n!==Ii&&Mi(n),e.callbackNode=null,e.callbackPriority=0);else{if(null!==n){if(e.callbackPriority===t)return;n!==Ii&&Mi(n)}15===t?(n=vs.bind(null,e),null===ji?(ji=[n],Fi=Si(Ti,Xi)):ji.push(n),n=Ii):14===t?n=Bi(99,vs.bind(null,e)):n=Bi(n=function(e){switch(e){case 15:case 14:return 99;case 13:case 12:case 11:case 10:return 98;case 9:case 8:case 7:case 6:case 4:case 5:return 97;case 3:case 2:case 1:return 95;case 0:return 90;default:throw Error(o(358,e))}}(t),gs.bind(null,e)),e.callbackPriority=t,e.callbackNode=n}}function gs(e){if(as=-1,ls=os=0,0!==(48&Tl))throw Error(o(327));var t=e.callbackNode;if(Rs()&&e.callbackNode!==t)return null;var n=zt(e,e===Dl?Rl:0);if(0===n)return null;var r=n,i=Tl;Tl|=16;var a=Ss();for(Dl===e&&Rl===r||(Bl(),_s(e,r));;)try{Es();break}catch(s){ks(e,s)}if(ea(),Ol.current=a,Tl=i,null!==Nl?r=0:(Dl=null,Rl=0,r=Ll),0!==(Fl&Wl))_s(e,0);else if(0!==r){if(2===r&&(Tl|=64,e.hydrate&&(e.hydrate=!1,Br(e.containerInfo)),0!==(n=Wt(e))&&(r=Ms(e,n))),1===r)throw t=jl,_s(e,0),ms(e,n),ps(e,Yi()),t;switch(e.finishedWork=e.current.alternate,e.finishedLanes=n,r){case 0:case 1:throw Error(o(345));case 2:Ts(e);break;case 3:if(ms(e,n),(62914560&n)===n&&10<(r=Ul+500-Yi())){if(0!==zt(e,0))break;if(((i=e.suspendedLanes)&n)!==n){cs(),e.pingedLanes|=e.suspendedLanes&i;break}e.timeoutHandle=Ur(Ts.bind(null,e),r);break}Ts(e);break;case 4:if(ms(e,n),(4186112&n)===n)break;for(r=e.eventTimes,i=-1;0<n;){var l=31-Bt(n);a=1<<l,(l=r[l])>i&&(i=l),n&=~a}if(n=i,10<(n=(120>(n=Yi()-n)?120:480>n?480:1080>n?1080:1920>n?1920:3e3>n?3e3:4320>n?4320:1960*El(n/1960))-n)){e.timeoutHandle=Ur(Ts.bind(null,e),n);break}Ts(e);break;case 5:Ts(e);break;default:throw Error(o(329))}}return ps(e,Yi()),e.callbackNode===t?gs.bind(null,e):null}function ms(e,t){for(t&=~Yl,t&=~Wl,e.suspendedLanes|=t,e.pingedLanes&=~t,e=e.expirationTimes;0<t;){var n=31-Bt(t),r=1<<n;e[n]=-1,t&=~r}}function vs(e){if(0!==(48&Tl))throw Error(o(327));if(Rs(),e===Dl&&0!==(e.expiredLanes&Rl)){var t=Rl,n=Ms(e,t);0!==(Fl&Wl)&&(n=Ms(e,t=zt(e,t)))}else n=Ms(e,t=zt(e,0));if(0!==e.tag&&2===n&&(Tl|=64,e.hydrate&&(e.hydrate=!1,Br(e.containerInfo)),0!==(t=Wt(e))&&(n=Ms(e,t))),1===n)throw n=jl,_s(e,0),ms(e,t),ps(e,Yi()),n;return e.finishedWork=e.current.alternate,e.finishedLanes=t,Ts(e),ps(e,Yi()),null}function ys(e,t){var n=Tl;Tl|=1;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}}function bs(e,t){var n=Tl;Tl&=-2,Tl|=8;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}}function xs(e,t){ui(Il,Al),Al|=t,Fl|=t}function ws(){Al=Il.current,si(Il)}function _s(e,t){e.finishedWork=null,e.finishedLanes=0;var n=e.timeoutHandle;if(-1!==n&&(e.timeoutHandle=-1,Vr(n)),null!==Nl)for(n=Nl.return;null!==n;){var r=n;switch(r.tag){case 1:null!==(r=r.type.childContextTypes)&&void 0!==r&&mi();break;case 3:Na(),si(fi),si(di),Xa();break;case 5:Aa(r);break;case 4:Na();break;case 13:case 19:si(Ia);break;case 10:ta(r);break;case 23:case 24:ws()}n=n.return}Dl=e,Nl=Vs(e.current,null),Rl=Al=Fl=t,Ll=0,jl=null,Yl=Wl=zl=0}function ks(e,t){for(;;){var n=Nl;try{if(ea(),qa.current=To,eo){for(var r=Qa.memoizedState;null!==r;){var i=r.queue;null!==i&&(i.pending=null),r=r.next}eo=!1}if(Ka=0,Ja=Za=Qa=null,to=!1,Pl.current=null,null===n||null===n.return){Ll=1,jl=t,Nl=null;break}e:{var a=e,o=n.return,l=n,s=t;if(t=Rl,l.flags|=2048,l.firstEffect=l.lastEffect=null,null!==s&&"object"===typeof s&&"function"===typeof s.then){var u=s;if(0===(2&l.mode)){var c=l.alternate;c?(l.updateQueue=c.updateQueue,l.memoizedState=c.memoizedState,l.lanes=c.lanes):(l.updateQueue=null,l.memoizedState=null)}var d=0!==(1&Ia.current),f=o;do{var h;if(h=13===f.tag){var p=f.memoizedState;if(null!==p)h=null!==p.dehydrated;else{var g=f.memoizedProps;h=void 0!==g.fallback&&(!0!==g.unstable_avoidThisFallback||!d)}}if(h){var m=f.updateQueue;if(null===m){var v=new Set;v.add(u),f.updateQueue=v}else m.add(u);if(0===(2&f.mode)){if(f.flags|=64,l.flags|=16384,l.flags&=-2981,1===l.tag)if(null===l.alternate)l.tag=17;else{var y=sa(-1,1);y.tag=2,ua(l,y)}l.lanes|=1;break e}s=void 0,l=t;var b=a.pingCache;if(null===b?(b=a.pingCache=new ul,s=new Set,b.set(u,s)):void 0===(s=b.get(u))&&(s=new Set,b.set(u,s)),!s.has(l)){s.add(l);var x=zs.bind(null,a,u,l);u.then(x,x)}f.flags|=4096,f.lanes=t;break e}f=f.return}while(null!==f);s=Error((q(l.type)||"A React component")+" suspended while rendering, but no fallback UI was specified.\n\nAdd a <Suspense fallback=...> component higher in the tree to provide a loading indicator or placeholder to display.")}5!==Ll&&(Ll=2),s=ll(s,l),f=o;do{switch(f.tag){case 3:a=s,f.flags|=4096,t&=-t,f.lanes|=t,ca(f,cl(0,a,t));break e;case 1:a=s;var w=f.type,_=f.stateNode;if(0===(64&f.flags)&&("function"===typeof w.getDerivedStateFromError||null!==_&&"function"===typeof _.componentDidCatch&&(null===Kl||!Kl.has(_)))){f.flags|=4096,t&=-t,f.lanes|=t,ca(f,dl(f,a,t));break e}}f=f.return}while(null!==f)}Ps(n)}catch(k){t=k,Nl===n&&null!==n&&(Nl=n=n.return);continue}break}}function Ss(){var e=Ol.current;return Ol.current=To,null===e?To:e}function Ms(e,t){var n=Tl;Tl|=16;var r=Ss();for(Dl===e&&Rl===t||_s(e,t);;)try{Cs();break}catch(i){ks(e,i)}if(ea(),Tl=n,Ol.current=r,null!==Nl)throw Error(o(261));return Dl=null,Rl=0,Ll}function Cs(){for(;null!==Nl;)Os(Nl)}function Es(){for(;null!==Nl&&!Ci();)Os(Nl)}function Os(e){var t=$l(e.alternate,e,Al);e.memoizedProps=e.pendingProps,null===t?Ps(e):Nl=t,Pl.current=null}function Ps(e){var t=e;do{var n=t.alternate;if(e=t.return,0===(2048&t.flags)){if(null!==(n=al(n,t,Al)))return void(Nl=n);if(24!==(n=t).tag&&23!==n.tag||null===n.memoizedState||0!==(1073741824&Al)||0===(4&n.mode)){for(var r=0,i=n.child;null!==i;)r|=i.lanes|i.childLanes,i=i.sibling;n.childLanes=r}null!==e&&0===(2048&e.flags)&&(null===e.firstEffect&&(e.firstEffect=t.firstEffect),null!==t.lastEffect&&(null!==e.lastEffect&&(e.lastEffect.nextEffect=t.firstEffect),e.lastEffect=t.lastEffect),1<t.flags&&(null!==e.lastEffect?e.lastEffect.nextEffect=t:e.firstEffect=t,e.lastEffect=t))}else{if(null!==(n=ol(t)))return n.flags&=2047,void(Nl=n);null!==e&&(e.firstEffect=e.lastEffect=null,e.flags|=2048)}if(null!==(t=t.sibling))return void(Nl=t);Nl=t=e}while(null!==t);0===Ll&&(Ll=5)}function Ts(e){var t=Hi();return Vi(99,Ds.bind(null,e,t)),null}function Ds(e,t){do{Rs()}while(null!==Zl);if(0!==(48&Tl))throw Error(o(327));var n=e.finishedWork;if(null===n)return null;if(e.finishedWork=null,e.finishedLanes=0,n===e.current)throw Error(o(177));e.callbackNode=null;var r=n.lanes|n.childLanes,i=r,a=e.pendingLanes&~i;e.pendingLanes=i,e.suspendedLanes=0,e.pingedLanes=0,e.expiredLanes&=i,e.mutableReadLanes&=i,e.entangledLanes&=i,i=e.entanglements;for(var l=e.eventTimes,s=e.expirationTimes;0<a;){var u=31-Bt(a),c=1<<u;i[u]=0,l[u]=-1,s[u]=-1,a&=~c}if(null!==ns&&0===(24&r)&&ns.has(e)&&ns.delete(e),e===Dl&&(Nl=Dl=null,Rl=0),1<n.flags?null!==n.lastEffect?(n.lastEffect.nextEffect=n,r=n.firstEffect):r=n:r=n.firstEffect,null!==r){if(i=Tl,Tl|=32,Pl.current=null,zr=Kt,gr(l=pr())){if("selectionStart"in l)s={start:l.selectionStart,end:l.selectionEnd};else e:if(s=(s=l.ownerDocument)&&s.defaultView||window,(c=s.getSelection&&s.getSelection())&&0!==c.rangeCount){s=c.anchorNode,a=c.anchorOffset,u=c.focusNode,c=c.focusOffset;try{s.nodeType,u.nodeType}catch(C){s=null;break e}var d=0,f=-1,h=-1,p=0,g=0,m=l,v=null;t:for(;;){for(var y;m!==s||0!==a&&3!==m.nodeType||(f=d+a),m!==u||0!==c&&3!==m.nodeType||(h=d+c),3===m.nodeType&&(d+=m.nodeValue.length),null!==(y=m.firstChild);)v=m,m=y;for(;;){if(m===l)break t;if(v===s&&++p===a&&(f=d),v===u&&++g===c&&(h=d),null!==(y=m.nextSibling))break;v=(m=v).parentNode}m=y}s=-1===f||-1===h?null:{start:f,end:h}}else s=null;s=s||{start:0,end:0}}else s=null;Wr={focusedElem:l,selectionRange:s},Kt=!1,ss=null,us=!1,Xl=r;do{try{Ns()}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);ss=null,Xl=r;do{try{for(l=e;null!==Xl;){var b=Xl.flags;if(16&b&&be(Xl.stateNode,""),128&b){var x=Xl.alternate;if(null!==x){var w=x.ref;null!==w&&("function"===typeof w?w(null):w.current=null)}}switch(1038&b){case 2:xl(Xl),Xl.flags&=-3;break;case 6:xl(Xl),Xl.flags&=-3,Sl(Xl.alternate,Xl);break;case 1024:Xl.flags&=-1025;break;case 1028:Xl.flags&=-1025,Sl(Xl.alternate,Xl);break;case 4:Sl(Xl.alternate,Xl);break;case 8:kl(l,s=Xl);var _=s.alternate;yl(s),null!==_&&yl(_)}Xl=Xl.nextEffect}}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);if(w=Wr,x=pr(),b=w.focusedElem,l=w.selectionRange,x!==b&&b&&b.ownerDocument&&hr(b.ownerDocument.documentElement,b)){null!==l&&gr(b)&&(x=l.start,void 0===(w=l.end)&&(w=x),"selectionStart"in b?(b.selectionStart=x,b.selectionEnd=Math.min(w,b.value.length)):(w=(x=b.ownerDocument||document)&&x.defaultView||window).getSelection&&(w=w.getSelection(),s=b.textContent.length,_=Math.min(l.start,s),l=void 0===l.end?_:Math.min(l.end,s),!w.extend&&_>l&&(s=l,l=_,_=s),s=fr(b,_),a=fr(b,l),s&&a&&(1!==w.rangeCount||w.anchorNode!==s.node||w.anchorOffset!==s.offset||w.focusNode!==a.node||w.focusOffset!==a.offset)&&((x=x.createRange()).setStart(s.node,s.offset),w.removeAllRanges(),_>l?(w.addRange(x),w.extend(a.node,a.offset)):(x.setEnd(a.node,a.offset),w.addRange(x))))),x=[];for(w=b;w=w.parentNode;)1===w.nodeType&&x.push({element:w,left:w.scrollLeft,top:w.scrollTop});for("function"===typeof b.focus&&b.focus(),b=0;b<x.length;b++)(w=x[b]).element.scrollLeft=w.left,w.element.scrollTop=w.top}Kt=!!zr,Wr=zr=null,e.current=n,Xl=r;do{try{for(b=e;null!==Xl;){var k=Xl.flags;if(36&k&&gl(b,Xl.alternate,Xl),128&k){x=void 0;var S=Xl.ref;if(null!==S){var M=Xl.stateNode;switch(Xl.tag){case 5:x=M;break;default:x=M}"function"===typeof S?S(x):S.current=x}}Xl=Xl.nextEffect}}catch(C){if(null===Xl)throw Error(o(330));Fs(Xl,C),Xl=Xl.nextEffect}}while(null!==Xl);Xl=null,Li(),Tl=i}else e.current=n;if(Ql)Ql=!1,Zl=e,Jl=t;else for(Xl=r;null!==Xl;)t=Xl.nextEffect,Xl.nextEffect=null,8&Xl.flags&&((k=Xl).sibling=null,k.stateNode=null),Xl=t;if(0===(r=e.pendingLanes)&&(Kl=null),1===r?e===is?rs++:(rs=0,is=e):rs=0,n=n.stateNode,_i&&"function"===typeof _i.onCommitFiberRoot)try{_i.onCommitFiberRoot(wi,n,void 0,64===(64&n.current.flags))}catch(C){}if(ps(e,Yi()),ql)throw ql=!1,e=Gl,Gl=null,e;return 0!==(8&Tl)||$i(),null}function Ns(){for(;null!==Xl;){var e=Xl.alternate;us||null===ss||(0!==(8&Xl.flags)?tt(Xl,ss)&&(us=!0):13===Xl.tag&&Cl(e,Xl)&&tt(Xl,ss)&&(us=!0));var t=Xl.flags;0!==(256&t)&&pl(e,Xl),0===(512&t)||Ql||(Ql=!0,Bi(97,(function(){return Rs(),null}))),Xl=Xl.nextEffect}}function Rs(){if(90!==Jl){var e=97<Jl?97:Jl;return Jl=90,Vi(e,Ls)}return!1}function As(e,t){es.push(t,e),Ql||(Ql=!0,Bi(97,(function(){return Rs(),null})))}function Is(e,t){ts.push(t,e),Ql||(Ql=!0,Bi(97,(function(){return Rs(),null})))}function Ls(){if(null===Zl)return!1;var e=Zl;if(Zl=null,0!==(48&Tl))throw Error(o(331));var t=Tl;Tl|=32;var n=ts;ts=[];for(var r=0;r<n.length;r+=2){var i=n[r],a=n[r+1],l=i.destroy;if(i.destroy=void 0,"function"===typeof l)try{l()}catch(u){if(null===a)throw Error(o(330));Fs(a,u)}}for(n=es,es=[],r=0;r<n.length;r+=2){i=n[r],a=n[r+1];try{var s=i.create;i.destroy=s()}catch(u){if(null===a)throw Error(o(330));Fs(a,u)}}for(s=e.current.firstEffect;null!==s;)e=s.nextEffect,s.nextEffect=null,8&s.flags&&(s.sibling=null,s.stateNode=null),s=e;return Tl=t,$i(),!0}function js(e,t,n){ua(e,t=cl(0,t=ll(n,t),1)),t=cs(),null!==(e=hs(e,1))&&(Vt(e,1,t),ps(e,t))}function Fs(e,t){if(3===e.tag)js(e,e,t);else for(var n=e.return;null!==n;){if(3===n.tag){js(n,e,t);break}if(1===n.tag){var r=n.stateNode;if("function"===typeof n.type.getDerivedStateFromError||"function"===typeof r.componentDidCatch&&(null===Kl||!Kl.has(r))){var i=dl(n,e=ll(t,e),1);if(ua(n,i),i=cs(),null!==(n=hs(n,1)))Vt(n,1,i),ps(n,i);else if("function"===typeof r.componentDidCatch&&(null===Kl||!Kl.has(r)))try{r.componentDidCatch(t,e)}catch(a){}break}}n=n.return}}function zs(e,t,n){var r=e.pingCache;null!==r&&r.delete(t),t=cs(),e.pingedLanes|=e.suspendedLanes&n,Dl===e&&(Rl&n)===n&&(4===Ll||3===Ll&&(62914560&Rl)===Rl&&500>Yi()-Ul?_s(e,0):Yl|=n),ps(e,t)}function Ws(e,t){var n=e.stateNode;null!==n&&n.delete(t),0===(t=0)&&(0===(2&(t=e.mode))?t=1:0===(4&t)?t=99===Hi()?1:2:(0===os&&(os=Fl),0===(t=Ht(62914560&~os))&&(t=4194304))),n=cs(),null!==(e=hs(e,t))&&(Vt(e,t,n),ps(e,n))}function Ys(e,t,n,r){this.tag=e,this.key=n,this.sibling=this.child=this.return=this.stateNode=this.type=this.elementType=null,this.index=0,this.ref=null,this.pendingProps=t,this.dependencies=this.memoizedState=this.updateQueue=this.memoizedProps=null,this.mode=r,this.flags=0,this.lastEffect=this.firstEffect=this.nextEffect=null,this.childLanes=this.lanes=0,this.alternate=null}function Hs(e,t,n,r){return new Ys(e,t,n,r)}function Us(e){return!(!(e=e.prototype)||!e.isReactComponent)}function Vs(e,t){var n=e.alternate;return null===n?((n=Hs(e.tag,t,e.key,e.mode)).elementType=e.elementType,n.type=e.type,n.stateNode=e.stateNode,n.alternate=e,e.alternate=n):(n.pendingProps=t,n.type=e.type,n.flags=0,n.nextEffect=null,n.firstEffect=null,n.lastEffect=null),n.childLanes=e.childLanes,n.lanes=e.lanes,n.child=e.child,n.memoizedProps=e.memoizedProps,n.memoizedState=e.memoizedState,n.updateQueue=e.updateQueue,t=e.dependencies,n.dependencies=null===t?null:{lanes:t.lanes,firstContext:t.firstContext},n.sibling=e.sibling,n.index=e.index,n.ref=e.ref,n}function Bs(e,t,n,r,i,a){var l=2;if(r=e,"function"===typeof e)Us(e)&&(l=1);else if("string"===typeof e)l=5;else e:switch(e){case M:return $s(n.children,i,a,t);case j:l=8,i|=16;break;case C:l=8,i|=1;break;case E:return(e=Hs(12,n,t,8|i)).elementType=E,e.type=E,e.lanes=a,e;case D:return(e=Hs(13,n,t,i)).type=D,e.elementType=D,e.lanes=a,e;case N:return(e=Hs(19,n,t,i)).elementType=N,e.lanes=a,e;case F:return Xs(n,i,a,t);case z:return(e=Hs(24,n,t,i)).elementType=z,e.lanes=a,e;default:if("object"===typeof e&&null!==e)switch(e.$$typeof){case O:l=10;break e;case P:l=9;break e;case T:l=11;break e;case R:l=14;break e;case A:l=16,r=null;break e;case I:l=22;break e}throw Error(o(130,null==e?e:typeof e,""))}return(t=Hs(l,n,t,i)).elementType=e,t.type=r,t.lanes=a,t}function $s(e,t,n,r){return(e=Hs(7,e,r,t)).lanes=n,e}function Xs(e,t,n,r){return(e=Hs(23,e,r,t)).elementType=F,e.lanes=n,e}function qs(e,t,n){return(e=Hs(6,e,null,t)).lanes=n,e}function Gs(e,t,n){return(t=Hs(4,null!==e.children?e.children:[],e.key,t)).lanes=n,t.stateNode={containerInfo:e.containerInfo,pendingChildren:null,implementation:e.implementation},t}function Ks(e,t,n){this.tag=t,this.containerInfo=e,this.finishedWork=this.pingCache=this.current=this.pendingChildren=null,this.timeoutHandle=-1,this.pendingContext=this.context=null,this.hydrate=n,this.callbackNode=null,this.callbackPriority=0,this.eventTimes=Ut(0),this.expirationTimes=Ut(-1),this.entangledLanes=this.finishedLanes=this.mutableReadLanes=this.expiredLanes=this.pingedLanes=this.suspendedLanes=this.pendingLanes=0,this.entanglements=Ut(0),this.mutableSourceEagerHydrationData=null}function Qs(e,t,n){var r=3<arguments.length&&void 0!==arguments[3]?arguments[3]:null;return{$$typeof:S,key:null==r?null:""+r,children:e,containerInfo:t,implementation:n}}function Zs(e,t,n,r){var i=t.current,a=cs(),l=ds(i);e:if(n){t:{if(Qe(n=n._reactInternals)!==n||1!==n.tag)throw Error(o(170));var s=n;do{switch(s.tag){case 3:s=s.stateNode.context;break t;case 1:if(gi(s.type)){s=s.stateNode.__reactInternalMemoizedMergedChildContext;break t}}s=s.return}while(null!==s);throw Error(o(171))}if(1===n.tag){var u=n.type;if(gi(u)){n=yi(n,u,s);break e}}n=s}else n=ci;return null===t.context?t.context=n:t.pendingContext=n,(t=sa(a,l)).payload={element:e},null!==(r=void 0===r?null:r)&&(t.callback=r),ua(i,t),fs(i,l,a),l}function Js(e){if(!(e=e.current).child)return null;switch(e.child.tag){case 5:default:return e.child.stateNode}}function eu(e,t){if(null!==(e=e.memoizedState)&&null!==e.dehydrated){var n=e.retryLane;e.retryLane=0!==n&&n<t?n:t}}function tu(e,t){eu(e,t),(e=e.alternate)&&eu(e,t)}function nu(e,t,n){var r=null!=n&&null!=n.hydrationOptions&&n.hydrationOptions.mutableSources||null;if(n=new Ks(e,t,null!=n&&!0===n.hydrate),t=Hs(3,null,null,2===t?7:1===t?3:0),n.current=t,t.stateNode=n,oa(t),e[Zr]=n.current,Tr(8===e.nodeType?e.parentNode:e),r)for(e=0;e<r.length;e++){var i=(t=r[e])._getVersion;i=i(t._source),null==n.mutableSourceEagerHydrationData?n.mutableSourceEagerHydrationData=[t,i]:n.mutableSourceEagerHydrationData.push(t,i)}this._internalRoot=n}function ru(e){return!(!e||1!==e.nodeType&&9!==e.nodeType&&11!==e.nodeType&&(8!==e.nodeType||" react-mount-point-unstable "!==e.nodeValue))}function iu(e,t,n,r,i){var a=n._reactRootContainer;if(a){var o=a._internalRoot;if("function"===typeof i){var l=i;i=function(){var e=Js(o);l.call(e)}}Zs(t,o,e,i)}else{if(a=n._reactRootContainer=function(e,t){if(t||(t=!(!(t=e?9===e.nodeType?e.documentElement:e.firstChild:null)||1!==t.nodeType||!t.hasAttribute("data-reactroot"))),!t)for(var n;n=e.lastChild;)e.removeChild(n);return new nu(e,0,t?{hydrate:!0}:void 0)}(n,r),o=a._internalRoot,"function"===typeof i){var s=i;i=function(){var e=Js(o);s.call(e)}}bs((function(){Zs(t,o,e,i)}))}return Js(o)}function au(e,t){var n=2<arguments.length&&void 0!==arguments[2]?arguments[2]:null;if(!ru(t))throw Error(o(200));return Qs(e,t,null,n)}$l=function(e,t,n){var r=t.lanes;if(null!==e)if(e.memoizedProps!==t.pendingProps||fi.current)Io=!0;else{if(0===(n&r)){switch(Io=!1,t.tag){case 3:Bo(t),Ba();break;case 5:Ra(t);break;case 1:gi(t.type)&&bi(t);break;case 4:Da(t,t.stateNode.containerInfo);break;case 10:r=t.memoizedProps.value;var i=t.type._context;ui(Ki,i._currentValue),i._currentValue=r;break;case 13:if(null!==t.memoizedState)return 0!==(n&t.child.childLanes)?Ko(e,t,n):(ui(Ia,1&Ia.current),null!==(t=rl(e,t,n))?t.sibling:null);ui(Ia,1&Ia.current);break;case 19:if(r=0!==(n&t.childLanes),0!==(64&e.flags)){if(r)return nl(e,t,n);t.flags|=64}if(null!==(i=t.memoizedState)&&(i.rendering=null,i.tail=null,i.lastEffect=null),ui(Ia,Ia.current),r)break;return null;case 23:case 24:return t.lanes=0,Wo(e,t,n)}return rl(e,t,n)}Io=0!==(16384&e.flags)}else Io=!1;switch(t.lanes=0,t.tag){case 2:if(r=t.type,null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),e=t.pendingProps,i=pi(t,di.current),ra(t,n),i=io(null,t,r,e,i,n),t.flags|=1,"object"===typeof i&&null!==i&&"function"===typeof i.render&&void 0===i.$$typeof){if(t.tag=1,t.memoizedState=null,t.updateQueue=null,gi(r)){var a=!0;bi(t)}else a=!1;t.memoizedState=null!==i.state&&void 0!==i.state?i.state:null,oa(t);var l=r.getDerivedStateFromProps;"function"===typeof l&&pa(t,r,l,e),i.updater=ga,t.stateNode=i,i._reactInternals=t,ba(t,r,e,n),t=Vo(null,t,r,!0,a,n)}else t.tag=0,Lo(null,t,i,n),t=t.child;return t;case 16:i=t.elementType;e:{switch(null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),e=t.pendingProps,i=(a=i._init)(i._payload),t.type=i,a=t.tag=function(e){if("function"===typeof e)return Us(e)?1:0;if(void 0!==e&&null!==e){if((e=e.$$typeof)===T)return 11;if(e===R)return 14}return 2}(i),e=Gi(i,e),a){case 0:t=Ho(null,t,i,e,n);break e;case 1:t=Uo(null,t,i,e,n);break e;case 11:t=jo(null,t,i,e,n);break e;case 14:t=Fo(null,t,i,Gi(i.type,e),r,n);break e}throw Error(o(306,i,""))}return t;case 0:return r=t.type,i=t.pendingProps,Ho(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 1:return r=t.type,i=t.pendingProps,Uo(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 3:if(Bo(t),r=t.updateQueue,null===e||null===r)throw Error(o(282));if(r=t.pendingProps,i=null!==(i=t.memoizedState)?i.element:null,la(e,t),da(t,r,null,n),(r=t.memoizedState.element)===i)Ba(),t=rl(e,t,n);else{if((a=(i=t.stateNode).hydrate)&&(Fa=$r(t.stateNode.containerInfo.firstChild),ja=t,a=za=!0),a){if(null!=(e=i.mutableSourceEagerHydrationData))for(i=0;i<e.length;i+=2)(a=e[i])._workInProgressVersionPrimary=e[i+1],$a.push(a);for(n=Ma(t,null,r,n),t.child=n;n;)n.flags=-3&n.flags|1024,n=n.sibling}else Lo(e,t,r,n),Ba();t=t.child}return t;case 5:return Ra(t),null===e&&Ha(t),r=t.type,i=t.pendingProps,a=null!==e?e.memoizedProps:null,l=i.children,Hr(r,i)?l=null:null!==a&&Hr(r,a)&&(t.flags|=16),Yo(e,t),Lo(e,t,l,n),t.child;case 6:return null===e&&Ha(t),null;case 13:return Ko(e,t,n);case 4:return Da(t,t.stateNode.containerInfo),r=t.pendingProps,null===e?t.child=Sa(t,null,r,n):Lo(e,t,r,n),t.child;case 11:return r=t.type,i=t.pendingProps,jo(e,t,r,i=t.elementType===r?i:Gi(r,i),n);case 7:return Lo(e,t,t.pendingProps,n),t.child;case 8:case 12:return Lo(e,t,t.pendingProps.children,n),t.child;case 10:e:{r=t.type._context,i=t.pendingProps,l=t.memoizedProps,a=i.value;var s=t.type._context;if(ui(Ki,s._currentValue),s._currentValue=a,null!==l)if(s=l.value,0===(a=sr(s,a)?0:0|("function"===typeof r._calculateChangedBits?r._calculateChangedBits(s,a):1073741823))){if(l.children===i.children&&!fi.current){t=rl(e,t,n);break e}}else for(null!==(s=t.child)&&(s.return=t);null!==s;){var u=s.dependencies;if(null!==u){l=s.child;for(var c=u.firstContext;null!==c;){if(c.context===r&&0!==(c.observedBits&a)){1===s.tag&&((c=sa(-1,n&-n)).tag=2,ua(s,c)),s.lanes|=n,null!==(c=s.alternate)&&(c.lanes|=n),na(s.return,n),u.lanes|=n;break}c=c.next}}else l=10===s.tag&&s.type===t.type?null:s.child;if(null!==l)l.return=s;else for(l=s;null!==l;){if(l===t){l=null;break}if(null!==(s=l.sibling)){s.return=l.return,l=s;break}l=l.return}s=l}Lo(e,t,i.children,n),t=t.child}return t;case 9:return i=t.type,r=(a=t.pendingProps).children,ra(t,n),r=r(i=ia(i,a.unstable_observedBits)),t.flags|=1,Lo(e,t,r,n),t.child;case 14:return a=Gi(i=t.type,t.pendingProps),Fo(e,t,i,a=Gi(i.type,a),r,n);case 15:return zo(e,t,t.type,t.pendingProps,r,n);case 17:return r=t.type,i=t.pendingProps,i=t.elementType===r?i:Gi(r,i),null!==e&&(e.alternate=null,t.alternate=null,t.flags|=2),t.tag=1,gi(r)?(e=!0,bi(t)):e=!1,ra(t,n),va(t,r,i),ba(t,r,i,n),Vo(null,t,r,!0,e,n);case 19:return nl(e,t,n);case 23:case 24:return Wo(e,t,n)}throw Error(o(156,t.tag))},nu.prototype.render=function(e){Zs(e,this._internalRoot,null,null)},nu.prototype.unmount=function(){var e=this._internalRoot,t=e.containerInfo;Zs(null,e,null,(function(){t[Zr]=null}))},nt=function(e){13===e.tag&&(fs(e,4,cs()),tu(e,4))},rt=function(e){13===e.tag&&(fs(e,67108864,cs()),tu(e,67108864))},it=function(e){if(13===e.tag){var t=cs(),n=ds(e);fs(e,n,t),tu(e,n)}},at=function(e,t){return t()},Oe=function(e,t,n){switch(t){case"input":if(re(e,n),t=n.name,"radio"===n.type&&null!=t){for(n=e;n.parentNode;)n=n.parentNode;for(n=n.querySelectorAll("input[name="+JSON.stringify(""+t)+'][type="radio"]'),t=0;t<n.length;t++){var r=n[t];if(r!==e&&r.form===e.form){var i=ri(r);if(!i)throw Error(o(90));Z(r),re(r,i)}}}break;case"textarea":ce(e,n);break;case"select":null!=(t=n.value)&&le(e,!!n.multiple,t,!1)}},Ae=ys,Ie=function(e,t,n,r,i){var a=Tl;Tl|=4;try{return Vi(98,e.bind(null,t,n,r,i))}finally{0===(Tl=a)&&(Bl(),$i())}},Le=function(){0===(49&Tl)&&(function(){if(null!==ns){var e=ns;ns=null,e.forEach((function(e){e.expiredLanes|=24&e.pendingLanes,ps(e,Yi())}))}$i()}(),Rs())},je=function(e,t){var n=Tl;Tl|=2;try{return e(t)}finally{0===(Tl=n)&&(Bl(),$i())}};var ou={Events:[ti,ni,ri,Ne,Re,Rs,{current:!1}]},lu={findFiberByHostInstance:ei,bundleType:0,version:"17.0.1",rendererPackageName:"react-dom"},su={bundleType:lu.bundleType,version:lu.version,rendererPackageName:lu.rendererPackageName,rendererConfig:lu.rendererConfig,overrideHookState:null,overrideHookStateDeletePath:null,overrideHookStateRenamePath:null,overrideProps:null,overridePropsDeletePath:null,overridePropsRenamePath:null,setSuspenseHandler:null,scheduleUpdate:null,currentDispatcherRef:_.ReactCurrentDispatcher,findHostInstanceByFiber:function(e){return null===(e=et(e))?null:e.stateNode},findFiberByHostInstance:lu.findFiberByHostInstance||function(){return null},findHostInstancesForRefresh:null,scheduleRefresh:null,scheduleRoot:null,setRefreshHandler:null,getCurrentFiber:null};if("undefined"!==typeof __REACT_DEVTOOLS_GLOBAL_HOOK__){var uu=__REACT_DEVTOOLS_GLOBAL_HOOK__;if(!uu.isDisabled&&uu.supportsFiber)try{wi=uu.inject(su),_i=uu}catch(ve){}}t.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED=ou,t.createPortal=au,t.findDOMNode=function(e){if(null==e)return null;if(1===e.nodeType)return e;var t=e._reactInternals;if(void 0===t){if("function"===typeof e.render)throw Error(o(188));throw Error(o(268,Object.keys(e)))}return e=null===(e=et(t))?null:e.stateNode},t.flushSync=function(e,t){var n=Tl;if(0!==(48&n))return e(t);Tl|=1;try{if(e)return Vi(99,e.bind(null,t))}finally{Tl=n,$i()}},t.hydrate=function(e,t,n){if(!ru(t))throw Error(o(200));return iu(null,e,t,!0,n)},t.render=function(e,t,n){if(!ru(t))throw Error(o(200));return iu(null,e,t,!1,n)},t.unmountComponentAtNode=function(e){if(!ru(e))throw Error(o(40));return!!e._reactRootContainer&&(bs((function(){iu(null,null,e,!1,(function(){e._reactRootContainer=null,e[Zr]=null}))})),!0)},t.unstable_batchedUpdates=ys,t.unstable_createPortal=function(e,t){return au(e,t,2<arguments.length&&void 0!==arguments[2]?arguments[2]:null)},t.unstable_renderSubtreeIntoContainer=function(e,t,n,r){if(!ru(n))throw Error(o(200));if(null==e||void 0===e._reactInternals)throw Error(o(38));return iu(e,t,n,!1,r)},t.version="17.0.1"},function(e,t,n){"use strict";e.exports=n(82)},function(e,t,n){"use strict";var r,i,a,o;if("object"===typeof performance&&"function"===typeof performance.now){var l=performance;t.unstable_now=function(){return l.now()}}else{var s=Date,u=s.now();t.unstable_now=function(){return s.now()-u}}if("undefined"===typeof window||"function"!==typeof MessageChannel){var c=null,d=null,f=function e(){if(null!==c)try{var n=t.unstable_now();c(!0,n),c=null}catch(b){throw setTimeout(e,0),b}};r=function(e){null!==c?setTimeout(r,0,e):(c=e,setTimeout(f,0))},i=function(e,t){d=setTimeout(e,t)},a=function(){clearTimeout(d)},t.unstable_shouldYield=function(){return!1},o=t.unstable_forceFrameRate=function(){}}else{var h=window.setTimeout,p=window.clearTimeout;if("undefined"!==typeof console){var g=window.cancelAnimationFrame;"function"!==typeof window.requestAnimationFrame&&console.error("This browser doesn't support requestAnimationFrame. Make sure that you load a polyfill in older browsers. https://reactjs.org/link/react-polyfills"),"function"!==typeof g&&console.error("This browser doesn't support cancelAnimationFrame. Make sure that you load a polyfill in older browsers. https://reactjs.org/link/react-polyfills")}var m=!1,v=null,y=-1,x=5,w=0;t.unstable_shouldYield=function(){return t.unstable_now()>=w},o=function(){},t.unstable_forceFrameRate=function(e){0>e||125<e?console.error("forceFrameRate takes a positive int between 0 and 125, forcing frame rates higher than 125 fps is not supported"):x=0<e?Math.floor(1e3/e):5};var _=new MessageChannel,k=_.port2;_.port1.onmessage=function(){if(null!==v){var e=t.unstable_now();w=e+x;try{v(!0,e)?k.postMessage(null):(m=!1,v=null)}catch(b){throw k.postMessage(null),b}}else m=!1},r=function(e){v=e,m||(m=!0,k.postMessage(null))},i=function(e,n){y=h((function(){e(t.unstable_now())}),n)},a=function(){p(y),y=-1}}function S(e,t){var n=e.length;e.push(t);e:for(;;){var r=n-1>>>1,i=e[r];if(!(void 0!==i&&0<E(i,t)))break e;e[r]=t,e[n]=i,n=r}}function M(e){return void 0===(e=e[0])?null:e}function C(e){var t=e[0];if(void 0!==t){var n=e.pop();if(n!==t){e[0]=n;e:for(var r=0,i=e.length;r<i;){var a=2*(r+1)-1,o=e[a],l=a+1,s=e[l];if(void 0!==o&&0>E(o,n))void 0!==s&&0>E(s,o)?(e[r]=s,e[l]=n,r=l):(e[r]=o,e[a]=n,r=a);else{if(!(void 0!==s&&0>E(s,n)))break e;e[r]=s,e[l]=n,r=l}}}return t}return null}function E(e,t){var n=e.sortIndex-t.sortIndex;return 0!==n?n:e.id-t.id}var O=[],P=[],T=1,D=null,N=3,R=!1,A=!1,I=!1;function L(e){for(var t=M(P);null!==t;){if(null===t.callback)C(P);else{if(!(t.startTime<=e))break;C(P),t.sortIndex=t.expirationTime,S(O,t)}t=M(P)}}function j(e){if(I=!1,L(e),!A)if(null!==M(O))A=!0,r(F);else{var t=M(P);null!==t&&i(j,t.startTime-e)}}function F(e,n){A=!1,I&&(I=!1,a()),R=!0;var r=N;try{for(L(n),D=M(O);null!==D&&(!(D.expirationTime>n)||e&&!t.unstable_shouldYield());){var o=D.callback;if("function"===typeof o){D.callback=null,N=D.priorityLevel;var l=o(D.expirationTime<=n);n=t.unstable_now(),"function"===typeof l?D.callback=l:D===M(O)&&C(O),L(n)}else C(O);D=M(O)}if(null!==D)var s=!0;else{var u=M(P);null!==u&&i(j,u.startTime-n),s=!1}return s}finally{D=null,N=r,R=!1}}var z=o;t.unstable_IdlePriority=5,t.unstable_ImmediatePriority=1,t.unstable_LowPriority=4,t.unstable_NormalPriority=3,t.unstable_Profiling=null,t.unstable_UserBlockingPriority=2,t.unstable_cancelCallback=function(e){e.callback=null},t.unstable_continueExecution=function(){A||R||(A=!0,r(F))},t.unstable_getCurrentPriorityLevel=function(){return N},t.unstable_getFirstCallbackNode=function(){return M(O)},t.unstable_next=function(e){switch(N){case 1:case 2:case 3:var t=3;break;default:t=N}var n=N;N=t;try{return e()}finally{N=n}},t.unstable_pauseExecution=function(){},t.unstable_requestPaint=z,t.unstable_runWithPriority=function(e,t){switch(e){case 1:case 2:case 3:case 4:case 5:break;default:e=3}var n=N;N=e;try{return t()}finally{N=n}},t.unstable_scheduleCallback=function(e,n,o){var l=t.unstable_now();switch("object"===typeof o&&null!==o?o="number"===typeof(o=o.delay)&&0<o?l+o:l:o=l,e){case 1:var s=-1;break;case 2:s=250;break;case 5:s=1073741823;break;case 4:s=1e4;break;default:s=5e3}return e={id:T++,callback:n,priorityLevel:e,startTime:o,expirationTime:s=o+s,sortIndex:-1},o>l?(e.sortIndex=o,S(P,e),null===M(O)&&e===M(P)&&(I?a():I=!0,i(j,o-l))):(e.sortIndex=s,S(O,e),A||R||(A=!0,r(F))),e},t.unstable_wrapCallback=function(e){var t=N;return function(){var n=N;N=t;try{return e.apply(this,arguments)}finally{N=n}}}},,,,function(e,t,n){},function(e,t,n){"use strict";n(35);var r=n(2),i=60103;if(t.Fragment=60107,"function"===typeof Symbol&&Symbol.for){var a=Symbol.for;i=a("react.element"),t.Fragment=a("react.fragment")}var o=r.__SECRET_INTERNALS_DO_NOT_USE_OR_YOU_WILL_BE_FIRED.ReactCurrentOwner,l=Object.prototype.hasOwnProperty,s={key:!0,ref:!0,__self:!0,__source:!0};function u(e,t,n){var r,a={},u=null,c=null;for(r in void 0!==n&&(u=""+n),void 0!==t.key&&(u=""+t.key),void 0!==t.ref&&(c=t.ref),t)l.call(t,r)&&!s.hasOwnProperty(r)&&(a[r]=t[r]);if(e&&e.defaultProps)for(r in t=e.defaultProps)void 0===a[r]&&(a[r]=t[r]);return{$$typeof:i,type:e,key:u,ref:c,props:a,_owner:o.current}}t.jsx=u,t.jsxs=u},function(e,t,n){"use strict";var r=n(89);function i(){}function a(){}a.resetWarningCache=i,e.exports=function(){function e(e,t,n,i,a,o){if(o!==r){var l=new Error("Calling PropTypes validators directly is not supported by the `prop-types` package. Use PropTypes.checkPropTypes() to call them. Read more at http://fb.me/use-check-prop-types");throw l.name="Invariant Violation",l}}function t(){return e}e.isRequired=e;var n={array:e,bool:e,func:e,number:e,object:e,string:e,symbol:e,any:e,arrayOf:t,element:e,elementType:e,instanceOf:t,node:e,objectOf:t,oneOf:t,oneOfType:t,shape:t,exact:t,checkPropTypes:a,resetWarningCache:i};return n.PropTypes=n,n}},function(e,t,n){"use strict";e.exports="SECRET_DO_NOT_PASS_THIS_OR_YOU_WILL_BE_FIRED"},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;!function(e){if(e&&e.__esModule)return e;var t={};if(null!=e)for(var n in e)if(Object.prototype.hasOwnProperty.call(e,n)){var r=Object.defineProperty&&Object.getOwnPropertyDescriptor?Object.getOwnPropertyDescriptor(e,n):{};r.get||r.set?Object.defineProperty(t,n,r):t[n]=e[n]}t.default=e}(n(1));var r=l(n(91)),i=l(n(94)),a=l(n(2)),o=l(n(52));n(54);function l(e){return e&&e.__esModule?e:{default:e}}function s(){return(s=Object.assign||function(e){for(var t=1;t<arguments.length;t++){var n=arguments[t];for(var r in n)Object.prototype.hasOwnProperty.call(n,r)&&(e[r]=n[r])}return e}).apply(this,arguments)}var u=function(e,t){return e&&t&&t.split(" ").forEach((function(t){return(0,r.default)(e,t)}))},c=function(e,t){return e&&t&&t.split(" ").forEach((function(t){return(0,i.default)(e,t)}))},d=function(e){var t,n;function r(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).onEnter=function(e,n){var r=t.getClassNames(n?"appear":"enter").className;t.removeClasses(e,"exit"),u(e,r),t.props.onEnter&&t.props.onEnter(e,n)},t.onEntering=function(e,n){var r=t.getClassNames(n?"appear":"enter").activeClassName;t.reflowAndAddClass(e,r),t.props.onEntering&&t.props.onEntering(e,n)},t.onEntered=function(e,n){var r=t.getClassNames("appear").doneClassName,i=t.getClassNames("enter").doneClassName,a=n?r+" "+i:i;t.removeClasses(e,n?"appear":"enter"),u(e,a),t.props.onEntered&&t.props.onEntered(e,n)},t.onExit=function(e){var n=t.getClassNames("exit").className;t.removeClasses(e,"appear"),t.removeClasses(e,"enter"),u(e,n),t.props.onExit&&t.props.onExit(e)},t.onExiting=function(e){var n=t.getClassNames("exit").activeClassName;t.reflowAndAddClass(e,n),t.props.onExiting&&t.props.onExiting(e)},t.onExited=function(e){var n=t.getClassNames("exit").doneClassName;t.removeClasses(e,"exit"),u(e,n),t.props.onExited&&t.props.onExited(e)},t.getClassNames=function(e){var n=t.props.classNames,r="string"===typeof n,i=r?(r&&n?n+"-":"")+e:n[e];return{className:i,activeClassName:r?i+"-active":n[e+"Active"],doneClassName:r?i+"-done":n[e+"Done"]}},t}n=e,(t=r).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var i=r.prototype;return i.removeClasses=function(e,t){var n=this.getClassNames(t),r=n.className,i=n.activeClassName,a=n.doneClassName;r&&c(e,r),i&&c(e,i),a&&c(e,a)},i.reflowAndAddClass=function(e,t){t&&(e&&e.scrollTop,u(e,t))},i.render=function(){var e=s({},this.props);return delete e.classNames,a.default.createElement(o.default,s({},e,{onEnter:this.onEnter,onEntered:this.onEntered,onEntering:this.onEntering,onExit:this.onExit,onExiting:this.onExiting,onExited:this.onExited}))},r}(a.default.Component);d.defaultProps={classNames:""},d.propTypes={};var f=d;t.default=f,e.exports=t.default},function(e,t,n){"use strict";var r=n(92);t.__esModule=!0,t.default=function(e,t){e.classList?e.classList.add(t):(0,i.default)(e,t)||("string"===typeof e.className?e.className=e.className+" "+t:e.setAttribute("class",(e.className&&e.className.baseVal||"")+" "+t))};var i=r(n(93));e.exports=t.default},function(e,t){e.exports=function(e){return e&&e.__esModule?e:{default:e}},e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";t.__esModule=!0,t.default=function(e,t){return e.classList?!!t&&e.classList.contains(t):-1!==(" "+(e.className.baseVal||e.className)+" ").indexOf(" "+t+" ")},e.exports=t.default},function(e,t,n){"use strict";function r(e,t){return e.replace(new RegExp("(^|\\s)"+t+"(?:\\s|$)","g"),"$1").replace(/\s+/g," ").replace(/^\s*|\s*$/g,"")}e.exports=function(e,t){e.classList?e.classList.remove(t):"string"===typeof e.className?e.className=r(e.className,t):e.setAttribute("class",r(e.className&&e.className.baseVal||"",t))}},function(e,t,n){"use strict";t.__esModule=!0,t.default=void 0;o(n(1));var r=o(n(2)),i=n(30),a=o(n(55));function o(e){return e&&e.__esModule?e:{default:e}}var l=function(e){var t,n;function o(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return(t=e.call.apply(e,[this].concat(r))||this).handleEnter=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEnter",0,n)},t.handleEntering=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEntering",0,n)},t.handleEntered=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onEntered",0,n)},t.handleExit=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExit",1,n)},t.handleExiting=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExiting",1,n)},t.handleExited=function(){for(var e=arguments.length,n=new Array(e),r=0;r<e;r++)n[r]=arguments[r];return t.handleLifecycle("onExited",1,n)},t}n=e,(t=o).prototype=Object.create(n.prototype),t.prototype.constructor=t,t.__proto__=n;var l=o.prototype;return l.handleLifecycle=function(e,t,n){var a,o=this.props.children,l=r.default.Children.toArray(o)[t];l.props[e]&&(a=l.props)[e].apply(a,n),this.props[e]&&this.props[e]((0,i.findDOMNode)(this))},l.render=function(){var e=this.props,t=e.children,n=e.in,i=function(e,t){if(null==e)return{};var n,r,i={},a=Object.keys(e);for(r=0;r<a.length;r++)n=a[r],t.indexOf(n)>=0||(i[n]=e[n]);return i}(e,["children","in"]),o=r.default.Children.toArray(t),l=o[0],s=o[1];return delete i.onEnter,delete i.onEntering,delete i.onEntered,delete i.onExit,delete i.onExiting,delete i.onExited,r.default.createElement(a.default,i,n?r.default.cloneElement(l,{key:"first",onEnter:this.handleEnter,onEntering:this.handleEntering,onEntered:this.handleEntered}):r.default.cloneElement(s,{key:"second",onEnter:this.handleExit,onEntering:this.handleExiting,onEntered:this.handleExited}))},o}(r.default.Component);l.propTypes={};var s=l;t.default=s,e.exports=t.default},function(e,t,n){"use strict";t.__esModule=!0,t.getChildMapping=i,t.mergeChildMappings=a,t.getInitialChildMapping=function(e,t){return i(e.children,(function(n){return(0,r.cloneElement)(n,{onExited:t.bind(null,n),in:!0,appear:o(n,"appear",e),enter:o(n,"enter",e),exit:o(n,"exit",e)})}))},t.getNextChildMapping=function(e,t,n){var l=i(e.children),s=a(t,l);return Object.keys(s).forEach((function(i){var a=s[i];if((0,r.isValidElement)(a)){var u=i in t,c=i in l,d=t[i],f=(0,r.isValidElement)(d)&&!d.props.in;!c||u&&!f?c||!u||f?c&&u&&(0,r.isValidElement)(d)&&(s[i]=(0,r.cloneElement)(a,{onExited:n.bind(null,a),in:d.props.in,exit:o(a,"exit",e),enter:o(a,"enter",e)})):s[i]=(0,r.cloneElement)(a,{in:!1}):s[i]=(0,r.cloneElement)(a,{onExited:n.bind(null,a),in:!0,exit:o(a,"exit",e),enter:o(a,"enter",e)})}})),s};var r=n(2);function i(e,t){var n=Object.create(null);return e&&r.Children.map(e,(function(e){return e})).forEach((function(e){n[e.key]=function(e){return t&&(0,r.isValidElement)(e)?t(e):e}(e)})),n}function a(e,t){function n(n){return n in t?t[n]:e[n]}e=e||{},t=t||{};var r,i=Object.create(null),a=[];for(var o in e)o in t?a.length&&(i[o]=a,a=[]):a.push(o);var l={};for(var s in t){if(i[s])for(r=0;r<i[s].length;r++){var u=i[s][r];l[i[s][r]]=n(u)}l[s]=n(s)}for(r=0;r<a.length;r++)l[a[r]]=n(a[r]);return l}function o(e,t,n){return null!=n[t]?n[t]:e.props[t]}},function(e,t){e.exports=Array.isArray||function(e){return"[object Array]"==Object.prototype.toString.call(e)}},function(e,t,n){"use strict";var r="function"===typeof Symbol&&Symbol.for,i=r?Symbol.for("react.element"):60103,a=r?Symbol.for("react.portal"):60106,o=r?Symbol.for("react.fragment"):60107,l=r?Symbol.for("react.strict_mode"):60108,s=r?Symbol.for("react.profiler"):60114,u=r?Symbol.for("react.provider"):60109,c=r?Symbol.for("react.context"):60110,d=r?Symbol.for("react.async_mode"):60111,f=r?Symbol.for("react.concurrent_mode"):60111,h=r?Symbol.for("react.forward_ref"):60112,p=r?Symbol.for("react.suspense"):60113,g=r?Symbol.for("react.suspense_list"):60120,m=r?Symbol.for("react.memo"):60115,v=r?Symbol.for("react.lazy"):60116,y=r?Symbol.for("react.block"):60121,b=r?Symbol.for("react.fundamental"):60117,x=r?Symbol.for("react.responder"):60118,w=r?Symbol.for("react.scope"):60119;function _(e){if("object"===typeof e&&null!==e){var t=e.$$typeof;switch(t){case i:switch(e=e.type){case d:case f:case o:case s:case l:case p:return e;default:switch(e=e&&e.$$typeof){case c:case h:case v:case m:case u:return e;default:return t}}case a:return t}}}function k(e){return _(e)===f}t.AsyncMode=d,t.ConcurrentMode=f,t.ContextConsumer=c,t.ContextProvider=u,t.Element=i,t.ForwardRef=h,t.Fragment=o,t.Lazy=v,t.Memo=m,t.Portal=a,t.Profiler=s,t.StrictMode=l,t.Suspense=p,t.isAsyncMode=function(e){return k(e)||_(e)===d},t.isConcurrentMode=k,t.isContextConsumer=function(e){return _(e)===c},t.isContextProvider=function(e){return _(e)===u},t.isElement=function(e){return"object"===typeof e&&null!==e&&e.$$typeof===i},t.isForwardRef=function(e){return _(e)===h},t.isFragment=function(e){return _(e)===o},t.isLazy=function(e){return _(e)===v},t.isMemo=function(e){return _(e)===m},t.isPortal=function(e){return _(e)===a},t.isProfiler=function(e){return _(e)===s},t.isStrictMode=function(e){return _(e)===l},t.isSuspense=function(e){return _(e)===p},t.isValidElementType=function(e){return"string"===typeof e||"function"===typeof e||e===o||e===f||e===s||e===l||e===p||e===g||"object"===typeof e&&null!==e&&(e.$$typeof===v||e.$$typeof===m||e.$$typeof===u||e.$$typeof===c||e.$$typeof===h||e.$$typeof===b||e.$$typeof===x||e.$$typeof===w||e.$$typeof===y)},t.typeOf=_},function(e,t){function n(t,r){return e.exports=n=Object.setPrototypeOf||function(e,t){return e.__proto__=t,e},e.exports.default=e.exports,e.exports.__esModule=!0,n(t,r)}e.exports=n,e.exports.default=e.exports,e.exports.__esModule=!0},function(e,t,n){"use strict";t.__esModule=!0;var r=n(2),i=(o(r),o(n(1))),a=o(n(101));o(n(47));function o(e){return e&&e.__esModule?e:{default:e}}function l(e,t){if(!(e instanceof t))throw new TypeError("Cannot call a class as a function")}function s(e,t){if(!e)throw new ReferenceError("this hasn't been initialised - super() hasn't been called");return!t||"object"!==typeof t&&"function"!==typeof t?e:t}function u(e,t){if("function"!==typeof t&&null!==t)throw new TypeError("Super expression must either be null or a function, not "+typeof t);e.prototype=Object.create(t&&t.prototype,{constructor:{value:e,enumerable:!1,writable:!0,configurable:!0}}),t&&(Object.setPrototypeOf?Object.setPrototypeOf(e,t):e.__proto__=t)}var c=1073741823;function d(e){var t=[];return{on:function(e){t.push(e)},off:function(e){t=t.filter((function(t){return t!==e}))},get:function(){return e},set:function(n,r){e=n,t.forEach((function(t){return t(e,r)}))}}}t.default=function(e,t){var n,o,f="__create-react-context-"+(0,a.default)()+"__",h=function(e){function n(){var t,r;l(this,n);for(var i=arguments.length,a=Array(i),o=0;o<i;o++)a[o]=arguments[o];return t=r=s(this,e.call.apply(e,[this].concat(a))),r.emitter=d(r.props.value),s(r,t)}return u(n,e),n.prototype.getChildContext=function(){var e;return(e={})[f]=this.emitter,e},n.prototype.componentWillReceiveProps=function(e){if(this.props.value!==e.value){var n=this.props.value,r=e.value,i=void 0;((a=n)===(o=r)?0!==a||1/a===1/o:a!==a&&o!==o)?i=0:(i="function"===typeof t?t(n,r):c,0!==(i|=0)&&this.emitter.set(e.value,i))}var a,o},n.prototype.render=function(){return this.props.children},n}(r.Component);h.childContextTypes=((n={})[f]=i.default.object.isRequired,n);var p=function(t){function n(){var e,r;l(this,n);for(var i=arguments.length,a=Array(i),o=0;o<i;o++)a[o]=arguments[o];return e=r=s(this,t.call.apply(t,[this].concat(a))),r.state={value:r.getValue()},r.onUpdate=function(e,t){0!==((0|r.observedBits)&t)&&r.setState({value:r.getValue()})},s(r,e)}return u(n,t),n.prototype.componentWillReceiveProps=function(e){var t=e.observedBits;this.observedBits=void 0===t||null===t?c:t},n.prototype.componentDidMount=function(){this.context[f]&&this.context[f].on(this.onUpdate);var e=this.props.observedBits;this.observedBits=void 0===e||null===e?c:e},n.prototype.componentWillUnmount=function(){this.context[f]&&this.context[f].off(this.onUpdate)},n.prototype.getValue=function(){return this.context[f]?this.context[f].get():e},n.prototype.render=function(){return(e=this.props.children,Array.isArray(e)?e[0]:e)(this.state.value);var e},n}(r.Component);return p.contextTypes=((o={})[f]=i.default.object,o),{Provider:h,Consumer:p}},e.exports=t.default},function(e,t,n){"use strict";(function(t){var n="__global_unique_id__";e.exports=function(){return t[n]=(t[n]||0)+1}}).call(this,n(36))},function(e,t){var n,r,i=e.exports={};function a(){throw new Error("setTimeout has not been defined")}function o(){throw new Error("clearTimeout has not been defined")}function l(e){if(n===setTimeout)return setTimeout(e,0);if((n===a||!n)&&setTimeout)return n=setTimeout,setTimeout(e,0);try{return n(e,0)}catch(t){try{return n.call(null,e,0)}catch(t){return n.call(this,e,0)}}}!function(){try{n="function"===typeof setTimeout?setTimeout:a}catch(e){n=a}try{r="function"===typeof clearTimeout?clearTimeout:o}catch(e){r=o}}();var s,u=[],c=!1,d=-1;function f(){c&&s&&(c=!1,s.length?u=s.concat(u):d=-1,u.length&&h())}function h(){if(!c){var e=l(f);c=!0;for(var t=u.length;t;){for(s=u,u=[];++d<t;)s&&s[d].run();d=-1,t=u.length}s=null,c=!1,function(e){if(r===clearTimeout)return clearTimeout(e);if((r===o||!r)&&clearTimeout)return r=clearTimeout,clearTimeout(e);try{r(e)}catch(t){try{return r.call(null,e)}catch(t){return r.call(this,e)}}}(e)}}function p(e,t){this.fun=e,this.array=t}function g(){}i.nextTick=function(e){var t=new Array(arguments.length-1);if(arguments.length>1)for(var n=1;n<arguments.length;n++)t[n-1]=arguments[n];u.push(new p(e,t)),1!==u.length||c||l(h)},p.prototype.run=function(){this.fun.apply(null,this.array)},i.title="browser",i.browser=!0,i.env={},i.argv=[],i.version="",i.versions={},i.on=g,i.addListener=g,i.once=g,i.off=g,i.removeListener=g,i.removeAllListeners=g,i.emit=g,i.prependListener=g,i.prependOnceListener=g,i.listeners=function(e){return[]},i.binding=function(e){throw new Error("process.binding is not supported")},i.cwd=function(){return"/"},i.chdir=function(e){throw new Error("process.chdir is not supported")},i.umask=function(){return 0}},function(e,t,n){var r=n(38);e.exports=function(e,t){return r(e,t)}},function(e,t,n){var r=n(59),i=n(64),a=n(138),o=n(142),l=n(160),s=n(14),u=n(66),c=n(68),d="[object Arguments]",f="[object Array]",h="[object Object]",p=Object.prototype.hasOwnProperty;e.exports=function(e,t,n,g,m,v){var y=s(e),b=s(t),x=y?f:l(e),w=b?f:l(t),_=(x=x==d?h:x)==h,k=(w=w==d?h:w)==h,S=x==w;if(S&&u(e)){if(!u(t))return!1;y=!0,_=!1}if(S&&!_)return v||(v=new r),y||c(e)?i(e,t,n,g,m,v):a(e,t,x,n,g,m,v);if(!(1&n)){var M=_&&p.call(e,"__wrapped__"),C=k&&p.call(t,"__wrapped__");if(M||C){var E=M?e.value():e,O=C?t.value():t;return v||(v=new r),m(E,O,n,g,v)}}return!!S&&(v||(v=new r),o(e,t,n,g,m,v))}},function(e,t){e.exports=function(){this.__data__=[],this.size=0}},function(e,t,n){var r=n(25),i=Array.prototype.splice;e.exports=function(e){var t=this.__data__,n=r(t,e);return!(n<0)&&(n==t.length-1?t.pop():i.call(t,n,1),--this.size,!0)}},function(e,t,n){var r=n(25);e.exports=function(e){var t=this.__data__,n=r(t,e);return n<0?void 0:t[n][1]}},function(e,t,n){var r=n(25);e.exports=function(e){return r(this.__data__,e)>-1}},function(e,t,n){var r=n(25);e.exports=function(e,t){var n=this.__data__,i=r(n,e);return i<0?(++this.size,n.push([e,t])):n[i][1]=t,this}},function(e,t,n){var r=n(24);e.exports=function(){this.__data__=new r,this.size=0}},function(e,t){e.exports=function(e){var t=this.__data__,n=t.delete(e);return this.size=t.size,n}},function(e,t){e.exports=function(e){return this.__data__.get(e)}},function(e,t){e.exports=function(e){return this.__data__.has(e)}},function(e,t,n){var r=n(24),i=n(39),a=n(41);e.exports=function(e,t){var n=this.__data__;if(n instanceof r){var o=n.__data__;if(!i||o.length<199)return o.push([e,t]),this.size=++n.size,this;n=this.__data__=new a(o)}return n.set(e,t),this.size=n.size,this}},function(e,t,n){var r=n(61),i=n(118),a=n(40),o=n(63),l=/^\[object .+?Constructor\]$/,s=Function.prototype,u=Object.prototype,c=s.toString,d=u.hasOwnProperty,f=RegExp("^"+c.call(d).replace(/[\\^$.*+?()[\]{}|]/g,"\\$&").replace(/hasOwnProperty|(function).*?(?=\\\()| for .+?(?=\\\])/g,"$1.*?")+"$");e.exports=function(e){return!(!a(e)||i(e))&&(r(e)?f:l).test(o(e))}},function(e,t,n){var r=n(26),i=Object.prototype,a=i.hasOwnProperty,o=i.toString,l=r?r.toStringTag:void 0;e.exports=function(e){var t=a.call(e,l),n=e[l];try{e[l]=void 0;var r=!0}catch(s){}var i=o.call(e);return r&&(t?e[l]=n:delete e[l]),i}},function(e,t){var n=Object.prototype.toString;e.exports=function(e){return n.call(e)}},function(e,t,n){var r=n(119),i=function(){var e=/[^.]+$/.exec(r&&r.keys&&r.keys.IE_PROTO||"");return e?"Symbol(src)_1."+e:""}();e.exports=function(e){return!!i&&i in e}},function(e,t,n){var r=n(13)["__core-js_shared__"];e.exports=r},function(e,t){e.exports=function(e,t){return null==e?void 0:e[t]}},function(e,t,n){var r=n(122),i=n(24),a=n(39);e.exports=function(){this.size=0,this.__data__={hash:new r,map:new(a||i),string:new r}}},function(e,t,n){var r=n(123),i=n(124),a=n(125),o=n(126),l=n(127);function s(e){var t=-1,n=null==e?0:e.length;for(this.clear();++t<n;){var r=e[t];this.set(r[0],r[1])}}s.prototype.clear=r,s.prototype.delete=i,s.prototype.get=a,s.prototype.has=o,s.prototype.set=l,e.exports=s},function(e,t,n){var r=n(27);e.exports=function(){this.__data__=r?r(null):{},this.size=0}},function(e,t){e.exports=function(e){var t=this.has(e)&&delete this.__data__[e];return this.size-=t?1:0,t}},function(e,t,n){var r=n(27),i=Object.prototype.hasOwnProperty;e.exports=function(e){var t=this.__data__;if(r){var n=t[e];return"__lodash_hash_undefined__"===n?void 0:n}return i.call(t,e)?t[e]:void 0}},function(e,t,n){var r=n(27),i=Object.prototype.hasOwnProperty;e.exports=function(e){var t=this.__data__;return r?void 0!==t[e]:i.call(t,e)}},function(e,t,n){var r=n(27);e.exports=function(e,t){var n=this.__data__;return this.size+=this.has(e)?0:1,n[e]=r&&void 0===t?"__lodash_hash_undefined__":t,this}},function(e,t,n){var r=n(28);e.exports=function(e){var t=r(this,e).delete(e);return this.size-=t?1:0,t}},function(e,t){e.exports=function(e){var t=typeof e;return"string"==t||"number"==t||"symbol"==t||"boolean"==t?"__proto__"!==e:null===e}},function(e,t,n){var r=n(28);e.exports=function(e){return r(this,e).get(e)}},function(e,t,n){var r=n(28);e.exports=function(e){return r(this,e).has(e)}},function(e,t,n){var r=n(28);e.exports=function(e,t){var n=r(this,e),i=n.size;return n.set(e,t),this.size+=n.size==i?0:1,this}},function(e,t,n){var r=n(41),i=n(134),a=n(135);function o(e){var t=-1,n=null==e?0:e.length;for(this.__data__=new r;++t<n;)this.add(e[t])}o.prototype.add=o.prototype.push=i,o.prototype.has=a,e.exports=o},function(e,t){e.exports=function(e){return this.__data__.set(e,"__lodash_hash_undefined__"),this}},function(e,t){e.exports=function(e){return this.__data__.has(e)}},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length;++n<r;)if(t(e[n],n,e))return!0;return!1}},function(e,t){e.exports=function(e,t){return e.has(t)}},function(e,t,n){var r=n(26),i=n(139),a=n(60),o=n(64),l=n(140),s=n(141),u=r?r.prototype:void 0,c=u?u.valueOf:void 0;e.exports=function(e,t,n,r,u,d,f){switch(n){case"[object DataView]":if(e.byteLength!=t.byteLength||e.byteOffset!=t.byteOffset)return!1;e=e.buffer,t=t.buffer;case"[object ArrayBuffer]":return!(e.byteLength!=t.byteLength||!d(new i(e),new i(t)));case"[object Boolean]":case"[object Date]":case"[object Number]":return a(+e,+t);case"[object Error]":return e.name==t.name&&e.message==t.message;case"[object RegExp]":case"[object String]":return e==t+"";case"[object Map]":var h=l;case"[object Set]":var p=1&r;if(h||(h=s),e.size!=t.size&&!p)return!1;var g=f.get(e);if(g)return g==t;r|=2,f.set(e,t);var m=o(h(e),h(t),r,u,d,f);return f.delete(e),m;case"[object Symbol]":if(c)return c.call(e)==c.call(t)}return!1}},function(e,t,n){var r=n(13).Uint8Array;e.exports=r},function(e,t){e.exports=function(e){var t=-1,n=Array(e.size);return e.forEach((function(e,r){n[++t]=[r,e]})),n}},function(e,t){e.exports=function(e){var t=-1,n=Array(e.size);return e.forEach((function(e){n[++t]=e})),n}},function(e,t,n){var r=n(143),i=Object.prototype.hasOwnProperty;e.exports=function(e,t,n,a,o,l){var s=1&n,u=r(e),c=u.length;if(c!=r(t).length&&!s)return!1;for(var d=c;d--;){var f=u[d];if(!(s?f in t:i.call(t,f)))return!1}var h=l.get(e),p=l.get(t);if(h&&p)return h==t&&p==e;var g=!0;l.set(e,t),l.set(t,e);for(var m=s;++d<c;){var v=e[f=u[d]],y=t[f];if(a)var b=s?a(y,v,f,t,e,l):a(v,y,f,e,t,l);if(!(void 0===b?v===y||o(v,y,n,a,l):b)){g=!1;break}m||(m="constructor"==f)}if(g&&!m){var x=e.constructor,w=t.constructor;x==w||!("constructor"in e)||!("constructor"in t)||"function"==typeof x&&x instanceof x&&"function"==typeof w&&w instanceof w||(g=!1)}return l.delete(e),l.delete(t),g}},function(e,t,n){var r=n(144),i=n(146),a=n(42);e.exports=function(e){return r(e,a,i)}},function(e,t,n){var r=n(145),i=n(14);e.exports=function(e,t,n){var a=t(e);return i(e)?a:r(a,n(e))}},function(e,t){e.exports=function(e,t){for(var n=-1,r=t.length,i=e.length;++n<r;)e[i+n]=t[n];return e}},function(e,t,n){var r=n(147),i=n(148),a=Object.prototype.propertyIsEnumerable,o=Object.getOwnPropertySymbols,l=o?function(e){return null==e?[]:(e=Object(e),r(o(e),(function(t){return a.call(e,t)})))}:i;e.exports=l},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length,i=0,a=[];++n<r;){var o=e[n];t(o,n,e)&&(a[i++]=o)}return a}},function(e,t){e.exports=function(){return[]}},function(e,t,n){var r=n(150),i=n(65),a=n(14),o=n(66),l=n(67),s=n(68),u=Object.prototype.hasOwnProperty;e.exports=function(e,t){var n=a(e),c=!n&&i(e),d=!n&&!c&&o(e),f=!n&&!c&&!d&&s(e),h=n||c||d||f,p=h?r(e.length,String):[],g=p.length;for(var m in e)!t&&!u.call(e,m)||h&&("length"==m||d&&("offset"==m||"parent"==m)||f&&("buffer"==m||"byteLength"==m||"byteOffset"==m)||l(m,g))||p.push(m);return p}},function(e,t){e.exports=function(e,t){for(var n=-1,r=Array(e);++n<e;)r[n]=t(n);return r}},function(e,t,n){var r=n(21),i=n(22);e.exports=function(e){return i(e)&&"[object Arguments]"==r(e)}},function(e,t){e.exports=function(){return!1}},function(e,t,n){var r=n(21),i=n(43),a=n(22),o={};o["[object Float32Array]"]=o["[object Float64Array]"]=o["[object Int8Array]"]=o["[object Int16Array]"]=o["[object Int32Array]"]=o["[object Uint8Array]"]=o["[object Uint8ClampedArray]"]=o["[object Uint16Array]"]=o["[object Uint32Array]"]=!0,o["[object Arguments]"]=o["[object Array]"]=o["[object ArrayBuffer]"]=o["[object Boolean]"]=o["[object DataView]"]=o["[object Date]"]=o["[object Error]"]=o["[object Function]"]=o["[object Map]"]=o["[object Number]"]=o["[object Object]"]=o["[object RegExp]"]=o["[object Set]"]=o["[object String]"]=o["[object WeakMap]"]=!1,e.exports=function(e){return a(e)&&i(e.length)&&!!o[r(e)]}},function(e,t){e.exports=function(e){return function(t){return e(t)}}},function(e,t,n){(function(e){var r=n(62),i=t&&!t.nodeType&&t,a=i&&"object"==typeof e&&e&&!e.nodeType&&e,o=a&&a.exports===i&&r.process,l=function(){try{var e=a&&a.require&&a.require("util").types;return e||o&&o.binding&&o.binding("util")}catch(t){}}();e.exports=l}).call(this,n(37)(e))},function(e,t,n){var r=n(157),i=n(158),a=Object.prototype.hasOwnProperty;e.exports=function(e){if(!r(e))return i(e);var t=[];for(var n in Object(e))a.call(e,n)&&"constructor"!=n&&t.push(n);return t}},function(e,t){var n=Object.prototype;e.exports=function(e){var t=e&&e.constructor;return e===("function"==typeof t&&t.prototype||n)}},function(e,t,n){var r=n(159)(Object.keys,Object);e.exports=r},function(e,t){e.exports=function(e,t){return function(n){return e(t(n))}}},function(e,t,n){var r=n(161),i=n(39),a=n(162),o=n(163),l=n(164),s=n(21),u=n(63),c="[object Map]",d="[object Promise]",f="[object Set]",h="[object WeakMap]",p="[object DataView]",g=u(r),m=u(i),v=u(a),y=u(o),b=u(l),x=s;(r&&x(new r(new ArrayBuffer(1)))!=p||i&&x(new i)!=c||a&&x(a.resolve())!=d||o&&x(new o)!=f||l&&x(new l)!=h)&&(x=function(e){var t=s(e),n="[object Object]"==t?e.constructor:void 0,r=n?u(n):"";if(r)switch(r){case g:return p;case m:return c;case v:return d;case y:return f;case b:return h}return t}),e.exports=x},function(e,t,n){var r=n(16)(n(13),"DataView");e.exports=r},function(e,t,n){var r=n(16)(n(13),"Promise");e.exports=r},function(e,t,n){var r=n(16)(n(13),"Set");e.exports=r},function(e,t,n){var r=n(16)(n(13),"WeakMap");e.exports=r},function(e,t,n){var r=n(166),i=n(168)((function(e,t,n){r(e,n,t)}));e.exports=i},function(e,t,n){var r=n(167);e.exports=function(e,t,n){"__proto__"==t&&r?r(e,t,{configurable:!0,enumerable:!0,value:n,writable:!0}):e[t]=n}},function(e,t,n){var r=n(16),i=function(){try{var e=r(Object,"defineProperty");return e({},"",{}),e}catch(t){}}();e.exports=i},function(e,t,n){var r=n(169),i=n(170),a=n(176),o=n(14);e.exports=function(e,t){return function(n,l){var s=o(n)?r:i,u=t?t():{};return s(n,e,a(l,2),u)}}},function(e,t){e.exports=function(e,t,n,r){for(var i=-1,a=null==e?0:e.length;++i<a;){var o=e[i];t(r,o,n(o),e)}return r}},function(e,t,n){var r=n(171);e.exports=function(e,t,n,i){return r(e,(function(e,r,a){t(i,e,n(e),a)})),i}},function(e,t,n){var r=n(172),i=n(175)(r);e.exports=i},function(e,t,n){var r=n(173),i=n(42);e.exports=function(e,t){return e&&r(e,t,i)}},function(e,t,n){var r=n(174)();e.exports=r},function(e,t){e.exports=function(e){return function(t,n,r){for(var i=-1,a=Object(t),o=r(t),l=o.length;l--;){var s=o[e?l:++i];if(!1===n(a[s],s,a))break}return t}}},function(e,t,n){var r=n(69);e.exports=function(e,t){return function(n,i){if(null==n)return n;if(!r(n))return e(n,i);for(var a=n.length,o=t?a:-1,l=Object(n);(t?o--:++o<a)&&!1!==i(l[o],o,l););return n}}},function(e,t,n){var r=n(177),i=n(180),a=n(191),o=n(14),l=n(192);e.exports=function(e){return"function"==typeof e?e:null==e?a:"object"==typeof e?o(e)?i(e[0],e[1]):r(e):l(e)}},function(e,t,n){var r=n(178),i=n(179),a=n(71);e.exports=function(e){var t=i(e);return 1==t.length&&t[0][2]?a(t[0][0],t[0][1]):function(n){return n===e||r(n,e,t)}}},function(e,t,n){var r=n(59),i=n(38);e.exports=function(e,t,n,a){var o=n.length,l=o,s=!a;if(null==e)return!l;for(e=Object(e);o--;){var u=n[o];if(s&&u[2]?u[1]!==e[u[0]]:!(u[0]in e))return!1}for(;++o<l;){var c=(u=n[o])[0],d=e[c],f=u[1];if(s&&u[2]){if(void 0===d&&!(c in e))return!1}else{var h=new r;if(a)var p=a(d,f,c,e,t,h);if(!(void 0===p?i(f,d,3,a,h):p))return!1}}return!0}},function(e,t,n){var r=n(70),i=n(42);e.exports=function(e){for(var t=i(e),n=t.length;n--;){var a=t[n],o=e[a];t[n]=[a,o,r(o)]}return t}},function(e,t,n){var r=n(38),i=n(181),a=n(188),o=n(44),l=n(70),s=n(71),u=n(29);e.exports=function(e,t){return o(e)&&l(t)?s(u(e),t):function(n){var o=i(n,e);return void 0===o&&o===t?a(n,e):r(t,o,3)}}},function(e,t,n){var r=n(72);e.exports=function(e,t,n){var i=null==e?void 0:r(e,t);return void 0===i?n:i}},function(e,t,n){var r=n(183),i=/[^.[\]]+|\[(?:(-?\d+(?:\.\d+)?)|(["'])((?:(?!\2)[^\\]|\\.)*?)\2)\]|(?=(?:\.|\[\])(?:\.|\[\]|$))/g,a=/\\(\\)?/g,o=r((function(e){var t=[];return 46===e.charCodeAt(0)&&t.push(""),e.replace(i,(function(e,n,r,i){t.push(r?i.replace(a,"$1"):n||e)})),t}));e.exports=o},function(e,t,n){var r=n(184);e.exports=function(e){var t=r(e,(function(e){return 500===n.size&&n.clear(),e})),n=t.cache;return t}},function(e,t,n){var r=n(41);function i(e,t){if("function"!=typeof e||null!=t&&"function"!=typeof t)throw new TypeError("Expected a function");var n=function n(){var r=arguments,i=t?t.apply(this,r):r[0],a=n.cache;if(a.has(i))return a.get(i);var o=e.apply(this,r);return n.cache=a.set(i,o)||a,o};return n.cache=new(i.Cache||r),n}i.Cache=r,e.exports=i},function(e,t,n){var r=n(186);e.exports=function(e){return null==e?"":r(e)}},function(e,t,n){var r=n(26),i=n(187),a=n(14),o=n(45),l=r?r.prototype:void 0,s=l?l.toString:void 0;e.exports=function e(t){if("string"==typeof t)return t;if(a(t))return i(t,e)+"";if(o(t))return s?s.call(t):"";var n=t+"";return"0"==n&&1/t==-Infinity?"-0":n}},function(e,t){e.exports=function(e,t){for(var n=-1,r=null==e?0:e.length,i=Array(r);++n<r;)i[n]=t(e[n],n,e);return i}},function(e,t,n){var r=n(189),i=n(190);e.exports=function(e,t){return null!=e&&i(e,t,r)}},function(e,t){e.exports=function(e,t){return null!=e&&t in Object(e)}},function(e,t,n){var r=n(73),i=n(65),a=n(14),o=n(67),l=n(43),s=n(29);e.exports=function(e,t,n){for(var u=-1,c=(t=r(t,e)).length,d=!1;++u<c;){var f=s(t[u]);if(!(d=null!=e&&n(e,f)))break;e=e[f]}return d||++u!=c?d:!!(c=null==e?0:e.length)&&l(c)&&o(f,c)&&(a(e)||i(e))}},function(e,t){e.exports=function(e){return e}},function(e,t,n){var r=n(193),i=n(194),a=n(44),o=n(29);e.exports=function(e){return a(e)?r(o(e)):i(e)}},function(e,t){e.exports=function(e){return function(t){return null==t?void 0:t[e]}}},function(e,t,n){var r=n(72);e.exports=function(e){return function(t){return r(t,e)}}},,function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={light:s.a.bool,dark:s.a.bool,full:s.a.bool,fixed:s.a.string,sticky:s.a.string,color:s.a.string,role:s.a.string,tag:d.i,className:s.a.string,cssModule:s.a.object,expand:s.a.oneOfType([s.a.bool,s.a.string])},h=function(e){var t,n=e.expand,a=e.className,l=e.cssModule,s=e.light,u=e.dark,f=e.fixed,h=e.sticky,p=e.color,g=e.tag,m=Object(i.a)(e,["expand","className","cssModule","light","dark","fixed","sticky","color","tag"]),v=Object(d.f)(c()(a,"navbar",function(e){return!1!==e&&(!0===e||"xs"===e?"navbar-expand":"navbar-expand-"+e)}(n),((t={"navbar-light":s,"navbar-dark":u})["bg-"+p]=p,t["fixed-"+f]=f,t["sticky-"+h]=h,t)),l);return o.a.createElement(g,Object(r.a)({},m,{className:v}))};h.propTypes=f,h.defaultProps={tag:"nav",expand:!1},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,fluid:s.a.oneOfType([s.a.bool,s.a.string]),className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.fluid,l=e.tag,s=Object(i.a)(e,["className","cssModule","fluid","tag"]),u="container";!0===a?u="container-fluid":a&&(u="container-"+a);var f=Object(d.f)(c()(t,u),n);return o.a.createElement(l,Object(r.a)({},s,{className:f}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,type:s.a.string,className:s.a.string,cssModule:s.a.object,children:s.a.node},h=function(e){var t=e.className,n=e.cssModule,a=e.children,l=e.tag,s=Object(i.a)(e,["className","cssModule","children","tag"]),u=Object(d.f)(c()(t,"navbar-toggler"),n);return o.a.createElement(l,Object(r.a)({"aria-label":"Toggle navigation"},s,{className:u}),a||o.a.createElement("span",{className:Object(d.f)("navbar-toggler-icon",n)}))};h.propTypes=f,h.defaultProps={tag:"button",type:"button"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"navbar-brand"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"a"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tabs:s.a.bool,pills:s.a.bool,vertical:s.a.oneOfType([s.a.bool,s.a.string]),horizontal:s.a.string,justified:s.a.bool,fill:s.a.bool,navbar:s.a.bool,card:s.a.bool,tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tabs,l=e.pills,s=e.vertical,u=e.horizontal,f=e.justified,h=e.fill,p=e.navbar,g=e.card,m=e.tag,v=Object(i.a)(e,["className","cssModule","tabs","pills","vertical","horizontal","justified","fill","navbar","card","tag"]),y=Object(d.f)(c()(t,p?"navbar-nav":"nav",!!u&&"justify-content-"+u,function(e){return!1!==e&&(!0===e||"xs"===e?"flex-column":"flex-"+e+"-column")}(s),{"nav-tabs":a,"card-header-tabs":g&&a,"nav-pills":l,"card-header-pills":g&&l,"nav-justified":f,"nav-fill":h}),n);return o.a.createElement(m,Object(r.a)({},v,{className:y}))};h.propTypes=f,h.defaultProps={tag:"ul",vertical:!1},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(3),p={tag:h.i,innerRef:c.a.oneOfType([c.a.object,c.a.func,c.a.string]),disabled:c.a.bool,active:c.a.bool,className:c.a.string,cssModule:c.a.object,onClick:c.a.func,href:c.a.any},g=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){this.props.disabled?e.preventDefault():("#"===this.props.href&&e.preventDefault(),this.props.onClick&&this.props.onClick(e))},n.render=function(){var e=this.props,t=e.className,n=e.cssModule,a=e.active,o=e.tag,l=e.innerRef,u=Object(i.a)(e,["className","cssModule","active","tag","innerRef"]),c=Object(h.f)(f()(t,"nav-link",{disabled:u.disabled,active:a}),n);return s.a.createElement(o,Object(r.a)({},u,{ref:l,onClick:this.onClick,className:c}))},t}(s.a.Component);g.propTypes=p,g.defaultProps={tag:"a"},t.a=g},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(50),f=n(5),h=n.n(f),p=n(31),g=n(3),m={a11y:c.a.bool,disabled:c.a.bool,direction:c.a.oneOf(["up","down","left","right"]),group:c.a.bool,isOpen:c.a.bool,nav:c.a.bool,active:c.a.bool,addonType:c.a.oneOfType([c.a.bool,c.a.oneOf(["prepend","append"])]),size:c.a.string,tag:g.i,toggle:c.a.func,children:c.a.node,className:c.a.string,cssModule:c.a.object,inNavbar:c.a.bool,setActiveFromChild:c.a.bool},v=[g.e.space,g.e.enter,g.e.up,g.e.down,g.e.end,g.e.home],y=function(e){function t(t){var n;return(n=e.call(this,t)||this).addEvents=n.addEvents.bind(Object(a.a)(n)),n.handleDocumentClick=n.handleDocumentClick.bind(Object(a.a)(n)),n.handleKeyDown=n.handleKeyDown.bind(Object(a.a)(n)),n.removeEvents=n.removeEvents.bind(Object(a.a)(n)),n.toggle=n.toggle.bind(Object(a.a)(n)),n.containerRef=s.a.createRef(),n}Object(o.a)(t,e);var n=t.prototype;return n.getContextValue=function(){return{toggle:this.toggle,isOpen:this.props.isOpen,direction:"down"===this.props.direction&&this.props.dropup?"up":this.props.direction,inNavbar:this.props.inNavbar,disabled:this.props.disabled}},n.componentDidMount=function(){this.handleProps()},n.componentDidUpdate=function(e){this.props.isOpen!==e.isOpen&&this.handleProps()},n.componentWillUnmount=function(){this.removeEvents()},n.getContainer=function(){return this.containerRef.current},n.getMenuCtrl=function(){return this._$menuCtrl||(this._$menuCtrl=this.getContainer().querySelector("[aria-expanded]")),this._$menuCtrl},n.getMenuItems=function(){return[].slice.call(this.getContainer().querySelectorAll('[role="menuitem"]'))},n.addEvents=function(){var e=this;["click","touchstart","keyup"].forEach((function(t){return document.addEventListener(t,e.handleDocumentClick,!0)}))},n.removeEvents=function(){var e=this;["click","touchstart","keyup"].forEach((function(t){return document.removeEventListener(t,e.handleDocumentClick,!0)}))},n.handleDocumentClick=function(e){if(!e||3!==e.which&&("keyup"!==e.type||e.which===g.e.tab)){var t=this.getContainer();(!t.contains(e.target)||t===e.target||"keyup"===e.type&&e.which!==g.e.tab)&&this.toggle(e)}},n.handleKeyDown=function(e){var t=this;if(!/input|textarea/i.test(e.target.tagName)&&(g.e.tab!==e.which||"menuitem"===e.target.getAttribute("role")&&this.props.a11y)&&((-1!==v.indexOf(e.which)||e.which>=48&&e.which<=90)&&e.preventDefault(),!this.props.disabled&&(this.getMenuCtrl()===e.target&&(!this.props.isOpen&&[g.e.space,g.e.enter,g.e.up,g.e.down].indexOf(e.which)>-1?(this.toggle(e),setTimeout((function(){return t.getMenuItems()[0].focus()}))):this.props.isOpen&&e.which===g.e.esc&&this.toggle(e)),this.props.isOpen&&"menuitem"===e.target.getAttribute("role"))))if([g.e.tab,g.e.esc].indexOf(e.which)>-1)this.toggle(e),this.getMenuCtrl().focus();else if([g.e.space,g.e.enter].indexOf(e.which)>-1)e.target.click(),this.getMenuCtrl().focus();else if([g.e.down,g.e.up].indexOf(e.which)>-1||[g.e.n,g.e.p].indexOf(e.which)>-1&&e.ctrlKey){var n=this.getMenuItems(),r=n.indexOf(e.target);g.e.up===e.which||g.e.p===e.which&&e.ctrlKey?r=0!==r?r-1:n.length-1:(g.e.down===e.which||g.e.n===e.which&&e.ctrlKey)&&(r=r===n.length-1?0:r+1),n[r].focus()}else if(g.e.end===e.which){var i=this.getMenuItems();i[i.length-1].focus()}else if(g.e.home===e.which){this.getMenuItems()[0].focus()}else if(e.which>=48&&e.which<=90)for(var a=this.getMenuItems(),o=String.fromCharCode(e.which).toLowerCase(),l=0;l<a.length;l+=1){if((a[l].textContent&&a[l].textContent[0].toLowerCase())===o){a[l].focus();break}}},n.handleProps=function(){this.props.isOpen?this.addEvents():this.removeEvents()},n.toggle=function(e){return this.props.disabled?e&&e.preventDefault():this.props.toggle(e)},n.render=function(){var e,t,n=Object(g.g)(this.props,["toggle","disabled","inNavbar","a11y"]),a=n.className,o=n.cssModule,l=n.direction,u=n.isOpen,c=n.group,f=n.size,m=n.nav,v=n.setActiveFromChild,y=n.active,b=n.addonType,x=n.tag,w=Object(i.a)(n,["className","cssModule","direction","isOpen","group","size","nav","setActiveFromChild","active","addonType","tag"]),_=x||(m?"li":"div"),k=!1;v&&s.a.Children.map(this.props.children[1].props.children,(function(e){e&&e.props.active&&(k=!0)}));var S=Object(g.f)(h()(a,"down"!==l&&"drop"+l,!(!m||!y)&&"active",!(!v||!k)&&"active",((e={})["input-group-"+b]=b,e["btn-group"]=c,e["btn-group-"+f]=!!f,e.dropdown=!c&&!b,e.show=u,e["nav-item"]=m,e)),o);return s.a.createElement(p.a.Provider,{value:this.getContextValue()},s.a.createElement(d.b,null,s.a.createElement(_,Object(r.a)({},w,((t={})["string"===typeof _?"ref":"innerRef"]=this.containerRef,t),{onKeyDown:this.handleKeyDown,className:S}))))},t}(s.a.Component);y.propTypes=m,y.defaultProps={a11y:!0,isOpen:!1,direction:"down",nav:!1,active:!1,addonType:!1,inNavbar:!1,setActiveFromChild:!1},t.a=y},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={color:s.a.string,pill:s.a.bool,tag:d.i,innerRef:s.a.oneOfType([s.a.object,s.a.func,s.a.string]),children:s.a.node,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.color,l=e.innerRef,s=e.pill,u=e.tag,f=Object(i.a)(e,["className","cssModule","color","innerRef","pill","tag"]),h=Object(d.f)(c()(t,"badge","badge-"+a,!!s&&"badge-pill"),n);return f.href&&"span"===u&&(u="a"),o.a.createElement(u,Object(r.a)({},f,{className:h,ref:l}))};h.propTypes=f,h.defaultProps={color:"secondary",pill:!1,tag:"span"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f=s.a.oneOfType([s.a.number,s.a.string]),h={tag:d.i,noGutters:s.a.bool,className:s.a.string,cssModule:s.a.object,form:s.a.bool,xs:f,sm:f,md:f,lg:f,xl:f},p={tag:"div",widths:["xs","sm","md","lg","xl"]},g=function(e){var t=e.className,n=e.cssModule,a=e.noGutters,l=e.tag,s=e.form,u=e.widths,f=Object(i.a)(e,["className","cssModule","noGutters","tag","form","widths"]),h=[];u.forEach((function(t,n){var r=e[t];if(delete f[t],r){var i=!n;h.push(i?"row-cols-"+r:"row-cols-"+t+"-"+r)}}));var p=Object(d.f)(c()(t,a?"no-gutters":null,s?"form-row":"row",h),n);return o.a.createElement(l,Object(r.a)({},f,{className:p}))};g.propTypes=h,g.defaultProps=p,t.a=g},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f=s.a.oneOfType([s.a.number,s.a.string]),h=s.a.oneOfType([s.a.bool,s.a.number,s.a.string,s.a.shape({size:s.a.oneOfType([s.a.bool,s.a.number,s.a.string]),order:f,offset:f})]),p={tag:d.i,xs:h,sm:h,md:h,lg:h,xl:h,className:s.a.string,cssModule:s.a.object,widths:s.a.array},g={tag:"div",widths:["xs","sm","md","lg","xl"]},m=function(e,t,n){return!0===n||""===n?e?"col":"col-"+t:"auto"===n?e?"col-auto":"col-"+t+"-auto":e?"col-"+n:"col-"+t+"-"+n},v=function(e){var t=e.className,n=e.cssModule,a=e.widths,l=e.tag,s=Object(i.a)(e,["className","cssModule","widths","tag"]),u=[];a.forEach((function(t,r){var i=e[t];if(delete s[t],i||""===i){var a=!r;if(Object(d.d)(i)){var o,l=a?"-":"-"+t+"-",f=m(a,t,i.size);u.push(Object(d.f)(c()(((o={})[f]=i.size||""===i.size,o["order"+l+i.order]=i.order||0===i.order,o["offset"+l+i.offset]=i.offset||0===i.offset,o)),n))}else{var h=m(a,t,i);u.push(h)}}})),u.length||u.push("col");var f=Object(d.f)(c()(t,u),n);return o.a.createElement(l,Object(r.a)({},s,{className:f}))};v.propTypes=p,v.defaultProps=g,t.a=v},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,inverse:s.a.bool,color:s.a.string,body:s.a.bool,outline:s.a.bool,className:s.a.string,cssModule:s.a.object,innerRef:s.a.oneOfType([s.a.object,s.a.string,s.a.func])},h=function(e){var t=e.className,n=e.cssModule,a=e.color,l=e.body,s=e.inverse,u=e.outline,f=e.tag,h=e.innerRef,p=Object(i.a)(e,["className","cssModule","color","body","inverse","outline","tag","innerRef"]),g=Object(d.f)(c()(t,"card",!!s&&"text-white",!!l&&"card-body",!!a&&(u?"border":"bg")+"-"+a),n);return o.a.createElement(f,Object(r.a)({},p,{className:g,ref:h}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"card-header"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.tag,l=Object(i.a)(e,["className","cssModule","tag"]),s=Object(d.f)(c()(t,"card-title"),n);return o.a.createElement(a,Object(r.a)({},l,{className:s}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,top:s.a.bool,bottom:s.a.bool,className:s.a.string,cssModule:s.a.object},h=function(e){var t=e.className,n=e.cssModule,a=e.top,l=e.bottom,s=e.tag,u=Object(i.a)(e,["className","cssModule","top","bottom","tag"]),f="card-img";a&&(f="card-img-top"),l&&(f="card-img-bottom");var h=Object(d.f)(c()(t,f),n);return o.a.createElement(s,Object(r.a)({},u,{className:h}))};h.propTypes=f,h.defaultProps={tag:"img"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(2),o=n.n(a),l=n(1),s=n.n(l),u=n(5),c=n.n(u),d=n(3),f={tag:d.i,className:s.a.string,cssModule:s.a.object,innerRef:s.a.oneOfType([s.a.object,s.a.string,s.a.func])},h=function(e){var t=e.className,n=e.cssModule,a=e.innerRef,l=e.tag,s=Object(i.a)(e,["className","cssModule","innerRef","tag"]),u=Object(d.f)(c()(t,"card-body"),n);return o.a.createElement(l,Object(r.a)({},s,{className:u,ref:a}))};h.propTypes=f,h.defaultProps={tag:"div"},t.a=h},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7);function l(e,t,n){return t in e?Object.defineProperty(e,t,{value:n,enumerable:!0,configurable:!0,writable:!0}):e[t]=n,e}var s,u=n(2),c=n.n(u),d=n(1),f=n.n(d),h=n(5),p=n.n(h),g=n(33),m=n(3);function v(e,t){var n=Object.keys(e);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(e);t&&(r=r.filter((function(t){return Object.getOwnPropertyDescriptor(e,t).enumerable}))),n.push.apply(n,r)}return n}function y(e){for(var t=1;t<arguments.length;t++){var n=null!=arguments[t]?arguments[t]:{};t%2?v(Object(n),!0).forEach((function(t){l(e,t,n[t])})):Object.getOwnPropertyDescriptors?Object.defineProperties(e,Object.getOwnPropertyDescriptors(n)):v(Object(n)).forEach((function(t){Object.defineProperty(e,t,Object.getOwnPropertyDescriptor(n,t))}))}return e}var b=y(y({},g.Transition.propTypes),{},{isOpen:f.a.bool,children:f.a.oneOfType([f.a.arrayOf(f.a.node),f.a.node]),tag:m.i,className:f.a.node,navbar:f.a.bool,cssModule:f.a.object,innerRef:f.a.oneOfType([f.a.func,f.a.string,f.a.object])}),x=y(y({},g.Transition.defaultProps),{},{isOpen:!1,appear:!1,enter:!0,exit:!0,tag:"div",timeout:m.c.Collapse}),w=((s={})[m.b.ENTERING]="collapsing",s[m.b.ENTERED]="collapse show",s[m.b.EXITING]="collapsing",s[m.b.EXITED]="collapse",s);function _(e){return e.scrollHeight}var k=function(e){function t(t){var n;return(n=e.call(this,t)||this).state={height:null},["onEntering","onEntered","onExit","onExiting","onExited"].forEach((function(e){n[e]=n[e].bind(Object(a.a)(n))})),n}Object(o.a)(t,e);var n=t.prototype;return n.onEntering=function(e,t){this.setState({height:_(e)}),this.props.onEntering(e,t)},n.onEntered=function(e,t){this.setState({height:null}),this.props.onEntered(e,t)},n.onExit=function(e){this.setState({height:_(e)}),this.props.onExit(e)},n.onExiting=function(e){e.offsetHeight;this.setState({height:0}),this.props.onExiting(e)},n.onExited=function(e){this.setState({height:null}),this.props.onExited(e)},n.render=function(){var e=this,t=this.props,n=t.tag,a=t.isOpen,o=t.className,l=t.navbar,s=t.cssModule,u=t.children,d=(t.innerRef,Object(i.a)(t,["tag","isOpen","className","navbar","cssModule","children","innerRef"])),f=this.state.height,h=Object(m.h)(d,m.a),v=Object(m.g)(d,m.a);return c.a.createElement(g.Transition,Object(r.a)({},h,{in:a,onEntering:this.onEntering,onEntered:this.onEntered,onExit:this.onExit,onExiting:this.onExiting,onExited:this.onExited}),(function(t){var i=function(e){return w[e]||"collapse"}(t),a=Object(m.f)(p()(o,i,l&&"navbar-collapse"),s),d=null===f?null:{height:f};return c.a.createElement(n,Object(r.a)({},v,{style:y(y({},v.style),d),className:a,ref:e.props.innerRef}),u)}))},t}(u.Component);k.propTypes=b,k.defaultProps=x;t.a=k},function(e,t,n){"use strict";var r=n(4),i=n(6),a=n(10),o=n(7),l=n(2),s=n.n(l),u=n(1),c=n.n(u),d=n(5),f=n.n(d),h=n(76),p=n.n(h),g=n(32),m=n.n(g),v=n(15),y=n.n(v),b=n(23),x=n.n(b),w=n(47),_=n.n(w),k=n(50),S=function(e){if("function"===typeof e){for(var t=arguments.length,n=new Array(t>1?t-1:0),r=1;r<t;r++)n[r-1]=arguments[r];return e.apply(void 0,n)}},M=function(e,t){if("function"===typeof e)return S(e,t);null!=e&&(e.current=t)},C=function(e){function t(){for(var t,n=arguments.length,r=new Array(n),i=0;i<n;i++)r[i]=arguments[i];return t=e.call.apply(e,[this].concat(r))||this,x()(y()(y()(t)),"refHandler",(function(e){M(t.props.innerRef,e),S(t.props.setReferenceNode,e)})),t}m()(t,e);var n=t.prototype;return n.componentWillUnmount=function(){M(this.props.innerRef,null)},n.render=function(){return _()(Boolean(this.props.setReferenceNode),"`Reference` should not be used outside of a `Manager` component."),(e=this.props.children,Array.isArray(e)?e[0]:e)({ref:this.refHandler});var e},t}(l.Component);function E(e){return l.createElement(k.a.Consumer,null,(function(t){return l.createElement(C,p()({setReferenceNode:t},e))}))}var O=n(31),P=n(3),T=n(75),D={caret:c.a.bool,color:c.a.string,children:c.a.node,className:c.a.string,cssModule:c.a.object,disabled:c.a.bool,onClick:c.a.func,"aria-haspopup":c.a.bool,split:c.a.bool,tag:P.i,nav:c.a.bool},N=function(e){function t(t){var n;return(n=e.call(this,t)||this).onClick=n.onClick.bind(Object(a.a)(n)),n}Object(o.a)(t,e);var n=t.prototype;return n.onClick=function(e){this.props.disabled||this.context.disabled?e.preventDefault():(this.props.nav&&!this.props.tag&&e.preventDefault(),this.props.onClick&&this.props.onClick(e),this.context.toggle(e))},n.render=function(){var e,t=this,n=this.props,a=n.className,o=n.color,l=n.cssModule,u=n.caret,c=n.split,d=n.nav,h=n.tag,p=n.innerRef,g=Object(i.a)(n,["className","color","cssModule","caret","split","nav","tag","innerRef"]),m=g["aria-label"]||"Toggle Dropdown",v=Object(P.f)(f()(a,{"dropdown-toggle":u||c,"dropdown-toggle-split":c,"nav-link":d}),l),y="undefined"!==typeof g.children?g.children:s.a.createElement("span",{className:"sr-only"},m);return d&&!h?(e="a",g.href="#"):h?e=h:(e=T.a,g.color=o,g.cssModule=l),this.context.inNavbar?s.a.createElement(e,Object(r.a)({},g,{className:v,onClick:this.onClick,"aria-expanded":this.context.isOpen,children:y})):s.a.createElement(E,{innerRef:p},(function(n){var i,a=n.ref;return s.a.createElement(e,Object(r.a)({},g,((i={})["string"===typeof e?"ref":"innerRef"]=a,i),{className:v,onClick:t.onClick,"aria-expanded":t.context.isOpen,children:y}))}))},t}(s.a.Component);N.propTypes=D,N.defaultProps={"aria-haspopup":!0,color:"secondary"},N.contextType=O.a;t.a=N}]]);
\ No newline at end of file
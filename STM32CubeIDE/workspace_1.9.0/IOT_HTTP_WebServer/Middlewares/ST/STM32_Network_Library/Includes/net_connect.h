@@ -126,6 +126,15 @@ typedef enum
 
 typedef struct pbuf net_buf_t;
 
+/**
+  * @brief  One of the buffers sent at once by net_sendv, same layout as struct iovec
+  */
+typedef struct net_iovec_s
+{
+  void     *iov_base;  /**< buffer start */
+  uint32_t iov_len;    /**< buffer length in byte */
+} net_iovec_t;
+
 
 /**
   *  TOPPP transition are requested by application. "ING" state are transitioning state, meaning that application has required a transition and
@@ -315,6 +324,7 @@ int32_t net_if_wakeup(net_if_handle_t *pnetif);
 #define net_connect             lwip_connect
 #define net_listen              lwip_listen
 #define net_send                lwip_send
+#define net_sendv(sock, iov, iovcnt, flags) lwip_writev((sock), (const struct iovec *)(iov), (iovcnt))
 #define net_recv                lwip_recv
 #define net_sendto              lwip_sendto
 #define net_recvfrom            lwip_recvfrom
@@ -333,6 +343,7 @@ int32_t net_getsockopt(int32_t sock, int32_t level, net_socketoption_t optname,
 int32_t net_connect(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen);
 int32_t net_listen(int32_t sock, int32_t backlog);
 int32_t net_send(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags);
+int32_t net_sendv(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags);
 int32_t net_recv(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in);
 int32_t net_sendto(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags, net_sockaddr_t *to, uint32_t tolen);
 int32_t net_recvfrom(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in, net_sockaddr_t *from,
@@ -106,6 +106,7 @@ struct net_if_drv_s
   int32_t (* paccept)(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen);
   int32_t (* pconnect)(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen);
   int32_t (* psend)(int32_t sock, uint8_t *buf, int32_t len, int32_t flags);
+  int32_t (* psendv)(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags);
   int32_t (* precv)(int32_t sock, uint8_t *buf, int32_t len, int32_t flags);
   int32_t (* psendto)(int32_t sock, uint8_t *buf, int32_t len, int32_t flags, net_sockaddr_t *to, uint32_t tolen);
   int32_t (* precvfrom)(int32_t sock, uint8_t *buf, int32_t len, int32_t flags, net_sockaddr_t *from, uint32_t *flen);
@@ -509,6 +509,109 @@ int32_t net_send(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags)
 }
 
 
+/**
+  * @brief  send several buffers at once to a connected socket, as a single buffer holding them one after the other
+  *         when the interface driver supports it, else one buffer after the other up to the first partial send
+  * @param  sock [in] integer source socket number
+  * @param  iov [in] pointer to an array of buffers
+  * @param  iovcnt [in] number of buffers
+  * @param  flags [in] specify blocking or non blocking , 0 is blocking mode, NET_MSG_DONTWAIT is non blocking
+  * @retval number of byte transmitted, negative value in case of error or timeout
+  */
+int32_t net_sendv(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags)
+{
+  int32_t ret = NET_ERROR_FRAMEWORK;
+  int32_t sent;
+  net_socket_t *pSocket;
+
+  if (!is_valid_socket(sock))
+  {
+    NET_DBG_ERROR("Invalid socket.\n");
+    ret = NET_ERROR_INVALID_SOCKET;
+  }
+  else
+  {
+    if ((iov == NULL) || (iovcnt <= 0))
+    {
+      ret = NET_ERROR_INVALID_SOCKET;
+    }
+    else
+    {
+      if (check_low_level_socket(sock) < 0)
+      {
+        NET_DBG_ERROR("low level socket has not been created.\n");
+        ret = NET_ERROR_SOCKET_FAILURE;
+      }
+      else
+      {
+        pSocket = net_socket_get_and_lock(sock);
+
+#ifdef NET_MBEDTLS_HOST_SUPPORT
+        if (pSocket->is_secure)
+        {
+          /* Each buffer is a TLS record of its own */
+          ret = 0;
+          for (int32_t i = 0; i < iovcnt; i++)
+          {
+            sent = (int32_t) net_mbedtls_sock_send(pSocket, iov[i].iov_base, iov[i].iov_len);
+            if (sent < 0)
+            {
+              ret = (ret == 0) ? sent : ret;
+              break;
+            }
+            ret += sent;
+            if ((uint32_t)sent < iov[i].iov_len)
+            {
+              break;
+            }
+          }
+        }
+        else
+#endif /* NET_MBEDTLS_HOST_SUPPORT */
+        {
+          if (net_access_control(pSocket->pnetif, NET_ACCESS_SEND, &ret))
+          {
+            UNLOCK_SOCK(sock);
+            if (pSocket->pnetif->pdrv->psendv != NULL)
+            {
+              ret = pSocket->pnetif->pdrv->psendv(pSocket->ulsocket, iov, iovcnt, flags);
+            }
+            else
+            {
+              ret = 0;
+              for (int32_t i = 0; i < iovcnt; i++)
+              {
+                sent = pSocket->pnetif->pdrv->psend(pSocket->ulsocket, iov[i].iov_base, (int32_t)iov[i].iov_len,
+                                                    flags);
+                if (sent < 0)
+                {
+                  /* Report the bytes already sent, if any, the error shows on the next call */
+                  ret = (ret == 0) ? sent : ret;
+                  break;
+                }
+                ret += sent;
+                if ((uint32_t)sent < iov[i].iov_len)
+                {
+                  break;
+                }
+              }
+            }
+            LOCK_SOCK(sock);
+
+            if ((ret < 0) && (ret != NET_ERROR_DISCONNECTED))
+            {
+              NET_DBG_ERROR("Error during sending data.\n");
+            }
+          }
+        }
+        UNLOCK_SOCK(sock);
+      }
+    }
+  }
+  return ret;
+}
+
+
 /**
   * @brief  receive data from a connected socket
   * @param  sock [in] integer socket number
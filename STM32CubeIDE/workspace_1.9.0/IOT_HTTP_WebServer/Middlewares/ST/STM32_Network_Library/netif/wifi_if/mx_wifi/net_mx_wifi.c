@@ -91,6 +91,7 @@ static int32_t mx_wifi_listen(int32_t sock, int32_t backlog);
 static int32_t mx_wifi_accept(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen);
 static int32_t mx_wifi_connect(int32_t sock, const net_sockaddr_t *addr, uint32_t addrlen);
 static int32_t mx_wifi_send(int32_t sock, uint8_t *buf, int32_t len, int32_t flags);
+static int32_t mx_wifi_sendv(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags);
 static int32_t mx_wifi_recv(int32_t sock, uint8_t *buf, int32_t len, int32_t flags);
 static int32_t mx_wifi_sendto(int32_t sock, uint8_t *buf, int32_t len, int32_t flags, net_sockaddr_t *to,
                               uint32_t tolen);
@@ -427,6 +428,7 @@ static int32_t mx_wifi_if_init(net_if_handle_t *pnetif)
     p->paccept = mx_wifi_accept;
     p->pconnect = mx_wifi_connect;
     p->psend = mx_wifi_send;
+    p->psendv = mx_wifi_sendv;
     p->precv = mx_wifi_recv;
     p->psendto = mx_wifi_sendto;
     p->precvfrom = mx_wifi_recvfrom;
@@ -1113,9 +1115,20 @@ static int32_t mx_wifi_socket(int32_t domain, int32_t type, int32_t protocol)
 static int32_t mx_wifi_setsockopt(int32_t sock, int32_t level, int32_t optname, const void *optvalue, uint32_t optlen)
 {
   int32_t ret;
+  int32_t nonblocking;
   MX_WIFIObject_t  *pMxWifiObj = wifi_obj_get();
 
-  ret = MX_WIFI_Socket_setsockopt(pMxWifiObj, sock, level, optname, optvalue, (int32_t)optlen);
+  if ((level == NET_SOL_SOCKET) && (optname == (int32_t)NET_SO_BLOCKING) && (optlen == sizeof(bool)))
+  {
+    /* the module mode is the other way round, non-blocking when set */
+    nonblocking = (*(const bool *)optvalue) ? 0 : 1;
+    ret = MX_WIFI_Socket_setsockopt(pMxWifiObj, sock, SOL_SOCKET, SO_BLOCKMODE, &nonblocking,
+                                    (int32_t)sizeof(nonblocking));
+  }
+  else
+  {
+    ret = MX_WIFI_Socket_setsockopt(pMxWifiObj, sock, level, optname, optvalue, (int32_t)optlen);
+  }
   return ret;
 }
 
@@ -1272,6 +1285,31 @@ static int32_t mx_wifi_send(int32_t sock, uint8_t *buf, int32_t len, int32_t fla
   return ret;
 }
 
+/**
+  * @brief                   mxchip wifi socket send of several buffers in one request
+  * @param  sock             socket fd
+  * @param  iov              data buffers to send
+  * @param  iovcnt           number of data buffers, the ones after MX_WIFI_IOV_MAX are left for a next call
+  * @param  flags            socket flag
+  * @return int32_t          bytes sent, if failed return error code(<0)
+  */
+static int32_t mx_wifi_sendv(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags)
+{
+  int32_t ret;
+  mx_iovec_t mx_iov[MX_WIFI_IOV_MAX];
+  int32_t mx_iovcnt = (iovcnt < MX_WIFI_IOV_MAX) ? iovcnt : MX_WIFI_IOV_MAX;
+  MX_WIFIObject_t *pMxWifiObj = wifi_obj_get();
+
+  for (int32_t i = 0; i < mx_iovcnt; i++)
+  {
+    mx_iov[i].buf = (uint8_t *)iov[i].iov_base;
+    mx_iov[i].len = (int32_t)iov[i].iov_len;
+  }
+
+  ret = MX_WIFI_Socket_sendv(pMxWifiObj, sock, mx_iov, mx_iovcnt, flags);
+  return ret;
+}
+
 /**
   * @brief                   mxchip wifi socket recv
   * @param  sock             socket fd
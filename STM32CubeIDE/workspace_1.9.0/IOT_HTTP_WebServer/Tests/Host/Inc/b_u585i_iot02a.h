@@ -0,0 +1,32 @@
+/**
+  **********************************************************************************************************************
+  * @file    b_u585i_iot02a.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the board BSP header, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef B_U585I_IOT02A_H
+#define B_U585I_IOT02A_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32u5xx_hal.h"
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+#define BSP_ERROR_NONE               (0)
+
+/* Memory mapped OSPI NOR flash base, only printed on the host */
+#define OCTOSPI2_BASE                (0x70000000UL)
+
+#endif /* B_U585I_IOT02A_H */
@@ -0,0 +1,30 @@
+/**
+  **********************************************************************************************************************
+  * @file    bsp.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the BSP services header, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef BSP_H
+#define BSP_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "b_u585i_iot02a.h"
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+int bsp_init(void);
+int bsp_ospi_nor_map(const uint8_t **area, uint32_t *area_size);
+
+#endif /* BSP_H */
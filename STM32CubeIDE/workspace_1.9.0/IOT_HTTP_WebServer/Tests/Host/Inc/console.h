@@ -0,0 +1,25 @@
+/**
+  **********************************************************************************************************************
+  * @file    console.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the console services header, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+/* The host console is the standard output, nothing to set up */
+
+#endif /* CONSOLE_H */
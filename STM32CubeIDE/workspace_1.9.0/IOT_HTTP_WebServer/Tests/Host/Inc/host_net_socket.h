@@ -0,0 +1,33 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_net_socket.h
+  * @author  MCD Application Team
+  * @brief   Header for host_net_socket.c module
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef HOST_NET_SOCKET_H
+#define HOST_NET_SOCKET_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* Port bound instead of the requested one: -1 keeps it, 0 lets the host pick a free one */
+extern int32_t host_net_port;
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+uint16_t host_net_port_get(void);
+
+#endif /* HOST_NET_SOCKET_H */
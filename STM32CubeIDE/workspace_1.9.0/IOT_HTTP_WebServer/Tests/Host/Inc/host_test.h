@@ -0,0 +1,73 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_test.h
+  * @author  MCD Application Team
+  * @brief   Header for host_test.c module, the harness shared by the host tests and benchmarks
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Client connection to the host server, with the data received past the last response read
+  */
+typedef struct
+{
+  int      fd;                                  /*!< Socket, negative once closed                */
+  uint32_t length;                              /*!< Bytes held in buffer                        */
+  char     buffer[65536];                       /*!< Received data                               */
+} host_client_t;
+
+/**
+  * @brief  Response read by a client
+  */
+typedef struct
+{
+  int      status;                              /*!< Status code, 0 if no complete response      */
+  bool     close;                               /*!< Connection: close header                    */
+  uint32_t header_size;                         /*!< Header size, end of headers included        */
+  uint32_t body_size;                           /*!< Body size, chunk framing removed            */
+  char     header[2048];                        /*!< Header, null terminated                     */
+  char     body[65536];                         /*!< Body, null terminated                       */
+} host_response_t;
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Check a condition, a failed one is reported and fails the test program */
+#define HOST_CHECK(cond)         host_test_check((cond), #cond, __FILE__, __LINE__)
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+bool host_test_check(bool cond, const char *text, const char *file, int line);
+int host_test_end(const char *name);
+
+uint64_t host_bench_now(void);
+void host_bench_report(const char *name, uint64_t count, uint64_t time_ns, const char *unit);
+
+uint16_t host_server_start(void);
+
+bool host_client_open(host_client_t *client, uint16_t port);
+bool host_client_send(host_client_t *client, const char *data, uint32_t size);
+bool host_client_response(host_client_t *client, host_response_t *response, bool head);
+bool host_client_closed(host_client_t *client, uint32_t timeout_ms);
+void host_client_close(host_client_t *client);
+
+uint32_t host_sensors_motion_streams(void);
+
+#endif /* HOST_TEST_H */
@@ -0,0 +1,71 @@
+/**
+  **********************************************************************************************************************
+  * @file    stm32u5xx_hal.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the HAL header, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef STM32U5xx_HAL_H
+#define STM32U5xx_HAL_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  SysTick registers read by the web server, held in memory on the host
+  */
+typedef struct
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t LOAD;
+  volatile uint32_t VAL;
+  volatile uint32_t CALIB;
+} SysTick_Type;
+
+/**
+  * @brief  Peripheral handles the web server headers refer to, never used on the host
+  */
+typedef struct
+{
+  void *Instance;
+} DMA_HandleTypeDef;
+
+typedef struct
+{
+  void *Instance;
+} SPI_HandleTypeDef;
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+#ifndef __IO
+#define __IO volatile
+#endif /* __IO */
+
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+extern SysTick_Type host_systick;
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+#define SysTick (&host_systick)
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+/* Host tick control, the tick follows the host clock plus a test controlled offset */
+void host_tick_advance(uint32_t ms);
+
+#endif /* STM32U5xx_HAL_H */
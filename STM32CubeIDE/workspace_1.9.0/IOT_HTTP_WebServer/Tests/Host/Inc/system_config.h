@@ -0,0 +1,25 @@
+/**
+  **********************************************************************************************************************
+  * @file    system_config.h
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the system configuration header, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef SYSTEM_CONFIG_H
+#define SYSTEM_CONFIG_H
+
+/* The host system needs no clock, cache or power configuration */
+
+#endif /* SYSTEM_CONFIG_H */
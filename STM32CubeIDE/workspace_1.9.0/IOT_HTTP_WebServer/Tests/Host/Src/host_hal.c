@@ -0,0 +1,66 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_hal.c
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the HAL time base, for the host build of the web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "stm32u5xx_hal.h"
+#include <time.h>
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* SysTick never reloads on the host, the web server time in us is the tick in ms times 1000 */
+SysTick_Type host_systick;
+
+/* Time in ms added to the host clock, so that tests do not wait for timeouts */
+static volatile uint32_t host_tick_offset;
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Get the tick in ms, from the host monotonic clock
+  * @param  None
+  * @retval Tick in ms
+  */
+uint32_t HAL_GetTick(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (uint32_t)((now.tv_sec * 1000) + (now.tv_nsec / 1000000)) + host_tick_offset;
+}
+
+/**
+  * @brief  Wait for a number of ms
+  * @param  Delay : time to wait in ms
+  * @retval None
+  */
+void HAL_Delay(uint32_t Delay)
+{
+  struct timespec delay = {(time_t)(Delay / 1000U), (long)(Delay % 1000U) * 1000000L};
+
+  (void)nanosleep(&delay, NULL);
+}
+
+/**
+  * @brief  Move the tick forward, as if time passed
+  * @param  ms : time in ms
+  * @retval None
+  */
+void host_tick_advance(uint32_t ms)
+{
+  host_tick_offset += ms;
+}
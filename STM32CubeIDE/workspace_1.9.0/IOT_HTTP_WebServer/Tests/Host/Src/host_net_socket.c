@@ -0,0 +1,292 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_net_socket.c
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the network library socket API, over the host TCP/IP stack, for the host build of the
+  *          web server sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "net_connect.h"
+#include "host_net_socket.h"
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Host descriptors a receive timeout can be kept for */
+#define HOST_NET_FD_MAX_NBR      (1024)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Port bound instead of the requested one: -1 keeps it, 0 lets the host pick a free one */
+int32_t host_net_port = -1;
+
+/* Port the last listening socket is bound to, 0 until a socket listens */
+static volatile uint16_t host_net_listen_port;
+
+/* Receive timeout in ms of each descriptor, 0 for none, as the network library keeps it, and its non-blocking mode */
+static int32_t host_net_timeouts[HOST_NET_FD_MAX_NBR];
+static bool    host_net_nonblocking[HOST_NET_FD_MAX_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static int32_t host_net_error(void);
+static bool host_net_wait(int32_t sock);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Port the last listening socket is bound to
+  * @param  None
+  * @retval Port, 0 if no socket listens yet
+  */
+uint16_t host_net_port_get(void)
+{
+  return host_net_listen_port;
+}
+
+/**
+  * @brief  Create a socket
+  * @param  domain   : NET_AF_INET
+  * @param  type     : NET_SOCK_STREAM
+  * @param  protocol : NET_IPPROTO_TCP
+  * @retval Socket, negative on error
+  */
+int32_t net_socket(int32_t domain, int32_t type, int32_t protocol)
+{
+  int32_t sock;
+  int     on = 1;
+
+  if ((domain != NET_AF_INET) || (type != NET_SOCK_STREAM))
+  {
+    return NET_ERROR_UNSUPPORTED;
+  }
+  (void)protocol;
+
+  sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if ((sock < 0) || (sock >= HOST_NET_FD_MAX_NBR))
+  {
+    return NET_ERROR_SOCKET_FAILURE;
+  }
+  (void)setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+  host_net_timeouts[sock]    = 0;
+  host_net_nonblocking[sock] = false;
+
+  return sock;
+}
+
+/**
+  * @brief  Bind a socket to a port of any local address
+  * @param  sock    : socket
+  * @param  addr    : address, only its port is used
+  * @param  addrlen : address size
+  * @retval 0 on success, negative on error
+  */
+int32_t net_bind(int32_t sock, net_sockaddr_t *addr, uint32_t addrlen)
+{
+  struct sockaddr_in local = {0};
+
+  (void)addrlen;
+
+  local.sin_family      = AF_INET;
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  local.sin_port        = (host_net_port < 0) ? ((net_sockaddr_in_t *)addr)->sin_port : htons((uint16_t)host_net_port);
+
+  return (bind(sock, (struct sockaddr *)&local, sizeof(local)) == 0) ? NET_OK : host_net_error();
+}
+
+/**
+  * @brief  Listen for incoming connections
+  * @param  sock    : socket
+  * @param  backlog : connections waiting to be accepted
+  * @retval 0 on success, negative on error
+  */
+int32_t net_listen(int32_t sock, int32_t backlog)
+{
+  struct sockaddr_in local;
+  socklen_t          size = sizeof(local);
+
+  if ((listen(sock, backlog) != 0) || (getsockname(sock, (struct sockaddr *)&local, &size) != 0))
+  {
+    return host_net_error();
+  }
+  host_net_listen_port = ntohs(local.sin_port);
+
+  return NET_OK;
+}
+
+/**
+  * @brief  Accept a connection, waiting for the socket receive timeout at most, not at all if non-blocking
+  * @param  sock    : listening socket
+  * @param  addr    : remote address (out), not filled
+  * @param  addrlen : remote address size
+  * @retval Connection socket, negative on timeout or error
+  */
+int32_t net_accept(int32_t sock, net_sockaddr_t *addr, uint32_t *addrlen)
+{
+  int32_t conn;
+
+  (void)addr;
+  (void)addrlen;
+
+  if (!host_net_wait(sock))
+  {
+    return NET_TIMEOUT;
+  }
+
+  conn = accept(sock, NULL, NULL);
+  if ((conn < 0) || (conn >= HOST_NET_FD_MAX_NBR))
+  {
+    return host_net_error();
+  }
+  host_net_timeouts[conn]    = 0;
+  host_net_nonblocking[conn] = false;
+
+  return conn;
+}
+
+/**
+  * @brief  Set a socket option, only the receive timeout and the blocking mode have an effect
+  * @param  sock     : socket
+  * @param  level    : NET_SOL_SOCKET
+  * @param  optname  : option
+  * @param  optvalue : option value
+  * @param  optlen   : option value size
+  * @retval 0 on success, negative on error
+  */
+int32_t net_setsockopt(int32_t sock, int32_t level, net_socketoption_t optname, const void *optvalue,
+                       uint32_t optlen)
+{
+  if ((sock < 0) || (sock >= HOST_NET_FD_MAX_NBR) || (optvalue == NULL))
+  {
+    return NET_ERROR_PARAMETER;
+  }
+
+  if ((level == NET_SOL_SOCKET) && (optname == NET_SO_RCVTIMEO) && (optlen == sizeof(int32_t)))
+  {
+    host_net_timeouts[sock] = *(const int32_t *)optvalue;
+  }
+  if ((level == NET_SOL_SOCKET) && (optname == NET_SO_BLOCKING) && (optlen == sizeof(bool)))
+  {
+    host_net_nonblocking[sock] = !*(const bool *)optvalue;
+  }
+
+  return NET_OK;
+}
+
+/**
+  * @brief  Receive data, waiting for the socket receive timeout at most unless NET_MSG_DONTWAIT is set
+  * @param  sock     : socket
+  * @param  buf      : data buffer
+  * @param  len      : buffer size
+  * @param  flags_in : zero or NET_MSG_DONTWAIT
+  * @retval Bytes received, 0 if the connection is closed, negative if none or on error
+  */
+int32_t net_recv(int32_t sock, uint8_t *buf, uint32_t len, int32_t flags_in)
+{
+  ssize_t ret;
+
+  if (((flags_in & NET_MSG_DONTWAIT) == 0) && !host_net_wait(sock))
+  {
+    return NET_TIMEOUT;
+  }
+
+  ret = recv(sock, buf, len, MSG_DONTWAIT);
+
+  return (ret >= 0) ? (int32_t)ret : host_net_error();
+}
+
+/**
+  * @brief  Send the data of several buffers, in a row
+  * @param  sock   : socket
+  * @param  iov    : buffers
+  * @param  iovcnt : buffer number
+  * @param  flags  : zero or NET_MSG_DONTWAIT
+  * @retval Bytes sent, negative if none could be or on error
+  */
+int32_t net_sendv(int32_t sock, const net_iovec_t *iov, int32_t iovcnt, int32_t flags)
+{
+  struct iovec  vec[8];
+  struct msghdr msg = {0};
+  ssize_t       ret;
+
+  if ((iov == NULL) || (iovcnt <= 0) || (iovcnt > (int32_t)(sizeof(vec) / sizeof(vec[0]))))
+  {
+    return NET_ERROR_PARAMETER;
+  }
+
+  for (int32_t i = 0; i < iovcnt; i++)
+  {
+    vec[i].iov_base = iov[i].iov_base;
+    vec[i].iov_len  = iov[i].iov_len;
+  }
+  msg.msg_iov    = vec;
+  msg.msg_iovlen = (size_t)iovcnt;
+
+  ret = sendmsg(sock, &msg, MSG_NOSIGNAL | (((flags & NET_MSG_DONTWAIT) != 0) ? MSG_DONTWAIT : 0));
+
+  return (ret >= 0) ? (int32_t)ret : host_net_error();
+}
+
+/**
+  * @brief  Close a socket
+  * @param  sock : socket
+  * @retval 0 on success, negative on error
+  */
+int32_t net_closesocket(int32_t sock)
+{
+  return (close(sock) == 0) ? NET_OK : NET_ERROR_CLOSE_SOCKET;
+}
+
+/**
+  * @brief  Set the port of a socket address
+  * @param  addr : address
+  * @param  port : port, host byte order
+  * @retval None
+  */
+void net_set_port(net_sockaddr_t *addr, uint16_t port)
+{
+  ((net_sockaddr_in_t *)addr)->sin_port = htons(port);
+}
+
+/**
+  * @brief  Network library error of the last failed host socket call
+  * @param  None
+  * @retval Error code
+  */
+static int32_t host_net_error(void)
+{
+  return ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? NET_ERROR_WOULD_BLOCK : NET_ERROR_SOCKET_FAILURE;
+}
+
+/**
+  * @brief  Wait for a socket to be readable, for its receive timeout at most, no timeout set meaning no wait as
+  *         with the network library, and a non-blocking socket not waiting
+  * @param  sock : socket
+  * @retval true if the socket is readable or closed, false on timeout
+  */
+static bool host_net_wait(int32_t sock)
+{
+  struct pollfd fd = {sock, POLLIN, 0};
+
+  if ((sock < 0) || (sock >= HOST_NET_FD_MAX_NBR))
+  {
+    return true;
+  }
+
+  return poll(&fd, 1, host_net_nonblocking[sock] ? 0 : (int)host_net_timeouts[sock]) != 0;
+}
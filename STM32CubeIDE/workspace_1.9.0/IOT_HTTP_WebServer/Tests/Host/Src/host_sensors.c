@@ -0,0 +1,134 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_sensors.c
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the sensors services, answering fixed values, for the host build of the web server
+  *          sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_sensors.h"
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Time in ms until the next acquisition, the values never change */
+#define HOST_SENSORS_PERIOD      (1000U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Latest values, as the board reads them in an office */
+static const webserver_sample_t host_sensor_samples[WEBSERVER_SENSOR_NBR] =
+{
+  {23.5f,   {0, 0, 0},       0U},
+  {1013.2f, {0, 0, 0},       0U},
+  {45.25f,  {0, 0, 0},       0U},
+  {0.0f,    {12, -8, 1000},  0U},
+  {0.0f,    {70, -140, 210}, 0U},
+  {0.0f,    {-215, 90, 380}, 0U},
+  {320.0f,  {0, 0, 0},       0U},
+  {850.0f,  {0, 0, 0},       0U},
+};
+
+/* Motion streams open, read by the tests from their own thread */
+static volatile uint32_t host_motion_streams;
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Read the temperature
+  * @param  value : temperature in degC (out)
+  * @retval BSP status
+  */
+int webserver_temp_sensor_read(float *value)
+{
+  *value = host_sensor_samples[WEBSERVER_SENSOR_TEMPERATURE].value;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Read the pressure
+  * @param  value : pressure in hPa (out)
+  * @retval BSP status
+  */
+int webserver_press_sensor_read(float *value)
+{
+  *value = host_sensor_samples[WEBSERVER_SENSOR_PRESSURE].value;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Read the humidity
+  * @param  value : humidity in %rH (out)
+  * @retval BSP status
+  */
+int webserver_humid_sensor_read(float *value)
+{
+  *value = host_sensor_samples[WEBSERVER_SENSOR_HUMIDITY].value;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Acquisition stage, nothing to acquire on the host
+  * @param  None
+  * @retval Time in ms until the next acquisition is due
+  */
+uint32_t webserver_sensors_process(void)
+{
+  return HOST_SENSORS_PERIOD;
+}
+
+/**
+  * @brief  Count a motion stream opening
+  * @param  None
+  * @retval None
+  */
+void webserver_sensors_motion_subscribe(void)
+{
+  host_motion_streams++;
+}
+
+/**
+  * @brief  Count a motion stream closing
+  * @param  None
+  * @retval None
+  */
+void webserver_sensors_motion_unsubscribe(void)
+{
+  host_motion_streams--;
+}
+
+/**
+  * @brief  Motion streams the server counts as open
+  * @param  None
+  * @retval Motion streams open
+  */
+uint32_t host_sensors_motion_streams(void)
+{
+  return host_motion_streams;
+}
+
+/**
+  * @brief  Get the last value of a sensor
+  * @param  sensor : sensor, one of WEBSERVER_SENSOR_xxx
+  * @param  sample : last value, acquired now
+  * @retval BSP status
+  */
+int webserver_sensor_get(uint32_t sensor, webserver_sample_t *sample)
+{
+  *sample      = host_sensor_samples[sensor];
+  sample->tick = HAL_GetTick();
+
+  return BSP_ERROR_NONE;
+}
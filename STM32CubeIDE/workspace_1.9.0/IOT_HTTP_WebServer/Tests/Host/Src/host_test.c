@@ -0,0 +1,406 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_test.c
+  * @author  MCD Application Team
+  * @brief   This file implements the harness shared by the host tests and benchmarks: checks, timing, a web server
+  *          thread and an HTTP client reading whole responses
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+#define _GNU_SOURCE
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "host_net_socket.h"
+#include "webserver_http_response.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Time in ms a client waits for data before giving up on a response */
+#define HOST_CLIENT_TIMEOUT      (2000)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Failed checks so far */
+static uint32_t host_test_failures;
+
+/* Checks so far */
+static uint32_t host_test_checks;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void *host_server_thread(void *arg);
+static bool host_client_need(host_client_t *client, uint32_t size);
+static uint32_t host_client_chunked(host_client_t *client, host_response_t *response);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Check a condition, reporting it when it does not hold
+  * @param  cond : condition value
+  * @param  text : condition source text
+  * @param  file : source file of the check
+  * @param  line : source line of the check
+  * @retval Condition value
+  */
+bool host_test_check(bool cond, const char *text, const char *file, int line)
+{
+  host_test_checks++;
+  if (!cond)
+  {
+    host_test_failures++;
+    printf("%s:%d: check failed: %s\n", file, line, text);
+  }
+
+  return cond;
+}
+
+/**
+  * @brief  Report the outcome of a test program
+  * @param  name : test program name
+  * @retval Exit status, 0 if all the checks held
+  */
+int host_test_end(const char *name)
+{
+  printf("%s: %s, %u checks, %u failed\n", name, (host_test_failures == 0U) ? "PASS" : "FAIL",
+         (unsigned int)host_test_checks, (unsigned int)host_test_failures);
+
+  return (host_test_failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+  * @brief  Get the time in ns, from the host monotonic clock
+  * @param  None
+  * @retval Time in ns
+  */
+uint64_t host_bench_now(void)
+{
+  struct timespec now;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/**
+  * @brief  Report a benchmark result, as operations per second and time per operation
+  * @param  name    : benchmark name
+  * @param  count   : operations done
+  * @param  time_ns : time they took in ns
+  * @param  unit    : operation name, plural
+  * @retval None
+  */
+void host_bench_report(const char *name, uint64_t count, uint64_t time_ns, const char *unit)
+{
+  double seconds = (double)time_ns / 1e9;
+
+  printf("%-40s %14.0f %s/s %10.1f ns/op\n", name, (seconds > 0.0) ? ((double)count / seconds) : 0.0, unit,
+         (count > 0U) ? ((double)time_ns / (double)count) : 0.0);
+}
+
+/**
+  * @brief  Start the web server in a thread, listening on a free local port
+  * @param  None
+  * @retval Port, 0 if the server did not start
+  */
+uint16_t host_server_start(void)
+{
+  pthread_t thread;
+
+  host_net_port = 0;
+  if (pthread_create(&thread, NULL, host_server_thread, NULL) != 0)
+  {
+    return 0U;
+  }
+  (void)pthread_detach(thread);
+
+  /* The server listens once its start up is done */
+  for (uint32_t i = 0U; (i < 2000U) && (host_net_port_get() == 0U); i++)
+  {
+    (void)usleep(1000);
+  }
+
+  return host_net_port_get();
+}
+
+/**
+  * @brief  Open a client connection to a local port
+  * @param  client : client
+  * @param  port   : port
+  * @retval true if connected, false otherwise
+  */
+bool host_client_open(host_client_t *client, uint16_t port)
+{
+  struct sockaddr_in remote = {0};
+  int on = 1;
+
+  client->length    = 0U;
+  client->buffer[0] = '\0';
+  client->fd        = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (client->fd < 0)
+  {
+    return false;
+  }
+  (void)setsockopt(client->fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+  remote.sin_family      = AF_INET;
+  remote.sin_port        = htons(port);
+  remote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (connect(client->fd, (struct sockaddr *)&remote, sizeof(remote)) != 0)
+  {
+    host_client_close(client);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Send data to the server, all of it
+  * @param  client : client
+  * @param  data   : data
+  * @param  size   : data size
+  * @retval true if sent, false otherwise
+  */
+bool host_client_send(host_client_t *client, const char *data, uint32_t size)
+{
+  ssize_t ret;
+
+  while (size > 0U)
+  {
+    ret = send(client->fd, data, size, MSG_NOSIGNAL);
+    if (ret <= 0)
+    {
+      return false;
+    }
+    data += ret;
+    size -= (uint32_t)ret;
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Read the next response, its body delimited by its length, its chunks or the connection close
+  * @param  client   : client
+  * @param  response : response (out), status 0 if none complete came in time
+  * @param  head     : response to a HEAD request, that has no body whatever its headers say
+  * @retval true if a complete response was read, false otherwise
+  */
+bool host_client_response(host_client_t *client, host_response_t *response, bool head)
+{
+  const char *field;
+  char       *end = NULL;
+  uint32_t   consumed;
+
+  response->status      = 0;
+  response->close       = false;
+  response->header_size = 0U;
+  response->body_size   = 0U;
+  response->header[0]   = '\0';
+  response->body[0]     = '\0';
+
+  /* Header */
+  while ((end = strstr(client->buffer, "\r\n\r\n")) == NULL)
+  {
+    if (!host_client_need(client, client->length + 1U))
+    {
+      return false;
+    }
+  }
+  response->header_size = (uint32_t)(end - client->buffer) + 4U;
+  if ((response->header_size >= sizeof(response->header)) || (strncmp(client->buffer, "HTTP/1.1 ", 9) != 0))
+  {
+    return false;
+  }
+  memcpy(response->header, client->buffer, response->header_size);
+  response->header[response->header_size] = '\0';
+  response->close = (strcasestr(response->header, "\r\nConnection: close\r\n") != NULL);
+
+  /* Body */
+  field    = strcasestr(response->header, "\r\nContent-Length:");
+  consumed = response->header_size;
+  if (head || (response->header[9] == '1') || (strncmp(&response->header[9], "204", 3) == 0) ||
+      (strncmp(&response->header[9], "304", 3) == 0))
+  {
+    response->body_size = 0U;
+  }
+  else if (strcasestr(response->header, "\r\nTransfer-Encoding: chunked\r\n") != NULL)
+  {
+    consumed = host_client_chunked(client, response);
+    if (consumed == 0U)
+    {
+      return false;
+    }
+  }
+  else if (field != NULL)
+  {
+    response->body_size = (uint32_t)strtoul(&field[17], NULL, 10);
+    if ((response->body_size >= sizeof(response->body)) ||
+        !host_client_need(client, response->header_size + response->body_size))
+    {
+      return false;
+    }
+    memcpy(response->body, &client->buffer[response->header_size], response->body_size);
+    consumed += response->body_size;
+  }
+  else
+  {
+    /* Up to the close */
+    while (host_client_need(client, client->length + 1U))
+    {
+    }
+    if (client->fd >= 0)
+    {
+      return false;
+    }
+    response->body_size = client->length - response->header_size;
+    memcpy(response->body, &client->buffer[response->header_size], response->body_size);
+    consumed = client->length;
+  }
+  response->body[response->body_size] = '\0';
+
+  /* Keep what follows, a pipelined response */
+  client->length -= consumed;
+  memmove(client->buffer, &client->buffer[consumed], client->length + 1U);
+  response->status = atoi(&response->header[9]);
+
+  return true;
+}
+
+/**
+  * @brief  Check that the server closes a connection, with no data before the close
+  * @param  client     : client
+  * @param  timeout_ms : time to wait for the close in ms
+  * @retval true if closed with no pending data, false otherwise
+  */
+bool host_client_closed(host_client_t *client, uint32_t timeout_ms)
+{
+  struct pollfd fd = {client->fd, POLLIN, 0};
+  char   data;
+
+  if (client->length > 0U)
+  {
+    return false;
+  }
+
+  return (poll(&fd, 1, (int)timeout_ms) == 1) && (recv(client->fd, &data, 1, 0) == 0);
+}
+
+/**
+  * @brief  Close a client connection
+  * @param  client : client
+  * @retval None
+  */
+void host_client_close(host_client_t *client)
+{
+  if (client->fd >= 0)
+  {
+    (void)close(client->fd);
+    client->fd = -1;
+  }
+}
+
+/**
+  * @brief  Run the web server, never returns unless it fails
+  * @param  arg : unused
+  * @retval NULL
+  */
+static void *host_server_thread(void *arg)
+{
+  (void)arg;
+
+  printf("web server stopped: %d\n", webserver_http_start());
+
+  return NULL;
+}
+
+/**
+  * @brief  Receive until a client holds a number of bytes
+  * @param  client : client
+  * @param  size   : bytes wanted
+  * @retval true if held, false on close, timeout or full buffer
+  */
+static bool host_client_need(host_client_t *client, uint32_t size)
+{
+  struct pollfd fd = {client->fd, POLLIN, 0};
+  ssize_t ret;
+
+  while (client->length < size)
+  {
+    if ((client->fd < 0) || (size >= sizeof(client->buffer)) || (poll(&fd, 1, HOST_CLIENT_TIMEOUT) != 1))
+    {
+      return false;
+    }
+
+    ret = recv(client->fd, &client->buffer[client->length], sizeof(client->buffer) - 1U - client->length, 0);
+    if (ret <= 0)
+    {
+      host_client_close(client);
+      return false;
+    }
+    client->length += (uint32_t)ret;
+    client->buffer[client->length] = '\0';
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Read a chunked body
+  * @param  client   : client, holding the response header
+  * @param  response : response, its body filled
+  * @retval Response size, header included, 0 on error
+  */
+static uint32_t host_client_chunked(host_client_t *client, host_response_t *response)
+{
+  uint32_t offset = response->header_size;
+  uint32_t chunk_size;
+  char     *line_end;
+
+  do
+  {
+    /* Chunk size line */
+    while ((line_end = strstr(&client->buffer[offset], "\r\n")) == NULL)
+    {
+      if (!host_client_need(client, client->length + 1U))
+      {
+        return 0U;
+      }
+    }
+    chunk_size = (uint32_t)strtoul(&client->buffer[offset], NULL, 16);
+    offset     = (uint32_t)(line_end - client->buffer) + 2U;
+
+    /* Chunk data and its line end */
+    if (((response->body_size + chunk_size) >= sizeof(response->body)) ||
+        !host_client_need(client, offset + chunk_size + 2U) ||
+        (strncmp(&client->buffer[offset + chunk_size], "\r\n", 2) != 0))
+    {
+      return 0U;
+    }
+    memcpy(&response->body[response->body_size], &client->buffer[offset], chunk_size);
+    response->body_size += chunk_size;
+    offset += chunk_size + 2U;
+  } while (chunk_size > 0U);
+
+  return offset;
+}
@@ -0,0 +1,48 @@
+/**
+  **********************************************************************************************************************
+  * @file    host_wifi.c
+  * @author  MCD Application Team
+  * @brief   Host stand-in of the Wi-Fi module services the web server reads, for the host build of the web server
+  *          sources
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "mx_wifi.h"
+#include <string.h>
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Get the module handle, there is none on the host
+  * @param  None
+  * @retval NULL
+  */
+MX_WIFIObject_t *wifi_obj_get(void)
+{
+  return NULL;
+}
+
+/**
+  * @brief  Get the IPC statistics, no command goes to a module on the host
+  * @param  Obj: pointer to module handle
+  * @param  stat: IPC statistics (out), all zero
+  * @retval Operation Status.
+  */
+MX_WIFI_STATUS_T MX_WIFI_GetIpcStat(MX_WIFIObject_t *Obj, mx_ipc_stat_t *stat)
+{
+  (void)Obj;
+  (void)memset(stat, 0, sizeof(*stat));
+
+  return MX_WIFI_STATUS_OK;
+}
@@ -0,0 +1,153 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_http_clients.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the connections event loop: requests per second answered to 1, 2 then 4 concurrent
+  *          clients, each one on its own persistent connection. Below the connection limit, each loop round also
+  *          polls for a new connection, without waiting as long as a connection is open.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Connections served at once, as set in webserver_http_conn.c */
+#define BENCH_CLIENTS_MAX_NBR    (4U)
+
+/* Requests each client sends, below the requests a persistent connection serves before closing */
+#define BENCH_REQUESTS           (99U)
+
+/* Connections each client opens in turn */
+#define BENCH_ROUNDS             (20U)
+
+#define BENCH_GET_TEMPERATURE    "GET /Read_Temperature HTTP/1.1\r\nHost: board\r\n\r\n"
+#define BENCH_GET_INDEX          "GET / HTTP/1.1\r\nHost: board\r\nAccept-Encoding: gzip\r\n\r\n"
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Benchmark client
+  */
+typedef struct
+{
+  pthread_t       thread;                       /*!< Client thread                               */
+  const char      *request;                     /*!< Request sent over and over                  */
+  uint32_t        answered;                     /*!< Requests answered with a 200 response       */
+  host_client_t   client;                       /*!< Connection                                  */
+  host_response_t response;                     /*!< Last response                               */
+} bench_client_t;
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint16_t bench_port;
+static bench_client_t bench_clients[BENCH_CLIENTS_MAX_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void bench_run(const char *name, const char *request, uint32_t client_nbr);
+static void *bench_client_run(void *arg);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Time a sensor route and a web page asset, for an increasing number of clients
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  bench_port = host_server_start();
+  if (!HOST_CHECK(bench_port != 0U))
+  {
+    return host_test_end("bench_http_clients");
+  }
+
+  for (uint32_t client_nbr = 1U; client_nbr <= BENCH_CLIENTS_MAX_NBR; client_nbr *= 2U)
+  {
+    bench_run("sensor route", BENCH_GET_TEMPERATURE, client_nbr);
+  }
+
+  for (uint32_t client_nbr = 1U; client_nbr <= BENCH_CLIENTS_MAX_NBR; client_nbr *= 2U)
+  {
+    bench_run("web page asset", BENCH_GET_INDEX, client_nbr);
+  }
+
+  return host_test_end("bench_http_clients");
+}
+
+/**
+  * @brief  Run concurrent clients sending the same request, and report the requests answered per second
+  * @param  name       : request name
+  * @param  request    : request, null terminated
+  * @param  client_nbr : number of clients
+  * @retval None
+  */
+static void bench_run(const char *name, const char *request, uint32_t client_nbr)
+{
+  char     report[64];
+  uint64_t answered = 0U;
+  uint64_t start;
+
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < client_nbr; i++)
+  {
+    bench_clients[i].request  = request;
+    bench_clients[i].answered = 0U;
+    HOST_CHECK(pthread_create(&bench_clients[i].thread, NULL, bench_client_run, &bench_clients[i]) == 0);
+  }
+
+  for (uint32_t i = 0U; i < client_nbr; i++)
+  {
+    (void)pthread_join(bench_clients[i].thread, NULL);
+    answered += bench_clients[i].answered;
+  }
+
+  (void)snprintf(report, sizeof(report), "%s, %u client%s", name, (unsigned int)client_nbr,
+                 (client_nbr > 1U) ? "s" : "");
+  host_bench_report(report, answered, host_bench_now() - start, "requests");
+  HOST_CHECK(answered == ((uint64_t)client_nbr * BENCH_ROUNDS * BENCH_REQUESTS));
+}
+
+/**
+  * @brief  Client thread: open a connection, send the requests one after the other, then close, for each round
+  * @param  arg : benchmark client
+  * @retval NULL
+  */
+static void *bench_client_run(void *arg)
+{
+  bench_client_t *bench = (bench_client_t *)arg;
+  uint32_t       size   = strlen(bench->request);
+
+  for (uint32_t round = 0U; round < BENCH_ROUNDS; round++)
+  {
+    if (!host_client_open(&bench->client, bench_port))
+    {
+      return NULL;
+    }
+
+    for (uint32_t i = 0U; i < BENCH_REQUESTS; i++)
+    {
+      if (!host_client_send(&bench->client, bench->request, size) ||
+          !host_client_response(&bench->client, &bench->response, false) || (bench->response.status != 200))
+      {
+        break;
+      }
+      bench->answered++;
+    }
+
+    host_client_close(&bench->client);
+  }
+
+  return NULL;
+}
@@ -0,0 +1,161 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_http_float.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the float writer, in values written per second: shortest digits writer, against the
+  *          snprintf("%g") it replaced, which keeps 6 significant digits only, then snprintf("%.9g"), which reads
+  *          back as the same float too. Sensor values first, then floats of any bit pattern.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_float.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define BENCH_VALUE_NBR          (4096U)
+#define BENCH_LOOPS              (500U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static float bench_sensors[BENCH_VALUE_NBR];
+static float bench_patterns[BENCH_VALUE_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void bench_values_init(void);
+static void bench_run(const char *name, const float *values);
+static uint32_t bench_random(void);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Time the writers over sensor values then any bit pattern
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  bench_values_init();
+
+  bench_run("sensor values", bench_sensors);
+  bench_run("any bit pattern", bench_patterns);
+
+  return host_test_end("bench_http_float");
+}
+
+/**
+  * @brief  Fill the values: sensor readings as the HTS221 and LPS22HH drivers return them, and finite floats
+  * @param  None
+  * @retval None
+  */
+static void bench_values_init(void)
+{
+  uint32_t bits;
+
+  for (uint32_t i = 0U; i < BENCH_VALUE_NBR; i++)
+  {
+    switch (i % 3U)
+    {
+      case 0U:
+        bench_sensors[i] = -10.0f + ((float)(bench_random() % 50000U) / 1000.0f);
+        break;
+      case 1U:
+        bench_sensors[i] = (float)(bench_random() % 100000U) / 1000.0f;
+        break;
+      default:
+        bench_sensors[i] = 950.0f + ((float)(bench_random() % 1000000U) / 10000.0f);
+        break;
+    }
+
+    do
+    {
+      bits = bench_random();
+      memcpy(&bench_patterns[i], &bits, sizeof(bits));
+    } while (!isfinite(bench_patterns[i]));
+  }
+}
+
+/**
+  * @brief  Time the writers over a set of values
+  * @param  name   : value set name
+  * @param  values : values, BENCH_VALUE_NBR of them
+  * @retval None
+  */
+static void bench_run(const char *name, const float *values)
+{
+  char     text[HTTP_FLOAT_SIZE];
+  char     report[64];
+  uint64_t start;
+  uint64_t length = 0U;
+  uint32_t ok = 0U;
+
+  start = host_bench_now();
+  for (uint32_t loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    for (uint32_t i = 0U; i < BENCH_VALUE_NBR; i++)
+    {
+      length += webserver_http_float_format(values[i], text);
+    }
+  }
+  (void)snprintf(report, sizeof(report), "%s, shortest digits", name);
+  host_bench_report(report, (uint64_t)BENCH_LOOPS * BENCH_VALUE_NBR, host_bench_now() - start, "values");
+
+  start = host_bench_now();
+  for (uint32_t loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    for (uint32_t i = 0U; i < BENCH_VALUE_NBR; i++)
+    {
+      length += (uint32_t)snprintf(text, sizeof(text), "%g", values[i]);
+    }
+  }
+  (void)snprintf(report, sizeof(report), "%s, snprintf %%g (before)", name);
+  host_bench_report(report, (uint64_t)BENCH_LOOPS * BENCH_VALUE_NBR, host_bench_now() - start, "values");
+
+  start = host_bench_now();
+  for (uint32_t loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    for (uint32_t i = 0U; i < BENCH_VALUE_NBR; i++)
+    {
+      length += (uint32_t)snprintf(text, sizeof(text), "%.9g", values[i]);
+    }
+  }
+  (void)snprintf(report, sizeof(report), "%s, snprintf %%.9g", name);
+  host_bench_report(report, (uint64_t)BENCH_LOOPS * BENCH_VALUE_NBR, host_bench_now() - start, "values");
+
+  /* The shortest digits read back as the same float, printf with 6 digits does not always */
+  for (uint32_t i = 0U; i < BENCH_VALUE_NBR; i++)
+  {
+    (void)webserver_http_float_format(values[i], text);
+    ok += (strtof(text, NULL) == values[i]) ? 1U : 0U;
+  }
+  HOST_CHECK((ok == BENCH_VALUE_NBR) && (length > 0U));
+}
+
+/**
+  * @brief  Pseudo random number, fixed sequence
+  * @param  None
+  * @retval Next number of the sequence
+  */
+static uint32_t bench_random(void)
+{
+  static uint32_t state = 0x12345678U;
+
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+
+  return state;
+}
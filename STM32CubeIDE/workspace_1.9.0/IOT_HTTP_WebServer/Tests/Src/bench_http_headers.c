@@ -0,0 +1,102 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_http_headers.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the web page asset response header: prebuilt block picked at request time, against
+  *          the same header encoded for each request
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_response.h"
+#include "webserver_http_parser.h"
+#include "webserver_http_assets.h"
+#include "webserver_http_encoder.h"
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define BENCH_LOOPS              (1000000U)
+
+#define BENCH_REQUEST            "GET /static/js/main.js HTTP/1.1\r\nHost: board\r\nAccept-Encoding: gzip\r\n\r\n"
+#define BENCH_PATH               "/static/js/main.js"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static char bench_header_buffer[HTTP_HEADERS_BUFFER_SIZE];
+static char bench_body_buffer[HTTP_SENSORS_BUFFER_SIZE];
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Time the asset response header both ways, for the same request
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  http_parser_t      parser;
+  http_request_t     request;
+  http_response_t    response = {0};
+  const http_asset_t *asset;
+  uint32_t           asset_id;
+  uint64_t           start;
+  bool               ok = true;
+
+  /* The server start up builds the header blocks */
+  HOST_CHECK(host_server_start() != 0U);
+
+  webserver_http_parser_init(&parser, &request);
+  HOST_CHECK(webserver_http_parser_execute(&parser, &request, BENCH_REQUEST, sizeof(BENCH_REQUEST) - 1U) ==
+             HTTP_PARSER_DONE);
+  response.header_buffer = bench_header_buffer;
+  response.body_buffer   = bench_body_buffer;
+
+  asset_id = webserver_http_asset_find(BENCH_PATH, sizeof(BENCH_PATH) - 1U);
+  asset    = webserver_http_asset_get(asset_id);
+  HOST_CHECK(asset_id != HTTP_ASSET_NONE);
+
+  /* Both give the same header */
+  request.keep_alive = true;
+  HOST_CHECK(webserver_http_process(&request, &response) == WEBSERVER_OK);
+  HOST_CHECK((webserver_http_encode_asset_response(bench_header_buffer, asset->content_type,
+                                                   asset->codings[HTTP_CODING_GZIP].body_size, true) == WEBSERVER_OK) &&
+             (webserver_http_encode_cache_headers(bench_header_buffer, asset->cache_policy,
+                                                  asset->codings[HTTP_CODING_GZIP].etag) == WEBSERVER_OK) &&
+             (webserver_http_encode_content_coding(bench_header_buffer, HTTP_CODING_GZIP) == WEBSERVER_OK));
+  HOST_CHECK((response.header_size == strlen(bench_header_buffer)) &&
+             (memcmp(response.header, bench_header_buffer, response.header_size) == 0));
+
+  /* Request answered with the prebuilt block */
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    request.keep_alive = true;
+    ok &= (webserver_http_process(&request, &response) == WEBSERVER_OK);
+  }
+  host_bench_report("asset response, prebuilt header", BENCH_LOOPS, host_bench_now() - start, "responses");
+
+  /* The header alone encoded for each request, as before the prebuilt blocks */
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    ok &= (webserver_http_encode_asset_response(bench_header_buffer, asset->content_type,
+                                                asset->codings[HTTP_CODING_GZIP].body_size, true) == WEBSERVER_OK);
+    ok &= (webserver_http_encode_cache_headers(bench_header_buffer, asset->cache_policy,
+                                               asset->codings[HTTP_CODING_GZIP].etag) == WEBSERVER_OK);
+    ok &= (webserver_http_encode_content_coding(bench_header_buffer, HTTP_CODING_GZIP) == WEBSERVER_OK);
+  }
+  host_bench_report("asset header alone, encoded (before)", BENCH_LOOPS, host_bench_now() - start, "headers");
+  HOST_CHECK(ok);
+
+  return host_test_end("bench_http_headers");
+}
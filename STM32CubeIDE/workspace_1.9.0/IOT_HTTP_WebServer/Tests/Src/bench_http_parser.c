@@ -0,0 +1,216 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_http_parser.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the HTTP request parser, in requests parsed per second: incremental parser, against the
+  *          end of headers search over the whole receive buffer after each read, then one search per header field,
+  *          that it replaced
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_parser.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define BENCH_LOOPS              (1000000U)
+
+/* Request of a browser loading the web page script, about 500 bytes */
+#define BENCH_REQUEST            "GET /static/js/main.js HTTP/1.1\r\n"                                                 \
+                                 "Host: 192.168.1.20\r\n"                                                            \
+                                 "Connection: keep-alive\r\n"                                                        \
+                                 "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like "      \
+                                 "Gecko) Chrome/120.0.0.0 Safari/537.36\r\n"                                         \
+                                 "Accept: */*\r\n"                                                                   \
+                                 "Referer: http://192.168.1.20/\r\n"                                                 \
+                                 "Accept-Encoding: gzip, deflate, br\r\n"                                            \
+                                 "Accept-Language: en-US,en;q=0.9,fr;q=0.8\r\n"                                      \
+                                 "If-None-Match: \"5d41402abc4b2a76\"\r\n"                                           \
+                                 "Cookie: session=0123456789abcdef0123456789abcdef; theme=dark; lang=en\r\n"         \
+                                 "Sec-Fetch-Dest: script\r\n"                                                        \
+                                 "Sec-Fetch-Mode: no-cors\r\n"                                                       \
+                                 "Sec-Fetch-Site: same-origin\r\n"                                                   \
+                                 "\r\n"
+
+#define BENCH_REQUEST_SIZE       (sizeof(BENCH_REQUEST) - 1U)
+
+/* Reads a request arrives in: one segment, then small Wi-Fi module frames */
+#define BENCH_SEGMENT_WHOLE      (BENCH_REQUEST_SIZE)
+#define BENCH_SEGMENT_SMALL      (64U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static const char bench_request[] = BENCH_REQUEST;
+
+/* Header fields the server looked up one by one before the parser */
+static const char *const bench_fields[] =
+{
+  "Connection:", "Accept-Encoding:", "If-None-Match:", "Range:", "If-Range:",
+};
+
+#define BENCH_FIELD_NBR          (sizeof(bench_fields) / sizeof(bench_fields[0]))
+
+/* Fields of the list present in the request, the range ones are not */
+#define BENCH_FIELD_FOUND_NBR    (3U)
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void bench_run(uint32_t segment);
+static bool bench_parse(uint32_t segment);
+static bool bench_scan(uint32_t segment);
+static const char *bench_scan_field(const char *header, uint32_t header_size, const char *name);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Time both ways of reading a request, received at once then in small reads
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  /* Both find the request and its header fields */
+  HOST_CHECK(bench_parse(BENCH_SEGMENT_WHOLE) && bench_parse(BENCH_SEGMENT_SMALL));
+  HOST_CHECK(bench_scan(BENCH_SEGMENT_WHOLE) && bench_scan(BENCH_SEGMENT_SMALL));
+
+  bench_run(BENCH_SEGMENT_WHOLE);
+  bench_run(BENCH_SEGMENT_SMALL);
+
+  return host_test_end("bench_http_parser");
+}
+
+/**
+  * @brief  Time both ways for a read size
+  * @param  segment : bytes received per read
+  * @retval None
+  */
+static void bench_run(uint32_t segment)
+{
+  char     name[64];
+  uint64_t start;
+  bool     ok = true;
+
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    ok &= bench_parse(segment);
+  }
+  (void)snprintf(name, sizeof(name), "parser, %u byte reads", (unsigned int)segment);
+  host_bench_report(name, BENCH_LOOPS, host_bench_now() - start, "requests");
+
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    ok &= bench_scan(segment);
+  }
+  (void)snprintf(name, sizeof(name), "rescan (before), %u byte reads", (unsigned int)segment);
+  host_bench_report(name, BENCH_LOOPS, host_bench_now() - start, "requests");
+
+  HOST_CHECK(ok);
+}
+
+/**
+  * @brief  Read a request with the parser, fed after each read
+  * @param  segment : bytes received per read
+  * @retval true if the request and the header fields it holds are found
+  */
+static bool bench_parse(uint32_t segment)
+{
+  http_parser_t  parser;
+  http_request_t request;
+  uint32_t       length = 0U;
+  uint32_t       result = HTTP_PARSER_MORE;
+
+  webserver_http_parser_init(&parser, &request);
+  while ((result == HTTP_PARSER_MORE) && (length < BENCH_REQUEST_SIZE))
+  {
+    length += ((BENCH_REQUEST_SIZE - length) < segment) ? (BENCH_REQUEST_SIZE - length) : segment;
+    result  = webserver_http_parser_execute(&parser, &request, bench_request, length);
+  }
+
+  return (result == HTTP_PARSER_DONE) && (request.header_size == BENCH_REQUEST_SIZE) &&
+         (request.connection.data != NULL) && (request.accept_encoding.data != NULL) &&
+         (request.if_none_match.data != NULL) && (request.range.data == NULL);
+}
+
+/**
+  * @brief  Read a request as the server did before the parser: search the end of headers from the start of the
+  *         receive buffer after each read, then search each header field the response uses
+  * @param  segment : bytes received per read
+  * @retval true if the request and the header fields it holds are found
+  */
+static bool bench_scan(uint32_t segment)
+{
+  static char buffer[BENCH_REQUEST_SIZE + 1U];
+  const char  *headers_end = NULL;
+  uint32_t    found        = 0U;
+  uint32_t    length       = 0U;
+  uint32_t    size;
+
+  while ((headers_end == NULL) && (length < BENCH_REQUEST_SIZE))
+  {
+    size = ((BENCH_REQUEST_SIZE - length) < segment) ? (BENCH_REQUEST_SIZE - length) : segment;
+    memcpy(&buffer[length], &bench_request[length], size);
+    length += size;
+    buffer[length] = '\0';
+    headers_end = strstr(buffer, "\r\n\r\n");
+  }
+
+  if (headers_end == NULL)
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0U; i < BENCH_FIELD_NBR; i++)
+  {
+    found += (bench_scan_field(buffer, (uint32_t)(headers_end - buffer) + 4U, bench_fields[i]) != NULL) ? 1U : 0U;
+  }
+
+  return found == BENCH_FIELD_FOUND_NBR;
+}
+
+/**
+  * @brief  Find a header field of a request header, as the response did before the parser
+  * @param  header      : request header
+  * @param  header_size : request header length
+  * @param  name        : header field name, colon included
+  * @retval Pointer to the field value, NULL if the request has no such field
+  */
+static const char *bench_scan_field(const char *header, uint32_t header_size, const char *name)
+{
+  const char *line     = header;
+  uint32_t   name_size = strlen(name);
+
+  while ((line = strstr(line, "\r\n")) != NULL)
+  {
+    line += 2;
+    if ((uint32_t)(line - header) >= header_size)
+    {
+      break;
+    }
+
+    if (strncasecmp(line, name, name_size) == 0)
+    {
+      line += name_size;
+      while (*line == ' ')
+      {
+        line++;
+      }
+
+      return line;
+    }
+  }
+
+  return NULL;
+}
@@ -0,0 +1,159 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_http_routes.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the HTTP request dispatch: route then web page asset index lookups, against the strncmp
+  *          chain on the request line they replaced
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_routes.h"
+#include "webserver_http_assets.h"
+#include "res.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define BENCH_LOOPS              (2000000U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Paths the server answered before the route table, in the order the strncmp chain tried them, then a miss */
+static const char *const bench_paths[] =
+{
+  "/", "/static/css/chunk.css", "/static/css/main.css", "/static/js/chunk.js", "/static/js/main.js", "/favicon.png",
+  "/manifest.json", "/static/media/fa-solid-900.woff2", "/static/media/FLSTM32U5.jpg", "/Read_Temperature",
+  "/Read_Pressure", "/Read_Humidity", "/missing.html",
+};
+
+#define BENCH_PATH_NBR           (sizeof(bench_paths) / sizeof(bench_paths[0]))
+
+/* Commands of the strncmp chain, after "GET /" */
+static const char *const bench_chain_cmds[] =
+{
+  " ", "static/css/chunk.css ", "static/css/main.css ", "static/js/chunk.js ", "static/js/main.js ", "favicon.png ",
+  "manifest.json ", "static/media/fa-solid-900.woff2 ", "static/media/FLSTM32U5.jpg ", "Read_Temperature ",
+  "Read_Pressure ", "Read_Humidity ",
+};
+
+#define BENCH_CHAIN_NBR          (sizeof(bench_chain_cmds) / sizeof(bench_chain_cmds[0]))
+
+static char bench_lines[BENCH_PATH_NBR][64];
+static uint32_t bench_path_sizes[BENCH_PATH_NBR];
+static uint32_t bench_chain_sizes[BENCH_CHAIN_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t bench_dispatch_index(const char *path, uint32_t path_size);
+static uint32_t bench_dispatch_chain(const char *line);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Time both dispatches over the same mix of requests
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  volatile uint32_t sink;
+  uint64_t start;
+  char     path[64];
+
+  HOST_CHECK(webserver_http_routes_init() == WEBSERVER_OK);
+  HOST_CHECK(webserver_http_assets_init(res_pack, res_pack_size) == WEBSERVER_OK);
+
+  /* Every route is found at its own key only, the path bytes the index reads being no proof of a match */
+  for (uint32_t i = 0U; i < http_routes_size; i++)
+  {
+    HOST_CHECK(webserver_http_route_find(http_routes[i].method, http_routes[i].path, http_routes[i].path_size) ==
+               &http_routes[i]);
+    HOST_CHECK(webserver_http_route_find(HTTP_METHOD_HEAD, http_routes[i].path, http_routes[i].path_size) == NULL);
+
+    memcpy(path, http_routes[i].path, http_routes[i].path_size);
+    path[http_routes[i].path_size - 1U] ^= 0x20;
+    HOST_CHECK(webserver_http_route_find(http_routes[i].method, path, http_routes[i].path_size) == NULL);
+  }
+  HOST_CHECK(webserver_http_route_find(HTTP_METHOD_GET, "/", 1U) == NULL);
+
+  for (uint32_t i = 0U; i < BENCH_CHAIN_NBR; i++)
+  {
+    bench_chain_sizes[i] = strlen(bench_chain_cmds[i]);
+  }
+
+  /* Both dispatches find the same paths */
+  for (uint32_t i = 0U; i < BENCH_PATH_NBR; i++)
+  {
+    bench_path_sizes[i] = strlen(bench_paths[i]);
+    (void)snprintf(bench_lines[i], sizeof(bench_lines[i]), "GET %s HTTP/1.1", bench_paths[i]);
+    HOST_CHECK((bench_dispatch_index(bench_paths[i], bench_path_sizes[i]) != 0U) ==
+               (bench_dispatch_chain(bench_lines[i]) != 0U));
+  }
+  HOST_CHECK(bench_dispatch_index(bench_paths[BENCH_PATH_NBR - 1U], bench_path_sizes[BENCH_PATH_NBR - 1U]) == 0U);
+
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    sink = bench_dispatch_index(bench_paths[i % BENCH_PATH_NBR], bench_path_sizes[i % BENCH_PATH_NBR]);
+  }
+  host_bench_report("dispatch: route and asset index", BENCH_LOOPS, host_bench_now() - start, "lookups");
+
+  start = host_bench_now();
+  for (uint32_t i = 0U; i < BENCH_LOOPS; i++)
+  {
+    sink = bench_dispatch_chain(bench_lines[i % BENCH_PATH_NBR]);
+  }
+  host_bench_report("dispatch: strncmp chain (before)", BENCH_LOOPS, host_bench_now() - start, "lookups");
+  (void)sink;
+
+  return host_test_end("bench_http_routes");
+}
+
+/**
+  * @brief  Dispatch a request path as the server does: route index, then web page asset index
+  * @param  path      : request path
+  * @param  path_size : request path length
+  * @retval 0 if nothing serves the path, 1 for a route, 2 for an asset
+  */
+static uint32_t bench_dispatch_index(const char *path, uint32_t path_size)
+{
+  if (webserver_http_route_find(HTTP_METHOD_GET, path, path_size) != NULL)
+  {
+    return 1U;
+  }
+
+  return (webserver_http_asset_find(path, path_size) != HTTP_ASSET_NONE) ? 2U : 0U;
+}
+
+/**
+  * @brief  Dispatch a request line as the server did before the route table: one strncmp per command, in turn
+  * @param  line : request line
+  * @retval 0 if no command matches, the command number plus 1 otherwise
+  */
+static uint32_t bench_dispatch_chain(const char *line)
+{
+  if (strncmp(line, "GET /", 5U) != 0)
+  {
+    return 0U;
+  }
+
+  for (uint32_t i = 0U; i < BENCH_CHAIN_NBR; i++)
+  {
+    if (strncmp(&line[5], bench_chain_cmds[i], bench_chain_sizes[i]) == 0)
+    {
+      return i + 1U;
+    }
+  }
+
+  return 0U;
+}
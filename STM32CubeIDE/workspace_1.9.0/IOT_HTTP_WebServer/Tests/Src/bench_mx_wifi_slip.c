@@ -0,0 +1,306 @@
+/**
+  **********************************************************************************************************************
+  * @file    bench_mx_wifi_slip.c
+  * @author  MCD Application Team
+  * @brief   Host benchmark of the Wi-Fi module UART link SLIP encoder, in command bytes encoded per second: encoder
+  *          writing to the bounded UART send buffer, against the encoder allocating a frame per command it replaced.
+  *          Its frames are first checked against the replaced encoder, and decoded back by the link SLIP decoder.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "mx_wifi.h"
+#include "mx_wifi_ipc.h"
+#include "mx_wifi_slip.h"
+#include "res.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define BENCH_COMMAND_SIZE       (MIPC_PKT_MAX_SIZE)
+#define BENCH_FRAME_MAX_SIZE     ((2U * BENCH_COMMAND_SIZE) + 2U)
+#define BENCH_LOOPS              (20000U)
+#define BENCH_CHECK_NBR          (3000U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint8_t bench_random_bytes[BENCH_COMMAND_SIZE];
+static uint8_t bench_escaped_bytes[BENCH_COMMAND_SIZE];
+static uint8_t bench_buffer[MX_WIFI_UART_TX_BUFFER_SIZE];
+
+/* Frame written by the encoder through its output, and a byte of every output call, for it not to be optimized out */
+static uint8_t           bench_frame[BENCH_FRAME_MAX_SIZE];
+static uint32_t          bench_frame_size;
+static volatile uint32_t bench_sink;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void bench_check(void);
+static void bench_run(const char *name, const uint8_t *data);
+static uint8_t *bench_slip_transfer(uint8_t *data, uint16_t len, uint16_t *outlen);
+static uint16_t bench_capture(uint8_t *data, uint16_t len);
+static uint16_t bench_drop(uint8_t *data, uint16_t len);
+static uint16_t bench_fail(uint8_t *data, uint16_t len);
+static uint32_t bench_random(void);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Check the encoder, then time it over web page bytes, random bytes and bytes to escape only
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  for (uint32_t i = 0U; i < BENCH_COMMAND_SIZE; i++)
+  {
+    bench_random_bytes[i]  = (uint8_t)bench_random();
+    bench_escaped_bytes[i] = SLIP_ESCAPE;
+  }
+
+  bench_check();
+
+  if (HOST_CHECK(res_pack_size >= BENCH_COMMAND_SIZE))
+  {
+    bench_run("web page", &res_pack[(res_pack_size - BENCH_COMMAND_SIZE) / 2U]);
+  }
+  bench_run("random bytes", bench_random_bytes);
+  bench_run("escapes only", bench_escaped_bytes);
+
+  return host_test_end("bench_mx_wifi_slip");
+}
+
+/**
+  * @brief  Encode commands of any size, from none to only bytes to escape, in send buffers of any size: the frame is
+  *         the one of the replaced encoder, byte for byte, and the link decoder gets the command back from it
+  * @param  None
+  * @retval None
+  */
+static void bench_check(void)
+{
+  static const uint8_t special[] = {SLIP_START, SLIP_END, SLIP_ESCAPE};
+  uint8_t  command[BENCH_COMMAND_SIZE];
+  uint8_t  *reference;
+  uint16_t reference_size;
+  uint16_t len;
+  uint16_t buf_size;
+  uint32_t encoded;
+  uint32_t density;
+  mx_buf_t *decoded;
+  bool     same = true;
+  bool     decoded_back = true;
+
+  for (uint32_t n = 0U; n < BENCH_CHECK_NBR; n++)
+  {
+    len = (uint16_t)(bench_random() % (BENCH_COMMAND_SIZE + 1U));
+    buf_size = (uint16_t)(2U + (bench_random() % (sizeof(bench_buffer) - 1U)));
+    density = n % 4U;
+    for (uint32_t i = 0U; i < len; i++)
+    {
+      command[i] = (uint8_t)bench_random();
+      if ((density == 3U) || ((density == 2U) && ((bench_random() % 8U) == 0U)))
+      {
+        command[i] = special[bench_random() % sizeof(special)];
+      }
+    }
+
+    bench_frame_size = 0U;
+    encoded = slip_encode(command, len, bench_buffer, buf_size, bench_capture);
+    reference = bench_slip_transfer(command, len, &reference_size);
+    same &= (reference != NULL) && (encoded == reference_size) && (bench_frame_size == reference_size) &&
+            (memcmp(bench_frame, reference, reference_size) == 0);
+    MX_WIFI_FREE(reference);
+
+    decoded = NULL;
+    for (uint32_t i = 0U; i < bench_frame_size; i++)
+    {
+      decoded_back &= (decoded == NULL);
+      decoded = slip_input_byte(bench_frame[i]);
+    }
+    decoded_back &= (decoded != NULL) && (MX_NET_BUFFER_GET_PAYLOAD_SIZE(decoded) == len) &&
+                    (memcmp(MX_NET_BUFFER_PAYLOAD(decoded), command, len) == 0);
+    if (decoded != NULL)
+    {
+      MX_NET_BUFFER_FREE(decoded);
+    }
+  }
+  HOST_CHECK(same);
+  HOST_CHECK(decoded_back);
+
+  /* Send buffer too small, output failing */
+  HOST_CHECK(slip_encode(bench_random_bytes, 16U, bench_buffer, 1U, bench_capture) == 0U);
+  HOST_CHECK(slip_encode(bench_random_bytes, BENCH_COMMAND_SIZE, bench_buffer, sizeof(bench_buffer),
+                         bench_fail) == 0U);
+}
+
+/**
+  * @brief  Time the encoders over commands of the largest size
+  * @param  name : command bytes name
+  * @param  data : command bytes, BENCH_COMMAND_SIZE of them
+  * @retval None
+  */
+static void bench_run(const char *name, const uint8_t *data)
+{
+  uint8_t  command[BENCH_COMMAND_SIZE];
+  uint8_t  *frame;
+  uint16_t frame_size;
+  char     report[64];
+  uint64_t start;
+  uint32_t ok = 0U;
+
+  memcpy(command, data, sizeof(command));
+
+  start = host_bench_now();
+  for (uint32_t loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    ok += (slip_encode(command, BENCH_COMMAND_SIZE, bench_buffer, sizeof(bench_buffer), bench_drop) > 0U) ? 1U : 0U;
+  }
+  (void)snprintf(report, sizeof(report), "%s, bounded buffer", name);
+  host_bench_report(report, (uint64_t)BENCH_LOOPS * BENCH_COMMAND_SIZE, host_bench_now() - start, "bytes");
+
+  start = host_bench_now();
+  for (uint32_t loop = 0U; loop < BENCH_LOOPS; loop++)
+  {
+    frame = bench_slip_transfer(command, BENCH_COMMAND_SIZE, &frame_size);
+    if (frame != NULL)
+    {
+      ok += (bench_drop(frame, frame_size) == frame_size) ? 1U : 0U;
+      MX_WIFI_FREE(frame);
+    }
+  }
+  (void)snprintf(report, sizeof(report), "%s, frame per command (before)", name);
+  host_bench_report(report, (uint64_t)BENCH_LOOPS * BENCH_COMMAND_SIZE, host_bench_now() - start, "bytes");
+
+  HOST_CHECK(ok == (2U * BENCH_LOOPS));
+}
+
+/**
+  * @brief  SLIP encoder replaced by slip_encode(): escapes counted, then a frame allocated and filled per command
+  * @param  data   : command
+  * @param  len    : command size
+  * @param  outlen : frame size (out)
+  * @retval Frame, to free with MX_WIFI_FREE(), NULL if not allocated
+  */
+static uint8_t *bench_slip_transfer(uint8_t *data, uint16_t len, uint16_t *outlen)
+{
+  uint16_t i;
+  uint16_t j;
+  uint16_t inc = 2;
+  uint8_t *buff = NULL;
+
+  for (i = 0; i < len; i++)
+  {
+    if ((data[i] == SLIP_START) || (data[i] == SLIP_END) || (data[i] == SLIP_ESCAPE))
+    {
+      inc++;
+    }
+  }
+
+  buff = (uint8_t *)MX_WIFI_MALLOC(len + inc);
+  if (buff == NULL)
+  {
+    return NULL;
+  }
+
+  buff[0] = SLIP_START;
+  for (i = 0, j = 1; i < len; i++)
+  {
+    if (data[i] == SLIP_START)
+    {
+      buff[j++] = SLIP_ESCAPE;
+      buff[j++] = SLIP_ESCAPE_START;
+    }
+    else if (data[i] == SLIP_END)
+    {
+      buff[j++] = SLIP_ESCAPE;
+      buff[j++] = SLIP_ESCAPE_END;
+    }
+    else if (data[i] == SLIP_ESCAPE)
+    {
+      buff[j++] = SLIP_ESCAPE;
+      buff[j++] = SLIP_ESCAPE_ES;
+    }
+    else
+    {
+      buff[j++] = data[i];
+    }
+  }
+  buff[j++] = SLIP_END;
+  *outlen = j;
+
+  return buff;
+}
+
+/**
+  * @brief  Encoder output appending to the frame
+  * @param  data : frame part
+  * @param  len  : frame part size
+  * @retval Bytes taken
+  */
+static uint16_t bench_capture(uint8_t *data, uint16_t len)
+{
+  if ((bench_frame_size + len) > sizeof(bench_frame))
+  {
+    return 0U;
+  }
+  memcpy(&bench_frame[bench_frame_size], data, len);
+  bench_frame_size += len;
+
+  return len;
+}
+
+/**
+  * @brief  Encoder output taking all bytes, as the UART send does
+  * @param  data : frame part
+  * @param  len  : frame part size
+  * @retval Bytes taken
+  */
+static uint16_t bench_drop(uint8_t *data, uint16_t len)
+{
+  bench_sink += data[len - 1U];
+
+  return len;
+}
+
+/**
+  * @brief  Encoder output failing after its first call
+  * @param  data : frame part
+  * @param  len  : frame part size
+  * @retval Bytes taken
+  */
+static uint16_t bench_fail(uint8_t *data, uint16_t len)
+{
+  static bool failing = false;
+  uint16_t    taken = failing ? (len - 1U) : len;
+
+  (void)data;
+  failing = true;
+
+  return taken;
+}
+
+/**
+  * @brief  Pseudo random number, fixed sequence
+  * @param  None
+  * @retval Next number of the sequence
+  */
+static uint32_t bench_random(void)
+{
+  static uint32_t state = 0x12345678U;
+
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+
+  return state;
+}
@@ -0,0 +1,288 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_hts221.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the HTS221 driver over a register level fake of the sensor on its I2C bus: bus transactions
+  *          of a sample read, and the calibration lines cached at init against the exact ones
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "hts221.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Factory calibration of a part, as held in its registers
+  */
+typedef struct
+{
+  uint8_t  h0_rh_x2;                            /*!< First humidity point, in %rH * 2            */
+  uint8_t  h1_rh_x2;                            /*!< Second humidity point, in %rH * 2           */
+  int16_t  h0_out;                              /*!< Raw output of the first humidity point      */
+  int16_t  h1_out;                              /*!< Raw output of the second humidity point     */
+  uint16_t t0_degc_x8;                          /*!< First temperature point, in degC * 8        */
+  uint16_t t1_degc_x8;                          /*!< Second temperature point, in degC * 8       */
+  int16_t  t0_out;                              /*!< Raw output of the first temperature point   */
+  int16_t  t1_out;                              /*!< Raw output of the second temperature point  */
+} test_calib_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Register auto increment bit of an I2C access */
+#define TEST_AUTO_INCREMENT      (0x80U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Parts: typical ones, then the steepest slopes the documented bound holds for */
+static const test_calib_t test_parts[] =
+{
+  {66U, 151U, -36, -10630, 156U, 242U, -12, 700},
+  {40U, 160U, 1200, -5300, 8U, 300U, 320, -420},
+  {0U, 190U, -1000, 1000, 0U, 320U, -500, 500},
+};
+
+/* Parts the driver refuses: equal raw outputs, then a slope out of its 32 bits */
+static const test_calib_t test_bad_parts[] =
+{
+  {66U, 151U, 300, 300, 156U, 242U, -12, 700},
+  {66U, 151U, -36, -10630, 0U, 1023U, 0, 1},
+};
+
+/* Fake part */
+static uint8_t  test_regs[256];
+static uint32_t test_transactions;
+static uint32_t test_calib_reads;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static int32_t test_bus_init(void);
+static int32_t test_bus_deinit(void);
+static int32_t test_bus_tick(void);
+static int32_t test_bus_read(uint16_t address, uint16_t reg, uint8_t *data, uint16_t length);
+static int32_t test_bus_write(uint16_t address, uint16_t reg, uint8_t *data, uint16_t length);
+static void test_part_set(const test_calib_t *calib);
+static void test_raw_set(uint8_t reg, int16_t raw);
+static bool test_part_init(HTS221_Object_t *hts221, const test_calib_t *calib);
+static void test_part(const test_calib_t *calib);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the HTS221 driver tests
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  HTS221_Object_t hts221;
+
+  for (uint32_t i = 0U; i < (sizeof(test_parts) / sizeof(test_parts[0])); i++)
+  {
+    test_part(&test_parts[i]);
+  }
+
+  for (uint32_t i = 0U; i < (sizeof(test_bad_parts) / sizeof(test_bad_parts[0])); i++)
+  {
+    HOST_CHECK(!test_part_init(&hts221, &test_bad_parts[i]));
+  }
+
+  return host_test_end("test_hts221");
+}
+
+/**
+  * @brief  Bus init, nothing to do
+  * @param  None
+  * @retval 0
+  */
+static int32_t test_bus_init(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus deinit, nothing to do
+  * @param  None
+  * @retval 0
+  */
+static int32_t test_bus_deinit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Bus tick
+  * @param  None
+  * @retval 0, the driver does not wait
+  */
+static int32_t test_bus_tick(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Read registers of the fake part, one bus transaction
+  * @param  address : device address
+  * @param  reg     : first register, auto increment bit included
+  * @param  data    : register values (out)
+  * @param  length  : number of registers
+  * @retval 0, -1 if the access is not one the part accepts
+  */
+static int32_t test_bus_read(uint16_t address, uint16_t reg, uint8_t *data, uint16_t length)
+{
+  uint8_t first = (uint8_t)(reg & ~TEST_AUTO_INCREMENT);
+
+  test_transactions++;
+  if ((address != HTS221_I2C_ADDRESS) || ((length > 1U) && ((reg & TEST_AUTO_INCREMENT) == 0U)) ||
+      ((first + length) > sizeof(test_regs)))
+  {
+    return -1;
+  }
+
+  if ((first <= HTS221_T1_OUT_H) && ((first + length) > HTS221_H0_RH_X2))
+  {
+    test_calib_reads++;
+  }
+  memcpy(data, &test_regs[first], length);
+
+  return 0;
+}
+
+/**
+  * @brief  Write registers of the fake part, one bus transaction
+  * @param  address : device address
+  * @param  reg     : first register, auto increment bit included
+  * @param  data    : register values
+  * @param  length  : number of registers
+  * @retval 0, -1 if the access is not one the part accepts
+  */
+static int32_t test_bus_write(uint16_t address, uint16_t reg, uint8_t *data, uint16_t length)
+{
+  uint8_t first = (uint8_t)(reg & ~TEST_AUTO_INCREMENT);
+
+  test_transactions++;
+  if ((address != HTS221_I2C_ADDRESS) || ((length > 1U) && ((reg & TEST_AUTO_INCREMENT) == 0U)) ||
+      ((first + length) > sizeof(test_regs)))
+  {
+    return -1;
+  }
+  memcpy(&test_regs[first], data, length);
+
+  return 0;
+}
+
+/**
+  * @brief  Load a factory calibration in the fake part registers
+  * @param  calib : factory calibration
+  * @retval None
+  */
+static void test_part_set(const test_calib_t *calib)
+{
+  memset(test_regs, 0, sizeof(test_regs));
+  test_regs[HTS221_WHO_AM_I]   = HTS221_ID;
+  test_regs[HTS221_H0_RH_X2]   = calib->h0_rh_x2;
+  test_regs[HTS221_H1_RH_X2]   = calib->h1_rh_x2;
+  test_regs[HTS221_T0_DEGC_X8] = (uint8_t)calib->t0_degc_x8;
+  test_regs[HTS221_T1_DEGC_X8] = (uint8_t)calib->t1_degc_x8;
+  test_regs[HTS221_T1_T0_MSB]  = (uint8_t)(((calib->t0_degc_x8 >> 8) & 0x3U) |
+                                           (((calib->t1_degc_x8 >> 8) & 0x3U) << 2));
+  test_raw_set(HTS221_H0_T0_OUT_L, calib->h0_out);
+  test_raw_set(HTS221_H1_T0_OUT_L, calib->h1_out);
+  test_raw_set(HTS221_T0_OUT_L, calib->t0_out);
+  test_raw_set(HTS221_T1_OUT_L, calib->t1_out);
+}
+
+/**
+  * @brief  Set a 16-bit register pair of the fake part
+  * @param  reg : low byte register
+  * @param  raw : value
+  * @retval None
+  */
+static void test_raw_set(uint8_t reg, int16_t raw)
+{
+  test_regs[reg]      = (uint8_t)((uint16_t)raw & 0xFFU);
+  test_regs[reg + 1U] = (uint8_t)((uint16_t)raw >> 8);
+}
+
+/**
+  * @brief  Register the fake part bus and initialize the driver
+  * @param  hts221 : driver object
+  * @param  calib  : factory calibration of the part
+  * @retval true if the driver accepted the part
+  */
+static bool test_part_init(HTS221_Object_t *hts221, const test_calib_t *calib)
+{
+  HTS221_IO_t io = {test_bus_init, test_bus_deinit, HTS221_I2C_BUS, HTS221_I2C_ADDRESS, test_bus_write,
+                    test_bus_read, test_bus_tick};
+
+  memset(hts221, 0, sizeof(*hts221));
+  test_part_set(calib);
+
+  return (HTS221_RegisterBusIO(hts221, &io) == HTS221_OK) && (HTS221_Init(hts221) == HTS221_OK);
+}
+
+/**
+  * @brief  Read every raw value of both outputs of a part: one bus transaction each, no calibration read, and within
+  *         the documented bound of the exact calibration line
+  * @param  calib : factory calibration of the part
+  * @retval None
+  */
+static void test_part(const test_calib_t *calib)
+{
+  HTS221_Object_t hts221;
+  double   h0 = calib->h0_rh_x2 / 2.0;
+  double   h1 = calib->h1_rh_x2 / 2.0;
+  double   t0 = calib->t0_degc_x8 / 8.0;
+  double   t1 = calib->t1_degc_x8 / 8.0;
+  double   exact;
+  double   error_max = 0.0;
+  float    value;
+  uint32_t transactions;
+  bool     ok = true;
+
+  if (!HOST_CHECK(test_part_init(&hts221, calib)))
+  {
+    return;
+  }
+  HOST_CHECK(test_calib_reads > 0U);
+  HOST_CHECK((HTS221_HUM_Enable(&hts221) == HTS221_OK) && (HTS221_TEMP_Enable(&hts221) == HTS221_OK));
+
+  test_calib_reads = 0U;
+  for (int32_t raw = INT16_MIN; raw <= INT16_MAX; raw++)
+  {
+    test_raw_set(HTS221_TEMP_OUT_L, (int16_t)raw);
+    test_raw_set(HTS221_HUMIDITY_OUT_L, (int16_t)raw);
+
+    /* Temperature */
+    transactions = test_transactions;
+    ok &= (HTS221_TEMP_GetTemperature(&hts221, &value) == HTS221_OK);
+    ok &= (test_transactions - transactions) == 1U;
+    exact = t0 + (((t1 - t0) * (raw - calib->t0_out)) / (calib->t1_out - calib->t0_out));
+    ok &= fabs(value - exact) <= (ldexp(fabs(raw - calib->t0_out), -HTS221_CALIB_SHIFT) + ldexp(fabs(exact), -23));
+    error_max = fmax(error_max, fabs(value - exact));
+
+    /* Humidity, bounded to 0-100 %rH */
+    transactions = test_transactions;
+    ok &= (HTS221_HUM_GetHumidity(&hts221, &value) == HTS221_OK);
+    ok &= (test_transactions - transactions) == 1U;
+    exact = h0 + (((h1 - h0) * (raw - calib->h0_out)) / (calib->h1_out - calib->h0_out));
+    exact = fmin(fmax(exact, 0.0), 100.0);
+    ok &= fabs(value - exact) <= (ldexp(fabs(raw - calib->h0_out), -HTS221_CALIB_SHIFT) + ldexp(fabs(exact), -23));
+    error_max = fmax(error_max, fabs(value - exact));
+  }
+
+  HOST_CHECK(ok);
+  HOST_CHECK(test_calib_reads == 0U);
+  HOST_CHECK(error_max < 4e-3);
+  printf("test_hts221: largest error %.3g\n", error_max);
+}
@@ -0,0 +1,223 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_assets.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the asset pack reader over the OSPI NOR flash image Utilities/res_nor.py programs, mapped in
+  *          memory as the firmware maps the flash: the pack is read in place, and erased, truncated, too small or
+  *          partly programmed areas are rejected without reading beyond them
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_assets.h"
+#include "res.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Flash image the Makefile programs the pack into, at HTTP_ASSETS_OSPI_OFFSET */
+#define TEST_IMAGE               "build/res_nor.img"
+
+/* MX25LM51245G geometry, as in res_nor.py */
+#define TEST_FLASH_SIZE          (64U * 1024U * 1024U)
+#define TEST_SECTOR_SIZE         (64U * 1024U)
+#define TEST_PAGE_SIZE           (256U)
+#define TEST_ERASED              (0xFFU)
+
+/* Asset pack header layout, as written by res_pack.py */
+#define TEST_HEADER_SIZE         (20U)
+#define TEST_HEADER_ASSET_NBR    (6U)
+#define TEST_HEADER_PACK_SIZE    (8U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint8_t *test_flash;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void test_programmed(void);
+static void test_rejected(void);
+static bool test_rejects(const uint8_t *area, uint32_t area_size);
+static bool test_rejects_guarded(const uint8_t *data, uint32_t area_size);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the asset pack reader tests
+  * @param  argc : argument number
+  * @param  argv : arguments, the flash image, TEST_IMAGE if not given
+  * @retval Exit status
+  */
+int main(int argc, char *argv[])
+{
+  const char *image = (argc > 1) ? argv[1] : TEST_IMAGE;
+  int        fd = open(image, O_RDONLY);
+
+  /* Private mapping: the tests damage their copy of the flash, never the image */
+  test_flash = (fd >= 0) ? mmap(NULL, TEST_FLASH_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+  if (!HOST_CHECK(test_flash != MAP_FAILED))
+  {
+    printf("test_http_assets: %s not mapped, run Utilities/res_nor.py program %s\n", image, image);
+    return host_test_end("test_http_assets");
+  }
+  (void)close(fd);
+
+  test_programmed();
+  test_rejected();
+
+  (void)munmap(test_flash, TEST_FLASH_SIZE);
+
+  return host_test_end("test_http_assets");
+}
+
+/**
+  * @brief  Read the pack programmed in the flash: it holds the pack the firmware links in, byte for byte, and every
+  *         asset is found by its path, with bodies in place in the flash
+  * @param  None
+  * @retval None
+  */
+static void test_programmed(void)
+{
+  const uint8_t      *area = &test_flash[HTTP_ASSETS_OSPI_OFFSET];
+  const http_asset_t *asset;
+  uint32_t           asset_nbr;
+  bool               ok = true;
+
+  HOST_CHECK(memcmp(area, res_pack, res_pack_size) == 0);
+  HOST_CHECK(webserver_http_assets_init(res_pack, res_pack_size) == WEBSERVER_OK);
+  asset_nbr = webserver_http_assets_count();
+
+  /* The whole flash past the pack offset, as the firmware maps it */
+  if (!HOST_CHECK(webserver_http_assets_init(area, TEST_FLASH_SIZE - HTTP_ASSETS_OSPI_OFFSET) == WEBSERVER_OK))
+  {
+    return;
+  }
+  HOST_CHECK((asset_nbr > 0U) && (webserver_http_assets_count() == asset_nbr));
+
+  for (uint32_t i = 0U; i < asset_nbr; i++)
+  {
+    asset = webserver_http_asset_get(i);
+    ok &= (webserver_http_asset_find(asset->path, asset->path_size) == i);
+    ok &= ((const uint8_t *)asset->path > area) && ((const uint8_t *)asset->path < &area[res_pack_size]);
+
+    for (uint32_t coding = HTTP_CODING_IDENTITY; coding < HTTP_CODING_NBR; coding++)
+    {
+      if (asset->codings[coding].body != NULL)
+      {
+        ok &= ((const uint8_t *)asset->codings[coding].body > area) &&
+              ((const uint8_t *)&asset->codings[coding].body[asset->codings[coding].body_size] <=
+               &area[res_pack_size]) && (asset->codings[coding].etag != NULL);
+      }
+    }
+    ok &= (asset->codings[HTTP_CODING_IDENTITY].body != NULL);
+  }
+  HOST_CHECK(ok);
+
+  /* An area ending with the pack is enough */
+  HOST_CHECK(webserver_http_assets_init(area, res_pack_size) == WEBSERVER_OK);
+}
+
+/**
+  * @brief  Check the areas the reader must reject
+  * @param  None
+  * @retval None
+  */
+static void test_rejected(void)
+{
+  uint8_t  *area = &test_flash[HTTP_ASSETS_OSPI_OFFSET];
+  uint32_t pack_size;
+  uint16_t asset_nbr;
+  bool     ok = true;
+
+  memcpy(&pack_size, &area[TEST_HEADER_PACK_SIZE], sizeof(pack_size));
+  memcpy(&asset_nbr, &area[TEST_HEADER_ASSET_NBR], sizeof(asset_nbr));
+  HOST_CHECK(pack_size == res_pack_size);
+
+  /* Erased: a sector past the pack, the last one of the flash, then the pack area once erased */
+  HOST_CHECK(test_rejects(&test_flash[2U * TEST_SECTOR_SIZE], TEST_SECTOR_SIZE));
+  HOST_CHECK(test_rejects(&test_flash[TEST_FLASH_SIZE - TEST_SECTOR_SIZE], TEST_SECTOR_SIZE));
+
+  /* Too small for a header, whatever it holds */
+  for (uint32_t area_size = 0U; area_size < TEST_HEADER_SIZE; area_size++)
+  {
+    ok &= test_rejects_guarded(area, area_size);
+  }
+  HOST_CHECK(ok);
+
+  /* Truncated: the area ends before the pack does */
+  HOST_CHECK(test_rejects_guarded(area, pack_size - 1U));
+  HOST_CHECK(test_rejects_guarded(area, pack_size / 2U));
+  HOST_CHECK(test_rejects_guarded(area, TEST_HEADER_SIZE));
+
+  /* Programming stopped after the first page: the asset strings read as erased */
+  memset(&area[TEST_PAGE_SIZE], TEST_ERASED, pack_size - TEST_PAGE_SIZE);
+  HOST_CHECK(test_rejects(area, TEST_FLASH_SIZE - HTTP_ASSETS_OSPI_OFFSET));
+
+  /* Index slot past the asset table */
+  memcpy(area, res_pack, pack_size);
+  HOST_CHECK(webserver_http_assets_init(area, pack_size) == WEBSERVER_OK);
+  memcpy(&area[TEST_HEADER_SIZE], &asset_nbr, sizeof(asset_nbr));
+  HOST_CHECK(test_rejects(area, pack_size));
+
+  /* Pack size field beyond the area */
+  memcpy(area, res_pack, pack_size);
+  area[TEST_HEADER_PACK_SIZE + 3U] = 0x7FU;
+  HOST_CHECK(test_rejects(area, pack_size));
+
+  /* Whole pack erased */
+  memset(area, TEST_ERASED, pack_size);
+  HOST_CHECK(test_rejects(area, TEST_FLASH_SIZE - HTTP_ASSETS_OSPI_OFFSET));
+}
+
+/**
+  * @brief  Check the reader rejects an area, and serves no asset after it
+  * @param  area      : memory area
+  * @param  area_size : memory area size
+  * @retval true if the area is rejected
+  */
+static bool test_rejects(const uint8_t *area, uint32_t area_size)
+{
+  return (webserver_http_assets_init(area, area_size) != WEBSERVER_OK) && (webserver_http_assets_count() == 0U) &&
+         (webserver_http_asset_find("/", 1U) == HTTP_ASSET_NONE) && (webserver_http_asset_get(0U) == NULL);
+}
+
+/**
+  * @brief  Check the reader rejects an area ending right before an inaccessible page, so that any field read beyond
+  *         the area faults
+  * @param  data      : area content
+  * @param  area_size : memory area size
+  * @retval true if the area is rejected
+  */
+static bool test_rejects_guarded(const uint8_t *data, uint32_t area_size)
+{
+  uint32_t page_size = (uint32_t)sysconf(_SC_PAGESIZE);
+  uint32_t map_size  = (((area_size + page_size - 1U) / page_size) + 1U) * page_size;
+  uint8_t  *map      = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  uint8_t  *area;
+  bool     rejected;
+
+  if ((map == MAP_FAILED) || (mprotect(&map[map_size - page_size], page_size, PROT_NONE) != 0))
+  {
+    return false;
+  }
+
+  /* 4 bytes aligned as the flash window, the guard page follows within 3 bytes */
+  area = &map[(map_size - page_size - area_size) & ~3U];
+  memcpy(area, data, area_size);
+  rejected = test_rejects(area, area_size);
+  (void)munmap(map, map_size);
+
+  return rejected;
+}
@@ -0,0 +1,102 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_codings.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the content coding negotiation: the web page is sent gzip coded to clients accepting it,
+  *          unless its quality value is zero, with CRLF and bare LF terminated header lines alike
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define TEST_GZIP_HEADER         "\r\nContent-Encoding: gzip\r\n"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint16_t test_port;
+static host_client_t test_client;
+static host_response_t test_response;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static bool test_gzip(const char *accept_encoding, const char *eol);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the coding tests against a host web server
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  static const char *const eols[] = {"\r\n", "\n"};
+
+  test_port = host_server_start();
+  if (!HOST_CHECK(test_port != 0U) || !HOST_CHECK(host_client_open(&test_client, test_port)))
+  {
+    return host_test_end("test_http_codings");
+  }
+
+  for (uint32_t i = 0U; i < (sizeof(eols) / sizeof(eols[0])); i++)
+  {
+    /* Accepted */
+    HOST_CHECK(test_gzip("gzip", eols[i]));
+    HOST_CHECK(test_gzip("deflate, gzip;q=0.5", eols[i]));
+    HOST_CHECK(test_gzip("gzip; q=0.01", eols[i]));
+    HOST_CHECK(test_gzip("*", eols[i]));
+
+    /* Refused, or not listed */
+    HOST_CHECK(!test_gzip(NULL, eols[i]));
+    HOST_CHECK(!test_gzip("identity", eols[i]));
+    HOST_CHECK(!test_gzip("gzip;q=0", eols[i]));
+    HOST_CHECK(!test_gzip("gzip;q=0.000", eols[i]));
+    HOST_CHECK(!test_gzip("gzip;Q=0, identity", eols[i]));
+    HOST_CHECK(!test_gzip("*;q=0", eols[i]));
+  }
+
+  host_client_close(&test_client);
+
+  return host_test_end("test_http_codings");
+}
+
+/**
+  * @brief  Get the web page with an Accept-Encoding header field, followed by another field
+  * @param  accept_encoding : Accept-Encoding field value, NULL for no field
+  * @param  eol             : header line terminator
+  * @retval true if the page is sent gzip coded
+  */
+static bool test_gzip(const char *accept_encoding, const char *eol)
+{
+  char request[256];
+
+  if (accept_encoding != NULL)
+  {
+    (void)snprintf(request, sizeof(request), "GET / HTTP/1.1%sAccept-Encoding: %s%sHost: board%s%s", eol,
+                   accept_encoding, eol, eol, eol);
+  }
+  else
+  {
+    (void)snprintf(request, sizeof(request), "GET / HTTP/1.1%sHost: board%s%s", eol, eol, eol);
+  }
+
+  if (!HOST_CHECK(host_client_send(&test_client, request, strlen(request)) &&
+                  host_client_response(&test_client, &test_response, false) && (test_response.status == 200)))
+  {
+    return false;
+  }
+
+  return strstr(test_response.header, TEST_GZIP_HEADER) != NULL;
+}
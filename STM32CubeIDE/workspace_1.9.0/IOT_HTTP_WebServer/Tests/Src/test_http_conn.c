@@ -0,0 +1,295 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_conn.c
+  * @author  MCD Application Team
+  * @brief   Host test of the HTTP connections: persistent connections, pipelined requests, idle timeout and
+  *          requests limit, motion streams counted by the sensors while open
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "stm32u5xx_hal.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Limits of a persistent connection, as set in webserver_http_conn.c */
+#define TEST_KEEPALIVE_TIMEOUT       (5000U)
+#define TEST_KEEPALIVE_MAX_REQUESTS  (100U)
+
+#define TEST_GET_TEMPERATURE         "GET /Read_Temperature HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_GET_HUMIDITY            "GET /Read_Humidity HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_GET_INDEX               "GET / HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_GET_MOTION              "GET /api/motion HTTP/1.1\r\nHost: board\r\nUpgrade: websocket\r\n" \
+                                     "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n" \
+                                     "Sec-WebSocket-Version: 13\r\n\r\n"
+#define TEST_GET_EVENTS              "GET /api/events HTTP/1.1\r\nHost: board\r\n\r\n"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint16_t test_port;
+static host_client_t test_client;
+static host_response_t test_response;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static bool test_request(host_client_t *client, const char *request, int status, bool close);
+static void test_pipelined(void);
+static void test_split(void);
+static void test_connection_close(void);
+static void test_idle_timeout(void);
+static void test_max_requests(void);
+static void test_motion_streams(void);
+static bool test_motion_streams_nbr(uint32_t nbr);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the connection tests against a host web server
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  test_port = host_server_start();
+  if (!HOST_CHECK(test_port != 0U))
+  {
+    return host_test_end("test_http_conn");
+  }
+
+  test_pipelined();
+  test_split();
+  test_connection_close();
+  test_idle_timeout();
+  test_max_requests();
+  test_motion_streams();
+
+  return host_test_end("test_http_conn");
+}
+
+/**
+  * @brief  Send a request and read its response
+  * @param  client  : client
+  * @param  request : request
+  * @param  status  : expected status code
+  * @param  close   : expected Connection: close
+  * @retval true if the response is the expected one
+  */
+static bool test_request(host_client_t *client, const char *request, int status, bool close)
+{
+  return host_client_send(client, request, strlen(request)) &&
+         host_client_response(client, &test_response, false) &&
+         (test_response.status == status) && (test_response.close == close);
+}
+
+/**
+  * @brief  Requests sent in a row, before any response, are answered in order on the same connection
+  * @param  None
+  * @retval None
+  */
+static void test_pipelined(void)
+{
+  static const char requests[] = TEST_GET_TEMPERATURE TEST_GET_INDEX TEST_GET_HUMIDITY;
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(host_client_send(&test_client, requests, sizeof(requests) - 1U));
+
+  HOST_CHECK(host_client_response(&test_client, &test_response, false));
+  HOST_CHECK((test_response.status == 200) && !test_response.close);
+  HOST_CHECK(strcmp(test_response.body, "23.5") == 0);
+
+  HOST_CHECK(host_client_response(&test_client, &test_response, false));
+  HOST_CHECK((test_response.status == 200) && !test_response.close);
+  HOST_CHECK(strstr(test_response.body, "<html") != NULL);
+
+  HOST_CHECK(host_client_response(&test_client, &test_response, false));
+  HOST_CHECK((test_response.status == 200) && !test_response.close);
+  HOST_CHECK(strcmp(test_response.body, "45.25") == 0);
+
+  /* Still open for the next one */
+  HOST_CHECK(test_request(&test_client, TEST_GET_TEMPERATURE, 200, false));
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  A request split over several segments, and one following it in the last segment, are both answered
+  * @param  None
+  * @retval None
+  */
+static void test_split(void)
+{
+  static const char requests[] = TEST_GET_TEMPERATURE TEST_GET_HUMIDITY;
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+
+  for (uint32_t i = 0U; i < (sizeof(requests) - 1U); i += 7U)
+  {
+    HOST_CHECK(host_client_send(&test_client, &requests[i], ((sizeof(requests) - 1U - i) < 7U) ?
+                                (sizeof(requests) - 1U - i) : 7U));
+    (void)usleep(2000);
+  }
+
+  HOST_CHECK(host_client_response(&test_client, &test_response, false) && (test_response.status == 200));
+  HOST_CHECK(strcmp(test_response.body, "23.5") == 0);
+  HOST_CHECK(host_client_response(&test_client, &test_response, false) && (test_response.status == 200));
+  HOST_CHECK(strcmp(test_response.body, "45.25") == 0);
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  A client asking for the close, or an HTTP/1.0 one, gets it after the response
+  * @param  None
+  * @retval None
+  */
+static void test_connection_close(void)
+{
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(&test_client, "GET /Read_Temperature HTTP/1.1\r\nConnection: close\r\n\r\n", 200, true));
+  HOST_CHECK(host_client_closed(&test_client, 1000U));
+  host_client_close(&test_client);
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(&test_client, "GET /Read_Temperature HTTP/1.0\r\n\r\n", 200, true));
+  HOST_CHECK(host_client_closed(&test_client, 1000U));
+  host_client_close(&test_client);
+
+  /* An HTTP/1.0 client may ask to keep it open */
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(&test_client, "GET /Read_Temperature HTTP/1.0\r\nConnection: keep-alive\r\n\r\n", 200,
+                          false));
+  HOST_CHECK(test_request(&test_client, TEST_GET_HUMIDITY, 200, false));
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  A persistent connection left idle is closed once the keep-alive timeout elapsed, not before
+  * @param  None
+  * @retval None
+  */
+static void test_idle_timeout(void)
+{
+  host_client_t idle_client;
+
+  /* Idle after a request */
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(&test_client, TEST_GET_TEMPERATURE, 200, false));
+
+  /* Idle from the accept */
+  HOST_CHECK(host_client_open(&idle_client, test_port));
+
+  host_tick_advance(TEST_KEEPALIVE_TIMEOUT - 1000U);
+  HOST_CHECK(!host_client_closed(&test_client, 200U));
+  HOST_CHECK(!host_client_closed(&idle_client, 0U));
+
+  /* Activity restarts the timeout */
+  HOST_CHECK(test_request(&test_client, TEST_GET_TEMPERATURE, 200, false));
+  host_tick_advance(TEST_KEEPALIVE_TIMEOUT - 1000U);
+  HOST_CHECK(!host_client_closed(&test_client, 200U));
+  HOST_CHECK(host_client_closed(&idle_client, 1000U));
+
+  host_tick_advance(1000U + 1U);
+  HOST_CHECK(host_client_closed(&test_client, 1000U));
+
+  host_client_close(&idle_client);
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  A persistent connection is closed after a number of requests, the last response telling so
+  * @param  None
+  * @retval None
+  */
+static void test_max_requests(void)
+{
+  bool ok = true;
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+
+  /* Two requests at a time, the second one pipelined */
+  for (uint32_t i = 1U; i < TEST_KEEPALIVE_MAX_REQUESTS; i += 2U)
+  {
+    ok &= host_client_send(&test_client, TEST_GET_TEMPERATURE TEST_GET_HUMIDITY,
+                           sizeof(TEST_GET_TEMPERATURE TEST_GET_HUMIDITY) - 1U);
+    ok &= host_client_response(&test_client, &test_response, false) && (test_response.status == 200) &&
+          (test_response.close == false);
+    ok &= host_client_response(&test_client, &test_response, false) && (test_response.status == 200) &&
+          (test_response.close == ((i + 1U) == TEST_KEEPALIVE_MAX_REQUESTS));
+  }
+  HOST_CHECK(ok);
+  HOST_CHECK(host_client_closed(&test_client, 1000U));
+  host_client_close(&test_client);
+
+  /* A request pipelined after the last one is not answered */
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  for (uint32_t i = 1U; i < TEST_KEEPALIVE_MAX_REQUESTS; i++)
+  {
+    ok &= test_request(&test_client, TEST_GET_TEMPERATURE, 200, false);
+  }
+  HOST_CHECK(ok);
+  HOST_CHECK(host_client_send(&test_client, TEST_GET_TEMPERATURE TEST_GET_HUMIDITY,
+                              sizeof(TEST_GET_TEMPERATURE TEST_GET_HUMIDITY) - 1U));
+  HOST_CHECK(host_client_response(&test_client, &test_response, false) && test_response.close);
+  HOST_CHECK(host_client_closed(&test_client, 1000U));
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  The sensors count a WebSocket motion stream from its opening to the connection close, once however many
+  *         batches it sends, and do not count a server-sent events stream
+  * @param  None
+  * @retval None
+  */
+static void test_motion_streams(void)
+{
+  host_client_t motion_client;
+
+  HOST_CHECK(test_motion_streams_nbr(0U));
+
+  HOST_CHECK(host_client_open(&motion_client, test_port));
+  HOST_CHECK(test_request(&motion_client, TEST_GET_MOTION, 101, false));
+  HOST_CHECK(test_motion_streams_nbr(1U));
+
+  /* Batches sent meanwhile */
+  host_tick_advance(1000U);
+  (void)usleep(50000);
+  HOST_CHECK(test_motion_streams_nbr(1U));
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  /* An events stream sends until the close, its response is not read */
+  HOST_CHECK(host_client_send(&test_client, TEST_GET_EVENTS, sizeof(TEST_GET_EVENTS) - 1U));
+  (void)usleep(50000);
+  HOST_CHECK(test_motion_streams_nbr(1U));
+  host_client_close(&test_client);
+
+  host_client_close(&motion_client);
+  HOST_CHECK(test_motion_streams_nbr(0U));
+}
+
+/**
+  * @brief  Wait for the sensors to count a number of motion streams
+  * @param  nbr : motion streams expected
+  * @retval true if counted within a second
+  */
+static bool test_motion_streams_nbr(uint32_t nbr)
+{
+  for (uint32_t i = 0U; i < 1000U; i++)
+  {
+    if (host_sensors_motion_streams() == nbr)
+    {
+      return true;
+    }
+    (void)usleep(1000);
+  }
+
+  return false;
+}
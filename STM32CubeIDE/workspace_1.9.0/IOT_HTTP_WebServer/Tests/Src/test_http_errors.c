@@ -0,0 +1,219 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_errors.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the requests the web server does not serve as GET ones: HEAD requests, methods it does not
+  *          implement, malformed and oversize requests
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Receive buffer size, as set in webserver_http_conn.h */
+#define TEST_RECEIVE_BUFFER_SIZE     (4096U)
+
+/* Time in ms the server has to close a connection */
+#define TEST_CLOSE_TIMEOUT           (1000U)
+
+#define TEST_GET_TEMPERATURE         "GET /Read_Temperature HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_GET_INDEX               "GET / HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_HEAD_INDEX              "HEAD / HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_HEAD_SENSORS            "HEAD /api/sensors HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_HEAD_EVENTS             "HEAD /api/events HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_HEAD_WEBSOCKET          "HEAD /api/motion HTTP/1.1\r\nHost: board\r\nUpgrade: websocket\r\n" \
+                                     "Connection: Upgrade\r\nSec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n" \
+                                     "Sec-WebSocket-Version: 13\r\n\r\n"
+#define TEST_DELETE_INDEX            "DELETE / HTTP/1.1\r\nHost: board\r\n\r\n"
+#define TEST_POST_INDEX              "POST / HTTP/1.1\r\nHost: board\r\nContent-Length: 5\r\n\r\nhello"
+#define TEST_POST_EMPTY              "POST / HTTP/1.1\r\nHost: board\r\nContent-Length: 00\r\n\r\n"
+#define TEST_POST_CHUNKED            "POST / HTTP/1.1\r\nHost: board\r\nTransfer-Encoding: chunked\r\n\r\n0\r\n\r\n"
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static uint16_t test_port;
+static host_client_t test_client;
+static host_response_t test_response;
+static char test_oversize[TEST_RECEIVE_BUFFER_SIZE + 1U];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static bool test_request(const char *request, int status, bool close, bool head);
+static void test_head(void);
+static void test_not_implemented(void);
+static void test_bad_request(void);
+static void test_oversize_request(void);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the error tests against a host web server
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  test_port = host_server_start();
+  if (!HOST_CHECK(test_port != 0U))
+  {
+    return host_test_end("test_http_errors");
+  }
+
+  test_head();
+  test_not_implemented();
+  test_bad_request();
+  test_oversize_request();
+
+  return host_test_end("test_http_errors");
+}
+
+/**
+  * @brief  Send a request on the test client and read its response
+  * @param  request : request, null terminated
+  * @param  status  : expected status code
+  * @param  close   : expected Connection: close
+  * @param  head    : response to a HEAD request, without body
+  * @retval true if the response is the expected one
+  */
+static bool test_request(const char *request, int status, bool close, bool head)
+{
+  return host_client_send(&test_client, request, strlen(request)) &&
+         host_client_response(&test_client, &test_response, head) &&
+         (test_response.status == status) && (test_response.close == close);
+}
+
+/**
+  * @brief  A HEAD response has the headers of the GET one and no body, and the connection goes on with the next
+  *         request
+  * @param  None
+  * @retval None
+  */
+static void test_head(void)
+{
+  uint32_t body_size;
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+
+  /* Web page asset, the same header as the GET response */
+  HOST_CHECK(test_request(TEST_GET_INDEX, 200, false, false));
+  body_size = test_response.body_size;
+  HOST_CHECK(test_request(TEST_HEAD_INDEX, 200, false, true));
+  HOST_CHECK(strtoul(strstr(test_response.header, "\r\nContent-Length:") + 17, NULL, 10) == body_size);
+
+  /* No body bytes follow: the next response is read right after the header */
+  HOST_CHECK(test_request(TEST_GET_TEMPERATURE, 200, false, false));
+  HOST_CHECK(strcmp(test_response.body, "23.5") == 0);
+
+  /* Body produced piece by piece, none of it is sent */
+  HOST_CHECK(test_request(TEST_HEAD_SENSORS, 200, false, true));
+  HOST_CHECK(strstr(test_response.header, "\r\nTransfer-Encoding: chunked\r\n") != NULL);
+  HOST_CHECK(test_request(TEST_GET_TEMPERATURE, 200, false, false));
+  HOST_CHECK(strcmp(test_response.body, "23.5") == 0);
+
+  /* Events stream, not opened */
+  HOST_CHECK(test_request(TEST_HEAD_EVENTS, 200, false, true));
+  HOST_CHECK(test_request(TEST_GET_TEMPERATURE, 200, false, false));
+  HOST_CHECK(strcmp(test_response.body, "23.5") == 0);
+
+  /* A WebSocket opening handshake must be a GET request */
+  HOST_CHECK(test_request(TEST_HEAD_WEBSOCKET, 400, false, true));
+  HOST_CHECK(test_request(TEST_GET_TEMPERATURE, 200, false, false));
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  Methods the server does not implement get a 501 response listing the implemented ones, the connection
+  *         stays open unless a request body follows
+  * @param  None
+  * @retval None
+  */
+static void test_not_implemented(void)
+{
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(TEST_DELETE_INDEX, 501, false, false));
+  HOST_CHECK(strstr(test_response.header, "\r\nAllow: GET, HEAD\r\n") != NULL);
+  HOST_CHECK(test_request(TEST_POST_EMPTY, 501, false, false));
+  HOST_CHECK(test_request(TEST_GET_TEMPERATURE, 200, false, false));
+
+  /* The body is not read, it cannot be told from a next request */
+  HOST_CHECK(test_request(TEST_POST_INDEX, 501, true, false));
+  HOST_CHECK(host_client_closed(&test_client, TEST_CLOSE_TIMEOUT));
+  host_client_close(&test_client);
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(TEST_POST_CHUNKED, 501, true, false));
+  HOST_CHECK(host_client_closed(&test_client, TEST_CLOSE_TIMEOUT));
+  host_client_close(&test_client);
+}
+
+/**
+  * @brief  A malformed request gets a 400 response, then the connection is closed
+  * @param  None
+  * @retval None
+  */
+static void test_bad_request(void)
+{
+  static const char *const requests[] =
+  {
+    "GARBAGE\r\n\r\n",
+    "GET index.html HTTP/1.1\r\n\r\n",
+    "GET / HTTP/2.0\r\n\r\n",
+    "GET / HTTP/1.1\r\nNo colon here\r\n\r\n",
+    "GET / HTTP/1.1\r\nHost : board\r\n\r\n",
+  };
+
+  for (uint32_t i = 0U; i < (sizeof(requests) / sizeof(requests[0])); i++)
+  {
+    HOST_CHECK(host_client_open(&test_client, test_port));
+    HOST_CHECK(test_request(requests[i], 400, true, false));
+    HOST_CHECK(host_client_closed(&test_client, TEST_CLOSE_TIMEOUT));
+    host_client_close(&test_client);
+  }
+}
+
+/**
+  * @brief  A request line, or a request header, filling the receive buffer gets a 414 or 431 response, then the
+  *         connection is closed
+  * @param  None
+  * @retval None
+  */
+static void test_oversize_request(void)
+{
+  uint32_t length;
+
+  /* Request line */
+  memset(test_oversize, 'a', TEST_RECEIVE_BUFFER_SIZE);
+  memcpy(test_oversize, "GET /", 5U);
+  test_oversize[TEST_RECEIVE_BUFFER_SIZE] = '\0';
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(test_oversize, 414, true, false));
+  HOST_CHECK(host_client_closed(&test_client, TEST_CLOSE_TIMEOUT));
+  host_client_close(&test_client);
+
+  /* Header fields, the end of headers never comes */
+  length = (uint32_t)snprintf(test_oversize, sizeof(test_oversize), "GET / HTTP/1.1\r\nHost: board\r\n");
+  while (length < TEST_RECEIVE_BUFFER_SIZE)
+  {
+    length += (uint32_t)snprintf(&test_oversize[length], sizeof(test_oversize) - length, "X-Padding: %s\r\n",
+                                 "0123456789abcdef0123456789abcdef");
+  }
+  test_oversize[TEST_RECEIVE_BUFFER_SIZE] = '\0';
+
+  HOST_CHECK(host_client_open(&test_client, test_port));
+  HOST_CHECK(test_request(test_oversize, 431, true, false));
+  HOST_CHECK(host_client_closed(&test_client, TEST_CLOSE_TIMEOUT));
+  host_client_close(&test_client);
+}
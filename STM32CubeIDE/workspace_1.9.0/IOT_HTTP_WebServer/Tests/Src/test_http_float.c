@@ -0,0 +1,311 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_float.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the float writer: every written value reads back as the same float, has no more digits
+  *          than the shortest printf output that does, the same ones when as long, and is in the documented notation.
+  *          The floats are checked by bit pattern, one in every STRIDE given on the command line (default 8191), on
+  *          all the host cores: "test_http_float 1" checks all of them, which takes minutes.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_float.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Share of the bit patterns checked by a thread, and its outcome
+  */
+typedef struct
+{
+  pthread_t thread;                             /*!< Checking thread                             */
+  uint64_t  first;                              /*!< First bit pattern                           */
+  uint64_t  end;                                /*!< Bit pattern after the last one              */
+  uint64_t  stride;                             /*!< Bit patterns between two checked ones       */
+  uint64_t  checked;                            /*!< Floats checked                              */
+  uint64_t  shorter;                            /*!< Floats written shorter than printf          */
+  uint64_t  failed;                             /*!< Floats failing a check                      */
+  uint32_t  first_failed;                       /*!< Bit pattern of the first failing float      */
+} test_share_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define TEST_STRIDE              (8191U)
+#define TEST_THREADS_MAX_NBR     (64U)
+
+/* Decimal notation range of the written value, as documented in webserver_http_float.c */
+#define TEST_DECIMAL_MIN         (1e-4)
+#define TEST_DECIMAL_END         (1e9)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static test_share_t test_shares[TEST_THREADS_MAX_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void test_patterns(uint64_t stride);
+static void test_values(void);
+static void *test_share_run(void *arg);
+static bool test_float(uint32_t bits, bool *shorter);
+static uint32_t test_digits(const char *text, char *digits);
+static bool test_notation(const char *text);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the float writer tests
+  * @param  argc : argument number
+  * @param  argv : arguments, the bit pattern stride, 1 for all floats
+  * @retval Exit status
+  */
+int main(int argc, char *argv[])
+{
+  uint64_t stride = (argc > 1) ? strtoull(argv[1], NULL, 10) : TEST_STRIDE;
+
+  test_values();
+  test_patterns((stride > 0U) ? stride : TEST_STRIDE);
+
+  return host_test_end("test_http_float");
+}
+
+/**
+  * @brief  Check the floats of a bit pattern stride, both signs, special values included, shared among threads
+  * @param  stride : bit patterns between two checked ones
+  * @retval None
+  */
+static void test_patterns(uint64_t stride)
+{
+  long     cores = sysconf(_SC_NPROCESSORS_ONLN);
+  uint32_t thread_nbr = ((cores > 0) && (cores < (long)TEST_THREADS_MAX_NBR)) ? (uint32_t)cores : 1U;
+  uint64_t share = ((1ULL << 32) / thread_nbr) + 1U;
+  uint64_t checked = 0U;
+  uint64_t shorter = 0U;
+  uint64_t failed = 0U;
+
+  for (uint32_t i = 0U; i < thread_nbr; i++)
+  {
+    test_shares[i].first  = i * share;
+    test_shares[i].end    = ((i + 1U) * share < (1ULL << 32)) ? ((i + 1U) * share) : (1ULL << 32);
+    test_shares[i].stride = stride;
+    HOST_CHECK(pthread_create(&test_shares[i].thread, NULL, test_share_run, &test_shares[i]) == 0);
+  }
+
+  for (uint32_t i = 0U; i < thread_nbr; i++)
+  {
+    (void)pthread_join(test_shares[i].thread, NULL);
+    checked += test_shares[i].checked;
+    shorter += test_shares[i].shorter;
+    failed  += test_shares[i].failed;
+    if (test_shares[i].failed != 0U)
+    {
+      printf("test_http_float: float 0x%08X failed\n", (unsigned int)test_shares[i].first_failed);
+    }
+  }
+
+  printf("test_http_float: %llu floats, 1 in %llu, %llu shorter than printf\n", (unsigned long long)checked,
+         (unsigned long long)stride, (unsigned long long)shorter);
+  HOST_CHECK(checked >= ((1ULL << 32) / stride));
+  HOST_CHECK(failed == 0U);
+}
+
+/**
+  * @brief  Check the values at the notation bounds, every power of two, the range ends and sensor values
+  * @param  None
+  * @retval None
+  */
+static void test_values(void)
+{
+  static const float values[] =
+  {
+    1e-4f, 1e9f, 999999936.0f, 123456792.0f, 0.00012345f, 23.5f, 45.25f, 1013.2f, 1000.0f, 0.1f, 1.0f,
+    3.4028235e38f, 1.17549435e-38f, 1.4e-45f, 0.0f, -0.0f,
+  };
+  char  text[HTTP_FLOAT_SIZE];
+  bool  shorter;
+  bool  ok = true;
+  float value;
+
+  /* Notation bounds: decimal from 1e-4, scientific from 1e9 */
+  HOST_CHECK((webserver_http_float_format(1e-4f, text) == 6U) && (strcmp(text, "0.0001") == 0));
+  HOST_CHECK((webserver_http_float_format(nextafterf(1e-4f, 0.0f), text) > 6U) && (strchr(text, 'e') != NULL));
+  HOST_CHECK((webserver_http_float_format(1e9f, text) == 5U) && (strcmp(text, "1e+09") == 0));
+  HOST_CHECK((webserver_http_float_format(nextafterf(1e9f, 0.0f), text) == 9U) && (strcmp(text, "999999940") == 0));
+  HOST_CHECK((webserver_http_float_format(-1.5e-7f, text) == 8U) && (strcmp(text, "-1.5e-07") == 0));
+  HOST_CHECK((webserver_http_float_format(1e30f, text) == 5U) && (strcmp(text, "1e+30") == 0));
+  HOST_CHECK((webserver_http_float_format(23.5f, text) == 4U) && (strcmp(text, "23.5") == 0));
+
+  /* Widest texts fit the buffer */
+  HOST_CHECK((webserver_http_float_format(-1.17549435e-38f, text) + 1U) <= HTTP_FLOAT_SIZE);
+  HOST_CHECK((webserver_http_float_format(-0.000123456784f, text) + 1U) <= HTTP_FLOAT_SIZE);
+
+  for (uint32_t i = 0U; i < (sizeof(values) / sizeof(values[0])); i++)
+  {
+    uint32_t bits;
+
+    memcpy(&bits, &values[i], sizeof(bits));
+    ok &= test_float(bits, &shorter) && test_float(bits ^ 0x80000000U, &shorter);
+  }
+
+  for (int32_t e = -149; e <= 127; e++)
+  {
+    uint32_t bits;
+
+    value = ldexpf(1.0f, e);
+    memcpy(&bits, &value, sizeof(bits));
+    ok &= test_float(bits, &shorter);
+  }
+  HOST_CHECK(ok);
+}
+
+/**
+  * @brief  Check the floats of a share of the bit patterns
+  * @param  arg : share
+  * @retval NULL
+  */
+static void *test_share_run(void *arg)
+{
+  test_share_t *share = (test_share_t *)arg;
+  uint64_t     bits = ((share->first + share->stride - 1U) / share->stride) * share->stride;
+  bool         shorter;
+
+  for (; bits < share->end; bits += share->stride)
+  {
+    if (!test_float((uint32_t)bits, &shorter))
+    {
+      share->first_failed = (share->failed == 0U) ? (uint32_t)bits : share->first_failed;
+      share->failed++;
+    }
+    share->shorter += shorter ? 1U : 0U;
+    share->checked++;
+  }
+
+  return NULL;
+}
+
+/**
+  * @brief  Check the text written for a float
+  * @param  bits    : float bit pattern
+  * @param  shorter : written with fewer digits than the shortest printf output (out)
+  * @retval true if the text reads back as the float, is no longer than printf and has the documented notation
+  */
+static bool test_float(uint32_t bits, bool *shorter)
+{
+  char     text[HTTP_FLOAT_SIZE + 8U];
+  char     reference[32];
+  char     digits[16];
+  char     reference_digits[16];
+  uint32_t digits_nbr;
+  uint32_t reference_nbr;
+  uint32_t read_bits;
+  uint32_t length;
+  float    value;
+  float    read;
+  int      precision;
+
+  memcpy(&value, &bits, sizeof(value));
+  *shorter = false;
+
+  memset(text, 0x55, sizeof(text));
+  length = webserver_http_float_format(value, text);
+  if ((length != strlen(text)) || ((length + 1U) > HTTP_FLOAT_SIZE))
+  {
+    return false;
+  }
+
+  /* Special values as printf */
+  if (!isfinite(value) || (value == 0.0f))
+  {
+    (void)snprintf(reference, sizeof(reference), "%g", value);
+    return strcmp(text, reference) == 0;
+  }
+
+  /* Reads back bit exact */
+  read = strtof(text, NULL);
+  memcpy(&read_bits, &read, sizeof(read_bits));
+  if (read_bits != bits)
+  {
+    return false;
+  }
+
+  /* Fewest correctly rounded digits printf needs to read back the float */
+  for (precision = 0; precision < 9; precision++)
+  {
+    (void)snprintf(reference, sizeof(reference), "%.*e", precision, value);
+    if (strtof(reference, NULL) == value)
+    {
+      break;
+    }
+  }
+
+  digits_nbr    = test_digits(text, digits);
+  reference_nbr = test_digits(reference, reference_digits);
+  if ((digits_nbr > reference_nbr) || ((digits_nbr == reference_nbr) && (strcmp(digits, reference_digits) != 0)))
+  {
+    return false;
+  }
+  *shorter = digits_nbr < reference_nbr;
+
+  return test_notation(text);
+}
+
+/**
+  * @brief  Get the significant digits of a number text, without leading nor trailing zeros
+  * @param  text   : number text
+  * @param  digits : significant digits, null terminated (out)
+  * @retval Number of significant digits
+  */
+static uint32_t test_digits(const char *text, char *digits)
+{
+  uint32_t digits_nbr = 0U;
+
+  for (; (*text != '\0') && (*text != 'e'); text++)
+  {
+    if ((*text >= '0') && (*text <= '9') && ((digits_nbr > 0U) || (*text != '0')))
+    {
+      digits[digits_nbr++] = *text;
+    }
+  }
+
+  while ((digits_nbr > 0U) && (digits[digits_nbr - 1U] == '0'))
+  {
+    digits_nbr--;
+  }
+  digits[digits_nbr] = '\0';
+
+  return digits_nbr;
+}
+
+/**
+  * @brief  Check the notation of a finite non zero number text: decimal from 1e-4 up to 1e9 excluded, scientific with
+  *         a signed two digit exponent at least otherwise, as a JSON number
+  * @param  text : number text
+  * @retval true if the notation is the documented one
+  */
+static bool test_notation(const char *text)
+{
+  const char *exponent = strchr(text, 'e');
+  double     magnitude = fabs(strtod(text, NULL));
+
+  if (exponent == NULL)
+  {
+    return (magnitude >= TEST_DECIMAL_MIN) && (magnitude < TEST_DECIMAL_END) && (text[strlen(text) - 1U] != '.');
+  }
+
+  return ((magnitude < TEST_DECIMAL_MIN) || (magnitude >= TEST_DECIMAL_END)) &&
+         ((exponent[1] == '+') || (exponent[1] == '-')) && (strlen(&exponent[2]) >= 2U) &&
+         (strspn(&exponent[2], "0123456789") == strlen(&exponent[2])) && (exponent[-1] != '.');
+}
@@ -0,0 +1,301 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_http_parser.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the incremental HTTP request parser: a request split at every byte, long lines, missing,
+  *          malformed and repeated header fields
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "webserver_http_parser.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Request with every header field the parser keeps, and some it skips */
+#define TEST_REQUEST             "GET /api/sensors?fields=temperature HTTP/1.1\r\n"                                   \
+                                 "Host: board\r\n"                                                                   \
+                                 "User-Agent: host-test\r\n"                                                         \
+                                 "Accept-Encoding: gzip, br\r\n"                                                     \
+                                 "connection:keep-alive \r\n"                                                        \
+                                 "If-None-Match: \"abc\"\r\n"                                                        \
+                                 "If-Range: \"abc\"\r\n"                                                             \
+                                 "Range: bytes=0-99\r\n"                                                             \
+                                 "Last-Event-ID: 42\r\n"                                                             \
+                                 "Upgrade: websocket\r\n"                                                            \
+                                 "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"                                   \
+                                 "Sec-WebSocket-Version: 13\r\n"                                                     \
+                                 "Content-Length: 0\r\n"                                                             \
+                                 "\r\n"
+
+/* Length of the long lines, close to the receive buffer size */
+#define TEST_LONG_SIZE           (4000U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static http_parser_t  test_parser;
+static http_request_t test_request;
+static char test_buffer[2U * TEST_LONG_SIZE];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t test_parse(const char *data);
+static bool test_slice(const http_slice_t *slice, const char *value);
+static bool test_request_fields(void);
+static void test_whole(void);
+static void test_split(void);
+static void test_long_lines(void);
+static void test_missing(void);
+static void test_malformed(void);
+static void test_repeated(void);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the parser tests
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  test_whole();
+  test_split();
+  test_long_lines();
+  test_missing();
+  test_malformed();
+  test_repeated();
+
+  return host_test_end("test_http_parser");
+}
+
+/**
+  * @brief  Parse a request received at once
+  * @param  data : request data, null terminated
+  * @retval Parser result, one of HTTP_PARSER_xxx
+  */
+static uint32_t test_parse(const char *data)
+{
+  webserver_http_parser_init(&test_parser, &test_request);
+
+  return webserver_http_parser_execute(&test_parser, &test_request, data, strlen(data));
+}
+
+/**
+  * @brief  Compare a request slice with a value
+  * @param  slice : request slice
+  * @param  value : expected value, NULL if the slice must be absent
+  * @retval true if the slice holds the value
+  */
+static bool test_slice(const http_slice_t *slice, const char *value)
+{
+  if (value == NULL)
+  {
+    return slice->data == NULL;
+  }
+
+  return (slice->data != NULL) && (slice->size == strlen(value)) && (memcmp(slice->data, value, slice->size) == 0);
+}
+
+/**
+  * @brief  Check the request parsed from TEST_REQUEST
+  * @param  None
+  * @retval true if every kept part of the request is the expected one
+  */
+static bool test_request_fields(void)
+{
+  return (test_request.method == HTTP_METHOD_GET) && test_request.http_1_1 &&
+         (test_request.header_size == (sizeof(TEST_REQUEST) - 1U)) &&
+         test_slice(&test_request.path, "/api/sensors") &&
+         test_slice(&test_request.query, "fields=temperature") &&
+         test_slice(&test_request.accept_encoding, "gzip, br") &&
+         test_slice(&test_request.connection, "keep-alive") &&
+         test_slice(&test_request.if_none_match, "\"abc\"") &&
+         test_slice(&test_request.if_range, "\"abc\"") &&
+         test_slice(&test_request.range, "bytes=0-99") &&
+         test_slice(&test_request.last_event_id, "42") &&
+         test_slice(&test_request.upgrade, "websocket") &&
+         test_slice(&test_request.ws_key, "dGhlIHNhbXBsZSBub25jZQ==") &&
+         test_slice(&test_request.ws_version, "13") &&
+         test_slice(&test_request.content_length, "0") &&
+         test_slice(&test_request.transfer_encoding, NULL);
+}
+
+/**
+  * @brief  A request received at once, alone or followed by another one
+  * @param  None
+  * @retval None
+  */
+static void test_whole(void)
+{
+  HOST_CHECK(test_parse(TEST_REQUEST) == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request_fields());
+
+  /* The parser stops at the end of headers, a pipelined request is left for the next call */
+  HOST_CHECK(test_parse(TEST_REQUEST "GET / HTTP/1.1\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request_fields());
+
+  /* Bare LF line ends */
+  HOST_CHECK(test_parse("GET /index.html HTTP/1.0\nRange: bytes=1-\n\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.path, "/index.html") && !test_request.http_1_1);
+  HOST_CHECK(test_slice(&test_request.range, "bytes=1-") && (test_request.header_size == 42U));
+
+  /* Empty lines before the request line */
+  HOST_CHECK(test_parse("\r\n\r\nHEAD / HTTP/1.1\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK((test_request.method == HTTP_METHOD_HEAD) && test_slice(&test_request.path, "/"));
+}
+
+/**
+  * @brief  A request received in two parts, split at every byte, then one byte at a time, is parsed as when received
+  *         at once
+  * @param  None
+  * @retval None
+  */
+static void test_split(void)
+{
+  static const char request[] = TEST_REQUEST;
+  uint32_t          size      = sizeof(request) - 1U;
+  bool              ok        = true;
+
+  for (uint32_t split = 0U; split < size; split++)
+  {
+    webserver_http_parser_init(&test_parser, &test_request);
+    ok &= (webserver_http_parser_execute(&test_parser, &test_request, request, split) == HTTP_PARSER_MORE);
+    ok &= (webserver_http_parser_execute(&test_parser, &test_request, request, size) == HTTP_PARSER_DONE);
+    ok &= test_request_fields();
+  }
+  HOST_CHECK(ok);
+
+  webserver_http_parser_init(&test_parser, &test_request);
+  for (uint32_t length = 1U; length < size; length++)
+  {
+    ok &= (webserver_http_parser_execute(&test_parser, &test_request, request, length) == HTTP_PARSER_MORE);
+  }
+  HOST_CHECK(ok);
+  HOST_CHECK(webserver_http_parser_execute(&test_parser, &test_request, request, size) == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request_fields());
+
+  /* Each byte is scanned once: nothing left to scan after the last call */
+  HOST_CHECK((test_parser.state == HTTP_PARSER_STATE_DONE) && (test_parser.scan_offset == size));
+}
+
+/**
+  * @brief  Lines up to the receive buffer size are parsed whole, the size limit is the connection one
+  * @param  None
+  * @retval None
+  */
+static void test_long_lines(void)
+{
+  uint32_t length;
+
+  /* Long request target */
+  length = (uint32_t)snprintf(test_buffer, sizeof(test_buffer), "GET /");
+  memset(&test_buffer[length], 'p', TEST_LONG_SIZE);
+  length += TEST_LONG_SIZE;
+  length += (uint32_t)snprintf(&test_buffer[length], sizeof(test_buffer) - length, " HTTP/1.1\r\n\r\n");
+  HOST_CHECK(test_parse(test_buffer) == HTTP_PARSER_DONE);
+  HOST_CHECK((test_request.path.size == (TEST_LONG_SIZE + 1U)) && (test_request.header_size == length));
+
+  /* Long kept header field value */
+  length = (uint32_t)snprintf(test_buffer, sizeof(test_buffer), "GET / HTTP/1.1\r\nIf-None-Match: ");
+  memset(&test_buffer[length], 'e', TEST_LONG_SIZE);
+  length += TEST_LONG_SIZE;
+  (void)snprintf(&test_buffer[length], sizeof(test_buffer) - length, "\r\n\r\n");
+  HOST_CHECK(test_parse(test_buffer) == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request.if_none_match.size == TEST_LONG_SIZE);
+
+  /* Long skipped header field, then a kept one */
+  length = (uint32_t)snprintf(test_buffer, sizeof(test_buffer), "GET / HTTP/1.1\r\nCookie: ");
+  memset(&test_buffer[length], 'c', TEST_LONG_SIZE);
+  length += TEST_LONG_SIZE;
+  (void)snprintf(&test_buffer[length], sizeof(test_buffer) - length, "\r\nRange: bytes=0-1\r\n\r\n");
+  HOST_CHECK(test_parse(test_buffer) == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.range, "bytes=0-1"));
+
+  /* No end of line yet, more data is needed however long the line */
+  test_buffer[length - 1U] = '\0';
+  HOST_CHECK(test_parse(test_buffer) == HTTP_PARSER_MORE);
+}
+
+/**
+  * @brief  Missing parts: absent header fields, missing end of headers, missing request line parts
+  * @param  None
+  * @retval None
+  */
+static void test_missing(void)
+{
+  /* No header field at all */
+  HOST_CHECK(test_parse("GET / HTTP/1.0\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.path, "/") && test_slice(&test_request.query, NULL));
+  HOST_CHECK(test_slice(&test_request.accept_encoding, NULL) && test_slice(&test_request.connection, NULL) &&
+             test_slice(&test_request.range, NULL) && test_slice(&test_request.content_length, NULL));
+
+  /* Empty query and empty header field value */
+  HOST_CHECK(test_parse("GET /?  HTTP/1.1\r\nConnection:\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET /? HTTP/1.1\r\nConnection: \r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.query, "") && test_slice(&test_request.connection, ""));
+
+  /* No end of headers */
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nHost: board\r\n") == HTTP_PARSER_MORE);
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nHost: board") == HTTP_PARSER_MORE);
+  HOST_CHECK(test_parse("") == HTTP_PARSER_MORE);
+
+  /* Request line parts */
+  HOST_CHECK(test_parse("GET\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET /\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse(" / HTTP/1.1\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET  HTTP/1.1\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / \r\n\r\n") == HTTP_PARSER_ERROR);
+}
+
+/**
+  * @brief  Malformed request lines and header field lines
+  * @param  None
+  * @retval None
+  */
+static void test_malformed(void)
+{
+  /* Request target not in origin form, unsupported version */
+  HOST_CHECK(test_parse("GET http://board/ HTTP/1.1\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET * HTTP/1.1\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/2.0\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.x\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.10\r\n\r\n") == HTTP_PARSER_ERROR);
+
+  /* Unknown methods are parsed, the response tells the client */
+  HOST_CHECK(test_parse("BREW / HTTP/1.1\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request.method == HTTP_METHOD_UNKNOWN);
+  HOST_CHECK(test_parse("get / HTTP/1.1\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_request.method == HTTP_METHOD_UNKNOWN);
+
+  /* Header field lines */
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nNo colon\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\n: no name\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nRange : bytes=0-1\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nRange: bytes=0-1\r\n folded\r\n\r\n") == HTTP_PARSER_ERROR);
+}
+
+/**
+  * @brief  Repeated header fields: the last value is kept, except for the length of a body that must not change
+  * @param  None
+  * @retval None
+  */
+static void test_repeated(void)
+{
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nConnection: close\r\nCONNECTION: keep-alive\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.connection, "keep-alive"));
+
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nContent-Length: 5\r\ncontent-length:5\r\n\r\n") == HTTP_PARSER_DONE);
+  HOST_CHECK(test_slice(&test_request.content_length, "5"));
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nContent-Length: 5\r\nContent-Length: 0\r\n\r\n") == HTTP_PARSER_ERROR);
+  HOST_CHECK(test_parse("GET / HTTP/1.1\r\nContent-Length: 0\r\nContent-Length: 05\r\n\r\n") == HTTP_PARSER_ERROR);
+}
@@ -0,0 +1,391 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_mx_wifi_recv.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the Wi-Fi module driver socket recv, over a fake module on its IPC link: data, close, error
+  *          and malformed answers, through the copying recv and recvfrom and the zero copy recv, and the release of
+  *          every IPC answer buffer. The driver is built with a short command timeout, as for the send tests.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "mx_wifi.h"
+#include "mx_wifi_ipc.h"
+#include "mx_wifi_hci.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Memory block allocated through malloc()
+  */
+typedef struct
+{
+  uint8_t *block;                               /*!< Block, NULL if the entry is free            */
+  size_t  size;                                 /*!< Block size                                  */
+} test_alloc_t;
+
+/**
+  * @brief  Module answer to a recv command, and what the driver returns for it
+  */
+typedef struct
+{
+  const char *name;                             /*!< Answer name                                 */
+  int32_t    received;                          /*!< Bytes received the answer tells             */
+  int32_t    data_size;                         /*!< Bytes in the answer                         */
+  int32_t    ret;                               /*!< Driver return, < 0 for a failure            */
+} test_case_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define TEST_SOCKET              (3)
+#define TEST_RECV_SIZE           (512)
+#define TEST_SIZE_ASKED          (-2)           /* Received or data size: the size the command asks for    */
+#define TEST_SIZE_CUT            (-1)           /* Data size: the answer ends within its received field    */
+#define TEST_ALLOC_MAX_NBR       (64U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static MX_WIFIObject_t test_wifi;
+static uint8_t test_data[MX_WIFI_IPC_PAYLOAD_SIZE];
+static uint8_t test_buffer[MX_WIFI_IPC_PAYLOAD_SIZE];
+
+/* Fake module: answer it gives to the next recv command, the answer not read by the driver yet, frame being sent */
+static const test_case_t *test_case;
+static mx_buf_t *test_answer;
+static bool     test_tx_pending;
+static uint32_t test_recv_size;
+
+/* Live malloc() blocks, and free() calls of a pointer malloc() did not return */
+static test_alloc_t test_allocs[TEST_ALLOC_MAX_NBR];
+static uint32_t     test_alloc_nbr;
+static uint32_t     test_bad_frees;
+
+/* Module answers to a recv command of TEST_RECV_SIZE bytes */
+static const test_case_t test_cases[] =
+{
+  {"all data asked",          TEST_RECV_SIZE,       TEST_RECV_SIZE,       TEST_RECV_SIZE},
+  {"part of the data asked",  100,                  100,                  100},
+  {"closed",                  0,                    0,                    0},
+  {"error",                   -1,                   0,                    -1},
+  {"data truncated",          TEST_RECV_SIZE,       TEST_RECV_SIZE / 2,   -1},
+  {"more data than asked",    TEST_RECV_SIZE + 1,   TEST_RECV_SIZE + 1,   -1},
+  {"received size cut",       TEST_RECV_SIZE,       TEST_SIZE_CUT,        -1},
+};
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void test_recv(const test_case_t *answer);
+static void test_recv_large(void);
+static void test_reset(const test_case_t *answer);
+static bool test_released(uint32_t alloc_nbr);
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+void *__wrap_malloc(size_t size);
+void __wrap_free(void *ptr);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the socket recv tests
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  for (uint32_t i = 0U; i < sizeof(test_data); i++)
+  {
+    test_data[i] = (uint8_t)rand();
+  }
+
+  if (!HOST_CHECK(mipc_init(NULL) == MIPC_CODE_SUCCESS))
+  {
+    return host_test_end("test_mx_wifi_recv");
+  }
+
+  for (uint32_t i = 0U; i < (sizeof(test_cases) / sizeof(test_cases[0])); i++)
+  {
+    test_recv(&test_cases[i]);
+  }
+  test_recv_large();
+
+  return host_test_end("test_mx_wifi_recv");
+}
+
+/**
+  * @brief  Receive with the module giving an answer: the copying recv and the zero copy one return what is expected,
+  *         with the data of the answer, recvfrom the same for data or malformed answers, and no buffer is left behind
+  * @param  answer : module answer
+  * @retval None
+  */
+static void test_recv(const test_case_t *answer)
+{
+  uint32_t        alloc_nbr = test_alloc_nbr;
+  mx_buf_t        *netbuf;
+  uint8_t         *data;
+  struct sockaddr fromaddr;
+  uint32_t        fromaddrlen = 0U;
+  int32_t         ret;
+
+  test_reset(answer);
+  ret = MX_WIFI_Socket_recv(&test_wifi, TEST_SOCKET, test_buffer, TEST_RECV_SIZE, 0);
+  printf("test_mx_wifi_recv: %s, recv returned %d\n", answer->name, (int)ret);
+  HOST_CHECK((ret == answer->ret) && ((ret <= 0) || (memcmp(test_buffer, test_data, (size_t)ret) == 0)));
+  HOST_CHECK(test_released(alloc_nbr));
+
+  test_reset(answer);
+  ret = MX_WIFI_Socket_recv_buf(&test_wifi, TEST_SOCKET, TEST_RECV_SIZE, 0, &netbuf, &data);
+  HOST_CHECK((ret == answer->ret) && ((ret > 0) == (data != NULL)));
+  HOST_CHECK((ret <= 0) || ((netbuf != NULL) && (memcmp(data, test_data, (size_t)ret) == 0)));
+  MX_WIFI_Socket_recv_release(&test_wifi, netbuf);
+  HOST_CHECK(test_released(alloc_nbr));
+
+  /* recvfrom tells a close and an error alike */
+  if (answer->ret != 0)
+  {
+    test_reset(answer);
+    ret = MX_WIFI_Socket_recvfrom(&test_wifi, TEST_SOCKET, test_buffer, TEST_RECV_SIZE, 0, &fromaddr, &fromaddrlen);
+    HOST_CHECK((ret > 0) ? ((ret == answer->ret) && (memcmp(test_buffer, test_data, (size_t)ret) == 0) &&
+                            (fromaddrlen == sizeof(fromaddr)) && (fromaddr.sa_family == AF_INET))
+                         : ((ret < 0) || (answer->received < 0)));
+    HOST_CHECK(test_released(alloc_nbr));
+  }
+}
+
+/**
+  * @brief  Receive more than an IPC answer holds: the driver asks for what fits, and returns it all
+  * @param  None
+  * @retval None
+  */
+static void test_recv_large(void)
+{
+  static const test_case_t answer = {"larger than an answer", TEST_SIZE_ASKED, TEST_SIZE_ASKED, 0};
+  uint32_t alloc_nbr = test_alloc_nbr;
+  int32_t  ret;
+
+  test_reset(&answer);
+  ret = MX_WIFI_Socket_recv(&test_wifi, TEST_SOCKET, test_buffer, (int32_t)sizeof(test_buffer), 0);
+  printf("test_mx_wifi_recv: %s, %u bytes asked, recv returned %d\n", answer.name, (unsigned int)test_recv_size,
+         (int)ret);
+  HOST_CHECK((test_recv_size > 0U) &&
+             ((test_recv_size + offsetof(socket_recv_rparams_t, buffer)) <= MX_WIFI_IPC_PAYLOAD_SIZE));
+  HOST_CHECK((ret == (int32_t)test_recv_size) && (memcmp(test_buffer, test_data, test_recv_size) == 0));
+  HOST_CHECK(test_released(alloc_nbr));
+}
+
+/**
+  * @brief  Empty the fake module, and set its answer to the next recv command
+  * @param  answer : module answer
+  * @retval None
+  */
+static void test_reset(const test_case_t *answer)
+{
+  test_case      = answer;
+  test_recv_size = 0U;
+  test_bad_frees = 0U;
+  memset(test_buffer, 0, sizeof(test_buffer));
+}
+
+/**
+  * @brief  Tell whether the driver gave back every block it allocated, and read every module answer
+  * @param  alloc_nbr : live blocks before the recv
+  * @retval true if it did
+  */
+static bool test_released(uint32_t alloc_nbr)
+{
+  return (test_bad_frees == 0U) && (test_alloc_nbr == alloc_nbr) && (test_answer == NULL);
+}
+
+/**
+  * @brief  Driver object of the fake module
+  * @param  None
+  * @retval Driver object
+  */
+MX_WIFIObject_t *wifi_obj_get(void)
+{
+  return &test_wifi;
+}
+
+/**
+  * @brief  Link init, nothing to do
+  * @param  ipc_send : link send function
+  * @retval 0
+  */
+int32_t mx_wifi_hci_init(mipc_send_func_t ipc_send)
+{
+  (void)ipc_send;
+  return 0;
+}
+
+/**
+  * @brief  Link deinit, nothing to do
+  * @param  None
+  * @retval 0
+  */
+int32_t mx_wifi_hci_deinit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Send a frame to the fake module: the link holds it until its next poll, and the module answers a recv or
+  *         recvfrom command at once, with the answer set by test_reset(), its data being the start of test_data
+  * @param  payload : frame, IPC header then command parameters
+  * @param  len     : frame size
+  * @retval 0, -1 if a frame is already being sent or not a recv command
+  */
+int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
+{
+  uint32_t              req_id;
+  uint16_t              api_id;
+  socket_recv_cparams_t cp;
+  size_t                header_size;
+  size_t                params_size;
+  int32_t               received;
+  int32_t               data_size;
+  struct sockaddr       addr = {sizeof(struct sockaddr), AF_INET, {0}};
+  socklen_t             addr_len = sizeof(addr);
+  uint8_t               *params;
+
+  if ((test_tx_pending == true) || (test_answer != NULL) || (len < (MIPC_PKT_PARAMS_OFFSET + sizeof(cp))))
+  {
+    return -1;
+  }
+
+  memcpy(&req_id, &payload[MIPC_PKT_REQ_ID_OFFSET], sizeof(req_id));
+  memcpy(&api_id, &payload[MIPC_PKT_API_ID_OFFSET], sizeof(api_id));
+  memcpy(&cp, &payload[MIPC_PKT_PARAMS_OFFSET], sizeof(cp));
+  if ((api_id != MIPC_API_SOCKET_RECV_CMD) && (api_id != MIPC_API_SOCKET_RECVFROM_CMD))
+  {
+    return -1;
+  }
+  test_tx_pending = true;
+  test_recv_size  = (uint32_t)cp.size;
+
+  header_size = (api_id == MIPC_API_SOCKET_RECV_CMD) ? offsetof(socket_recv_rparams_t, buffer)
+                                                     : offsetof(socket_recvfrom_rparams_t, buffer);
+  received    = (test_case->received == TEST_SIZE_ASKED) ? (int32_t)cp.size : test_case->received;
+  data_size   = (test_case->data_size == TEST_SIZE_ASKED) ? (int32_t)cp.size : test_case->data_size;
+  params_size = (data_size == TEST_SIZE_CUT) ? (sizeof(received) / 2U) : (header_size + (size_t)data_size);
+
+  test_answer = mx_buf_alloc(MIPC_PKT_PARAMS_OFFSET + params_size);
+  if (test_answer == NULL)
+  {
+    return 0;
+  }
+  params = &test_answer->data[MIPC_PKT_PARAMS_OFFSET];
+  memcpy(&test_answer->data[MIPC_PKT_REQ_ID_OFFSET], &req_id, sizeof(req_id));
+  memcpy(&test_answer->data[MIPC_PKT_API_ID_OFFSET], &api_id, sizeof(api_id));
+  if (data_size == TEST_SIZE_CUT)
+  {
+    memcpy(params, &received, params_size);
+    return 0;
+  }
+  memcpy(params, &received, sizeof(received));
+  if (api_id == MIPC_API_SOCKET_RECVFROM_CMD)
+  {
+    memcpy(&params[offsetof(socket_recvfrom_rparams_t, addr)], &addr, sizeof(addr));
+    memcpy(&params[offsetof(socket_recvfrom_rparams_t, length)], &addr_len, sizeof(addr_len));
+  }
+  memcpy(&params[header_size], test_data, (size_t)data_size);
+
+  return 0;
+}
+
+/**
+  * @brief  Tell whether the link still holds a frame to send
+  * @param  None
+  * @retval true if it does
+  */
+bool mx_wifi_hci_tx_pending(void)
+{
+  return test_tx_pending;
+}
+
+/**
+  * @brief  Poll the link: the held frame goes out first, then the module answer is read
+  * @param  timeout : timeout in ms, not waited for
+  * @retval Answer, NULL if none
+  */
+mx_buf_t *mx_wifi_hci_recv(uint32_t timeout)
+{
+  mx_buf_t *answer = test_answer;
+
+  (void)timeout;
+  if (test_tx_pending == true)
+  {
+    test_tx_pending = false;
+    return NULL;
+  }
+  test_answer = NULL;
+
+  return answer;
+}
+
+/**
+  * @brief  Free a received buffer
+  * @param  netbuf : buffer
+  * @retval None
+  */
+void mx_wifi_hci_free(mx_buf_t *netbuf)
+{
+  MX_NET_BUFFER_FREE(netbuf);
+}
+
+/**
+  * @brief  malloc(), linked in with --wrap=malloc: the block is recorded
+  * @param  size : block size
+  * @retval Block, NULL if none
+  */
+void *__wrap_malloc(size_t size)
+{
+  uint8_t *block = __real_malloc(size);
+
+  for (uint32_t i = 0U; (block != NULL) && (i < TEST_ALLOC_MAX_NBR); i++)
+  {
+    if (test_allocs[i].block == NULL)
+    {
+      test_allocs[i].block = block;
+      test_allocs[i].size  = size;
+      test_alloc_nbr++;
+      break;
+    }
+  }
+
+  return block;
+}
+
+/**
+  * @brief  free(), linked in with --wrap=free: a pointer malloc() did not return is counted, and not freed
+  * @param  ptr : block
+  * @retval None
+  */
+void __wrap_free(void *ptr)
+{
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0U; i < TEST_ALLOC_MAX_NBR; i++)
+  {
+    if (test_allocs[i].block == ptr)
+    {
+      test_allocs[i].block = NULL;
+      test_alloc_nbr--;
+      __real_free(ptr);
+      return;
+    }
+  }
+  test_bad_frees++;
+}
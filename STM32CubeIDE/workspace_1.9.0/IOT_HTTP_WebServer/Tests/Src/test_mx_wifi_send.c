@@ -0,0 +1,470 @@
+/**
+  **********************************************************************************************************************
+  * @file    test_mx_wifi_send.c
+  * @author  MCD Application Team
+  * @brief   Host tests of the Wi-Fi module driver socket send, over a fake module on its IPC link: the bytes the
+  *          module gets, the fragments in flight, the command frames they are built in, and the driver allocations.
+  *          The web server send path, a non-blocking send of a header and a body buffer, is checked on its own.
+  *          The driver is built with a send window wider than its send frames, for the allocated ones to be used too,
+  *          and a short command timeout, for a fragment the module does not answer.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "host_test.h"
+#include "mx_wifi.h"
+#include "mx_wifi_ipc.h"
+#include "mx_wifi_hci.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Memory block allocated through malloc()
+  */
+typedef struct
+{
+  uint8_t *block;                               /*!< Block, NULL if the entry is free            */
+  size_t  size;                                 /*!< Block size                                  */
+} test_alloc_t;
+
+/**
+  * @brief  What the module does with the send command it cuts
+  */
+typedef enum
+{
+  TEST_CUT_NONE = 0,                            /*!< All fragments sent in full                  */
+  TEST_CUT_HALF,                                /*!< Half of the fragment sent                   */
+  TEST_CUT_FULL,                                /*!< Half sent, the module send buffer then full */
+  TEST_CUT_ERROR,                               /*!< Nothing sent, the answer is an error        */
+  TEST_CUT_UNANSWERED                           /*!< The fragment is sent, but never answered    */
+} test_cut_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define TEST_SOCKET              (3)
+#define TEST_DATA_SIZE           (12000U)
+#define TEST_HEADER_SIZE         (180U)
+
+/* Bytes the web server sends at once, see webserver_http_conn.c */
+#define TEST_SERVER_SEND_SIZE    (4U * (MX_WIFI_BUFFER_SIZE - 100U))
+#define TEST_ANSWER_MAX_NBR      (64U)
+#define TEST_ALLOC_MAX_NBR       (256U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static MX_WIFIObject_t test_wifi;
+static uint8_t test_data[TEST_DATA_SIZE];
+
+/* Fake module: bytes received, answers not read by the driver yet, frame the link is sending */
+static uint8_t  test_stream[TEST_DATA_SIZE];
+static uint32_t test_stream_size;
+static mx_buf_t *test_answers[TEST_ANSWER_MAX_NBR];
+static uint32_t test_answer_nbr;
+static bool     test_tx_pending;
+
+/* Send command the module cuts, counted from 0, what it does with it, and whether its send buffer is full */
+static uint32_t   test_cut_frag;
+static test_cut_t test_cut;
+static bool       test_full;
+
+/* Send commands the module got: in all, in flight at most, in allocated frames, not on a 4 bytes boundary */
+static uint32_t test_frag_nbr;
+static uint32_t test_in_flight_max;
+static uint32_t test_frags_allocated;
+static uint32_t test_frags_unaligned;
+
+/* Live malloc() blocks, and free() calls of a pointer malloc() did not return */
+static test_alloc_t test_allocs[TEST_ALLOC_MAX_NBR];
+static uint32_t     test_alloc_nbr;
+static uint32_t     test_bad_frees;
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void test_send(const char *name, int32_t flags);
+static void test_send_server(void);
+static void test_send_cut(const char *name, int32_t flags, uint32_t frag, test_cut_t cut, bool partial);
+static void test_reset(uint32_t frag, test_cut_t cut);
+static void test_answer(uint32_t req_id, uint16_t api_id, int32_t status);
+static bool test_allocated(const uint8_t *data);
+void *__real_malloc(size_t size);
+void __real_free(void *ptr);
+void *__wrap_malloc(size_t size);
+void __wrap_free(void *ptr);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Run the socket send tests
+  * @param  None
+  * @retval Exit status
+  */
+int main(void)
+{
+  uint32_t last_frag;
+
+  for (uint32_t i = 0U; i < TEST_DATA_SIZE; i++)
+  {
+    test_data[i] = (uint8_t)rand();
+  }
+
+  if (!HOST_CHECK(mipc_init(NULL) == MIPC_CODE_SUCCESS))
+  {
+    return host_test_end("test_mx_wifi_send");
+  }
+
+  test_send("blocking", 0);
+  last_frag = test_frag_nbr - 1U;
+  test_send("non-blocking", MX_MSG_DONTWAIT);
+  test_send_server();
+
+  /* The cut fragment has later ones in flight, but for the last one: the module taking them breaks the stream */
+  for (int32_t flags = 0; flags <= MX_MSG_DONTWAIT; flags += MX_MSG_DONTWAIT)
+  {
+    printf("test_mx_wifi_send: %s\n", (flags == 0) ? "blocking" : "non-blocking");
+    test_send_cut("first fragment half sent", flags, 0U, TEST_CUT_HALF, false);
+    test_send_cut("first fragment failed", flags, 0U, TEST_CUT_ERROR, false);
+    test_send_cut("second fragment unanswered", flags, 1U, TEST_CUT_UNANSWERED, false);
+    test_send_cut("second fragment half sent, send buffer then full", flags, 1U, TEST_CUT_FULL, true);
+    test_send_cut("last fragment half sent", flags, last_frag, TEST_CUT_HALF, true);
+  }
+
+  return host_test_end("test_mx_wifi_send");
+}
+
+/**
+  * @brief  Send data larger than several IPC commands: the module gets it all in order, with up to the send window in
+  *         flight, blocking or not, and the driver gives back every block it allocated
+  * @param  name  : send mode name
+  * @param  flags : send flags
+  * @retval None
+  */
+static void test_send(const char *name, int32_t flags)
+{
+  uint32_t alloc_nbr;
+  int32_t  ret;
+
+  test_reset(0U, TEST_CUT_NONE);
+  alloc_nbr = test_alloc_nbr;
+
+  ret = MX_WIFI_Socket_send(&test_wifi, TEST_SOCKET, test_data, (int32_t)TEST_DATA_SIZE, flags);
+  printf("test_mx_wifi_send: %s, %u fragments, %u in flight at most, %u in allocated frames\n", name,
+         (unsigned int)test_frag_nbr, (unsigned int)test_in_flight_max, (unsigned int)test_frags_allocated);
+
+  HOST_CHECK(ret == (int32_t)TEST_DATA_SIZE);
+  HOST_CHECK((test_stream_size == TEST_DATA_SIZE) && (memcmp(test_stream, test_data, TEST_DATA_SIZE) == 0));
+  HOST_CHECK(test_frag_nbr > MX_WIFI_TX_WINDOW);
+  HOST_CHECK(test_frags_unaligned == 0U);
+  HOST_CHECK((test_bad_frees == 0U) && (test_alloc_nbr == alloc_nbr));
+  HOST_CHECK(test_in_flight_max == MX_WIFI_TX_WINDOW);
+  HOST_CHECK(test_frags_allocated > 0U);
+}
+
+/**
+  * @brief  Send as the web server does: a response header and a body part in one non-blocking call, of more than one
+  *         IPC command, the fragments going with more than one in flight
+  * @param  None
+  * @retval None
+  */
+static void test_send_server(void)
+{
+  mx_iovec_t iov[2] = {{test_data, (int32_t)TEST_HEADER_SIZE},
+                       {&test_data[TEST_HEADER_SIZE], (int32_t)(TEST_SERVER_SEND_SIZE - TEST_HEADER_SIZE)}};
+  int32_t    ret;
+
+  test_reset(0U, TEST_CUT_NONE);
+
+  ret = MX_WIFI_Socket_sendv(&test_wifi, TEST_SOCKET, iov, 2, MX_MSG_DONTWAIT);
+  printf("test_mx_wifi_send: web server send, %u fragments, %u in flight at most\n", (unsigned int)test_frag_nbr,
+         (unsigned int)test_in_flight_max);
+
+  HOST_CHECK(ret == (int32_t)TEST_SERVER_SEND_SIZE);
+  HOST_CHECK((test_stream_size == TEST_SERVER_SEND_SIZE) &&
+             (memcmp(test_stream, test_data, TEST_SERVER_SEND_SIZE) == 0));
+  HOST_CHECK((test_frag_nbr > 1U) && (test_in_flight_max > 1U));
+}
+
+/**
+  * @brief  Send data larger than several IPC commands, the module cutting one of them: the send fails when the module
+  *         took bytes past the gap, or left a fragment unanswered, and otherwise returns the bytes the module got,
+  *         with no fragment sent after the cut one. The driver gives back every block it allocated.
+  * @param  name    : send case name
+  * @param  flags   : send flags
+  * @param  frag    : fragment the module cuts, counted from 0
+  * @param  cut     : what the module does with it
+  * @param  partial : the send returns the bytes sent, instead of failing
+  * @retval None
+  */
+static void test_send_cut(const char *name, int32_t flags, uint32_t frag, test_cut_t cut, bool partial)
+{
+  uint32_t alloc_nbr;
+  int32_t  ret;
+
+  test_reset(frag, cut);
+  alloc_nbr = test_alloc_nbr;
+
+  ret = MX_WIFI_Socket_send(&test_wifi, TEST_SOCKET, test_data, (int32_t)TEST_DATA_SIZE, flags);
+  printf("test_mx_wifi_send:   %s, returned %d, %u fragments, %u bytes got by the module\n", name, (int)ret,
+         (unsigned int)test_frag_nbr, (unsigned int)test_stream_size);
+
+  if (partial)
+  {
+    HOST_CHECK((ret > 0) && ((uint32_t)ret == test_stream_size) && (test_frag_nbr > frag) &&
+               (memcmp(test_stream, test_data, test_stream_size) == 0));
+  }
+  else
+  {
+    HOST_CHECK(ret < 0);
+  }
+  HOST_CHECK((test_bad_frees == 0U) && (test_alloc_nbr == alloc_nbr) && (test_answer_nbr == 0U));
+}
+
+/**
+  * @brief  Empty the fake module
+  * @param  frag : send command the module cuts, counted from 0
+  * @param  cut  : what the module does with it
+  * @retval None
+  */
+static void test_reset(uint32_t frag, test_cut_t cut)
+{
+  test_cut_frag        = frag;
+  test_cut             = cut;
+  test_full            = false;
+  test_stream_size     = 0U;
+  test_frag_nbr        = 0U;
+  test_in_flight_max   = 0U;
+  test_frags_allocated = 0U;
+  test_frags_unaligned = 0U;
+  test_bad_frees       = 0U;
+}
+
+/**
+  * @brief  Queue a module answer
+  * @param  req_id : request identifier
+  * @param  api_id : command
+  * @param  status : answer parameter, the bytes sent for a send command
+  * @retval None
+  */
+static void test_answer(uint32_t req_id, uint16_t api_id, int32_t status)
+{
+  mx_buf_t *answer = mx_buf_alloc(MIPC_PKT_PARAMS_OFFSET + sizeof(status));
+
+  if ((answer == NULL) || (test_answer_nbr == TEST_ANSWER_MAX_NBR))
+  {
+    MX_WIFI_FREE(answer);
+    return;
+  }
+
+  memcpy(&answer->data[MIPC_PKT_REQ_ID_OFFSET], &req_id, sizeof(req_id));
+  memcpy(&answer->data[MIPC_PKT_API_ID_OFFSET], &api_id, sizeof(api_id));
+  memcpy(&answer->data[MIPC_PKT_PARAMS_OFFSET], &status, sizeof(status));
+  test_answers[test_answer_nbr++] = answer;
+  test_in_flight_max = (test_answer_nbr > test_in_flight_max) ? test_answer_nbr : test_in_flight_max;
+}
+
+/**
+  * @brief  Tell whether data lies in a live malloc() block
+  * @param  data : data
+  * @retval true if it does
+  */
+static bool test_allocated(const uint8_t *data)
+{
+  for (uint32_t i = 0U; i < TEST_ALLOC_MAX_NBR; i++)
+  {
+    if ((test_allocs[i].block != NULL) && (data >= test_allocs[i].block) &&
+        (data < &test_allocs[i].block[test_allocs[i].size]))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+  * @brief  Driver object of the fake module
+  * @param  None
+  * @retval Driver object
+  */
+MX_WIFIObject_t *wifi_obj_get(void)
+{
+  return &test_wifi;
+}
+
+/**
+  * @brief  Link init, nothing to do
+  * @param  ipc_send : link send function
+  * @retval 0
+  */
+int32_t mx_wifi_hci_init(mipc_send_func_t ipc_send)
+{
+  (void)ipc_send;
+  return 0;
+}
+
+/**
+  * @brief  Link deinit, nothing to do
+  * @param  None
+  * @retval 0
+  */
+int32_t mx_wifi_hci_deinit(void)
+{
+  return 0;
+}
+
+/**
+  * @brief  Send a frame to the fake module: the link holds it until its next poll, and the module answers it at once,
+  *         a send command with all its bytes sent, but for the one it cuts and those after it once its buffer is full
+  * @param  payload : frame, IPC header then command parameters
+  * @param  len     : frame size
+  * @retval 0, -1 if a frame is already being sent
+  */
+int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
+{
+  uint32_t              req_id;
+  uint16_t              api_id;
+  socket_send_cparams_t cp;
+  uint8_t               *cparams = &payload[MIPC_PKT_PARAMS_OFFSET];
+  test_cut_t            cut;
+  size_t                size;
+
+  if ((test_tx_pending == true) || (len < MIPC_PKT_PARAMS_OFFSET))
+  {
+    return -1;
+  }
+  test_tx_pending = true;
+
+  memcpy(&req_id, &payload[MIPC_PKT_REQ_ID_OFFSET], sizeof(req_id));
+  memcpy(&api_id, &payload[MIPC_PKT_API_ID_OFFSET], sizeof(api_id));
+  if (api_id != MIPC_API_SOCKET_SEND_CMD)
+  {
+    test_answer(req_id, api_id, 0);
+    return 0;
+  }
+
+  memcpy(&cp, cparams, offsetof(socket_send_cparams_t, buffer));
+  cut = (test_frag_nbr == test_cut_frag) ? test_cut : TEST_CUT_NONE;
+  test_frag_nbr++;
+  test_frags_allocated += test_allocated(payload) ? 1U : 0U;
+  test_frags_unaligned += (((uintptr_t)cparams % 4U) != 0U) ? 1U : 0U;
+  if ((cp.socket != TEST_SOCKET) || ((test_stream_size + cp.size) > TEST_DATA_SIZE) || (cut == TEST_CUT_ERROR) ||
+      test_full)
+  {
+    test_answer(req_id, api_id, -1);
+    return 0;
+  }
+
+  test_full = (cut == TEST_CUT_FULL);
+  size = ((cut == TEST_CUT_HALF) || (cut == TEST_CUT_FULL)) ? (cp.size / 2U) : cp.size;
+  memcpy(&test_stream[test_stream_size], &cparams[offsetof(socket_send_cparams_t, buffer)], size);
+  test_stream_size += size;
+  if (cut != TEST_CUT_UNANSWERED)
+  {
+    test_answer(req_id, api_id, (int32_t)size);
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Tell whether the link still holds a frame to send
+  * @param  None
+  * @retval true if it does
+  */
+bool mx_wifi_hci_tx_pending(void)
+{
+  return test_tx_pending;
+}
+
+/**
+  * @brief  Poll the link: the held frame goes out first, then the module answers are read one at a time
+  * @param  timeout : timeout in ms, not waited for
+  * @retval Answer, NULL if none
+  */
+mx_buf_t *mx_wifi_hci_recv(uint32_t timeout)
+{
+  mx_buf_t *answer;
+
+  (void)timeout;
+  if (test_tx_pending == true)
+  {
+    test_tx_pending = false;
+    return NULL;
+  }
+  if (test_answer_nbr == 0U)
+  {
+    return NULL;
+  }
+
+  answer = test_answers[0];
+  test_answer_nbr--;
+  memmove(&test_answers[0], &test_answers[1], test_answer_nbr * sizeof(test_answers[0]));
+
+  return answer;
+}
+
+/**
+  * @brief  Free a received buffer
+  * @param  netbuf : buffer
+  * @retval None
+  */
+void mx_wifi_hci_free(mx_buf_t *netbuf)
+{
+  MX_NET_BUFFER_FREE(netbuf);
+}
+
+/**
+  * @brief  malloc(), linked in with --wrap=malloc: the block is recorded
+  * @param  size : block size
+  * @retval Block, NULL if none
+  */
+void *__wrap_malloc(size_t size)
+{
+  uint8_t *block = __real_malloc(size);
+
+  for (uint32_t i = 0U; (block != NULL) && (i < TEST_ALLOC_MAX_NBR); i++)
+  {
+    if (test_allocs[i].block == NULL)
+    {
+      test_allocs[i].block = block;
+      test_allocs[i].size  = size;
+      test_alloc_nbr++;
+      break;
+    }
+  }
+
+  return block;
+}
+
+/**
+  * @brief  free(), linked in with --wrap=free: a pointer malloc() did not return is counted, and not freed
+  * @param  ptr : block
+  * @retval None
+  */
+void __wrap_free(void *ptr)
+{
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0U; i < TEST_ALLOC_MAX_NBR; i++)
+  {
+    if (test_allocs[i].block == ptr)
+    {
+      test_allocs[i].block = NULL;
+      test_alloc_nbr--;
+      __real_free(ptr);
+      return;
+    }
+  }
+  test_bad_frees++;
+}
@@ -0,0 +1,45 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_host.c
+  * @author  MCD Application Team
+  * @brief   Host build of the web server: the firmware HTTP sources over the host TCP/IP stack, to be loaded with
+  *          Utilities/http_load.py
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_response.h"
+#include "host_net_socket.h"
+#include <stdlib.h>
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Port served when none is given, the firmware one needs privileges on the host */
+#define WEBSERVER_HOST_PORT      (8080)
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Serve the web page and the sensors on a local port
+  * @param  argc : argument number
+  * @param  argv : arguments, the port to serve on
+  * @retval Exit status, only returns on a socket error
+  */
+int main(int argc, char *argv[])
+{
+  host_net_port = (argc > 1) ? atoi(argv[1]) : WEBSERVER_HOST_PORT;
+
+  /* Print as the board does, line by line */
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  return (webserver_http_start() == WEBSERVER_OK) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
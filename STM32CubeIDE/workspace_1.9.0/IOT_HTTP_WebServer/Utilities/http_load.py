@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+#
+# HTTP load generator and benchmark for the web server.
+#
+# Each connection is a thread sending requests one after the other for the
+# test duration, a request being drawn from the mix at random:
+#
+#   static     web page assets, the files under Fs/ at the paths res_pack.py
+#              serves them at
+#   sensor     /Read_Temperature, /Read_Pressure and /Read_Humidity
+#   api        /api/sensors
+#   metrics    /metrics
+#
+# With keep-alive on, a connection sends all its requests over one HTTP/1.1
+# socket, opened again only when the server closes it. With keep-alive off,
+# each request opens its own socket and asks for it to be closed after the
+# response. Responses are read in full, by Content-Length, chunked or up to
+# the socket close, and a request counts as an error on a connect or socket
+# failure, a timeout or a status other than 2xx or 3xx.
+#
+# A run reports requests and bytes per second and p50/p95/p99 latency, from
+# the request sent to the last response byte, in total and by request class.
+# Several concurrency levels and both keep-alive modes can be run in a row,
+# each run printing its own table, and the results written as JSON to compare
+# firmware builds.
+#
+# The target is any host and port: a board on its WiFi address, or a host
+# build of the web server listening on a local port. Python threads are enough
+# to saturate a board, a host build may need several instances of the tool.
+#
+# usage: python3 Utilities/http_load.py <host> [options]
+#
+#   -p, --port         server port, 80
+#   -c, --concurrency  connections, or a comma separated list of runs, 1
+#   -d, --duration     seconds per run, 10
+#   -m, --mix          class=weight list, static=4,sensor=1,api=1
+#   -k, --keep-alive   on, off or both, on
+#   -z, --gzip         accept gzip coded bodies
+#   -t, --timeout      socket timeout in seconds, 5
+#   -j, --json         file to write the results to
+#
+# example: python3 Utilities/http_load.py 192.168.1.20 -c 1,2,4,8 -k both
+
+import argparse
+import json
+import os
+import random
+import socket
+import sys
+import threading
+import time
+
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FS_DIR = os.path.join(ROOT_DIR, 'Fs')
+
+CLASSES = {
+  'sensor': ['/Read_Temperature', '/Read_Pressure', '/Read_Humidity'],
+  'api': ['/api/sensors'],
+  'metrics': ['/metrics'],
+}
+MIX_DEFAULT = 'static=4,sensor=1,api=1'
+PERCENTILES = [50, 95, 99]
+LINE_MAX = 8192
+
+
+def static_paths():
+  # Same paths as load_assets() in res_pack.py
+  paths = []
+  for directory, dirs, files in os.walk(FS_DIR):
+    dirs.sort()
+    for name in sorted(files):
+      path = '/' + os.path.relpath(os.path.join(directory, name), FS_DIR).replace(os.sep, '/')
+      paths.append(path[:-len('index.html')] if name == 'index.html' else path)
+  return paths
+
+
+def parse_mix(text):
+  mix = []
+  for item in text.split(','):
+    name, _, weight = item.partition('=')
+    paths = static_paths() if name == 'static' else CLASSES.get(name)
+    if not paths:
+      raise SystemExit('mix: unknown or empty class %s' % name)
+    try:
+      weight = float(weight) if weight else 1.0
+    except ValueError:
+      raise SystemExit('mix: weight of %s is not a number' % name)
+    if weight > 0:
+      mix.append((name, paths, weight))
+  if not mix:
+    raise SystemExit('mix: no class with a weight')
+  return mix
+
+
+class ResponseError(Exception):
+  pass
+
+
+class Connection:
+  """One client socket, reading responses through a counting buffer."""
+
+  def __init__(self, host, port, timeout):
+    self.sock = socket.create_connection((host, port), timeout)
+    self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    self.buffer = b''
+    self.received = 0
+
+  def close(self):
+    self.sock.close()
+
+  def fill(self):
+    data = self.sock.recv(65536)
+    if not data:
+      return False
+    self.buffer += data
+    self.received += len(data)
+    return True
+
+  def readline(self):
+    while True:
+      end = self.buffer.find(b'\r\n')
+      if end >= 0:
+        line, self.buffer = self.buffer[:end], self.buffer[end + 2:]
+        return line
+      if len(self.buffer) > LINE_MAX:
+        raise ResponseError('line too long')
+      if not self.fill():
+        raise ResponseError('closed within a line')
+
+  def skip(self, size):
+    while len(self.buffer) < size:
+      size -= len(self.buffer)
+      self.buffer = b''
+      if not self.fill():
+        raise ResponseError('closed within the body')
+    self.buffer = self.buffer[size:]
+
+  def skip_to_close(self):
+    self.buffer = b''
+    while self.fill():
+      self.buffer = b''
+
+  def response(self):
+    """Read a response, return its status and whether the connection stays open."""
+    status = self.readline().split(b' ', 2)
+    if len(status) < 2 or not status[0].startswith(b'HTTP/1.') or not status[1].isdigit():
+      raise ResponseError('bad status line')
+    headers = {}
+    while True:
+      line = self.readline()
+      if not line:
+        break
+      name, _, value = line.partition(b':')
+      headers[name.strip().lower()] = value.strip().lower()
+
+    keep = status[0] == b'HTTP/1.1' and headers.get(b'connection') != b'close'
+    if headers.get(b'transfer-encoding') == b'chunked':
+      while True:
+        size = int(self.readline().split(b';')[0], 16)
+        if size == 0:
+          break
+        self.skip(size + 2)
+      while self.readline():
+        pass
+    elif b'content-length' in headers:
+      self.skip(int(headers[b'content-length']))
+    else:
+      self.skip_to_close()
+      keep = False
+    return int(status[1]), keep
+
+
+class Worker(threading.Thread):
+  def __init__(self, number, options, mix, deadline):
+    super().__init__(daemon=True)
+    self.options = options
+    self.mix = mix
+    self.deadline = deadline
+    self.random = random.Random(number)
+    self.samples = {name: [] for name, _, _ in mix}
+    self.errors = {name: 0 for name, _, _ in mix}
+    self.received = {name: 0 for name, _, _ in mix}
+    self.sent = 0
+    self.connects = 0
+
+  def request(self, path):
+    lines = ['GET %s HTTP/1.1' % path, 'Host: %s' % self.options.host]
+    if not self.options.keep:
+      lines.append('Connection: close')
+    if self.options.gzip:
+      lines.append('Accept-Encoding: gzip')
+    return ('\r\n'.join(lines) + '\r\n\r\n').encode()
+
+  def run(self):
+    weights = [weight for _, _, weight in self.mix]
+    conn = None
+    while time.monotonic() < self.deadline:
+      name, paths, _ = self.random.choices(self.mix, weights)[0]
+      data = self.request(self.random.choice(paths))
+      start = time.monotonic()
+      received = 0
+      try:
+        if conn is None:
+          conn = Connection(self.options.host, self.options.port, self.options.timeout)
+          self.connects += 1
+        received = conn.received
+        conn.sock.sendall(data)
+        self.sent += len(data)
+        status, keep = conn.response()
+        if status >= 400:
+          self.errors[name] += 1
+        else:
+          self.samples[name].append(time.monotonic() - start)
+      except (OSError, ResponseError, ValueError):
+        self.errors[name] += 1
+        keep = False
+        # Do not spin on a server refusing connections
+        time.sleep(0.01)
+      if conn is not None:
+        self.received[name] += conn.received - received
+        # Without keep-alive the request asked for the close, whether the response says so or not
+        if not (keep and self.options.keep):
+          conn.close()
+          conn = None
+    if conn is not None:
+      conn.close()
+
+
+def percentile(samples, rank):
+  # Nearest rank, samples sorted
+  if not samples:
+    return 0.0
+  return samples[max(0, (len(samples) * rank + 99) // 100 - 1)]
+
+
+def summary(samples, errors, received, elapsed):
+  samples = sorted(samples)
+  result = {'requests': len(samples), 'errors': errors, 'rps': len(samples) / elapsed,
+            'bytes_per_s': received / elapsed}
+  for rank in PERCENTILES:
+    result['p%d_ms' % rank] = percentile(samples, rank) * 1000.0
+  return result
+
+
+def run(options, mix, concurrency):
+  deadline = time.monotonic() + options.duration
+  workers = [Worker(number, options, mix, deadline) for number in range(concurrency)]
+  start = time.monotonic()
+  for worker in workers:
+    worker.start()
+  for worker in workers:
+    worker.join()
+  elapsed = time.monotonic() - start
+
+  result = {'concurrency': concurrency, 'keep_alive': options.keep, 'seconds': elapsed}
+  result.update(summary([s for w in workers for c in w.samples.values() for s in c],
+                        sum(sum(w.errors.values()) for w in workers),
+                        sum(sum(w.received.values()) for w in workers), elapsed))
+  result['sent_bytes_per_s'] = sum(w.sent for w in workers) / elapsed
+  result['connects'] = sum(w.connects for w in workers)
+  result['classes'] = {name: summary([s for w in workers for s in w.samples[name]],
+                                     sum(w.errors[name] for w in workers),
+                                     sum(w.received[name] for w in workers), elapsed)
+                       for name, _, _ in mix}
+  return result
+
+
+def print_row(label, result, width):
+  print('%-*s %9d %7d %9.1f %11.0f %9.1f %9.1f %9.1f' %
+        (width, label, result['requests'], result['errors'], result['rps'], result['bytes_per_s'],
+         result['p50_ms'], result['p95_ms'], result['p99_ms']))
+
+
+def main():
+  parser = argparse.ArgumentParser(description='HTTP load generator and benchmark for the web server')
+  parser.add_argument('host')
+  parser.add_argument('-p', '--port', type=int, default=80)
+  parser.add_argument('-c', '--concurrency', default='1')
+  parser.add_argument('-d', '--duration', type=float, default=10.0)
+  parser.add_argument('-m', '--mix', default=MIX_DEFAULT)
+  parser.add_argument('-k', '--keep-alive', choices=['on', 'off', 'both'], default='on')
+  parser.add_argument('-z', '--gzip', action='store_true')
+  parser.add_argument('-t', '--timeout', type=float, default=5.0)
+  parser.add_argument('-j', '--json')
+  options = parser.parse_args()
+
+  mix = parse_mix(options.mix)
+  try:
+    levels = [int(level) for level in options.concurrency.split(',')]
+  except ValueError:
+    parser.error('concurrency is not a list of numbers')
+  if any(level < 1 for level in levels):
+    parser.error('concurrency below 1')
+  modes = {'on': [True], 'off': [False], 'both': [True, False]}[options.keep_alive]
+
+  print('%s:%d, %.0f s per run, mix %s%s' % (options.host, options.port, options.duration,
+                                            ','.join('%s=%g' % (name, weight) for name, _, weight in mix),
+                                            ', gzip' if options.gzip else ''))
+  width = max(len(name) for name, _, _ in mix) + 2
+  results = []
+  for keep in modes:
+    for concurrency in levels:
+      options.keep = keep
+      result = run(options, mix, concurrency)
+      results.append(result)
+      print()
+      print('c=%d keep-alive %s, %d connections' % (concurrency, 'on' if keep else 'off', result['connects']))
+      print('%-*s %9s %7s %9s %11s %9s %9s %9s' %
+            (width, '', 'requests', 'errors', 'req/s', 'bytes/s', 'p50 ms', 'p95 ms', 'p99 ms'))
+      if len(mix) > 1:
+        for name, _, _ in mix:
+          print_row('  ' + name, result['classes'][name], width)
+      print_row('total', result, width)
+
+  if options.json:
+    with open(options.json, 'w') as f:
+      json.dump({'host': options.host, 'port': options.port, 'duration': options.duration,
+                 'mix': options.mix, 'gzip': options.gzip, 'runs': results}, f, indent=2)
+  return 1 if any(result['requests'] == 0 for result in results) else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
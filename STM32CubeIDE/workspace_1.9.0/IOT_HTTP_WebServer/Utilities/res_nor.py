@@ -0,0 +1,198 @@
+#!/usr/bin/env python3
+#
+# File-backed simulator of the OSPI NOR flash, to program and read back the web
+# page resources pack on the host.
+#
+# The image file stands for the MX25LM51245G array, an erased byte reading
+# 0xFF. Programming follows the NOR rules: a 64 KB sector is erased before it
+# is programmed, a program only clears bits and a page program does not cross
+# a 256 bytes page, so that the image is what the board flash holds once
+# res_pack.bin is flashed at the same offset. Reading back goes through the
+# same checks and path lookup as WebServer/App/http/webserver_http_assets.c,
+# on the image mapped in memory as the firmware reads the flash in place.
+#
+# usage: python3 Utilities/res_nor.py program <image> [pack] [offset]
+#        python3 Utilities/res_nor.py check <image> [offset]
+#        python3 Utilities/res_nor.py cat <image> <path> [coding] [offset]
+#
+# The offset defaults to 0, as HTTP_ASSETS_OSPI_OFFSET.
+
+import gzip
+import mmap
+import os
+import struct
+import sys
+
+import res_pack
+
+FLASH_SIZE = 64 * 1024 * 1024      # MX25LM51245G_FLASH_SIZE
+SECTOR_SIZE = 64 * 1024            # MX25LM51245G_SECTOR_64K
+PAGE_SIZE = 256                    # MX25LM51245G_PAGE_SIZE
+ERASED = 0xFF
+
+ASSETS_MAX_NBR = 12                # HTTP_ASSETS_MAX_NBR
+CODINGS = ['identity', 'gzip', 'br']
+
+
+class Nor:
+  def __init__(self, path):
+    if not os.path.exists(path):
+      with open(path, 'wb') as f:
+        for _ in range(FLASH_SIZE // SECTOR_SIZE):
+          f.write(bytes([ERASED]) * SECTOR_SIZE)
+    self.file = open(path, 'r+b')
+    self.map = mmap.mmap(self.file.fileno(), 0)
+    if len(self.map) != FLASH_SIZE:
+      raise SystemExit('%s: not a %d bytes flash image' % (path, FLASH_SIZE))
+
+  def erase_sector(self, address):
+    start = address - address % SECTOR_SIZE
+    self.map[start:start + SECTOR_SIZE] = bytes([ERASED]) * SECTOR_SIZE
+
+  def program_page(self, address, data):
+    if address // PAGE_SIZE != (address + len(data) - 1) // PAGE_SIZE:
+      raise SystemExit('page program across a page boundary at 0x%08X' % address)
+    # A program only clears bits, programming a non erased byte leaves the AND of both
+    current = self.map[address:address + len(data)]
+    self.map[address:address + len(data)] = bytes(a & b for a, b in zip(current, data))
+
+  def write(self, address, data):
+    if address % SECTOR_SIZE != 0:
+      raise SystemExit('offset 0x%X is not a sector boundary' % address)
+    if address + len(data) > FLASH_SIZE:
+      raise SystemExit('%d bytes do not fit at offset 0x%X' % (len(data), address))
+    for sector in range(address, address + len(data), SECTOR_SIZE):
+      self.erase_sector(sector)
+    for page in range(address, address + len(data), PAGE_SIZE):
+      self.program_page(page, data[page - address:page - address + PAGE_SIZE])
+
+  def close(self):
+    self.map.flush()
+    self.map.close()
+    self.file.close()
+
+
+class Assets:
+  """Read a pack in place, as webserver_http_assets.c does: fails on any field out of the area."""
+
+  def __init__(self, area, offset):
+    self.area = area
+    self.base = offset
+    area_size = len(area) - offset
+    if area_size < res_pack.HEADER.size:
+      raise ValueError('no room for a pack header')
+    magic, version, asset_nbr, size, seed, index_size = res_pack.HEADER.unpack_from(area, offset)
+    if magic != res_pack.MAGIC:
+      raise ValueError('no pack, magic 0x%08X%s' % (magic, ' (erased)' if magic == 0xFFFFFFFF else ''))
+    if size < res_pack.HEADER.size or size > area_size:
+      raise ValueError('pack size %d out of the area' % size)
+    if (version != res_pack.VERSION or asset_nbr > ASSETS_MAX_NBR or index_size == 0 or
+        index_size < asset_nbr or index_size & (index_size - 1) or index_size > 0x10000):
+      raise ValueError('header not valid')
+    self.size = size
+    self.seed = seed
+    self.index = struct.unpack_from('<%dH' % index_size, area, offset + res_pack.HEADER.size)
+    table = res_pack.HEADER.size + 2 * index_size
+    table += (-table) % 4
+    entry_size = res_pack.ASSET.size + res_pack.CODINGS_NBR * res_pack.BODY.size
+    if table + asset_nbr * entry_size > size:
+      raise ValueError('asset table out of the pack')
+    if any(slot != res_pack.INDEX_EMPTY and slot >= asset_nbr for slot in self.index):
+      raise ValueError('index slot out of the asset table')
+
+    self.assets = []
+    for number in range(asset_nbr):
+      entry = table + number * entry_size
+      path, path_size, media_type, cache = res_pack.ASSET.unpack_from(area, offset + entry)
+      path = self.string(path)
+      if len(path) != path_size:
+        raise ValueError('asset %d path size' % number)
+      bodies = []
+      for coding in range(res_pack.CODINGS_NBR):
+        body, body_size, etag = res_pack.BODY.unpack_from(area, offset + entry + res_pack.ASSET.size +
+                                                          coding * res_pack.BODY.size)
+        if body == 0 and coding != 0:
+          bodies.append(None)
+          continue
+        if body > size or body_size > size - body:
+          raise ValueError('asset %d body out of the pack' % number)
+        bodies.append((offset + body, body_size, self.string(etag)))
+      self.assets.append((path, self.string(media_type), cache, bodies))
+
+  def string(self, offset):
+    end = self.area.find(b'\0', self.base + offset, self.base + self.size) if offset < self.size else -1
+    if end < 0:
+      raise ValueError('string at %d not terminated in the pack' % offset)
+    return bytes(self.area[self.base + offset:end])
+
+  def find(self, path):
+    slot = self.index[res_pack.path_hash(self.seed, path) & (len(self.index) - 1)]
+    if slot == res_pack.INDEX_EMPTY or self.assets[slot][0] != path:
+      return None
+    return slot
+
+  def body(self, number, coding):
+    start, size, _ = self.assets[number][3][coding]
+    return bytes(self.area[start:start + size])
+
+
+def program(image, pack_path, offset):
+  with open(pack_path, 'rb') as f:
+    pack = f.read()
+  nor = Nor(image)
+  nor.write(offset, pack)
+  nor.close()
+  print('%s: %d bytes programmed at 0x%08X' % (image, len(pack), offset))
+
+
+def check(image, offset):
+  nor = Nor(image)
+  assets = Assets(nor.map, offset)
+  errors = 0
+  for number, (path, media_type, cache, bodies) in enumerate(assets.assets):
+    identity = assets.body(number, 0)
+    if assets.find(path) != number:
+      print('%s: not found by its path' % path.decode())
+      errors += 1
+    if bodies[1] is not None and gzip.decompress(assets.body(number, 1)) != identity:
+      print('%s: gzip body does not decode to the identity body' % path.decode())
+      errors += 1
+    print('%-34s %-26s %s' % (path.decode(), media_type.decode(),
+                              ' '.join('%s %d' % (CODINGS[c], b[1]) for c, b in enumerate(bodies) if b is not None)))
+  print('%s: %d assets, %d bytes at 0x%08X, %d errors' % (image, len(assets.assets), assets.size, offset, errors))
+  nor.close()
+  return 1 if errors else 0
+
+
+def cat(image, path, coding, offset):
+  nor = Nor(image)
+  assets = Assets(nor.map, offset)
+  number = assets.find(path.encode())
+  if number is None or assets.assets[number][3][coding] is None:
+    print('%s: not found' % path, file=sys.stderr)
+    return 1
+  sys.stdout.buffer.write(assets.body(number, coding))
+  nor.close()
+  return 0
+
+
+def main():
+  args = sys.argv[1:]
+  try:
+    if len(args) >= 2 and args[0] == 'program':
+      return program(args[1], args[2] if len(args) > 2 else res_pack.OUTPUT, int(args[3], 0) if len(args) > 3 else 0)
+    if len(args) >= 2 and args[0] == 'check':
+      return check(args[1], int(args[2], 0) if len(args) > 2 else 0)
+    if len(args) >= 3 and args[0] == 'cat':
+      return cat(args[1], args[2], CODINGS.index(args[3]) if len(args) > 3 else 0,
+                 int(args[4], 0) if len(args) > 4 else 0)
+  except ValueError as error:
+    print('%s: %s' % (args[1], error), file=sys.stderr)
+    return 1
+  print('usage: res_nor.py program <image> [pack] [offset] | check <image> [offset] |'
+        ' cat <image> <path> [coding] [offset]', file=sys.stderr)
+  return 2
+
+
+if __name__ == '__main__':
+  sys.exit(main())
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+#
+# Pack the web page resources into a single indexed blob.
+#
+# Every file under Fs/ is a resource, served at its path relative to Fs/, an
+# index.html file being served at its directory path instead ("/"). Text
+# resources are also compressed with gzip, and with brotli when the python
+# brotli module is installed, a coded body being kept only when smaller.
+# Output is reproducible (no timestamp in the gzip header), so the pack only
+# changes when a resource does.
+#
+# The pack is written to WebServer/App/web_addons/res_pack.bin and linked in
+# the firmware by res_pack.s. It holds, all fields little endian:
+#
+#   header     magic "WRES", version, asset number, pack size, index seed,
+#              index size
+#   index      index size slots of 16 bits: asset number of the path hashed to
+#              the slot, 0xFFFF if none. The seed is chosen so that no two
+#              paths share a slot, a lookup is one hash and one compare.
+#   assets     one entry per asset: path, media type, cache policy and, for
+#              each content coding (identity, gzip, br), body offset, size
+#              and strong entity tag derived from the body content hash
+#   strings    null terminated paths, media types and quoted entity tags
+#   bodies     4 bytes aligned
+#
+# Offsets are from the pack start, so that the pack can be read in place from
+# any address. The layout is mirrored by WebServer/App/http/webserver_http_assets.h.
+#
+# usage: python3 Utilities/res_pack.py [output]
+
+import gzip
+import hashlib
+import os
+import struct
+import sys
+
+try:
+  import brotli
+except ImportError:
+  brotli = None
+
+ROOT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+FS_DIR = os.path.join(ROOT_DIR, 'Fs')
+OUTPUT = os.path.join(ROOT_DIR, 'WebServer', 'App', 'web_addons', 'res_pack.bin')
+
+MAGIC = 0x53455257                 # "WRES"
+VERSION = 1
+HEADER = struct.Struct('<IHHIII')  # magic, version, asset number, size, seed, index size
+BODY = struct.Struct('<III')       # offset, size, entity tag
+ASSET = struct.Struct('<IIII')     # path, path size, media type, cache policy
+CODINGS_NBR = 3                    # identity, gzip, br, as HTTP_CODING_xxx
+INDEX_EMPTY = 0xFFFF
+SEED_MAX = 0x10000
+
+# Cache policies, as HTTP_CACHE_xxx
+CACHE_NO_CACHE = 1                 # Cached, revalidated before each use
+CACHE_MAX_AGE = 2                  # Cached, used without revalidation for a day
+
+# File extension: media type, content coded
+MEDIA_TYPES = {
+  '.html':  ('text/html; charset=utf-8', True),
+  '.css':   ('text/css', True),
+  '.js':    ('text/javascript', True),
+  '.json':  ('application/json', True),
+  '.svg':   ('image/svg+xml', True),
+  '.txt':   ('text/plain', True),
+  '.png':   ('image/png', False),
+  '.jpg':   ('image/jpeg', False),
+  '.ico':   ('image/x-icon', False),
+  '.woff2': ('font/woff2', False),
+}
+MEDIA_TYPE_DEFAULT = ('application/octet-stream', False)
+
+# Hex digits of the content hash kept in an entity tag
+ETAG_DIGITS = 16
+
+# Content encoders, by content coding
+ENCODERS = [
+  None,
+  lambda data: gzip.compress(data, compresslevel=9, mtime=0),
+  (lambda data: brotli.compress(data, quality=11)) if brotli is not None else None,
+]
+
+
+def path_hash(seed, path):
+  # Same as http_assets_hash() in webserver_http_assets.c: seeded FNV-1a, then an avalanche step
+  h = 2166136261 ^ seed
+  for byte in path:
+    h = ((h ^ byte) * 16777619) & 0xFFFFFFFF
+  h ^= h >> 15
+  h = (h * 0x2C1B3C6D) & 0xFFFFFFFF
+  h ^= h >> 12
+  return h
+
+
+def build_index(paths):
+  size = 2
+  while size < 2 * len(paths):
+    size *= 2
+  for seed in range(SEED_MAX):
+    index = [INDEX_EMPTY] * size
+    for number, path in enumerate(paths):
+      slot = path_hash(seed, path) & (size - 1)
+      if index[slot] != INDEX_EMPTY:
+        break
+      index[slot] = number
+    else:
+      return seed, index
+  raise SystemExit('no collision free index seed')
+
+
+def etag(data):
+  return '"%s"' % hashlib.sha256(data).hexdigest()[:ETAG_DIGITS]
+
+
+def load_assets():
+  assets = []
+  for directory, dirs, files in os.walk(FS_DIR):
+    dirs.sort()
+    for name in sorted(files):
+      rel = os.path.relpath(os.path.join(directory, name), FS_DIR).replace(os.sep, '/')
+      path = '/' + rel
+      if name == 'index.html':
+        path = path[:-len('index.html')]
+      with open(os.path.join(directory, name), 'rb') as f:
+        data = f.read()
+      media_type, coded = MEDIA_TYPES.get(os.path.splitext(name)[1].lower(), MEDIA_TYPE_DEFAULT)
+      # Build tool output under static/ has content hashed names, anything else may change in place
+      cache = CACHE_MAX_AGE if rel.startswith('static/') else CACHE_NO_CACHE
+      bodies = [data] + [None] * (CODINGS_NBR - 1)
+      if coded:
+        for coding in range(1, CODINGS_NBR):
+          if ENCODERS[coding] is not None:
+            encoded = ENCODERS[coding](data)
+            if len(encoded) < len(data):
+              bodies[coding] = encoded
+      assets.append((path.encode(), media_type.encode(), cache, bodies))
+  return assets
+
+
+def pack(assets):
+  seed, index = build_index([asset[0] for asset in assets])
+
+  table_offset = HEADER.size + 2 * len(index)
+  table_offset += (-table_offset) % 4
+  strings_offset = table_offset + len(assets) * (ASSET.size + CODINGS_NBR * BODY.size)
+
+  # Strings, then bodies
+  strings = bytearray()
+  string_offsets = {}
+
+  def string(text):
+    if text not in string_offsets:
+      string_offsets[text] = strings_offset + len(strings)
+      strings.extend(text + b'\0')
+    return string_offsets[text]
+
+  entries = []
+  for path, media_type, cache, bodies in assets:
+    entries.append((string(path), len(path), string(media_type), cache,
+                    [string(etag(body).encode()) if body is not None else 0 for body in bodies]))
+
+  data = bytearray()
+  data_offset = strings_offset + len(strings)
+  data_offset += (-data_offset) % 4
+  table = bytearray()
+  for (path, path_size, media_type, cache, etags), (_, _, _, bodies) in zip(entries, assets):
+    table += ASSET.pack(path, path_size, media_type, cache)
+    for body, tag in zip(bodies, etags):
+      if body is None:
+        table += BODY.pack(0, 0, 0)
+        continue
+      data += b'\0' * ((-len(data)) % 4)
+      table += BODY.pack(data_offset + len(data), len(body), tag)
+      data += body
+
+  blob = bytearray()
+  blob += HEADER.pack(MAGIC, VERSION, len(assets), 0, seed, len(index))
+  blob += struct.pack('<%dH' % len(index), *index)
+  blob += b'\0' * (table_offset - len(blob))
+  blob += table
+  blob += strings
+  blob += b'\0' * (data_offset - len(blob))
+  blob += data
+  blob[8:12] = struct.pack('<I', len(blob))
+  return bytes(blob)
+
+
+def main():
+  output = sys.argv[1] if len(sys.argv) > 1 else OUTPUT
+
+  if brotli is None:
+    print('brotli module not found, brotli variants not packed')
+
+  assets = load_assets()
+  blob = pack(assets)
+
+  for path, media_type, cache, bodies in assets:
+    sizes = ' -> '.join('%d' % len(body) for body in bodies if body is not None)
+    print('%-34s %s bytes' % (path.decode(), sizes))
+
+  with open(output, 'wb') as f:
+    f.write(blob)
+  print('%s: %d assets, %d bytes' % (os.path.relpath(output, ROOT_DIR), len(assets), len(blob)))
+
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
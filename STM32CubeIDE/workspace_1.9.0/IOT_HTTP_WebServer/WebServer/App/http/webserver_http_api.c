@@ -0,0 +1,504 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_api.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server http JSON API.
+  *          /api/sensors returns the last values of every board sensor in one JSON document, taken from the
+  *          latest value store, each one with the tick it was acquired at and its age in ms:
+  *            {"temperature":{"value":23.5,"timestamp":1234,"age":12},
+  *             "accelerometer":{"x":-12,"y":3,"z":1015,"timestamp":1250,"age":1}, ...}
+  *          A sensor that cannot be read, one that did not start on this board for instance, is null.
+  *          A "fields" query parameter selects some of them: /api/sensors?fields=temperature,humidity
+  *          /api/events pushes the same document as a server-sent events stream, one event every "interval" ms:
+  *            id: 42
+  *            data: {"temperature":{"value":23.5,"timestamp":1234,"age":12}}
+  *          Event ids number the samples, a client resuming with Last-Event-ID goes on from the next one.
+  *          /api/motion is a WebSocket stream of accelerometer, gyroscope and magnetometer samples, taken every
+  *          "interval" ms and sent in batches, one binary message per batch. A sample is 10 little endian
+  *          32 bits integers: tick in ms, then x, y and z of acceleration (mg), angular rate (mdps) and
+  *          magnetic field (mgauss).
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_api.h"
+#include "webserver_sensors.h"
+#include "webserver_http_writer.h"
+#include "webserver_http_float.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Sensor field of the JSON document
+  */
+typedef struct
+{
+  const char *name;                            /*!< Field name                                        */
+  uint32_t   name_size;                        /*!< Field name length                                 */
+  uint32_t   sensor;                           /*!< Sensor, one of WEBSERVER_SENSOR_xxx               */
+  bool       axes;                             /*!< 3 axes sensor, single value sensor otherwise      */
+} http_api_sensor_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Query parameters */
+#define HTTP_API_FIELDS_PARAM        "fields"      /* Comma separated field names                     */
+#define HTTP_API_INTERVAL_PARAM      "interval"    /* Time in ms between two events                   */
+
+/* Time in ms between two events of a stream */
+#define HTTP_API_EVENT_PERIOD        (1000U)       /* Without interval parameter                      */
+#define HTTP_API_EVENT_PERIOD_MIN    (100U)
+#define HTTP_API_EVENT_PERIOD_MAX    (60000U)
+
+/* Time in ms between two motion samples */
+#define HTTP_API_MOTION_PERIOD       (5U)          /* Without interval parameter                      */
+#define HTTP_API_MOTION_PERIOD_MIN   (2U)
+#define HTTP_API_MOTION_PERIOD_MAX   (1000U)
+
+/* Motion samples batches */
+#define HTTP_API_MOTION_SAMPLE_SIZE  (10U * sizeof(int32_t))
+#define HTTP_API_MOTION_BATCH        (12U)         /* Samples in a full batch                         */
+#define HTTP_API_MOTION_LATENCY      (100U)        /* Time in ms before a batch is sent, even if short */
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Expand a constant field name into the name and name_size fields */
+#define HTTP_API_NAME(name)          (name), (sizeof(name) - 1U)
+
+/* Largest JSON object of a sensor value */
+#define HTTP_API_VALUE_SIZE          (96U)
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Sensor fields, in document order */
+static const http_api_sensor_t http_api_sensors[] =
+{
+  {HTTP_API_NAME("temperature"),   WEBSERVER_SENSOR_TEMPERATURE, false},
+  {HTTP_API_NAME("pressure"),      WEBSERVER_SENSOR_PRESSURE,    false},
+  {HTTP_API_NAME("humidity"),      WEBSERVER_SENSOR_HUMIDITY,    false},
+  {HTTP_API_NAME("accelerometer"), WEBSERVER_SENSOR_ACCELERO,    true},
+  {HTTP_API_NAME("gyroscope"),     WEBSERVER_SENSOR_GYRO,        true},
+  {HTTP_API_NAME("magnetometer"),  WEBSERVER_SENSOR_MAGNETO,     true},
+  {HTTP_API_NAME("light"),         WEBSERVER_SENSOR_LIGHT,       false},
+  {HTTP_API_NAME("distance"),      WEBSERVER_SENSOR_RANGING,     false},
+};
+
+#define HTTP_API_SENSORS_NBR         (sizeof(http_api_sensors) / sizeof(http_api_sensors[0]))
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static bool http_api_query_param(const http_slice_t *query, const char *name, http_slice_t *value);
+static uint32_t http_api_selected_sensors(const http_slice_t *query);
+static uint32_t http_api_decimal(const http_slice_t *value, uint32_t default_value);
+static uint32_t http_api_period(const http_slice_t *query, uint32_t period, uint32_t period_min,
+                                uint32_t period_max);
+static WebServer_StatusTypeDef http_api_document(uint32_t selected, char *buffer, uint32_t buffer_size,
+                                                 uint32_t *size);
+static bool http_api_document_fill(http_writer_t *writer);
+static int32_t http_api_sensor_value(const http_api_sensor_t *sensor, char *buffer, uint32_t buffer_size);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Start writing the JSON document of the selected sensors values, chunked if the client supports it
+  * @param  request : parsed request, its query string may select the fields
+  * @param  writer  : response body writer
+  * @retval None
+  */
+void webserver_http_api_sensors_start(const http_request_t *request, http_writer_t *writer)
+{
+  webserver_http_writer_start(writer, http_api_document_fill, http_api_selected_sensors(&request->query),
+                              request->http_1_1);
+}
+
+/**
+  * @brief  Set up the server-sent events stream asked for by a request
+  * @param  request : parsed request, its query string may select the fields and the interval
+  * @param  stream  : stream to be set up, its first event is due at once
+  * @retval None
+  */
+void webserver_http_api_stream_open(const http_request_t *request, http_stream_t *stream)
+{
+  uint32_t period = http_api_period(&request->query, HTTP_API_EVENT_PERIOD, HTTP_API_EVENT_PERIOD_MIN,
+                                    HTTP_API_EVENT_PERIOD_MAX);
+
+  stream->type       = HTTP_STREAM_EVENTS;
+  stream->period     = period;
+  stream->fields     = http_api_selected_sensors(&request->query);
+  stream->event_id   = http_api_decimal(&request->last_event_id, 0U);
+  stream->event_tick = HAL_GetTick() - period;
+}
+
+/**
+  * @brief  Write the next event of a server-sent events stream, if it is due
+  * @param  stream      : stream
+  * @param  buffer      : event buffer
+  * @param  buffer_size : event buffer size
+  * @param  size        : event length (out), 0 if no event is due yet
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_api_stream_event(http_stream_t *stream, char *buffer, uint32_t buffer_size,
+                                                        uint32_t *size)
+{
+  uint32_t document_size;
+  int32_t  ret;
+
+  *size = 0U;
+  if ((HAL_GetTick() - stream->event_tick) < stream->period)
+  {
+    return WEBSERVER_OK;
+  }
+
+  /* Keep the pace even if an event is sent late */
+  stream->event_tick += stream->period;
+  if ((HAL_GetTick() - stream->event_tick) >= stream->period)
+  {
+    stream->event_tick = HAL_GetTick();
+  }
+  stream->event_id++;
+
+  ret = snprintf(buffer, buffer_size, "id: %lu\ndata: ", (unsigned long)stream->event_id);
+  if ((ret < 0) || ((uint32_t)ret >= buffer_size))
+  {
+    return HTTP_ERROR;
+  }
+
+  /* The document holds no line feed, it is a single data line. Keep room for the end of event. */
+  if (http_api_document(stream->fields, &buffer[ret], buffer_size - (uint32_t)ret - 2U,
+                        &document_size) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  *size = (uint32_t)ret + document_size;
+  buffer[(*size)++] = '\n';
+  buffer[(*size)++] = '\n';
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Set up the motion samples stream asked for by a request
+  * @param  request : parsed request, its query string may select the interval
+  * @param  stream  : stream to be set up, its first sample is due at once
+  * @retval None
+  */
+void webserver_http_api_motion_open(const http_request_t *request, http_stream_t *stream)
+{
+  uint32_t period = http_api_period(&request->query, HTTP_API_MOTION_PERIOD, HTTP_API_MOTION_PERIOD_MIN,
+                                    HTTP_API_MOTION_PERIOD_MAX);
+
+  stream->type         = HTTP_STREAM_WEBSOCKET;
+  stream->period       = period;
+  stream->event_tick   = HAL_GetTick() - period;
+  stream->sample_count = 0U;
+}
+
+/**
+  * @brief  Take a motion sample if it is due, and hand over the batch once complete
+  * @param  stream      : stream
+  * @param  buffer      : batch buffer, kept from one call to the next
+  * @param  buffer_size : batch buffer size
+  * @param  size        : batch length (out), 0 while the batch is not complete
+  * @retval None
+  */
+void webserver_http_api_motion_batch(http_stream_t *stream, uint8_t *buffer, uint32_t buffer_size, uint32_t *size)
+{
+  webserver_sample_t axes[3];
+  int32_t  sample[HTTP_API_MOTION_SAMPLE_SIZE / sizeof(int32_t)];
+  uint32_t batch = buffer_size / HTTP_API_MOTION_SAMPLE_SIZE;
+  uint32_t tick  = HAL_GetTick();
+
+  *size = 0U;
+  batch = (batch > HTTP_API_MOTION_BATCH) ? HTTP_API_MOTION_BATCH : batch;
+
+  if ((tick - stream->event_tick) >= stream->period)
+  {
+    /* Keep the pace, unless samples are late by more than a period */
+    stream->event_tick = ((tick - stream->event_tick) < (2U * stream->period)) ?
+                         (stream->event_tick + stream->period) : tick;
+
+    /* Last values of the acquisition stage, a sensor that cannot be read gives zeros */
+    (void)webserver_sensor_get(WEBSERVER_SENSOR_ACCELERO, &axes[0]);
+    (void)webserver_sensor_get(WEBSERVER_SENSOR_GYRO, &axes[1]);
+    (void)webserver_sensor_get(WEBSERVER_SENSOR_MAGNETO, &axes[2]);
+
+    sample[0] = (int32_t)axes[0].tick;
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+      sample[1U + (3U * i)] = axes[i].axes.x;
+      sample[2U + (3U * i)] = axes[i].axes.y;
+      sample[3U + (3U * i)] = axes[i].axes.z;
+    }
+
+    if (stream->sample_count == 0U)
+    {
+      stream->batch_tick = tick;
+    }
+    memcpy(&buffer[stream->sample_count * HTTP_API_MOTION_SAMPLE_SIZE], sample, HTTP_API_MOTION_SAMPLE_SIZE);
+    stream->sample_count++;
+  }
+
+  /* Full batch, or samples waiting for too long */
+  if ((stream->sample_count >= batch) ||
+      ((stream->sample_count > 0U) && ((tick - stream->batch_tick) >= HTTP_API_MOTION_LATENCY)))
+  {
+    *size                = stream->sample_count * HTTP_API_MOTION_SAMPLE_SIZE;
+    stream->sample_count = 0U;
+  }
+}
+
+/**
+  * @brief  Find a parameter of a query string
+  * @param  query : request query string
+  * @param  name  : parameter name
+  * @param  value : parameter value (out)
+  * @retval true if the parameter is found, false otherwise
+  */
+static bool http_api_query_param(const http_slice_t *query, const char *name, http_slice_t *value)
+{
+  const char *param     = query->data;
+  const char *query_end = &query->data[query->size];
+  const char *param_end;
+  uint32_t   name_size  = strlen(name);
+
+  /* Parameters are '&' separated name=value pairs */
+  while ((param != NULL) && (param < query_end))
+  {
+    param_end = memchr(param, '&', (uint32_t)(query_end - param));
+    param_end = (param_end != NULL) ? param_end : query_end;
+
+    if (((uint32_t)(param_end - param) > name_size) && (strncmp(param, name, name_size) == 0) &&
+        (param[name_size] == '='))
+    {
+      value->data = &param[name_size + 1U];
+      value->size = (uint32_t)(param_end - value->data);
+      return true;
+    }
+
+    param = param_end + 1;
+  }
+
+  return false;
+}
+
+/**
+  * @brief  Get the sensors selected by the "fields" query parameter
+  * @param  query : request query string
+  * @retval Selected sensors, bit i set for http_api_sensors[i], all of them without a "fields" parameter
+  */
+static uint32_t http_api_selected_sensors(const http_slice_t *query)
+{
+  http_slice_t value;
+  const char   *name;
+  const char   *value_end;
+  uint32_t     name_size;
+  uint32_t     selected = 0U;
+
+  if (!http_api_query_param(query, HTTP_API_FIELDS_PARAM, &value))
+  {
+    return (1UL << HTTP_API_SENSORS_NBR) - 1U;
+  }
+
+  /* Comma separated field names, unknown ones are ignored */
+  name      = value.data;
+  value_end = &value.data[value.size];
+  while (name < value_end)
+  {
+    name_size = 0U;
+    while ((&name[name_size] < value_end) && (name[name_size] != ','))
+    {
+      name_size++;
+    }
+
+    for (uint32_t i = 0U; i < HTTP_API_SENSORS_NBR; i++)
+    {
+      if ((http_api_sensors[i].name_size == name_size) && (memcmp(http_api_sensors[i].name, name, name_size) == 0))
+      {
+        selected |= 1UL << i;
+      }
+    }
+
+    name += name_size + 1U;
+  }
+
+  return selected;
+}
+
+/**
+  * @brief  Convert a decimal number
+  * @param  value         : decimal digits
+  * @param  default_value : value returned if the digits are missing, invalid or out of range
+  * @retval Converted number
+  */
+static uint32_t http_api_decimal(const http_slice_t *value, uint32_t default_value)
+{
+  uint32_t number = 0U;
+
+  if ((value->data == NULL) || (value->size == 0U) || (value->size > 9U))
+  {
+    return default_value;
+  }
+
+  for (uint32_t i = 0U; i < value->size; i++)
+  {
+    if ((value->data[i] < '0') || (value->data[i] > '9'))
+    {
+      return default_value;
+    }
+    number = (number * 10U) + (uint32_t)(value->data[i] - '0');
+  }
+
+  return number;
+}
+
+/**
+  * @brief  Get the sampling period set by the "interval" query parameter
+  * @param  query      : request query string
+  * @param  period     : period without interval parameter
+  * @param  period_min : shortest period
+  * @param  period_max : longest period
+  * @retval Period in ms
+  */
+static uint32_t http_api_period(const http_slice_t *query, uint32_t period, uint32_t period_min,
+                                uint32_t period_max)
+{
+  http_slice_t value;
+
+  if (http_api_query_param(query, HTTP_API_INTERVAL_PARAM, &value))
+  {
+    period = http_api_decimal(&value, period);
+    period = (period < period_min) ? period_min : period;
+    period = (period > period_max) ? period_max : period;
+  }
+
+  return period;
+}
+
+/**
+  * @brief  Read the selected sensors and write their values as a JSON document
+  * @param  selected    : selected sensors, bit i set for http_api_sensors[i]
+  * @param  buffer      : document buffer
+  * @param  buffer_size : document buffer size
+  * @param  size        : document length (out)
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_api_document(uint32_t selected, char *buffer, uint32_t buffer_size,
+                                                 uint32_t *size)
+{
+  uint32_t length = 0U;
+  int32_t  ret;
+
+  for (uint32_t i = 0U; i < HTTP_API_SENSORS_NBR; i++)
+  {
+    if ((selected & (1UL << i)) == 0U)
+    {
+      continue;
+    }
+
+    /* Separator, then "name": */
+    ret = snprintf(&buffer[length], buffer_size - length, "%c\"%s\":", (length == 0U) ? '{' : ',',
+                   http_api_sensors[i].name);
+    if ((ret < 0) || ((uint32_t)ret >= (buffer_size - length)))
+    {
+      return HTTP_ERROR;
+    }
+    length += (uint32_t)ret;
+
+    ret = http_api_sensor_value(&http_api_sensors[i], &buffer[length], buffer_size - length);
+    if (ret < 0)
+    {
+      return HTTP_ERROR;
+    }
+    length += (uint32_t)ret;
+  }
+
+  /* Close the document, an empty selection gives an empty object */
+  ret = snprintf(&buffer[length], buffer_size - length, (length == 0U) ? "{}" : "}");
+  if ((ret < 0) || ((uint32_t)ret >= (buffer_size - length)))
+  {
+    return HTTP_ERROR;
+  }
+  *size = length + (uint32_t)ret;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Read the selected sensors and write their values as a JSON document, one sensor at a time so that
+  *         the document size is not bounded by the writer buffer
+  * @param  writer : response body writer, its context is the selected sensors, its cursor the next sensor
+  * @retval true once the whole document is written, false otherwise
+  */
+static bool http_api_document_fill(http_writer_t *writer)
+{
+  uint32_t selected = writer->context;
+  char     value[HTTP_API_VALUE_SIZE];
+  bool     first;
+
+  for (; writer->cursor < HTTP_API_SENSORS_NBR; writer->cursor++)
+  {
+    if ((selected & (1UL << writer->cursor)) == 0U)
+    {
+      continue;
+    }
+
+    if (http_api_sensor_value(&http_api_sensors[writer->cursor], value, sizeof(value)) < 0)
+    {
+      strcpy(value, "null");
+    }
+
+    /* A sensor that does not fit is written again in the next piece */
+    first = (selected & ((1UL << writer->cursor) - 1U)) == 0U;
+    if (!webserver_http_writer_printf(writer, "%c\"%s\":%s", first ? '{' : ',', http_api_sensors[writer->cursor].name,
+                                      value))
+    {
+      return false;
+    }
+  }
+
+  /* Close the document, an empty selection gives an empty object */
+  return webserver_http_writer_printf(writer, (selected == 0U) ? "{}" : "}");
+}
+
+/**
+  * @brief  Write the last value of a sensor as a JSON object, or null if it cannot be read. The timestamp is
+  *         the tick the value was acquired at, the age the time in ms since then.
+  * @param  sensor      : sensor field
+  * @param  buffer      : object buffer
+  * @param  buffer_size : object buffer size
+  * @retval Object length, negative if the buffer is too small
+  */
+static int32_t http_api_sensor_value(const http_api_sensor_t *sensor, char *buffer, uint32_t buffer_size)
+{
+  webserver_sample_t sample;
+  char     text[HTTP_FLOAT_SIZE];
+  int32_t  ret;
+
+  if ((webserver_sensor_get(sensor->sensor, &sample) != 0) || (!sensor->axes && !isfinite(sample.value)))
+  {
+    ret = snprintf(buffer, buffer_size, "null");
+  }
+  else if (!sensor->axes)
+  {
+    (void)webserver_http_float_format(sample.value, text);
+    ret = snprintf(buffer, buffer_size, "{\"value\":%s,\"timestamp\":%lu,\"age\":%lu}", text,
+                   (unsigned long)sample.tick, (unsigned long)(HAL_GetTick() - sample.tick));
+  }
+  else
+  {
+    ret = snprintf(buffer, buffer_size, "{\"x\":%ld,\"y\":%ld,\"z\":%ld,\"timestamp\":%lu,\"age\":%lu}",
+                   (long)sample.axes.x, (long)sample.axes.y, (long)sample.axes.z, (unsigned long)sample.tick,
+                   (unsigned long)(HAL_GetTick() - sample.tick));
+  }
+
+  return ((ret < 0) || ((uint32_t)ret >= buffer_size)) ? -1 : ret;
+}
@@ -0,0 +1,39 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_api.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_api.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_API_H
+#define WEBSERVER_HTTP_API_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "webserver_status.h"
+#include "webserver_http_routes.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+void webserver_http_api_sensors_start(const http_request_t *request, http_writer_t *writer);
+void webserver_http_api_stream_open(const http_request_t *request, http_stream_t *stream);
+WebServer_StatusTypeDef webserver_http_api_stream_event(http_stream_t *stream, char *buffer, uint32_t buffer_size,
+                                                        uint32_t *size);
+void webserver_http_api_motion_open(const http_request_t *request, http_stream_t *stream);
+void webserver_http_api_motion_batch(http_stream_t *stream, uint8_t *buffer, uint32_t buffer_size, uint32_t *size);
+
+#endif /* WEBSERVER_HTTP_API_H */
@@ -0,0 +1,279 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_assets.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web page asset pack services
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_assets.h"
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Asset pack header, as written by Utilities/res_pack.py. Offsets are from the pack start.
+  */
+typedef struct
+{
+  uint32_t magic;                              /*!< HTTP_ASSETS_MAGIC                                 */
+  uint16_t version;                            /*!< HTTP_ASSETS_VERSION                               */
+  uint16_t asset_nbr;                          /*!< Number of assets                                  */
+  uint32_t size;                               /*!< Pack size                                         */
+  uint32_t seed;                               /*!< Path hash seed giving a collision free index      */
+  uint32_t index_size;                         /*!< Index slots, power of two                         */
+} http_assets_header_t;
+
+/**
+  * @brief  Asset pack body entry
+  */
+typedef struct
+{
+  uint32_t offset;                             /*!< Body offset, 0 if not available                   */
+  uint32_t size;                               /*!< Body size                                         */
+  uint32_t etag;                               /*!< Quoted entity tag offset                          */
+} http_assets_body_t;
+
+/**
+  * @brief  Asset pack asset entry
+  */
+typedef struct
+{
+  uint32_t           path;                     /*!< Path offset                                       */
+  uint32_t           path_size;                /*!< Path length                                       */
+  uint32_t           content_type;             /*!< Media type offset                                 */
+  uint32_t           cache_policy;             /*!< One of HTTP_CACHE_xxx                             */
+  http_assets_body_t codings[HTTP_CODING_NBR]; /*!< Bodies, by HTTP_CODING_xxx                        */
+} http_assets_entry_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define HTTP_ASSETS_MAGIC            (0x53455257U) /* "WRES" */
+#define HTTP_ASSETS_VERSION          (1U)
+#define HTTP_ASSETS_INDEX_EMPTY      (0xFFFFU)
+
+#define HTTP_ASSETS_FNV_OFFSET       (2166136261U)
+#define HTTP_ASSETS_FNV_PRIME        (16777619U)
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Asset pack in use, NULL until a valid one is set */
+static const http_assets_header_t *http_assets_pack;
+
+/* Slots of the pack index, each holding an asset number */
+static const uint16_t *http_assets_index;
+
+/* Assets of the pack, resolved once */
+static http_asset_t http_assets[HTTP_ASSETS_MAX_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t http_assets_hash(uint32_t seed, const char *path, uint32_t path_size);
+static const char *http_assets_string(const uint8_t *pack, uint32_t pack_size, uint32_t offset);
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Hash an asset path (FNV-1a with a seed and a final avalanche step), as res_pack.py does
+  * @param  seed      : hash seed
+  * @param  path      : pointer to request path
+  * @param  path_size : request path length
+  * @retval Hash value
+  */
+static uint32_t http_assets_hash(uint32_t seed, const char *path, uint32_t path_size)
+{
+  uint32_t hash = HTTP_ASSETS_FNV_OFFSET ^ seed;
+
+  for (uint32_t i = 0U; i < path_size; i++)
+  {
+    hash = (hash ^ (uint8_t)path[i]) * HTTP_ASSETS_FNV_PRIME;
+  }
+
+  hash ^= hash >> 15;
+  hash *= 0x2C1B3C6DU;
+  hash ^= hash >> 12;
+
+  return hash;
+}
+
+/**
+  * @brief  Get a pack string, checking it is null terminated within the pack
+  * @param  pack      : pointer to asset pack
+  * @param  pack_size : asset pack size
+  * @param  offset    : string offset
+  * @retval Pointer to the string, NULL if not valid
+  */
+static const char *http_assets_string(const uint8_t *pack, uint32_t pack_size, uint32_t offset)
+{
+  if ((offset >= pack_size) || (memchr(&pack[offset], '\0', pack_size - offset) == NULL))
+  {
+    return NULL;
+  }
+
+  return (const char *)&pack[offset];
+}
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Check an asset pack and resolve its assets. The pack is read in place, it must stay mapped for
+  *         as long as assets are served.
+  * @param  pack      : pointer to asset pack, 4 bytes aligned
+  * @param  area_size : size of the memory area holding the pack, nothing is read beyond it
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_assets_init(const uint8_t *pack, uint32_t area_size)
+{
+  const http_assets_header_t *header = (const http_assets_header_t *)pack;
+  const http_assets_entry_t  *entries;
+  const uint16_t             *index;
+  const http_assets_body_t   *body;
+  http_asset_t               *asset;
+  uint32_t                   table_offset;
+
+  http_assets_pack = NULL;
+
+  /* An erased or foreign area fails here, before any offset of it is trusted */
+  if ((area_size < sizeof(http_assets_header_t)) || (header->magic != HTTP_ASSETS_MAGIC) ||
+      (header->size < sizeof(http_assets_header_t)) || (header->size > area_size))
+  {
+    return HTTP_ERROR;
+  }
+
+  if ((header->version != HTTP_ASSETS_VERSION) || (header->asset_nbr > HTTP_ASSETS_MAX_NBR) ||
+      (header->index_size == 0U) || (header->index_size < header->asset_nbr) ||
+      ((header->index_size & (header->index_size - 1U)) != 0U) || (header->index_size > 0x10000U))
+  {
+    return HTTP_ERROR;
+  }
+
+  /* Index, then asset table, 4 bytes aligned */
+  index        = (const uint16_t *)&pack[sizeof(http_assets_header_t)];
+  table_offset = (sizeof(http_assets_header_t) + (header->index_size * sizeof(uint16_t)) + 3U) & ~3U;
+  entries      = (const http_assets_entry_t *)&pack[table_offset];
+  if ((table_offset + (header->asset_nbr * sizeof(http_assets_entry_t))) > header->size)
+  {
+    return HTTP_ERROR;
+  }
+
+  for (uint32_t slot = 0U; slot < header->index_size; slot++)
+  {
+    if ((index[slot] != HTTP_ASSETS_INDEX_EMPTY) && (index[slot] >= header->asset_nbr))
+    {
+      return HTTP_ERROR;
+    }
+  }
+
+  for (uint32_t i = 0U; i < header->asset_nbr; i++)
+  {
+    asset = &http_assets[i];
+
+    asset->path         = http_assets_string(pack, header->size, entries[i].path);
+    asset->path_size    = entries[i].path_size;
+    asset->content_type = http_assets_string(pack, header->size, entries[i].content_type);
+    asset->cache_policy = entries[i].cache_policy;
+    asset->negotiated   = false;
+    if ((asset->path == NULL) || (strlen(asset->path) != asset->path_size) || (asset->content_type == NULL))
+    {
+      return HTTP_ERROR;
+    }
+
+    for (uint32_t coding = HTTP_CODING_IDENTITY; coding < HTTP_CODING_NBR; coding++)
+    {
+      body = &entries[i].codings[coding];
+      asset->codings[coding].body      = NULL;
+      asset->codings[coding].body_size = 0U;
+      asset->codings[coding].etag      = NULL;
+
+      /* The identity body is always there, coded ones only when smaller */
+      if ((body->offset == 0U) && (coding != HTTP_CODING_IDENTITY))
+      {
+        continue;
+      }
+      if ((body->offset > header->size) || (body->size > (header->size - body->offset)))
+      {
+        return HTTP_ERROR;
+      }
+
+      asset->codings[coding].body      = (const char *)&pack[body->offset];
+      asset->codings[coding].body_size = body->size;
+      asset->codings[coding].etag      = http_assets_string(pack, header->size, body->etag);
+      if (asset->codings[coding].etag == NULL)
+      {
+        return HTTP_ERROR;
+      }
+
+      asset->negotiated = asset->negotiated || (coding != HTTP_CODING_IDENTITY);
+    }
+  }
+
+  http_assets_index = index;
+  http_assets_pack  = header;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Get the number of assets of the pack
+  * @param  None
+  * @retval Number of assets, 0 if no valid pack is set
+  */
+uint32_t webserver_http_assets_count(void)
+{
+  return (http_assets_pack != NULL) ? http_assets_pack->asset_nbr : 0U;
+}
+
+/**
+  * @brief  Find the asset served at a path, one hash and one compare whatever the number of assets
+  * @param  path      : pointer to request path, query string excluded
+  * @param  path_size : request path length
+  * @retval Asset number, HTTP_ASSET_NONE if none
+  */
+uint32_t webserver_http_asset_find(const char *path, uint32_t path_size)
+{
+  const http_asset_t *asset;
+  uint32_t slot;
+
+  if (http_assets_pack == NULL)
+  {
+    return HTTP_ASSET_NONE;
+  }
+
+  slot = http_assets_hash(http_assets_pack->seed, path, path_size) & (http_assets_pack->index_size - 1U);
+  if (http_assets_index[slot] == HTTP_ASSETS_INDEX_EMPTY)
+  {
+    return HTTP_ASSET_NONE;
+  }
+
+  /* A single candidate per slot, confirm the path */
+  asset = &http_assets[http_assets_index[slot]];
+  if ((asset->path_size != path_size) || (memcmp(asset->path, path, path_size) != 0))
+  {
+    return HTTP_ASSET_NONE;
+  }
+
+  return http_assets_index[slot];
+}
+
+/**
+  * @brief  Get an asset of the pack
+  * @param  asset : asset number
+  * @retval Pointer to the asset, NULL if none
+  */
+const http_asset_t *webserver_http_asset_get(uint32_t asset)
+{
+  if (asset >= webserver_http_assets_count())
+  {
+    return NULL;
+  }
+
+  return &http_assets[asset];
+}
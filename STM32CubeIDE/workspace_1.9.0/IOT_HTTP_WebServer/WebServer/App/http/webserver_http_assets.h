@@ -0,0 +1,76 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_assets.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_assets.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_ASSETS_H
+#define WEBSERVER_HTTP_ASSETS_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "webserver_status.h"
+#include "webserver_http_routes.h"
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Web page asset pack location: 0 linked in the internal flash with the firmware, 1 flashed separately to the OSPI NOR
+   flash and read in place through its memory mapped window */
+#if !defined(HTTP_ASSETS_OSPI)
+#define HTTP_ASSETS_OSPI             (0)
+#endif
+
+/* Asset pack offset in the OSPI NOR flash, a 64 KB sector boundary */
+#define HTTP_ASSETS_OSPI_OFFSET      (0x00000000U)
+
+/* Maximum number of assets in a pack */
+#define HTTP_ASSETS_MAX_NBR          (12U)
+
+/* Asset number of a path not found in the pack */
+#define HTTP_ASSET_NONE              (0xFFFFFFFFU)
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Asset body, as a content coding of it
+  */
+typedef struct
+{
+  const char *body;                            /*!< Body data, NULL if not available                  */
+  uint32_t   body_size;                        /*!< Body size                                         */
+  const char *etag;                            /*!< Body entity tag, quoted                           */
+} http_asset_body_t;
+
+/**
+  * @brief  Web page asset, pointing into the asset pack
+  */
+typedef struct
+{
+  const char        *path;                     /*!< Absolute request path, null terminated            */
+  uint32_t          path_size;                 /*!< Request path length                               */
+  const char        *content_type;             /*!< Media type, null terminated                       */
+  uint32_t          cache_policy;              /*!< Response cache policy, one of HTTP_CACHE_xxx      */
+  bool              negotiated;                /*!< Content coded bodies available                    */
+  http_asset_body_t codings[HTTP_CODING_NBR];  /*!< Bodies, by HTTP_CODING_xxx                        */
+} http_asset_t;
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+WebServer_StatusTypeDef webserver_http_assets_init(const uint8_t *pack, uint32_t area_size);
+uint32_t webserver_http_assets_count(void);
+uint32_t webserver_http_asset_find(const char *path, uint32_t path_size);
+const http_asset_t *webserver_http_asset_get(uint32_t asset);
+
+#endif /* WEBSERVER_HTTP_ASSETS_H */
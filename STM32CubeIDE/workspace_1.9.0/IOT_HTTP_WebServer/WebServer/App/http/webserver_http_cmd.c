@@ -19,56 +19,6 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver_http_cmd.h"
 
-/* HTTP commands */
-const char     http_get_cmd[]    = "GET /";
-const uint32_t http_get_cmd_size = sizeof(http_get_cmd) - 1U;
-
-/* Get html command */
-const char     http_html_cmd[]    = " ";
-const uint32_t http_html_cmd_size = sizeof(http_html_cmd) - 1U;
-
-/* Get css commands */
-const char     http_css_chunk_cmd[]    = "static/css/chunk.css ";
-const uint32_t http_css_chunk_cmd_size = sizeof(http_css_chunk_cmd) - 1U;
-const char     http_css_main_cmd[]     = "static/css/main.css ";
-const uint32_t http_css_main_cmd_size  = sizeof(http_css_main_cmd) - 1U;
-
-/* Get js commands */
-const char     http_js_chunk_cmd[]    = "static/js/chunk.js ";
-const uint32_t http_js_chunk_cmd_size = sizeof(http_js_chunk_cmd) - 1U;
-const char     http_js_main_cmd[]     = "static/js/main.js ";
-const uint32_t http_js_main_cmd_size  = sizeof(http_js_main_cmd) - 1U;
-
-/* Get font command */
-const char     http_font_cmd[]    = "static/media/fa-solid-900.woff2 ";
-const uint32_t http_font_cmd_size = sizeof(http_font_cmd) - 1U;
-
-/* Get json command */
-const char     http_json_cmd[]    = "manifest.json ";
-const uint32_t http_json_cmd_size = sizeof(http_json_cmd) - 1U;
-
-/* Get favicon command */
-const char     http_favicon_cmd[]    = "favicon.png ";
-const uint32_t http_favicon_cmd_size = sizeof(http_favicon_cmd) - 1U;
-
-/* Get image command */
-const char     http_image_cmd[]    = "static/media/FLSTM32U5.jpg ";
-const uint32_t http_image_cmd_size = sizeof(http_image_cmd) - 1U;
-
-/* Get css command */
-const char     http_css_cmd[]    = "styles.css ";
-const uint32_t http_css_cmd_size = sizeof(http_css_cmd) - 1U;
-
-/* Read temperature command */
-const char     http_read_temperature_cmd[]    = "Read_Temperature ";
-const uint32_t http_read_temperature_cmd_size = sizeof(http_read_temperature_cmd) - 1U;
-/* Read pressure command */
-const char     http_read_pressure_cmd[]    = "Read_Pressure ";
-const uint32_t http_read_pressure_cmd_size = sizeof(http_read_pressure_cmd) - 1U;
-/* Read humidity command */
-const char     http_read_humidity_cmd[]    = "Read_Humidity ";
-const uint32_t http_read_humidity_cmd_size = sizeof(http_read_humidity_cmd) - 1U;
-
 /* HTTP response headers */
 const char *http_headers[] =
 {
@@ -84,6 +34,26 @@ const char *http_headers[] =
   "Access-Control-Allow-Methods: GET\r\n",
   "Access-Control-Allow-Headers: cache-control, last-event-id, X-Requested-With\r\n",
   "Cache-Control: no-cache\r\n",
+  "Connection: keep-alive\r\n",
+  "Vary: Accept-Encoding\r\n",
+  "Content-Encoding: ",
+  "HTTP/1.1 304 Not Modified\r\n",
+  "ETag: ",
+  "Cache-Control: max-age=86400\r\n",
+  "HTTP/1.1 206 Partial Content\r\n",
+  "HTTP/1.1 416 Range Not Satisfiable\r\n",
+  "Content-Range: bytes ",
+  "HTTP/1.1 101 Switching Protocols\r\n",
+  "Upgrade: websocket\r\n",
+  "Connection: Upgrade\r\n",
+  "Sec-WebSocket-Accept: ",
+  "HTTP/1.1 400 Bad Request\r\n",
+  "Sec-WebSocket-Version: 13\r\n",
+  "Transfer-Encoding: chunked\r\n",
+  "HTTP/1.1 414 URI Too Long\r\n",
+  "HTTP/1.1 431 Request Header Fields Too Large\r\n",
+  "HTTP/1.1 501 Not Implemented\r\n",
+  "Allow: GET, HEAD\r\n",
 };
 
 /* HTTP response content types */
@@ -96,4 +66,14 @@ const char *http_content_types[] =
   "font/woff2\r\n",
   "application/json\r\n",
   "image/jpg\r\n",
+  "text/event-stream\r\n",
+  "text/plain; version=0.0.4; charset=utf-8\r\n",
+};
+
+/* HTTP response content codings */
+const char *http_content_codings[] =
+{
+  "identity\r\n",
+  "gzip\r\n",
+  "br\r\n",
 };
@@ -23,58 +23,9 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include <string.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
 
-/* HTTP commands */
-extern const char     http_get_cmd[];
-extern const uint32_t http_get_cmd_size;
-
-/* Get html command */
-extern const char     http_html_cmd[];
-extern const uint32_t http_html_cmd_size;
-
-/* Get css commands */
-extern const char     http_css_chunk_cmd[];
-extern const uint32_t http_css_chunk_cmd_size;
-extern const char     http_css_main_cmd[];
-extern const uint32_t http_css_main_cmd_size;
-
-/* Get js commands */
-extern const char     http_js_chunk_cmd[];
-extern const uint32_t http_js_chunk_cmd_size;
-extern const char     http_js_main_cmd[];
-extern const uint32_t http_js_main_cmd_size;
-
-/* Get font command */
-extern const char     http_font_cmd[];
-extern const uint32_t http_font_cmd_size;
-
-/* Get json command */
-extern const char     http_json_cmd[];
-extern const uint32_t http_json_cmd_size;
-
-/* Get favicon command */
-extern const char     http_favicon_cmd[];
-extern const uint32_t http_favicon_cmd_size;
-
-/* Get image command */
-extern const char     http_image_cmd[];
-extern const uint32_t http_image_cmd_size;
-
-/* Get css command */
-extern const char     http_css_cmd[];
-extern const uint32_t http_css_cmd_size;
-
-/* Read temperature command */
-extern const char     http_read_temperature_cmd[];
-extern const uint32_t http_read_temperature_cmd_size;
-/* Read pressure command */
-extern const char     http_read_pressure_cmd[];
-extern const uint32_t http_read_pressure_cmd_size;
-/* Read humidity command */
-extern const char     http_read_humidity_cmd[];
-extern const uint32_t http_read_humidity_cmd_size;
-
 /* HTTP response headers */
 extern const char     *http_headers[];
 extern const uint32_t http_headers_size;
@@ -83,6 +34,9 @@ extern const uint32_t http_headers_size;
 extern const char     *http_content_types[];
 extern const uint32_t http_content_types_size;
 
+/* HTTP response content codings */
+extern const char     *http_content_codings[];
+
 /* Exported types ----------------------------------------------------------------------------------------------------*/
 /* Exported constants ------------------------------------------------------------------------------------------------*/
 /* HTTP header response defines */
@@ -98,6 +52,26 @@ extern const uint32_t http_content_types_size;
 #define HTTP_HEADER_CONTROL_METHODS  (9U)
 #define HTTP_HEADER_CONTROL_HEADERS  (10U)
 #define HTTP_HEADER_CACHE_CONTROL    (11U)
+#define HTTP_HEADER_CONNECTION_ALIVE (12U)
+#define HTTP_HEADER_VARY_ENCODING    (13U)
+#define HTTP_HEADER_CONTENT_ENCODING (14U)
+#define HTTP_HEADER_NOT_MODIFIED     (15U)
+#define HTTP_HEADER_ETAG             (16U)
+#define HTTP_HEADER_CACHE_MAX_AGE    (17U)
+#define HTTP_HEADER_PARTIAL_CONTENT  (18U)
+#define HTTP_HEADER_RANGE_INVALID    (19U)
+#define HTTP_HEADER_BYTES_RANGE      (20U)
+#define HTTP_HEADER_SWITCHING        (21U)
+#define HTTP_HEADER_UPGRADE_WS       (22U)
+#define HTTP_HEADER_CONNECTION_UPG   (23U)
+#define HTTP_HEADER_WS_ACCEPT        (24U)
+#define HTTP_HEADER_BAD_REQUEST      (25U)
+#define HTTP_HEADER_WS_VERSION       (26U)
+#define HTTP_HEADER_CHUNKED          (27U)
+#define HTTP_HEADER_URI_TOO_LONG     (28U)
+#define HTTP_HEADER_FIELDS_TOO_LARGE (29U)
+#define HTTP_HEADER_NOT_IMPLEMENTED  (30U)
+#define HTTP_HEADER_ALLOW            (31U)
 
 /* HTTP response content defines */
 #define HTTP_HEADER_CONTENT_HTML     (0U)
@@ -107,19 +81,19 @@ extern const uint32_t http_content_types_size;
 #define HTTP_HEADER_CONTENT_FONT     (4U)
 #define HTTP_HEADER_CONTENT_JSON     (5U)
 #define HTTP_HEADER_CONTENT_IMAGE    (6U)
+#define HTTP_HEADER_CONTENT_EVENTS   (7U)
+#define HTTP_HEADER_CONTENT_METRICS  (8U)
 
 /* HTTP response content IDs */
-#define HTTP_HEADER_HTML_ID          (0U)
-#define HTTP_HEADER_JS_ID            (1U)
-#define HTTP_HEADER_CSS_ID           (2U)
-#define HTTP_HEADER_FAVICON_ID       (3U)
 #define HTTP_HEADER_SENSOR_ID        (4U)
 #define HTTP_HEADER_TEMP_SENSOR_ID   (5U)
 #define HTTP_HEADER_PRESS_SENSOR_ID  (6U)
 #define HTTP_HEADER_HUM_SENSOR_ID    (7U)
-#define HTTP_HEADER_FONT_ID          (8U)
 #define HTTP_HEADER_JSON_ID          (9U)
-#define HTTP_HEADER_IMAGE_ID         (10U)
+#define HTTP_HEADER_NOTFOUND_ID      (11U)
+#define HTTP_HEADER_EVENTS_ID        (12U)
+#define HTTP_HEADER_WEBSOCKET_ID     (13U)
+#define HTTP_HEADER_METRICS_ID       (14U)
 
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
@@ -0,0 +1,686 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_conn.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server http connections event loop.
+  *          Several connections are served at once, each one with its own state and send cursor, using
+  *          non-blocking socket calls: a connection that cannot progress is skipped, and a large body is
+  *          sent one chunk per loop round so that it does not hold the other connections back. A body of
+  *          unknown length is produced the same way, one piece per round, by the response writer.
+  *          A response may be followed by a stream, server-sent events or WebSocket frames: the connection
+  *          then sends each event or batch of samples as it is due, until the client closes it.
+  *          Each loop round first runs the sensors acquisition stage, so that connections only ever read
+  *          the latest value store. The accept call only waits for a new connection while none is open,
+  *          the live ones being polled again at once otherwise.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_conn.h"
+#include "webserver_http_response.h"
+#include "webserver_http_parser.h"
+#include "webserver_http_encoder.h"
+#include "webserver_http_api.h"
+#include "webserver_http_ws.h"
+#include "webserver_http_writer.h"
+#include "webserver_http_metrics.h"
+#include "webserver_sensors.h"
+#include "net_connect.h"
+#include "mx_wifi.h"
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  HTTP connection
+  */
+typedef struct
+{
+  int32_t         socket;                                       /*!< Connection socket                   */
+  uint32_t        state;                                        /*!< One of HTTP_CONN_xxx                */
+  uint32_t        last_activity;                                /*!< Tick of the last progress           */
+  uint32_t        request_count;                                /*!< Requests answered so far            */
+  uint32_t        request_start;                                /*!< Time in us the request started      */
+  uint32_t        timing;                                       /*!< One of HTTP_CONN_TIMING_xxx         */
+  bool            keep_alive;                                   /*!< Keep open after the response        */
+  bool            motion;                                       /*!< Motion stream subscribed            */
+  uint32_t        recv_length;                                  /*!< Bytes held in recv_buffer           */
+  http_parser_t   parser;                                       /*!< Request parser state                */
+  http_request_t  request;                                      /*!< Request being received              */
+  uint32_t        send_offset;                                  /*!< Bytes of the response already sent  */
+  http_response_t response;                                     /*!< Response being sent                 */
+  char            recv_buffer[HTTP_RECEIVE_BUFFER_SIZE + 1U];   /*!< Received request data               */
+  char            header_buffer[HTTP_HEADERS_BUFFER_SIZE];      /*!< Response header scratch buffer      */
+  char            body_buffer[HTTP_SENSORS_BUFFER_SIZE];        /*!< Response body scratch buffer        */
+} http_conn_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define HTTP_CONN_MAX_NBR           (NET_MAX_SOCKETS_NBR - 1U)  /* One socket is the listening one             */
+
+/* Connection states */
+#define HTTP_CONN_FREE              (0U)      /* Slot not in use                                          */
+#define HTTP_CONN_READING           (1U)      /* Waiting for a complete request header                    */
+#define HTTP_CONN_SENDING           (2U)      /* Sending a response                                       */
+#define HTTP_CONN_STREAMING         (3U)      /* Waiting for the next event or frame of a stream          */
+
+/* Request timing phases */
+#define HTTP_CONN_TIMING_NONE       (0U)      /* No request being answered                                */
+#define HTTP_CONN_TIMING_FIRST      (1U)      /* Response built, first byte not sent yet                  */
+#define HTTP_CONN_TIMING_LAST       (2U)      /* First byte sent, last byte not sent yet                  */
+
+#define HTTP_KEEPALIVE_TIMEOUT      (5000U)   /* Idle time in ms before a persistent connection is closed */
+#define HTTP_KEEPALIVE_MAX_REQUESTS (100U)    /* Requests served on a persistent connection before closing */
+#define HTTP_SEND_TIMEOUT           (10000U)  /* Time in ms without send progress before dropping a client */
+
+/* Time in ms the accept call waits for a new connection while no connection is open, it does not wait otherwise */
+#define HTTP_ACCEPT_IDLE_TIMEOUT    (1000)
+
+/* Bytes handed to one send, split in frames by the driver: a few frames, so that one connection does not hold the */
+/* others for long                                                                                               */
+#define MAX_SOCKET_DATASIZE         (4U * (MX_WIFI_BUFFER_SIZE - 100U))
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Connections pool */
+static http_conn_t http_conns[HTTP_CONN_MAX_NBR];
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t http_conn_accept(int32_t listen_socket);
+static bool http_conn_step(http_conn_t *conn);
+static bool http_conn_read(http_conn_t *conn);
+static void http_conn_reject(http_conn_t *conn, uint32_t status);
+static bool http_conn_write(http_conn_t *conn);
+static bool http_conn_events(http_conn_t *conn);
+static bool http_conn_websocket(http_conn_t *conn);
+static bool http_conn_websocket_reply(http_conn_t *conn, const http_ws_frame_t *frame);
+static void http_conn_close(http_conn_t *conn);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Serve the HTTP connections of a listening socket
+  * @param  listen_socket : listening socket
+  * @retval Web Server status, only returns on a listening socket error
+  */
+WebServer_StatusTypeDef webserver_http_conn_serve(int32_t listen_socket)
+{
+  int32_t  timeout = HTTP_ACCEPT_IDLE_TIMEOUT;
+  uint32_t live_nbr;
+  bool     accept_blocking = true;
+  bool     blocking;
+
+  if (net_setsockopt(listen_socket, NET_SOL_SOCKET, NET_SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0)
+  {
+    printf("*** Fail : Accept timeout not set !!!! \r\n");
+    return SOCKET_ERROR;
+  }
+
+  while (1)
+  {
+    /* Acquire the sensors that are due, before the connections read them */
+    (void)webserver_sensors_process();
+
+    /* Give each live connection a chance to progress */
+    live_nbr = 0U;
+    for (uint32_t i = 0U; i < HTTP_CONN_MAX_NBR; i++)
+    {
+      if (http_conns[i].state != HTTP_CONN_FREE)
+      {
+        (void)http_conn_step(&http_conns[i]);
+        live_nbr += (http_conns[i].state != HTTP_CONN_FREE) ? 1U : 0U;
+      }
+    }
+
+    if (live_nbr == HTTP_CONN_MAX_NBR)
+    {
+      continue;
+    }
+
+    /* Wait for a new connection only while the pool is idle, the live connections are polled again at once */
+    blocking = (live_nbr == 0U);
+    if (blocking != accept_blocking)
+    {
+      if (net_setsockopt(listen_socket, NET_SOL_SOCKET, NET_SO_BLOCKING, &blocking, sizeof(blocking)) != 0)
+      {
+        printf("*** Fail : Accept mode not set !!!! \r\n");
+        return SOCKET_ERROR;
+      }
+      accept_blocking = blocking;
+    }
+
+    (void)http_conn_accept(listen_socket);
+  }
+}
+
+/**
+  * @brief  Accept a new connection into a free slot of the pool
+  * @param  listen_socket : listening socket
+  * @retval Number of accepted connections
+  */
+static uint32_t http_conn_accept(int32_t listen_socket)
+{
+  struct net_sockaddr remotehost;
+  uint32_t size = sizeof(remotehost);
+  int32_t  socket;
+
+  /* A timeout only means nobody connected */
+  socket = net_accept(listen_socket, &remotehost, &size);
+  if (socket < 0)
+  {
+    return 0U;
+  }
+
+  for (uint32_t i = 0U; i < HTTP_CONN_MAX_NBR; i++)
+  {
+    if (http_conns[i].state == HTTP_CONN_FREE)
+    {
+      http_conns[i].socket                 = socket;
+      http_conns[i].state                  = HTTP_CONN_READING;
+      http_conns[i].last_activity          = HAL_GetTick();
+      http_conns[i].request_count          = 0U;
+      http_conns[i].request_start          = webserver_http_metrics_now();
+      http_conns[i].timing                 = HTTP_CONN_TIMING_NONE;
+      http_conns[i].keep_alive             = true;
+      http_conns[i].motion                 = false;
+      http_conns[i].recv_length            = 0U;
+      webserver_http_parser_init(&http_conns[i].parser, &http_conns[i].request);
+      http_conns[i].send_offset            = 0U;
+      http_conns[i].response.header_buffer = http_conns[i].header_buffer;
+      http_conns[i].response.body_buffer   = http_conns[i].body_buffer;
+      webserver_http_metrics_count(HTTP_METRICS_ACCEPTED, 1U);
+      return 1U;
+    }
+  }
+
+  /* No free slot, only possible if the network library has more sockets than expected */
+  (void)net_closesocket(socket);
+  webserver_http_metrics_count(HTTP_METRICS_REJECTED, 1U);
+
+  return 0U;
+}
+
+/**
+  * @brief  Let a connection progress as far as it can without waiting
+  * @param  conn : connection
+  * @retval true if the connection progressed, false otherwise
+  */
+static bool http_conn_step(http_conn_t *conn)
+{
+  switch (conn->state)
+  {
+    /* Read and answer a request */
+  case HTTP_CONN_READING:
+    {
+      return http_conn_read(conn);
+    }
+
+    /* Send the next chunk of the response */
+  case HTTP_CONN_SENDING:
+    {
+      return http_conn_write(conn);
+    }
+
+    /* Build the next event or frame of the stream */
+  case HTTP_CONN_STREAMING:
+    {
+      if (conn->response.stream.type == HTTP_STREAM_WEBSOCKET)
+      {
+        return http_conn_websocket(conn);
+      }
+      return http_conn_events(conn);
+    }
+
+  default:
+    return false;
+  }
+}
+
+/**
+  * @brief  Read the request data available on a connection, and build the response of a complete request
+  * @param  conn : connection
+  * @retval true if the connection progressed, false otherwise
+  */
+static bool http_conn_read(http_conn_t *conn)
+{
+  http_request_t *request = &conn->request;
+  uint32_t       request_length;
+  uint32_t       result;
+  int32_t        ret;
+
+  /* Parse the received data, pipelined requests may already be there */
+  result = webserver_http_parser_execute(&conn->parser, request, conn->recv_buffer, conn->recv_length);
+  if (result == HTTP_PARSER_ERROR)
+  {
+    printf("*** Fail : Invalid HTTP request !!!! \r\n");
+    http_conn_reject(conn, HTTP_HEADER_BAD_REQUEST);
+    return true;
+  }
+
+  if (result == HTTP_PARSER_MORE)
+  {
+    /* Request header larger than the receive buffer, the request line alone or with its header fields */
+    if (conn->recv_length >= HTTP_RECEIVE_BUFFER_SIZE)
+    {
+      http_conn_reject(conn, (conn->parser.state == HTTP_PARSER_STATE_REQUEST) ?
+                             HTTP_HEADER_URI_TOO_LONG : HTTP_HEADER_FIELDS_TOO_LARGE);
+      return true;
+    }
+
+    ret = net_recv(conn->socket, (uint8_t *)&conn->recv_buffer[conn->recv_length],
+                   HTTP_RECEIVE_BUFFER_SIZE - conn->recv_length, NET_MSG_DONTWAIT);
+
+    /* Closed by the client */
+    if (ret == 0)
+    {
+      http_conn_close(conn);
+      return true;
+    }
+
+    /* Nothing to read, close the connection once it stayed idle for too long */
+    if (ret < 0)
+    {
+      if ((HAL_GetTick() - conn->last_activity) > HTTP_KEEPALIVE_TIMEOUT)
+      {
+        webserver_http_metrics_count(HTTP_METRICS_TIMEOUTS, 1U);
+        http_conn_close(conn);
+      }
+      return false;
+    }
+
+    /* A request following another one on an idle connection starts with its first byte, the first request
+       of a connection with the accept */
+    if ((conn->recv_length == 0U) && (conn->request_count > 0U))
+    {
+      conn->request_start = webserver_http_metrics_now();
+    }
+    webserver_http_metrics_count(HTTP_METRICS_RECV_BYTES, (uint32_t)ret);
+
+    /* Keep the received data null terminated, header field values are bounded by the end of their line */
+    conn->recv_length += (uint32_t)ret;
+    conn->recv_buffer[conn->recv_length] = '\0';
+    conn->last_activity = HAL_GetTick();
+    return true;
+  }
+
+  /* Keep the connection open unless the client, or the request limit, asks otherwise */
+  request_length = request->header_size;
+  conn->request_count++;
+  request->keep_alive = conn->request_count < HTTP_KEEPALIVE_MAX_REQUESTS;
+
+  if (webserver_http_process(request, &conn->response) != WEBSERVER_OK)
+  {
+    printf("*** Fail : Invalid HTTP request !!!! \r\n");
+    http_conn_reject(conn, HTTP_HEADER_BAD_REQUEST);
+    return true;
+  }
+
+  conn->keep_alive = request->keep_alive;
+  conn->timing     = HTTP_CONN_TIMING_FIRST;
+
+  /* The response does not refer to the request, keep pipelined data received after it */
+  conn->recv_length -= request_length;
+  memmove(conn->recv_buffer, &conn->recv_buffer[request_length], conn->recv_length + 1U);
+  webserver_http_parser_init(&conn->parser, request);
+
+  conn->send_offset   = 0U;
+  conn->state         = HTTP_CONN_SENDING;
+  conn->last_activity = HAL_GetTick();
+
+  return true;
+}
+
+/**
+  * @brief  Answer a request the server cannot read with an error status, then close the connection once it is sent.
+  *         The rest of the received data cannot be told apart from the request, it is dropped.
+  * @param  conn   : connection
+  * @param  status : status line, one of HTTP_HEADER_BAD_REQUEST, HTTP_HEADER_URI_TOO_LONG or
+  *                  HTTP_HEADER_FIELDS_TOO_LARGE
+  * @retval None
+  */
+static void http_conn_reject(http_conn_t *conn, uint32_t status)
+{
+  http_response_t *response = &conn->response;
+
+  webserver_http_metrics_count(HTTP_METRICS_BAD_REQUESTS, 1U);
+
+  if (webserver_http_encode_error_response(conn->header_buffer, status, false) != WEBSERVER_OK)
+  {
+    http_conn_close(conn);
+    return;
+  }
+
+  response->header      = conn->header_buffer;
+  response->header_size = strlen(conn->header_buffer);
+  response->body        = NULL;
+  response->body_size   = 0U;
+  response->stream.type = HTTP_STREAM_NONE;
+  response->writer.fill = NULL;
+  response->metric      = webserver_http_metrics_slot(NULL, HTTP_ASSET_NONE);
+  response->failed      = true;
+
+  conn->recv_length   = 0U;
+  conn->keep_alive    = false;
+  conn->timing        = HTTP_CONN_TIMING_FIRST;
+  conn->send_offset   = 0U;
+  conn->state         = HTTP_CONN_SENDING;
+  conn->last_activity = HAL_GetTick();
+}
+
+/**
+  * @brief  Send the next chunk of a connection response: what is left of the header and the body following it, in
+  *         one frame, so that a small response goes out as a single segment
+  * @param  conn : connection
+  * @retval true if the connection progressed, false otherwise
+  */
+static bool http_conn_write(http_conn_t *conn)
+{
+  http_response_t *response = &conn->response;
+  net_iovec_t iov[2];
+  int32_t     iovcnt = 0;
+  uint32_t    data_size;
+  uint32_t    body_offset = 0U;
+  uint32_t    now;
+  int32_t     ret;
+
+  if (conn->send_offset < response->header_size)
+  {
+    iov[iovcnt].iov_base = (void *)&response->header[conn->send_offset];
+    iov[iovcnt].iov_len  = response->header_size - conn->send_offset;
+    iovcnt++;
+  }
+  else
+  {
+    body_offset = conn->send_offset - response->header_size;
+  }
+
+  data_size = response->header_size + response->body_size - conn->send_offset;
+  if (data_size > MAX_SOCKET_DATASIZE)
+  {
+    data_size = MAX_SOCKET_DATASIZE;
+  }
+
+  /* Body up to the send size, after the header part if any */
+  if ((iovcnt == 0) || (data_size > iov[0].iov_len))
+  {
+    iov[iovcnt].iov_base = (void *)&response->body[body_offset];
+    iov[iovcnt].iov_len  = data_size - ((iovcnt == 0) ? 0U : iov[0].iov_len);
+    iovcnt++;
+  }
+  else
+  {
+    iov[0].iov_len = data_size;
+  }
+
+  if (data_size > 0U)
+  {
+    /* Nothing sent, drop the client once it stopped reading for too long. The tick is taken before the send, the
+       client may already be done with the data once it returns */
+    now = HAL_GetTick();
+    ret = net_sendv(conn->socket, iov, iovcnt, NET_MSG_DONTWAIT);
+    if (ret <= 0)
+    {
+      webserver_http_metrics_count(HTTP_METRICS_SEND_BLOCKED, 1U);
+      if ((now - conn->last_activity) > HTTP_SEND_TIMEOUT)
+      {
+        webserver_http_metrics_count(HTTP_METRICS_TIMEOUTS, 1U);
+        http_conn_close(conn);
+      }
+      return false;
+    }
+
+    webserver_http_metrics_count(HTTP_METRICS_SEND_CALLS, 1U);
+    webserver_http_metrics_sent(response->metric, (uint32_t)ret);
+    if (conn->timing == HTTP_CONN_TIMING_FIRST)
+    {
+      webserver_http_metrics_first_byte(response->metric, conn->request_start);
+      conn->timing = HTTP_CONN_TIMING_LAST;
+    }
+
+    conn->send_offset  += (uint32_t)ret;
+    conn->last_activity = now;
+  }
+
+  /* Response complete, wait for the next event, the next request or close */
+  if (conn->send_offset == response->header_size + response->body_size)
+  {
+    /* Body produced piece by piece, send the next one */
+    if ((response->writer.fill != NULL) && !response->writer.done)
+    {
+      if (webserver_http_writer_next(&response->writer, conn->body_buffer, HTTP_SENSORS_BUFFER_SIZE,
+                                     &response->body_size) != WEBSERVER_OK)
+      {
+        printf("*** Fail : Response body not produced !!!! \r\n");
+        http_conn_close(conn);
+        return true;
+      }
+
+      response->header_size = 0U;
+      response->body        = conn->body_buffer;
+      conn->send_offset     = 0U;
+      return true;
+    }
+
+    /* Request answered, a stream one once its opening response is sent */
+    if (conn->timing != HTTP_CONN_TIMING_NONE)
+    {
+      webserver_http_metrics_request(response->metric, conn->request_start, response->failed);
+      conn->timing = HTTP_CONN_TIMING_NONE;
+    }
+
+    if (response->stream.type != HTTP_STREAM_NONE)
+    {
+      /* The motion sensors run at their stream rates as long as the connection is open */
+      if ((response->stream.type == HTTP_STREAM_WEBSOCKET) && !conn->motion)
+      {
+        webserver_sensors_motion_subscribe();
+        conn->motion = true;
+      }
+      conn->state = HTTP_CONN_STREAMING;
+    }
+    else if (conn->keep_alive)
+    {
+      /* A pipelined request is already there, it starts now */
+      conn->request_start = webserver_http_metrics_now();
+      conn->state         = HTTP_CONN_READING;
+    }
+    else
+    {
+      http_conn_close(conn);
+    }
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Send the next event of a connection stream once it is due
+  * @param  conn : connection
+  * @retval true if the connection progressed, false otherwise
+  */
+static bool http_conn_events(http_conn_t *conn)
+{
+  http_response_t *response = &conn->response;
+  uint32_t        event_size;
+  int32_t         ret;
+
+  /* The client has nothing more to send, reading only tells if it closed the stream */
+  ret = net_recv(conn->socket, (uint8_t *)conn->recv_buffer, HTTP_RECEIVE_BUFFER_SIZE, NET_MSG_DONTWAIT);
+  if (ret == 0)
+  {
+    http_conn_close(conn);
+    return true;
+  }
+  webserver_http_metrics_count(HTTP_METRICS_RECV_BYTES, (ret > 0) ? (uint32_t)ret : 0U);
+
+  if (webserver_http_api_stream_event(&response->stream, conn->body_buffer, HTTP_SENSORS_BUFFER_SIZE,
+                                      &event_size) != WEBSERVER_OK)
+  {
+    printf("*** Fail : Event not built !!!! \r\n");
+    http_conn_close(conn);
+    return true;
+  }
+
+  if (event_size == 0U)
+  {
+    return false;
+  }
+
+  /* Send the event alone, as a response without header */
+  response->header_size = 0U;
+  response->body        = conn->body_buffer;
+  response->body_size   = event_size;
+  conn->send_offset     = 0U;
+  conn->state           = HTTP_CONN_SENDING;
+  conn->last_activity   = HAL_GetTick();
+
+  return true;
+}
+
+/**
+  * @brief  Answer the frames received on a WebSocket connection, and send the motion samples once a batch is
+  *         complete
+  * @param  conn : connection
+  * @retval true, the samples are taken at a high rate and the event loop must not wait for a new connection
+  */
+static bool http_conn_websocket(http_conn_t *conn)
+{
+  http_response_t *response = &conn->response;
+  http_ws_frame_t frame;
+  uint32_t        result;
+  uint32_t        batch_size;
+  int32_t         ret;
+
+  /* Receive the client frames, there is no need for a null terminated buffer anymore */
+  if (conn->recv_length < HTTP_RECEIVE_BUFFER_SIZE)
+  {
+    ret = net_recv(conn->socket, (uint8_t *)&conn->recv_buffer[conn->recv_length],
+                   HTTP_RECEIVE_BUFFER_SIZE - conn->recv_length, NET_MSG_DONTWAIT);
+    if (ret == 0)
+    {
+      http_conn_close(conn);
+      return true;
+    }
+    conn->recv_length += (ret > 0) ? (uint32_t)ret : 0U;
+    webserver_http_metrics_count(HTTP_METRICS_RECV_BYTES, (ret > 0) ? (uint32_t)ret : 0U);
+  }
+
+  /* A frame larger than the receive buffer is never complete */
+  result = webserver_http_ws_frame_parse((uint8_t *)conn->recv_buffer, conn->recv_length, &frame);
+  if ((result == HTTP_WS_FRAME_ERROR) ||
+      ((result == HTTP_WS_FRAME_MORE) && (conn->recv_length >= HTTP_RECEIVE_BUFFER_SIZE)))
+  {
+    printf("*** Fail : Invalid WebSocket frame !!!! \r\n");
+    http_conn_close(conn);
+    return true;
+  }
+
+  if (result == HTTP_WS_FRAME_DONE)
+  {
+    if (http_conn_websocket_reply(conn, &frame))
+    {
+      return true;
+    }
+
+    conn->recv_length -= frame.frame_size;
+    memmove(conn->recv_buffer, &conn->recv_buffer[frame.frame_size], conn->recv_length);
+  }
+
+  /* Send the batch as a binary message */
+  webserver_http_api_motion_batch(&response->stream, (uint8_t *)conn->body_buffer, HTTP_SENSORS_BUFFER_SIZE,
+                                  &batch_size);
+  if (batch_size > 0U)
+  {
+    response->header      = conn->header_buffer;
+    response->header_size = webserver_http_ws_frame_header((uint8_t *)conn->header_buffer, HTTP_WS_OPCODE_BINARY,
+                                                           batch_size);
+    response->body        = conn->body_buffer;
+    response->body_size   = batch_size;
+    conn->send_offset     = 0U;
+    conn->state           = HTTP_CONN_SENDING;
+    conn->last_activity   = HAL_GetTick();
+  }
+
+  return true;
+}
+
+/**
+  * @brief  Answer a control frame received on a WebSocket connection: pong for a ping, close for a close.
+  *         Data frames and pongs are ignored.
+  * @param  conn  : connection
+  * @param  frame : received frame, still in the receive buffer
+  * @retval true if the answer is being sent and the frame consumed, false otherwise
+  */
+static bool http_conn_websocket_reply(http_conn_t *conn, const http_ws_frame_t *frame)
+{
+  http_response_t *response = &conn->response;
+  uint32_t        header_size;
+
+  if ((frame->opcode != HTTP_WS_OPCODE_PING) && (frame->opcode != HTTP_WS_OPCODE_CLOSE))
+  {
+    return false;
+  }
+
+  /* Answer with the same payload, the status code for a close, in the header buffer. A batch being built
+     in the body buffer is kept. */
+  header_size = webserver_http_ws_frame_header((uint8_t *)conn->header_buffer,
+                                               (frame->opcode == HTTP_WS_OPCODE_PING) ?
+                                               HTTP_WS_OPCODE_PONG : HTTP_WS_OPCODE_CLOSE,
+                                               frame->payload_size);
+  memcpy(&conn->header_buffer[header_size], frame->payload, frame->payload_size);
+
+  response->header      = conn->header_buffer;
+  response->header_size = header_size + frame->payload_size;
+  response->body_size   = 0U;
+
+  /* The closing handshake ends the stream, and the connection once the answer is sent */
+  if (frame->opcode == HTTP_WS_OPCODE_CLOSE)
+  {
+    response->stream.type = HTTP_STREAM_NONE;
+    conn->keep_alive      = false;
+  }
+
+  conn->recv_length -= frame->frame_size;
+  memmove(conn->recv_buffer, &conn->recv_buffer[frame->frame_size], conn->recv_length);
+
+  conn->send_offset   = 0U;
+  conn->state         = HTTP_CONN_SENDING;
+  conn->last_activity = HAL_GetTick();
+
+  return true;
+}
+
+/**
+  * @brief  Close a connection and release its slot
+  * @param  conn : connection
+  * @retval None
+  */
+static void http_conn_close(http_conn_t *conn)
+{
+  if (net_closesocket(conn->socket) != 0)
+  {
+    printf("*** Fail : Socket not closed !!!! \r\n");
+  }
+
+  /* A request still being answered is dropped */
+  if (conn->timing != HTTP_CONN_TIMING_NONE)
+  {
+    webserver_http_metrics_request(conn->response.metric, conn->request_start, true);
+  }
+  webserver_http_metrics_count(HTTP_METRICS_CLOSED, 1U);
+
+  if (conn->motion)
+  {
+    webserver_sensors_motion_unsubscribe();
+    conn->motion = false;
+  }
+
+  conn->state = HTTP_CONN_FREE;
+}
@@ -0,0 +1,33 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_conn.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_conn.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_CONN_H
+#define WEBSERVER_HTTP_CONN_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "webserver_status.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+WebServer_StatusTypeDef webserver_http_conn_serve(int32_t listen_socket);
+
+#endif /* WEBSERVER_HTTP_CONN_H */
@@ -18,341 +18,637 @@
 
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver_http_encoder.h"
+#include "webserver_http_routes.h"
 
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
 /* Private define ----------------------------------------------------------------------------------------------------*/
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void http_encode_connection(char *response, bool keep_alive);
+static WebServer_StatusTypeDef http_encode_reopen(char *response);
+
 /* Private functions -------------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Append the connection header to a response.
+  * @param  response   : Pointer to response buffer.
+  * @param  keep_alive : Keep the connection open after the response.
+  * @retval None.
+  */
+static void http_encode_connection(char *response, bool keep_alive)
+{
+  if (keep_alive)
+  {
+    /* Add http keep-alive connection header */
+    strcat(response, http_headers[HTTP_HEADER_CONNECTION_ALIVE]);
+  }
+  else
+  {
+    /* Add http close connection header */
+    strcat(response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  }
+}
+
+/**
+  * @brief  Remove the end of headers of an encoded response, so that headers can be appended to it.
+  * @param  response : Pointer to a complete response header, end of headers included.
+  * @retval Web Server status.
+  */
+static WebServer_StatusTypeDef http_encode_reopen(char *response)
+{
+  uint32_t response_size = strlen(response);
+
+  if ((response_size < 4U) || (strcmp(&response[response_size - 4U], "\r\n\r\n") != 0))
+  {
+    return HTTP_ERROR;
+  }
+  response[response_size - 2U] = '\0';
+
+  return WEBSERVER_OK;
+}
+
 /* Functions prototypes ----------------------------------------------------------------------------------------------*/
 
 /**
-  * @brief  Encode html response.
-  * @param  html_response : Pointer to html response buffer.
-  * @param  html_size     : html body size.
+  * @brief  Encode web page asset response.
+  * @param  asset_response : Pointer to asset response buffer.
+  * @param  content_type   : Asset media type.
+  * @param  asset_size     : asset body size.
+  * @param  keep_alive     : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_html_response(char *html_response,
-                                                            int html_size)
+WebServer_StatusTypeDef webserver_http_encode_asset_response(char *asset_response,
+                                                             const char *content_type,
+                                                             int asset_size,
+                                                             bool keep_alive)
 {
   char body_length[20] = {0};
 
   /* Clear response buffer from any previous data */
-  memset(html_response, 0, strlen((char *)html_response));
+  memset(asset_response, 0, strlen((char *)asset_response));
 
   /* Add http accept header */
-  strcpy(html_response, http_headers[HTTP_HEADER_ACCEPT]);
+  strcpy(asset_response, http_headers[HTTP_HEADER_ACCEPT]);
 
   /* Add http server header */
-  strcat(html_response, http_headers[HTTP_HEADER_SERVER]);
+  strcat(asset_response, http_headers[HTTP_HEADER_SERVER]);
 
   /* Add http control headers */
-  strcat(html_response, http_headers[HTTP_HEADER_CONTROL_ORIGIN]);
-  strcat(html_response, http_headers[HTTP_HEADER_CONTROL_METHODS]);
-  strcat(html_response, http_headers[HTTP_HEADER_CONTROL_HEADERS]);
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTROL_ORIGIN]);
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTROL_METHODS]);
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTROL_HEADERS]);
 
   /* Add http content type header */
-  strcat(html_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(html_response, http_content_types[HTTP_HEADER_CONTENT_HTML]);
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(asset_response, content_type);
+  strcat(asset_response, "\r\n");
 
   /* Add http content range header */
-  strcat(html_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
 
   /* Add http content length header */
-  strcat(html_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", html_size);
-  strcat(html_response, body_length);
-  strcat(html_response, "\r\n");
+  strcat(asset_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  sprintf(body_length, "%d", asset_size);
+  strcat(asset_response, body_length);
+  strcat(asset_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(html_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(asset_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(html_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(asset_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode css response.
-  * @param  css_response : Pointer to css response buffer.
-  * @param  css_size     : css body size.
+  * @brief  Encode sensor response.
+  * @param  sensor_response : Pointer to sensor response buffer.
+  * @param  sensor_size     : sensor body size.
+  * @param  keep_alive      : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_css_response(char *css_response,
-                                                           int css_size)
+WebServer_StatusTypeDef webserver_http_encode_sensor_response(char *sensor_response,
+                                                              int sensor_size,
+                                                              bool keep_alive)
 {
   char body_length[20] = {0};
 
-  /* Clear response buffer from any previous data */
-  memset(css_response, 0, strlen((char *)css_response));
+  /* Clear response buffer from any previous response */
+  memset(sensor_response, 0, strlen(sensor_response));
 
   /* Add http accept header */
-  strcpy(css_response, http_headers[HTTP_HEADER_ACCEPT]);
-
-  /* Add http server header */
-  strcat(css_response, http_headers[HTTP_HEADER_SERVER]);
+  strcpy(sensor_response, http_headers[HTTP_HEADER_ACCEPT]);
 
   /* Add http content type header */
-  strcat(css_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(css_response, http_content_types[HTTP_HEADER_CONTENT_CSS]);
+  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
 
   /* Add http content range header */
-  strcat(css_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
 
   /* Add http content length header */
-  strcat(css_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", css_size);
-  strcat(css_response, body_length);
-  strcat(css_response, "\r\n");
+  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  sprintf(body_length, "%d", sensor_size);
+  strcat(sensor_response, body_length);
+  strcat(sensor_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(css_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(sensor_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(css_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(sensor_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode js response.
-  * @param  js_response : Pointer to js response buffer.
-  * @param  js_size     : js body size.
+  * @brief  Encode json response.
+  * @param  json_response : Pointer to json response buffer.
+  * @param  json_size     : json body size.
+  * @param  keep_alive    : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_js_response(char *js_response,
-                                                          int js_size)
+WebServer_StatusTypeDef webserver_http_encode_json_response(char *json_response,
+                                                            int json_size,
+                                                            bool keep_alive)
 {
   char body_length[20] = {0};
 
-  /* Clear response buffer from any previous data */
-  memset(js_response, 0, strlen((char *)js_response));
+  /* Clear response buffer from any previous response */
+  memset(json_response, 0, strlen(json_response));
 
   /* Add http accept header */
-  strcpy(js_response, http_headers[HTTP_HEADER_ACCEPT]);
-
-  /* Add http server header */
-  strcat(js_response, http_headers[HTTP_HEADER_SERVER]);
+  strcpy(json_response, http_headers[HTTP_HEADER_ACCEPT]);
 
   /* Add http content type header */
-  strcat(js_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(js_response, http_content_types[HTTP_HEADER_CONTENT_JS]);
+  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(json_response, http_content_types[HTTP_HEADER_CONTENT_JSON]);
 
   /* Add http content range header */
-  strcat(js_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
 
   /* Add http content length header */
-  strcat(js_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", js_size);
-  strcat(js_response, body_length);
-  strcat(js_response, "\r\n");
+  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  sprintf(body_length, "%d", json_size);
+  strcat(json_response, body_length);
+  strcat(json_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(js_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(json_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(js_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(json_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode favicon response.
-  * @param  favicon_response : Pointer to favicon response buffer.
-  * @param  favicon_size     : favicon body size.
+  * @brief  Encode metrics response.
+  * @param  metrics_response : Pointer to metrics response buffer.
+  * @param  metrics_size     : metrics body size.
+  * @param  keep_alive       : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_favicon_response(char *favicon_response,
-                                                               int favicon_size)
+WebServer_StatusTypeDef webserver_http_encode_metrics_response(char *metrics_response,
+                                                               int metrics_size,
+                                                               bool keep_alive)
 {
   char body_length[20] = {0};
 
-  /* Clear response buffer from any previous data */
-  memset(favicon_response, 0, strlen((char *)favicon_response));
+  /* Clear response buffer from any previous response */
+  memset(metrics_response, 0, strlen(metrics_response));
 
   /* Add http accept header */
-  strcpy(favicon_response, http_headers[HTTP_HEADER_ACCEPT]);
-
-  /* Add http server header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_SERVER]);
-
-  /* Add http cache control header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
+  strcpy(metrics_response, http_headers[HTTP_HEADER_ACCEPT]);
 
   /* Add http content type header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(favicon_response, http_content_types[HTTP_HEADER_CONTENT_FAVICON]);
+  strcat(metrics_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(metrics_response, http_content_types[HTTP_HEADER_CONTENT_METRICS]);
 
-  /* Add http content range header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  /* Add http cache control header, metrics are never served from a cache */
+  strcat(metrics_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
 
   /* Add http content length header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", favicon_size);
-  strcat(favicon_response, body_length);
-  strcat(favicon_response, "\r\n");
+  strcat(metrics_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  sprintf(body_length, "%d", metrics_size);
+  strcat(metrics_response, body_length);
+  strcat(metrics_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(favicon_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(metrics_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(favicon_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(metrics_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode sensor response.
-  * @param  sensor_response : Pointer to sensor response buffer.
-  * @param  sensor_size     : sensor body size.
+  * @brief  Encode not found response.
+  * @param  notfound_response : Pointer to not found response buffer.
+  * @param  notfound_size     : not found body size.
+  * @param  keep_alive        : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_sensor_response(char *sensor_response,
-                                                              int sensor_size)
+WebServer_StatusTypeDef webserver_http_encode_notfound_response(char *notfound_response,
+                                                                int notfound_size,
+                                                                bool keep_alive)
 {
   char body_length[20] = {0};
 
   /* Clear response buffer from any previous response */
-  memset(sensor_response, 0, strlen(sensor_response));
+  memset(notfound_response, 0, strlen(notfound_response));
 
-  /* Add http accept header */
-  strcpy(sensor_response, http_headers[HTTP_HEADER_ACCEPT]);
-
-  /* Add http content type header */
-  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  /* Add http file not found header */
+  strcpy(notfound_response, http_headers[HTTP_HEADER_FILE_NOTFOUND]);
 
-  /* Add http content range header */
-  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  /* Add http server header */
+  strcat(notfound_response, http_headers[HTTP_HEADER_SERVER]);
 
   /* Add http content length header */
-  strcat(sensor_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", sensor_size);
-  strcat(sensor_response, body_length);
-  strcat(sensor_response, "\r\n");
+  strcat(notfound_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  sprintf(body_length, "%d", notfound_size);
+  strcat(notfound_response, body_length);
+  strcat(notfound_response, "\r\n");
 
-  /* Add http close connection header */
-  strcat(sensor_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(notfound_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(sensor_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(notfound_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode woff2 response.
-  * @param  woff2_response : Pointer to sensor response buffer.
-  * @param  woff2_size     : sensor body size.
+  * @brief  Encode server-sent events stream response.
+  *         The stream has no length, it lasts until the connection is closed.
+  * @param  events_response : Pointer to events stream response buffer.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_woff2_response(char *woff2_response,
-                                                             int woff2_size)
+WebServer_StatusTypeDef webserver_http_encode_events_response(char *events_response)
 {
-  char body_length[20] = {0};
-
   /* Clear response buffer from any previous response */
-  memset(woff2_response, 0, strlen(woff2_response));
+  memset(events_response, 0, strlen(events_response));
 
   /* Add http accept header */
-  strcpy(woff2_response, http_headers[HTTP_HEADER_ACCEPT]);
+  strcpy(events_response, http_headers[HTTP_HEADER_ACCEPT]);
+
+  /* Add http server header */
+  strcat(events_response, http_headers[HTTP_HEADER_SERVER]);
+
+  /* Add http control headers */
+  strcat(events_response, http_headers[HTTP_HEADER_CONTROL_ORIGIN]);
+  strcat(events_response, http_headers[HTTP_HEADER_CONTROL_METHODS]);
+  strcat(events_response, http_headers[HTTP_HEADER_CONTROL_HEADERS]);
 
   /* Add http content type header */
-  strcat(woff2_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(events_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
+  strcat(events_response, http_content_types[HTTP_HEADER_CONTENT_EVENTS]);
 
-  /* Add http content range header */
-  strcat(woff2_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  /* Add http cache control header, events are never cached */
+  strcat(events_response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
 
-  /* Add http content length header */
-  strcat(woff2_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", woff2_size);
-  strcat(woff2_response, body_length);
-  strcat(woff2_response, "\r\n");
+  /* Add http keep-alive connection header */
+  http_encode_connection(events_response, true);
+
+  /* Add http end of headers */
+  strcat(events_response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Encode WebSocket opening handshake response.
+  * @param  switching_response : Pointer to switching protocols response buffer.
+  * @param  accept             : Sec-WebSocket-Accept header field value.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_switching_response(char *switching_response,
+                                                                 const char *accept)
+{
+  /* Clear response buffer from any previous response */
+  memset(switching_response, 0, strlen(switching_response));
+
+  /* Add http switching protocols header */
+  strcpy(switching_response, http_headers[HTTP_HEADER_SWITCHING]);
+
+  /* Add http server header */
+  strcat(switching_response, http_headers[HTTP_HEADER_SERVER]);
+
+  /* Add http upgrade headers */
+  strcat(switching_response, http_headers[HTTP_HEADER_UPGRADE_WS]);
+  strcat(switching_response, http_headers[HTTP_HEADER_CONNECTION_UPG]);
 
-  /* Add http close connection header */
-  strcat(woff2_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http WebSocket accept header */
+  strcat(switching_response, http_headers[HTTP_HEADER_WS_ACCEPT]);
+  strcat(switching_response, accept);
+  strcat(switching_response, "\r\n");
 
   /* Add http end of headers */
-  strcat(woff2_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(switching_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode json response.
-  * @param  json_response : Pointer to json response buffer.
-  * @param  json_size     : json body size.
+  * @brief  Encode bad request response, without body.
+  *         It lists the supported WebSocket version, it answers the opening handshakes the server rejects.
+  * @param  badrequest_response : Pointer to bad request response buffer.
+  * @param  keep_alive          : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_json_response(char *json_response,
-                                                            int json_size)
+WebServer_StatusTypeDef webserver_http_encode_badrequest_response(char *badrequest_response,
+                                                                  bool keep_alive)
 {
-  char body_length[20] = {0};
+  /* Clear response buffer from any previous response */
+  memset(badrequest_response, 0, strlen(badrequest_response));
+
+  /* Add http bad request header */
+  strcpy(badrequest_response, http_headers[HTTP_HEADER_BAD_REQUEST]);
+
+  /* Add http server header */
+  strcat(badrequest_response, http_headers[HTTP_HEADER_SERVER]);
+
+  /* Add http WebSocket version header */
+  strcat(badrequest_response, http_headers[HTTP_HEADER_WS_VERSION]);
+
+  /* Add http content length header */
+  strcat(badrequest_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  strcat(badrequest_response, "0\r\n");
+
+  /* Add http connection header */
+  http_encode_connection(badrequest_response, keep_alive);
 
+  /* Add http end of headers */
+  strcat(badrequest_response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Encode error response, without body, of a request the server does not answer.
+  *         A not implemented response lists the methods the server does implement.
+  * @param  error_response : Pointer to error response buffer.
+  * @param  status         : Status line, one of HTTP_HEADER_BAD_REQUEST, HTTP_HEADER_URI_TOO_LONG,
+  *                          HTTP_HEADER_FIELDS_TOO_LARGE or HTTP_HEADER_NOT_IMPLEMENTED.
+  * @param  keep_alive     : Keep the connection open after the response.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_error_response(char *error_response,
+                                                             uint32_t status,
+                                                             bool keep_alive)
+{
   /* Clear response buffer from any previous response */
-  memset(json_response, 0, strlen(json_response));
+  memset(error_response, 0, strlen(error_response));
 
-  /* Add http accept header */
-  strcpy(json_response, http_headers[HTTP_HEADER_ACCEPT]);
+  /* Add http error status header */
+  strcpy(error_response, http_headers[status]);
 
-  /* Add http content type header */
-  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(json_response, http_content_types[HTTP_HEADER_CONTENT_JSON]);
+  /* Add http server header */
+  strcat(error_response, http_headers[HTTP_HEADER_SERVER]);
 
-  /* Add http content range header */
-  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  /* Add http allowed methods header */
+  if (status == HTTP_HEADER_NOT_IMPLEMENTED)
+  {
+    strcat(error_response, http_headers[HTTP_HEADER_ALLOW]);
+  }
 
   /* Add http content length header */
-  strcat(json_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", json_size);
-  strcat(json_response, body_length);
-  strcat(json_response, "\r\n");
+  strcat(error_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  strcat(error_response, "0\r\n");
 
-  /* Add http close connection header */
-  strcat(json_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+  /* Add http connection header */
+  http_encode_connection(error_response, keep_alive);
 
   /* Add http end of headers */
-  strcat(json_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(error_response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
 
 /**
-  * @brief  Encode image response.
-  * @param  image_response : Pointer to image response buffer.
-  * @param  image_size     : image body size.
+  * @brief  Encode not modified response.
+  * @param  notmodified_response : Pointer to not modified response buffer.
+  * @param  keep_alive           : Keep the connection open after the response.
   * @retval Web Server status.
   */
-WebServer_StatusTypeDef webserver_http_encode_image_response(char *image_response,
-                                                             int image_size)
+WebServer_StatusTypeDef webserver_http_encode_notmodified_response(char *notmodified_response,
+                                                                   bool keep_alive)
 {
-  char body_length[20] = {0};
+  /* Clear response buffer from any previous response */
+  memset(notmodified_response, 0, strlen(notmodified_response));
+
+  /* Add http not modified header */
+  strcpy(notmodified_response, http_headers[HTTP_HEADER_NOT_MODIFIED]);
+
+  /* Add http server header */
+  strcat(notmodified_response, http_headers[HTTP_HEADER_SERVER]);
+
+  /* Add http connection header */
+  http_encode_connection(notmodified_response, keep_alive);
+
+  /* Add http end of headers */
+  strcat(notmodified_response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Encode range not satisfiable response.
+  * @param  rangeinvalid_response : Pointer to range not satisfiable response buffer.
+  * @param  resource_size         : Size of the requested resource.
+  * @param  keep_alive            : Keep the connection open after the response.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_rangeinvalid_response(char *rangeinvalid_response,
+                                                                    uint32_t resource_size,
+                                                                    bool keep_alive)
+{
+  char range[24] = {0};
 
   /* Clear response buffer from any previous response */
-  memset(image_response, 0, strlen(image_response));
+  memset(rangeinvalid_response, 0, strlen(rangeinvalid_response));
 
-  /* Add http accept header */
-  strcpy(image_response, http_headers[HTTP_HEADER_ACCEPT]);
+  /* Add http range not satisfiable header */
+  strcpy(rangeinvalid_response, http_headers[HTTP_HEADER_RANGE_INVALID]);
 
-  /* Add http content type header */
-  strcat(image_response, http_headers[HTTP_HEADER_CONTENT_TYPE]);
-  strcat(image_response, http_content_types[HTTP_HEADER_CONTENT_IMAGE]);
+  /* Add http server header */
+  strcat(rangeinvalid_response, http_headers[HTTP_HEADER_SERVER]);
 
-  /* Add http content range header */
-  strcat(image_response, http_headers[HTTP_HEADER_CONTENT_RANGE]);
+  /* Add http content range header, giving the resource size */
+  strcat(rangeinvalid_response, http_headers[HTTP_HEADER_BYTES_RANGE]);
+  sprintf(range, "*/%lu\r\n", (unsigned long)resource_size);
+  strcat(rangeinvalid_response, range);
 
   /* Add http content length header */
-  strcat(image_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
-  sprintf(body_length, "%d", image_size);
-  strcat(image_response, body_length);
-  strcat(image_response, "\r\n");
+  strcat(rangeinvalid_response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  strcat(rangeinvalid_response, "0\r\n");
+
+  /* Add http connection header */
+  http_encode_connection(rangeinvalid_response, keep_alive);
+
+  /* Add http end of headers */
+  strcat(rangeinvalid_response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Turn an encoded 200 response into a partial content one.
+  * @param  response      : Pointer to a complete 200 response header, end of headers included,
+  *                         its content length being the range length.
+  * @param  first         : First byte of the range.
+  * @param  last          : Last byte of the range, included.
+  * @param  resource_size : Size of the whole resource.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_partial_content(char *response,
+                                                              uint32_t first,
+                                                              uint32_t last,
+                                                              uint32_t resource_size)
+{
+  uint32_t ok_size      = strlen(http_headers[HTTP_HEADER_ACCEPT]);
+  uint32_t partial_size = strlen(http_headers[HTTP_HEADER_PARTIAL_CONTENT]);
+  char range[40] = {0};
+
+  /* Replace http status line */
+  if (strncmp(response, http_headers[HTTP_HEADER_ACCEPT], ok_size) != 0)
+  {
+    return HTTP_ERROR;
+  }
+  memmove(&response[partial_size], &response[ok_size], strlen(response) - ok_size + 1U);
+  memcpy(response, http_headers[HTTP_HEADER_PARTIAL_CONTENT], partial_size);
+
+  /* Remove http end of headers */
+  if (http_encode_reopen(response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* Add http content range header */
+  strcat(response, http_headers[HTTP_HEADER_BYTES_RANGE]);
+  sprintf(range, "%lu-%lu/%lu\r\n", (unsigned long)first, (unsigned long)last, (unsigned long)resource_size);
+  strcat(response, range);
+
+  /* Add http end of headers */
+  strcat(response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
 
-  /* Add http close connection header */
-  strcat(image_response, http_headers[HTTP_HEADER_CONNECTION_CLOSE]);
+/**
+  * @brief  Turn an encoded response into one whose body length is not known up front.
+  * @param  response : Pointer to a complete response header, end of headers included.
+  * @param  chunked  : Body sent with the chunked transfer coding, otherwise it lasts until the connection
+  *                    is closed.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_transfer_chunked(char *response,
+                                                               bool chunked)
+{
+  char *length = strstr(response, http_headers[HTTP_HEADER_CONTENT_LENGTH]);
+  char *length_end;
+
+  /* Remove http content length header */
+  if (length == NULL)
+  {
+    return HTTP_ERROR;
+  }
+  length_end = strstr(length, "\r\n");
+  if (length_end == NULL)
+  {
+    return HTTP_ERROR;
+  }
+  memmove(length, &length_end[2], strlen(&length_end[2]) + 1U);
+
+  if (chunked)
+  {
+    /* Remove http end of headers */
+    if (http_encode_reopen(response) != WEBSERVER_OK)
+    {
+      return HTTP_ERROR;
+    }
+
+    /* Add http transfer encoding header */
+    strcat(response, http_headers[HTTP_HEADER_CHUNKED]);
+
+    /* Add http end of headers */
+    strcat(response, http_headers[HTTP_HEADER_HEADERS_END]);
+  }
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Add the content negotiation headers to an encoded response.
+  * @param  response : Pointer to a complete response header, end of headers included.
+  * @param  coding   : Content coding of the body, 0 for identity.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_content_coding(char *response,
+                                                             uint32_t coding)
+{
+  /* Remove http end of headers */
+  if (http_encode_reopen(response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* Add http vary header, caches must key the response on the accepted codings */
+  strcat(response, http_headers[HTTP_HEADER_VARY_ENCODING]);
+
+  /* Add http content encoding header */
+  if (coding != 0U)
+  {
+    strcat(response, http_headers[HTTP_HEADER_CONTENT_ENCODING]);
+    strcat(response, http_content_codings[coding]);
+  }
+
+  /* Add http end of headers */
+  strcat(response, http_headers[HTTP_HEADER_HEADERS_END]);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Add the cache headers to an encoded response.
+  * @param  response     : Pointer to a complete response header, end of headers included.
+  * @param  cache_policy : Response cache policy, one of HTTP_CACHE_xxx.
+  * @param  etag         : Quoted entity tag of the body, NULL if none.
+  * @retval Web Server status.
+  */
+WebServer_StatusTypeDef webserver_http_encode_cache_headers(char *response,
+                                                            uint32_t cache_policy,
+                                                            const char *etag)
+{
+  /* Remove http end of headers */
+  if (http_encode_reopen(response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* Add http cache control header */
+  if (cache_policy == HTTP_CACHE_NO_CACHE)
+  {
+    strcat(response, http_headers[HTTP_HEADER_CACHE_CONTROL]);
+  }
+  else if (cache_policy == HTTP_CACHE_MAX_AGE)
+  {
+    strcat(response, http_headers[HTTP_HEADER_CACHE_MAX_AGE]);
+  }
+
+  /* Add http entity tag header */
+  if (etag != NULL)
+  {
+    strcat(response, http_headers[HTTP_HEADER_ETAG]);
+    strcat(response, etag);
+    strcat(response, "\r\n");
+  }
 
   /* Add http end of headers */
-  strcat(image_response, http_headers[HTTP_HEADER_HEADERS_END]);
+  strcat(response, http_headers[HTTP_HEADER_HEADERS_END]);
 
   return WEBSERVER_OK;
 }
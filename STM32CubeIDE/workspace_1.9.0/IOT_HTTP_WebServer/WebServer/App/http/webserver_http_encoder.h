@@ -28,21 +28,45 @@
 /* Exported constants ------------------------------------------------------------------------------------------------*/
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
-WebServer_StatusTypeDef webserver_http_encode_html_response(char *html_response,
-                                                            int html_size);
-WebServer_StatusTypeDef webserver_http_encode_css_response(char *css_response,
-                                                           int css_size);
-WebServer_StatusTypeDef webserver_http_encode_js_response(char *js_response,
-                                                          int js_size);
-WebServer_StatusTypeDef webserver_http_encode_favicon_response(char *favicon_response,
-                                                               int favicon_size);
+WebServer_StatusTypeDef webserver_http_encode_asset_response(char *asset_response,
+                                                             const char *content_type,
+                                                             int asset_size,
+                                                             bool keep_alive);
 WebServer_StatusTypeDef webserver_http_encode_sensor_response(char *sensor_response,
-                                                              int sensor_size);
-WebServer_StatusTypeDef webserver_http_encode_woff2_response(char *woff2_response,
-                                                             int woff2_size);
+                                                              int sensor_size,
+                                                              bool keep_alive);
 WebServer_StatusTypeDef webserver_http_encode_json_response(char *json_response,
-                                                            int json_size);
-WebServer_StatusTypeDef webserver_http_encode_image_response(char *image_response,
-                                                             int image_size);
+                                                            int json_size,
+                                                            bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_metrics_response(char *metrics_response,
+                                                               int metrics_size,
+                                                               bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_notfound_response(char *notfound_response,
+                                                                int notfound_size,
+                                                                bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_events_response(char *events_response);
+WebServer_StatusTypeDef webserver_http_encode_switching_response(char *switching_response,
+                                                                 const char *accept);
+WebServer_StatusTypeDef webserver_http_encode_badrequest_response(char *badrequest_response,
+                                                                  bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_error_response(char *error_response,
+                                                             uint32_t status,
+                                                             bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_notmodified_response(char *notmodified_response,
+                                                                   bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_rangeinvalid_response(char *rangeinvalid_response,
+                                                                    uint32_t resource_size,
+                                                                    bool keep_alive);
+WebServer_StatusTypeDef webserver_http_encode_partial_content(char *response,
+                                                              uint32_t first,
+                                                              uint32_t last,
+                                                              uint32_t resource_size);
+WebServer_StatusTypeDef webserver_http_encode_transfer_chunked(char *response,
+                                                               bool chunked);
+WebServer_StatusTypeDef webserver_http_encode_content_coding(char *response,
+                                                             uint32_t coding);
+WebServer_StatusTypeDef webserver_http_encode_cache_headers(char *response,
+                                                            uint32_t cache_policy,
+                                                            const char *etag);
 
 #endif /* WEBSERVER_HTTP_ENCODER_H */
@@ -0,0 +1,411 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_float.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server float formatting of sensor values.
+  *          A value is written with the fewest decimal digits that read back as the same float (Ryu
+  *          algorithm, U. Adams, PLDI 2018), using 32 and 64 bits integer arithmetic only: no printf float
+  *          support, no heap, no floating point operation. Values from 1e-4 up to, but not including, 1e9 are
+  *          written in decimal notation (23.5, 0.001), other ones in scientific notation (1.5e-07, 1e+09), as
+  *          JSON numbers.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_float.h"
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* IEEE 754 single precision layout */
+#define HTTP_FLOAT_MANTISSA_BITS     (23U)
+#define HTTP_FLOAT_EXPONENT_MASK     (0xFFU)
+#define HTTP_FLOAT_BIAS              (127)
+
+/* Significant bits of the powers of 5 tables */
+#define HTTP_FLOAT_POW5_INV_BITS     (59)
+#define HTTP_FLOAT_POW5_BITS         (61)
+#define HTTP_FLOAT_POW5_INV_NBR      (31U)
+
+/* Decimal notation range, as the position of the decimal point from the first digit */
+#define HTTP_FLOAT_POINT_MIN         (-3)       /* 0.000123                                           */
+#define HTTP_FLOAT_POINT_MAX         (9)        /* 123456789                                          */
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Bits of 5^e, e > 0, and 1 for e = 0 */
+#define HTTP_FLOAT_POW5_BITS_OF(e)   ((int32_t)((((uint32_t)(e)) * 1217359U) >> 19) + 1)
+
+/* floor(log10(2^e)) and floor(log10(5^e)), e >= 0 */
+#define HTTP_FLOAT_LOG10_POW2(e)     ((int32_t)((((uint32_t)(e)) * 78913U) >> 18))
+#define HTTP_FLOAT_LOG10_POW5(e)     ((int32_t)((((uint32_t)(e)) * 732923U) >> 20))
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* floor(2^(bits(5^i) - 1 + HTTP_FLOAT_POW5_INV_BITS) / 5^i) + 1 */
+static const uint64_t http_float_pow5_inv[HTTP_FLOAT_POW5_INV_NBR] =
+{
+  576460752303423489ULL, 461168601842738791ULL, 368934881474191033ULL, 295147905179352826ULL,
+  472236648286964522ULL, 377789318629571618ULL, 302231454903657294ULL, 483570327845851670ULL,
+  386856262276681336ULL, 309485009821345069ULL, 495176015714152110ULL, 396140812571321688ULL,
+  316912650057057351ULL, 507060240091291761ULL, 405648192073033409ULL, 324518553658426727ULL,
+  519229685853482763ULL, 415383748682786211ULL, 332306998946228969ULL, 531691198313966350ULL,
+  425352958651173080ULL, 340282366920938464ULL, 544451787073501542ULL, 435561429658801234ULL,
+  348449143727040987ULL, 557518629963265579ULL, 446014903970612463ULL, 356811923176489971ULL,
+  570899077082383953ULL, 456719261665907162ULL, 365375409332725730ULL
+};
+
+/* 5^i, on HTTP_FLOAT_POW5_BITS bits */
+static const uint64_t http_float_pow5[] =
+{
+  1152921504606846976ULL, 1441151880758558720ULL, 1801439850948198400ULL, 2251799813685248000ULL,
+  1407374883553280000ULL, 1759218604441600000ULL, 2199023255552000000ULL, 1374389534720000000ULL,
+  1717986918400000000ULL, 2147483648000000000ULL, 1342177280000000000ULL, 1677721600000000000ULL,
+  2097152000000000000ULL, 1310720000000000000ULL, 1638400000000000000ULL, 2048000000000000000ULL,
+  1280000000000000000ULL, 1600000000000000000ULL, 2000000000000000000ULL, 1250000000000000000ULL,
+  1562500000000000000ULL, 1953125000000000000ULL, 1220703125000000000ULL, 1525878906250000000ULL,
+  1907348632812500000ULL, 1192092895507812500ULL, 1490116119384765625ULL, 1862645149230957031ULL,
+  1164153218269348144ULL, 1455191522836685180ULL, 1818989403545856475ULL, 2273736754432320594ULL,
+  1421085471520200371ULL, 1776356839400250464ULL, 2220446049250313080ULL, 1387778780781445675ULL,
+  1734723475976807094ULL, 2168404344971008868ULL, 1355252715606880542ULL, 1694065894508600678ULL,
+  2117582368135750847ULL, 1323488980084844279ULL, 1654361225106055349ULL, 2067951531382569187ULL,
+  1292469707114105741ULL, 1615587133892632177ULL, 2019483917365790221ULL
+};
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t http_float_shortest(uint32_t ieee_mantissa, uint32_t ieee_exponent, int32_t *exponent);
+static uint32_t http_float_mul_shift(uint32_t m, uint64_t factor, int32_t shift);
+static bool http_float_pow5_multiple(uint32_t value, uint32_t p);
+static uint32_t http_float_digits(uint32_t value);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Write a float with the fewest digits that read back as the same value
+  * @param  value  : value
+  * @param  buffer : text buffer of HTTP_FLOAT_SIZE bytes, null terminated
+  * @retval Text length
+  */
+uint32_t webserver_http_float_format(float value, char *buffer)
+{
+  uint32_t bits;
+  uint32_t ieee_mantissa;
+  uint32_t ieee_exponent;
+  uint32_t digits;
+  uint32_t digits_nbr;
+  int32_t  exponent;
+  int32_t  point;
+  uint32_t length = 0U;
+  char     text[10] = {0};
+
+  memcpy(&bits, &value, sizeof(bits));
+  ieee_mantissa = bits & ((1UL << HTTP_FLOAT_MANTISSA_BITS) - 1U);
+  ieee_exponent = (bits >> HTTP_FLOAT_MANTISSA_BITS) & HTTP_FLOAT_EXPONENT_MASK;
+
+  if ((bits >> 31) != 0U)
+  {
+    buffer[length++] = '-';
+  }
+
+  /* Same texts as printf for the special values */
+  if (ieee_exponent == HTTP_FLOAT_EXPONENT_MASK)
+  {
+    strcpy(&buffer[length], (ieee_mantissa != 0U) ? "nan" : "inf");
+    return length + 3U;
+  }
+  if ((ieee_exponent == 0U) && (ieee_mantissa == 0U))
+  {
+    strcpy(&buffer[length], "0");
+    return length + 1U;
+  }
+
+  /* Shortest digits, value is digits * 10^exponent */
+  digits     = http_float_shortest(ieee_mantissa, ieee_exponent, &exponent);
+  digits_nbr = http_float_digits(digits);
+  for (uint32_t i = digits_nbr; i > 0U; i--)
+  {
+    text[i - 1U] = (char)('0' + (digits % 10U));
+    digits /= 10U;
+  }
+
+  /* Position of the decimal point from the first digit */
+  point = (int32_t)digits_nbr + exponent;
+
+  if ((point >= HTTP_FLOAT_POINT_MIN) && (point <= HTTP_FLOAT_POINT_MAX))
+  {
+    if (point <= 0)
+    {
+      /* 0.00ddd */
+      buffer[length++] = '0';
+      buffer[length++] = '.';
+      for (; point < 0; point++)
+      {
+        buffer[length++] = '0';
+      }
+      memcpy(&buffer[length], text, digits_nbr);
+      length += digits_nbr;
+    }
+    else if ((uint32_t)point < digits_nbr)
+    {
+      /* dd.ddd */
+      memcpy(&buffer[length], text, (uint32_t)point);
+      length += (uint32_t)point;
+      buffer[length++] = '.';
+      memcpy(&buffer[length], &text[point], digits_nbr - (uint32_t)point);
+      length += digits_nbr - (uint32_t)point;
+    }
+    else
+    {
+      /* ddd00 */
+      memcpy(&buffer[length], text, digits_nbr);
+      length += digits_nbr;
+      for (; (uint32_t)point > digits_nbr; point--)
+      {
+        buffer[length++] = '0';
+      }
+    }
+  }
+  else
+  {
+    /* d.ddde-XX, two exponent digits at least as printf */
+    buffer[length++] = text[0];
+    if (digits_nbr > 1U)
+    {
+      buffer[length++] = '.';
+      memcpy(&buffer[length], &text[1], digits_nbr - 1U);
+      length += digits_nbr - 1U;
+    }
+    exponent = point - 1;
+    buffer[length++] = 'e';
+    buffer[length++] = (exponent < 0) ? '-' : '+';
+    exponent = (exponent < 0) ? -exponent : exponent;
+    buffer[length++] = (char)('0' + (exponent / 10));
+    buffer[length++] = (char)('0' + (exponent % 10));
+  }
+
+  buffer[length] = '\0';
+
+  return length;
+}
+
+/**
+  * @brief  Shortest decimal digits of a finite non zero float, correctly rounded (Ryu)
+  * @param  ieee_mantissa : float mantissa field
+  * @param  ieee_exponent : float exponent field
+  * @param  exponent      : power of 10 of the last digit (out)
+  * @retval Digits
+  */
+static uint32_t http_float_shortest(uint32_t ieee_mantissa, uint32_t ieee_exponent, int32_t *exponent)
+{
+  int32_t  e2;
+  uint32_t m2;
+  uint32_t mv;
+  uint32_t mp;
+  uint32_t mm;
+  uint32_t mm_shift;
+  uint32_t vr;
+  uint32_t vp;
+  uint32_t vm;
+  int32_t  e10;
+  int32_t  q;
+  int32_t  i;
+  int32_t  k;
+  int32_t  removed = 0;
+  uint32_t last_removed = 0U;
+  bool     accept_bounds;
+  bool     vm_trailing_zeros = false;
+  bool     vr_trailing_zeros = false;
+
+  /* Value is m2 * 2^e2, two more bits to hold the halfway points to the neighbour floats */
+  if (ieee_exponent == 0U)
+  {
+    e2 = 1 - HTTP_FLOAT_BIAS - (int32_t)HTTP_FLOAT_MANTISSA_BITS - 2;
+    m2 = ieee_mantissa;
+  }
+  else
+  {
+    e2 = (int32_t)ieee_exponent - HTTP_FLOAT_BIAS - (int32_t)HTTP_FLOAT_MANTISSA_BITS - 2;
+    m2 = (1UL << HTTP_FLOAT_MANTISSA_BITS) | ieee_mantissa;
+  }
+  accept_bounds = (m2 & 1U) == 0U;
+
+  /* Rounding interval [mm, mp] around mv, the lower gap is half as large at a power of 2 */
+  mv       = 4U * m2;
+  mp       = (4U * m2) + 2U;
+  mm_shift = ((ieee_mantissa != 0U) || (ieee_exponent <= 1U)) ? 1U : 0U;
+  mm       = (4U * m2) - 1U - mm_shift;
+
+  /* Interval bounds in decimal, to 10^e10 */
+  if (e2 >= 0)
+  {
+    q   = HTTP_FLOAT_LOG10_POW2(e2);
+    e10 = q;
+    k   = HTTP_FLOAT_POW5_INV_BITS + HTTP_FLOAT_POW5_BITS_OF(q) - 1;
+    i   = -e2 + q + k;
+    vr  = http_float_mul_shift(mv, http_float_pow5_inv[q], i);
+    vp  = http_float_mul_shift(mp, http_float_pow5_inv[q], i);
+    vm  = http_float_mul_shift(mm, http_float_pow5_inv[q], i);
+    if ((q != 0) && (((vp - 1U) / 10U) <= (vm / 10U)))
+    {
+      /* The digit removed in the loop below is not computed there, the last removed one is needed */
+      k = HTTP_FLOAT_POW5_INV_BITS + HTTP_FLOAT_POW5_BITS_OF(q - 1) - 1;
+      last_removed = http_float_mul_shift(mv, http_float_pow5_inv[q - 1], -e2 + q - 1 + k) % 10U;
+    }
+    if (q <= 9)
+    {
+      /* Only one of mp, mv and mm can be a multiple of 5, if any */
+      if ((mv % 5U) == 0U)
+      {
+        vr_trailing_zeros = http_float_pow5_multiple(mv, (uint32_t)q);
+      }
+      else if (accept_bounds)
+      {
+        vm_trailing_zeros = http_float_pow5_multiple(mm, (uint32_t)q);
+      }
+      else
+      {
+        vp -= http_float_pow5_multiple(mp, (uint32_t)q) ? 1U : 0U;
+      }
+    }
+  }
+  else
+  {
+    q   = HTTP_FLOAT_LOG10_POW5(-e2);
+    e10 = q + e2;
+    i   = -e2 - q;
+    k   = HTTP_FLOAT_POW5_BITS_OF(i) - HTTP_FLOAT_POW5_BITS;
+    vr  = http_float_mul_shift(mv, http_float_pow5[i], q - k);
+    vp  = http_float_mul_shift(mp, http_float_pow5[i], q - k);
+    vm  = http_float_mul_shift(mm, http_float_pow5[i], q - k);
+    if ((q != 0) && (((vp - 1U) / 10U) <= (vm / 10U)))
+    {
+      k = q - 1 - (HTTP_FLOAT_POW5_BITS_OF(i + 1) - HTTP_FLOAT_POW5_BITS);
+      last_removed = http_float_mul_shift(mv, http_float_pow5[i + 1], k) % 10U;
+    }
+    if (q <= 1)
+    {
+      /* mv = 4 * m2 has at least 2 trailing zero bits */
+      vr_trailing_zeros = true;
+      if (accept_bounds)
+      {
+        vm_trailing_zeros = mm_shift == 1U;
+      }
+      else
+      {
+        vp--;
+      }
+    }
+    else if (q < 31)
+    {
+      vr_trailing_zeros = (mv & ((1UL << (q - 1)) - 1U)) == 0U;
+    }
+  }
+
+  /* Remove the digits shared by both bounds, rounding the value correctly */
+  if (vm_trailing_zeros || vr_trailing_zeros)
+  {
+    while ((vp / 10U) > (vm / 10U))
+    {
+      vm_trailing_zeros &= (vm % 10U) == 0U;
+      vr_trailing_zeros &= last_removed == 0U;
+      last_removed = vr % 10U;
+      vr /= 10U;
+      vp /= 10U;
+      vm /= 10U;
+      removed++;
+    }
+    if (vm_trailing_zeros)
+    {
+      while ((vm % 10U) == 0U)
+      {
+        vr_trailing_zeros &= last_removed == 0U;
+        last_removed = vr % 10U;
+        vr /= 10U;
+        vp /= 10U;
+        vm /= 10U;
+        removed++;
+      }
+    }
+    if (vr_trailing_zeros && (last_removed == 5U) && ((vr % 2U) == 0U))
+    {
+      /* Exactly halfway, round to even */
+      last_removed = 4U;
+    }
+    vr += (((vr == vm) && (!accept_bounds || !vm_trailing_zeros)) || (last_removed >= 5U)) ? 1U : 0U;
+  }
+  else
+  {
+    while ((vp / 10U) > (vm / 10U))
+    {
+      last_removed = vr % 10U;
+      vr /= 10U;
+      vp /= 10U;
+      vm /= 10U;
+      removed++;
+    }
+    vr += ((vr == vm) || (last_removed >= 5U)) ? 1U : 0U;
+  }
+
+  *exponent = e10 + removed;
+
+  return vr;
+}
+
+/**
+  * @brief  Multiply by a 64 bits factor and shift right, the result fitting 32 bits
+  * @param  m      : value
+  * @param  factor : factor
+  * @param  shift  : right shift, more than 32
+  * @retval (m * factor) >> shift
+  */
+static uint32_t http_float_mul_shift(uint32_t m, uint64_t factor, int32_t shift)
+{
+  uint64_t low  = (uint64_t)m * (uint32_t)factor;
+  uint64_t high = (uint64_t)m * (uint32_t)(factor >> 32);
+
+  return (uint32_t)(((low >> 32) + high) >> (shift - 32));
+}
+
+/**
+  * @brief  Tell whether a value is a multiple of 5^p
+  * @param  value : value, not 0
+  * @param  p     : power of 5
+  * @retval true if 5^p divides the value
+  */
+static bool http_float_pow5_multiple(uint32_t value, uint32_t p)
+{
+  uint32_t count = 0U;
+
+  while ((value % 5U) == 0U)
+  {
+    value /= 5U;
+    count++;
+  }
+
+  return count >= p;
+}
+
+/**
+  * @brief  Count the decimal digits of a value
+  * @param  value : value, less than 10^9
+  * @retval Digits number
+  */
+static uint32_t http_float_digits(uint32_t value)
+{
+  uint32_t digits_nbr = 1U;
+
+  for (; value >= 10U; value /= 10U)
+  {
+    digits_nbr++;
+  }
+
+  return digits_nbr;
+}
@@ -0,0 +1,36 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_float.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_float.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_FLOAT_H
+#define WEBSERVER_HTTP_FLOAT_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Size of a formatted float, null character included: -1.17549435e-38 */
+#define HTTP_FLOAT_SIZE              (16U)
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+uint32_t webserver_http_float_format(float value, char *buffer);
+
+#endif /* WEBSERVER_HTTP_FLOAT_H */
@@ -0,0 +1,602 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_metrics.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server metrics: per route request counters and latency histograms,
+  *          connection, socket and Wi-Fi module IPC counters, served in the Prometheus text format.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_metrics.h"
+#include "webserver_http_writer.h"
+#include "mx_wifi.h"
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Latency histogram
+  */
+typedef struct
+{
+  uint32_t buckets[HTTP_METRICS_BUCKET_NBR + 1U]; /*!< Observations by bucket, the last one unbounded   */
+  uint64_t sum;                                /*!< Sum of the observations in us                     */
+} http_metrics_histogram_t;
+
+/**
+  * @brief  Metrics of the requests answered by a route, an asset or neither
+  */
+typedef struct
+{
+  uint32_t                 requests;           /*!< Requests answered                                 */
+  uint32_t                 errors;             /*!< Error responses and dropped responses             */
+  uint64_t                 bytes;              /*!< Bytes sent                                        */
+  http_metrics_histogram_t first_byte;         /*!< Request start to first byte sent                  */
+  http_metrics_histogram_t duration;           /*!< Request start to last byte sent                   */
+} http_metrics_route_t;
+
+/**
+  * @brief  Metric family, as served
+  */
+typedef struct
+{
+  const char *name;                            /*!< Metric name                                       */
+  const char *help;                            /*!< Metric description                                */
+  uint32_t   type;                             /*!< One of HTTP_METRICS_TYPE_xxx                      */
+  uint32_t   source;                           /*!< Counter number, or one of HTTP_METRICS_SOURCE_xxx */
+  uint32_t   decimals;                         /*!< Decimals of a value in seconds, 0 for an integer  */
+} http_metrics_family_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Metric types, as named by http_metrics_types[] */
+#define HTTP_METRICS_TYPE_COUNTER    (0U)
+#define HTTP_METRICS_TYPE_GAUGE      (1U)
+#define HTTP_METRICS_TYPE_HISTOGRAM  (2U)
+
+/* Metric values, besides the counters */
+#define HTTP_METRICS_SOURCE_OPEN         (0x10U) /* Connections open                                  */
+#define HTTP_METRICS_SOURCE_UPTIME       (0x11U) /* Time since start up in ms                         */
+#define HTTP_METRICS_SOURCE_IPC_REQUESTS (0x12U) /* Wi-Fi module commands                             */
+#define HTTP_METRICS_SOURCE_IPC_TIMEOUTS (0x13U) /* Wi-Fi module commands not answered                */
+#define HTTP_METRICS_SOURCE_IPC_EVENTS   (0x14U) /* Wi-Fi module events                               */
+#define HTTP_METRICS_SOURCE_IPC_WAIT     (0x15U) /* Time waiting for Wi-Fi module answers in ms       */
+
+/* Metric values by route, from HTTP_METRICS_SOURCE_ROUTE on */
+#define HTTP_METRICS_SOURCE_ROUTE        (0x20U)
+#define HTTP_METRICS_SOURCE_REQUESTS     (0x20U)
+#define HTTP_METRICS_SOURCE_ERRORS       (0x21U)
+#define HTTP_METRICS_SOURCE_BYTES        (0x22U)
+#define HTTP_METRICS_SOURCE_FIRST_BYTE   (0x23U)
+#define HTTP_METRICS_SOURCE_DURATION     (0x24U)
+
+/* Lines of a route histogram: buckets, +Inf bucket, sum and count */
+#define HTTP_METRICS_HISTOGRAM_LINES (HTTP_METRICS_BUCKET_NBR + 3U)
+
+/* Writer cursor: metric family, then line in the family */
+#define HTTP_METRICS_LINE_BITS       (16U)
+#define HTTP_METRICS_LINE_MASK       ((1UL << HTTP_METRICS_LINE_BITS) - 1U)
+
+/* Outcomes of a line write */
+#define HTTP_METRICS_LINE_WRITTEN    (0U)       /* Written, or nothing to write, go on with the next  */
+#define HTTP_METRICS_LINE_FULL       (1U)       /* Does not fit, write it again to the next piece     */
+#define HTTP_METRICS_LINE_END        (2U)       /* No more lines in the family                        */
+
+/* Text of a metric value, 64 bits integer part and decimals */
+#define HTTP_METRICS_NUMBER_SIZE     (32U)
+#define HTTP_METRICS_NUMBER_SPLIT    (1000000000U) /* Integer part printed as 9 digits halves         */
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Metrics by slot */
+static http_metrics_route_t http_metrics_routes[HTTP_METRICS_SLOT_NBR];
+
+/* Connection and socket counters, by HTTP_METRICS_xxx */
+static uint32_t http_metrics_counters[HTTP_METRICS_COUNTER_NBR];
+
+/* Metric type names, by HTTP_METRICS_TYPE_xxx */
+static const char *const http_metrics_types[] =
+{
+  "counter",
+  "gauge",
+  "histogram",
+};
+
+/* Metric families, in serving order */
+static const http_metrics_family_t http_metrics_families[] =
+{
+  {"http_requests_total", "Requests answered.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_REQUESTS, 0U},
+  {"http_request_errors_total", "Requests answered with an error status, or dropped before their last byte.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_ERRORS, 0U},
+  {"http_response_bytes_total", "Bytes sent, stream data included.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_BYTES, 0U},
+  {"http_request_first_byte_seconds", "Time from accept, or first request byte, to first response byte sent.",
+   HTTP_METRICS_TYPE_HISTOGRAM, HTTP_METRICS_SOURCE_FIRST_BYTE, 6U},
+  {"http_request_duration_seconds", "Time from accept, or first request byte, to last response byte sent.",
+   HTTP_METRICS_TYPE_HISTOGRAM, HTTP_METRICS_SOURCE_DURATION, 6U},
+  {"http_connections_accepted_total", "Connections accepted.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_ACCEPTED, 0U},
+  {"http_connections_rejected_total", "Connections closed at once, no connection slot free.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_REJECTED, 0U},
+  {"http_connections_closed_total", "Connections closed.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_CLOSED, 0U},
+  {"http_connections_timeouts_total", "Connections closed idle, or not reading their response.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_TIMEOUTS, 0U},
+  {"http_connections_open", "Connections open.",
+   HTTP_METRICS_TYPE_GAUGE, HTTP_METRICS_SOURCE_OPEN, 0U},
+  {"http_bad_requests_total", "Connections closed on a request that is not valid HTTP.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_BAD_REQUESTS, 0U},
+  {"net_recv_bytes_total", "Bytes received on the connections.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_RECV_BYTES, 0U},
+  {"net_send_calls_total", "Socket sends that sent data.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SEND_CALLS, 0U},
+  {"net_send_blocked_total", "Socket sends that sent nothing, the socket buffer being full.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SEND_BLOCKED, 0U},
+  {"mx_wifi_ipc_requests_total", "Commands sent to the Wi-Fi module.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_IPC_REQUESTS, 0U},
+  {"mx_wifi_ipc_timeouts_total", "Commands not answered in time by the Wi-Fi module.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_IPC_TIMEOUTS, 0U},
+  {"mx_wifi_ipc_events_total", "Events received from the Wi-Fi module.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_IPC_EVENTS, 0U},
+  {"mx_wifi_ipc_wait_seconds_total", "Time spent waiting for Wi-Fi module command answers.",
+   HTTP_METRICS_TYPE_COUNTER, HTTP_METRICS_SOURCE_IPC_WAIT, 3U},
+  {"http_uptime_seconds", "Time since start up.",
+   HTTP_METRICS_TYPE_GAUGE, HTTP_METRICS_SOURCE_UPTIME, 3U},
+};
+
+#define HTTP_METRICS_FAMILY_NBR      (sizeof(http_metrics_families) / sizeof(http_metrics_families[0]))
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void http_metrics_observe(http_metrics_histogram_t *histogram, uint32_t duration);
+static const char *http_metrics_label(uint32_t slot);
+static uint64_t http_metrics_value(uint32_t source, uint32_t slot);
+static void http_metrics_number(char *text, uint64_t value, uint32_t decimals);
+static uint32_t http_metrics_line(const http_metrics_family_t *family, uint32_t line, http_writer_t *writer);
+static uint32_t http_metrics_histogram_line(const http_metrics_family_t *family, uint32_t slot, uint32_t line,
+                                            http_writer_t *writer);
+static bool http_metrics_fill(http_writer_t *writer);
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Add an observation to a latency histogram
+  * @param  histogram : histogram
+  * @param  duration  : observed time in us
+  * @retval None
+  */
+static void http_metrics_observe(http_metrics_histogram_t *histogram, uint32_t duration)
+{
+  uint32_t bucket = 0U;
+
+  /* First bucket whose upper bound is not less than the duration, the last one holds the longer ones */
+  while ((bucket < HTTP_METRICS_BUCKET_NBR) && (duration > (1UL << (HTTP_METRICS_BUCKET_MIN_LOG2 + bucket))))
+  {
+    bucket++;
+  }
+
+  histogram->buckets[bucket]++;
+  histogram->sum += duration;
+}
+
+/**
+  * @brief  Get the route label of a slot
+  * @param  slot : metrics slot
+  * @retval Request path of the route or asset, "other" for requests answered by neither, NULL if not in use
+  */
+static const char *http_metrics_label(uint32_t slot)
+{
+  const http_asset_t *asset;
+
+  if (slot < HTTP_METRICS_ROUTE_MAX_NBR)
+  {
+    return (slot < http_routes_size) ? http_routes[slot].path : NULL;
+  }
+
+  if (slot == HTTP_METRICS_SLOT_OTHER)
+  {
+    return "other";
+  }
+
+  asset = webserver_http_asset_get(slot - HTTP_METRICS_ROUTE_MAX_NBR);
+
+  return (asset != NULL) ? asset->path : NULL;
+}
+
+/**
+  * @brief  Get a metric value
+  * @param  source : counter number, or one of HTTP_METRICS_SOURCE_xxx
+  * @param  slot   : metrics slot of a value by route
+  * @retval Value
+  */
+static uint64_t http_metrics_value(uint32_t source, uint32_t slot)
+{
+  mx_ipc_stat_t ipc_stat = {0};
+  uint64_t      value;
+
+  if ((source >= HTTP_METRICS_SOURCE_IPC_REQUESTS) && (source <= HTTP_METRICS_SOURCE_IPC_WAIT))
+  {
+    (void)MX_WIFI_GetIpcStat(wifi_obj_get(), &ipc_stat);
+  }
+
+  switch (source)
+  {
+  case HTTP_METRICS_SOURCE_REQUESTS:
+    {
+      value = http_metrics_routes[slot].requests;
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_ERRORS:
+    {
+      value = http_metrics_routes[slot].errors;
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_BYTES:
+    {
+      value = http_metrics_routes[slot].bytes;
+      break;
+    }
+
+    /* Connections rejected are closed at once, not counted as closed */
+  case HTTP_METRICS_SOURCE_OPEN:
+    {
+      value = http_metrics_counters[HTTP_METRICS_ACCEPTED] - http_metrics_counters[HTTP_METRICS_CLOSED];
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_UPTIME:
+    {
+      value = HAL_GetTick();
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_IPC_REQUESTS:
+    {
+      value = ipc_stat.requests;
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_IPC_TIMEOUTS:
+    {
+      value = ipc_stat.timeouts;
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_IPC_EVENTS:
+    {
+      value = ipc_stat.events;
+      break;
+    }
+
+  case HTTP_METRICS_SOURCE_IPC_WAIT:
+    {
+      value = ipc_stat.wait_ms;
+      break;
+    }
+
+    /* Connection and socket counters */
+  default:
+    value = (source < HTTP_METRICS_COUNTER_NBR) ? http_metrics_counters[source] : 0U;
+    break;
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Write a metric value as text
+  * @param  text     : text buffer, HTTP_METRICS_NUMBER_SIZE
+  * @param  value    : value, in 10^-decimals units
+  * @param  decimals : decimals of the value
+  * @retval None
+  */
+static void http_metrics_number(char *text, uint64_t value, uint32_t decimals)
+{
+  uint64_t scale = 1U;
+  uint64_t integer;
+  int      length;
+
+  for (uint32_t i = 0U; i < decimals; i++)
+  {
+    scale *= 10U;
+  }
+  integer = value / scale;
+
+  /* The C library has no 64 bits conversion, print a large integer part as two halves */
+  if (integer >= HTTP_METRICS_NUMBER_SPLIT)
+  {
+    length = snprintf(text, HTTP_METRICS_NUMBER_SIZE, "%lu%09lu", (unsigned long)(integer / HTTP_METRICS_NUMBER_SPLIT),
+                      (unsigned long)(integer % HTTP_METRICS_NUMBER_SPLIT));
+  }
+  else
+  {
+    length = snprintf(text, HTTP_METRICS_NUMBER_SIZE, "%lu", (unsigned long)integer);
+  }
+
+  if (decimals > 0U)
+  {
+    (void)snprintf(&text[length], HTTP_METRICS_NUMBER_SIZE - (uint32_t)length, ".%0*lu", (int)decimals,
+                   (unsigned long)(value % scale));
+  }
+}
+
+/**
+  * @brief  Write a line of a metric family: its description first, then its value, or its values by route
+  * @param  family : metric family
+  * @param  line   : line number in the family
+  * @param  writer : response body writer
+  * @retval Line outcome, one of HTTP_METRICS_LINE_xxx
+  */
+static uint32_t http_metrics_line(const http_metrics_family_t *family, uint32_t line, http_writer_t *writer)
+{
+  uint32_t   lines = (family->type == HTTP_METRICS_TYPE_HISTOGRAM) ? HTTP_METRICS_HISTOGRAM_LINES : 1U;
+  const char *label;
+  char       value[HTTP_METRICS_NUMBER_SIZE];
+  uint32_t   slot;
+  bool       written;
+
+  if (line == 0U)
+  {
+    written = webserver_http_writer_printf(writer, "# HELP %s %s\n# TYPE %s %s\n", family->name, family->help,
+                                           family->name, http_metrics_types[family->type]);
+
+    return written ? HTTP_METRICS_LINE_WRITTEN : HTTP_METRICS_LINE_FULL;
+  }
+  line--;
+
+  /* Single value */
+  if (family->source < HTTP_METRICS_SOURCE_ROUTE)
+  {
+    if (line > 0U)
+    {
+      return HTTP_METRICS_LINE_END;
+    }
+
+    http_metrics_number(value, http_metrics_value(family->source, 0U), family->decimals);
+    written = webserver_http_writer_printf(writer, "%s %s\n", family->name, value);
+
+    return written ? HTTP_METRICS_LINE_WRITTEN : HTTP_METRICS_LINE_FULL;
+  }
+
+  /* Values by route, of the slots in use */
+  slot = line / lines;
+  if (slot >= HTTP_METRICS_SLOT_NBR)
+  {
+    return HTTP_METRICS_LINE_END;
+  }
+
+  label = http_metrics_label(slot);
+  if (label == NULL)
+  {
+    return HTTP_METRICS_LINE_WRITTEN;
+  }
+
+  if (family->type == HTTP_METRICS_TYPE_HISTOGRAM)
+  {
+    return http_metrics_histogram_line(family, slot, line % lines, writer);
+  }
+
+  http_metrics_number(value, http_metrics_value(family->source, slot), family->decimals);
+  written = webserver_http_writer_printf(writer, "%s{route=\"%s\"} %s\n", family->name, label, value);
+
+  return written ? HTTP_METRICS_LINE_WRITTEN : HTTP_METRICS_LINE_FULL;
+}
+
+/**
+  * @brief  Write a line of a route histogram: cumulative buckets, then sum and count
+  * @param  family : metric family
+  * @param  slot   : metrics slot, in use
+  * @param  line   : line number in the histogram
+  * @param  writer : response body writer
+  * @retval Line outcome, one of HTTP_METRICS_LINE_xxx
+  */
+static uint32_t http_metrics_histogram_line(const http_metrics_family_t *family, uint32_t slot, uint32_t line,
+                                            http_writer_t *writer)
+{
+  const http_metrics_histogram_t *histogram = (family->source == HTTP_METRICS_SOURCE_FIRST_BYTE) ?
+                                              &http_metrics_routes[slot].first_byte :
+                                              &http_metrics_routes[slot].duration;
+  const char *label = http_metrics_label(slot);
+  char       bound[HTTP_METRICS_NUMBER_SIZE];
+  uint32_t   count = 0U;
+  uint32_t   total = 0U;
+  bool       written;
+
+  /* Observations up to the bucket bound, all of them past the last bucket */
+  for (uint32_t i = 0U; i <= HTTP_METRICS_BUCKET_NBR; i++)
+  {
+    count += (i <= line) ? histogram->buckets[i] : 0U;
+    total += histogram->buckets[i];
+  }
+
+  /* A route not answered yet has no latency to show, leave its histogram out to keep the page short */
+  if (total == 0U)
+  {
+    return HTTP_METRICS_LINE_WRITTEN;
+  }
+
+  if (line < HTTP_METRICS_BUCKET_NBR)
+  {
+    http_metrics_number(bound, 1UL << (HTTP_METRICS_BUCKET_MIN_LOG2 + line), family->decimals);
+    written = webserver_http_writer_printf(writer, "%s_bucket{route=\"%s\",le=\"%s\"} %lu\n", family->name, label,
+                                           bound, (unsigned long)count);
+  }
+  else if (line == HTTP_METRICS_BUCKET_NBR)
+  {
+    written = webserver_http_writer_printf(writer, "%s_bucket{route=\"%s\",le=\"+Inf\"} %lu\n", family->name, label,
+                                           (unsigned long)count);
+  }
+  else if (line == (HTTP_METRICS_BUCKET_NBR + 1U))
+  {
+    http_metrics_number(bound, histogram->sum, family->decimals);
+    written = webserver_http_writer_printf(writer, "%s_sum{route=\"%s\"} %s\n", family->name, label, bound);
+  }
+  else
+  {
+    written = webserver_http_writer_printf(writer, "%s_count{route=\"%s\"} %lu\n", family->name, label,
+                                           (unsigned long)count);
+  }
+
+  return written ? HTTP_METRICS_LINE_WRITTEN : HTTP_METRICS_LINE_FULL;
+}
+
+/**
+  * @brief  Write the metrics, one line at a time so that they are not bounded by the writer buffer
+  * @param  writer : response body writer, its cursor the metric family and the line in it
+  * @retval true once all the metrics are written, false otherwise
+  */
+static bool http_metrics_fill(http_writer_t *writer)
+{
+  uint32_t family;
+  uint32_t result;
+
+  while ((writer->cursor >> HTTP_METRICS_LINE_BITS) < HTTP_METRICS_FAMILY_NBR)
+  {
+    family = writer->cursor >> HTTP_METRICS_LINE_BITS;
+    result = http_metrics_line(&http_metrics_families[family], writer->cursor & HTTP_METRICS_LINE_MASK, writer);
+
+    /* A line that does not fit is written again in the next piece */
+    if (result == HTTP_METRICS_LINE_FULL)
+    {
+      return false;
+    }
+
+    writer->cursor = (result == HTTP_METRICS_LINE_END) ? ((family + 1U) << HTTP_METRICS_LINE_BITS) :
+                     (writer->cursor + 1U);
+  }
+
+  return true;
+}
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Clear the metrics
+  * @param  None
+  * @retval Web Server status, an error if the route table has more routes than metrics slots
+  */
+WebServer_StatusTypeDef webserver_http_metrics_init(void)
+{
+  if (http_routes_size > HTTP_METRICS_ROUTE_MAX_NBR)
+  {
+    return HTTP_ERROR;
+  }
+
+  memset(http_metrics_routes, 0, sizeof(http_metrics_routes));
+  memset(http_metrics_counters, 0, sizeof(http_metrics_counters));
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Get the time in us, from the HAL tick of 1 ms and the SysTick counter within it. It wraps after
+  *         71 minutes, only differences of it are meaningful.
+  * @param  None
+  * @retval Time in us
+  */
+uint32_t webserver_http_metrics_now(void)
+{
+  uint32_t tick;
+  uint32_t count;
+
+  /* Read a tick and the counter of the same ms, again if the tick interrupt came in between */
+  do
+  {
+    tick  = HAL_GetTick();
+    count = SysTick->VAL;
+  } while (tick != HAL_GetTick());
+
+  /* The counter counts down from its reload value to 0 each ms */
+  return (tick * 1000U) + (((SysTick->LOAD - count) * 1000U) / (SysTick->LOAD + 1U));
+}
+
+/**
+  * @brief  Get the metrics slot of a request
+  * @param  route : matched route, NULL if none
+  * @param  asset : matched asset number, HTTP_ASSET_NONE if none
+  * @retval Metrics slot
+  */
+uint32_t webserver_http_metrics_slot(const http_route_t *route, uint32_t asset)
+{
+  if (route != NULL)
+  {
+    return (uint32_t)(route - http_routes);
+  }
+
+  if (asset != HTTP_ASSET_NONE)
+  {
+    return HTTP_METRICS_ROUTE_MAX_NBR + asset;
+  }
+
+  return HTTP_METRICS_SLOT_OTHER;
+}
+
+/**
+  * @brief  Add to a connection or socket counter
+  * @param  counter : counter, one of HTTP_METRICS_xxx
+  * @param  value   : value to be added
+  * @retval None
+  */
+void webserver_http_metrics_count(uint32_t counter, uint32_t value)
+{
+  http_metrics_counters[counter] += value;
+}
+
+/**
+  * @brief  Count the bytes sent for a request
+  * @param  slot : metrics slot of the request
+  * @param  size : bytes sent
+  * @retval None
+  */
+void webserver_http_metrics_sent(uint32_t slot, uint32_t size)
+{
+  http_metrics_routes[slot].bytes += size;
+}
+
+/**
+  * @brief  Record the time to the first response byte of a request
+  * @param  slot  : metrics slot of the request
+  * @param  start : time in us the request started
+  * @retval None
+  */
+void webserver_http_metrics_first_byte(uint32_t slot, uint32_t start)
+{
+  http_metrics_observe(&http_metrics_routes[slot].first_byte, webserver_http_metrics_now() - start);
+}
+
+/**
+  * @brief  Record a request once its last response byte is sent, or once it is dropped
+  * @param  slot   : metrics slot of the request
+  * @param  start  : time in us the request started
+  * @param  failed : response with an error status, or dropped
+  * @retval None
+  */
+void webserver_http_metrics_request(uint32_t slot, uint32_t start, bool failed)
+{
+  http_metrics_routes[slot].requests++;
+  http_metrics_routes[slot].errors += failed ? 1U : 0U;
+  http_metrics_observe(&http_metrics_routes[slot].duration, webserver_http_metrics_now() - start);
+}
+
+/**
+  * @brief  Start writing the metrics in the Prometheus text format, chunked if the client supports it
+  * @param  request : parsed request
+  * @param  writer  : response body writer
+  * @retval None
+  */
+void webserver_http_metrics_start(const http_request_t *request, http_writer_t *writer)
+{
+  webserver_http_writer_start(writer, http_metrics_fill, 0U, request->http_1_1);
+}
@@ -0,0 +1,63 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_metrics.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_metrics.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_METRICS_H
+#define WEBSERVER_HTTP_METRICS_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "webserver_status.h"
+#include "webserver_http_routes.h"
+#include "webserver_http_assets.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Latency histograms: log2 buckets of microseconds, the first one up to 2^HTTP_METRICS_BUCKET_MIN_LOG2 */
+#define HTTP_METRICS_BUCKET_MIN_LOG2 (8U)       /* 256 us                                             */
+#define HTTP_METRICS_BUCKET_NBR      (17U)      /* Finite buckets, the last one up to 16.8 s          */
+
+/* Metrics slots: routes, then web page assets, then requests answered by neither */
+#define HTTP_METRICS_ROUTE_MAX_NBR   (16U)
+#define HTTP_METRICS_SLOT_NBR        (HTTP_METRICS_ROUTE_MAX_NBR + HTTP_ASSETS_MAX_NBR + 1U)
+#define HTTP_METRICS_SLOT_OTHER      (HTTP_METRICS_SLOT_NBR - 1U)
+
+/* Connection and socket counters */
+#define HTTP_METRICS_ACCEPTED        (0U)       /* Connections accepted                               */
+#define HTTP_METRICS_REJECTED        (1U)       /* Connections closed at once, no free slot           */
+#define HTTP_METRICS_CLOSED          (2U)       /* Connections closed                                 */
+#define HTTP_METRICS_TIMEOUTS        (3U)       /* Connections closed idle or not reading             */
+#define HTTP_METRICS_BAD_REQUESTS    (4U)       /* Connections closed on a request that is not HTTP   */
+#define HTTP_METRICS_RECV_BYTES      (5U)       /* Bytes received                                     */
+#define HTTP_METRICS_SEND_CALLS      (6U)       /* Send calls that sent data                          */
+#define HTTP_METRICS_SEND_BLOCKED    (7U)       /* Send calls that sent nothing                       */
+#define HTTP_METRICS_COUNTER_NBR     (8U)
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+WebServer_StatusTypeDef webserver_http_metrics_init(void);
+uint32_t webserver_http_metrics_now(void);
+uint32_t webserver_http_metrics_slot(const http_route_t *route, uint32_t asset);
+void webserver_http_metrics_count(uint32_t counter, uint32_t value);
+void webserver_http_metrics_sent(uint32_t slot, uint32_t size);
+void webserver_http_metrics_first_byte(uint32_t slot, uint32_t start);
+void webserver_http_metrics_request(uint32_t slot, uint32_t start, bool failed);
+void webserver_http_metrics_start(const http_request_t *request, http_writer_t *writer);
+
+#endif /* WEBSERVER_HTTP_METRICS_H */
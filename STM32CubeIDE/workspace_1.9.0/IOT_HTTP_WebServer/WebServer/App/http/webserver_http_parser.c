@@ -0,0 +1,267 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_parser.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server http request parser.
+  *          The parser is incremental: it is fed the receive buffer each time new data arrives, resumes where
+  *          it stopped, and scans each byte once. It copies nothing, the request line parts and the header
+  *          fields the server uses are slices of the receive buffer.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_parser.h"
+#include <stddef.h>
+#include <string.h>
+#include <strings.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Header field kept by the parser
+  */
+typedef struct
+{
+  const char *name;                            /*!< Field name, colon excluded                        */
+  uint32_t   name_size;                        /*!< Field name length                                 */
+  size_t     offset;                           /*!< Offset of the value slice in http_request_t       */
+  bool       single;                           /*!< Repeated with another value, the request is wrong */
+} http_parser_field_t;
+
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Expand a header field name and its http_request_t member into a field table entry, a repeated field keeps its
+   last value */
+#define HTTP_PARSER_FIELD(name, member) {(name), (sizeof(name) - 1U), offsetof(http_request_t, member), false}
+
+/* Same, for a field whose values must all be the same when repeated */
+#define HTTP_PARSER_SINGLE_FIELD(name, member) {(name), (sizeof(name) - 1U), offsetof(http_request_t, member), true}
+
+/* Optional white space around a header field value */
+#define HTTP_PARSER_IS_OWS(c)        (((c) == ' ') || ((c) == '\t'))
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Header fields used by the server, the other ones are skipped */
+static const http_parser_field_t http_parser_fields[] =
+{
+  HTTP_PARSER_FIELD("Accept-Encoding",       accept_encoding),
+  HTTP_PARSER_FIELD("Connection",            connection),
+  HTTP_PARSER_SINGLE_FIELD("Content-Length", content_length),
+  HTTP_PARSER_FIELD("If-None-Match",         if_none_match),
+  HTTP_PARSER_FIELD("If-Range",              if_range),
+  HTTP_PARSER_FIELD("Last-Event-ID",         last_event_id),
+  HTTP_PARSER_FIELD("Range",                 range),
+  HTTP_PARSER_FIELD("Sec-WebSocket-Key",     ws_key),
+  HTTP_PARSER_FIELD("Sec-WebSocket-Version", ws_version),
+  HTTP_PARSER_FIELD("Transfer-Encoding",     transfer_encoding),
+  HTTP_PARSER_FIELD("Upgrade",               upgrade),
+};
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t http_parser_request_line(http_request_t *request, const char *line, uint32_t line_size);
+static uint32_t http_parser_header_line(http_request_t *request, const char *line, uint32_t line_size);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Prepare the parser and the request for a new request
+  * @param  parser  : parser
+  * @param  request : request to be filled by the parser
+  * @retval None
+  */
+void webserver_http_parser_init(http_parser_t *parser, http_request_t *request)
+{
+  memset(parser, 0, sizeof(*parser));
+  memset(request, 0, sizeof(*request));
+
+  parser->state   = HTTP_PARSER_STATE_REQUEST;
+  request->method = HTTP_METHOD_UNKNOWN;
+}
+
+/**
+  * @brief  Parse the request data received so far. The data buffer must not move, nor its first
+  *         data_size bytes change, between the calls made for the same request.
+  * @param  parser    : parser
+  * @param  request   : request, filled as its lines are parsed
+  * @param  data      : received data, starting at the request first byte
+  * @param  data_size : number of bytes received so far
+  * @retval Parser result, one of HTTP_PARSER_xxx
+  */
+uint32_t webserver_http_parser_execute(http_parser_t *parser, http_request_t *request,
+                                       const char *data, uint32_t data_size)
+{
+  const char *line;
+  const char *line_end;
+  uint32_t   line_size;
+
+  while (parser->state != HTTP_PARSER_STATE_DONE)
+  {
+    /* Only scan the bytes received since the previous call */
+    line_end = memchr(&data[parser->scan_offset], '\n', data_size - parser->scan_offset);
+    if (line_end == NULL)
+    {
+      parser->scan_offset = data_size;
+      return HTTP_PARSER_MORE;
+    }
+
+    /* Complete line, CR LF or bare LF terminated */
+    line      = &data[parser->line_start];
+    line_size = (uint32_t)(line_end - line);
+    if ((line_size > 0U) && (line[line_size - 1U] == '\r'))
+    {
+      line_size--;
+    }
+    parser->line_start  = (uint32_t)(line_end - data) + 1U;
+    parser->scan_offset = parser->line_start;
+
+    if (parser->state == HTTP_PARSER_STATE_REQUEST)
+    {
+      /* Empty lines before the request line are ignored */
+      if (line_size == 0U)
+      {
+        continue;
+      }
+
+      if (http_parser_request_line(request, line, line_size) != HTTP_PARSER_DONE)
+      {
+        return HTTP_PARSER_ERROR;
+      }
+      parser->state = HTTP_PARSER_STATE_HEADER;
+    }
+    else if (line_size == 0U)
+    {
+      /* End of headers */
+      request->header      = data;
+      request->header_size = parser->line_start;
+      parser->state        = HTTP_PARSER_STATE_DONE;
+    }
+    else if (http_parser_header_line(request, line, line_size) != HTTP_PARSER_DONE)
+    {
+      return HTTP_PARSER_ERROR;
+    }
+  }
+
+  return HTTP_PARSER_DONE;
+}
+
+/**
+  * @brief  Parse the request line: method, request target, then protocol version
+  * @param  request   : request to be filled
+  * @param  line      : request line, end of line excluded
+  * @param  line_size : request line length
+  * @retval Parser result, HTTP_PARSER_DONE or HTTP_PARSER_ERROR
+  */
+static uint32_t http_parser_request_line(http_request_t *request, const char *line, uint32_t line_size)
+{
+  const char *line_end = &line[line_size];
+  const char *target;
+  const char *target_end;
+  const char *query;
+  const char *version;
+
+  /* Method */
+  target = memchr(line, ' ', line_size);
+  if ((target == NULL) || (target == line))
+  {
+    return HTTP_PARSER_ERROR;
+  }
+  request->method = webserver_http_route_method(line, (uint32_t)(target - line));
+  target++;
+
+  /* Request target, only the origin form is served */
+  target_end = memchr(target, ' ', (uint32_t)(line_end - target));
+  if ((target_end == NULL) || (target == target_end) || (target[0] != '/'))
+  {
+    return HTTP_PARSER_ERROR;
+  }
+
+  query = memchr(target, '?', (uint32_t)(target_end - target));
+  if (query != NULL)
+  {
+    request->path.data  = target;
+    request->path.size  = (uint32_t)(query - target);
+    request->query.data = query + 1;
+    request->query.size = (uint32_t)(target_end - query) - 1U;
+  }
+  else
+  {
+    request->path.data  = target;
+    request->path.size  = (uint32_t)(target_end - target);
+  }
+
+  /* Protocol version, HTTP/1.0 or HTTP/1.1 */
+  version = target_end + 1;
+  if (((line_end - version) != 8) || (strncmp(version, "HTTP/1.", 7U) != 0) ||
+      (version[7] < '0') || (version[7] > '9'))
+  {
+    return HTTP_PARSER_ERROR;
+  }
+  request->http_1_1 = (version[7] != '0');
+
+  return HTTP_PARSER_DONE;
+}
+
+/**
+  * @brief  Parse a header field line, and keep its value if the server uses it
+  * @param  request   : request to be filled
+  * @param  line      : header field line, end of line excluded
+  * @param  line_size : header field line length
+  * @retval Parser result, HTTP_PARSER_DONE or HTTP_PARSER_ERROR
+  */
+static uint32_t http_parser_header_line(http_request_t *request, const char *line, uint32_t line_size)
+{
+  const char   *colon = memchr(line, ':', line_size);
+  const char   *value;
+  const char   *value_end = &line[line_size];
+  uint32_t     name_size;
+  http_slice_t *slice;
+
+  /* Field name, no white space allowed before the colon, this also rejects obsolete line folding */
+  if ((colon == NULL) || (colon == line) || HTTP_PARSER_IS_OWS(colon[-1]) || HTTP_PARSER_IS_OWS(line[0]))
+  {
+    return HTTP_PARSER_ERROR;
+  }
+  name_size = (uint32_t)(colon - line);
+
+  for (uint32_t i = 0U; i < (sizeof(http_parser_fields) / sizeof(http_parser_fields[0])); i++)
+  {
+    if ((http_parser_fields[i].name_size == name_size) &&
+        (strncasecmp(line, http_parser_fields[i].name, name_size) == 0))
+    {
+      /* Field value, surrounding white space excluded */
+      value = colon + 1;
+      while ((value < value_end) && HTTP_PARSER_IS_OWS(*value))
+      {
+        value++;
+      }
+      while ((value_end > value) && HTTP_PARSER_IS_OWS(value_end[-1]))
+      {
+        value_end--;
+      }
+
+      slice       = (http_slice_t *)((char *)request + http_parser_fields[i].offset);
+
+      /* Conflicting values, the request could be read in two ways */
+      if (http_parser_fields[i].single && (slice->data != NULL) &&
+          ((slice->size != (uint32_t)(value_end - value)) || (strncmp(slice->data, value, slice->size) != 0)))
+      {
+        return HTTP_PARSER_ERROR;
+      }
+
+      slice->data = value;
+      slice->size = (uint32_t)(value_end - value);
+      break;
+    }
+  }
+
+  return HTTP_PARSER_DONE;
+}
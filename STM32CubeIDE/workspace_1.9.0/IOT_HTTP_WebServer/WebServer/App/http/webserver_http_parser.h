@@ -0,0 +1,55 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_parser.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_parser.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_PARSER_H
+#define WEBSERVER_HTTP_PARSER_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include "webserver_http_routes.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  HTTP request parser state, kept between two reads of the same request
+  */
+typedef struct
+{
+  uint32_t state;                              /*!< Line being parsed, one of HTTP_PARSER_STATE_xxx   */
+  uint32_t line_start;                         /*!< Offset of the line being parsed                   */
+  uint32_t scan_offset;                        /*!< Offset of the first byte not scanned yet          */
+} http_parser_t;
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* HTTP request parser results */
+#define HTTP_PARSER_MORE             (0U)      /* Request header incomplete, feed more data           */
+#define HTTP_PARSER_DONE             (1U)      /* Request header complete                             */
+#define HTTP_PARSER_ERROR            (2U)      /* Malformed request                                   */
+
+/* HTTP request parser states */
+#define HTTP_PARSER_STATE_REQUEST    (0U)      /* Request line                                        */
+#define HTTP_PARSER_STATE_HEADER     (1U)      /* Header field lines                                  */
+#define HTTP_PARSER_STATE_DONE       (2U)      /* End of headers reached                              */
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+void webserver_http_parser_init(http_parser_t *parser, http_request_t *request);
+uint32_t webserver_http_parser_execute(http_parser_t *parser, http_request_t *request,
+                                       const char *data, uint32_t data_size);
+
+#endif /* WEBSERVER_HTTP_PARSER_H */
@@ -19,50 +19,73 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver_http_response.h"
 #include "webserver_http_encoder.h"
+#include "webserver_http_conn.h"
+#include "webserver_http_api.h"
+#include "webserver_http_ws.h"
+#include "webserver_http_writer.h"
+#include "webserver_http_float.h"
+#include "webserver_http_assets.h"
+#include "webserver_http_metrics.h"
 #include "net_connect.h"
-#include "mx_wifi.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <strings.h>
 
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
 /* Private define ----------------------------------------------------------------------------------------------------*/
 #define HTTP_SERVER_PORT         (80U)
-#define HTTP_RECEIVE_BUFFER_SIZE (1500U)
-#define HTTP_SENSORS_BUFFER_SIZE (20U)
-#define HTTP_HEADERS_BUFFER_SIZE (500U)
 
-#define MAX_SOCKET_DATASIZE      (MX_WIFI_BUFFER_SIZE - 100U)
+/* Byte range request outcomes */
+#define HTTP_RANGE_NONE          (0U)  /* No usable range, send the whole body */
+#define HTTP_RANGE_PARTIAL       (1U)  /* Send a part of the body              */
+#define HTTP_RANGE_INVALID       (2U)  /* Range out of the body                */
+
+/* Time in ms an events stream client waits before reconnecting */
+#define HTTP_EVENTS_RETRY        (3000U)
+
+/* Status code first digit in a response header, after "HTTP/1.1 " */
+#define HTTP_STATUS_CLASS        (9U)
 
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
-/* Sensors acquisition variables declaration */
-float temperature_value = 0;
-float pressure_value    = 0;
-float humidity_value    = 0;
-
-/* Treat responses variables declaration */
-int sock, newconn, size;
+/* Listening socket declaration */
+int sock;
 
 /* Socket variables declaration */
-struct net_sockaddr address, remotehost;
+struct net_sockaddr address;
 
-/* HTTP buffers declaration */
-char http_sensor_value[HTTP_SENSORS_BUFFER_SIZE];
+/* HTTP buffers declaration, used to build the static headers at start up */
 char http_header_response[HTTP_HEADERS_BUFFER_SIZE];
 
+/* Web page assets prebuilt header blocks, by asset number */
+static http_static_headers_t http_asset_headers[HTTP_ASSETS_MAX_NBR];
+
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
-static WebServer_StatusTypeDef http_treat_request(uint32_t socket);
-static WebServer_StatusTypeDef http_send_headers_response(uint32_t headers_id,
-                                                          uint32_t socket,
-                                                          char *headers_buff,
-                                                          uint32_t data_size);
-static WebServer_StatusTypeDef http_send_response(uint32_t headers_id,
-                                                  uint32_t socket,
-                                                  char *headers_buff,
-                                                  const char *body_buff,
-                                                  uint32_t data_size);
-static WebServer_StatusTypeDef http_send(uint32_t socket,
-                                         const char *frame,
-                                         uint32_t frame_size);
+static bool http_request_has_token(const http_slice_t *value, const char *token);
+static uint32_t http_request_span(const char *value, const char *value_end, const char *reject);
+static bool http_request_keep_alive(const http_request_t *request);
+static bool http_request_has_body(const http_request_t *request);
+static uint32_t http_request_accept_codings(const http_request_t *request);
+static bool http_request_zero_quality(const char *params, const char *params_end);
+static bool http_request_not_modified(const http_request_t *request, const char *etag);
+static uint32_t http_request_range(const http_request_t *request, const char *etag, uint32_t body_size,
+                                   uint32_t *first, uint32_t *last);
+static WebServer_StatusTypeDef http_dispatch_request(const http_request_t *request, http_response_t *response);
+static WebServer_StatusTypeDef http_asset_response(uint32_t asset_id, const http_request_t *request,
+                                                   http_response_t *response);
+static WebServer_StatusTypeDef http_encode_headers(uint32_t headers_id,
+                                                   char *headers_buff,
+                                                   uint32_t data_size,
+                                                   bool keep_alive);
+static WebServer_StatusTypeDef http_build_static_headers(void);
+static WebServer_StatusTypeDef http_build_response(uint32_t headers_id,
+                                                   http_response_t *response,
+                                                   const char *body_buff,
+                                                   uint32_t data_size,
+                                                   bool keep_alive);
+static WebServer_StatusTypeDef http_build_writer_response(uint32_t headers_id,
+                                                          http_response_t *response,
+                                                          bool keep_alive);
 
 /* Functions prototypes ----------------------------------------------------------------------------------------------*/
 
@@ -73,6 +96,56 @@ static WebServer_StatusTypeDef http_send(uint32_t socket,
   */
 WebServer_StatusTypeDef webserver_http_start(void)
 {
+  const uint8_t *assets_area;
+  uint32_t assets_area_size;
+
+  /* Build the route lookup index */
+  if (webserver_http_routes_init() != WEBSERVER_OK)
+  {
+    printf("*** Fail : Route index not built !!!! \r\n");
+    return HTTP_ERROR;
+  }
+
+  /* Clear the metrics, one slot per route */
+  if (webserver_http_metrics_init() != WEBSERVER_OK)
+  {
+    printf("*** Fail : Metrics not set up !!!! \r\n");
+    return HTTP_ERROR;
+  }
+
+#if (HTTP_ASSETS_OSPI == 1)
+  /* Read the web page asset pack in place from the OSPI NOR flash, the firmware does not link it in */
+  if (bsp_ospi_nor_map(&assets_area, &assets_area_size) != BSP_ERROR_NONE)
+  {
+    printf("*** Fail : OSPI NOR flash not mapped !!!! \r\n");
+    return HTTP_ERROR;
+  }
+  assets_area      = &assets_area[HTTP_ASSETS_OSPI_OFFSET];
+  assets_area_size = assets_area_size - HTTP_ASSETS_OSPI_OFFSET;
+#else
+  /* Read the web page asset pack linked in */
+  assets_area      = res_pack;
+  assets_area_size = res_pack_size;
+#endif /* HTTP_ASSETS_OSPI */
+
+  /* Check the web page asset pack */
+  if (webserver_http_assets_init(assets_area, assets_area_size) != WEBSERVER_OK)
+  {
+    printf("*** Fail : Web page assets not valid !!!! \r\n");
+#if (HTTP_ASSETS_OSPI == 1)
+    printf("*** Flash res_pack.bin to the OSPI NOR flash at 0x%08lX \r\n",
+           (unsigned long)(OCTOSPI2_BASE + HTTP_ASSETS_OSPI_OFFSET));
+#endif /* HTTP_ASSETS_OSPI */
+    return HTTP_ERROR;
+  }
+
+  /* Build the web page assets header blocks */
+  if (http_build_static_headers() != WEBSERVER_OK)
+  {
+    printf("*** Fail : Static headers not built !!!! \r\n");
+    return HTTP_ERROR;
+  }
+
   /* create a TCP socket */
   printf("\r\n");
   printf("*** Create TCP socket \r\n");
@@ -104,238 +177,776 @@ WebServer_StatusTypeDef webserver_http_start(void)
   }
   printf("*** Listening started \r\n");
 
-  size = sizeof(remotehost);
+  /* Serve the connections until a fatal socket error */
+  return webserver_http_conn_serve(sock);
+}
 
-  /* Infinite loop to serve socket communication */
-  while (1)
+/**
+  * @brief  Build the response to a complete HTTP request header
+  * @param  request  : request filled by the parser, keep_alive false if the server wants the
+  *                    connection closed after the response. Completed by the call.
+  * @param  response : response to be filled, scratch buffers set
+  * @retval Web Server status, an error means the request is not valid HTTP
+  */
+WebServer_StatusTypeDef webserver_http_process(http_request_t *request, http_response_t *response)
+{
+  /* Keep the connection open unless the client, or the server, asks otherwise */
+  request->keep_alive = request->keep_alive && http_request_keep_alive(request);
+
+  /* A request body is never read, the next request could not be told from it */
+  if (http_request_has_body(request))
   {
-    /* Accept net socket requests */
-    newconn = net_accept(sock, (struct net_sockaddr *)&remotehost, (uint32_t *)&size);
+    request->keep_alive = false;
+  }
+
+  /* Content codings the client can decode */
+  request->accept_codings = http_request_accept_codings(request);
+
+  response->header      = NULL;
+  response->header_size = 0U;
+  response->body        = NULL;
+  response->body_size   = 0U;
+  response->stream.type = HTTP_STREAM_NONE;
+  response->writer.fill = NULL;
+
+  /* Answer the request */
+  if (http_dispatch_request(request, response) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* A raw body of unknown length ends with the connection */
+  if ((response->writer.fill != NULL) && !response->writer.chunked)
+  {
+    request->keep_alive = false;
+  }
+
+  /* A HEAD response is the GET one, headers only */
+  if (request->method == HTTP_METHOD_HEAD)
+  {
+    response->body        = NULL;
+    response->body_size   = 0U;
+    response->stream.type = HTTP_STREAM_NONE;
+    response->writer.fill = NULL;
+  }
 
-    /* Check if a valid new connection is requested */
-    if (newconn > 0)
+  /* Client and server errors are counted as failed requests */
+  response->failed = (response->header_size > HTTP_STATUS_CLASS) && (response->header[HTTP_STATUS_CLASS] >= '4');
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Check if a comma separated header field value lists a token
+  * @param  value : header field value
+  * @param  token : token to be found, case insensitive
+  * @retval true if the value lists the token, false otherwise
+  */
+static bool http_request_has_token(const http_slice_t *value, const char *token)
+{
+  const char *item      = value->data;
+  const char *value_end = &value->data[value->size];
+  uint32_t   token_size = strlen(token);
+  uint32_t   item_size;
+
+  while (item < value_end)
+  {
+    if ((*item == ',') || (*item == ' ') || (*item == '\t'))
     {
-      /* Treat net socket requests */
-      if (http_treat_request(newconn) != WEBSERVER_OK)
-      {
-        printf("*** Fail : Invalid HTTP request !!!! \r\n");
-        return SOCKET_ERROR;
-      }
+      item++;
+      continue;
     }
-    else
+
+    item_size = http_request_span(item, value_end, ", \t;\r");
+    if ((item_size == token_size) && (strncasecmp(item, token, token_size) == 0))
     {
-      printf("*** Fail : Invalid socket connection !!!! \r\n");
-      return SOCKET_ERROR;
+      return true;
     }
+
+    item += item_size;
+    item += http_request_span(item, value_end, ",\r");
   }
+
+  return false;
 }
 
 /**
-  * @brief  Treat webserver HTTP request
-  * @param  socket : connection socket
-  * @retval Web Server status
+  * @brief  Length of the initial part of a header field value made of characters not in a set
+  * @param  value     : pointer in the header field value
+  * @param  value_end : end of the header field value
+  * @param  reject    : characters ending the part, "\r" included
+  * @retval Length of the part, bounded by the end of the value
   */
-static WebServer_StatusTypeDef http_treat_request(uint32_t socket)
+static uint32_t http_request_span(const char *value, const char *value_end, const char *reject)
 {
-  unsigned char recv_buffer[HTTP_RECEIVE_BUFFER_SIZE];
+  uint32_t size = strcspn(value, reject);
 
-  /* Clear receive buffer */
-  memset((void*)recv_buffer, 0, HTTP_RECEIVE_BUFFER_SIZE);
+  return (size < (uint32_t)(value_end - value)) ? size : (uint32_t)(value_end - value);
+}
 
-  /* Read the http request */
-  if (net_recvfrom(socket, recv_buffer, HTTP_RECEIVE_BUFFER_SIZE, 0, (struct net_sockaddr *)&remotehost, (uint32_t *)&size) < 0)
-  {
-    return HTTP_ERROR;
-  }
+/**
+  * @brief  Check if the connection must be kept open after answering a request
+  * @param  request : parsed request
+  * @retval true if the connection is persistent, false otherwise
+  */
+static bool http_request_keep_alive(const http_request_t *request)
+{
+  /* HTTP/1.1 connections are persistent by default, HTTP/1.0 ones are not */
+  bool keep_alive = request->http_1_1;
 
-  /* Treat get cmd */
-  if (strncmp((char *)recv_buffer, http_get_cmd, http_get_cmd_size) == 0U)
+  /* A connection header overrides the default behaviour */
+  if (request->connection.data != NULL)
   {
-    /* Send html */
-    if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_html_cmd, http_html_cmd_size) == 0U)
+    if (http_request_has_token(&request->connection, "close"))
     {
-      http_send_response(HTTP_HEADER_HTML_ID, socket, http_header_response, html_buff, html_buff_size);
+      keep_alive = false;
     }
-    /* Send css shunk */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_css_chunk_cmd, http_css_chunk_cmd_size) == 0U)
+    else if (http_request_has_token(&request->connection, "keep-alive"))
     {
-      http_send_response(HTTP_HEADER_CSS_ID, socket, http_header_response, css_shunk_buff, css_shunk_buff_size);
+      keep_alive = true;
     }
-    /* Send main css */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_css_main_cmd, http_css_main_cmd_size) == 0U)
-    {
-      http_send_response(HTTP_HEADER_CSS_ID, socket, http_header_response, css_main_buff, css_main_buff_size);
-    }
-    /* Send js shunk */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_js_chunk_cmd, http_js_chunk_cmd_size) == 0U)
+  }
+
+  return keep_alive;
+}
+
+/**
+  * @brief  Check if a request body follows the request header
+  * @param  request : parsed request
+  * @retval true if the request has a body, even an empty chunked one, false otherwise
+  */
+static bool http_request_has_body(const http_request_t *request)
+{
+  if (request->transfer_encoding.data != NULL)
+  {
+    return true;
+  }
+
+  /* Any length other than zero, leading zeros allowed */
+  return (request->content_length.data != NULL) &&
+         (strspn(request->content_length.data, "0") < request->content_length.size);
+}
+
+/**
+  * @brief  Get the content codings accepted by the client
+  * @param  request : parsed request
+  * @retval Accepted content codings, HTTP_CODING_MASK() bits
+  */
+static uint32_t http_request_accept_codings(const http_request_t *request)
+{
+  const char *value     = request->accept_encoding.data;
+  const char *value_end = &request->accept_encoding.data[request->accept_encoding.size];
+  uint32_t   codings = HTTP_CODING_MASK(HTTP_CODING_IDENTITY);
+  uint32_t   coding;
+  uint32_t   token_size;
+  uint32_t   params_size;
+
+  if (value == NULL)
+  {
+    return codings;
+  }
+
+  /* Comma separated list of codings, each one with an optional quality value */
+  while (value < value_end)
+  {
+    if ((*value == ',') || (*value == ' ') || (*value == '\t'))
     {
-      http_send_response(HTTP_HEADER_JS_ID, socket, http_header_response, js_shunk_buff, js_shunk_buff_size);
+      value++;
+      continue;
     }
-    /* Send main js */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_js_main_cmd, http_js_main_cmd_size) == 0U)
+
+    token_size  = http_request_span(value, value_end, ",; \t\r");
+    params_size = http_request_span(&value[token_size], value_end, ",\r");
+
+    if (((token_size == 4U) && (strncasecmp(value, "gzip", 4U) == 0)) ||
+        ((token_size == 6U) && (strncasecmp(value, "x-gzip", 6U) == 0)))
     {
-      http_send_response(HTTP_HEADER_JS_ID, socket, http_header_response, js_main_buff, js_main_buff_size);
+      coding = HTTP_CODING_MASK(HTTP_CODING_GZIP);
     }
-    /* Send favicon */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_favicon_cmd, http_favicon_cmd_size) == 0U)
+    else if ((token_size == 2U) && (strncasecmp(value, "br", 2U) == 0))
     {
-      http_send_response(HTTP_HEADER_FAVICON_ID, socket, http_header_response, favicon_buff, favicon_buff_size);
+      coding = HTTP_CODING_MASK(HTTP_CODING_BR);
     }
-    /* Send json */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_json_cmd, http_json_cmd_size) == 0U)
+    else if ((token_size == 1U) && (value[0] == '*'))
     {
-      http_send_response(HTTP_HEADER_JSON_ID, socket, http_header_response, json_buff, json_buff_size);
+      coding = HTTP_CODING_MASK(HTTP_CODING_GZIP) | HTTP_CODING_MASK(HTTP_CODING_BR);
     }
-    /* Send font */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_font_cmd, http_font_cmd_size) == 0U)
+    else
     {
-      http_send_response(HTTP_HEADER_FONT_ID, socket, http_header_response, font_buff, font_buff_size);
+      coding = 0U;
     }
-    /* Send image */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_image_cmd, http_image_cmd_size) == 0U)
+    value += token_size;
+
+    if (http_request_zero_quality(value, &value[params_size]))
     {
-      http_send_response(HTTP_HEADER_IMAGE_ID, socket, http_header_response, image_buff, image_buff_size);
+      coding = 0U;
     }
-    /* Send read temperature response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_temperature_cmd, http_read_temperature_cmd_size) == 0U)
+
+    codings |= coding;
+    value   += params_size;
+  }
+
+  return codings;
+}
+
+/**
+  * @brief  Check if the parameters of a coding give it a zero quality value ("q=0", "q=0.000"), which refuses it. The
+  *         parameters are read up to their end only, whatever ends the header line.
+  * @param  params     : coding parameters, from the end of the coding token
+  * @param  params_end : end of the coding parameters
+  * @retval true if the quality value is zero, false otherwise
+  */
+static bool http_request_zero_quality(const char *params, const char *params_end)
+{
+  const char *quality = params;
+  uint32_t   quality_size;
+  uint32_t   i = 1U;
+
+  while (((quality + 2) <= params_end) && !(((quality[0] == 'q') || (quality[0] == 'Q')) && (quality[1] == '=')))
+  {
+    quality++;
+  }
+  if ((quality + 2) > params_end)
+  {
+    return false;
+  }
+
+  quality     += 2;
+  quality_size = http_request_span(quality, params_end, "; \t\r\n");
+  while ((i < quality_size) && ((quality[i] == '0') || (quality[i] == '.')))
+  {
+    i++;
+  }
+
+  return (quality_size > 0U) && (quality[0] == '0') && (i == quality_size);
+}
+
+/**
+  * @brief  Check if the client cached copy of a body is still valid
+  * @param  request : parsed request
+  * @param  etag    : quoted entity tag of the body to be sent, NULL if none
+  * @retval true if the request If-None-Match header lists the entity tag, false otherwise
+  */
+static bool http_request_not_modified(const http_request_t *request, const char *etag)
+{
+  const char *value     = request->if_none_match.data;
+  const char *value_end = &request->if_none_match.data[request->if_none_match.size];
+  uint32_t   etag_size;
+
+  if ((value == NULL) || (etag == NULL))
+  {
+    return false;
+  }
+
+  /* Any current representation matches */
+  if (*value == '*')
+  {
+    return true;
+  }
+
+  /* Weak comparison, as required for If-None-Match: a W/ prefix does not matter */
+  etag_size = strlen(etag);
+  for (; &value[etag_size] <= value_end; value++)
+  {
+    if (strncmp(value, etag, etag_size) == 0)
     {
-      webserver_temp_sensor_read(&temperature_value);
-      sprintf(http_sensor_value, "%g", temperature_value);
-      http_send_response(HTTP_HEADER_SENSOR_ID, socket, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      return true;
     }
-    /* Send read pressure response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_pressure_cmd, http_read_pressure_cmd_size) == 0U)
+  }
+
+  return false;
+}
+
+/**
+  * @brief  Get the byte range requested by the client. Only single ranges are served, multiple ones
+  *         and malformed ones are ignored, as allowed, and the whole body is sent.
+  * @param  request   : parsed request
+  * @param  etag      : quoted entity tag of the body to be sent, NULL if none
+  * @param  body_size : size of the body to be sent
+  * @param  first     : first byte of the range (out)
+  * @param  last      : last byte of the range, included (out)
+  * @retval Range outcome, one of HTTP_RANGE_xxx
+  */
+static uint32_t http_request_range(const http_request_t *request, const char *etag, uint32_t body_size,
+                                   uint32_t *first, uint32_t *last)
+{
+  const char *value     = request->range.data;
+  const char *value_end = &request->range.data[request->range.size];
+  char       *end;
+
+  if ((value == NULL) || (request->range.size < 6U) || (strncasecmp(value, "bytes=", 6) != 0))
+  {
+    return HTTP_RANGE_NONE;
+  }
+  value += 6;
+
+  /* Multiple ranges are not supported */
+  if (memchr(value, ',', (uint32_t)(value_end - value)) != NULL)
+  {
+    return HTTP_RANGE_NONE;
+  }
+
+  /* The range only applies if the client copy is still the current body, a date never matches
+   * as no Last-Modified is sent, and a weak tag never matches a strong comparison */
+  if ((request->if_range.data != NULL) &&
+      ((etag == NULL) || (request->if_range.size != strlen(etag)) ||
+       (strncmp(request->if_range.data, etag, request->if_range.size) != 0)))
+  {
+    return HTTP_RANGE_NONE;
+  }
+
+  if (value[0] == '-')
+  {
+    /* Suffix range: last bytes of the body */
+    *last  = strtoul(&value[1], &end, 10);
+    if ((end == &value[1]) || (end != value_end))
     {
-      webserver_press_sensor_read(&pressure_value);
-      sprintf(http_sensor_value, "%g", pressure_value);
-      http_send_response(HTTP_HEADER_SENSOR_ID, socket, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      return HTTP_RANGE_NONE;
     }
-    /* Send read humidity response */
-    else if (strncmp((char *)&recv_buffer[http_get_cmd_size], http_read_humidity_cmd, http_read_humidity_cmd_size) == 0U)
+    if (*last == 0U)
     {
-      webserver_humid_sensor_read(&humidity_value);
-      sprintf(http_sensor_value, "%g", humidity_value);
-      http_send_response(HTTP_HEADER_SENSOR_ID, socket, http_header_response, http_sensor_value, strlen(http_sensor_value));
+      return HTTP_RANGE_INVALID;
     }
+    *first = (*last < body_size) ? (body_size - *last) : 0U;
+    *last  = body_size - 1U;
   }
   else
   {
-    return HTTP_ERROR;
+    /* First byte, then optional last byte */
+    *first = strtoul(value, &end, 10);
+    if ((end == value) || (*end != '-'))
+    {
+      return HTTP_RANGE_NONE;
+    }
+    value = end + 1;
+
+    *last = body_size - 1U;
+    if (value != value_end)
+    {
+      *last = strtoul(value, &end, 10);
+      if ((end == value) || (end != value_end) || (*last < *first))
+      {
+        return HTTP_RANGE_NONE;
+      }
+      if (*last >= body_size)
+      {
+        *last = body_size - 1U;
+      }
+    }
   }
 
-  /* Close connection socket */
-  if (net_closesocket(socket) != 0U)
+  if ((body_size == 0U) || (*first >= body_size))
   {
-    return HTTP_ERROR;
+    return HTTP_RANGE_INVALID;
   }
 
-  return WEBSERVER_OK;
+  return HTTP_RANGE_PARTIAL;
 }
 
 /**
-  * @brief  HTTP send headers and body responses data via socket
-  * @param  socket       : connection socket
-  * @param  headers_id   : specifies the header ID
-  * @param  headers_buff : pointer to headers buffer
-  * @param  data_size    : size of body web resources
+  * @brief  Route a webserver HTTP request and build its response
+  * @param  request  : parsed request
+  * @param  response : response to be filled
   * @retval Web Server status
   */
-static WebServer_StatusTypeDef http_send_response(uint32_t headers_id,
-                                                  uint32_t socket,
-                                                  char *headers_buff,
-                                                  const char *body_buff,
-                                                  uint32_t data_size)
+static WebServer_StatusTypeDef http_dispatch_request(const http_request_t *request, http_response_t *response)
 {
-  /* Send HTTP header response */
-  if (http_send_headers_response(headers_id, socket, headers_buff, data_size) != WEBSERVER_OK)
+  const http_route_t *route;
+  uint32_t asset_id;
+  uint32_t method;
+
+  /* Methods the server does not implement, the connection stays usable */
+  if (request->method == HTTP_METHOD_UNKNOWN)
   {
-    return HTTP_ERROR;
+    response->metric = webserver_http_metrics_slot(NULL, HTTP_ASSET_NONE);
+    if (webserver_http_encode_error_response(response->header_buffer, HTTP_HEADER_NOT_IMPLEMENTED,
+                                             request->keep_alive) != WEBSERVER_OK)
+    {
+      return HTTP_ERROR;
+    }
+
+    response->header      = response->header_buffer;
+    response->header_size = strlen(response->header_buffer);
+
+    return WEBSERVER_OK;
+  }
+
+  /* A HEAD request is answered as a GET one, the body is dropped afterwards */
+  method = (request->method == HTTP_METHOD_HEAD) ? HTTP_METHOD_GET : request->method;
+
+  /* Look the route up and let its handler answer */
+  route = webserver_http_route_find(method, request->path.data, request->path.size);
+  if (route != NULL)
+  {
+    response->metric = webserver_http_metrics_slot(route, HTTP_ASSET_NONE);
+    return route->handler(route, request, response);
   }
 
-  /* Send HTTP body response */
-  if (http_send(socket, (const char *)body_buff, data_size) != WEBSERVER_OK)
+  /* Then the web page assets */
+  asset_id = (method == HTTP_METHOD_GET) ?
+             webserver_http_asset_find(request->path.data, request->path.size) : HTTP_ASSET_NONE;
+  response->metric = webserver_http_metrics_slot(NULL, asset_id);
+  if (asset_id != HTTP_ASSET_NONE)
   {
-    return HTTP_ERROR;
+    return http_asset_response(asset_id, request, response);
   }
 
-  return WEBSERVER_OK;
+  return http_build_response(HTTP_HEADER_NOTFOUND_ID, response, NULL, 0U, request->keep_alive);
 }
 
 /**
-  * @brief  HTTP send headers responses data via socket
-  * @param  socket       : connection socket
-  * @param  headers_id   : specifies the header ID
-  * @param  headers_buff : pointer to headers buffer
-  * @param  data_size    : size of body web resources
+  * @brief  Answer with a web page asset, content coded when the client accepts one of its coded
+  *         bodies, or a body less 304 response when the client cached copy is still valid, or the
+  *         requested byte range of it
+  * @param  asset_id : asset number
+  * @param  request  : parsed request
+  * @param  response : response to be filled
   * @retval Web Server status
   */
-static WebServer_StatusTypeDef http_send_headers_response(uint32_t socket,
-                                                          uint32_t headers_id,
-                                                          char *headers_buff,
-                                                          uint32_t data_size)
+static WebServer_StatusTypeDef http_asset_response(uint32_t asset_id, const http_request_t *request,
+                                                   http_response_t *response)
 {
-  /* Check header ID */
-  switch(headers_id)
+  char       *header_buffer = response->header_buffer;
+  const http_asset_t *asset = webserver_http_asset_get(asset_id);
+  const http_static_headers_t *headers = &http_asset_headers[asset_id];
+  const char *body      = asset->codings[HTTP_CODING_IDENTITY].body;
+  const char *etag      = asset->codings[HTTP_CODING_IDENTITY].etag;
+  uint32_t   body_size  = asset->codings[HTTP_CODING_IDENTITY].body_size;
+  uint32_t   coding     = HTTP_CODING_IDENTITY;
+  uint32_t   keep_alive = request->keep_alive;
+  uint32_t   first;
+  uint32_t   last;
+
+  /* Pick the densest accepted coding: brotli, then gzip */
+  for (uint32_t i = HTTP_CODING_NBR - 1U; i > HTTP_CODING_IDENTITY; i--)
   {
-    /* Send HTML header response */
-  case HTTP_HEADER_HTML_ID:
+    if ((asset->codings[i].body != NULL) && ((request->accept_codings & HTTP_CODING_MASK(i)) != 0U))
     {
-      if (webserver_http_encode_html_response(headers_buff, data_size) != WEBSERVER_OK)
-      {
-        return HTTP_ERROR;
-      }
-
+      coding    = i;
+      body      = asset->codings[i].body;
+      body_size = asset->codings[i].body_size;
+      etag      = asset->codings[i].etag;
       break;
     }
+  }
 
-    /* Send CSS header response */
-  case HTTP_HEADER_CSS_ID:
+  /* Client copy up to date, send the headers only */
+  if (http_request_not_modified(request, etag))
+  {
+    if ((webserver_http_encode_notmodified_response(header_buffer, request->keep_alive) != WEBSERVER_OK) ||
+        (webserver_http_encode_cache_headers(header_buffer, asset->cache_policy, etag) != WEBSERVER_OK) ||
+        (asset->negotiated &&
+         (webserver_http_encode_content_coding(header_buffer, coding) != WEBSERVER_OK)))
     {
-      if (webserver_http_encode_css_response(headers_buff, data_size) != WEBSERVER_OK)
-      {
-        return HTTP_ERROR;
-      }
-
-      break;
+      return HTTP_ERROR;
     }
 
-    /* Send JS header response */
-  case HTTP_HEADER_JS_ID:
+    response->header      = header_buffer;
+    response->header_size = strlen(header_buffer);
+
+    return WEBSERVER_OK;
+  }
+
+  switch (http_request_range(request, etag, body_size, &first, &last))
+  {
+    /* Send the requested part of the body */
+  case HTTP_RANGE_PARTIAL:
     {
-      if (webserver_http_encode_js_response(headers_buff, data_size) != WEBSERVER_OK)
+      if ((webserver_http_encode_asset_response(header_buffer, asset->content_type, last - first + 1U,
+                                                request->keep_alive) != WEBSERVER_OK) ||
+          (webserver_http_encode_partial_content(header_buffer, first, last, body_size) != WEBSERVER_OK) ||
+          (webserver_http_encode_cache_headers(header_buffer, asset->cache_policy, etag) != WEBSERVER_OK) ||
+          (asset->negotiated &&
+           (webserver_http_encode_content_coding(header_buffer, coding) != WEBSERVER_OK)))
       {
         return HTTP_ERROR;
       }
 
-      break;
+      response->header      = header_buffer;
+      response->header_size = strlen(header_buffer);
+      response->body        = &body[first];
+      response->body_size   = last - first + 1U;
+
+      return WEBSERVER_OK;
     }
 
-    /* Send favicon header response */
-  case HTTP_HEADER_FAVICON_ID:
+    /* Send the body size only */
+  case HTTP_RANGE_INVALID:
     {
-      if (webserver_http_encode_favicon_response(headers_buff, data_size) != WEBSERVER_OK)
+      if (webserver_http_encode_rangeinvalid_response(header_buffer, body_size,
+                                                      request->keep_alive) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
 
-      break;
+      response->header      = header_buffer;
+      response->header_size = strlen(header_buffer);
+
+      return WEBSERVER_OK;
     }
 
-    /* Send font header response */
-  case HTTP_HEADER_FONT_ID:
+    /* Send the whole body */
+  default:
+    break;
+  }
+
+  /* Send the header block built at start up, then the body */
+  response->header      = headers->block[coding][keep_alive];
+  response->header_size = headers->block_size[coding][keep_alive];
+  response->body        = body;
+  response->body_size   = body_size;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Read a sensor and answer with its value
+  * @param  route    : matched route
+  * @param  request  : parsed request
+  * @param  response : response to be filled
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_sensor_handler(const http_route_t *route, const http_request_t *request,
+                                                      http_response_t *response)
+{
+  float    value = 0;
+  uint32_t size;
+
+  route->read(&value);
+  size = webserver_http_float_format(value, response->body_buffer);
+
+  return http_build_response(route->headers_id, response, response->body_buffer, size, request->keep_alive);
+}
+
+/**
+  * @brief  Read the sensors selected by the request and answer with a JSON document of their values
+  * @param  route    : matched route
+  * @param  request  : parsed request
+  * @param  response : response to be filled
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_api_handler(const http_route_t *route, const http_request_t *request,
+                                                   http_response_t *response)
+{
+  webserver_http_api_sensors_start(request, &response->writer);
+
+  return http_build_writer_response(route->headers_id, response, request->keep_alive && response->writer.chunked);
+}
+
+/**
+  * @brief  Answer with the server metrics, in the Prometheus text format
+  * @param  route    : matched route
+  * @param  request  : parsed request
+  * @param  response : response to be filled
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_metrics_handler(const http_route_t *route, const http_request_t *request,
+                                                       http_response_t *response)
+{
+  webserver_http_metrics_start(request, &response->writer);
+
+  return http_build_writer_response(route->headers_id, response, request->keep_alive && response->writer.chunked);
+}
+
+/**
+  * @brief  Answer with a server-sent events stream of the sensors selected by the request
+  * @param  route    : matched route
+  * @param  request  : parsed request
+  * @param  response : response to be filled, its stream is sent once the header is
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_events_handler(const http_route_t *route, const http_request_t *request,
+                                                      http_response_t *response)
+{
+  webserver_http_api_stream_open(request, &response->stream);
+
+  /* Start with the reconnection delay, the events follow as they are due */
+  snprintf(response->body_buffer, HTTP_SENSORS_BUFFER_SIZE, "retry: %u\n\n", HTTP_EVENTS_RETRY);
+
+  return http_build_response(route->headers_id, response, response->body_buffer,
+                             strlen(response->body_buffer), true);
+}
+
+/**
+  * @brief  Upgrade the connection to a WebSocket streaming the motion samples
+  * @param  route    : matched route
+  * @param  request  : parsed request
+  * @param  response : response to be filled, its stream is sent once the header is
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_ws_handler(const http_route_t *route, const http_request_t *request,
+                                                  http_response_t *response)
+{
+  char accept[HTTP_WS_ACCEPT_SIZE + 1U];
+
+  (void)route;
+
+  /* Not a valid opening handshake, or not a supported version */
+  if ((request->method != HTTP_METHOD_GET) || !request->http_1_1 || !http_request_has_token(&request->upgrade, "websocket") ||
+      !http_request_has_token(&request->connection, "upgrade") ||
+      (request->ws_version.size != 2U) || (strncmp(request->ws_version.data, "13", 2U) != 0) ||
+      (webserver_http_ws_accept(&request->ws_key, accept) != WEBSERVER_OK))
+  {
+    if (webserver_http_encode_badrequest_response(response->header_buffer, request->keep_alive) != WEBSERVER_OK)
     {
-      if (webserver_http_encode_woff2_response(headers_buff, data_size) != WEBSERVER_OK)
+      return HTTP_ERROR;
+    }
+
+    response->header      = response->header_buffer;
+    response->header_size = strlen(response->header_buffer);
+
+    return WEBSERVER_OK;
+  }
+
+  if (webserver_http_encode_switching_response(response->header_buffer, accept) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  response->header      = response->header_buffer;
+  response->header_size = strlen(response->header_buffer);
+
+  webserver_http_api_motion_open(request, &response->stream);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Build once the complete header blocks of the web page assets, for each available content
+  *         coding and both connection behaviours, so that serving an asset needs no string processing.
+  * @param  None
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_build_static_headers(void)
+{
+  const http_asset_t *asset;
+  http_static_headers_t *headers;
+  uint32_t keep_alive;
+
+  for (uint32_t i = 0U; i < webserver_http_assets_count(); i++)
+  {
+    asset   = webserver_http_asset_get(i);
+    headers = &http_asset_headers[i];
+
+    for (uint32_t coding = HTTP_CODING_IDENTITY; coding < HTTP_CODING_NBR; coding++)
+    {
+      if (asset->codings[coding].body == NULL)
       {
-        return HTTP_ERROR;
+        continue;
       }
 
-      break;
+      for (keep_alive = 0U; keep_alive < 2U; keep_alive++)
+      {
+        if (webserver_http_encode_asset_response(http_header_response, asset->content_type,
+                                                 asset->codings[coding].body_size, (bool)keep_alive) != WEBSERVER_OK)
+        {
+          return HTTP_ERROR;
+        }
+
+        /* Cache policy and validator of the body */
+        if (webserver_http_encode_cache_headers(http_header_response, asset->cache_policy,
+                                                asset->codings[coding].etag) != WEBSERVER_OK)
+        {
+          return HTTP_ERROR;
+        }
+
+        /* Negotiated assets tell caches which coding they got */
+        if (asset->negotiated &&
+            (webserver_http_encode_content_coding(http_header_response, coding) != WEBSERVER_OK))
+        {
+          return HTTP_ERROR;
+        }
+
+        headers->block_size[coding][keep_alive] = strlen(http_header_response);
+        if (headers->block_size[coding][keep_alive] >= HTTP_STATIC_HEADERS_SIZE)
+        {
+          return HTTP_ERROR;
+        }
+
+        memcpy(headers->block[coding][keep_alive], http_header_response, headers->block_size[coding][keep_alive] + 1U);
+      }
     }
+  }
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  HTTP build headers and body responses
+  * @param  headers_id   : specifies the header ID
+  * @param  response     : response to be filled
+  * @param  body_buff    : pointer to body buffer
+  * @param  data_size    : size of body web resources
+  * @param  keep_alive   : keep the connection open after the response
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_build_response(uint32_t headers_id,
+                                                   http_response_t *response,
+                                                   const char *body_buff,
+                                                   uint32_t data_size,
+                                                   bool keep_alive)
+{
+  /* Build HTTP header response */
+  if (http_encode_headers(headers_id, response->header_buffer, data_size, keep_alive) != WEBSERVER_OK)
+  {
+    return HTTP_ERROR;
+  }
+
+  response->header      = response->header_buffer;
+  response->header_size = strlen(response->header_buffer);
+  response->body        = body_buff;
+  response->body_size   = data_size;
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  HTTP build headers responses of a body produced by the response writer
+  * @param  headers_id   : specifies the header ID
+  * @param  response     : response to be filled, its writer started
+  * @param  keep_alive   : keep the connection open after the response, only possible with a chunked body
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_build_writer_response(uint32_t headers_id,
+                                                          http_response_t *response,
+                                                          bool keep_alive)
+{
+  /* Build HTTP header response, without content length */
+  if ((http_encode_headers(headers_id, response->header_buffer, 0U, keep_alive) != WEBSERVER_OK) ||
+      (webserver_http_encode_transfer_chunked(response->header_buffer, response->writer.chunked) != WEBSERVER_OK))
+  {
+    return HTTP_ERROR;
+  }
+
+  /* The body follows, piece by piece */
+  response->header      = response->header_buffer;
+  response->header_size = strlen(response->header_buffer);
+  response->body        = NULL;
+  response->body_size   = 0U;
 
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  HTTP build headers responses
+  * @param  headers_id   : specifies the header ID
+  * @param  headers_buff : pointer to headers buffer
+  * @param  data_size    : size of body web resources
+  * @param  keep_alive   : keep the connection open after the response
+  * @retval Web Server status
+  */
+static WebServer_StatusTypeDef http_encode_headers(uint32_t headers_id,
+                                                   char *headers_buff,
+                                                   uint32_t data_size,
+                                                   bool keep_alive)
+{
+  /* Check header ID */
+  switch(headers_id)
+  {
     /* Send sensor header response */
   case HTTP_HEADER_SENSOR_ID:
     {
-      if (webserver_http_encode_sensor_response(headers_buff, data_size) != WEBSERVER_OK)
+      if (webserver_http_encode_sensor_response(headers_buff, data_size, keep_alive) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
@@ -346,7 +957,7 @@ static WebServer_StatusTypeDef http_send_headers_response(uint32_t socket,
     /* Send JSON header response */
   case HTTP_HEADER_JSON_ID:
     {
-      if (webserver_http_encode_json_response(headers_buff, data_size) != WEBSERVER_OK)
+      if (webserver_http_encode_json_response(headers_buff, data_size, keep_alive) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
@@ -354,10 +965,10 @@ static WebServer_StatusTypeDef http_send_headers_response(uint32_t socket,
       break;
     }
 
-    /* Send image header response */
-  case HTTP_HEADER_IMAGE_ID:
+    /* Send metrics header response */
+  case HTTP_HEADER_METRICS_ID:
     {
-      if (webserver_http_encode_image_response(headers_buff, data_size) != WEBSERVER_OK)
+      if (webserver_http_encode_metrics_response(headers_buff, data_size, keep_alive) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
@@ -365,62 +976,32 @@ static WebServer_StatusTypeDef http_send_headers_response(uint32_t socket,
       break;
     }
 
-    /* Invalid header ID */
-  default:
-    return HTTP_ERROR;
-    break;
-  }
-
-  /* Send HTTP built response */
-  if (http_send(socket, (const char *)headers_buff, strlen((char*)headers_buff)) != WEBSERVER_OK)
-  {
-    return HTTP_ERROR;
-  }
-
-  return WEBSERVER_OK;
-}
-
-/**
-  * @brief  HTTP send data via socket
-  * @param  socket      : connection socket
-  * @param  frame       : pointer to frame to be sent
-  * @param  frame_size  : size of frame to be sent
-  * @retval Web Server status
-  */
-static WebServer_StatusTypeDef http_send(uint32_t socket,
-                                         const char *frame,
-                                         uint32_t frame_size)
-{
-  /* Setup send information */
-  uint32_t data_size = frame_size;
-  uint32_t data_idx  = 0U;
-
-  /* Check remaining data */
-  while (data_size > 0U)
-  {
-    if (data_size >= MAX_SOCKET_DATASIZE)
+    /* Send not found header response */
+  case HTTP_HEADER_NOTFOUND_ID:
     {
-      /* Send data */
-      if (net_send(socket, (uint8_t*)&frame[data_idx], MAX_SOCKET_DATASIZE, 0) <= 0U)
+      if (webserver_http_encode_notfound_response(headers_buff, data_size, keep_alive) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
 
-      /* Update send information */
-      data_size -= MAX_SOCKET_DATASIZE;
-      data_idx += MAX_SOCKET_DATASIZE;
+      break;
     }
-    else
+
+    /* Send events stream header response */
+  case HTTP_HEADER_EVENTS_ID:
     {
-      /* Send data */
-      if (net_send(socket, (uint8_t*)&frame[data_idx], data_size, 0) <= 0U)
+      if (webserver_http_encode_events_response(headers_buff) != WEBSERVER_OK)
       {
         return HTTP_ERROR;
       }
 
-      /* Update send information */
-      data_size = 0U;
+      break;
     }
+
+    /* Invalid header ID */
+  default:
+    return HTTP_ERROR;
+    break;
   }
 
   return WEBSERVER_OK;
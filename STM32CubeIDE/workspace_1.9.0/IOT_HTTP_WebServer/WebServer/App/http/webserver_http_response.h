@@ -23,6 +23,7 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver.h"
 #include "webserver_http_cmd.h"
+#include "webserver_http_routes.h"
 #include "res.h"
 
 /* Exported types ----------------------------------------------------------------------------------------------------*/
@@ -30,5 +31,16 @@
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
 WebServer_StatusTypeDef webserver_http_start(void);
+WebServer_StatusTypeDef webserver_http_process(http_request_t *request, http_response_t *response);
+WebServer_StatusTypeDef webserver_http_sensor_handler(const http_route_t *route, const http_request_t *request,
+                                                      http_response_t *response);
+WebServer_StatusTypeDef webserver_http_api_handler(const http_route_t *route, const http_request_t *request,
+                                                   http_response_t *response);
+WebServer_StatusTypeDef webserver_http_events_handler(const http_route_t *route, const http_request_t *request,
+                                                      http_response_t *response);
+WebServer_StatusTypeDef webserver_http_metrics_handler(const http_route_t *route, const http_request_t *request,
+                                                       http_response_t *response);
+WebServer_StatusTypeDef webserver_http_ws_handler(const http_route_t *route, const http_request_t *request,
+                                                  http_response_t *response);
 
 #endif /* WEBSERVER_HTTP_RESPONSE_H */
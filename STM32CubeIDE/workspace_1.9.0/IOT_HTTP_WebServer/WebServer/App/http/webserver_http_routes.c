@@ -0,0 +1,213 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_routes.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server http route table and dispatch lookup
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_routes.h"
+#include "webserver_http_response.h"
+#include "webserver_sensors.h"
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/* Private define ----------------------------------------------------------------------------------------------------*/
+#define HTTP_ROUTE_INDEX_BITS        (6U)
+#define HTTP_ROUTE_INDEX_SIZE        (1UL << HTTP_ROUTE_INDEX_BITS) /* At least twice the number of routes */
+#define HTTP_ROUTE_INDEX_EMPTY       (0xFFU)
+#define HTTP_ROUTE_SEED_MAX          (0x1000U)  /* Seeds tried per pair of key bytes to build a collision free index */
+#define HTTP_ROUTE_SEED_STEP         (0x9E3779B9U)
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Route index, maps a hash slot to a route table entry */
+static uint8_t  http_route_index[HTTP_ROUTE_INDEX_SIZE];
+
+/* Key of a route: method, path length and the path bytes at two positions, shorter than the shortest path. The
+   seed multiplying it gives a collision free route index. */
+static uint32_t http_route_seed;
+static uint32_t http_route_pos[2];
+static uint32_t http_route_path_min;
+
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+/* HTTP route table */
+const http_route_t http_routes[] =
+{
+  /* Sensors values */
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/Read_Temperature"), webserver_http_sensor_handler, HTTP_HEADER_SENSOR_ID,
+   webserver_temp_sensor_read},
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/Read_Pressure"), webserver_http_sensor_handler, HTTP_HEADER_SENSOR_ID,
+   webserver_press_sensor_read},
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/Read_Humidity"), webserver_http_sensor_handler, HTTP_HEADER_SENSOR_ID,
+   webserver_humid_sensor_read},
+
+  /* All sensors values, as one JSON document */
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/api/sensors"), webserver_http_api_handler, HTTP_HEADER_JSON_ID, NULL},
+
+  /* Sensors values pushed as server-sent events */
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/api/events"), webserver_http_events_handler, HTTP_HEADER_EVENTS_ID, NULL},
+
+  /* Motion samples pushed over a WebSocket */
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/api/motion"), webserver_http_ws_handler, HTTP_HEADER_WEBSOCKET_ID, NULL},
+
+  /* Server metrics, in the Prometheus text format */
+  {HTTP_METHOD_GET, HTTP_ROUTE_PATH("/metrics"), webserver_http_metrics_handler, HTTP_HEADER_METRICS_ID, NULL},
+};
+
+const uint32_t http_routes_size = sizeof(http_routes) / sizeof(http_routes[0]);
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static uint32_t http_route_slot(uint32_t method, const char *path, uint32_t path_size);
+static bool http_route_index_build(void);
+
+/* Private functions -------------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Get the route index slot of a request: its key multiplied by the seed, top bits
+  * @param  method    : HTTP method
+  * @param  path      : pointer to request path, at least http_route_path_min long
+  * @param  path_size : request path length
+  * @retval Route index slot
+  */
+static uint32_t http_route_slot(uint32_t method, const char *path, uint32_t path_size)
+{
+  uint32_t key = (method << 24) | ((path_size & 0xFFU) << 16) | ((uint32_t)(uint8_t)path[http_route_pos[0]] << 8) |
+                 (uint8_t)path[http_route_pos[1]];
+
+  return (key * http_route_seed) >> (32U - HTTP_ROUTE_INDEX_BITS);
+}
+
+/**
+  * @brief  Fill the route index with the current key positions and seed
+  * @param  None
+  * @retval true if every route has its own slot, false on a collision
+  */
+static bool http_route_index_build(void)
+{
+  uint32_t slot;
+
+  memset(http_route_index, HTTP_ROUTE_INDEX_EMPTY, sizeof(http_route_index));
+
+  for (uint32_t route = 0U; route < http_routes_size; route++)
+  {
+    slot = http_route_slot(http_routes[route].method, http_routes[route].path, http_routes[route].path_size);
+    if (http_route_index[slot] != HTTP_ROUTE_INDEX_EMPTY)
+    {
+      return false;
+    }
+
+    http_route_index[slot] = (uint8_t)route;
+  }
+
+  return true;
+}
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Build the route index: look for two path byte positions and a seed placing every route in its own
+  *         slot, so that a lookup costs two byte reads, a multiply and one compare, whatever the number of routes
+  *         and the path length.
+  * @param  None
+  * @retval Web Server status
+  */
+WebServer_StatusTypeDef webserver_http_routes_init(void)
+{
+  if ((http_routes_size == 0U) || (http_routes_size > (HTTP_ROUTE_INDEX_SIZE / 2U)))
+  {
+    return HTTP_ERROR;
+  }
+
+  /* Key bytes are read before the length is known to match, only within the shortest path */
+  http_route_path_min = UINT32_MAX;
+  for (uint32_t route = 0U; route < http_routes_size; route++)
+  {
+    if (http_routes[route].path_size < http_route_path_min)
+    {
+      http_route_path_min = http_routes[route].path_size;
+    }
+  }
+
+  for (http_route_pos[1] = 0U; http_route_pos[1] < http_route_path_min; http_route_pos[1]++)
+  {
+    for (http_route_pos[0] = 0U; http_route_pos[0] <= http_route_pos[1]; http_route_pos[0]++)
+    {
+      http_route_seed = HTTP_ROUTE_SEED_STEP;
+      for (uint32_t i = 0U; i < HTTP_ROUTE_SEED_MAX; i++)
+      {
+        if (http_route_index_build())
+        {
+          return WEBSERVER_OK;
+        }
+        http_route_seed += 2U * HTTP_ROUTE_SEED_STEP;
+      }
+    }
+  }
+
+  return HTTP_ERROR;
+}
+
+/**
+  * @brief  Get the HTTP method ID of a request method token
+  * @param  method      : pointer to method token
+  * @param  method_size : method token length
+  * @retval HTTP method ID, HTTP_METHOD_UNKNOWN if not supported
+  */
+uint32_t webserver_http_route_method(const char *method, uint32_t method_size)
+{
+  if ((method_size == 3U) && (strncmp(method, "GET", 3U) == 0))
+  {
+    return HTTP_METHOD_GET;
+  }
+
+  if ((method_size == 4U) && (strncmp(method, "HEAD", 4U) == 0))
+  {
+    return HTTP_METHOD_HEAD;
+  }
+
+  return HTTP_METHOD_UNKNOWN;
+}
+
+/**
+  * @brief  Find the route matching a request
+  * @param  method    : HTTP method ID
+  * @param  path      : pointer to request path, query string excluded
+  * @param  path_size : request path length
+  * @retval Pointer to the matching route, NULL if none
+  */
+const http_route_t *webserver_http_route_find(uint32_t method, const char *path, uint32_t path_size)
+{
+  const http_route_t *route;
+  uint32_t slot;
+
+  if (path_size < http_route_path_min)
+  {
+    return NULL;
+  }
+
+  slot = http_route_slot(method, path, path_size);
+  if (http_route_index[slot] == HTTP_ROUTE_INDEX_EMPTY)
+  {
+    return NULL;
+  }
+
+  /* A single candidate per slot, confirm the key */
+  route = &http_routes[http_route_index[slot]];
+  if ((route->method != method) || (route->path_size != path_size) || (memcmp(route->path, path, path_size) != 0))
+  {
+    return NULL;
+  }
+
+  return route;
+}
@@ -0,0 +1,197 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_routes.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_routes.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_ROUTES_H
+#define WEBSERVER_HTTP_ROUTES_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "webserver_status.h"
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Size of a prebuilt static resource header block */
+#define HTTP_STATIC_HEADERS_SIZE     (448U)
+
+/* Size of the request and response buffers of a connection */
+#define HTTP_RECEIVE_BUFFER_SIZE     (4096U)
+#define HTTP_HEADERS_BUFFER_SIZE     (500U)
+#define HTTP_SENSORS_BUFFER_SIZE     (640U)
+
+/* HTTP response content codings */
+#define HTTP_CODING_IDENTITY         (0U)
+#define HTTP_CODING_GZIP             (1U)
+#define HTTP_CODING_BR               (2U)
+#define HTTP_CODING_NBR              (3U)
+
+/* Bit of a content coding in an accepted codings mask */
+#define HTTP_CODING_MASK(coding)     (1UL << (coding))
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+typedef struct http_route_s http_route_t;
+
+/**
+  * @brief  Complete response header blocks of a static resource, built once at start up.
+  *         First index is the content coding, second one is 0 to close the connection, 1 to keep it alive.
+  */
+typedef struct
+{
+  char     block[HTTP_CODING_NBR][2][HTTP_STATIC_HEADERS_SIZE];
+  uint32_t block_size[HTTP_CODING_NBR][2];
+} http_static_headers_t;
+
+/**
+  * @brief  Part of a request, pointing into the receive buffer, not null terminated
+  */
+typedef struct
+{
+  const char *data;                            /*!< First character, NULL if absent                   */
+  uint32_t   size;                             /*!< Length                                            */
+} http_slice_t;
+
+/**
+  * @brief  Parsed HTTP request, as seen by route handlers
+  */
+typedef struct
+{
+  const char   *header;                        /*!< Request header, end of headers included           */
+  uint32_t     header_size;                    /*!< Request header length                             */
+  uint32_t     method;                         /*!< HTTP method, one of HTTP_METHOD_xxx               */
+  http_slice_t path;                           /*!< Absolute request path, query string excluded      */
+  http_slice_t query;                          /*!< Query string, '?' excluded                        */
+  bool         http_1_1;                       /*!< HTTP/1.1 request, HTTP/1.0 otherwise              */
+  http_slice_t accept_encoding;                /*!< Accept-Encoding header field value                */
+  http_slice_t connection;                     /*!< Connection header field value                     */
+  http_slice_t content_length;                 /*!< Content-Length header field value                 */
+  http_slice_t if_none_match;                  /*!< If-None-Match header field value                  */
+  http_slice_t if_range;                       /*!< If-Range header field value                       */
+  http_slice_t range;                          /*!< Range header field value                          */
+  http_slice_t last_event_id;                  /*!< Last-Event-ID header field value                  */
+  http_slice_t upgrade;                        /*!< Upgrade header field value                        */
+  http_slice_t ws_key;                         /*!< Sec-WebSocket-Key header field value              */
+  http_slice_t ws_version;                     /*!< Sec-WebSocket-Version header field value          */
+  http_slice_t transfer_encoding;              /*!< Transfer-Encoding header field value              */
+  uint32_t     accept_codings;                 /*!< Accepted content codings, HTTP_CODING_MASK() bits */
+  bool         keep_alive;                     /*!< Keep the connection open after the response       */
+} http_request_t;
+
+/**
+  * @brief  Stream of sensor samples, sent by a connection once the response header is
+  */
+typedef struct
+{
+  uint32_t type;                               /*!< Stream type, one of HTTP_STREAM_xxx               */
+  uint32_t period;                             /*!< Time in ms between two samples                    */
+  uint32_t fields;                             /*!< Sensors sent in each event                        */
+  uint32_t event_id;                           /*!< Id of the last event sent                         */
+  uint32_t event_tick;                         /*!< Tick the last sample was due at                   */
+  uint32_t sample_count;                       /*!< Samples held in the batch being built             */
+  uint32_t batch_tick;                         /*!< Tick of the first sample of the batch             */
+} http_stream_t;
+
+typedef struct http_writer_s http_writer_t;
+
+/**
+  * @brief  Body producer of a response whose length is not known up front. It writes as much of the body as
+  *         fits the writer, and is called again each time the previous piece is sent.
+  * @retval true once the whole body is written, false otherwise
+  */
+typedef bool (*http_writer_fill_t)(http_writer_t *writer);
+
+/**
+  * @brief  Body writer, sends a body piece by piece so that it never needs to be held whole in memory
+  */
+struct http_writer_s
+{
+  http_writer_fill_t fill;                     /*!< Body producer, NULL if the body is known up front */
+  uint32_t   context;                          /*!< Producer argument                                 */
+  uint32_t   cursor;                           /*!< Producer position in the body                     */
+  bool       chunked;                          /*!< Chunked transfer coding, raw until closed if not  */
+  bool       done;                             /*!< Last piece produced                               */
+  char       *data;                            /*!< Piece being written                               */
+  uint32_t   size;                             /*!< Piece size                                        */
+  uint32_t   length;                           /*!< Piece length written so far                       */
+};
+
+/**
+  * @brief  HTTP response, as filled by route handlers. Header and body are sent in this order by the
+  *         connection they belong to, they must stay valid until then.
+  */
+typedef struct
+{
+  char       *header_buffer;                   /*!< Header scratch buffer, HTTP_HEADERS_BUFFER_SIZE   */
+  char       *body_buffer;                     /*!< Body scratch buffer, HTTP_SENSORS_BUFFER_SIZE     */
+  const char *header;                          /*!< Response header                                   */
+  uint32_t   header_size;                      /*!< Response header length                            */
+  const char *body;                            /*!< Response body, NULL if none                       */
+  uint32_t   body_size;                        /*!< Response body length                              */
+  http_stream_t stream;                        /*!< Stream following the response, if any             */
+  http_writer_t writer;                        /*!< Body writer, if the body is not known up front    */
+  uint32_t   metric;                           /*!< Metrics slot the request is accounted in          */
+  bool       failed;                           /*!< Error status, 4xx or 5xx                          */
+} http_response_t;
+
+/**
+  * @brief  HTTP route handler, builds the full response of a matched route
+  */
+typedef WebServer_StatusTypeDef (*http_route_handler_t)(const http_route_t *route, const http_request_t *request,
+                                                        http_response_t *response);
+
+/**
+  * @brief  HTTP route definition
+  */
+struct http_route_s
+{
+  uint32_t             method;                 /*!< HTTP method, one of HTTP_METHOD_xxx               */
+  const char           *path;                  /*!< Absolute request path, query string excluded      */
+  uint32_t             path_size;              /*!< Request path length                               */
+  http_route_handler_t handler;                /*!< Response handler                                  */
+  uint32_t             headers_id;             /*!< Response content type, one of HTTP_HEADER_xxx_ID  */
+  int                  (*read)(float *value);  /*!< Sensor read function, if any                      */
+};
+
+/* HTTP request methods */
+#define HTTP_METHOD_GET              (0U)
+#define HTTP_METHOD_HEAD             (1U)
+#define HTTP_METHOD_UNKNOWN          (0xFFU)
+
+/* Streams following a response */
+#define HTTP_STREAM_NONE             (0U)       /* Plain response                                     */
+#define HTTP_STREAM_EVENTS           (1U)       /* Server-sent events of JSON sensor values           */
+#define HTTP_STREAM_WEBSOCKET        (2U)       /* WebSocket binary frames of motion samples          */
+
+/* HTTP response cache policies */
+#define HTTP_CACHE_NONE              (0U)       /* No cache header                                    */
+#define HTTP_CACHE_NO_CACHE          (1U)       /* Cached, revalidated before each use                */
+#define HTTP_CACHE_MAX_AGE           (2U)       /* Cached, used without revalidation for a day        */
+
+/* Exported variables ------------------------------------------------------------------------------------------------*/
+extern const http_route_t http_routes[];
+extern const uint32_t     http_routes_size;
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Expand a constant path string into the path and path_size route fields */
+#define HTTP_ROUTE_PATH(path)        (path), (sizeof(path) - 1U)
+
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+WebServer_StatusTypeDef webserver_http_routes_init(void);
+uint32_t webserver_http_route_method(const char *method, uint32_t method_size);
+const http_route_t *webserver_http_route_find(uint32_t method, const char *path, uint32_t path_size);
+
+#endif /* WEBSERVER_HTTP_ROUTES_H */
@@ -0,0 +1,164 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_writer.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server http body writer.
+  *          A handler that cannot tell its body length up front starts a writer with a producer instead of
+  *          building the body. Each time the previous piece is sent, the connection asks the writer for the
+  *          next one: the producer fills the connection body buffer, and the piece is sent as one chunk of
+  *          the chunked transfer coding. Memory use is thus bounded by the body buffer, whatever the body size.
+  *          HTTP/1.0 clients get the raw body, delimited by the connection close.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_writer.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Chunk framing: size line before the data, line end after it, last chunk after the last piece */
+#define HTTP_WRITER_SIZE_DIGITS      (4U)       /* Hexadecimal digits, pieces are less than 64 KB     */
+#define HTTP_WRITER_SIZE_LINE        (HTTP_WRITER_SIZE_DIGITS + 2U)
+#define HTTP_WRITER_DATA_END         "\r\n"
+#define HTTP_WRITER_LAST_CHUNK       "0\r\n\r\n"
+#define HTTP_WRITER_FRAMING_SIZE     (HTTP_WRITER_SIZE_LINE + sizeof(HTTP_WRITER_DATA_END) - 1U + \
+                                      sizeof(HTTP_WRITER_LAST_CHUNK) - 1U)
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+/* Private variables -------------------------------------------------------------------------------------------------*/
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Start a writer
+  * @param  writer  : writer
+  * @param  fill    : body producer
+  * @param  context : producer argument
+  * @param  chunked : send the body with the chunked transfer coding, raw if not
+  * @retval None
+  */
+void webserver_http_writer_start(http_writer_t *writer, http_writer_fill_t fill, uint32_t context, bool chunked)
+{
+  memset(writer, 0, sizeof(http_writer_t));
+
+  writer->fill    = fill;
+  writer->context = context;
+  writer->chunked = chunked;
+}
+
+/**
+  * @brief  Write data to the piece being produced, all of it or nothing
+  * @param  writer    : writer
+  * @param  data      : data
+  * @param  data_size : data length
+  * @retval true if the data is written, false if it does not fit and must be written to the next piece
+  */
+bool webserver_http_writer_write(http_writer_t *writer, const char *data, uint32_t data_size)
+{
+  if (data_size > (writer->size - writer->length))
+  {
+    return false;
+  }
+
+  memcpy(&writer->data[writer->length], data, data_size);
+  writer->length += data_size;
+
+  return true;
+}
+
+/**
+  * @brief  Write formatted data to the piece being produced, all of it or nothing
+  * @param  writer : writer
+  * @param  format : printf format
+  * @retval true if the data is written, false if it does not fit and must be written to the next piece
+  */
+bool webserver_http_writer_printf(http_writer_t *writer, const char *format, ...)
+{
+  uint32_t free_size = writer->size - writer->length;
+  va_list  args;
+  int      ret;
+
+  /* One more byte for the null character, it is overwritten by the next write */
+  va_start(args, format);
+  ret = vsnprintf(&writer->data[writer->length], free_size + 1U, format, args);
+  va_end(args);
+
+  if ((ret < 0) || ((uint32_t)ret > free_size))
+  {
+    return false;
+  }
+  writer->length += (uint32_t)ret;
+
+  return true;
+}
+
+/**
+  * @brief  Produce the next piece of the body, framed as a chunk
+  * @param  writer      : writer
+  * @param  buffer      : piece buffer
+  * @param  buffer_size : piece buffer size, the framing takes 13 bytes of it
+  * @param  size        : piece length (out)
+  * @retval Web Server status, HTTP_ERROR if the producer cannot progress
+  */
+WebServer_StatusTypeDef webserver_http_writer_next(http_writer_t *writer, char *buffer, uint32_t buffer_size,
+                                                   uint32_t *size)
+{
+  uint32_t data_offset = writer->chunked ? HTTP_WRITER_SIZE_LINE : 0U;
+  uint32_t framing_size = writer->chunked ? HTTP_WRITER_FRAMING_SIZE : 0U;
+  char     size_line[HTTP_WRITER_SIZE_LINE + 1U];
+
+  if (buffer_size <= framing_size)
+  {
+    return HTTP_ERROR;
+  }
+
+  /* The null character of a formatted write needs one more byte */
+  writer->data   = &buffer[data_offset];
+  writer->size   = buffer_size - framing_size - 1U;
+  writer->length = 0U;
+  writer->done   = writer->fill(writer);
+
+  /* Each call must either progress or end the body */
+  if ((writer->length == 0U) && !writer->done)
+  {
+    return HTTP_ERROR;
+  }
+
+  if (!writer->chunked)
+  {
+    *size = writer->length;
+    return WEBSERVER_OK;
+  }
+
+  /* An empty chunk would end the body, an empty last piece is the last chunk alone */
+  *size = 0U;
+  if (writer->length > 0U)
+  {
+    (void)snprintf(size_line, sizeof(size_line), "%0*lX\r\n", (int)HTTP_WRITER_SIZE_DIGITS,
+                   (unsigned long)writer->length);
+    memcpy(buffer, size_line, HTTP_WRITER_SIZE_LINE);
+    memcpy(&buffer[HTTP_WRITER_SIZE_LINE + writer->length], HTTP_WRITER_DATA_END, sizeof(HTTP_WRITER_DATA_END) - 1U);
+    *size = HTTP_WRITER_SIZE_LINE + writer->length + sizeof(HTTP_WRITER_DATA_END) - 1U;
+  }
+
+  if (writer->done)
+  {
+    memcpy(&buffer[*size], HTTP_WRITER_LAST_CHUNK, sizeof(HTTP_WRITER_LAST_CHUNK) - 1U);
+    *size += sizeof(HTTP_WRITER_LAST_CHUNK) - 1U;
+  }
+
+  return WEBSERVER_OK;
+}
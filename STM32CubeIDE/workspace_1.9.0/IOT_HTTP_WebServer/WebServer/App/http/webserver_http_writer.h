@@ -0,0 +1,39 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_writer.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_writer.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_WRITER_H
+#define WEBSERVER_HTTP_WRITER_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "webserver_status.h"
+#include "webserver_http_routes.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+void webserver_http_writer_start(http_writer_t *writer, http_writer_fill_t fill, uint32_t context, bool chunked);
+bool webserver_http_writer_write(http_writer_t *writer, const char *data, uint32_t data_size);
+bool webserver_http_writer_printf(http_writer_t *writer, const char *format, ...);
+WebServer_StatusTypeDef webserver_http_writer_next(http_writer_t *writer, char *buffer, uint32_t buffer_size,
+                                                   uint32_t *size);
+
+#endif /* WEBSERVER_HTTP_WRITER_H */
@@ -0,0 +1,337 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_ws.c
+  * @author  MCD Application Team
+  * @brief   This file implements the web server WebSocket protocol (RFC 6455): opening handshake key, frame
+  *          headers sent by the server and frames received from a client.
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include "webserver_http_ws.h"
+#include <string.h>
+
+/* Private typedef ---------------------------------------------------------------------------------------------------*/
+/* Private define ----------------------------------------------------------------------------------------------------*/
+/* Length of a Sec-WebSocket-Key header field value, base64 encoded 16 bytes nonce */
+#define HTTP_WS_KEY_SIZE             (24U)
+
+/* GUID appended to the client key before hashing it */
+#define HTTP_WS_GUID                 "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+/* SHA-1 block and digest sizes */
+#define HTTP_WS_SHA1_BLOCK_SIZE      (64U)
+#define HTTP_WS_SHA1_DIGEST_SIZE     (20U)
+
+/* Frame header bits */
+#define HTTP_WS_FIN                  (0x80U)
+#define HTTP_WS_RSV                  (0x70U)
+#define HTTP_WS_OPCODE               (0x0FU)
+#define HTTP_WS_MASK                 (0x80U)
+#define HTTP_WS_LENGTH               (0x7FU)
+#define HTTP_WS_LENGTH_16            (126U)     /* 16 bits extended payload length follows            */
+#define HTTP_WS_LENGTH_64            (127U)     /* 64 bits extended payload length follows            */
+
+/* Private macro -----------------------------------------------------------------------------------------------------*/
+#define HTTP_WS_ROTL(value, bits)    (((value) << (bits)) | ((value) >> (32U - (bits))))
+
+/* Private variables -------------------------------------------------------------------------------------------------*/
+static const char http_ws_base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Private function prototypes ---------------------------------------------------------------------------------------*/
+static void http_ws_sha1(const uint8_t *data, uint32_t data_size, uint8_t *digest);
+static void http_ws_sha1_block(uint32_t *state, const uint8_t *block);
+static void http_ws_base64_encode(const uint8_t *data, uint32_t data_size, char *text);
+
+/* Functions prototypes ----------------------------------------------------------------------------------------------*/
+
+/**
+  * @brief  Compute the Sec-WebSocket-Accept value answering a Sec-WebSocket-Key
+  * @param  key    : Sec-WebSocket-Key header field value
+  * @param  accept : Sec-WebSocket-Accept header field value (out), HTTP_WS_ACCEPT_SIZE + 1 bytes, null terminated
+  * @retval Web Server status, HTTP_ERROR if the key is not a valid one
+  */
+WebServer_StatusTypeDef webserver_http_ws_accept(const http_slice_t *key, char *accept)
+{
+  uint8_t input[HTTP_WS_KEY_SIZE + sizeof(HTTP_WS_GUID) - 1U];
+  uint8_t digest[HTTP_WS_SHA1_DIGEST_SIZE];
+
+  if ((key->data == NULL) || (key->size != HTTP_WS_KEY_SIZE))
+  {
+    return HTTP_ERROR;
+  }
+
+  memcpy(input, key->data, HTTP_WS_KEY_SIZE);
+  memcpy(&input[HTTP_WS_KEY_SIZE], HTTP_WS_GUID, sizeof(HTTP_WS_GUID) - 1U);
+
+  http_ws_sha1(input, sizeof(input), digest);
+  http_ws_base64_encode(digest, sizeof(digest), accept);
+
+  return WEBSERVER_OK;
+}
+
+/**
+  * @brief  Write the header of a final, unmasked frame
+  * @param  header       : header buffer, HTTP_WS_HEADER_MAX_SIZE bytes
+  * @param  opcode       : frame opcode, one of HTTP_WS_OPCODE_xxx
+  * @param  payload_size : payload length
+  * @retval Header length
+  */
+uint32_t webserver_http_ws_frame_header(uint8_t *header, uint32_t opcode, uint32_t payload_size)
+{
+  header[0] = (uint8_t)(HTTP_WS_FIN | (opcode & HTTP_WS_OPCODE));
+
+  if (payload_size < HTTP_WS_LENGTH_16)
+  {
+    header[1] = (uint8_t)payload_size;
+    return 2U;
+  }
+
+  if (payload_size <= 0xFFFFU)
+  {
+    header[1] = HTTP_WS_LENGTH_16;
+    header[2] = (uint8_t)(payload_size >> 8);
+    header[3] = (uint8_t)payload_size;
+    return 4U;
+  }
+
+  header[1] = HTTP_WS_LENGTH_64;
+  memset(&header[2], 0, 4U);
+  header[6] = (uint8_t)(payload_size >> 24);
+  header[7] = (uint8_t)(payload_size >> 16);
+  header[8] = (uint8_t)(payload_size >> 8);
+  header[9] = (uint8_t)payload_size;
+
+  return HTTP_WS_HEADER_MAX_SIZE;
+}
+
+/**
+  * @brief  Parse a frame received from a client, and unmask its payload in place
+  * @param  data      : received data, starting with the frame
+  * @param  data_size : received data length
+  * @param  frame     : parsed frame (out), valid on HTTP_WS_FRAME_DONE
+  * @retval Parser result, one of HTTP_WS_FRAME_xxx
+  */
+uint32_t webserver_http_ws_frame_parse(uint8_t *data, uint32_t data_size, http_ws_frame_t *frame)
+{
+  const uint8_t *mask;
+  uint32_t header_size = 2U;
+  uint32_t payload_size;
+
+  if (data_size < header_size)
+  {
+    return HTTP_WS_FRAME_MORE;
+  }
+
+  /* No extension is negotiated, and a client always masks its frames */
+  if (((data[0] & HTTP_WS_RSV) != 0U) || ((data[1] & HTTP_WS_MASK) == 0U))
+  {
+    return HTTP_WS_FRAME_ERROR;
+  }
+
+  frame->fin    = (data[0] & HTTP_WS_FIN) != 0U;
+  frame->opcode = data[0] & HTTP_WS_OPCODE;
+  payload_size  = data[1] & HTTP_WS_LENGTH;
+
+  if (payload_size == HTTP_WS_LENGTH_16)
+  {
+    header_size += 2U;
+    if (data_size < header_size)
+    {
+      return HTTP_WS_FRAME_MORE;
+    }
+    payload_size = ((uint32_t)data[2] << 8) | data[3];
+  }
+  else if (payload_size == HTTP_WS_LENGTH_64)
+  {
+    header_size += 8U;
+    if (data_size < header_size)
+    {
+      return HTTP_WS_FRAME_MORE;
+    }
+
+    /* Far more than any receive buffer */
+    if ((data[2] | data[3] | data[4] | data[5]) != 0U)
+    {
+      return HTTP_WS_FRAME_ERROR;
+    }
+    payload_size = ((uint32_t)data[6] << 24) | ((uint32_t)data[7] << 16) | ((uint32_t)data[8] << 8) | data[9];
+  }
+
+  /* Control frames are never fragmented and carry a short payload */
+  if (((frame->opcode & HTTP_WS_OPCODE_CLOSE) != 0U) && (!frame->fin || (payload_size > HTTP_WS_CONTROL_MAX_SIZE)))
+  {
+    return HTTP_WS_FRAME_ERROR;
+  }
+
+  mask         = &data[header_size];
+  header_size += 4U;
+  if ((data_size < header_size) || ((data_size - header_size) < payload_size))
+  {
+    return HTTP_WS_FRAME_MORE;
+  }
+
+  frame->payload      = &data[header_size];
+  frame->payload_size = payload_size;
+  frame->frame_size   = header_size + payload_size;
+
+  for (uint32_t i = 0U; i < payload_size; i++)
+  {
+    frame->payload[i] ^= mask[i & 3U];
+  }
+
+  return HTTP_WS_FRAME_DONE;
+}
+
+/**
+  * @brief  Compute the SHA-1 digest of a message
+  * @param  data      : message
+  * @param  data_size : message length, less than 512 MB
+  * @param  digest    : message digest (out), HTTP_WS_SHA1_DIGEST_SIZE bytes
+  * @retval None
+  */
+static void http_ws_sha1(const uint8_t *data, uint32_t data_size, uint8_t *digest)
+{
+  uint32_t state[5] = {0x67452301U, 0xEFCDAB89U, 0x98BADCFEU, 0x10325476U, 0xC3D2E1F0U};
+  uint8_t  block[HTTP_WS_SHA1_BLOCK_SIZE];
+  uint32_t tail_size = data_size % HTTP_WS_SHA1_BLOCK_SIZE;
+  uint32_t bit_size  = data_size * 8U;
+
+  for (uint32_t offset = 0U; offset + HTTP_WS_SHA1_BLOCK_SIZE <= data_size; offset += HTTP_WS_SHA1_BLOCK_SIZE)
+  {
+    http_ws_sha1_block(state, &data[offset]);
+  }
+
+  /* Pad the last block with 0x80, zeros and the message length in bits */
+  memset(block, 0, sizeof(block));
+  memcpy(block, &data[data_size - tail_size], tail_size);
+  block[tail_size] = 0x80U;
+  if (tail_size >= (HTTP_WS_SHA1_BLOCK_SIZE - 8U))
+  {
+    http_ws_sha1_block(state, block);
+    memset(block, 0, sizeof(block));
+  }
+  block[60] = (uint8_t)(bit_size >> 24);
+  block[61] = (uint8_t)(bit_size >> 16);
+  block[62] = (uint8_t)(bit_size >> 8);
+  block[63] = (uint8_t)bit_size;
+  http_ws_sha1_block(state, block);
+
+  for (uint32_t i = 0U; i < HTTP_WS_SHA1_DIGEST_SIZE; i++)
+  {
+    digest[i] = (uint8_t)(state[i / 4U] >> (24U - (8U * (i % 4U))));
+  }
+}
+
+/**
+  * @brief  Process a SHA-1 block
+  * @param  state : hash state, updated
+  * @param  block : block of HTTP_WS_SHA1_BLOCK_SIZE bytes
+  * @retval None
+  */
+static void http_ws_sha1_block(uint32_t *state, const uint8_t *block)
+{
+  uint32_t w[16];
+  uint32_t a = state[0];
+  uint32_t b = state[1];
+  uint32_t c = state[2];
+  uint32_t d = state[3];
+  uint32_t e = state[4];
+  uint32_t f;
+  uint32_t k;
+  uint32_t temp;
+
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    w[i] = ((uint32_t)block[4U * i] << 24) | ((uint32_t)block[(4U * i) + 1U] << 16) |
+           ((uint32_t)block[(4U * i) + 2U] << 8) | block[(4U * i) + 3U];
+  }
+
+  /* The message schedule is kept as a 16 words ring */
+  for (uint32_t i = 0U; i < 80U; i++)
+  {
+    if (i >= 16U)
+    {
+      temp = w[(i + 13U) & 15U] ^ w[(i + 8U) & 15U] ^ w[(i + 2U) & 15U] ^ w[i & 15U];
+      w[i & 15U] = HTTP_WS_ROTL(temp, 1U);
+    }
+
+    if (i < 20U)
+    {
+      f = (b & c) | (~b & d);
+      k = 0x5A827999U;
+    }
+    else if (i < 40U)
+    {
+      f = b ^ c ^ d;
+      k = 0x6ED9EBA1U;
+    }
+    else if (i < 60U)
+    {
+      f = (b & c) | (b & d) | (c & d);
+      k = 0x8F1BBCDCU;
+    }
+    else
+    {
+      f = b ^ c ^ d;
+      k = 0xCA62C1D6U;
+    }
+
+    temp = HTTP_WS_ROTL(a, 5U) + f + e + k + w[i & 15U];
+    e    = d;
+    d    = c;
+    c    = HTTP_WS_ROTL(b, 30U);
+    b    = a;
+    a    = temp;
+  }
+
+  state[0] += a;
+  state[1] += b;
+  state[2] += c;
+  state[3] += d;
+  state[4] += e;
+}
+
+/**
+  * @brief  Encode data in base64
+  * @param  data      : data
+  * @param  data_size : data length
+  * @param  text      : base64 text (out), null terminated, 4 characters for every 3 bytes of data, rounded up
+  * @retval None
+  */
+static void http_ws_base64_encode(const uint8_t *data, uint32_t data_size, char *text)
+{
+  uint32_t group;
+  uint32_t i;
+
+  for (i = 0U; (i + 3U) <= data_size; i += 3U)
+  {
+    group   = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1U] << 8) | data[i + 2U];
+    *text++ = http_ws_base64[(group >> 18) & 0x3FU];
+    *text++ = http_ws_base64[(group >> 12) & 0x3FU];
+    *text++ = http_ws_base64[(group >> 6) & 0x3FU];
+    *text++ = http_ws_base64[group & 0x3FU];
+  }
+
+  /* Last one or two bytes, padded */
+  if (i < data_size)
+  {
+    group   = ((uint32_t)data[i] << 16) | (((i + 1U) < data_size) ? ((uint32_t)data[i + 1U] << 8) : 0U);
+    *text++ = http_ws_base64[(group >> 18) & 0x3FU];
+    *text++ = http_ws_base64[(group >> 12) & 0x3FU];
+    *text++ = ((i + 1U) < data_size) ? http_ws_base64[(group >> 6) & 0x3FU] : '=';
+    *text++ = '=';
+  }
+
+  *text = '\0';
+}
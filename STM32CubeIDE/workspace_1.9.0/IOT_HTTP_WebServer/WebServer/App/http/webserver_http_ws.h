@@ -0,0 +1,71 @@
+/**
+  **********************************************************************************************************************
+  * @file    webserver_http_ws.h
+  * @author  MCD Application Team
+  * @brief   header file for webserver_http_ws.c
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
+#ifndef WEBSERVER_HTTP_WS_H
+#define WEBSERVER_HTTP_WS_H
+
+/* Includes ----------------------------------------------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "webserver_status.h"
+#include "webserver_http_routes.h"
+
+/* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  WebSocket frame received from a client
+  */
+typedef struct
+{
+  uint32_t opcode;                             /*!< Frame opcode, one of HTTP_WS_OPCODE_xxx           */
+  bool     fin;                                /*!< Final fragment of a message                       */
+  uint8_t  *payload;                           /*!< Unmasked payload                                  */
+  uint32_t payload_size;                       /*!< Payload length                                    */
+  uint32_t frame_size;                         /*!< Whole frame length, header included               */
+} http_ws_frame_t;
+
+/* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Length of a Sec-WebSocket-Accept header field value, base64 encoded SHA-1 digest */
+#define HTTP_WS_ACCEPT_SIZE          (28U)
+
+/* Largest header of a frame sent by the server, which is never masked */
+#define HTTP_WS_HEADER_MAX_SIZE      (10U)
+
+/* Largest payload of a control frame */
+#define HTTP_WS_CONTROL_MAX_SIZE     (125U)
+
+/* Frame opcodes */
+#define HTTP_WS_OPCODE_CONTINUATION  (0x0U)
+#define HTTP_WS_OPCODE_TEXT          (0x1U)
+#define HTTP_WS_OPCODE_BINARY        (0x2U)
+#define HTTP_WS_OPCODE_CLOSE         (0x8U)
+#define HTTP_WS_OPCODE_PING          (0x9U)
+#define HTTP_WS_OPCODE_PONG          (0xAU)
+
+/* Frame parser results */
+#define HTTP_WS_FRAME_MORE           (0U)       /* Frame not received completely yet                  */
+#define HTTP_WS_FRAME_DONE           (1U)       /* Frame complete                                     */
+#define HTTP_WS_FRAME_ERROR          (2U)       /* Protocol error, the connection must be failed      */
+
+/* Exported macro ----------------------------------------------------------------------------------------------------*/
+/* Exported functions ----------------------------------------------------------------------------------------------- */
+WebServer_StatusTypeDef webserver_http_ws_accept(const http_slice_t *key, char *accept);
+uint32_t webserver_http_ws_frame_header(uint8_t *header, uint32_t opcode, uint32_t payload_size);
+uint32_t webserver_http_ws_frame_parse(uint8_t *data, uint32_t data_size, http_ws_frame_t *frame);
+
+#endif /* WEBSERVER_HTTP_WS_H */
@@ -2,7 +2,13 @@
   **********************************************************************************************************************
   * @file    webserver_sensors.c
   * @author  MCD Application Team
-  * @brief   This file implements the web server sensors services
+  * @brief   This file implements the web server sensors services.
+  *          Sensors are read by a periodic acquisition stage, each one at its own output data rate, into a
+  *          latest value store. Readers get the last value and its tick from the store in constant time,
+  *          without any bus transfer. Each store entry is guarded by a sequence counter, so that readers
+  *          never see a half written value even if the acquisition runs from an interrupt.
+  *          The motion sensors are only acquired at their output data rates while a motion stream is open,
+  *          at the dashboard refresh rate otherwise.
   **********************************************************************************************************************
   * @attention
   *
@@ -19,22 +25,109 @@
 /* Includes ----------------------------------------------------------------------------------------------------------*/
 #include "webserver_sensors.h"
 #include "b_u585i_iot02a_env_sensors.h"
+#include "b_u585i_iot02a_motion_sensors.h"
+#include "b_u585i_iot02a_light_sensor.h"
+#include "b_u585i_iot02a_ranging_sensor.h"
 
 /* Private typedef ---------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Sensor acquisition
+  */
+typedef struct
+{
+  uint32_t period;                                   /*!< Time in ms between two acquisitions        */
+  uint32_t stream_period;                            /*!< Same, while a motion stream is open         */
+  int      (*acquire)(webserver_sample_t *sample);   /*!< Bus read, BSP_ERROR_BUSY if no new value    */
+} sensor_acquisition_t;
+
+/**
+  * @brief  Latest value store entry of a sensor
+  */
+typedef struct
+{
+  volatile uint32_t  sequence;                       /*!< Odd while the entry is being written        */
+  int                status;                         /*!< BSP status of the last acquisition          */
+  webserver_sample_t sample;                         /*!< Last value acquired                         */
+  uint32_t           due_tick;                       /*!< Tick the next acquisition is due at         */
+  bool               started;                        /*!< Sensor started, acquired from then on       */
+} sensor_store_t;
+
 /* Private define ----------------------------------------------------------------------------------------------------*/
+/* Motion sensors instances */
+#define MOTION_ACC_GYRO_INSTANCE     (0U)       /* ISM330DHCX accelerometer and gyroscope */
+#define MOTION_MAGNETO_INSTANCE      (1U)       /* IIS2MDC magnetometer                   */
+
+/* Motion sensors output data rates in Hz, high enough for the WebSocket motion stream */
+#define MOTION_ACC_GYRO_ODR          (416.0f)
+#define MOTION_MAGNETO_ODR           (100.0f)   /* Highest one of the IIS2MDC             */
+
+/* Ambient light resolution in lux per count, for a gain of 1 and a 100 ms exposure time */
+#define LIGHT_LUX_PER_COUNT          (0.0576f)
+
+/* Ranging sensor instance, configuration and free running measurement frequency */
+#define RANGING_INSTANCE             (0U)
+#define RANGING_TIMING_BUDGET        (30U)      /* ms */
+#define RANGING_FREQUENCY            (10U)      /* Hz */
+
+/* Acquisition periods in ms, from the sensors output data rates */
+#define TEMP_HUMID_PERIOD            (143U)     /* HTS221 at 7 Hz                         */
+#define PRESS_PERIOD                 (20U)      /* LPS22HH at 50 Hz                       */
+#define MOTION_ACC_GYRO_PERIOD       (2U)       /* ISM330DHCX at 416 Hz, tick resolution  */
+#define MOTION_MAGNETO_PERIOD        (10U)      /* IIS2MDC at 100 Hz                      */
+#define LIGHT_PERIOD                 (100U)     /* VEML6030 100 ms exposure time          */
+#define RANGING_PERIOD               (1000U / RANGING_FREQUENCY)
+
+/* Motion sensors acquisition period in ms while no motion stream is open: the dashboard refresh rate, that is the
+   shortest interval between two server-sent events */
+#define MOTION_DASHBOARD_PERIOD      (100U)
+
 /* Private macro -----------------------------------------------------------------------------------------------------*/
 /* Private variables -------------------------------------------------------------------------------------------------*/
+/* Ranging sensor last measurement */
+static RANGING_SENSOR_Result_t ranging_result;
+
+/* Motion streams open */
+static uint32_t motion_subscribers;
+
 /* Private function prototypes ---------------------------------------------------------------------------------------*/
+static int temp_sensor_acquire(webserver_sample_t *sample);
+static int press_sensor_acquire(webserver_sample_t *sample);
+static int humid_sensor_acquire(webserver_sample_t *sample);
+static int accelero_sensor_acquire(webserver_sample_t *sample);
+static int gyro_sensor_acquire(webserver_sample_t *sample);
+static int magneto_sensor_acquire(webserver_sample_t *sample);
+static int light_sensor_acquire(webserver_sample_t *sample);
+static int ranging_sensor_acquire(webserver_sample_t *sample);
+
+/* Sensors acquisitions, by WEBSERVER_SENSOR_xxx */
+static const sensor_acquisition_t sensor_acquisitions[WEBSERVER_SENSOR_NBR] =
+{
+  {TEMP_HUMID_PERIOD,       TEMP_HUMID_PERIOD,      temp_sensor_acquire},
+  {PRESS_PERIOD,            PRESS_PERIOD,           press_sensor_acquire},
+  {TEMP_HUMID_PERIOD,       TEMP_HUMID_PERIOD,      humid_sensor_acquire},
+  {MOTION_DASHBOARD_PERIOD, MOTION_ACC_GYRO_PERIOD, accelero_sensor_acquire},
+  {MOTION_DASHBOARD_PERIOD, MOTION_ACC_GYRO_PERIOD, gyro_sensor_acquire},
+  {MOTION_DASHBOARD_PERIOD, MOTION_MAGNETO_PERIOD,  magneto_sensor_acquire},
+  {LIGHT_PERIOD,            LIGHT_PERIOD,           light_sensor_acquire},
+  {RANGING_PERIOD,          RANGING_PERIOD,         ranging_sensor_acquire},
+};
+
+/* Latest value store, by WEBSERVER_SENSOR_xxx */
+static sensor_store_t sensor_store[WEBSERVER_SENSOR_NBR];
+
 /* Functions prototypes ----------------------------------------------------------------------------------------------*/
 
 /**
-  * @brief  Start temperature, pressure and humidity sensors acquisition.
+  * @brief  Start temperature, pressure and humidity sensors acquisition, and the motion, light and ranging ones.
+  *         The latter are optional: one that does not start is never acquired, its BSP status is the one of its
+  *         start.
   * @param  None
-  * @retval BSP status
+  * @retval BSP status of the temperature, pressure and humidity sensors start
   */
 int webserver_sensors_start(void)
 {
   int   status = BSP_ERROR_NONE;
+  int   start_status[WEBSERVER_SENSOR_NBR] = {BSP_ERROR_NONE};
 
   /* De-Initialize function */
   status |= BSP_ENV_SENSOR_DeInit(0);
@@ -45,6 +138,145 @@ int webserver_sensors_start(void)
   status |= webserver_humid_sensor_start();
   status |= webserver_temp_sensor_start();
 
+  /* Optional sensors, the web server goes on without them */
+  start_status[WEBSERVER_SENSOR_ACCELERO] = webserver_motion_sensors_start();
+  start_status[WEBSERVER_SENSOR_GYRO]     = start_status[WEBSERVER_SENSOR_ACCELERO];
+  start_status[WEBSERVER_SENSOR_MAGNETO]  = start_status[WEBSERVER_SENSOR_ACCELERO];
+  start_status[WEBSERVER_SENSOR_LIGHT]    = webserver_light_sensor_start();
+  start_status[WEBSERVER_SENSOR_RANGING]  = webserver_ranging_sensor_start();
+
+  /* Nothing acquired yet, every acquisition of a started sensor is due */
+  for (uint32_t sensor = 0U; sensor < WEBSERVER_SENSOR_NBR; sensor++)
+  {
+    sensor_store[sensor].started  = (start_status[sensor] == BSP_ERROR_NONE);
+    sensor_store[sensor].status   = sensor_store[sensor].started ? BSP_ERROR_NO_INIT : start_status[sensor];
+    sensor_store[sensor].due_tick = HAL_GetTick();
+  }
+  (void)webserver_sensors_process();
+
+  return status;
+}
+
+/**
+  * @brief  Acquisition stage: read the sensors whose acquisition is due into the latest value store.
+  *         To be called periodically, at least as often as the shortest acquisition period for the values
+  *         to be fresh.
+  * @param  None
+  * @retval Time in ms until the next acquisition is due
+  */
+uint32_t webserver_sensors_process(void)
+{
+  sensor_store_t     *store;
+  webserver_sample_t sample;
+  uint32_t           tick = HAL_GetTick();
+  uint32_t           next = UINT32_MAX;
+  uint32_t           period;
+  int                status;
+
+  for (uint32_t sensor = 0U; sensor < WEBSERVER_SENSOR_NBR; sensor++)
+  {
+    store = &sensor_store[sensor];
+
+    /* A sensor that did not start is never acquired */
+    if (!store->started)
+    {
+      continue;
+    }
+
+    period = (motion_subscribers > 0U) ? sensor_acquisitions[sensor].stream_period :
+             sensor_acquisitions[sensor].period;
+
+    if ((int32_t)(store->due_tick - tick) <= 0)
+    {
+      /* Keep the pace, unless the acquisition is late by more than a period */
+      store->due_tick += period;
+      if ((int32_t)(store->due_tick - tick) <= 0)
+      {
+        store->due_tick = tick + period;
+      }
+
+      /* A free running sensor may have no new value yet */
+      sample = store->sample;
+      status = sensor_acquisitions[sensor].acquire(&sample);
+      if (status != BSP_ERROR_BUSY)
+      {
+        sample.tick = tick;
+
+        store->sequence++;
+        __DMB();
+        store->status = status;
+        store->sample = sample;
+        __DMB();
+        store->sequence++;
+      }
+    }
+
+    if ((store->due_tick - tick) < next)
+    {
+      next = store->due_tick - tick;
+    }
+  }
+
+  return next;
+}
+
+/**
+  * @brief  Count a motion stream opening: the motion sensors are acquired at their output data rates from now on,
+  *         until the last motion stream is closed.
+  * @param  None
+  * @retval None
+  */
+void webserver_sensors_motion_subscribe(void)
+{
+  if (motion_subscribers++ == 0U)
+  {
+    /* Do not wait for the end of a dashboard period */
+    for (uint32_t sensor = 0U; sensor < WEBSERVER_SENSOR_NBR; sensor++)
+    {
+      if (sensor_acquisitions[sensor].stream_period != sensor_acquisitions[sensor].period)
+      {
+        sensor_store[sensor].due_tick = HAL_GetTick();
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Count a motion stream closing: the motion sensors are back to the dashboard refresh rate once no motion
+  *         stream is open.
+  * @param  None
+  * @retval None
+  */
+void webserver_sensors_motion_unsubscribe(void)
+{
+  if (motion_subscribers > 0U)
+  {
+    motion_subscribers--;
+  }
+}
+
+/**
+  * @brief  Get the last value of a sensor from the latest value store, without any bus transfer.
+  * @param  sensor : sensor, one of WEBSERVER_SENSOR_xxx
+  * @param  sample : last value and the tick it was acquired at, its age is HAL_GetTick() - sample->tick
+  * @retval BSP status of the acquisition of this value
+  */
+int webserver_sensor_get(uint32_t sensor, webserver_sample_t *sample)
+{
+  const sensor_store_t *store = &sensor_store[sensor];
+  uint32_t sequence;
+  int      status;
+
+  /* Copy again if the entry was written meanwhile */
+  do
+  {
+    sequence = store->sequence;
+    __DMB();
+    *sample = store->sample;
+    status  = store->status;
+    __DMB();
+  } while (((sequence & 1U) != 0U) || (sequence != store->sequence));
+
   return status;
 }
 
@@ -99,16 +331,32 @@ int webserver_temp_sensor_stop(void)
 }
 
 /**
-  * @brief  Read temperature sensor acquisition value.
-  * @param  None
+  * @brief  Read temperature sensor last acquired value, from the latest value store.
+  * @param  value : temperature
   * @retval BSP status
   */
 int webserver_temp_sensor_read(float *value)
+{
+  webserver_sample_t sample;
+  int status;
+
+  status = webserver_sensor_get(WEBSERVER_SENSOR_TEMPERATURE, &sample);
+  *value = sample.value;
+
+  return status;
+}
+
+/**
+  * @brief  Acquire temperature sensor value.
+  * @param  sample : acquired value
+  * @retval BSP status
+  */
+static int temp_sensor_acquire(webserver_sample_t *sample)
 {
   int   status = BSP_ERROR_NONE;
 
   /* Get value function */
-  status |= BSP_ENV_SENSOR_GetValue(0, ENV_TEMPERATURE, value);
+  status |= BSP_ENV_SENSOR_GetValue(0, ENV_TEMPERATURE, &sample->value);
 
   return status;
 }
@@ -164,16 +412,32 @@ int webserver_press_sensor_stop(void)
 }
 
 /**
-  * @brief  Read pressure sensor acquisition value.
-  * @param  None
+  * @brief  Read pressure sensor last acquired value, from the latest value store.
+  * @param  value : pressure
   * @retval BSP status
   */
 int webserver_press_sensor_read(float *value)
+{
+  webserver_sample_t sample;
+  int status;
+
+  status = webserver_sensor_get(WEBSERVER_SENSOR_PRESSURE, &sample);
+  *value = sample.value;
+
+  return status;
+}
+
+/**
+  * @brief  Acquire pressure sensor value.
+  * @param  sample : acquired value
+  * @retval BSP status
+  */
+static int press_sensor_acquire(webserver_sample_t *sample)
 {
   int   status = BSP_ERROR_NONE;
 
   /* Get value function */
-  status |= BSP_ENV_SENSOR_GetValue(1, ENV_PRESSURE, value);
+  status |= BSP_ENV_SENSOR_GetValue(1, ENV_PRESSURE, &sample->value);
 
   return status;
 }
@@ -230,16 +494,215 @@ int webserver_humid_sensor_stop(void)
 }
 
 /**
-  * @brief  Read humidity sensor acquisition value.
-  * @param  None
+  * @brief  Read humidity sensor last acquired value, from the latest value store.
+  * @param  value : humidity
   * @retval BSP status
   */
 int webserver_humid_sensor_read(float *value)
+{
+  webserver_sample_t sample;
+  int status;
+
+  status = webserver_sensor_get(WEBSERVER_SENSOR_HUMIDITY, &sample);
+  *value = sample.value;
+
+  return status;
+}
+
+/**
+  * @brief  Acquire humidity sensor value.
+  * @param  sample : acquired value
+  * @retval BSP status
+  */
+static int humid_sensor_acquire(webserver_sample_t *sample)
 {
   int   status = BSP_ERROR_NONE;
 
   /* Get value function */
-  status |= BSP_ENV_SENSOR_GetValue(0, ENV_HUMIDITY, value);
+  status |= BSP_ENV_SENSOR_GetValue(0, ENV_HUMIDITY, &sample->value);
+
+  return status;
+}
+
+/**
+  * @brief  Start accelerometer, gyroscope and magnetometer acquisition.
+  * @param  None
+  * @retval BSP status
+  */
+int webserver_motion_sensors_start(void)
+{
+  int status = BSP_ERROR_NONE;
+
+  /* Initialize function */
+  status |= BSP_MOTION_SENSOR_Init(MOTION_ACC_GYRO_INSTANCE, MOTION_ACCELERO | MOTION_GYRO);
+  status |= BSP_MOTION_SENSOR_Init(MOTION_MAGNETO_INSTANCE, MOTION_MAGNETO);
+
+  /* Set output data rate */
+  status |= BSP_MOTION_SENSOR_SetOutputDataRate(MOTION_ACC_GYRO_INSTANCE, MOTION_ACCELERO, MOTION_ACC_GYRO_ODR);
+  status |= BSP_MOTION_SENSOR_SetOutputDataRate(MOTION_ACC_GYRO_INSTANCE, MOTION_GYRO, MOTION_ACC_GYRO_ODR);
+  status |= BSP_MOTION_SENSOR_SetOutputDataRate(MOTION_MAGNETO_INSTANCE, MOTION_MAGNETO, MOTION_MAGNETO_ODR);
+
+  /* Enable function */
+  status |= BSP_MOTION_SENSOR_Enable(MOTION_ACC_GYRO_INSTANCE, MOTION_ACCELERO);
+  status |= BSP_MOTION_SENSOR_Enable(MOTION_ACC_GYRO_INSTANCE, MOTION_GYRO);
+  status |= BSP_MOTION_SENSOR_Enable(MOTION_MAGNETO_INSTANCE, MOTION_MAGNETO);
+
+  return status;
+}
+
+/**
+  * @brief  Acquire accelerometer value, in mg.
+  * @param  sample : acquired acceleration on each axis
+  * @retval BSP status
+  */
+static int accelero_sensor_acquire(webserver_sample_t *sample)
+{
+  BSP_MOTION_SENSOR_Axes_t value = {0};
+  int status = BSP_ERROR_NONE;
+
+  /* Get value function */
+  status |= BSP_MOTION_SENSOR_GetAxes(MOTION_ACC_GYRO_INSTANCE, MOTION_ACCELERO, &value);
+
+  sample->axes.x = value.xval;
+  sample->axes.y = value.yval;
+  sample->axes.z = value.zval;
 
   return status;
 }
+
+/**
+  * @brief  Acquire gyroscope value, in mdps.
+  * @param  sample : acquired angular rate on each axis
+  * @retval BSP status
+  */
+static int gyro_sensor_acquire(webserver_sample_t *sample)
+{
+  BSP_MOTION_SENSOR_Axes_t value = {0};
+  int status = BSP_ERROR_NONE;
+
+  /* Get value function */
+  status |= BSP_MOTION_SENSOR_GetAxes(MOTION_ACC_GYRO_INSTANCE, MOTION_GYRO, &value);
+
+  sample->axes.x = value.xval;
+  sample->axes.y = value.yval;
+  sample->axes.z = value.zval;
+
+  return status;
+}
+
+/**
+  * @brief  Acquire magnetometer value, in mgauss.
+  * @param  sample : acquired magnetic field on each axis
+  * @retval BSP status
+  */
+static int magneto_sensor_acquire(webserver_sample_t *sample)
+{
+  BSP_MOTION_SENSOR_Axes_t value = {0};
+  int status = BSP_ERROR_NONE;
+
+  /* Get value function */
+  status |= BSP_MOTION_SENSOR_GetAxes(MOTION_MAGNETO_INSTANCE, MOTION_MAGNETO, &value);
+
+  sample->axes.x = value.xval;
+  sample->axes.y = value.yval;
+  sample->axes.z = value.zval;
+
+  return status;
+}
+
+/**
+  * @brief  Start ambient light sensor acquisition.
+  * @param  None
+  * @retval BSP status
+  */
+int webserver_light_sensor_start(void)
+{
+  int status = BSP_ERROR_NONE;
+
+  /* Initialize function */
+  status |= BSP_LIGHT_SENSOR_Init(0);
+
+  /* Gain and exposure time the lux conversion is based on */
+  status |= BSP_LIGHT_SENSOR_SetGain(0, LIGHT_SENSOR_ALS_CHANNEL, LIGHT_SENSOR_GAIN_1);
+  status |= BSP_LIGHT_SENSOR_SetExposureTime(0, LIGHT_SENSOR_EXPOSURE_TIME_100);
+
+  /* Start function */
+  status |= BSP_LIGHT_SENSOR_Start(0, LIGHT_SENSOR_MODE_CONTINUOUS);
+
+  return status;
+}
+
+/**
+  * @brief  Acquire ambient light sensor value, in lux.
+  * @param  sample : acquired ambient light
+  * @retval BSP status
+  */
+static int light_sensor_acquire(webserver_sample_t *sample)
+{
+  uint32_t counts[LIGHT_SENSOR_MAX_CHANNELS] = {0};
+  int status = BSP_ERROR_NONE;
+
+  /* Get value function */
+  status |= BSP_LIGHT_SENSOR_GetValues(0, counts);
+
+  sample->value = (float)counts[LIGHT_SENSOR_ALS_CHANNEL] * LIGHT_LUX_PER_COUNT;
+
+  return status;
+}
+
+/**
+  * @brief  Start time of flight ranging sensor acquisition, free running.
+  * @param  None
+  * @retval BSP status
+  */
+int webserver_ranging_sensor_start(void)
+{
+  RANGING_SENSOR_ProfileConfig_t profile;
+  int status = BSP_ERROR_NONE;
+
+  /* Initialize function */
+  status |= BSP_RANGING_SENSOR_Init(RANGING_INSTANCE);
+
+  /* 4x4 zones, measured continuously */
+  profile.RangingProfile = RS_PROFILE_4x4_CONTINUOUS;
+  profile.TimingBudget   = RANGING_TIMING_BUDGET;
+  profile.Frequency      = RANGING_FREQUENCY;
+  profile.EnableAmbient  = 0U;
+  profile.EnableSignal   = 0U;
+  status |= BSP_RANGING_SENSOR_ConfigProfile(RANGING_INSTANCE, &profile);
+
+  /* Start function, results are then read without waiting */
+  status |= BSP_RANGING_SENSOR_Start(RANGING_INSTANCE, RS_MODE_ASYNC_CONTINUOUS);
+
+  return status;
+}
+
+/**
+  * @brief  Acquire time of flight ranging sensor value: distance of the nearest target, in mm.
+  *         The sensor is free running, a new measurement is not always ready.
+  * @param  sample : acquired distance, 0 if no target is detected
+  * @retval BSP status, BSP_ERROR_BUSY if no new measurement is ready
+  */
+static int ranging_sensor_acquire(webserver_sample_t *sample)
+{
+  uint32_t distance = 0U;
+
+  /* Get value function, fails while no new measurement is ready */
+  if (BSP_RANGING_SENSOR_GetDistance(RANGING_INSTANCE, &ranging_result) != BSP_ERROR_NONE)
+  {
+    return BSP_ERROR_BUSY;
+  }
+
+  for (uint32_t zone = 0U; zone < ranging_result.NumberOfZones; zone++)
+  {
+    if ((ranging_result.ZoneResult[zone].NumberOfTargets > 0U) && (ranging_result.ZoneResult[zone].Status[0] == 0U) &&
+        ((distance == 0U) || (ranging_result.ZoneResult[zone].Distance[0] < distance)))
+    {
+      distance = ranging_result.ZoneResult[zone].Distance[0];
+    }
+  }
+
+  sample->value = (float)distance;
+
+  return BSP_ERROR_NONE;
+}
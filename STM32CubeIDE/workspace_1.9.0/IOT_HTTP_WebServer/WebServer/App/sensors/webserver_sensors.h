@@ -24,7 +24,38 @@
 #include "webserver.h"
 
 /* Exported types ----------------------------------------------------------------------------------------------------*/
+/**
+  * @brief  Motion sensor value on each axis
+  */
+typedef struct
+{
+  int32_t x;
+  int32_t y;
+  int32_t z;
+} webserver_axes_t;
+
+/**
+  * @brief  Sensor value, as held by the latest value store
+  */
+typedef struct
+{
+  float            value;                      /*!< Value of a single value sensor                    */
+  webserver_axes_t axes;                       /*!< Value of a 3 axes sensor                          */
+  uint32_t         tick;                       /*!< Tick the value was acquired at                    */
+} webserver_sample_t;
+
 /* Exported constants ------------------------------------------------------------------------------------------------*/
+/* Sensors of the latest value store */
+#define WEBSERVER_SENSOR_TEMPERATURE (0U)       /* degC                                   */
+#define WEBSERVER_SENSOR_PRESSURE    (1U)       /* hPa                                    */
+#define WEBSERVER_SENSOR_HUMIDITY    (2U)       /* %rH                                    */
+#define WEBSERVER_SENSOR_ACCELERO    (3U)       /* mg                                     */
+#define WEBSERVER_SENSOR_GYRO        (4U)       /* mdps                                   */
+#define WEBSERVER_SENSOR_MAGNETO     (5U)       /* mgauss                                 */
+#define WEBSERVER_SENSOR_LIGHT       (6U)       /* lux                                    */
+#define WEBSERVER_SENSOR_RANGING     (7U)       /* mm                                     */
+#define WEBSERVER_SENSOR_NBR         (8U)
+
 /* Exported macro ----------------------------------------------------------------------------------------------------*/
 /* Exported functions ----------------------------------------------------------------------------------------------- */
 int webserver_temp_sensor_start(void);
@@ -36,7 +67,14 @@ int webserver_press_sensor_read(float *value);
 int webserver_humid_sensor_start(void);
 int webserver_humid_sensor_stop(void);
 int webserver_humid_sensor_read(float *value);
+int webserver_motion_sensors_start(void);
+int webserver_light_sensor_start(void);
+int webserver_ranging_sensor_start(void);
 int webserver_sensors_start(void);
+uint32_t webserver_sensors_process(void);
+void webserver_sensors_motion_subscribe(void);
+void webserver_sensors_motion_unsubscribe(void);
+int webserver_sensor_get(uint32_t sensor, webserver_sample_t *sample);
 
 /* Private defines ---------------------------------------------------------------------------------------------------*/
 
@@ -1,3716 +0,0 @@
-/**
-  **********************************************************************************************************************
-  * @file    css_main_res.h
-  * @author  MCD Application Team
-  * @brief   This file implements the web page shunk cascading style sheets resources
-  **********************************************************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2021 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  **********************************************************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
-#ifndef CSS_SHUNK_RES_H
-#define CSS_SHUNK_RES_H
-
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page shunk css resources buffer */
-static const char css_shunk_buff[] =
-{
-  0x2a, 0x2f, 0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x62, 0x2c, 0x2e, 0x66, 0x61, 0x64, 0x2c,
-  0x2e, 0x66, 0x61, 0x6c, 0x2c, 0x2e, 0x66, 0x61, 0x72, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x2d,
-  0x6d, 0x6f, 0x7a, 0x2d, 0x6f, 0x73, 0x78, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x6d, 0x6f,
-  0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3a, 0x67, 0x72, 0x61, 0x79, 0x73, 0x63, 0x61, 0x6c, 0x65,
-  0x3b, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x6d,
-  0x6f, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x3a, 0x61, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x69, 0x61,
-  0x73, 0x65, 0x64, 0x3b, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x69, 0x6e, 0x6c, 0x69,
-  0x6e, 0x65, 0x2d, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
-  0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x66, 0x65, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73,
-  0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x76, 0x61, 0x72,
-  0x69, 0x61, 0x6e, 0x74, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x74, 0x65, 0x78, 0x74,
-  0x2d, 0x72, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b,
-  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x67, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x31,
-  0x2e, 0x33, 0x33, 0x33, 0x33, 0x33, 0x65, 0x6d, 0x3b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x3b, 0x76, 0x65, 0x72, 0x74, 0x69,
-  0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x2d, 0x2e, 0x30, 0x36, 0x36, 0x37,
-  0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x78, 0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73,
-  0x69, 0x7a, 0x65, 0x3a, 0x2e, 0x37, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x2e, 0x38, 0x37, 0x35, 0x65,
-  0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x31, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69,
-  0x7a, 0x65, 0x3a, 0x31, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x32, 0x78, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x33, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x33, 0x65, 0x6d,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x34, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a,
-  0x65, 0x3a, 0x34, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x35, 0x78, 0x7b, 0x66, 0x6f, 0x6e,
-  0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x36,
-  0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x36, 0x65, 0x6d, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x37, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
-  0x3a, 0x37, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x38, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x38, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x39, 0x78,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x39, 0x65, 0x6d, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x31, 0x30, 0x78, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65,
-  0x3a, 0x31, 0x30, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x77, 0x7b, 0x74, 0x65, 0x78,
-  0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77,
-  0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x2e, 0x32, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x6c, 0x7b, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2d, 0x74, 0x79,
-  0x70, 0x65, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x3a, 0x32, 0x2e, 0x35, 0x65, 0x6d, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e,
-  0x67, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x30, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6c, 0x3e,
-  0x6c, 0x69, 0x7b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x7b, 0x6c, 0x65, 0x66, 0x74,
-  0x3a, 0x2d, 0x32, 0x65, 0x6d, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61,
-  0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69,
-  0x67, 0x6e, 0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a,
-  0x32, 0x65, 0x6d, 0x3b, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x69, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x2e, 0x30, 0x38, 0x65, 0x6d, 0x20,
-  0x73, 0x6f, 0x6c, 0x69, 0x64, 0x20, 0x23, 0x65, 0x65, 0x65, 0x3b, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3a, 0x2e, 0x31, 0x65, 0x6d, 0x3b, 0x70, 0x61,
-  0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x2e, 0x32, 0x65, 0x6d, 0x20, 0x2e, 0x32, 0x35, 0x65, 0x6d,
-  0x20, 0x2e, 0x31, 0x35, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x7b, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3a, 0x6c, 0x65, 0x66, 0x74, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x7b, 0x66,
-  0x6c, 0x6f, 0x61, 0x74, 0x3a, 0x72, 0x69, 0x67, 0x68, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x62,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x2e, 0x66,
-  0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x2c,
-  0x2e, 0x66, 0x61, 0x72, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x3a, 0x2e, 0x33, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c,
-  0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x62, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66, 0x61, 0x6c, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x2e, 0x66,
-  0x61, 0x72, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x2c, 0x2e, 0x66, 0x61, 0x73, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x6c, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
-  0x2e, 0x33, 0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x7b, 0x61, 0x6e,
-  0x69, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x20,
-  0x32, 0x73, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x61, 0x72, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69,
-  0x74, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6c, 0x73, 0x65, 0x7b, 0x61, 0x6e, 0x69,
-  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x20, 0x31,
-  0x73, 0x20, 0x73, 0x74, 0x65, 0x70, 0x73, 0x28, 0x38, 0x29, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e,
-  0x69, 0x74, 0x65, 0x7d, 0x40, 0x6b, 0x65, 0x79, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x66,
-  0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x7b, 0x30, 0x25, 0x7b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66,
-  0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x30, 0x64, 0x65, 0x67, 0x29,
-  0x7d, 0x74, 0x6f, 0x7b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f,
-  0x74, 0x61, 0x74, 0x65, 0x28, 0x31, 0x74, 0x75, 0x72, 0x6e, 0x29, 0x7d, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x39, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66,
-  0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58,
-  0x49, 0x6d, 0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d,
-  0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d,
-  0x61, 0x67, 0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x31, 0x29, 0x22,
-  0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74,
-  0x65, 0x28, 0x39, 0x30, 0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74,
-  0x61, 0x74, 0x65, 0x2d, 0x31, 0x38, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c, 0x74,
-  0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d, 0x61,
-  0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63, 0x72,
-  0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67, 0x65,
-  0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x32, 0x29, 0x22, 0x3b, 0x74, 0x72,
-  0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x31,
-  0x38, 0x30, 0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74,
-  0x65, 0x2d, 0x32, 0x37, 0x30, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72,
-  0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d, 0x61, 0x67, 0x65,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63, 0x72, 0x6f, 0x73,
-  0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x28, 0x72,
-  0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x33, 0x29, 0x22, 0x3b, 0x74, 0x72, 0x61, 0x6e,
-  0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x28, 0x32, 0x37, 0x30,
-  0x64, 0x65, 0x67, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f,
-  0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69, 0x6c,
-  0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49, 0x6d,
-  0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69, 0x63,
-  0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61, 0x67,
-  0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x30, 0x2c, 0x20, 0x6d, 0x69,
-  0x72, 0x72, 0x6f, 0x72, 0x3d, 0x31, 0x29, 0x22, 0x3b, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f,
-  0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x58, 0x28, 0x2d, 0x31, 0x29, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b,
-  0x74, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x59,
-  0x28, 0x2d, 0x31, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x62, 0x6f,
-  0x74, 0x68, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72, 0x69,
-  0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76,
-  0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70,
-  0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b, 0x2d, 0x6d, 0x73, 0x2d, 0x66, 0x69,
-  0x6c, 0x74, 0x65, 0x72, 0x3a, 0x22, 0x70, 0x72, 0x6f, 0x67, 0x69, 0x64, 0x3a, 0x44, 0x58, 0x49,
-  0x6d, 0x61, 0x67, 0x65, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x2e, 0x4d, 0x69,
-  0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x2e, 0x42, 0x61, 0x73, 0x69, 0x63, 0x49, 0x6d, 0x61,
-  0x67, 0x65, 0x28, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x32, 0x2c, 0x20, 0x6d,
-  0x69, 0x72, 0x72, 0x6f, 0x72, 0x3d, 0x31, 0x29, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c,
-  0x69, 0x70, 0x2d, 0x62, 0x6f, 0x74, 0x68, 0x2c, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70,
-  0x2d, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x7b, 0x74, 0x72, 0x61,
-  0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x3a, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x28, 0x2d, 0x31, 0x29,
-  0x7d, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d,
-  0x62, 0x6f, 0x74, 0x68, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x2c, 0x3a,
-  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x69, 0x70, 0x2d, 0x76, 0x65,
-  0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x39, 0x30, 0x2c, 0x3a, 0x72, 0x6f, 0x6f, 0x74,
-  0x20, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x2d, 0x31, 0x38, 0x30, 0x2c,
-  0x3a, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65,
-  0x2d, 0x32, 0x37, 0x30, 0x7b, 0x2d, 0x77, 0x65, 0x62, 0x6b, 0x69, 0x74, 0x2d, 0x66, 0x69, 0x6c,
-  0x74, 0x65, 0x72, 0x3a, 0x6e, 0x6f, 0x6e, 0x65, 0x3b, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a,
-  0x6e, 0x6f, 0x6e, 0x65, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x7b, 0x64,
-  0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x65, 0x6d, 0x3b, 0x6c,
-  0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x32, 0x65, 0x6d, 0x3b, 0x70,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x3b, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3a,
-  0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x32, 0x2e, 0x35,
-  0x65, 0x6d, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x31, 0x78, 0x2c,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x32, 0x78, 0x7b, 0x6c, 0x65, 0x66,
-  0x74, 0x3a, 0x30, 0x3b, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73,
-  0x6f, 0x6c, 0x75, 0x74, 0x65, 0x3b, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-  0x3a, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x30,
-  0x30, 0x25, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x31, 0x78, 0x7b,
-  0x6c, 0x69, 0x6e, 0x65, 0x2d, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x69, 0x6e, 0x68, 0x65,
-  0x72, 0x69, 0x74, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x32, 0x78,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x32, 0x65, 0x6d, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x7b, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
-  0x3a, 0x23, 0x66, 0x66, 0x66, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x35, 0x30, 0x30, 0x70, 0x78, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x63, 0x65, 0x73,
-  0x73, 0x69, 0x62, 0x6c, 0x65, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x63, 0x75, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x63, 0x71, 0x75, 0x69, 0x73,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2d, 0x69, 0x6e, 0x63, 0x6f, 0x72, 0x70, 0x6f, 0x72, 0x61,
-  0x74, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x64,
-  0x72, 0x65, 0x73, 0x73, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x63, 0x61, 0x72,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64, 0x6a,
-  0x75, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x64, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x64,
-  0x76, 0x65, 0x72, 0x73, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x66, 0x66, 0x69, 0x6c, 0x69, 0x61, 0x74, 0x65, 0x74, 0x68, 0x65, 0x6d, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x69, 0x72, 0x2d,
-  0x66, 0x72, 0x65, 0x73, 0x68, 0x65, 0x6e, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x69, 0x72, 0x62, 0x6e, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x67, 0x6f, 0x6c, 0x69, 0x61, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d,
-  0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x6a, 0x75, 0x73, 0x74, 0x69, 0x66, 0x79, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x69, 0x70, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x36, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x67,
-  0x69, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x62, 0x75, 0x6c, 0x61, 0x6e, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x65, 0x72,
-  0x69, 0x63, 0x61, 0x6e, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61,
-  0x67, 0x65, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x69, 0x6e, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6d, 0x69, 0x6c, 0x69,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x63,
-  0x68, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6e, 0x64, 0x72, 0x6f, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6e, 0x67, 0x65, 0x6c, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75,
-  0x62, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
-  0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x72, 0x69,
-  0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d,
-  0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67,
-  0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x6e, 0x67, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x6e, 0x67, 0x72, 0x79, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e, 0x67, 0x75, 0x6c,
-  0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x6e,
-  0x6b, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70,
-  0x70, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x69, 0x6f, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70, 0x70,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x70,
-  0x70, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x63, 0x68, 0x77,
-  0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64,
-  0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65,
-  0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77,
-  0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x63,
-  0x69, 0x72, 0x63, 0x6c, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x75, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77,
-  0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x68, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d,
-  0x61, 0x6c, 0x74, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x61, 0x72, 0x74, 0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x73, 0x73, 0x69, 0x73, 0x74, 0x69, 0x76, 0x65,
-  0x2d, 0x6c, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x79, 0x73, 0x74, 0x65,
-  0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x73,
-  0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x61, 0x73, 0x79, 0x6d, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x61, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x74, 0x6f, 0x6d,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x75, 0x64, 0x69,
-  0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61,
-  0x75, 0x64, 0x69, 0x6f, 0x2d, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x75, 0x74, 0x6f,
-  0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x61, 0x76, 0x69, 0x61, 0x6e, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x76, 0x69, 0x61, 0x74, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x61, 0x77, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x37, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x62, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x62, 0x79, 0x2d, 0x63, 0x61,
-  0x72, 0x72, 0x69, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x63, 0x74,
-  0x65, 0x72, 0x69, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x61, 0x63, 0x74, 0x65, 0x72, 0x69, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x68, 0x61, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63,
-  0x61, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6c,
-  0x61, 0x6e, 0x63, 0x65, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x6e, 0x64, 0x2d,
-  0x61, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x6e, 0x64, 0x63, 0x61, 0x6d, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x73, 0x65, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62,
-  0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x61, 0x73, 0x6b, 0x65, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x68, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72,
-  0x79, 0x2d, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x34, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65,
-  0x72, 0x79, 0x2d, 0x68, 0x61, 0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x71, 0x75, 0x61, 0x72, 0x74,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x61,
-  0x74, 0x74, 0x65, 0x72, 0x79, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x65, 0x2d, 0x71, 0x75, 0x61, 0x72,
-  0x74, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x61, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x6e, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x68, 0x61, 0x6e, 0x63, 0x65, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x65, 0x7a, 0x69, 0x65, 0x72, 0x2d, 0x63,
-  0x75, 0x72, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x69, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x69, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x6e, 0x6f, 0x63,
-  0x75, 0x6c, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x69, 0x6f, 0x68, 0x61, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x72, 0x74, 0x68, 0x64, 0x61, 0x79, 0x2d, 0x63,
-  0x61, 0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x69, 0x74, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x74, 0x63, 0x6f, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x2d, 0x74, 0x69, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x61, 0x63,
-  0x6b, 0x62, 0x65, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2d, 0x70, 0x68, 0x6f,
-  0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c,
-  0x69, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x6c, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x6c, 0x6f, 0x67, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6c, 0x6f, 0x67, 0x67, 0x65, 0x72, 0x2d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x75, 0x65, 0x74, 0x6f, 0x6f, 0x74, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6c, 0x75, 0x65,
-  0x74, 0x6f, 0x6f, 0x74, 0x68, 0x2d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6d, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x64, 0x65, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6d, 0x65, 0x64,
-  0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x72, 0x65, 0x61, 0x64, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x6f, 0x6b,
-  0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x6f, 0x6f, 0x74, 0x73, 0x74, 0x72, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x34, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x2d, 0x6e, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x77, 0x6c, 0x69, 0x6e,
-  0x67, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x62, 0x6f, 0x78, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x78, 0x2d, 0x74, 0x69, 0x73, 0x73, 0x75, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x6f, 0x78, 0x65, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x69,
-  0x6c, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62,
-  0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x72, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x69, 0x65, 0x66, 0x63, 0x61, 0x73, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x69, 0x65,
-  0x66, 0x63, 0x61, 0x73, 0x65, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x6f, 0x61, 0x64, 0x63, 0x61,
-  0x73, 0x74, 0x2d, 0x74, 0x6f, 0x77, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x6f, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x75, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x74, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x6c, 0x6c, 0x68, 0x6f,
-  0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75,
-  0x6c, 0x6c, 0x73, 0x65, 0x79, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x75, 0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x62, 0x75, 0x72, 0x6f, 0x6d, 0x6f, 0x62, 0x65, 0x6c, 0x65, 0x78, 0x70, 0x65, 0x72,
-  0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x73,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x75, 0x73, 0x69, 0x6e, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x62, 0x75, 0x79, 0x2d, 0x6e, 0x2d, 0x6c,
-  0x61, 0x72, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x62, 0x75, 0x79, 0x73, 0x65, 0x6c, 0x6c, 0x61, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x63, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x65, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65,
-  0x6e, 0x64, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72,
-  0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x64, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64,
-  0x61, 0x72, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c,
-  0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6c, 0x65, 0x6e, 0x64, 0x61, 0x72, 0x2d,
-  0x77, 0x65, 0x65, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x2d, 0x72, 0x65, 0x74, 0x72, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6d, 0x70, 0x67, 0x72,
-  0x6f, 0x75, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x61, 0x6e, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x2d, 0x6d, 0x61, 0x70, 0x6c, 0x65, 0x2d, 0x6c,
-  0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x6e, 0x64, 0x79, 0x2d, 0x63, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x6e, 0x6e, 0x61, 0x62, 0x69, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x35, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x70, 0x73, 0x75, 0x6c, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d,
-  0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x64, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d, 0x63, 0x72, 0x61, 0x73, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x2d, 0x73,
-  0x69, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x61, 0x76, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x6c, 0x65,
-  0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x72, 0x65, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x6c,
-  0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x61, 0x72, 0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72,
-  0x65, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x65, 0x74, 0x2d, 0x75, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x72,
-  0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x72, 0x74, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x31, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x72, 0x74, 0x2d, 0x70, 0x6c,
-  0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61,
-  0x73, 0x68, 0x2d, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x62, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x61, 0x6d, 0x61, 0x7a, 0x6f, 0x6e, 0x2d,
-  0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x63, 0x2d, 0x61, 0x6d, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x63, 0x2d, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x70, 0x61, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x64, 0x69, 0x6e,
-  0x65, 0x72, 0x73, 0x2d, 0x63, 0x6c, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x6a, 0x63,
-  0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d,
-  0x6d, 0x61, 0x73, 0x74, 0x65, 0x72, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x70, 0x61, 0x79, 0x70, 0x61, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x63, 0x2d, 0x73, 0x74,
-  0x72, 0x69, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x63, 0x2d, 0x76, 0x69, 0x73, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x65, 0x6e, 0x74, 0x6f, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x65, 0x72, 0x74, 0x69,
-  0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x61, 0x69, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x6c, 0x6b, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x6c, 0x6b, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x2d, 0x74, 0x65, 0x61, 0x63, 0x68, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x67, 0x2d,
-  0x73, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x61, 0x72, 0x65, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x66, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x62,
-  0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68,
-  0x61, 0x72, 0x74, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x61, 0x72, 0x74, 0x2d, 0x70, 0x69, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d,
-  0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x65, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x62, 0x69, 0x73, 0x68, 0x6f,
-  0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65,
-  0x73, 0x73, 0x2d, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d,
-  0x6b, 0x6e, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x70, 0x61, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x73, 0x73, 0x2d, 0x71, 0x75,
-  0x65, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x68, 0x65, 0x73, 0x73, 0x2d, 0x72, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72,
-  0x63, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d,
-  0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x65, 0x76, 0x72, 0x6f, 0x6e,
-  0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x68, 0x69, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x68, 0x72, 0x6f, 0x6d, 0x65, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x68, 0x75, 0x72, 0x63, 0x68, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x31, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x2d, 0x6e, 0x6f, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x34, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x69, 0x6e, 0x69, 0x63, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63,
-  0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c,
-  0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x32, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2d, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c,
-  0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x6e, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64,
-  0x2d, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x65, 0x61, 0x74,
-  0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e,
-  0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x33,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x73, 0x68, 0x6f,
-  0x77, 0x65, 0x72, 0x73, 0x2d, 0x68, 0x65, 0x61, 0x76, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x73, 0x75, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64,
-  0x2d, 0x73, 0x75, 0x6e, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61,
-  0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x66, 0x6c, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x73, 0x63, 0x61, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f,
-  0x75, 0x64, 0x73, 0x6d, 0x69, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x76, 0x65, 0x72, 0x73, 0x69, 0x66, 0x79, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x63, 0x6b, 0x74,
-  0x61, 0x69, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x64, 0x65, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x64, 0x69, 0x65, 0x70, 0x69,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x66,
-  0x66, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x67, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x69, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d,
-  0x65, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x64, 0x6f,
-  0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f,
-  0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2d, 0x64,
-  0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x63, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x63, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70,
-  0x72, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
-  0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6e, 0x63, 0x69, 0x65, 0x72, 0x67, 0x65,
-  0x2d, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6e, 0x66, 0x6c, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x38,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x64, 0x65,
-  0x76, 0x65, 0x6c, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x6f, 0x6b, 0x69, 0x65, 0x2d, 0x62, 0x69, 0x74, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x70, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x70, 0x79,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x6f, 0x74, 0x74, 0x6f, 0x6e, 0x2d, 0x62, 0x75, 0x72, 0x65, 0x61, 0x75, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x6f, 0x75, 0x63, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x70, 0x61, 0x6e, 0x65,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x62, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d,
-  0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x2d, 0x65, 0x75, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x65, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x63, 0x2d, 0x6a, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74,
-  0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x6e, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69,
-  0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x70, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x65, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76,
-  0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x70, 0x64, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x72, 0x65, 0x6d,
-  0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73, 0x61,
-  0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f,
-  0x6e, 0x73, 0x2d, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x6c, 0x75, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x65, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x73, 0x68, 0x61,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72,
-  0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2d, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, 0x2d, 0x7a,
-  0x65, 0x72, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x65, 0x64, 0x69, 0x74, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x69, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x72,
-  0x6f, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63,
-  0x72, 0x6f, 0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x68, 0x61, 0x69, 0x72, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x77, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x6f, 0x77, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x72, 0x75, 0x74, 0x63,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x73, 0x73,
-  0x33, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x63, 0x73, 0x73,
-  0x33, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x62, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x63, 0x75, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x63, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x66, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x2d, 0x61, 0x6e, 0x64, 0x2d, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x2d, 0x61, 0x6e, 0x64, 0x2d,
-  0x64, 0x2d, 0x62, 0x65, 0x79, 0x6f, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x64, 0x61, 0x69, 0x6c, 0x79, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x61, 0x73, 0x68, 0x63,
-  0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x61, 0x74, 0x61, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x65, 0x7a, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x6c, 0x69, 0x63, 0x69, 0x6f, 0x75, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x6d, 0x6f, 0x63, 0x72,
-  0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65,
-  0x70, 0x6c, 0x6f, 0x79, 0x64, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x65, 0x73, 0x6b, 0x70, 0x72, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x38, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x73, 0x6b, 0x74, 0x6f, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x76, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x65, 0x76, 0x69, 0x61, 0x6e, 0x74, 0x61,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x68,
-  0x61, 0x72, 0x6d, 0x61, 0x63, 0x68, 0x61, 0x6b, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x68, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x61, 0x67, 0x6e, 0x6f, 0x73, 0x65, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x61, 0x73, 0x70, 0x6f,
-  0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x63, 0x65, 0x2d, 0x64, 0x32, 0x30, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x63, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x64, 0x36, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x66, 0x69, 0x76, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x66,
-  0x6f, 0x75, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x69, 0x63, 0x65, 0x2d, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x73, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63, 0x65, 0x2d, 0x74, 0x68, 0x72, 0x65,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x63,
-  0x65, 0x2d, 0x74, 0x77, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x6f, 0x63, 0x65, 0x61, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x67, 0x69, 0x74, 0x61,
-  0x6c, 0x2d, 0x74, 0x61, 0x63, 0x68, 0x6f, 0x67, 0x72, 0x61, 0x70, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69,
-  0x73, 0x63, 0x6f, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x69, 0x73, 0x63, 0x6f, 0x75, 0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x73, 0x65, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x69, 0x7a, 0x7a, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6e, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x63, 0x68, 0x75,
-  0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x63,
-  0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f,
-  0x6c, 0x6c, 0x61, 0x72, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x79, 0x2d, 0x66, 0x6c, 0x61, 0x74,
-  0x62, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64,
-  0x6f, 0x6e, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x6f, 0x6f, 0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x6f, 0x72, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x6f, 0x74,
-  0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x6f, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x62, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x61, 0x66, 0x74, 0x32, 0x64, 0x69, 0x67,
-  0x69, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x64, 0x72, 0x61, 0x66, 0x74, 0x69, 0x6e, 0x67, 0x2d, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x73, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x61, 0x67,
-  0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72,
-  0x61, 0x77, 0x2d, 0x70, 0x6f, 0x6c, 0x79, 0x67, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x65, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x69, 0x62, 0x62, 0x62, 0x6c, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x69, 0x62, 0x62, 0x62,
-  0x6c, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x6f, 0x70, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x6d, 0x2d, 0x73, 0x74, 0x65,
-  0x65, 0x6c, 0x70, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x72, 0x75, 0x6d, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x2d, 0x62, 0x69, 0x74, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x72, 0x75, 0x70, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75, 0x6d,
-  0x62, 0x62, 0x65, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x75, 0x6d, 0x70, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75, 0x6d, 0x70, 0x73, 0x74, 0x65, 0x72, 0x2d, 0x66, 0x69,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x64, 0x75,
-  0x6e, 0x67, 0x65, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x64, 0x79, 0x61, 0x6c, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x62, 0x69, 0x72, 0x64, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x62, 0x61, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x66, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x64, 0x67, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x64, 0x67, 0x65, 0x2d, 0x6c, 0x65,
-  0x67, 0x61, 0x63, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x64, 0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x66, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x6a, 0x65, 0x63, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x69, 0x73, 0x2d, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6c, 0x6c, 0x69, 0x70,
-  0x73, 0x69, 0x73, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6c, 0x6c, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x33, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x6d, 0x70, 0x69, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65,
-  0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x65, 0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x2d, 0x74,
-  0x65, 0x78, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x6e, 0x76, 0x65, 0x6c, 0x6f, 0x70, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x61,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x71, 0x75, 0x61,
-  0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x72,
-  0x61, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x72, 0x6c, 0x61, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x74, 0x68, 0x65, 0x72, 0x65, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x74, 0x68, 0x65, 0x72, 0x6e, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x74, 0x73, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x75, 0x72, 0x6f, 0x2d, 0x73,
-  0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65,
-  0x76, 0x65, 0x72, 0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x61,
-  0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x74, 0x72, 0x69, 0x61,
-  0x6e, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x31, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x70, 0x65, 0x64, 0x69, 0x74, 0x65, 0x64, 0x73, 0x73,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x74,
-  0x65, 0x72, 0x6e, 0x61, 0x6c, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x78, 0x74, 0x65, 0x72, 0x6e,
-  0x61, 0x6c, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79, 0x65,
-  0x2d, 0x64, 0x72, 0x6f, 0x70, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x66, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x65, 0x79, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f,
-  0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x63,
-  0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x6d, 0x65, 0x73, 0x73,
-  0x65, 0x6e, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x39, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x61, 0x63, 0x65, 0x62, 0x6f, 0x6f, 0x6b, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x6e, 0x74, 0x61,
-  0x73, 0x79, 0x2d, 0x66, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x67, 0x61, 0x6d, 0x65, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x73, 0x74, 0x2d,
-  0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x73, 0x74, 0x2d, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x35, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61, 0x75, 0x63,
-  0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x61,
-  0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x61,
-  0x74, 0x68, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x65, 0x61, 0x74, 0x68, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36,
-  0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x64, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x64, 0x6f, 0x72, 0x61, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x65, 0x6d, 0x61, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x67, 0x68,
-  0x74, 0x65, 0x72, 0x2d, 0x6a, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x67, 0x6d, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x72, 0x63,
-  0x68, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x75, 0x64, 0x69, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d,
-  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x63, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x63, 0x73, 0x76, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x64, 0x6f, 0x77,
-  0x6e, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x78, 0x63, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x65, 0x78, 0x70, 0x6f,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x65, 0x2d, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x69, 0x6d, 0x70, 0x6f, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x36, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d,
-  0x69, 0x6e, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x69, 0x6e, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x2d,
-  0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x6d,
-  0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70, 0x64, 0x66, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70,
-  0x6f, 0x77, 0x65, 0x72, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72,
-  0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x37, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65,
-  0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x6f,
-  0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69,
-  0x6c, 0x6c, 0x2d, 0x64, 0x72, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x62, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x70, 0x72, 0x69, 0x6e, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x65, 0x2d, 0x65, 0x78, 0x74, 0x69, 0x6e, 0x67, 0x75, 0x69, 0x73, 0x68, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72,
-  0x65, 0x66, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x65, 0x66, 0x6f, 0x78, 0x2d, 0x62, 0x72, 0x6f, 0x77, 0x73, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74,
-  0x2d, 0x61, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x69, 0x72, 0x73, 0x74, 0x2d, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2d, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x69, 0x72, 0x73, 0x74, 0x64, 0x72, 0x61, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x37, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x69, 0x73, 0x74, 0x2d, 0x72, 0x61, 0x69,
-  0x73, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x61, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6c, 0x61, 0x67, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x61, 0x67, 0x2d, 0x75, 0x73,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x61,
-  0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c,
-  0x69, 0x63, 0x6b, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6c, 0x69, 0x70, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x34, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d,
-  0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x2d, 0x70,
-  0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73,
-  0x6f, 0x6d, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x35, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d,
-  0x66, 0x6c, 0x61, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d, 0x6c, 0x6f, 0x67,
-  0x6f, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x69, 0x63, 0x6f, 0x6e, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x6e, 0x74, 0x69, 0x63, 0x6f, 0x6e, 0x73,
-  0x2d, 0x66, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66,
-  0x6f, 0x6f, 0x74, 0x62, 0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x77, 0x65,
-  0x73, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x6f, 0x72, 0x75,
-  0x6d, 0x62, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x6f, 0x75, 0x72, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x38, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x2d, 0x63, 0x6f,
-  0x64, 0x65, 0x2d, 0x63, 0x61, 0x6d, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x66, 0x72, 0x65, 0x65, 0x62, 0x73, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x32, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x72, 0x6f, 0x77, 0x6e, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x75, 0x6c,
-  0x63, 0x72, 0x75, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x66, 0x75, 0x6e, 0x6e, 0x65, 0x6c, 0x2d, 0x64, 0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x66, 0x75, 0x74, 0x62, 0x6f, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x6c, 0x61, 0x63,
-  0x74, 0x69, 0x63, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x6c, 0x61, 0x63, 0x74, 0x69, 0x63,
-  0x2d, 0x73, 0x65, 0x6e, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x61, 0x6d, 0x65, 0x70, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x73, 0x2d, 0x70, 0x75, 0x6d, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x61, 0x76, 0x65, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x65, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72,
-  0x6c, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x65, 0x74, 0x2d, 0x70, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x67, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x36, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x66, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x66, 0x74, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74,
-  0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x68, 0x75,
-  0x62, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x6b, 0x72, 0x61, 0x6b, 0x65, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x6c, 0x61, 0x62, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x69, 0x74, 0x74, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61,
-  0x73, 0x73, 0x2d, 0x63, 0x68, 0x65, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x39, 0x66, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x6d, 0x61, 0x72, 0x74, 0x69,
-  0x6e, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c,
-  0x61, 0x73, 0x73, 0x2d, 0x6d, 0x61, 0x72, 0x74, 0x69, 0x6e, 0x69, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73,
-  0x2d, 0x77, 0x68, 0x69, 0x73, 0x6b, 0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x69, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x69, 0x64, 0x65, 0x2d, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62,
-  0x65, 0x2d, 0x61, 0x66, 0x72, 0x69, 0x63, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65, 0x2d, 0x61, 0x6d, 0x65, 0x72, 0x69, 0x63,
-  0x61, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c,
-  0x6f, 0x62, 0x65, 0x2d, 0x61, 0x73, 0x69, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6c, 0x6f, 0x62, 0x65, 0x2d, 0x65, 0x75, 0x72, 0x6f, 0x70, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x66, 0x6f,
-  0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f,
-  0x6c, 0x66, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x72, 0x65, 0x61, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x64, 0x72, 0x65, 0x61, 0x64,
-  0x73, 0x2d, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67,
-  0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x64, 0x72, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d,
-  0x70, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67,
-  0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f,
-  0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x70, 0x6c, 0x75,
-  0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2d, 0x77, 0x61, 0x6c, 0x6c, 0x65,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x6f, 0x70,
-  0x75, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x72, 0x61, 0x64, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x61, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x39, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x61, 0x74, 0x69, 0x70,
-  0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72,
-  0x61, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72,
-  0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68,
-  0x61, 0x6e, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6d, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x37,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d,
-  0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x67, 0x72, 0x69, 0x6e, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x77, 0x65, 0x61, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d,
-  0x68, 0x65, 0x61, 0x72, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x71,
-  0x75, 0x69, 0x6e, 0x74, 0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e,
-  0x2d, 0x74, 0x65, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x6e, 0x67, 0x75, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f,
-  0x6e, 0x67, 0x75, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x74, 0x6f, 0x6e, 0x67,
-  0x75, 0x65, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x6e, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x38, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x68, 0x6f, 0x72,
-  0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x6c, 0x69,
-  0x6e, 0x65, 0x73, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x69, 0x70, 0x2d, 0x76, 0x65, 0x72,
-  0x74, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x67, 0x72, 0x69, 0x70, 0x66, 0x69, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x72, 0x75, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x69, 0x6c, 0x64, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65,
-  0x30, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x69, 0x74, 0x61, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x67, 0x75, 0x6c, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x2d, 0x73, 0x71, 0x75,
-  0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x61, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6e, 0x65, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6e, 0x65, 0x77,
-  0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x61, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x63, 0x6b, 0x65, 0x72, 0x72, 0x61, 0x6e, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6d, 0x62, 0x75, 0x72,
-  0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x61, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x61, 0x6d, 0x73, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68,
-  0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c,
-  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c,
-  0x64, 0x69, 0x6e, 0x67, 0x2d, 0x75, 0x73, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x68, 0x6f, 0x6c, 0x64, 0x69, 0x6e, 0x67,
-  0x2d, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x6d, 0x69,
-  0x64, 0x64, 0x6c, 0x65, 0x2d, 0x66, 0x69, 0x6e, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x61, 0x70, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x2d, 0x70, 0x65, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f,
-  0x69, 0x6e, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2d,
-  0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x6e, 0x64, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d,
-  0x73, 0x63, 0x69, 0x73, 0x73, 0x6f, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x2d, 0x73, 0x70, 0x61, 0x72, 0x6b, 0x6c, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x2d, 0x73, 0x70, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x68, 0x65, 0x6c, 0x70, 0x69, 0x6e,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e,
-  0x64, 0x73, 0x2d, 0x77, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b,
-  0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x6e, 0x64, 0x73, 0x68, 0x61, 0x6b, 0x65,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x61, 0x6e, 0x75, 0x6b, 0x69, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x72, 0x64, 0x2d, 0x68, 0x61, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x38, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x73, 0x68, 0x74, 0x61,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61, 0x74,
-  0x2d, 0x63, 0x6f, 0x77, 0x62, 0x6f, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x61, 0x74, 0x2d, 0x63, 0x6f, 0x77, 0x62, 0x6f, 0x79, 0x2d, 0x73, 0x69,
-  0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x61,
-  0x74, 0x2d, 0x77, 0x69, 0x7a, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x64, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x30, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x63, 0x6f, 0x75,
-  0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65,
-  0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x63, 0x6f, 0x75, 0x67, 0x68, 0x2d, 0x73, 0x6c,
-  0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68,
-  0x65, 0x61, 0x64, 0x2d, 0x73, 0x69, 0x64, 0x65, 0x2d, 0x6d, 0x61, 0x73, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65,
-  0x30, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x2d, 0x73, 0x69,
-  0x64, 0x65, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x70, 0x68, 0x6f, 0x6e, 0x65,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61,
-  0x64, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x38,
-  0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x64, 0x73, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74,
-  0x2d, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x62, 0x65, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x65, 0x6c, 0x69, 0x63, 0x6f, 0x70, 0x74,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69,
-  0x67, 0x68, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x65,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x70, 0x70, 0x6f, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x70, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x72, 0x65, 0x2d, 0x61, 0x2d, 0x68,
-  0x65, 0x6c, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x69, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x63, 0x6b, 0x65, 0x79, 0x2d, 0x70, 0x75, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x35, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x6c, 0x6c, 0x79,
-  0x2d, 0x62, 0x65, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x6f, 0x6c, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x6e, 0x62, 0x69, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x72, 0x73, 0x65, 0x2d, 0x68, 0x65,
-  0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74,
-  0x61, 0x6c, 0x2d, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x37, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x73, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x2d, 0x75, 0x73,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x74, 0x2d, 0x74, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x6f, 0x74, 0x64, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x30, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x68, 0x6f, 0x74, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x74, 0x6a, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x31,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67,
-  0x6c, 0x61, 0x73, 0x73, 0x2d, 0x65, 0x6e, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x68, 0x61,
-  0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f,
-  0x75, 0x72, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x64,
-  0x61, 0x6d, 0x61, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x6f, 0x75, 0x7a, 0x7a, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x72, 0x79, 0x76, 0x6e, 0x69, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x74, 0x6d, 0x6c, 0x35,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x68, 0x75, 0x62, 0x73,
-  0x70, 0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x2d, 0x63, 0x75, 0x72, 0x73, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x63, 0x65, 0x2d, 0x63, 0x72, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x63, 0x69, 0x63, 0x6c, 0x65, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x38, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x64, 0x2d, 0x62,
-  0x61, 0x64, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x69, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x69, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x64, 0x65, 0x61, 0x6c, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x67, 0x6c, 0x6f, 0x6f,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6d, 0x61, 0x67,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6d, 0x61,
-  0x67, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6d, 0x64, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6e, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x69, 0x6e, 0x64, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x69, 0x6e, 0x64, 0x75, 0x73, 0x74, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x66, 0x6f, 0x2d, 0x63,
-  0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x69, 0x6e, 0x6e, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x67,
-  0x72, 0x61, 0x6d, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6f, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x63,
-  0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x6e, 0x65, 0x74, 0x2d, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x6e, 0x76, 0x69, 0x73,
-  0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69,
-  0x6f, 0x78, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x69, 0x74, 0x61, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x63, 0x68, 0x2d, 0x69, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x75, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x69, 0x74, 0x75, 0x6e, 0x65, 0x73, 0x2d,
-  0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x61, 0x76, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x65, 0x64, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6a, 0x65, 0x64, 0x69, 0x2d, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x65, 0x6e, 0x6b, 0x69, 0x6e, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x69, 0x72, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x67, 0x65, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x69, 0x6e, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x6f, 0x6d, 0x6c,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x6f, 0x75,
-  0x72, 0x6e, 0x61, 0x6c, 0x2d, 0x77, 0x68, 0x69, 0x6c, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6a, 0x73, 0x66, 0x69, 0x64, 0x64,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x61,
-  0x61, 0x62, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b,
-  0x61, 0x67, 0x67, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6b, 0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x65, 0x79, 0x62, 0x61, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6b, 0x65, 0x79, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x65, 0x79, 0x63, 0x64, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x68, 0x61, 0x6e, 0x64, 0x61, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x36, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x63, 0x6b, 0x73,
-  0x74, 0x61, 0x72, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6b, 0x69, 0x63, 0x6b, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x72, 0x2d, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x73, 0x73, 0x2d,
-  0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x69, 0x73, 0x73, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x2d, 0x68, 0x65, 0x61, 0x72, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6b, 0x69, 0x77, 0x69, 0x2d,
-  0x62, 0x69, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6b, 0x6f, 0x72, 0x76, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x61, 0x6e, 0x64, 0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x36, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74,
-  0x6f, 0x70, 0x2d, 0x63, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f, 0x70, 0x2d, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x70, 0x74, 0x6f,
-  0x70, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x73, 0x74, 0x66, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x73, 0x74, 0x66, 0x6d,
-  0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d,
-  0x73, 0x71, 0x75, 0x69, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x61, 0x75, 0x67, 0x68, 0x2d, 0x77, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x2d, 0x67, 0x72,
-  0x6f, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x65, 0x61, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x65, 0x61, 0x6e, 0x70, 0x75, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x65, 0x6d, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x33, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61,
-  0x6e, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x65, 0x76,
-  0x65, 0x6c, 0x2d, 0x75, 0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x62, 0x66, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x66, 0x65, 0x2d, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x62,
-  0x75, 0x6c, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c,
-  0x69, 0x6e, 0x6b, 0x65, 0x64, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x63, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x6b, 0x65, 0x64, 0x69, 0x6e, 0x2d, 0x69, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x6f, 0x64, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x6e, 0x75,
-  0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x72,
-  0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x6f, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x2d, 0x75, 0x6c,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x34,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x63, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d,
-  0x61, 0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61,
-  0x72, 0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x6e, 0x67, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x6f, 0x77, 0x2d, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x67, 0x67,
-  0x61, 0x67, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x39, 0x64, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x6e, 0x67, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x30, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x75, 0x6e, 0x67, 0x73, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x65, 0x30, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6c, 0x79, 0x66, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x67, 0x65,
-  0x6e, 0x74, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x61, 0x67, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x67, 0x6e, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x69, 0x6c, 0x2d, 0x62, 0x75, 0x6c, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x69, 0x6c, 0x63, 0x68, 0x69, 0x6d, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x6c, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x6e, 0x64,
-  0x61, 0x6c, 0x6f, 0x72, 0x69, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x39, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b,
-  0x65, 0x64, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x6d, 0x61, 0x72, 0x6b,
-  0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x70, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x37, 0x36, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x70, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x37, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x6b, 0x64, 0x6f,
-  0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x30, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61,
-  0x72, 0x6b, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x72, 0x73, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61,
-  0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2d, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x72, 0x73, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6b, 0x65, 0x2d, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x73, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x61, 0x73, 0x74, 0x6f, 0x64, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x61, 0x78, 0x63, 0x64, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x64, 0x62, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x61, 0x70, 0x70, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x33, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x75,
-  0x6d, 0x2d, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x65, 0x64, 0x6b, 0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6d, 0x65, 0x64, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x65, 0x65, 0x74, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x67, 0x61, 0x70, 0x6f, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x2d, 0x62, 0x6c, 0x61, 0x6e, 0x6b,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x68, 0x2d,
-  0x72, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x2d, 0x65, 0x79, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x6e, 0x64, 0x65, 0x6c,
-  0x65, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65,
-  0x6e, 0x6f, 0x72, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6d, 0x65, 0x72, 0x63, 0x75, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x65, 0x74, 0x65, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x62, 0x6c, 0x6f, 0x67, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x31, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f,
-  0x63, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73,
-  0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x63, 0x72, 0x6f, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72,
-  0x6f, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x69, 0x6e, 0x75, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x34, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x74, 0x74, 0x65, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78, 0x63, 0x6c, 0x6f, 0x75,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69, 0x78,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x69,
-  0x7a, 0x75, 0x6e, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x64, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x72, 0x6f, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d,
-  0x62, 0x69, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x62, 0x69, 0x6c, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x64, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d,
-  0x62, 0x69, 0x6c, 0x6c, 0x2d, 0x77, 0x61, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x62, 0x69, 0x6c, 0x6c, 0x2d,
-  0x77, 0x61, 0x76, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x65, 0x79,
-  0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6e, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x61, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x6f, 0x6e, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x72, 0x74, 0x61, 0x72,
-  0x2d, 0x70, 0x65, 0x73, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x73, 0x71, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x74, 0x6f, 0x72, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x31, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x6f, 0x75, 0x6e, 0x74,
-  0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x66, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d,
-  0x6f, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6d, 0x6f, 0x75, 0x73, 0x65, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x75, 0x67, 0x2d, 0x68, 0x6f, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6d, 0x75, 0x73, 0x69,
-  0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x61, 0x70,
-  0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x65, 0x6f, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x65, 0x74, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x77, 0x69, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x65, 0x75, 0x74, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x65, 0x77, 0x73, 0x70,
-  0x61, 0x70, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6e, 0x69, 0x6d, 0x62, 0x6c, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x6f, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x6f, 0x64, 0x65, 0x2d, 0x6a, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x6f, 0x74, 0x2d, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6e, 0x6f, 0x74, 0x65, 0x73, 0x2d,
-  0x6d, 0x65, 0x64, 0x69, 0x63, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x6e, 0x70, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x6e, 0x73, 0x38, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x6e, 0x75, 0x74, 0x72, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x67,
-  0x72, 0x6f, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2d, 0x75, 0x6e, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x63, 0x74, 0x6f, 0x70, 0x75,
-  0x73, 0x2d, 0x64, 0x65, 0x70, 0x6c, 0x6f, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x64, 0x6e, 0x6f, 0x6b, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x69, 0x6b,
-  0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x64, 0x6e,
-  0x6f, 0x6b, 0x6c, 0x61, 0x73, 0x73, 0x6e, 0x69, 0x6b, 0x69, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x69, 0x6c,
-  0x2d, 0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x6f, 0x6c, 0x64, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x63, 0x61, 0x72, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x69, 0x64,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x39, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x65, 0x72,
-  0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x70, 0x74,
-  0x69, 0x6e, 0x2d, 0x6d, 0x6f, 0x6e, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x72, 0x63, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x64,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x73, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x74, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x6f, 0x75, 0x74, 0x64, 0x65, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x34, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x67, 0x65, 0x6c,
-  0x69, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x61, 0x67, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2d, 0x62, 0x72, 0x75, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x69, 0x6e, 0x74, 0x2d, 0x72, 0x6f,
-  0x6c, 0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x61, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x33, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x6c, 0x66, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x6c, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x2d, 0x70, 0x6c, 0x61,
-  0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61,
-  0x70, 0x65, 0x72, 0x63, 0x6c, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x36, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x72, 0x61, 0x63, 0x68, 0x75, 0x74, 0x65, 0x2d, 0x62, 0x6f, 0x78,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x72, 0x61,
-  0x67, 0x72, 0x61, 0x70, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x61, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x73, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x73, 0x74, 0x61, 0x66, 0x61, 0x72,
-  0x69, 0x61, 0x6e, 0x69, 0x73, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x61, 0x73, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x61, 0x74, 0x72, 0x65, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61, 0x75, 0x73, 0x65, 0x2d, 0x63, 0x69, 0x72,
-  0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x61, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x61,
-  0x79, 0x70, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x37, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x66, 0x61, 0x6e, 0x63, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x61, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x6e, 0x69, 0x62, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x2d, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x6e, 0x63, 0x69, 0x6c, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x30,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6e, 0x63, 0x69, 0x6c, 0x2d, 0x72, 0x75,
-  0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x65, 0x6e, 0x6e, 0x79, 0x2d, 0x61, 0x72, 0x63, 0x61, 0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2d, 0x61, 0x72,
-  0x72, 0x6f, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x65, 0x6f, 0x70, 0x6c, 0x65, 0x2d, 0x63, 0x61, 0x72, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x70, 0x70, 0x65, 0x72, 0x2d, 0x68,
-  0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65,
-  0x72, 0x62, 0x79, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x72, 0x63, 0x65, 0x6e, 0x74, 0x61, 0x67, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x34, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x65, 0x72, 0x69, 0x73, 0x63,
-  0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70,
-  0x65, 0x72, 0x73, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x6f, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x61, 0x62, 0x72, 0x69, 0x63, 0x61, 0x74,
-  0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68,
-  0x6f, 0x65, 0x6e, 0x69, 0x78, 0x2d, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x77, 0x6f, 0x72, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x65, 0x6e,
-  0x69, 0x78, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x64, 0x72, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x39, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f,
-  0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x64, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e,
-  0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38,
-  0x37, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x6f, 0x6e, 0x65, 0x2d, 0x76, 0x6f,
-  0x6c, 0x75, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x68, 0x6f, 0x74, 0x6f, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x68, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64,
-  0x2d, 0x70, 0x69, 0x70, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72,
-  0x2d, 0x68, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69, 0x70, 0x65, 0x72, 0x2d, 0x70, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x65, 0x64, 0x2d, 0x70, 0x69,
-  0x70, 0x65, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x31, 0x65,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x67, 0x67, 0x79, 0x2d, 0x62, 0x61, 0x6e, 0x6b,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6c, 0x6c,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x65, 0x73, 0x74, 0x2d, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x65,
-  0x73, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x69, 0x7a, 0x7a, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x38, 0x31, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x63,
-  0x65, 0x2d, 0x6f, 0x66, 0x2d, 0x77, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x37, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x2d, 0x61,
-  0x72, 0x72, 0x69, 0x76, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x61, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x2d, 0x64, 0x65, 0x70, 0x61, 0x72, 0x74, 0x75, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61,
-  0x6e, 0x65, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x39, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x34, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x61, 0x79, 0x73,
-  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x73, 0x71,
-  0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x70, 0x6f, 0x64, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6c, 0x6c, 0x2d, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x6d, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x35, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x6f, 0x70, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x31, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x72, 0x74, 0x72, 0x61, 0x69,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x6f, 0x75,
-  0x6e, 0x64, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x34, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x2d, 0x6f, 0x66, 0x66, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x38, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x61, 0x79, 0x69, 0x6e, 0x67, 0x2d,
-  0x68, 0x61, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70,
-  0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x38, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x69, 0x6e, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x63,
-  0x65, 0x64, 0x75, 0x72, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x2d, 0x68, 0x75, 0x6e, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
-  0x74, 0x2d, 0x64, 0x69, 0x61, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6d, 0x70, 0x2d, 0x6d, 0x65, 0x64, 0x69, 0x63, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x6d,
-  0x70, 0x2d, 0x73, 0x6f, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x70, 0x75, 0x7a, 0x7a, 0x6c, 0x65, 0x2d, 0x70, 0x69, 0x65, 0x63, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x70, 0x79, 0x74, 0x68,
-  0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x71,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x72, 0x63, 0x6f,
-  0x64, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75,
-  0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x69,
-  0x64, 0x64, 0x69, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x71, 0x75, 0x69, 0x6e, 0x73, 0x63, 0x61, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x6f, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x2d, 0x6c, 0x65,
-  0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75,
-  0x6f, 0x74, 0x65, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x71, 0x75, 0x72, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x37,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x2d, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x64, 0x69, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x61, 0x64, 0x69, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x69, 0x6e, 0x62, 0x6f, 0x77,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x35, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x6e, 0x64,
-  0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61,
-  0x73, 0x70, 0x62, 0x65, 0x72, 0x72, 0x79, 0x2d, 0x70, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x62,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x61, 0x76, 0x65, 0x6c, 0x72, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x61, 0x63, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x61, 0x63, 0x74, 0x65,
-  0x75, 0x72, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x61, 0x64, 0x6d, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x62, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x63, 0x65, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x2d, 0x76, 0x69,
-  0x6e, 0x79, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x63, 0x79, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x64, 0x2d, 0x72, 0x69, 0x76, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x61, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x2d,
-  0x61, 0x6c, 0x69, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x64, 0x64, 0x69, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x61, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x68, 0x61, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x6f,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x64, 0x6f,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x35, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x6d, 0x6f, 0x76, 0x65, 0x2d, 0x66, 0x6f, 0x72,
-  0x6d, 0x61, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x6e, 0x72, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x2d, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x70, 0x6c, 0x79, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x33, 0x65, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x70, 0x75, 0x62, 0x6c, 0x69,
-  0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72,
-  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x67, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66,
-  0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x76, 0x69, 0x6e, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x33, 0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x73, 0x74,
-  0x72, 0x6f, 0x6f, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x65, 0x74, 0x77, 0x65, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x39, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x72, 0x69, 0x62, 0x62, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x61, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x62, 0x6f, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x34, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63, 0x6b, 0x65, 0x74, 0x63, 0x68, 0x61,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x6f, 0x63,
-  0x6b, 0x72, 0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x6f, 0x75, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x72, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x73, 0x73, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x33,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x62, 0x6c, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x35, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c,
-  0x65, 0x72, 0x2d, 0x63, 0x6f, 0x6d, 0x62, 0x69, 0x6e, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x2d, 0x68, 0x6f, 0x72,
-  0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x72, 0x75, 0x6c, 0x65, 0x72, 0x2d, 0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x6e,
-  0x6e, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x72, 0x75, 0x70, 0x65, 0x65, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x72, 0x75, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x63, 0x72, 0x79, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x64, 0x2d, 0x74, 0x65, 0x61,
-  0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x66,
-  0x61, 0x72, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x36, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x61, 0x6c, 0x65, 0x73, 0x66, 0x6f, 0x72, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x74, 0x65, 0x6c, 0x6c, 0x69, 0x74, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x62, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x74, 0x65, 0x6c, 0x6c,
-  0x69, 0x74, 0x65, 0x2d, 0x64, 0x69, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x61, 0x76, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x68, 0x6c, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x68, 0x6f, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x34, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x63, 0x72, 0x65, 0x77, 0x64, 0x72, 0x69,
-  0x76, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x63, 0x72, 0x69, 0x62, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x63, 0x72, 0x6f, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x30, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x64, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x32,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x64,
-  0x6f, 0x6c, 0x6c, 0x61, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x36, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x65, 0x6e, 0x67, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x65, 0x65, 0x64, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x6c, 0x6c, 0x63, 0x61, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x6c, 0x6c, 0x73, 0x79,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x31, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65, 0x72, 0x76,
-  0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x65,
-  0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68,
-  0x61, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x61, 0x72, 0x65, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x65, 0x6b, 0x65, 0x6c, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x2d,
-  0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x68, 0x69, 0x65, 0x6c, 0x64, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x69, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d,
-  0x66, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x68, 0x69, 0x72, 0x74, 0x73, 0x69, 0x6e, 0x62, 0x75, 0x6c, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x65, 0x2d, 0x70, 0x72, 0x69,
-  0x6e, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x68, 0x6f, 0x70, 0x69, 0x66, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x61, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69,
-  0x6e, 0x67, 0x2d, 0x62, 0x61, 0x73, 0x6b, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x6f, 0x70, 0x70, 0x69, 0x6e, 0x67, 0x2d, 0x63, 0x61,
-  0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x37, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68,
-  0x6f, 0x70, 0x77, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x68, 0x6f, 0x77, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x63, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x68, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x2d, 0x76, 0x61, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d,
-  0x69, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x2d,
-  0x6f, 0x75, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x31, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x62, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x6d, 0x2d, 0x63, 0x61,
-  0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69,
-  0x6d, 0x70, 0x6c, 0x79, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x73, 0x74, 0x72, 0x69, 0x78, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x65, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x74, 0x65, 0x6d, 0x61, 0x70, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x69, 0x74, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x31, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x61, 0x74, 0x69,
-  0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b,
-  0x65, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x6b, 0x69, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6b, 0x69, 0x69, 0x6e, 0x67, 0x2d, 0x6e, 0x6f, 0x72, 0x64, 0x69, 0x63, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x75, 0x6c, 0x6c,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x34, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x75, 0x6c,
-  0x6c, 0x2d, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x62, 0x6f, 0x6e, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x79, 0x61, 0x74, 0x6c, 0x61, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x31, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6b, 0x79, 0x70,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x61,
-  0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c,
-  0x61, 0x63, 0x6b, 0x2d, 0x68, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x31, 0x35, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x65, 0x69, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x63,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x64, 0x65, 0x72, 0x73, 0x2d, 0x68,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6c, 0x69, 0x64,
-  0x65, 0x73, 0x68, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x37, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x31, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x2d, 0x62, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x62, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d, 0x69, 0x6c, 0x65, 0x2d, 0x77,
-  0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x64, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6d, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x35, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6d, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x6d, 0x6f, 0x6b, 0x69, 0x6e, 0x67, 0x2d, 0x62, 0x61, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x34, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6d, 0x73, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37,
-  0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70, 0x63, 0x68, 0x61, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x61, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70,
-  0x63, 0x68, 0x61, 0x74, 0x2d, 0x67, 0x68, 0x6f, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x61, 0x70, 0x63, 0x68, 0x61, 0x74, 0x2d, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x66, 0x6c, 0x61,
-  0x6b, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6e,
-  0x6f, 0x77, 0x6d, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6e, 0x6f, 0x77, 0x70, 0x6c, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x32, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x36, 0x65, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x63, 0x6b, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x61, 0x72, 0x2d, 0x70, 0x61, 0x6e, 0x65,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x35, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70,
-  0x68, 0x61, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68,
-  0x61, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2d, 0x75, 0x70, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72,
-  0x74, 0x2d, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x36, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d,
-  0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x38, 0x38, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d,
-  0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x61, 0x6d, 0x6f, 0x75, 0x6e, 0x74, 0x2d, 0x75,
-  0x70, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72,
-  0x69, 0x63, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x2d,
-  0x64, 0x6f, 0x77, 0x6e, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x36, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63,
-  0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x6f, 0x72, 0x74, 0x2d, 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x2d, 0x75, 0x70, 0x2d, 0x61,
-  0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f,
-  0x72, 0x74, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x75, 0x6e, 0x64, 0x63, 0x6c, 0x6f, 0x75, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62,
-  0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x74, 0x72, 0x65,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x61,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x62, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x61, 0x63,
-  0x65, 0x2d, 0x73, 0x68, 0x75, 0x74, 0x74, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x61, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33,
-  0x66, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x65, 0x61, 0x6b, 0x65, 0x72, 0x2d,
-  0x64, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x70, 0x65, 0x6c, 0x6c, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x39,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x64, 0x65, 0x72, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x31, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x70, 0x6c, 0x6f,
-  0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x70, 0x6f, 0x74, 0x69, 0x66, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x63, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x70, 0x72, 0x61, 0x79, 0x2d, 0x63, 0x61, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d,
-  0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x2d, 0x72, 0x6f, 0x6f, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x36, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x62, 0x65, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x2d, 0x65, 0x78, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63,
-  0x6b, 0x2d, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x70, 0x61, 0x74, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x34, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x6d, 0x70,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x62, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x30, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72,
-  0x2d, 0x61, 0x6e, 0x64, 0x2d, 0x63, 0x72, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x36, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x68, 0x61,
-  0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74,
-  0x61, 0x72, 0x2d, 0x68, 0x61, 0x6c, 0x66, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x72, 0x2d, 0x6f, 0x66, 0x2d, 0x64,
-  0x61, 0x76, 0x69, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x61, 0x72, 0x2d, 0x6f, 0x66, 0x2d, 0x6c, 0x69, 0x66, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36,
-  0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x61, 0x79, 0x6c, 0x69, 0x6e, 0x6b,
-  0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74,
-  0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x65, 0x61, 0x6d, 0x2d, 0x73, 0x79, 0x6d,
-  0x62, 0x6f, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x65, 0x70, 0x2d, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x34, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x65, 0x70, 0x2d, 0x66, 0x6f, 0x72,
-  0x77, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x65, 0x74, 0x68, 0x6f, 0x73, 0x63, 0x6f, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x2d, 0x6d,
-  0x75, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73,
-  0x74, 0x69, 0x63, 0x6b, 0x79, 0x2d, 0x6e, 0x6f, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x34, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f,
-  0x70, 0x77, 0x61, 0x74, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x6f, 0x70, 0x77, 0x61, 0x74, 0x63, 0x68, 0x2d, 0x32, 0x30, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x36, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x34, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65,
-  0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x34, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x74, 0x6f, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x65, 0x30, 0x37, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x6f, 0x72, 0x65,
-  0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x31, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x72, 0x61, 0x76, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x32, 0x38, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x30,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x65, 0x65, 0x74, 0x2d, 0x76, 0x69, 0x65,
-  0x77, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x31, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72,
-  0x69, 0x6b, 0x65, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x65, 0x2d, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x32, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x72, 0x6f,
-  0x6f, 0x70, 0x77, 0x61, 0x66, 0x65, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x73, 0x74, 0x75, 0x64, 0x69, 0x6f, 0x76, 0x69, 0x6e, 0x61, 0x72, 0x69, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x33, 0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x74, 0x75, 0x6d, 0x62,
-  0x6c, 0x65, 0x75, 0x70, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x73, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x65, 0x75, 0x70, 0x6f, 0x6e, 0x2d, 0x63, 0x69,
-  0x72, 0x63, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x61, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x75, 0x62, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x62, 0x77, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x69, 0x74, 0x63, 0x61, 0x73, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x66, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x69, 0x74, 0x63,
-  0x61, 0x73, 0x65, 0x2d, 0x72, 0x6f, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70, 0x65, 0x72, 0x70, 0x6f, 0x77, 0x65, 0x72,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70,
-  0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x32, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x70, 0x70, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x72, 0x70, 0x72, 0x69, 0x73, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x75, 0x73, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x64, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x77, 0x61, 0x74, 0x63, 0x68,
-  0x62, 0x6f, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x77, 0x69, 0x66, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x65, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x73, 0x77, 0x69, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x73, 0x77, 0x69, 0x6d, 0x6d, 0x69, 0x6e, 0x67, 0x2d, 0x70, 0x6f, 0x6f,
-  0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6d,
-  0x66, 0x6f, 0x6e, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x33, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x73, 0x79, 0x6e, 0x61, 0x67, 0x6f, 0x67, 0x75, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6e, 0x63, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x6e, 0x63, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x66, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x73, 0x79, 0x72, 0x69, 0x6e, 0x67, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x38, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x2d, 0x74, 0x65, 0x6e, 0x6e, 0x69, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x64, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x30,
-  0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x74, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x74, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x61, 0x63, 0x68, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x33, 0x66, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x67, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x32, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x70, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x64, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x61, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x61, 0x78, 0x69, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x62, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x61, 0x6d, 0x73, 0x70,
-  0x65, 0x61, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x65, 0x65, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x65, 0x74, 0x68, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x32, 0x66,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6c, 0x65, 0x67, 0x72, 0x61, 0x6d, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6c, 0x65, 0x67, 0x72,
-  0x61, 0x6d, 0x2d, 0x70, 0x6c, 0x61, 0x6e, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d,
-  0x68, 0x69, 0x67, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x2d, 0x6c, 0x6f, 0x77, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x36, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6e, 0x63, 0x65,
-  0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x62, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x64, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x6e, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x37, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x32, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x65, 0x78, 0x74, 0x2d, 0x68, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x65, 0x78, 0x74, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x2d, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x2d, 0x6c, 0x69, 0x73, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x30, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x2d, 0x72,
-  0x65, 0x64, 0x2d, 0x79, 0x65, 0x74, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x39, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x6d, 0x61, 0x73, 0x6b, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x36, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x6d,
-  0x65, 0x63, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x68, 0x65, 0x6d, 0x65, 0x69, 0x73, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d,
-  0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65,
-  0x74, 0x65, 0x72, 0x2d, 0x66, 0x75, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d,
-  0x68, 0x61, 0x6c, 0x66, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x71, 0x75, 0x61, 0x72,
-  0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x68, 0x65, 0x72, 0x6d, 0x6f, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2d, 0x74, 0x68, 0x72, 0x65, 0x65,
-  0x2d, 0x71, 0x75, 0x61, 0x72, 0x74, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x63, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x69, 0x6e, 0x6b, 0x2d, 0x70, 0x65, 0x61, 0x6b, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d,
-  0x62, 0x73, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x35, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x73, 0x2d, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x36, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x68, 0x75, 0x6d, 0x62, 0x74, 0x61, 0x63,
-  0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x38, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x63,
-  0x6b, 0x65, 0x74, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x66, 0x66, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x69, 0x6b, 0x74, 0x6f, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x62, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x30, 0x64,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x2d, 0x63, 0x69, 0x72, 0x63,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69,
-  0x6e, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x34, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69,
-  0x6e, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x69, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x67, 0x67, 0x6c,
-  0x65, 0x2d, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x38, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74, 0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x31, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x69, 0x6c, 0x65, 0x74,
-  0x2d, 0x70, 0x61, 0x70, 0x65, 0x72, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30,
-  0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x6c, 0x62, 0x6f, 0x78, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x35, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x6c, 0x73,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x37, 0x64, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x6f, 0x74,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f, 0x72,
-  0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x6f,
-  0x72, 0x69, 0x69, 0x2d, 0x67, 0x61, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x32,
-  0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x64, 0x65, 0x2d, 0x66, 0x65, 0x64,
-  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x31, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x64, 0x65, 0x6d, 0x61, 0x72, 0x6b, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x35, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x66, 0x66, 0x69, 0x63, 0x2d,
-  0x6c, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x72, 0x61, 0x69, 0x6c, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x34, 0x31, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6d, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x61, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x32, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x6e,
-  0x73, 0x67, 0x65, 0x6e, 0x64, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32,
-  0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31,
-  0x66, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61,
-  0x73, 0x68, 0x2d, 0x72, 0x65, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x61, 0x73, 0x68, 0x2d, 0x72, 0x65, 0x73, 0x74,
-  0x6f, 0x72, 0x65, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x61, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x65, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x62, 0x62, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x72, 0x65, 0x6c, 0x6c, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x31, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x69, 0x70, 0x61, 0x64, 0x76, 0x69, 0x73, 0x6f, 0x72,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x36, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x6f, 0x70,
-  0x68, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72,
-  0x75, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x64, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74,
-  0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6c, 0x6f, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6d, 0x6f,
-  0x6e, 0x73, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x6d, 0x6f, 0x76, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x34, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x72, 0x75, 0x63, 0x6b, 0x2d, 0x70,
-  0x69, 0x63, 0x6b, 0x75, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x74, 0x73, 0x68, 0x69, 0x72, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x74, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x74, 0x75, 0x6d, 0x62, 0x6c, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x76, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x36, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x77, 0x69, 0x74, 0x63,
-  0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x77, 0x69,
-  0x74, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x39, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x74, 0x77, 0x69, 0x74, 0x74, 0x65, 0x72, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x38, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x74, 0x79, 0x70, 0x6f, 0x33, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x32, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x62, 0x65, 0x72, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x62, 0x75, 0x6e, 0x74,
-  0x75, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x37, 0x64, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x69, 0x6b,
-  0x69, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6d,
-  0x62, 0x72, 0x61, 0x63, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x65, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6d, 0x62, 0x72, 0x65, 0x6c, 0x6c, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x65, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6d, 0x62, 0x72, 0x65, 0x6c, 0x6c, 0x61, 0x2d, 0x62, 0x65,
-  0x61, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75,
-  0x6e, 0x63, 0x68, 0x61, 0x72, 0x74, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x6f, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x30, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x64, 0x6f, 0x2d, 0x61, 0x6c,
-  0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69,
-  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x72, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x34, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x61, 0x6c, 0x2d, 0x61,
-  0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6e, 0x69, 0x76, 0x65, 0x72, 0x73, 0x69, 0x74, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39,
-  0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x69, 0x6e, 0x6b, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x39, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x6c, 0x6f, 0x63,
-  0x6b, 0x2d, 0x61, 0x6c, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x75, 0x6e, 0x73, 0x70, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x63, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x6e, 0x74, 0x61, 0x70, 0x70, 0x64, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34,
-  0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x70, 0x6c, 0x6f, 0x61, 0x64, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x30, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x70, 0x73, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x65, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x62, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x38, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x61, 0x6c, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x61, 0x6c, 0x74, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x61,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x61, 0x73, 0x74, 0x72, 0x6f,
-  0x6e, 0x61, 0x75, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x63,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x69, 0x72, 0x63, 0x6c,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x63, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66, 0x64, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x63, 0x6f, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x66,
-  0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x65, 0x64, 0x69, 0x74,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x34, 0x66, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x66, 0x72, 0x69, 0x65, 0x6e, 0x64, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x30, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x67, 0x72, 0x61, 0x64, 0x75, 0x61, 0x74,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x69, 0x6e, 0x6a, 0x75, 0x72, 0x65, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x32, 0x38, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6c, 0x6f, 0x63, 0x6b, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x30, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6d,
-  0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x66, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65,
-  0x72, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6e, 0x69, 0x6e, 0x6a, 0x61, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x30, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x6e, 0x75,
-  0x72, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75,
-  0x73, 0x65, 0x72, 0x2d, 0x70, 0x6c, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x65, 0x63, 0x72, 0x65, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x31, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d,
-  0x73, 0x68, 0x69, 0x65, 0x6c, 0x64, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x35, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35,
-  0x30, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x74, 0x61, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x30, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x2d, 0x74, 0x69, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x30, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x73, 0x65, 0x72, 0x2d, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x35,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x63,
-  0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72, 0x73, 0x2d, 0x63, 0x6f, 0x67,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x35, 0x30, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x73, 0x65, 0x72,
-  0x73, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x33, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x70, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65, 0x31, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x75, 0x73, 0x73, 0x75, 0x6e, 0x6e, 0x61, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30,
-  0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x75, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6c, 0x2d, 0x73,
-  0x70, 0x6f, 0x6f, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x75, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x65, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x61, 0x61, 0x64, 0x69, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x38,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2d, 0x73, 0x71, 0x75,
-  0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x62, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76,
-  0x65, 0x6e, 0x75, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x76, 0x65, 0x6e, 0x75, 0x73, 0x2d, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32,
-  0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65, 0x6e, 0x75, 0x73, 0x2d, 0x6d, 0x61,
-  0x72, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65,
-  0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x65,
-  0x73, 0x74, 0x2d, 0x70, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x36,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x63, 0x6f, 0x69, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x33, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x64, 0x65, 0x6f, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x32, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x64, 0x65,
-  0x6f, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x61, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x32, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x61, 0x6c, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x33, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x62, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72,
-  0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x39,
-  0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x33,
-  0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x64, 0x65, 0x6f, 0x2d, 0x73, 0x6c, 0x61,
-  0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69,
-  0x68, 0x61, 0x72, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x76, 0x69, 0x6d, 0x65, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x76, 0x69, 0x6d, 0x65, 0x6f, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x31, 0x39, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x6d, 0x65, 0x6f, 0x2d, 0x76,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x37, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x6e, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x63, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72, 0x75,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72,
-  0x75, 0x73, 0x2d, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37, 0x35, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x69, 0x72, 0x75, 0x73, 0x65, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x37,
-  0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6b, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x39, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6e, 0x76, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x62, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x69, 0x63, 0x65, 0x6d, 0x61, 0x69, 0x6c, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x38, 0x39, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x6c, 0x65, 0x79, 0x62,
-  0x61, 0x6c, 0x6c, 0x2d, 0x62, 0x61, 0x6c, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x35, 0x66, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x64, 0x6f, 0x77, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x30, 0x32, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d,
-  0x65, 0x2d, 0x6d, 0x75, 0x74, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x39, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x6f, 0x66, 0x66, 0x3a, 0x62, 0x65, 0x66,
-  0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30,
-  0x32, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x2d, 0x75,
-  0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x30, 0x32, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x6f, 0x74,
-  0x65, 0x2d, 0x79, 0x65, 0x61, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x76, 0x72, 0x2d, 0x63, 0x61, 0x72, 0x64, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x32, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x76, 0x75, 0x65, 0x6a, 0x73, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x34, 0x31, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x6c, 0x6b, 0x69, 0x6e,
-  0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x6c,
-  0x6c, 0x65, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x35, 0x35, 0x35, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77,
-  0x61, 0x72, 0x65, 0x68, 0x6f, 0x75, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x34, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x74, 0x63, 0x68, 0x6d, 0x61, 0x6e, 0x2d, 0x6d, 0x6f, 0x6e,
-  0x69, 0x74, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x65, 0x30, 0x38, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x77, 0x61, 0x74, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x37, 0x33, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x76, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x33, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x61, 0x7a, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x38, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x65, 0x62, 0x6c,
-  0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x35, 0x63, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x69,
-  0x62, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x38, 0x61, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x68, 0x61, 0x6e, 0x67, 0x69, 0x6e, 0x67, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x65, 0x69, 0x78, 0x69, 0x6e,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x31, 0x64, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x68, 0x61, 0x74,
-  0x73, 0x61, 0x70, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x68, 0x61, 0x74, 0x73, 0x61, 0x70, 0x70, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x34, 0x30, 0x63, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x68, 0x65, 0x65, 0x6c,
-  0x63, 0x68, 0x61, 0x69, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x68, 0x6d, 0x63, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x30, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x69, 0x66, 0x69, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x69, 0x6b, 0x69, 0x70, 0x65, 0x64, 0x69, 0x61, 0x2d, 0x77, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x32, 0x36, 0x36, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x37, 0x32, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d,
-  0x63, 0x6c, 0x6f, 0x73, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x69, 0x7a, 0x65,
-  0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a,
-  0x22, 0x5c, 0x66, 0x32, 0x64, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64,
-  0x6f, 0x77, 0x2d, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64,
-  0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2d, 0x72, 0x65,
-  0x73, 0x74, 0x6f, 0x72, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x64, 0x32, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x37, 0x61, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d, 0x62, 0x6f, 0x74, 0x74, 0x6c, 0x65, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x37, 0x32, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d,
-  0x67, 0x6c, 0x61, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e,
-  0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x65, 0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61,
-  0x2d, 0x77, 0x69, 0x6e, 0x65, 0x2d, 0x67, 0x6c, 0x61, 0x73, 0x73, 0x2d, 0x61, 0x6c, 0x74, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x35, 0x63, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x78, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x35, 0x63, 0x66, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x69, 0x7a, 0x61, 0x72, 0x64,
-  0x73, 0x2d, 0x6f, 0x66, 0x2d, 0x74, 0x68, 0x65, 0x2d, 0x63, 0x6f, 0x61, 0x73, 0x74, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x37, 0x33, 0x30, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x64, 0x75, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x65, 0x30, 0x38, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x6c, 0x66, 0x2d, 0x70,
-  0x61, 0x63, 0x6b, 0x2d, 0x62, 0x61, 0x74, 0x74, 0x61, 0x6c, 0x69, 0x6f, 0x6e, 0x3a, 0x62, 0x65,
-  0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66,
-  0x35, 0x31, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x6e, 0x2d, 0x73, 0x69, 0x67,
-  0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x31, 0x35, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x6f, 0x72,
-  0x64, 0x70, 0x72, 0x65, 0x73, 0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x61, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x77, 0x6f, 0x72, 0x64, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2d, 0x73, 0x69, 0x6d, 0x70,
-  0x6c, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70,
-  0x62, 0x65, 0x67, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b,
-  0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x37, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x65, 0x78, 0x70, 0x6c, 0x6f, 0x72, 0x65, 0x72, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x32, 0x64, 0x65, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x66, 0x6f, 0x72, 0x6d,
-  0x73, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x32, 0x39, 0x38, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x77, 0x70, 0x72,
-  0x65, 0x73, 0x73, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x33, 0x65, 0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x77, 0x72, 0x65, 0x6e, 0x63, 0x68, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x30, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x78, 0x2d, 0x72, 0x61, 0x79, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x39, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x62, 0x6f, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31, 0x32, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x69, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x38, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x78, 0x69, 0x6e, 0x67, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x3a, 0x62,
-  0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c,
-  0x66, 0x31, 0x36, 0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x2d, 0x63, 0x6f, 0x6d, 0x62,
-  0x69, 0x6e, 0x61, 0x74, 0x6f, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f,
-  0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x33, 0x62, 0x22, 0x7d, 0x2e, 0x66,
-  0x61, 0x2d, 0x79, 0x61, 0x68, 0x6f, 0x6f, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x39, 0x65, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x79, 0x61, 0x6d, 0x6d, 0x65, 0x72, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
-  0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x38, 0x34, 0x30, 0x22,
-  0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x6e, 0x64, 0x65, 0x78, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x6e, 0x64, 0x65, 0x78, 0x2d, 0x69, 0x6e,
-  0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x34, 0x31,
-  0x34, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x61, 0x72, 0x6e, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x37, 0x65,
-  0x33, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x65, 0x6c, 0x70, 0x3a, 0x62, 0x65, 0x66, 0x6f,
-  0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x65,
-  0x39, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x65, 0x6e, 0x2d, 0x73, 0x69, 0x67, 0x6e, 0x3a,
-  0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22,
-  0x5c, 0x66, 0x31, 0x35, 0x37, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79, 0x69, 0x6e, 0x2d, 0x79,
-  0x61, 0x6e, 0x67, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65,
-  0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x61, 0x64, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x79,
-  0x6f, 0x61, 0x73, 0x74, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74,
-  0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x32, 0x62, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d,
-  0x79, 0x6f, 0x75, 0x74, 0x75, 0x62, 0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63,
-  0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3a, 0x22, 0x5c, 0x66, 0x31, 0x36, 0x37, 0x22, 0x7d, 0x2e,
-  0x66, 0x61, 0x2d, 0x79, 0x6f, 0x75, 0x74, 0x75, 0x62, 0x65, 0x2d, 0x73, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
-  0x3a, 0x22, 0x5c, 0x66, 0x34, 0x33, 0x31, 0x22, 0x7d, 0x2e, 0x66, 0x61, 0x2d, 0x7a, 0x68, 0x69,
-  0x68, 0x75, 0x3a, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x7b, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e,
-  0x74, 0x3a, 0x22, 0x5c, 0x66, 0x36, 0x33, 0x66, 0x22, 0x7d, 0x2e, 0x73, 0x72, 0x2d, 0x6f, 0x6e,
-  0x6c, 0x79, 0x7b, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3a, 0x30, 0x3b, 0x63, 0x6c, 0x69, 0x70,
-  0x3a, 0x72, 0x65, 0x63, 0x74, 0x28, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b, 0x68,
-  0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x31, 0x70, 0x78, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e,
-  0x3a, 0x2d, 0x31, 0x70, 0x78, 0x3b, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x68,
-  0x69, 0x64, 0x64, 0x65, 0x6e, 0x3b, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x30, 0x3b,
-  0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x61, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74,
-  0x65, 0x3b, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x31, 0x70, 0x78, 0x7d, 0x2e, 0x73, 0x72, 0x2d,
-  0x6f, 0x6e, 0x6c, 0x79, 0x2d, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3a, 0x61,
-  0x63, 0x74, 0x69, 0x76, 0x65, 0x2c, 0x2e, 0x73, 0x72, 0x2d, 0x6f, 0x6e, 0x6c, 0x79, 0x2d, 0x66,
-  0x6f, 0x63, 0x75, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x3a, 0x66, 0x6f, 0x63, 0x75, 0x73, 0x7b, 0x63,
-  0x6c, 0x69, 0x70, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a,
-  0x61, 0x75, 0x74, 0x6f, 0x3b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x30, 0x3b, 0x6f, 0x76,
-  0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x3a, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x3b, 0x70,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x3b, 0x77,
-  0x69, 0x64, 0x74, 0x68, 0x3a, 0x61, 0x75, 0x74, 0x6f, 0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79,
-  0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35,
-  0x20, 0x42, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x22, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74,
-  0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30, 0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d,
-  0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x73, 0x72,
-  0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e,
-  0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x66, 0x65, 0x61, 0x32, 0x34, 0x39, 0x36, 0x2e,
-  0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x66,
-  0x65, 0x61, 0x32, 0x34, 0x39, 0x36, 0x2e, 0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69, 0x65, 0x66, 0x69,
-  0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x65, 0x6d, 0x62, 0x65, 0x64,
-  0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75,
-  0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d,
-  0x34, 0x30, 0x30, 0x2e, 0x63, 0x39, 0x36, 0x37, 0x61, 0x39, 0x34, 0x63, 0x2e, 0x77, 0x6f, 0x66,
-  0x66, 0x32, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66,
-  0x32, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72,
-  0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x64, 0x63, 0x32, 0x63, 0x62, 0x61, 0x64,
-  0x64, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22,
-  0x77, 0x6f, 0x66, 0x66, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61,
-  0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x65, 0x63, 0x38, 0x32,
-  0x66, 0x32, 0x38, 0x32, 0x2e, 0x74, 0x74, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74,
-  0x28, 0x22, 0x74, 0x72, 0x75, 0x65, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x73, 0x2d, 0x34, 0x30,
-  0x30, 0x2e, 0x65, 0x33, 0x33, 0x65, 0x32, 0x63, 0x66, 0x36, 0x2e, 0x73, 0x76, 0x67, 0x23, 0x66,
-  0x6f, 0x6e, 0x74, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x28, 0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x62, 0x7b, 0x66,
-  0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74,
-  0x20, 0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x42, 0x72, 0x61, 0x6e, 0x64,
-  0x73, 0x22, 0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20,
-  0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
-  0x6c, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30,
-  0x30, 0x3b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30,
-  0x38, 0x66, 0x39, 0x38, 0x39, 0x31, 0x61, 0x2e, 0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63,
-  0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69,
-  0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c,
-  0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30, 0x38, 0x66, 0x39, 0x38, 0x39, 0x31, 0x61, 0x2e,
-  0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69, 0x65, 0x66, 0x69, 0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-  0x61, 0x74, 0x28, 0x22, 0x65, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65,
-  0x6e, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e,
-  0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66,
-  0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x31, 0x30,
-  0x30, 0x38, 0x62, 0x35, 0x32, 0x32, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x29, 0x20, 0x66, 0x6f,
-  0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x22, 0x29, 0x2c, 0x75, 0x72,
-  0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d,
-  0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d,
-  0x34, 0x30, 0x30, 0x2e, 0x31, 0x30, 0x36, 0x39, 0x65, 0x61, 0x35, 0x35, 0x2e, 0x77, 0x6f, 0x66,
-  0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x22,
-  0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75,
-  0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x31, 0x34, 0x39, 0x35, 0x66, 0x35, 0x37, 0x38,
-  0x2e, 0x74, 0x74, 0x66, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x74, 0x72,
-  0x75, 0x65, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f,
-  0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f,
-  0x66, 0x61, 0x2d, 0x72, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x2d, 0x34, 0x30, 0x30, 0x2e, 0x30,
-  0x36, 0x62, 0x39, 0x64, 0x31, 0x39, 0x63, 0x2e, 0x73, 0x76, 0x67, 0x23, 0x66, 0x6f, 0x6e, 0x74,
-  0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28,
-  0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d, 0x2e, 0x66, 0x61, 0x62, 0x2c, 0x2e, 0x66, 0x61, 0x72,
-  0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x34, 0x30, 0x30,
-  0x7d, 0x40, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x66, 0x61, 0x63, 0x65, 0x7b, 0x66, 0x6f, 0x6e, 0x74,
-  0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x41, 0x77,
-  0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x3b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x39, 0x30, 0x30, 0x3b,
-  0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x3a, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61,
-  0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x33, 0x61, 0x32, 0x34, 0x61,
-  0x36, 0x30, 0x65, 0x2e, 0x65, 0x6f, 0x74, 0x29, 0x3b, 0x73, 0x72, 0x63, 0x3a, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30,
-  0x2e, 0x33, 0x61, 0x32, 0x34, 0x61, 0x36, 0x30, 0x65, 0x2e, 0x65, 0x6f, 0x74, 0x3f, 0x23, 0x69,
-  0x65, 0x66, 0x69, 0x78, 0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x65, 0x6d,
-  0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x2d, 0x6f, 0x70, 0x65, 0x6e, 0x74, 0x79, 0x70, 0x65, 0x22,
-  0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69,
-  0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x29, 0x20, 0x66, 0x6f, 0x72,
-  0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x32, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c,
-  0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30,
-  0x2e, 0x34, 0x36, 0x66, 0x64, 0x62, 0x64, 0x32, 0x64, 0x2e, 0x77, 0x6f, 0x66, 0x66, 0x29, 0x20,
-  0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x77, 0x6f, 0x66, 0x66, 0x22, 0x29, 0x2c, 0x75,
-  0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2f,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f, 0x6c, 0x69, 0x64, 0x2d, 0x39,
-  0x30, 0x30, 0x2e, 0x31, 0x30, 0x65, 0x63, 0x65, 0x66, 0x63, 0x32, 0x2e, 0x74, 0x74, 0x66, 0x29,
-  0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x74, 0x72, 0x75, 0x65, 0x74, 0x79, 0x70,
-  0x65, 0x22, 0x29, 0x2c, 0x75, 0x72, 0x6c, 0x28, 0x2e, 0x2e, 0x2f, 0x2e, 0x2e, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2f, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x2f, 0x66, 0x61, 0x2d, 0x73, 0x6f,
-  0x6c, 0x69, 0x64, 0x2d, 0x39, 0x30, 0x30, 0x2e, 0x33, 0x37, 0x31, 0x64, 0x62, 0x63, 0x65, 0x30,
-  0x2e, 0x73, 0x76, 0x67, 0x23, 0x66, 0x6f, 0x6e, 0x74, 0x61, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65,
-  0x29, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x61, 0x74, 0x28, 0x22, 0x73, 0x76, 0x67, 0x22, 0x29, 0x7d,
-  0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x72, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x66, 0x6f,
-  0x6e, 0x74, 0x2d, 0x66, 0x61, 0x6d, 0x69, 0x6c, 0x79, 0x3a, 0x22, 0x46, 0x6f, 0x6e, 0x74, 0x20,
-  0x41, 0x77, 0x65, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x35, 0x20, 0x46, 0x72, 0x65, 0x65, 0x22, 0x7d,
-  0x2e, 0x66, 0x61, 0x2c, 0x2e, 0x66, 0x61, 0x73, 0x7b, 0x66, 0x6f, 0x6e, 0x74, 0x2d, 0x77, 0x65,
-  0x69, 0x67, 0x68, 0x74, 0x3a, 0x39, 0x30, 0x30, 0x7d
-};
-
-#endif /* CSS_SHUNK_RES_H */
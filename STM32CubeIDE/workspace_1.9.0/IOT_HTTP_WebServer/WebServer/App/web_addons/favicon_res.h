@@ -1,287 +0,0 @@
-/**
-  **********************************************************************************************************************
-  * @file    favicon_res.h
-  * @author  MCD Application Team
-  * @brief   This file implements the web page favicon resources
-  **********************************************************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2021 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  **********************************************************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
-#ifndef FAVICON_RES_H
-#define FAVICON_RES_H
-
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page favicon resources buffer */
-static const char favicon_buff[] =
-{
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
-  0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x08, 0x03, 0x00, 0x00, 0x00, 0x44, 0xa4, 0x8a,
-  0xc6, 0x00, 0x00, 0x00, 0x19, 0x74, 0x45, 0x58, 0x74, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72,
-  0x65, 0x00, 0x41, 0x64, 0x6f, 0x62, 0x65, 0x20, 0x49, 0x6d, 0x61, 0x67, 0x65, 0x52, 0x65, 0x61,
-  0x64, 0x79, 0x71, 0xc9, 0x65, 0x3c, 0x00, 0x00, 0x00, 0x33, 0x50, 0x4c, 0x54, 0x45, 0x81, 0x91,
-  0xa5, 0x13, 0x31, 0x56, 0xef, 0xf1, 0xf4, 0x62, 0x76, 0x8f, 0xa0, 0xac, 0xbb, 0xd0, 0xd6, 0xdd,
-  0xdf, 0xe3, 0xe8, 0x32, 0x4c, 0x6d, 0x90, 0x9e, 0xb0, 0x52, 0x68, 0x83, 0xc0, 0xc8, 0xd2, 0x23,
-  0x3f, 0x62, 0xb0, 0xba, 0xc7, 0x72, 0x84, 0x9a, 0x42, 0x5a, 0x78, 0x03, 0x23, 0x4b, 0xff, 0xff,
-  0xff, 0x79, 0x3e, 0x8c, 0x82, 0x00, 0x00, 0x00, 0x11, 0x74, 0x52, 0x4e, 0x53, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x25, 0xad,
-  0x99, 0x62, 0x00, 0x00, 0x00, 0xc2, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xdc, 0x93, 0xdd, 0x16,
-  0x84, 0x20, 0x08, 0x84, 0x11, 0xcd, 0xb4, 0x1f, 0xe5, 0xfd, 0x9f, 0x76, 0x19, 0xb4, 0xad, 0x73,
-  0x36, 0xdb, 0xfb, 0xb8, 0x19, 0xcb, 0x4f, 0x18, 0xc8, 0x48, 0xfe, 0x04, 0xbd, 0x09, 0x88, 0x94,
-  0xcb, 0x7d, 0x34, 0x20, 0xd4, 0x51, 0x38, 0x03, 0x96, 0xe1, 0x7e, 0x25, 0x03, 0x32, 0x56, 0xd3,
-  0xd8, 0x43, 0xd4, 0xfd, 0xf0, 0x64, 0x72, 0xaf, 0x75, 0x7e, 0xec, 0xc2, 0x69, 0x01, 0x91, 0x74,
-  0xa9, 0xac, 0xfc, 0x04, 0x2d, 0x06, 0xa0, 0x85, 0x5d, 0x64, 0xbb, 0x5a, 0x13, 0xf1, 0xd0, 0x64,
-  0x40, 0xd1, 0xd5, 0xca, 0x0a, 0xba, 0x2f, 0xc0, 0xc2, 0x5d, 0x15, 0xb0, 0x5c, 0xd5, 0x6b, 0xa9,
-  0xe9, 0x20, 0x7c, 0x2f, 0xe8, 0xcd, 0x83, 0xef, 0x2f, 0xf9, 0x24, 0x16, 0x91, 0xb5, 0xab, 0x10,
-  0x1f, 0xc7, 0x66, 0xee, 0xce, 0x60, 0x71, 0xe9, 0xaa, 0xc0, 0x69, 0x1e, 0x84, 0xa5, 0x0b, 0x6d,
-  0x74, 0x6d, 0x36, 0xb4, 0x9e, 0xde, 0x73, 0x2b, 0xed, 0xd8, 0x46, 0x07, 0x05, 0x70, 0x89, 0x4d,
-  0x1f, 0x9b, 0x35, 0x08, 0x5a, 0xff, 0xbd, 0x0f, 0xc8, 0x17, 0x6d, 0x74, 0xd5, 0xc5, 0x1b, 0xc0,
-  0xb7, 0xe9, 0x61, 0x74, 0x2e, 0xdc, 0xdc, 0x28, 0xc2, 0x0d, 0xd1, 0xaf, 0xba, 0x95, 0x9c, 0xe2,
-  0x1b, 0xff, 0x8b, 0x71, 0x7c, 0x04, 0x18, 0x00, 0x62, 0x78, 0x3a, 0x66, 0xfb, 0x38, 0xb6, 0x2e,
-  0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82, 0x2a, 0x00, 0x00, 0x78,
-  0x99, 0xb2, 0x3c, 0xb9, 0x24, 0x39, 0x45, 0x81, 0x5b, 0x08, 0x2d, 0x71, 0x07, 0x57, 0x57, 0x2e,
-  0x1e, 0x28, 0xce, 0x49, 0x17, 0x2b, 0x14, 0x36, 0x61, 0x02, 0x61, 0x9a, 0x40, 0x2e, 0xc2, 0x79,
-  0x99, 0x19, 0x32, 0x81, 0x34, 0x0f, 0xe0, 0xf3, 0xcc, 0x00, 0x00, 0xa0, 0x91, 0x15, 0x11, 0xe0,
-  0x83, 0xf3, 0xfd, 0x78, 0xce, 0x0e, 0xae, 0xce, 0xce, 0x36, 0x8e, 0xb6, 0x0e, 0x5f, 0x2d, 0xea,
-  0xbf, 0x06, 0xff, 0x22, 0x62, 0x62, 0xe3, 0xfe, 0xe5, 0xcf, 0xab, 0x70, 0x40, 0x00, 0x00, 0xe1,
-  0x74, 0x7e, 0xd1, 0xfe, 0x2c, 0x2f, 0xb3, 0x1a, 0x80, 0x3b, 0x06, 0x80, 0x6d, 0xfe, 0xa2, 0x25,
-  0xee, 0x04, 0x68, 0x5e, 0x0b, 0xa0, 0x75, 0xf7, 0x8b, 0x66, 0xb2, 0x0f, 0x40, 0xb5, 0x00, 0xa0,
-  0xe9, 0xda, 0x57, 0xf3, 0x70, 0xf8, 0x7e, 0x3c, 0x3c, 0x45, 0xa1, 0x90, 0xb9, 0xd9, 0xd9, 0xe5,
-  0xe4, 0xe4, 0xd8, 0x4a, 0xc4, 0x42, 0x5b, 0x61, 0xca, 0x57, 0x7d, 0xfe, 0x67, 0xc2, 0x5f, 0xc0,
-  0x57, 0xfd, 0x6c, 0xf9, 0x7e, 0x3c, 0xfc, 0xf7, 0xf5, 0xe0, 0xbe, 0xe2, 0x24, 0x81, 0x32, 0x5d,
-  0x81, 0x47, 0x04, 0xf8, 0xe0, 0xc2, 0xcc, 0xf4, 0x4c, 0xa5, 0x1c, 0xcf, 0x92, 0x09, 0x84, 0x62,
-  0xdc, 0xe6, 0x8f, 0x47, 0xfc, 0xb7, 0x0b, 0xff, 0xfc, 0x1d, 0xd3, 0x22, 0xc4, 0x49, 0x62, 0xb9,
-  0x58, 0x2a, 0x14, 0xe3, 0x51, 0x12, 0x71, 0x8e, 0x44, 0x9a, 0x8c, 0xf3, 0x32, 0xa5, 0x22, 0x89,
-  0x42, 0x92, 0x29, 0xc5, 0x25, 0xd2, 0xff, 0x64, 0xe2, 0xdf, 0x2c, 0xfb, 0x03, 0x3e, 0xdf, 0x35,
-  0x00, 0xb0, 0x6a, 0x3e, 0x01, 0x7b, 0x91, 0x2d, 0xa8, 0x5d, 0x63, 0x03, 0xf6, 0x4b, 0x27, 0x10,
-  0x58, 0x74, 0xc0, 0xe2, 0xf7, 0x00, 0x00, 0xf2, 0xbb, 0x6f, 0xc1, 0xd4, 0x28, 0x08, 0x03, 0x80,
-  0x68, 0x83, 0xe1, 0xcf, 0x77, 0xff, 0xef, 0x3f, 0xfd, 0x47, 0xa0, 0x25, 0x00, 0x80, 0x66, 0x49,
-  0x92, 0x71, 0x00, 0x00, 0x5e, 0x44, 0x24, 0x2e, 0x54, 0xca, 0xb3, 0x3f, 0xc7, 0x08, 0x00, 0x00,
-  0x44, 0xa0, 0x81, 0x2a, 0xb0, 0x41, 0x1b, 0xf4, 0xc1, 0x18, 0x2c, 0xc0, 0x06, 0x1c, 0xc1, 0x05,
-  0xdc, 0xc1, 0x0b, 0xfc, 0x60, 0x36, 0x84, 0x42, 0x24, 0xc4, 0xc2, 0x42, 0x10, 0x42, 0x0a, 0x64,
-  0x80, 0x1c, 0x72, 0x60, 0x29, 0xac, 0x82, 0x42, 0x28, 0x86, 0xcd, 0xb0, 0x1d, 0x2a, 0x60, 0x2f,
-  0xd4, 0x40, 0x1d, 0x34, 0xc0, 0x51, 0x68, 0x86, 0x93, 0x70, 0x0e, 0x2e, 0xc2, 0x55, 0xb8, 0x0e,
-  0x3d, 0x70, 0x0f, 0xfa, 0x61, 0x08, 0x9e, 0xc1, 0x28, 0xbc, 0x81, 0x09, 0x04, 0x41, 0xc8, 0x08,
-  0x13, 0x61, 0x21, 0xda, 0x88, 0x01, 0x62, 0x8a, 0x58, 0x23, 0x8e, 0x08, 0x17, 0x99, 0x85, 0xf8,
-  0x21, 0xc1, 0x48, 0x04, 0x12, 0x8b, 0x24, 0x20, 0xc9, 0x88, 0x14, 0x51, 0x22, 0x4b, 0x91, 0x35,
-  0x48, 0x31, 0x52, 0x8a, 0x54, 0x20, 0x55, 0x48, 0x1d, 0xf2, 0x3d, 0x72, 0x02, 0x39, 0x87, 0x5c,
-  0x46, 0xba, 0x91, 0x3b, 0xc8, 0x00, 0x32, 0x82, 0xfc, 0x86, 0xbc, 0x47, 0x31, 0x94, 0x81, 0xb2,
-  0x51, 0x3d, 0xd4, 0x0c, 0xb5, 0x43, 0xb9, 0xa8, 0x37, 0x1a, 0x84, 0x46, 0xa2, 0x0b, 0xd0, 0x64,
-  0x74, 0x31, 0x9a, 0x8f, 0x16, 0xa0, 0x9b, 0xd0, 0x72, 0xb4, 0x1a, 0x3d, 0x8c, 0x36, 0xa1, 0xe7,
-  0xd0, 0xab, 0x68, 0x0f, 0xda, 0x8f, 0x3e, 0x43, 0xc7, 0x30, 0xc0, 0xe8, 0x18, 0x07, 0x33, 0xc4,
-  0x6c, 0x30, 0x2e, 0xc6, 0xc3, 0x42, 0xb1, 0x38, 0x2c, 0x09, 0x93, 0x63, 0xcb, 0xb1, 0x22, 0xac,
-  0x0c, 0xab, 0xc6, 0x1a, 0xb0, 0x56, 0xac, 0x03, 0xbb, 0x89, 0xf5, 0x63, 0xcf, 0xb1, 0x77, 0x04,
-  0x12, 0x81, 0x45, 0xc0, 0x09, 0x36, 0x04, 0x77, 0x42, 0x20, 0x61, 0x1e, 0x41, 0x48, 0x58, 0x4c,
-  0x58, 0x4e, 0xd8, 0x48, 0xa8, 0x20, 0x1c, 0x24, 0x34, 0x11, 0xda, 0x09, 0x37, 0x09, 0x03, 0x84,
-  0x51, 0xc2, 0x27, 0x22, 0x93, 0xa8, 0x4b, 0xb4, 0x26, 0xba, 0x11, 0xf9, 0xc4, 0x18, 0x62, 0x32,
-  0x31, 0x87, 0x58, 0x48, 0x2c, 0x23, 0xd6, 0x12, 0x8f, 0x13, 0x2f, 0x10, 0x7b, 0x88, 0x43, 0xc4,
-  0x37, 0x24, 0x12, 0x89, 0x43, 0x32, 0x27, 0xb9, 0x90, 0x02, 0x49, 0xb1, 0xa4, 0x54, 0xd2, 0x12,
-  0xd2, 0x46, 0xd2, 0x6e, 0x52, 0x23, 0xe9, 0x2c, 0xa9, 0x9b, 0x34, 0x48, 0x1a, 0x23, 0x93, 0xc9,
-  0xda, 0x64, 0x6b, 0xb2, 0x07, 0x39, 0x94, 0x2c, 0x20, 0x2b, 0xc8, 0x85, 0xe4, 0x9d, 0xe4, 0xc3,
-  0xe4, 0x33, 0xe4, 0x1b, 0xe4, 0x21, 0xf2, 0x5b, 0x0a, 0x9d, 0x62, 0x40, 0x71, 0xa4, 0xf8, 0x53,
-  0xe2, 0x28, 0x52, 0xca, 0x6a, 0x4a, 0x19, 0xe5, 0x10, 0xe5, 0x34, 0xe5, 0x06, 0x65, 0x98, 0x32,
-  0x41, 0x55, 0xa3, 0x9a, 0x52, 0xdd, 0xa8, 0xa1, 0x54, 0x11, 0x35, 0x8f, 0x5a, 0x42, 0xad, 0xa1,
-  0xb6, 0x52, 0xaf, 0x51, 0x87, 0xa8, 0x13, 0x34, 0x75, 0x9a, 0x39, 0xcd, 0x83, 0x16, 0x49, 0x4b,
-  0xa5, 0xad, 0xa2, 0x95, 0xd3, 0x1a, 0x68, 0x17, 0x68, 0xf7, 0x69, 0xaf, 0xe8, 0x74, 0xba, 0x11,
-  0xdd, 0x95, 0x1e, 0x4e, 0x97, 0xd0, 0x57, 0xd2, 0xcb, 0xe9, 0x47, 0xe8, 0x97, 0xe8, 0x03, 0xf4,
-  0x77, 0x0c, 0x0d, 0x86, 0x15, 0x83, 0xc7, 0x88, 0x67, 0x28, 0x19, 0x9b, 0x18, 0x07, 0x18, 0x67,
-  0x19, 0x77, 0x18, 0xaf, 0x98, 0x4c, 0xa6, 0x19, 0xd3, 0x8b, 0x19, 0xc7, 0x54, 0x30, 0x37, 0x31,
-  0xeb, 0x98, 0xe7, 0x99, 0x0f, 0x99, 0x6f, 0x55, 0x58, 0x2a, 0xb6, 0x2a, 0x7c, 0x15, 0x91, 0xca,
-  0x0a, 0x95, 0x4a, 0x95, 0x26, 0x95, 0x1b, 0x2a, 0x2f, 0x54, 0xa9, 0xaa, 0xa6, 0xaa, 0xde, 0xaa,
-  0x0b, 0x55, 0xf3, 0x55, 0xcb, 0x54, 0x8f, 0xa9, 0x5e, 0x53, 0x7d, 0xae, 0x46, 0x55, 0x33, 0x53,
-  0xe3, 0xa9, 0x09, 0xd4, 0x96, 0xab, 0x55, 0xaa, 0x9d, 0x50, 0xeb, 0x53, 0x1b, 0x53, 0x67, 0xa9,
-  0x3b, 0xa8, 0x87, 0xaa, 0x67, 0xa8, 0x6f, 0x54, 0x3f, 0xa4, 0x7e, 0x59, 0xfd, 0x89, 0x06, 0x59,
-  0xc3, 0x4c, 0xc3, 0x4f, 0x43, 0xa4, 0x51, 0xa0, 0xb1, 0x5f, 0xe3, 0xbc, 0xc6, 0x20, 0x0b, 0x63,
-  0x19, 0xb3, 0x78, 0x2c, 0x21, 0x6b, 0x0d, 0xab, 0x86, 0x75, 0x81, 0x35, 0xc4, 0x26, 0xb1, 0xcd,
-  0xd9, 0x7c, 0x76, 0x2a, 0xbb, 0x98, 0xfd, 0x1d, 0xbb, 0x8b, 0x3d, 0xaa, 0xa9, 0xa1, 0x39, 0x43,
-  0x33, 0x4a, 0x33, 0x57, 0xb3, 0x52, 0xf3, 0x94, 0x66, 0x3f, 0x07, 0xe3, 0x98, 0x71, 0xf8, 0x9c,
-  0x74, 0x4e, 0x09, 0xe7, 0x28, 0xa7, 0x97, 0xf3, 0x7e, 0x8a, 0xde, 0x14, 0xef, 0x29, 0xe2, 0x29,
-  0x1b, 0xa6, 0x34, 0x4c, 0xb9, 0x31, 0x65, 0x5c, 0x6b, 0xaa, 0x96, 0x97, 0x96, 0x58, 0xab, 0x48,
-  0xab, 0x51, 0xab, 0x47, 0xeb, 0xbd, 0x36, 0xae, 0xed, 0xa7, 0x9d, 0xa6, 0xbd, 0x45, 0xbb, 0x59,
-  0xfb, 0x81, 0x0e, 0x41, 0xc7, 0x4a, 0x27, 0x5c, 0x27, 0x47, 0x67, 0x8f, 0xce, 0x05, 0x9d, 0xe7,
-  0x53, 0xd9, 0x53, 0xdd, 0xa7, 0x0a, 0xa7, 0x16, 0x4d, 0x3d, 0x3a, 0xf5, 0xae, 0x2e, 0xaa, 0x6b,
-  0xa5, 0x1b, 0xa1, 0xbb, 0x44, 0x77, 0xbf, 0x6e, 0xa7, 0xee, 0x98, 0x9e, 0xbe, 0x5e, 0x80, 0x9e,
-  0x4c, 0x6f, 0xa7, 0xde, 0x79, 0xbd, 0xe7, 0xfa, 0x1c, 0x7d, 0x2f, 0xfd, 0x54, 0xfd, 0x6d, 0xfa,
-  0xa7, 0xf5, 0x47, 0x0c, 0x58, 0x06, 0xb3, 0x0c, 0x24, 0x06, 0xdb, 0x0c, 0xce, 0x18, 0x3c, 0xc5,
-  0x35, 0x71, 0x6f, 0x3c, 0x1d, 0x2f, 0xc7, 0xdb, 0xf1, 0x51, 0x43, 0x5d, 0xc3, 0x40, 0x43, 0xa5,
-  0x61, 0x95, 0x61, 0x97, 0xe1, 0x84, 0x91, 0xb9, 0xd1, 0x3c, 0xa3, 0xd5, 0x46, 0x8d, 0x46, 0x0f,
-  0x8c, 0x69, 0xc6, 0x5c, 0xe3, 0x24, 0xe3, 0x6d, 0xc6, 0x6d, 0xc6, 0xa3, 0x26, 0x06, 0x26, 0x21,
-  0x26, 0x4b, 0x4d, 0xea, 0x4d, 0xee, 0x9a, 0x52, 0x4d, 0xb9, 0xa6, 0x29, 0xa6, 0x3b, 0x4c, 0x3b,
-  0x4c, 0xc7, 0xcd, 0xcc, 0xcd, 0xa2, 0xcd, 0xd6, 0x99, 0x35, 0x9b, 0x3d, 0x31, 0xd7, 0x32, 0xe7,
-  0x9b, 0xe7, 0x9b, 0xd7, 0x9b, 0xdf, 0xb7, 0x60, 0x5a, 0x78, 0x5a, 0x2c, 0xb6, 0xa8, 0xb6, 0xb8,
-  0x65, 0x49, 0xb2, 0xe4, 0x5a, 0xa6, 0x59, 0xee, 0xb6, 0xbc, 0x6e, 0x85, 0x5a, 0x39, 0x59, 0xa5,
-  0x58, 0x55, 0x5a, 0x5d, 0xb3, 0x46, 0xad, 0x9d, 0xad, 0x25, 0xd6, 0xbb, 0xad, 0xbb, 0xa7, 0x11,
-  0xa7, 0xb9, 0x4e, 0x93, 0x4e, 0xab, 0x9e, 0xd6, 0x67, 0xc3, 0xb0, 0xf1, 0xb6, 0xc9, 0xb6, 0xa9,
-  0xb7, 0x19, 0xb0, 0xe5, 0xd8, 0x06, 0xdb, 0xae, 0xb6, 0x6d, 0xb6, 0x7d, 0x61, 0x67, 0x62, 0x17,
-  0x67, 0xb7, 0xc5, 0xae, 0xc3, 0xee, 0x93, 0xbd, 0x93, 0x7d, 0xba, 0x7d, 0x8d, 0xfd, 0x3d, 0x07,
-  0x0d, 0x87, 0xd9, 0x0e, 0xab, 0x1d, 0x5a, 0x1d, 0x7e, 0x73, 0xb4, 0x72, 0x14, 0x3a, 0x56, 0x3a,
-  0xde, 0x9a, 0xce, 0x9c, 0xee, 0x3f, 0x7d, 0xc5, 0xf4, 0x96, 0xe9, 0x2f, 0x67, 0x58, 0xcf, 0x10,
-  0xcf, 0xd8, 0x33, 0xe3, 0xb6, 0x13, 0xcb, 0x29, 0xc4, 0x69, 0x9d, 0x53, 0x9b, 0xd3, 0x47, 0x67,
-  0x17, 0x67, 0xb9, 0x73, 0x83, 0xf3, 0x88, 0x8b, 0x89, 0x4b, 0x82, 0xcb, 0x2e, 0x97, 0x3e, 0x2e,
-  0x9b, 0x1b, 0xc6, 0xdd, 0xc8, 0xbd, 0xe4, 0x4a, 0x74, 0xf5, 0x71, 0x5d, 0xe1, 0x7a, 0xd2, 0xf5,
-  0x9d, 0x9b, 0xb3, 0x9b, 0xc2, 0xed, 0xa8, 0xdb, 0xaf, 0xee, 0x36, 0xee, 0x69, 0xee, 0x87, 0xdc,
-  0x9f, 0xcc, 0x34, 0x9f, 0x29, 0x9e, 0x59, 0x33, 0x73, 0xd0, 0xc3, 0xc8, 0x43, 0xe0, 0x51, 0xe5,
-  0xd1, 0x3f, 0x0b, 0x9f, 0x95, 0x30, 0x6b, 0xdf, 0xac, 0x7e, 0x4f, 0x43, 0x4f, 0x81, 0x67, 0xb5,
-  0xe7, 0x23, 0x2f, 0x63, 0x2f, 0x91, 0x57, 0xad, 0xd7, 0xb0, 0xb7, 0xa5, 0x77, 0xaa, 0xf7, 0x61,
-  0xef, 0x17, 0x3e, 0xf6, 0x3e, 0x72, 0x9f, 0xe3, 0x3e, 0xe3, 0x3c, 0x37, 0xde, 0x32, 0xde, 0x59,
-  0x5f, 0xcc, 0x37, 0xc0, 0xb7, 0xc8, 0xb7, 0xcb, 0x4f, 0xc3, 0x6f, 0x9e, 0x5f, 0x85, 0xdf, 0x43,
-  0x7f, 0x23, 0xff, 0x64, 0xff, 0x7a, 0xff, 0xd1, 0x00, 0xa7, 0x80, 0x25, 0x01, 0x67, 0x03, 0x89,
-  0x81, 0x41, 0x81, 0x5b, 0x02, 0xfb, 0xf8, 0x7a, 0x7c, 0x21, 0xbf, 0x8e, 0x3f, 0x3a, 0xdb, 0x65,
-  0xf6, 0xb2, 0xd9, 0xed, 0x41, 0x8c, 0xa0, 0xb9, 0x41, 0x15, 0x41, 0x8f, 0x82, 0xad, 0x82, 0xe5,
-  0xc1, 0xad, 0x21, 0x68, 0xc8, 0xec, 0x90, 0xad, 0x21, 0xf7, 0xe7, 0x98, 0xce, 0x91, 0xce, 0x69,
-  0x0e, 0x85, 0x50, 0x7e, 0xe8, 0xd6, 0xd0, 0x07, 0x61, 0xe6, 0x61, 0x8b, 0xc3, 0x7e, 0x0c, 0x27,
-  0x85, 0x87, 0x85, 0x57, 0x86, 0x3f, 0x8e, 0x70, 0x88, 0x58, 0x1a, 0xd1, 0x31, 0x97, 0x35, 0x77,
-  0xd1, 0xdc, 0x43, 0x73, 0xdf, 0x44, 0xfa, 0x44, 0x96, 0x44, 0xde, 0x9b, 0x67, 0x31, 0x4f, 0x39,
-  0xaf, 0x2d, 0x4a, 0x35, 0x2a, 0x3e, 0xaa, 0x2e, 0x6a, 0x3c, 0xda, 0x37, 0xba, 0x34, 0xba, 0x3f,
-  0xc6, 0x2e, 0x66, 0x59, 0xcc, 0xd5, 0x58, 0x9d, 0x58, 0x49, 0x6c, 0x4b, 0x1c, 0x39, 0x2e, 0x2a,
-  0xae, 0x36, 0x6e, 0x6c, 0xbe, 0xdf, 0xfc, 0xed, 0xf3, 0x87, 0xe2, 0x9d, 0xe2, 0x0b, 0xe3, 0x7b,
-  0x17, 0x98, 0x2f, 0xc8, 0x5d, 0x70, 0x79, 0xa1, 0xce, 0xc2, 0xf4, 0x85, 0xa7, 0x16, 0xa9, 0x2e,
-  0x12, 0x2c, 0x3a, 0x96, 0x40, 0x4c, 0x88, 0x4e, 0x38, 0x94, 0xf0, 0x41, 0x10, 0x2a, 0xa8, 0x16,
-  0x8c, 0x25, 0xf2, 0x13, 0x77, 0x25, 0x8e, 0x0a, 0x79, 0xc2, 0x1d, 0xc2, 0x67, 0x22, 0x2f, 0xd1,
-  0x36, 0xd1, 0x88, 0xd8, 0x43, 0x5c, 0x2a, 0x1e, 0x4e, 0xf2, 0x48, 0x2a, 0x4d, 0x7a, 0x92, 0xec,
-  0x91, 0xbc, 0x35, 0x79, 0x24, 0xc5, 0x33, 0xa5, 0x2c, 0xe5, 0xb9, 0x84, 0x27, 0xa9, 0x90, 0xbc,
-  0x4c, 0x0d, 0x4c, 0xdd, 0x9b, 0x3a, 0x9e, 0x16, 0x9a, 0x76, 0x20, 0x6d, 0x32, 0x3d, 0x3a, 0xbd,
-  0x31, 0x83, 0x92, 0x91, 0x90, 0x71, 0x42, 0xaa, 0x21, 0x4d, 0x93, 0xb6, 0x67, 0xea, 0x67, 0xe6,
-  0x66, 0x76, 0xcb, 0xac, 0x65, 0x85, 0xb2, 0xfe, 0xc5, 0x6e, 0x8b, 0xb7, 0x2f, 0x1e, 0x95, 0x07,
-  0xc9, 0x6b, 0xb3, 0x90, 0xac, 0x05, 0x59, 0x2d, 0x0a, 0xb6, 0x42, 0xa6, 0xe8, 0x54, 0x5a, 0x28,
-  0xd7, 0x2a, 0x07, 0xb2, 0x67, 0x65, 0x57, 0x66, 0xbf, 0xcd, 0x89, 0xca, 0x39, 0x96, 0xab, 0x9e,
-  0x2b, 0xcd, 0xed, 0xcc, 0xb3, 0xca, 0xdb, 0x90, 0x37, 0x9c, 0xef, 0x9f, 0xff, 0xed, 0x12, 0xc2,
-  0x12, 0xe1, 0x92, 0xb6, 0xa5, 0x86, 0x4b, 0x57, 0x2d, 0x1d, 0x58, 0xe6, 0xbd, 0xac, 0x6a, 0x39,
-  0xb2, 0x3c, 0x71, 0x79, 0xdb, 0x0a, 0xe3, 0x15, 0x05, 0x2b, 0x86, 0x56, 0x06, 0xac, 0x3c, 0xb8,
-  0x8a, 0xb6, 0x2a, 0x6d, 0xd5, 0x4f, 0xab, 0xed, 0x57, 0x97, 0xae, 0x7e, 0xbd, 0x26, 0x7a, 0x4d,
-  0x6b, 0x81, 0x5e, 0xc1, 0xca, 0x82, 0xc1, 0xb5, 0x01, 0x6b, 0xeb, 0x0b, 0x55, 0x0a, 0xe5, 0x85,
-  0x7d, 0xeb, 0xdc, 0xd7, 0xed, 0x5d, 0x4f, 0x58, 0x2f, 0x59, 0xdf, 0xb5, 0x61, 0xfa, 0x86, 0x9d,
-  0x1b, 0x3e, 0x15, 0x89, 0x8a, 0xae, 0x14, 0xdb, 0x17, 0x97, 0x15, 0x7f, 0xd8, 0x28, 0xdc, 0x78,
-  0xe5, 0x1b, 0x87, 0x6f, 0xca, 0xbf, 0x99, 0xdc, 0x94, 0xb4, 0xa9, 0xab, 0xc4, 0xb9, 0x64, 0xcf,
-  0x66, 0xd2, 0x66, 0xe9, 0xe6, 0xde, 0x2d, 0x9e, 0x5b, 0x0e, 0x96, 0xaa, 0x97, 0xe6, 0x97, 0x0e,
-  0x6e, 0x0d, 0xd9, 0xda, 0xb4, 0x0d, 0xdf, 0x56, 0xb4, 0xed, 0xf5, 0xf6, 0x45, 0xdb, 0x2f, 0x97,
-  0xcd, 0x28, 0xdb, 0xbb, 0x83, 0xb6, 0x43, 0xb9, 0xa3, 0xbf, 0x3c, 0xb8, 0xbc, 0x65, 0xa7, 0xc9,
-  0xce, 0xcd, 0x3b, 0x3f, 0x54, 0xa4, 0x54, 0xf4, 0x54, 0xfa, 0x54, 0x36, 0xee, 0xd2, 0xdd, 0xb5,
-  0x61, 0xd7, 0xf8, 0x6e, 0xd1, 0xee, 0x1b, 0x7b, 0xbc, 0xf6, 0x34, 0xec, 0xd5, 0xdb, 0x5b, 0xbc,
-  0xf7, 0xfd, 0x3e, 0xc9, 0xbe, 0xdb, 0x55, 0x01, 0x55, 0x4d, 0xd5, 0x66, 0xd5, 0x65, 0xfb, 0x49,
-  0xfb, 0xb3, 0xf7, 0x3f, 0xae, 0x89, 0xaa, 0xe9, 0xf8, 0x96, 0xfb, 0x6d, 0x5d, 0xad, 0x4e, 0x6d,
-  0x71, 0xed, 0xc7, 0x03, 0xd2, 0x03, 0xfd, 0x07, 0x23, 0x0e, 0xb6, 0xd7, 0xb9, 0xd4, 0xd5, 0x1d,
-  0xd2, 0x3d, 0x54, 0x52, 0x8f, 0xd6, 0x2b, 0xeb, 0x47, 0x0e, 0xc7, 0x1f, 0xbe, 0xfe, 0x9d, 0xef,
-  0x77, 0x2d, 0x0d, 0x36, 0x0d, 0x55, 0x8d, 0x9c, 0xc6, 0xe2, 0x23, 0x70, 0x44, 0x79, 0xe4, 0xe9,
-  0xf7, 0x09, 0xdf, 0xf7, 0x1e, 0x0d, 0x3a, 0xda, 0x76, 0x8c, 0x7b, 0xac, 0xe1, 0x07, 0xd3, 0x1f,
-  0x76, 0x1d, 0x67, 0x1d, 0x2f, 0x6a, 0x42, 0x9a, 0xf2, 0x9a, 0x46, 0x9b, 0x53, 0x9a, 0xfb, 0x5b,
-  0x62, 0x5b, 0xba, 0x4f, 0xcc, 0x3e, 0xd1, 0xd6, 0xea, 0xde, 0x7a, 0xfc, 0x47, 0xdb, 0x1f, 0x0f,
-  0x9c, 0x34, 0x3c, 0x59, 0x79, 0x4a, 0xf3, 0x54, 0xc9, 0x69, 0xda, 0xe9, 0x82, 0xd3, 0x93, 0x67,
-  0xf2, 0xcf, 0x8c, 0x9d, 0x95, 0x9d, 0x7d, 0x7e, 0x2e, 0xf9, 0xdc, 0x60, 0xdb, 0xa2, 0xb6, 0x7b,
-  0xe7, 0x63, 0xce, 0xdf, 0x6a, 0x0f, 0x6f, 0xef, 0xba, 0x10, 0x74, 0xe1, 0xd2, 0x45, 0xff, 0x8b,
-  0xe7, 0x3b, 0xbc, 0x3b, 0xce, 0x5c, 0xf2, 0xb8, 0x74, 0xf2, 0xb2, 0xdb, 0xe5, 0x13, 0x57, 0xb8,
-  0x57, 0x9a, 0xaf, 0x3a, 0x5f, 0x6d, 0xea, 0x74, 0xea, 0x3c, 0xfe, 0x93, 0xd3, 0x4f, 0xc7, 0xbb,
-  0x9c, 0xbb, 0x9a, 0xae, 0xb9, 0x5c, 0x6b, 0xb9, 0xee, 0x7a, 0xbd, 0xb5, 0x7b, 0x66, 0xf7, 0xe9,
-  0x1b, 0x9e, 0x37, 0xce, 0xdd, 0xf4, 0xbd, 0x79, 0xf1, 0x16, 0xff, 0xd6, 0xd5, 0x9e, 0x39, 0x3d,
-  0xdd, 0xbd, 0xf3, 0x7a, 0x6f, 0xf7, 0xc5, 0xf7, 0xf5, 0xdf, 0x16, 0xdd, 0x7e, 0x72, 0x27, 0xfd,
-  0xce, 0xcb, 0xbb, 0xd9, 0x77, 0x27, 0xee, 0xad, 0xbc, 0x4f, 0xbc, 0x5f, 0xf4, 0x40, 0xed, 0x41,
-  0xd9, 0x43, 0xdd, 0x87, 0xd5, 0x3f, 0x5b, 0xfe, 0xdc, 0xd8, 0xef, 0xdc, 0x7f, 0x6a, 0xc0, 0x77,
-  0xa0, 0xf3, 0xd1, 0xdc, 0x47, 0xf7, 0x06, 0x85, 0x83, 0xcf, 0xfe, 0x91, 0xf5, 0x8f, 0x0f, 0x43,
-  0x05, 0x8f, 0x99, 0x8f, 0xcb, 0x86, 0x0d, 0x86, 0xeb, 0x9e, 0x38, 0x3e, 0x39, 0x39, 0xe2, 0x3f,
-  0x72, 0xfd, 0xe9, 0xfc, 0xa7, 0x43, 0xcf, 0x64, 0xcf, 0x26, 0x9e, 0x17, 0xfe, 0xa2, 0xfe, 0xcb,
-  0xae, 0x17, 0x16, 0x2f, 0x7e, 0xf8, 0xd5, 0xeb, 0xd7, 0xce, 0xd1, 0x98, 0xd1, 0xa1, 0x97, 0xf2,
-  0x97, 0x93, 0xbf, 0x6d, 0x7c, 0xa5, 0xfd, 0xea, 0xc0, 0xeb, 0x19, 0xaf, 0xdb, 0xc6, 0xc2, 0xc6,
-  0x1e, 0xbe, 0xc9, 0x78, 0x33, 0x31, 0x5e, 0xf4, 0x56, 0xfb, 0xed, 0xc1, 0x77, 0xdc, 0x77, 0x1d,
-  0xef, 0xa3, 0xdf, 0x0f, 0x4f, 0xe4, 0x7c, 0x20, 0x7f, 0x28, 0xff, 0x68, 0xf9, 0xb1, 0xf5, 0x53,
-  0xd0, 0xa7, 0xfb, 0x93, 0x19, 0x93, 0x93, 0xff, 0x04, 0x03, 0x98, 0xf3, 0xfc, 0x63, 0x33, 0x2d,
-  0xdb, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x7a, 0x25, 0x00, 0x00, 0x80,
-  0x83, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x80, 0xe9, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea,
-  0x60, 0x00, 0x00, 0x3a, 0x98, 0x00, 0x00, 0x17, 0x6f, 0x92, 0x5f, 0xc5, 0x46, 0x00, 0x00, 0x05,
-  0x49, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xec, 0x97, 0x5b, 0x8c, 0x55, 0xd5, 0x19, 0xc7, 0x7f,
-  0xdf, 0x5a, 0x6b, 0x9f, 0x7d, 0xce, 0x99, 0x39, 0x03, 0x33, 0x82, 0x30, 0xe0, 0x08, 0x4e, 0x90,
-  0x71, 0x20, 0x58, 0x8b, 0x80, 0x90, 0x82, 0x63, 0xd1, 0x52, 0x2f, 0x68, 0x52, 0xdb, 0x10, 0x43,
-  0x22, 0x89, 0x97, 0xc8, 0x8b, 0x55, 0x1e, 0x9a, 0xf0, 0xa0, 0xc6, 0x4b, 0x7c, 0xa0, 0x4d, 0x5a,
-  0xab, 0xa9, 0x46, 0x93, 0xda, 0x42, 0x43, 0x8c, 0x41, 0x25, 0xad, 0x86, 0x96, 0x91, 0xe8, 0x08,
-  0x58, 0xb5, 0x53, 0xc4, 0x51, 0xc1, 0x91, 0xab, 0x30, 0x83, 0x9c, 0xb9, 0xe0, 0x5c, 0xce, 0x99,
-  0x39, 0xb7, 0xbd, 0xf7, 0x5a, 0x7d, 0xd8, 0x13, 0x8a, 0x81, 0x69, 0x7c, 0x20, 0xf1, 0xa1, 0xb3,
-  0x92, 0x9d, 0xb5, 0x92, 0x2f, 0x7b, 0xad, 0xdf, 0xf7, 0xad, 0x6f, 0xfd, 0xbf, 0xb5, 0xc4, 0x39,
-  0xc7, 0xf7, 0xd9, 0x14, 0xdf, 0x73, 0x9b, 0x00, 0x98, 0x00, 0x98, 0x00, 0x30, 0xff, 0xcb, 0x98,
-  0x1d, 0xc8, 0xdd, 0xdd, 0xda, 0x71, 0x7c, 0x7d, 0xd7, 0xe0, 0xe8, 0x6c, 0x94, 0x11, 0xa5, 0xb5,
-  0x43, 0x69, 0xb4, 0x12, 0x8c, 0x08, 0x5a, 0x2b, 0xb4, 0x08, 0x5a, 0x0b, 0x5a, 0x04, 0xa5, 0x00,
-  0x04, 0x6b, 0xc1, 0xe2, 0x88, 0x2c, 0x58, 0x17, 0xf7, 0x91, 0x03, 0x67, 0x2d, 0xb8, 0x88, 0x72,
-  0x25, 0x50, 0x0b, 0x67, 0x4f, 0xe9, 0x5e, 0x7d, 0xcd, 0x15, 0xd7, 0x8d, 0x0b, 0xd0, 0xde, 0x79,
-  0x7c, 0xd3, 0xc6, 0x2d, 0xbb, 0x36, 0x66, 0x0b, 0x0e, 0x4c, 0x92, 0x00, 0x05, 0x9e, 0x8f, 0x78,
-  0x49, 0x7c, 0xa3, 0x48, 0x7b, 0x0a, 0xdf, 0xd3, 0xf8, 0x9e, 0x26, 0x69, 0x84, 0xa4, 0xa7, 0x48,
-  0x68, 0x85, 0x73, 0x8e, 0x52, 0x68, 0xe3, 0x2f, 0x70, 0x94, 0x03, 0x4b, 0x29, 0x88, 0x28, 0x86,
-  0x96, 0x30, 0x08, 0xb1, 0x41, 0x89, 0x62, 0x7e, 0x98, 0x17, 0xef, 0x6d, 0xf9, 0x60, 0xdc, 0x08,
-  0x8c, 0x16, 0x4b, 0x3f, 0x7a, 0xf2, 0x2f, 0xad, 0x1b, 0xfb, 0xf3, 0x21, 0x09, 0x2f, 0x41, 0x7d,
-  0x46, 0x58, 0xd4, 0x78, 0x29, 0x99, 0x64, 0x02, 0x27, 0x0a, 0x11, 0x50, 0x12, 0x7b, 0x2d, 0x2a,
-  0x1e, 0x2b, 0x01, 0x85, 0x80, 0x80, 0x75, 0xb1, 0xe7, 0x8e, 0x78, 0xec, 0x1c, 0x58, 0xc6, 0xfa,
-  0x28, 0x24, 0xe5, 0xcd, 0x70, 0x37, 0x2d, 0xb8, 0xe2, 0x85, 0x71, 0x01, 0xda, 0x3e, 0x3b, 0x76,
-  0xdf, 0xf1, 0xbe, 0x1c, 0x26, 0x95, 0xe2, 0xc7, 0xcd, 0xf5, 0x3c, 0xb6, 0xa6, 0x85, 0x29, 0xb5,
-  0x93, 0x2e, 0xe6, 0xd6, 0x77, 0x00, 0xbb, 0x2f, 0x08, 0xe0, 0xa0, 0xe1, 0xad, 0xf6, 0x43, 0x3f,
-  0x8b, 0xa2, 0x88, 0xcb, 0xeb, 0x6a, 0x78, 0x7a, 0xdd, 0xcd, 0x64, 0x52, 0x89, 0x8b, 0x9d, 0x7b,
-  0x2f, 0x3b, 0xe7, 0x22, 0x11, 0x39, 0x1f, 0xe0, 0x50, 0x76, 0x78, 0x4d, 0x7b, 0xe7, 0x89, 0xc9,
-  0x4a, 0x60, 0xc9, 0xbc, 0xc6, 0xb3, 0x8b, 0xff, 0xfb, 0xc8, 0x29, 0xda, 0xbe, 0xe8, 0xc6, 0x4f,
-  0x24, 0x50, 0x5a, 0x83, 0xd2, 0x28, 0xa5, 0x11, 0xa5, 0xc6, 0x12, 0x50, 0x10, 0x11, 0x02, 0x6b,
-  0x59, 0x39, 0x77, 0x3a, 0x4d, 0xd3, 0xe3, 0x88, 0xbd, 0xfd, 0xc9, 0x51, 0xf6, 0x77, 0x0d, 0x90,
-  0x4a, 0x25, 0x89, 0x1c, 0x2c, 0x6e, 0xbc, 0xf4, 0xcc, 0x8a, 0x2b, 0xa7, 0xbf, 0x3e, 0xde, 0x29,
-  0xf0, 0x5b, 0x3f, 0x3e, 0xbc, 0x6e, 0x34, 0x97, 0x43, 0x79, 0x09, 0x26, 0x57, 0xa7, 0xce, 0x1a,
-  0x8e, 0x74, 0x9d, 0xe6, 0x99, 0x37, 0x76, 0x33, 0xb9, 0x6e, 0x2a, 0xc6, 0x4f, 0x22, 0xc6, 0x43,
-  0x3c, 0x1f, 0x31, 0x1e, 0x46, 0x2b, 0x3c, 0x25, 0x28, 0xa5, 0xd0, 0x95, 0x51, 0x6e, 0x6c, 0xac,
-  0x05, 0x60, 0x70, 0x38, 0xc7, 0x6f, 0x5b, 0x3f, 0xe7, 0x54, 0x90, 0xc4, 0xd8, 0x88, 0x52, 0x61,
-  0x84, 0x05, 0x33, 0x6a, 0xb6, 0x03, 0xbd, 0x22, 0x72, 0x3e, 0x40, 0x29, 0xb4, 0x2b, 0xdb, 0xda,
-  0x3f, 0xbd, 0xda, 0x57, 0x16, 0x87, 0xe5, 0xcb, 0x13, 0xd9, 0xb3, 0xb6, 0xb5, 0x37, 0x2e, 0x26,
-  0x8c, 0xe0, 0x37, 0x3b, 0xf6, 0xe3, 0x4b, 0x82, 0x84, 0x11, 0xd0, 0x0e, 0xd1, 0x0e, 0xb4, 0x42,
-  0x29, 0x45, 0x31, 0x88, 0xb8, 0x7e, 0x46, 0x9a, 0xb9, 0x33, 0xa7, 0xc6, 0xb9, 0xf4, 0x45, 0x37,
-  0x5f, 0x17, 0x84, 0xda, 0x2a, 0x45, 0xa5, 0x5c, 0xa1, 0x71, 0x8a, 0x89, 0x56, 0xcc, 0xad, 0xff,
-  0xf3, 0xb8, 0x42, 0xb4, 0xf3, 0xd3, 0x13, 0xf7, 0x1d, 0x38, 0x74, 0x8c, 0xa4, 0xd1, 0xa4, 0x3c,
-  0xc5, 0xbe, 0x03, 0x87, 0xd9, 0xbc, 0xbb, 0x73, 0xcc, 0x2a, 0xac, 0x5b, 0xb5, 0x84, 0x27, 0xee,
-  0x6a, 0x21, 0x88, 0x22, 0xca, 0xa5, 0x22, 0x44, 0x15, 0x5c, 0x50, 0xc1, 0x05, 0x65, 0x6c, 0x10,
-  0x10, 0x94, 0x8b, 0xdc, 0xb1, 0xa4, 0x09, 0xc6, 0xbc, 0xdb, 0xf9, 0xe5, 0x00, 0x29, 0xad, 0x70,
-  0x41, 0x99, 0xbe, 0xc1, 0x41, 0xae, 0x9f, 0x33, 0xe5, 0xc3, 0xa4, 0xef, 0xb7, 0x5f, 0x50, 0x88,
-  0x22, 0xc7, 0x95, 0xbf, 0xdb, 0xbe, 0xeb, 0x96, 0xec, 0xd0, 0x00, 0x65, 0x26, 0x93, 0xf2, 0x93,
-  0x18, 0xe3, 0xd8, 0xf4, 0xca, 0xdf, 0x19, 0x29, 0x16, 0x79, 0xf0, 0xe6, 0x85, 0x00, 0xfc, 0x62,
-  0x59, 0x33, 0x35, 0x35, 0x35, 0x3c, 0xb5, 0x6d, 0x0f, 0x41, 0xa9, 0x84, 0xe7, 0xbb, 0x58, 0x5c,
-  0xa2, 0x32, 0xcd, 0xf5, 0x75, 0x2c, 0x6b, 0x6a, 0x88, 0xb7, 0xac, 0x2f, 0xc7, 0x9e, 0x93, 0xfd,
-  0x0c, 0x97, 0x4b, 0xe4, 0x83, 0x00, 0x15, 0x16, 0xb9, 0x75, 0x71, 0xf3, 0xcb, 0xc4, 0x27, 0xf2,
-  0xfc, 0x08, 0xfc, 0xf3, 0xc0, 0xd1, 0x75, 0xfb, 0xda, 0xdb, 0xd3, 0x49, 0x4f, 0x31, 0x5a, 0x2e,
-  0x73, 0xa6, 0x50, 0xa0, 0xa7, 0x50, 0xa0, 0x6f, 0x24, 0xc7, 0xaf, 0xb6, 0xbc, 0xc9, 0x86, 0xcd,
-  0x3b, 0x88, 0x6c, 0x04, 0xc0, 0xaa, 0xf9, 0x33, 0x79, 0xe8, 0xf6, 0xeb, 0xe8, 0x1a, 0x2d, 0x72,
-  0x6a, 0x24, 0x4f, 0xd7, 0x48, 0x9e, 0xc3, 0xc3, 0x39, 0x56, 0x5f, 0x3b, 0x0b, 0xdf, 0xc4, 0x53,
-  0xfe, 0xf1, 0x5f, 0x47, 0x39, 0xd4, 0xdb, 0x4f, 0x7f, 0xb1, 0xc0, 0xe8, 0x70, 0x8e, 0xd5, 0x0b,
-  0xaf, 0xea, 0x6a, 0xba, 0x6c, 0xda, 0xdf, 0xc6, 0x93, 0xe2, 0xcc, 0x9f, 0x76, 0xbc, 0xb7, 0xb6,
-  0x98, 0xcf, 0x63, 0xa4, 0x06, 0xa2, 0x31, 0xd9, 0x8c, 0x2c, 0x68, 0x0f, 0x31, 0x1e, 0xcf, 0xfe,
-  0x75, 0x2f, 0x03, 0x43, 0x39, 0x5e, 0x58, 0x7f, 0x27, 0xd5, 0x29, 0x9f, 0x9b, 0xe6, 0x37, 0x90,
-  0xf0, 0x85, 0xee, 0xa1, 0x1c, 0x18, 0xc3, 0xa4, 0xaa, 0x34, 0x2d, 0x4d, 0xf5, 0x00, 0xf4, 0xe4,
-  0x0a, 0x6c, 0xde, 0xfb, 0x19, 0x5a, 0x22, 0x74, 0x25, 0x20, 0x99, 0x50, 0x6c, 0x58, 0x79, 0xf5,
-  0x36, 0x60, 0xf0, 0x82, 0x00, 0xbd, 0x43, 0x23, 0xb7, 0x1d, 0xec, 0xee, 0x6f, 0x9c, 0x33, 0xa7,
-  0x11, 0xa3, 0x0d, 0xa2, 0x14, 0x4e, 0x69, 0x44, 0x6b, 0x9c, 0x68, 0x50, 0x0a, 0x2b, 0x9a, 0x3d,
-  0x9d, 0xa7, 0xe8, 0x3a, 0x33, 0xc4, 0xbc, 0x86, 0x69, 0xd4, 0xfa, 0x9a, 0x69, 0x2a, 0xe0, 0x74,
-  0x58, 0x21, 0x2c, 0x95, 0xb8, 0x63, 0x7e, 0x3d, 0x0d, 0x93, 0xd2, 0x00, 0x6c, 0xdb, 0xbb, 0x9f,
-  0xbe, 0x6c, 0x96, 0xaa, 0xaa, 0x34, 0x85, 0x62, 0x91, 0x65, 0x0b, 0x9a, 0x2a, 0x8b, 0x2e, 0xbf,
-  0x64, 0xcb, 0x05, 0x8b, 0x91, 0x73, 0x8e, 0xba, 0xea, 0xd4, 0x03, 0x3b, 0x37, 0x3d, 0x8c, 0x56,
-  0x8a, 0x6f, 0x5d, 0x51, 0xbf, 0x75, 0x61, 0x75, 0x28, 0x11, 0x6a, 0xd2, 0x49, 0x00, 0x8e, 0xf5,
-  0x0e, 0x70, 0xb2, 0x77, 0x00, 0xdf, 0x3a, 0xb4, 0x75, 0xdc, 0xbf, 0x72, 0x51, 0x9c, 0x4b, 0x91,
-  0xe5, 0xb5, 0x8f, 0x3a, 0xf1, 0xb0, 0xe8, 0x4a, 0x09, 0x37, 0x92, 0x67, 0xcd, 0x0f, 0x67, 0xb7,
-  0x2a, 0xe1, 0xc0, 0xb9, 0x53, 0x3f, 0xf4, 0xe8, 0x4b, 0x3c, 0xf7, 0xf4, 0x7a, 0x8c, 0xb5, 0x76,
-  0xa9, 0x67, 0xf4, 0x0d, 0x97, 0x64, 0xd2, 0xdf, 0x59, 0xc6, 0x4a, 0x95, 0x90, 0x27, 0xb7, 0xfe,
-  0x83, 0xbe, 0x9e, 0x3e, 0x30, 0x86, 0x96, 0x1f, 0xcc, 0x65, 0xe9, 0x55, 0xb3, 0x00, 0xd8, 0xd5,
-  0x71, 0x84, 0xf7, 0x3f, 0x3f, 0x86, 0x36, 0x9a, 0x5c, 0x2e, 0xe0, 0xe7, 0x4b, 0x9b, 0xbf, 0xb9,
-  0x67, 0xf9, 0xfc, 0xc7, 0xcf, 0xfd, 0xff, 0x97, 0x8f, 0xbc, 0xc8, 0x1f, 0x7e, 0xbf, 0x2d, 0x06,
-  0xd0, 0x5a, 0x2f, 0x07, 0x46, 0x80, 0xf0, 0xbb, 0x2c, 0x1e, 0x45, 0x96, 0xad, 0xef, 0xee, 0xa3,
-  0xbb, 0xe7, 0x1b, 0x7e, 0xb2, 0xa8, 0x99, 0xa0, 0x1c, 0xb2, 0xe1, 0xf6, 0x15, 0x18, 0x1d, 0x27,
-  0xdf, 0x91, 0xd3, 0xfd, 0x2c, 0x9f, 0x33, 0x43, 0xa6, 0xd6, 0xd6, 0x84, 0x3f, 0x5d, 0xd8, 0xd4,
-  0xbe, 0xfe, 0x96, 0x65, 0x8f, 0x01, 0x9f, 0x04, 0x41, 0xc8, 0xf3, 0x9b, 0x77, 0xf0, 0xc1, 0x47,
-  0x07, 0x79, 0xed, 0x8d, 0x36, 0x98, 0x54, 0x15, 0x1f, 0xee, 0xec, 0x68, 0x90, 0x99, 0x9e, 0x36,
-  0x75, 0x71, 0x19, 0xc0, 0x01, 0x72, 0x11, 0xb4, 0x5e, 0x80, 0x00, 0x38, 0xdd, 0xda, 0xb6, 0x9f,
-  0x5f, 0x3f, 0xf3, 0x2a, 0x3d, 0x03, 0xc3, 0x74, 0x1e, 0xfc, 0x0a, 0xac, 0x43, 0x55, 0xa7, 0xe2,
-  0xea, 0xf8, 0xf5, 0x9b, 0x98, 0xb5, 0x3b, 0xb3, 0xc5, 0xcb, 0x32, 0xe6, 0x24, 0x40, 0x68, 0x1d,
-  0xf3, 0xea, 0x7c, 0x66, 0x56, 0x1b, 0x6e, 0x98, 0x99, 0x66, 0x56, 0x5a, 0x78, 0xeb, 0x9d, 0x8f,
-  0xe9, 0xec, 0x3c, 0x01, 0x5a, 0x91, 0xc9, 0xa4, 0xf1, 0x13, 0x1e, 0x83, 0x83, 0x79, 0x10, 0x41,
-  0x24, 0x26, 0xb6, 0xf6, 0xbf, 0xb9, 0xa2, 0x24, 0xae, 0x09, 0x0e, 0xc7, 0xae, 0xdd, 0x1d, 0xbc,
-  0xbb, 0xb7, 0x83, 0x28, 0x5f, 0x80, 0x84, 0x41, 0xaa, 0x52, 0x28, 0xe0, 0xdc, 0xc7, 0x90, 0x4c,
-  0xbc, 0x8c, 0x26, 0x00, 0xfe, 0xef, 0x01, 0xfe, 0x33, 0x00, 0x06, 0x3c, 0x35, 0x30, 0xad, 0xb0,
-  0x66, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-
-#endif /* FAVICON_RES_H */
@@ -1,169 +0,0 @@
-/**
-  **********************************************************************************************************************
-  * @file    html_res.h
-  * @author  MCD Application Team
-  * @brief   This file implements the web page html resources
-  **********************************************************************************************************************
-  * @attention
-  *
-  * Copyright (c) 2021 STMicroelectronics.
-  * All rights reserved.
-  *
-  * This software is licensed under terms that can be found in the LICENSE file
-  * in the root directory of this software component.
-  * If no LICENSE file comes with this software, it is provided AS-IS.
-  *
-  **********************************************************************************************************************
-  */
-
-/* Define to prevent recursive inclusion -----------------------------------------------------------------------------*/
-#ifndef HTML_RES_H
-#define HTML_RES_H
-
-/* Exported variables ------------------------------------------------------------------------------------------------*/
-/* Web page html resources buffer */
-static const char html_buff[] =
-{
-  0x3C, 0x21, 0x64, 0x6F, 0x63, 0x74, 0x79, 0x70, 0x65, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x3C,
-  0x68, 0x74, 0x6D, 0x6C, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3D, 0x22, 0x65, 0x6E, 0x22, 0x20, 0x63,
-  0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x70, 0x65, 0x72, 0x66, 0x65, 0x63, 0x74, 0x2D, 0x73, 0x63,
-  0x72, 0x6F, 0x6C, 0x6C, 0x62, 0x61, 0x72, 0x2D, 0x6F, 0x66, 0x66, 0x22, 0x3E, 0x3C, 0x68, 0x65,
-  0x61, 0x64, 0x3E, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74,
-  0x3D, 0x22, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2F, 0x3E, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20,
-  0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x20,
-  0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x64,
-  0x65, 0x76, 0x69, 0x63, 0x65, 0x2D, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x69, 0x6E, 0x69, 0x74,
-  0x69, 0x61, 0x6C, 0x2D, 0x73, 0x63, 0x61, 0x6C, 0x65, 0x3D, 0x31, 0x2C, 0x73, 0x68, 0x72, 0x69,
-  0x6E, 0x6B, 0x2D, 0x74, 0x6F, 0x2D, 0x66, 0x69, 0x74, 0x3D, 0x6E, 0x6F, 0x22, 0x2F, 0x3E, 0x3C,
-  0x6D, 0x65, 0x74, 0x61, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x74, 0x68, 0x65, 0x6D, 0x65,
-  0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x22, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D,
-  0x22, 0x23, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x2F, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B,
-  0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74, 0x22, 0x20,
-  0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F, 0x6D, 0x61, 0x6E, 0x69, 0x66, 0x65, 0x73, 0x74,
-  0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x2F, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65,
-  0x6C, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x73, 0x3D, 0x22,
-  0x37, 0x36, 0x78, 0x37, 0x36, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x69, 0x6D, 0x61,
-  0x67, 0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F,
-  0x66, 0x61, 0x76, 0x69, 0x63, 0x6F, 0x6E, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x2F, 0x3E, 0x3C, 0x74,
-  0x69, 0x74, 0x6C, 0x65, 0x3E, 0x53, 0x54, 0x4D, 0x33, 0x32, 0x55, 0x35, 0x20, 0x57, 0x65, 0x62,
-  0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x44, 0x65, 0x6D, 0x6F, 0x3C, 0x2F, 0x74, 0x69, 0x74,
-  0x6C, 0x65, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x2E,
-  0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x63, 0x73, 0x73, 0x2F, 0x63, 0x68, 0x75, 0x6E,
-  0x6B, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C,
-  0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3E, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x68, 0x72,
-  0x65, 0x66, 0x3D, 0x22, 0x2E, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x63, 0x73, 0x73,
-  0x2F, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22,
-  0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x68, 0x65,
-  0x61, 0x64, 0x3E, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x3C, 0x6E, 0x6F, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x3E, 0x59, 0x6F, 0x75, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65,
-  0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x4A, 0x61, 0x76, 0x61, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74,
-  0x20, 0x74, 0x6F, 0x20, 0x72, 0x75, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x61, 0x70, 0x70,
-  0x2E, 0x3C, 0x2F, 0x6E, 0x6F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C, 0x64, 0x69, 0x76,
-  0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x6F, 0x6F, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76,
-  0x3E, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-  0x28, 0x72, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6E, 0x2C, 0x61, 0x2C,
-  0x6C, 0x3D, 0x72, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x3D, 0x72, 0x5B, 0x31, 0x5D, 0x2C, 0x66, 0x3D,
-  0x72, 0x5B, 0x32, 0x5D, 0x2C, 0x70, 0x3D, 0x30, 0x2C, 0x73, 0x3D, 0x5B, 0x5D, 0x3B, 0x70, 0x3C,
-  0x6C, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x70, 0x2B, 0x2B, 0x29, 0x61, 0x3D, 0x6C,
-  0x5B, 0x70, 0x5D, 0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F,
-  0x74, 0x79, 0x70, 0x65, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65,
-  0x72, 0x74, 0x79, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6F, 0x2C, 0x61, 0x29, 0x26, 0x26, 0x6F,
-  0x5B, 0x61, 0x5D, 0x26, 0x26, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6F, 0x5B, 0x61, 0x5D,
-  0x5B, 0x30, 0x5D, 0x29, 0x2C, 0x6F, 0x5B, 0x61, 0x5D, 0x3D, 0x30, 0x3B, 0x66, 0x6F, 0x72, 0x28,
-  0x6E, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72,
-  0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72,
-  0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x63, 0x2C, 0x6E, 0x29,
-  0x26, 0x26, 0x28, 0x65, 0x5B, 0x6E, 0x5D, 0x3D, 0x63, 0x5B, 0x6E, 0x5D, 0x29, 0x3B, 0x66, 0x6F,
-  0x72, 0x28, 0x69, 0x26, 0x26, 0x69, 0x28, 0x72, 0x29, 0x3B, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67,
-  0x74, 0x68, 0x3B, 0x29, 0x73, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x28, 0x29, 0x3B,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x75, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2E, 0x61, 0x70,
-  0x70, 0x6C, 0x79, 0x28, 0x75, 0x2C, 0x66, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2C, 0x74, 0x28, 0x29,
-  0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x28, 0x29, 0x7B, 0x66, 0x6F,
-  0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x72, 0x3D, 0x30, 0x3B, 0x72, 0x3C, 0x75, 0x2E,
-  0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x72, 0x2B, 0x2B, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28,
-  0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x75, 0x5B, 0x72, 0x5D, 0x2C, 0x6E, 0x3D, 0x21, 0x30, 0x2C,
-  0x6C, 0x3D, 0x31, 0x3B, 0x6C, 0x3C, 0x74, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x6C,
-  0x2B, 0x2B, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x74, 0x5B, 0x6C, 0x5D, 0x3B, 0x30,
-  0x21, 0x3D, 0x3D, 0x6F, 0x5B, 0x63, 0x5D, 0x26, 0x26, 0x28, 0x6E, 0x3D, 0x21, 0x31, 0x29, 0x7D,
-  0x6E, 0x26, 0x26, 0x28, 0x75, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x72, 0x2D, 0x2D,
-  0x2C, 0x31, 0x29, 0x2C, 0x65, 0x3D, 0x61, 0x28, 0x61, 0x2E, 0x73, 0x3D, 0x74, 0x5B, 0x30, 0x5D,
-  0x29, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x76, 0x61, 0x72, 0x20,
-  0x6E, 0x3D, 0x7B, 0x7D, 0x2C, 0x6F, 0x3D, 0x7B, 0x31, 0x3A, 0x30, 0x7D, 0x2C, 0x75, 0x3D, 0x5B,
-  0x5D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x28, 0x72, 0x29, 0x7B,
-  0x69, 0x66, 0x28, 0x6E, 0x5B, 0x72, 0x5D, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E,
-  0x5B, 0x72, 0x5D, 0x2E, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3B, 0x76, 0x61, 0x72, 0x20,
-  0x74, 0x3D, 0x6E, 0x5B, 0x72, 0x5D, 0x3D, 0x7B, 0x69, 0x3A, 0x72, 0x2C, 0x6C, 0x3A, 0x21, 0x31,
-  0x2C, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3A, 0x7B, 0x7D, 0x7D, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x72, 0x5D, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x2E,
-  0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x2C, 0x74, 0x2C, 0x74, 0x2E, 0x65, 0x78, 0x70, 0x6F,
-  0x72, 0x74, 0x73, 0x2C, 0x61, 0x29, 0x2C, 0x74, 0x2E, 0x6C, 0x3D, 0x21, 0x30, 0x2C, 0x74, 0x2E,
-  0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x7D, 0x61, 0x2E, 0x6D, 0x3D, 0x65, 0x2C, 0x61, 0x2E,
-  0x63, 0x3D, 0x6E, 0x2C, 0x61, 0x2E, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x2C, 0x72, 0x2C, 0x74, 0x29, 0x7B, 0x61, 0x2E, 0x6F, 0x28, 0x65, 0x2C, 0x72, 0x29,
-  0x7C, 0x7C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50,
-  0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x72, 0x2C, 0x7B, 0x65, 0x6E, 0x75,
-  0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x67, 0x65, 0x74, 0x3A, 0x74,
-  0x7D, 0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-  0x28, 0x65, 0x29, 0x7B, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 0x21,
-  0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x26, 0x26,
-  0x53, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54,
-  0x61, 0x67, 0x26, 0x26, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E,
-  0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x53, 0x79, 0x6D, 0x62,
-  0x6F, 0x6C, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x54, 0x61, 0x67, 0x2C, 0x7B,
-  0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x22, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x22, 0x7D, 0x29,
-  0x2C, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50, 0x72,
-  0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x65, 0x2C, 0x22, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F,
-  0x64, 0x75, 0x6C, 0x65, 0x22, 0x2C, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x21, 0x30, 0x7D,
-  0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x74, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28,
-  0x65, 0x2C, 0x72, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x26, 0x72, 0x26, 0x26, 0x28, 0x65, 0x3D,
-  0x61, 0x28, 0x65, 0x29, 0x29, 0x2C, 0x38, 0x26, 0x72, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-  0x20, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x34, 0x26, 0x72, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x26, 0x26, 0x65,
-  0x26, 0x26, 0x65, 0x2E, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x29, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x74, 0x3D, 0x4F, 0x62,
-  0x6A, 0x65, 0x63, 0x74, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x28, 0x6E, 0x75, 0x6C, 0x6C,
-  0x29, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x72, 0x28, 0x74, 0x29, 0x2C, 0x4F, 0x62, 0x6A, 0x65,
-  0x63, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74,
-  0x79, 0x28, 0x74, 0x2C, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x22, 0x2C, 0x7B, 0x65,
-  0x6E, 0x75, 0x6D, 0x65, 0x72, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x21, 0x30, 0x2C, 0x76, 0x61, 0x6C,
-  0x75, 0x65, 0x3A, 0x65, 0x7D, 0x29, 0x2C, 0x32, 0x26, 0x72, 0x26, 0x26, 0x22, 0x73, 0x74, 0x72,
-  0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x29, 0x66,
-  0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x29, 0x61, 0x2E,
-  0x64, 0x28, 0x74, 0x2C, 0x6E, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x72,
-  0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x72, 0x5D, 0x7D, 0x2E, 0x62,
-  0x69, 0x6E, 0x64, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x6E, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6E, 0x20, 0x74, 0x7D, 0x2C, 0x61, 0x2E, 0x6E, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74,
-  0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x72, 0x3D, 0x65, 0x26, 0x26,
-  0x65, 0x2E, 0x5F, 0x5F, 0x65, 0x73, 0x4D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x3F, 0x66, 0x75, 0x6E,
-  0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65,
-  0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x3B, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x64, 0x28, 0x72, 0x2C, 0x22, 0x61, 0x22, 0x2C,
-  0x72, 0x29, 0x2C, 0x72, 0x7D, 0x2C, 0x61, 0x2E, 0x6F, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69,
-  0x6F, 0x6E, 0x28, 0x65, 0x2C, 0x72, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4F,
-  0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E,
-  0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2E, 0x63,
-  0x61, 0x6C, 0x6C, 0x28, 0x65, 0x2C, 0x72, 0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x70, 0x3D, 0x22, 0x2E,
-  0x2F, 0x22, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77,
-  0x65, 0x62, 0x70, 0x61, 0x63, 0x6B, 0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B,
-  0x2D, 0x64, 0x61, 0x73, 0x68, 0x62, 0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74,
-  0x22, 0x5D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x22, 0x77, 0x65, 0x62, 0x70, 0x61, 0x63, 0x6B,
-  0x4A, 0x73, 0x6F, 0x6E, 0x70, 0x62, 0x6C, 0x61, 0x63, 0x6B, 0x2D, 0x64, 0x61, 0x73, 0x68, 0x62,
-  0x6F, 0x61, 0x72, 0x64, 0x2D, 0x72, 0x65, 0x61, 0x63, 0x74, 0x22, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D,
-  0x2C, 0x63, 0x3D, 0x6C, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x28, 0x6C,
-  0x29, 0x3B, 0x6C, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x3D, 0x72, 0x2C, 0x6C, 0x3D, 0x6C, 0x2E, 0x73,
-  0x6C, 0x69, 0x63, 0x65, 0x28, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x66,
-  0x3D, 0x30, 0x3B, 0x66, 0x3C, 0x6C, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x66, 0x2B,
-  0x2B, 0x29, 0x72, 0x28, 0x6C, 0x5B, 0x66, 0x5D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3D,
-  0x63, 0x3B, 0x74, 0x28, 0x29, 0x7D, 0x28, 0x5B, 0x5D, 0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-  0x70, 0x74, 0x3E, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22,
-  0x2E, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2F, 0x6A, 0x73, 0x2F, 0x63, 0x68, 0x75, 0x6E,
-  0x6B, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C,
-  0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x2E, 0x2F, 0x73, 0x74,
-  0x61, 0x74, 0x69, 0x63, 0x2F, 0x6A, 0x73, 0x2F, 0x6D, 0x61, 0x69, 0x6E, 0x2E, 0x6A, 0x73, 0x22,
-  0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79,
-  0x3E, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E
-};
-
-#endif /* HTML_RES_H */
@@ -0,0 +1,37 @@
+/**
+  **********************************************************************************************************************
+  * @file    res_pack.s
+  * @author  MCD Application Team
+  * @brief   This file links the web page resources pack, built from the Fs folder by Utilities/res_pack.py
+  **********************************************************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  **********************************************************************************************************************
+  */
+
+  .syntax unified
+
+/* The pack is read in place, its fields are 4 bytes aligned. The path is relative to the build directory. */
+  .section .rodata.res_pack,"a",%progbits
+  .balign 4
+  .global res_pack
+  .type   res_pack, %object
+res_pack:
+  .incbin "../../WebServer/App/web_addons/res_pack.bin"
+res_pack_end:
+  .size   res_pack, . - res_pack
+
+  .section .rodata.res_pack_size,"a",%progbits
+  .balign 4
+  .global res_pack_size
+  .type   res_pack_size, %object
+res_pack_size:
+  .word   res_pack_end - res_pack
+  .size   res_pack_size, . - res_pack_size
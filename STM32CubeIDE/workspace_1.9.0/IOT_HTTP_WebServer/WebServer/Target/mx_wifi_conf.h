@@ -143,12 +143,30 @@ int32_t mxwifi_probe(void **ll_drv_context);
 #define MX_WIFI_TX_BUFFER_NO_COPY                   (1)
 #endif /* MX_WIFI_TX_BUFFER_NO_COPY */
 
+/* Socket send frames, kept for the driver lifetime: a send builds its IPC command in one of them instead of allocating */
+/* and copying it, a send finding none free falls back to an allocated one                                             */
+#ifndef MX_WIFI_TX_FRAME_NBR
+#define MX_WIFI_TX_FRAME_NBR                        (2)
+#endif /* MX_WIFI_TX_FRAME_NBR */
+
+/* Socket send fragments in flight: a send larger than one IPC command is split, the next fragments going while the */
+/* module answers the first, blocking or not. It fails as a whole if the module takes bytes past one not sent in    */
+/* full. 1 sends one fragment after the other                                                                       */
+#ifndef MX_WIFI_TX_WINDOW
+#define MX_WIFI_TX_WINDOW                           (MX_WIFI_TX_FRAME_NBR)
+#endif /* MX_WIFI_TX_WINDOW */
+
 
 /* Sizeof the circular buffer for Uart mode, when buffer is half full data are transmitted to next stage */
 #ifndef MX_CIRCULAR_UART_RX_BUFFER_SIZE
 #define MX_CIRCULAR_UART_RX_BUFFER_SIZE             (400)
 #endif /* MX_CIRCULAR_UART_RX_BUFFER_SIZE */
 
+/* Size of the buffer SLIP frames are encoded to in Uart mode, sent each time it is full */
+#ifndef MX_WIFI_UART_TX_BUFFER_SIZE
+#define MX_WIFI_UART_TX_BUFFER_SIZE                 (256)
+#endif /* MX_WIFI_UART_TX_BUFFER_SIZE */
+
 
 #ifndef MX_STAT_ON
 #define MX_STAT_ON                                  (0)
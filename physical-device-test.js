@@ -11,7 +11,7 @@ function sleep(ms) {
 async function readSensor(ip, sensor) {
   const client = new PromiseSocket()
   await client.connect(80, ip)
-  await client.writeAll('GET /Read_' + sensor + ' HTTP/1.0\r\n', 1024)
+  await client.writeAll('GET /Read_' + sensor + ' HTTP/1.0\r\n\r\n', 1024)
   const result = await client.readAll()
   await sleep(500)
   client.destroy()